@@ -111,6 +111,7 @@ CPU_ISR  NetDev_WiFiISR_Handler_PMOD1_GT202   (void);
 #elif BSP_CFG_GT202_PMOD2 > 0
 CPU_ISR  NetDev_WiFiISR_Handler_PMOD2_GT202   (void);
 #endif
+CPU_ISR  NetDev_WiFiISR_Handler_DMA_GT202     (void);
 #endif
 
 
@@ -62,16 +62,63 @@
 #include  <os.h>
 #include  <iorx651.h>
 #include  <bsp_os.h>
-#include  <IF\net_if_wifi.h>
+#include  <IF/net_if_wifi.h>
 #include  <bsp_clk.h>
+#include  <KAL/kal.h>
 
 
 /*
 *********************************************************************************************************
 *                                            LOCAL DEFINES
+*
+* Note(s) : (1) SPI transfers of at least NET_BSP_GT202_SPI_DMA_LEN_MIN octets are moved by DMAC channel 0
+*               (transmit) & DMAC channel 1 (receive), activated by the RSPI transmit-buffer-empty & receive-
+*               buffer-full requests.  Shorter register & command tokens remain CPU-polled since programming
+*               both DMAC channels would cost more than the transfer itself.
+*
+*           (2) The DMAC moves single octets to & from the RSPI data register, which requires byte access to
+*               'SPDR' (RSPI Data Control Register 'SPBYT' bit).  'iorx651.h' does NOT name this bit.
 *********************************************************************************************************
 */
 
+#ifdef  NET_IF_WIFI_MODULE_EN
+                                                                /* -------------------- SPI DMA CFG ------------------- */
+#define  NET_BSP_GT202_SPI_DMA_LEN_MIN                    32u   /* Min xfer len to move by DMAC (see Note #1).          */
+#define  NET_BSP_GT202_SPI_DMA_TIMEOUT_MS                100u   /* Max time to wait for a DMAC xfer to complete.        */
+#define  NET_BSP_GT202_SPI_DMA_SEM_NAME          "GT202 SPI DMA"
+
+#define  NET_BSP_GT202_RSPI_SPDCR_SPBYT           DEF_BIT_06    /* See Note #2.                                         */
+
+#define  NET_BSP_GT202_DMAC_MD_NORMAL                      0u   /* Normal xfer mode.                                    */
+#define  NET_BSP_GT202_DMAC_DTS_NONE                       2u   /* No repeat/block area.                                */
+#define  NET_BSP_GT202_DMAC_SZ_08                          0u   /*  8-bit xfer unit.                                    */
+#define  NET_BSP_GT202_DMAC_DCTG_PERIPH                    1u   /* Activated by peripheral int req.                     */
+#define  NET_BSP_GT202_DMAC_ADDR_FIXED                     0u   /* Addr fixed.                                          */
+#define  NET_BSP_GT202_DMAC_ADDR_INCR                      2u   /* Addr incremented after each xfer.                    */
+
+#if BSP_CFG_GT202_ON_BOARD > 0
+#define  NET_BSP_GT202_RSPI                            RSPI1
+#define  NET_BSP_GT202_RSPI_VECT_TX         VECT_RSPI1_SPTI1
+#define  NET_BSP_GT202_RSPI_VECT_RX         VECT_RSPI1_SPRI1
+#define  NET_BSP_GT202_RSPI_IEN_TX         IEN(RSPI1, SPTI1)
+#define  NET_BSP_GT202_RSPI_IEN_RX         IEN(RSPI1, SPRI1)
+
+#elif BSP_CFG_GT202_PMOD1 > 0
+#define  NET_BSP_GT202_RSPI                            RSPI0
+#define  NET_BSP_GT202_RSPI_VECT_TX         VECT_RSPI0_SPTI0
+#define  NET_BSP_GT202_RSPI_VECT_RX         VECT_RSPI0_SPRI0
+#define  NET_BSP_GT202_RSPI_IEN_TX         IEN(RSPI0, SPTI0)
+#define  NET_BSP_GT202_RSPI_IEN_RX         IEN(RSPI0, SPRI0)
+
+#elif BSP_CFG_GT202_PMOD2 > 0
+#define  NET_BSP_GT202_RSPI                            RSPI1
+#define  NET_BSP_GT202_RSPI_VECT_TX         VECT_RSPI1_SPTI1
+#define  NET_BSP_GT202_RSPI_VECT_RX         VECT_RSPI1_SPRI1
+#define  NET_BSP_GT202_RSPI_IEN_TX         IEN(RSPI1, SPTI1)
+#define  NET_BSP_GT202_RSPI_IEN_RX         IEN(RSPI1, SPRI1)
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -104,6 +151,12 @@
 
 CPU_BOOLEAN  SPI_LOCK;
 
+#ifdef  NET_IF_WIFI_MODULE_EN
+static  KAL_SEM_HANDLE  NetDev_WiFi_GT202_SPI_DMA_Sem;         /* Signaled by DMAC rx chan xfer end.                   */
+static  CPU_INT08U      NetDev_WiFi_GT202_SPI_DMA_DummyWr = 0xFFu;  /* Tx'd when no wr buf is given.                  */
+static  CPU_INT08U      NetDev_WiFi_GT202_SPI_DMA_DummyRd;     /* Rx'd when no rd buf is given.                        */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -200,6 +253,15 @@ static  void     NetDev_WiFi_GT202_SPI_Lock               (NET_IF
 
 static  void     NetDev_WiFi_GT202_SPI_Unlock             (NET_IF                          *p_if);
 
+static  void     NetDev_WiFi_GT202_SPI_DMA_Init           (NET_ERR                         *p_err);
+
+static  void     NetDev_WiFi_GT202_SPI_WrRd_DMA           (CPU_INT08U                      *p_buf_wr,
+                                                           CPU_INT08U                      *p_buf_rd,
+                                                           CPU_INT16U                       len,
+                                                           NET_ERR                         *p_err);
+
+        CPU_ISR  NetDev_WiFiISR_Handler_DMA_GT202         (void);
+
 #if BSP_CFG_GT202_ON_BOARD > 0
 static  void     NetDev_WiFi_GT202_OnBoard_CfgGPIO        (NET_IF                          *p_if,
                                                            NET_ERR                         *p_err);
@@ -798,6 +860,7 @@ static  void  NetDev_WiFi_GT202_PMOD2_IntCtrl (NET_IF       *p_if,
 *               p_err   Pointer to variable  that will receive the return error code from this function :
 *
 *                           NET_DEV_ERR_NONE
+*                           NET_DEV_ERR_INIT
 *
 * Return(s)   : none.
 *
@@ -807,6 +870,9 @@ static  void  NetDev_WiFi_GT202_PMOD2_IntCtrl (NET_IF       *p_if,
 *               application function(s)
 *
 * Note(s)     : (1) This function is called only when the wireless network interface is added.
+*
+*               (2) The DMAC channels used for long SPI transfers are configured along with the RSPI unit
+*                   (see 'NetDev_WiFi_GT202_SPI_DMA_Init()').
 *********************************************************************************************************
 */
 #if BSP_CFG_GT202_ON_BOARD > 0
@@ -828,7 +894,7 @@ static  void  NetDev_WiFi_GT202_OnBoard_SPI_Init (NET_IF   *p_if,
     BSP_Register_Protect(PRC1_OP_MODES, WRITE_DISABLED);        /* Disable writing to Operation Mode registers.         */
     CPU_CRITICAL_EXIT();
 
-   *p_err = NET_DEV_ERR_NONE;
+    NetDev_WiFi_GT202_SPI_DMA_Init(p_err);                      /* See Note #2.                                         */
 }
 
 #elif BSP_CFG_GT202_PMOD1 > 0
@@ -850,7 +916,7 @@ static  void  NetDev_WiFi_GT202_PMOD1_SPI_Init (NET_IF   *p_if,
     BSP_Register_Protect(PRC1_OP_MODES, WRITE_DISABLED);        /* Disable writing to Operation Mode registers.         */
     CPU_CRITICAL_EXIT();
 
-   *p_err = NET_DEV_ERR_NONE;
+    NetDev_WiFi_GT202_SPI_DMA_Init(p_err);                      /* See Note #2.                                         */
 }
 
 #elif BSP_CFG_GT202_PMOD2 > 0
@@ -872,7 +938,7 @@ static  void  NetDev_WiFi_GT202_PMOD2_SPI_Init (NET_IF   *p_if,
     BSP_Register_Protect(PRC1_OP_MODES, WRITE_DISABLED);        /* Disable writing to Operation Mode registers.         */
     CPU_CRITICAL_EXIT();
 
-   *p_err = NET_DEV_ERR_NONE;
+    NetDev_WiFi_GT202_SPI_DMA_Init(p_err);                      /* See Note #2.                                         */
 }
 #endif
 
@@ -964,6 +1030,7 @@ static  void  NetDev_WiFi_GT202_SPI_Unlock (NET_IF  *p_if)
 *               p_err   Pointer to variable  that will receive the return error code from this function :
 *
 *                           NET_DEV_ERR_NONE
+*                           NET_DEV_ERR_FAULT
 *
 * Return(s)   : none.
 *
@@ -972,7 +1039,9 @@ static  void  NetDev_WiFi_GT202_SPI_Unlock (NET_IF  *p_if)
 *               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) Transfers of at least NET_BSP_GT202_SPI_DMA_LEN_MIN octets are handed to the DMAC & the
+*                   calling task pends until the transfer completes instead of polling each octet with
+*                   interrupts disabled (see 'LOCAL DEFINES  Note #1').
 *********************************************************************************************************
 */
 #if BSP_CFG_GT202_ON_BOARD > 0
@@ -993,6 +1062,12 @@ static  void  NetDev_WiFi_GT202_OnBoard_SPI_WrRd (NET_IF      *p_if,
 
 
     UNUSED_PARAM(p_if);                                         /* Prevent 'variable unused' compiler warning           */
+
+    if (wr_rd_len >= NET_BSP_GT202_SPI_DMA_LEN_MIN) {           /* See Note #1.                                         */
+        NetDev_WiFi_GT202_SPI_WrRd_DMA(p_buf_wr, p_buf_rd, wr_rd_len, p_err);
+        return;
+    }
+
                                                                 /* Determine buffer pointer incrementation size.        */
     ptr_incr_wr = ptr_incr_rd = 1u;
 
@@ -1065,6 +1140,12 @@ static  void  NetDev_WiFi_GT202_PMOD1_SPI_WrRd (NET_IF      *p_if,
 
 
     UNUSED_PARAM(p_if);                                         /* Prevent 'variable unused' compiler warning           */
+
+    if (wr_rd_len >= NET_BSP_GT202_SPI_DMA_LEN_MIN) {           /* See Note #1.                                         */
+        NetDev_WiFi_GT202_SPI_WrRd_DMA(p_buf_wr, p_buf_rd, wr_rd_len, p_err);
+        return;
+    }
+
                                                                 /* Determine buffer pointer incrementation size.        */
     ptr_incr_wr = ptr_incr_rd = 1u;
 
@@ -1137,6 +1218,12 @@ static  void  NetDev_WiFi_GT202_PMOD2_SPI_WrRd (NET_IF      *p_if,
 
 
     UNUSED_PARAM(p_if);                                         /* Prevent 'variable unused' compiler warning           */
+
+    if (wr_rd_len >= NET_BSP_GT202_SPI_DMA_LEN_MIN) {           /* See Note #1.                                         */
+        NetDev_WiFi_GT202_SPI_WrRd_DMA(p_buf_wr, p_buf_rd, wr_rd_len, p_err);
+        return;
+    }
+
                                                                 /* Determine buffer pointer incrementation size.        */
     ptr_incr_wr = ptr_incr_rd = 1u;
 
@@ -1192,6 +1279,205 @@ static  void  NetDev_WiFi_GT202_PMOD2_SPI_WrRd (NET_IF      *p_if,
 }
 #endif
 
+/*
+*********************************************************************************************************
+*                                  NetDev_WiFi_GT202_SPI_DMA_Init()
+*
+* Description : (1) Initialize DMAC channels used for long SPI transfers :
+*
+*                   (a) Create DMAC transfer end signal
+*                   (b) Wake DMAC unit from standby mode
+*                   (c) Configure DMAC activation sources & transfer modes
+*                   (d) Configure DMAC transfer end interrupt
+*
+*
+* Argument(s) : p_err   Pointer to variable  that will receive the return error code from this function :
+*
+*                           NET_DEV_ERR_NONE
+*                           NET_DEV_ERR_INIT
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_WiFi_GT202_OnBoard_SPI_Init(),
+*               NetDev_WiFi_GT202_PMOD1_SPI_Init(),
+*               NetDev_WiFi_GT202_PMOD2_SPI_Init().
+*
+* Note(s)     : (2) Only the receive channel signals transfer end since the last octet is received after
+*                   the last octet is transmitted.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_WiFi_GT202_SPI_DMA_Init (NET_ERR  *p_err)
+{
+    RTOS_ERR  err_kal;
+    CPU_SR_ALLOC();
+
+
+                                                                /* ---------------- CREATE XFER SIGNAL ---------------- */
+    NetDev_WiFi_GT202_SPI_DMA_Sem = KAL_SemCreate((const CPU_CHAR *)NET_BSP_GT202_SPI_DMA_SEM_NAME,
+                                                                    DEF_NULL,
+                                                                   &err_kal);
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_INIT;
+        return;
+    }
+
+                                                                /* ------------------- WAKE DMAC UNIT ----------------- */
+    CPU_CRITICAL_ENTER();
+    BSP_Register_Protect(PRC0_CLOCK_GEN, WRITE_ENABLED);        /* Enable writing to Clock Generation registers.        */
+    BSP_Register_Protect(PRC1_OP_MODES, WRITE_ENABLED);         /* Enable writing to Operation Mode registers.          */
+
+    MSTP(DMAC) = 0u;                                            /* Wake DMAC unit from standby mode                     */
+
+    BSP_Register_Protect(PRC0_CLOCK_GEN, WRITE_DISABLED);       /* Disable writing to Clock Generation registers.       */
+    BSP_Register_Protect(PRC1_OP_MODES, WRITE_DISABLED);        /* Disable writing to Operation Mode registers.         */
+    CPU_CRITICAL_EXIT();
+
+                                                                /* -------------------- CFG TX CHAN ------------------- */
+    DMAC0.DMCNT.BIT.DTE  = 0u;
+    ICU.DMRSR0           = NET_BSP_GT202_RSPI_VECT_TX;          /* Activated by RSPI tx buf empty.                      */
+    DMAC0.DMTMD.BIT.MD   = NET_BSP_GT202_DMAC_MD_NORMAL;
+    DMAC0.DMTMD.BIT.DTS  = NET_BSP_GT202_DMAC_DTS_NONE;
+    DMAC0.DMTMD.BIT.SZ   = NET_BSP_GT202_DMAC_SZ_08;
+    DMAC0.DMTMD.BIT.DCTG = NET_BSP_GT202_DMAC_DCTG_PERIPH;
+    DMAC0.DMINT.BYTE     = 0u;                                  /* No tx xfer end int (see Note #2).                    */
+
+                                                                /* -------------------- CFG RX CHAN ------------------- */
+    DMAC1.DMCNT.BIT.DTE  = 0u;
+    ICU.DMRSR1           = NET_BSP_GT202_RSPI_VECT_RX;          /* Activated by RSPI rx buf full.                       */
+    DMAC1.DMTMD.BIT.MD   = NET_BSP_GT202_DMAC_MD_NORMAL;
+    DMAC1.DMTMD.BIT.DTS  = NET_BSP_GT202_DMAC_DTS_NONE;
+    DMAC1.DMTMD.BIT.SZ   = NET_BSP_GT202_DMAC_SZ_08;
+    DMAC1.DMTMD.BIT.DCTG = NET_BSP_GT202_DMAC_DCTG_PERIPH;
+    DMAC1.DMINT.BYTE     = 0u;
+    DMAC1.DMINT.BIT.DTIE = 1u;                                  /* Signal xfer end (see Note #2).                       */
+
+                                                                /* --------------- CFG XFER END INT ------------------- */
+    IPR(DMAC, DMAC1I) = 0x1;                                    /* Set IPL to lowest setting.                           */
+    IR (DMAC, DMAC1I) =   0;                                    /* Clear any pending interrupt.                         */
+
+    BSP_IntVectSet(VECT_DMAC_DMAC1I, (CPU_FNCT_VOID)NetDev_WiFiISR_Handler_DMA_GT202);
+
+    IEN(DMAC, DMAC1I) =   1;                                    /* Enable interrupt source.                             */
+
+    DMAC.DMAST.BIT.DMST = 1u;                                   /* Enable DMAC unit.                                    */
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  NetDev_WiFi_GT202_SPI_WrRd_DMA()
+*
+* Description : Write and read from SPI using the DMAC.
+*
+* Argument(s) : p_buf_wr    Pointer to buffer to write (see Note #1).
+*
+*               p_buf_rd    Pointer to buffer for data read (see Note #1).
+*
+*               len         Number of octets to write and read.
+*
+*               p_err   Pointer to variable  that will receive the return error code from this function :
+*
+*                           NET_DEV_ERR_NONE
+*                           NET_DEV_ERR_FAULT
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_WiFi_GT202_OnBoard_SPI_WrRd(),
+*               NetDev_WiFi_GT202_PMOD1_SPI_WrRd(),
+*               NetDev_WiFi_GT202_PMOD2_SPI_WrRd().
+*
+* Note(s)     : (1) If either buffer pointer is NULL, the matching DMAC channel is left on a fixed dummy
+*                   octet : all 1's are transmitted, or received data is discarded.
+*
+*               (2) RSPI transmit & receive requests are routed to the DMAC rather than to the CPU while
+*                   the DMAC channels are enabled.  The first transmit-buffer-empty request is raised when
+*                   the RSPI is enabled.
+*
+*               (3) The transfer end signal is cleared before the transfer starts so that a signal posted
+*                   by a previously aborted transfer cannot release this one early.
+*********************************************************************************************************
+*/
+
+static  void  NetDev_WiFi_GT202_SPI_WrRd_DMA (CPU_INT08U  *p_buf_wr,
+                                              CPU_INT08U  *p_buf_rd,
+                                              CPU_INT16U   len,
+                                              NET_ERR     *p_err)
+{
+    RTOS_ERR  err_kal;
+
+
+                                                                /* -------------------- CFG RX CHAN ------------------- */
+    DMAC1.DMSAR         = (void *)&NET_BSP_GT202_RSPI.SPDR;
+    DMAC1.DMAMD.BIT.SM  =  NET_BSP_GT202_DMAC_ADDR_FIXED;
+    if (p_buf_rd != DEF_NULL) {
+        DMAC1.DMDAR        = (void *)p_buf_rd;
+        DMAC1.DMAMD.BIT.DM =  NET_BSP_GT202_DMAC_ADDR_INCR;
+    } else {                                                    /* See Note #1.                                         */
+        DMAC1.DMDAR        = (void *)&NetDev_WiFi_GT202_SPI_DMA_DummyRd;
+        DMAC1.DMAMD.BIT.DM =  NET_BSP_GT202_DMAC_ADDR_FIXED;
+    }
+    DMAC1.DMCRA         =  len;
+
+                                                                /* -------------------- CFG TX CHAN ------------------- */
+    if (p_buf_wr != DEF_NULL) {
+        DMAC0.DMSAR        = (void *)p_buf_wr;
+        DMAC0.DMAMD.BIT.SM =  NET_BSP_GT202_DMAC_ADDR_INCR;
+    } else {                                                    /* See Note #1.                                         */
+        DMAC0.DMSAR        = (void *)&NetDev_WiFi_GT202_SPI_DMA_DummyWr;
+        DMAC0.DMAMD.BIT.SM =  NET_BSP_GT202_DMAC_ADDR_FIXED;
+    }
+    DMAC0.DMDAR         = (void *)&NET_BSP_GT202_RSPI.SPDR;
+    DMAC0.DMAMD.BIT.DM  =  NET_BSP_GT202_DMAC_ADDR_FIXED;
+    DMAC0.DMCRA         =  len;
+
+    KAL_SemSet(NetDev_WiFi_GT202_SPI_DMA_Sem, 0u, &err_kal);    /* See Note #3.                                         */
+    DMAC1.DMSTS.BIT.DTIF = 0u;
+    DMAC1.DMCNT.BIT.DTE  = 1u;
+    DMAC0.DMCNT.BIT.DTE  = 1u;
+
+                                                                /* --------------------- START XFER ------------------- */
+    NET_BSP_GT202_RSPI.SPDCR.BYTE |= NET_BSP_GT202_RSPI_SPDCR_SPBYT;
+    NET_BSP_GT202_RSPI_IEN_TX      = 1u;                        /* Route RSPI reqs to DMAC (see Note #2).               */
+    NET_BSP_GT202_RSPI_IEN_RX      = 1u;
+
+    NET_BSP_GT202_RSPI.SPCR2.BIT.SPIIE = 0;                     /* Disable idle interrupt.                              */
+    NET_BSP_GT202_RSPI.SPCR.BIT.SPTIE  = 1;                     /* Enable transmit interrupt request.                   */
+    NET_BSP_GT202_RSPI.SPCR.BIT.SPRIE  = 1;                     /* Enable receive  interrupt request.                   */
+    NET_BSP_GT202_RSPI.SPCR.BIT.SPE    = 1;                     /* Enable RSPI.                                         */
+
+                                                                /* ------------------ WAIT FOR XFER END --------------- */
+    KAL_SemPend(NetDev_WiFi_GT202_SPI_DMA_Sem,
+                KAL_OPT_PEND_NONE,
+                NET_BSP_GT202_SPI_DMA_TIMEOUT_MS,
+               &err_kal);
+
+    NET_BSP_GT202_RSPI.SPCR.BIT.SPTIE  = 0;                     /* Disable transmit interrupt request.                  */
+    NET_BSP_GT202_RSPI.SPCR.BIT.SPRIE  = 0;                     /* Disable receive  interrupt request.                  */
+    NET_BSP_GT202_RSPI_IEN_TX          = 0u;
+    NET_BSP_GT202_RSPI_IEN_RX          = 0u;
+
+    DMAC0.DMCNT.BIT.DTE = 0u;
+    DMAC1.DMCNT.BIT.DTE = 0u;
+
+    if (err_kal == KAL_ERR_NONE) {
+        while ((NET_BSP_GT202_RSPI.SPSR.BIT.IDLNF) != 0u);      /* Wait until SPI transfer is complete.                 */
+    }
+
+    NET_BSP_GT202_RSPI.SPCR.BIT.SPE    = 0;                     /* Disable RSPI.                                        */
+    NET_BSP_GT202_RSPI.SPDCR.BYTE     &= (CPU_INT08U)~NET_BSP_GT202_RSPI_SPDCR_SPBYT;
+
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_FAULT;
+        return;
+    }
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
 
 /*
 *********************************************************************************************************
@@ -1702,4 +1988,40 @@ CPU_ISR  NetDev_WiFiISR_Handler_PMOD2_GT202 (void)
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*                                  NetDev_WiFiISR_Handler_DMA_GT202()
+*
+* Description : BSP-level ISR handler for DMAC SPI receive channel transfer end.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU &/or device interrupts.
+*
+* Note(s)     : (1) Releases the task pending in 'NetDev_WiFi_GT202_SPI_WrRd_DMA()'.
+*********************************************************************************************************
+*/
+
+#if      __RENESAS__
+#pragma  interrupt   NetDev_WiFiISR_Handler_DMA_GT202
+#endif
+
+CPU_ISR  NetDev_WiFiISR_Handler_DMA_GT202 (void)
+{
+    RTOS_ERR  err_kal;
+
+
+    OSIntEnter();                                               /* Notify uC/OS-III or uC/OS-II of ISR entry            */
+    CPU_INT_GLOBAL_EN();                                        /* Reenable global interrupts                           */
+
+    DMAC1.DMSTS.BIT.DTIF = 0u;                                  /* Clear xfer end flag.                                 */
+                                                                /* See Note #1.                                         */
+    KAL_SemPost(NetDev_WiFi_GT202_SPI_DMA_Sem, KAL_OPT_POST_NONE, &err_kal);
+
+    OSIntExit();                                                /* Notify uC/OS-III or uC/OS-II of ISR exit             */
+}
+
 #endif
@@ -58,6 +58,22 @@
 *********************************************************************************************************
 */
 
+#define  APP_DHCP_C_LEASE_MAGIC                  0x4C534544u    /* Marks a valid kept lease ('LSED').                   */
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_DHCP_C_LEASE_KEEP_EN == DEF_ENABLED)
+typedef  struct  app_dhcp_c_lease_keep {
+    APP_KEEP_HDR  Hdr;                                          /* See 'app_keep.h  Note #2'.                           */
+    DHCPc_LEASE   Lease;                                        /* Kept lease.                                          */
+} APP_DHCP_C_LEASE_KEEP;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -65,6 +81,11 @@
 *********************************************************************************************************
 */
 
+#if (APP_CFG_DHCP_C_LEASE_KEEP_EN == DEF_ENABLED)
+static  APP_KEEP_NO_INIT  APP_DHCP_C_LEASE_KEEP  AppDHCPc_LeaseKeep;    /* NOT cleared on sw reset (see ...      */
+                                                                        /* ... 'AppDHCPc_Init()  Note #1b').     */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -79,6 +100,16 @@
 *********************************************************************************************************
 */
 
+#if (APP_CFG_DHCP_C_LEASE_KEEP_EN == DEF_ENABLED)
+#if (APP_CFG_KEEP_EN != DEF_ENABLED)
+#error  "APP_CFG_DHCP_C_LEASE_KEEP_EN        requires APP_CFG_KEEP_EN == DEF_ENABLED"
+#endif
+
+#if (DHCPc_CFG_INIT_REBOOT_EN != DEF_ENABLED)
+#error  "APP_CFG_DHCP_C_LEASE_KEEP_EN        requires DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED"
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -92,13 +123,23 @@
 *
 * Caller(s)   : App_TCPIP_Init().
 *
-* Note(s)     : none.
+* Note(s)     : (1) (a) If APP_CFG_DHCP_C_LEASE_KEEP_EN is enabled, the lease acquired by the DHCP client is
+*                       kept & re-confirmed with a single REQUEST on the next start (see 'dhcp-c.c
+*                       DHCPc_StartReboot()'), rather than negotiated again from DISCOVER.  The kept
+*                       address is NOT used until it is re-confirmed so that the lease read back once the
+*                       address is configured is always the server's current lease.
+*
+*                   (b) The lease is kept across a software reset only (see 'app_keep.h  Note #1'); when
+*                       none is kept, a new lease is negotiated.
 *********************************************************************************************************
 */
 
 CPU_BOOLEAN  AppDHCPc_Init (NET_IF_NBR  if_nbr)
 {
     DHCPc_OPT_CODE  req_param[DHCPc_CFG_PARAM_REQ_TBL_SIZE];
+#if (APP_CFG_DHCP_C_LEASE_KEEP_EN == DEF_ENABLED)
+    CPU_BOOLEAN     lease_kept;
+#endif
     CPU_BOOLEAN     cfg_done;
     CPU_BOOLEAN     dly;
     DHCPc_STATUS    dhcp_status;
@@ -126,10 +167,32 @@ CPU_BOOLEAN  AppDHCPc_Init (NET_IF_NBR  if_nbr)
                                                                 /* ----------- START INTERFACE'S DHCP CLIENT ---------- */
     req_param[0] = DHCP_OPT_DOMAIN_NAME_SERVER;
 
+#if (APP_CFG_DHCP_C_LEASE_KEEP_EN == DEF_ENABLED)               /* See Note #1.                                         */
+    lease_kept = AppKeep_Restore(&AppDHCPc_LeaseKeep.Hdr,       /* Invalidate kept lease until re-confirmed.            */
+                                 &AppDHCPc_LeaseKeep.Lease,
+                                  sizeof(AppDHCPc_LeaseKeep.Lease),
+                                  APP_DHCP_C_LEASE_MAGIC);
+
+    if (lease_kept == DEF_YES) {
+        APP_TRACE_INFO(("Re-confirm kept DHCP lease ...\n\r"));
+        DHCPc_StartReboot((NET_IF_NBR      ) if_nbr,
+                          (DHCPc_OPT_CODE *)&req_param[0],
+                          (CPU_INT08U      ) 1u,
+                          (DHCPc_LEASE    *)&AppDHCPc_LeaseKeep.Lease,
+                          (CPU_BOOLEAN     ) DEF_NO,     /* See Note #1a.                                        */
+                          (DHCPc_ERR      *)&err_dhcp);
+    } else {
+        DHCPc_Start((NET_IF_NBR      ) if_nbr,
+                    (DHCPc_OPT_CODE *)&req_param[0],
+                    (CPU_INT08U      ) 1u,
+                    (DHCPc_ERR      *)&err_dhcp);
+    }
+#else
     DHCPc_Start((NET_IF_NBR      ) if_nbr,
                 (DHCPc_OPT_CODE *)&req_param[0],
                 (CPU_INT08U      ) 1u,
                 (DHCPc_ERR      *)&err_dhcp);
+#endif
     if (err_dhcp != DHCPc_ERR_NONE) {
         APP_TRACE_INFO(("DHCPc_Start() failed w/err = %d \r\n", err_dhcp));
         return (DEF_FAIL);
@@ -153,6 +216,15 @@ CPU_BOOLEAN  AppDHCPc_Init (NET_IF_NBR  if_nbr)
         switch (dhcp_status) {
             case DHCP_STATUS_CFGD:
                  APP_TRACE_INFO(("DHCP address configured\n\r"));
+#if (APP_CFG_DHCP_C_LEASE_KEEP_EN == DEF_ENABLED)               /* Keep lease for next start (see Note #1).             */
+                 DHCPc_LeaseGet(if_nbr, &AppDHCPc_LeaseKeep.Lease, &err_dhcp);
+                 if (err_dhcp == DHCPc_ERR_NONE) {
+                     AppKeep_Commit(&AppDHCPc_LeaseKeep.Hdr,
+                                    &AppDHCPc_LeaseKeep.Lease,
+                                     sizeof(AppDHCPc_LeaseKeep.Lease),
+                                     APP_DHCP_C_LEASE_MAGIC);
+                 }
+#endif
                  cfg_done = DEF_YES;
                  break;
 
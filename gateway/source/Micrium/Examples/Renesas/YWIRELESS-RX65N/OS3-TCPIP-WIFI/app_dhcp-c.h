@@ -47,6 +47,7 @@
 
 #include <lib_def.h>
 #include <app_cfg.h>
+#include <app_keep.h>
 
 /*
 *********************************************************************************************************
@@ -71,6 +72,10 @@
 #define  APP_CFG_DHCP_C_EN                       DEF_ENABLED
 #endif
 
+#ifndef  APP_CFG_DHCP_C_LEASE_KEEP_EN                           /* Keep lease across sw resets (see 'app_dhcp-c.c ...   */
+#define  APP_CFG_DHCP_C_LEASE_KEEP_EN            APP_CFG_KEEP_EN /* ... AppDHCPc_Init()  Note #1').                     */
+#endif
+
 
 /*
 *********************************************************************************************************
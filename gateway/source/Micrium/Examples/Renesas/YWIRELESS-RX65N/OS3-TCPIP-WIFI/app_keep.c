@@ -0,0 +1,202 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       KEPT-ACROSS-RESET DATA
+*                                          APPLICATION CODE
+*
+* Filename      : app_keep.c
+* Version       : V1.00
+* Programmer(s) : FF
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <app_keep.h>
+
+
+/*
+*********************************************************************************************************
+*                                               ENABLE
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_KEEP_EN == DEF_ENABLED)
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppKeep_ChkCalc (void        *p_data,
+                                     CPU_SIZE_T   data_len,
+                                     CPU_INT32U   magic);
+
+
+/*
+*********************************************************************************************************
+*                                          AppKeep_Restore()
+*
+* Description : Validate kept data & invalidate it until committed again.
+*
+* Argument(s) : p_hdr       Pointer to kept data's header.
+*
+*               p_data      Pointer to kept data.
+*
+*               data_len    Length of kept data (in octets).
+*
+*               magic       Magic value identifying the kept data.
+*
+* Return(s)   : DEF_YES, if kept data valid (see Note #1).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Kept data is left in place whether valid or not; it is invalidated so that a reset
+*                   before AppKeep_Commit() is called again does NOT restore it a second time.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppKeep_Restore (APP_KEEP_HDR  *p_hdr,
+                              void          *p_data,
+                              CPU_SIZE_T     data_len,
+                              CPU_INT32U     magic)
+{
+    CPU_BOOLEAN  valid;
+
+
+    valid = DEF_NO;
+    if ((p_hdr->Magic == magic) &&
+        (p_hdr->Chk   == AppKeep_ChkCalc(p_data, data_len, magic))) {
+        valid = DEF_YES;
+    }
+
+    p_hdr->Magic = 0u;                                          /* See Note #1.                                         */
+
+    return (valid);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppKeep_Commit()
+*
+* Description : Mark kept data valid.
+*
+* Argument(s) : p_hdr       Pointer to kept data's header.
+*
+*               p_data      Pointer to kept data.
+*
+*               data_len    Length of kept data (in octets).
+*
+*               magic       Magic value identifying the kept data.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Kept data MUST be written before it is committed.
+*********************************************************************************************************
+*/
+
+void  AppKeep_Commit (APP_KEEP_HDR  *p_hdr,
+                      void          *p_data,
+                      CPU_SIZE_T     data_len,
+                      CPU_INT32U     magic)
+{
+    p_hdr->Chk   = AppKeep_ChkCalc(p_data, data_len, magic);
+    p_hdr->Magic = magic;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppKeep_Invalidate()
+*
+* Description : Mark kept data invalid.
+*
+* Argument(s) : p_hdr       Pointer to kept data's header.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Should be called before kept data is overwritten so that a reset during the write
+*                   does NOT leave partially written data marked valid.
+*********************************************************************************************************
+*/
+
+void  AppKeep_Invalidate (APP_KEEP_HDR  *p_hdr)
+{
+    p_hdr->Magic = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppKeep_ChkCalc()
+*
+* Description : Calculate kept data's check value.
+*
+* Argument(s) : p_data      Pointer to kept data.
+*
+*               data_len    Length of kept data (in octets).
+*
+*               magic       Magic value identifying the kept data.
+*
+* Return(s)   : Check value.
+*
+* Caller(s)   : AppKeep_Restore(),
+*               AppKeep_Commit().
+*
+* Note(s)     : (1) Every octet of the kept data is folded in, seeded w/ the inverted magic, so that RAM
+*                   left in any state by a power cycle is NOT taken for valid data.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppKeep_ChkCalc (void        *p_data,
+                                     CPU_SIZE_T   data_len,
+                                     CPU_INT32U   magic)
+{
+    CPU_INT08U  *p_octet;
+    CPU_INT32U   chk;
+    CPU_SIZE_T   ix;
+
+
+    p_octet = (CPU_INT08U *)p_data;
+    chk     = ~magic;                                           /* See Note #1.                                         */
+    for (ix = 0u; ix < data_len; ix++) {
+        chk = ((chk << 5u) | (chk >> 27u)) ^ p_octet[ix];
+    }
+
+    return (chk);
+}
+
+#endif
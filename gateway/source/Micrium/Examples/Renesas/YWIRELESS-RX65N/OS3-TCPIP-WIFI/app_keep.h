@@ -0,0 +1,137 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       KEPT-ACROSS-RESET DATA
+*                                          APPLICATION CODE
+*
+* Filename      : app_keep.h
+* Version       : V1.00
+* Programmer(s) : FF
+*********************************************************************************************************
+* Note(s)       : (1) Kept data is placed in a RAM section NOT initialized by the C start-up code.  It
+*                     therefore survives a software reset but NOT a power cycle, after which its header
+*                     check fails & the data is ignored.
+*
+*                 (2) Kept data is declared with APP_KEEP_NO_INIT & starts with an APP_KEEP_HDR :
+*
+*                         static  APP_KEEP_NO_INIT  struct {
+*                             APP_KEEP_HDR  Hdr;
+*                             <type>        Data;
+*                         } AppXxx_Kept;
+*
+*                     & is validated by AppKeep_Restore() & marked valid by AppKeep_Commit().
+*********************************************************************************************************
+*/
+
+#ifndef  APP_KEEP_H
+#define  APP_KEEP_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <app_cfg.h>
+
+
+/*
+*********************************************************************************************************
+*                                        DEFAULT CONFIGURATION
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_KEEP_EN                                        /* Keep app data across sw resets (see Note #1).        */
+#define  APP_CFG_KEEP_EN                        DEF_ENABLED
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                                 DEFINES
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_KEEP_EN == DEF_ENABLED)
+#ifdef   __IAR_SYSTEMS_ICC__
+#define  APP_KEEP_NO_INIT                       __no_init       /* See Note #1.                                         */
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_keep_hdr {
+    CPU_INT32U  Magic;                                          /* Caller's magic if kept data valid.                   */
+    CPU_INT32U  Chk;                                            /* Chk of kept data seeded w/ inverted magic.           */
+} APP_KEEP_HDR;
+
+
+/*
+*********************************************************************************************************
+*                                           FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_KEEP_EN == DEF_ENABLED)
+CPU_BOOLEAN  AppKeep_Restore    (APP_KEEP_HDR  *p_hdr,
+                                 void          *p_data,
+                                 CPU_SIZE_T     data_len,
+                                 CPU_INT32U     magic);
+
+void         AppKeep_Commit     (APP_KEEP_HDR  *p_hdr,
+                                 void          *p_data,
+                                 CPU_SIZE_T     data_len,
+                                 CPU_INT32U     magic);
+
+void         AppKeep_Invalidate (APP_KEEP_HDR  *p_hdr);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_KEEP_EN == DEF_ENABLED)
+#ifndef  APP_KEEP_NO_INIT
+#error  "APP_CFG_KEEP_EN                     requires a '__no_init' RAM section [see 'app_keep.h  Note #1']"
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of kept data app module include.                 */
@@ -70,6 +70,8 @@
 *********************************************************************************************************
 */
 
+#define  APP_TCPIP_DNS_CACHE_MAGIC               0x444E5343u    /* Marks a valid kept DNS cache entry ('DNSC').         */
+
 
 /*
 *********************************************************************************************************
@@ -77,6 +79,13 @@
 *********************************************************************************************************
 */
 
+#if (APP_CFG_TCPIP_DNS_CACHE_KEEP_EN == DEF_ENABLED)
+typedef  struct  app_tcpip_dns_cache_keep {
+    APP_KEEP_HDR      Hdr;                                      /* See 'app_keep.h  Note #2'.                           */
+    DNSc_CACHE_ENTRY  Entry;                                    /* Kept DNS cache entry.                                */
+} APP_TCPIP_DNS_CACHE_KEEP;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -86,6 +95,11 @@
 
 static  NET_IF_NBR  AppTCPIP_IF_NbrDflt;
 
+#if (APP_CFG_TCPIP_DNS_CACHE_KEEP_EN == DEF_ENABLED)
+static  APP_KEEP_NO_INIT  APP_TCPIP_DNS_CACHE_KEEP  AppTCPIP_DNScCacheKept;    /* NOT cleared on sw reset (see ...             */
+                                                                        /* ... 'AppTCPIP_DNScCacheKeep()  Note #1b').   */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -109,6 +123,19 @@ static  void  AppPrintIPAddr     (NET_IF_NBR  if_nbr);
 extern char * g_prov_ssid;
 extern char * g_prov_ssid_password;
 
+
+/*
+*********************************************************************************************************
+*                                    LOCAL CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_TCPIP_DNS_CACHE_KEEP_EN == DEF_ENABLED)
+#if (APP_CFG_KEEP_EN != DEF_ENABLED)
+#error  "APP_CFG_TCPIP_DNS_CACHE_KEEP_EN      requires APP_CFG_KEEP_EN == DEF_ENABLED"
+#endif
+#endif
+
 /*
 *********************************************************************************************************
 *                                            AppTCPIP_Init()
@@ -142,6 +169,9 @@ CPU_BOOLEAN  AppTCPIP_Init (void)
     NET_ERR            net_err;
     static NET_IF_WIFI_AP     ap[APP_CFG_WIFI_AP_TBL_SIZE];
     CPU_BOOLEAN        dhcp_status;
+#if (APP_CFG_TCPIP_DNS_CACHE_KEEP_EN == DEF_ENABLED)
+    CPU_BOOLEAN        entry_kept;
+#endif
     DNSc_ERR           dns_err;
 
                                                                 /* --------------------- INIT TCPIP ------------------- */
@@ -275,12 +305,73 @@ CPU_BOOLEAN  AppTCPIP_Init (void)
         return (DEF_FAIL);
     }
 
+#if (APP_CFG_TCPIP_DNS_CACHE_KEEP_EN == DEF_ENABLED)            /* ------------ RESTORE KEPT DNS CACHE ENTRY ---------- */
+    entry_kept = AppKeep_Restore(&AppTCPIP_DNScCacheKept.Hdr,   /* Invalidate kept entry until kept again.              */
+                                 &AppTCPIP_DNScCacheKept.Entry,
+                                  sizeof(AppTCPIP_DNScCacheKept.Entry),
+                                  APP_TCPIP_DNS_CACHE_MAGIC);
+    if (entry_kept == DEF_YES) {
+        DNSc_CacheEntrySet(&AppTCPIP_DNScCacheKept.Entry, &dns_err);
+        if (dns_err == DNSc_ERR_NONE) {
+            APP_TRACE_INFO(("DNS cache entry restored for %s\r\n", AppTCPIP_DNScCacheKept.Entry.Name));
+        }
+    }
+#endif
+
     AppTCPIP_IF_NbrDflt = if_nbr_wifi;
 
     return (DEF_OK);
 }
 
 
+/*
+*********************************************************************************************************
+*                                       AppTCPIP_DNScCacheKeep()
+*
+* Description : Keep a host's DNS cache entry across a software reset.
+*
+* Arguments   : p_host_name     Pointer to a string that contains the host name.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) (a) The kept entry is restored into the DNS cache by AppTCPIP_Init() so that the host
+*                       may be reached again without waiting for a DNS server round trip.  The restored
+*                       addresses are stale & are resolved again on first use (see 'dns-c.c
+*                       DNSc_CacheEntrySet()  Note #2').
+*
+*                   (b) The entry is kept across a software reset only (see 'app_keep.h  Note #1'); when
+*                       none is kept, the host is resolved from the DNS server.
+*
+*               (2) Should be called once the host has been reached, so that only addresses known to work
+*                   are kept.
+*********************************************************************************************************
+*/
+
+void  AppTCPIP_DNScCacheKeep (CPU_CHAR  *p_host_name)
+{
+#if (APP_CFG_TCPIP_DNS_CACHE_KEEP_EN == DEF_ENABLED)
+    DNSc_ERR  dns_err;
+
+
+    AppKeep_Invalidate(&AppTCPIP_DNScCacheKept.Hdr);
+
+    DNSc_CacheEntryGet(p_host_name, &AppTCPIP_DNScCacheKept.Entry, &dns_err);
+    if (dns_err != DNSc_ERR_NONE) {
+        return;
+    }
+
+    AppKeep_Commit(&AppTCPIP_DNScCacheKept.Hdr,
+                   &AppTCPIP_DNScCacheKept.Entry,
+                    sizeof(AppTCPIP_DNScCacheKept.Entry),
+                    APP_TCPIP_DNS_CACHE_MAGIC);
+#else
+    (void)&p_host_name;
+#endif
+}
+
+
 /*
 *********************************************************************************************************
 *                                         AppNet_MacAddrDfltGet()
@@ -41,6 +41,7 @@
 */
 
 #include  <cpu.h>
+#include  <app_keep.h>
 
 
 /*
@@ -53,6 +54,10 @@
 #define  APP_CFG_TCPIP_EN                       DEF_ENABLED
 #endif
 
+#ifndef  APP_CFG_TCPIP_DNS_CACHE_KEEP_EN                         /* Keep DNS cache entry across sw resets (see ...       */
+#define  APP_CFG_TCPIP_DNS_CACHE_KEEP_EN        APP_CFG_KEEP_EN /* ... 'app_tcpip.c  AppTCPIP_DNScCacheKeep()  Note #1').*/
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -114,6 +119,7 @@
 #if (APP_CFG_TCPIP_EN == DEF_ENABLED)
 CPU_BOOLEAN  AppTCPIP_Init           (void);
 void         AppTCPIP_MacAddrDfltGet (CPU_CHAR *mac_addr);
+void         AppTCPIP_DNScCacheKeep  (CPU_CHAR *p_host_name);
 #endif
 
 
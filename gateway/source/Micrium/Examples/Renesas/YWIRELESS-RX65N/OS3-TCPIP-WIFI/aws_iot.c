@@ -43,6 +43,7 @@
 
 #include  <Client/Source/mqtt-c.h>
 #include  <Secure/net_secure.h>
+#include  <app_tcpip.h>
 
 
 /*
@@ -988,6 +989,8 @@ static  CPU_BOOLEAN  AWS_IoT_ChkConnect (void)
             break;
         }
 
+        AppTCPIP_DNScCacheKeep(AWS_IOT_BROKER_NAME);           /* Keep broker addr across sw resets.                   */
+
         ret_val = DEF_OK;
 
     } while(0u);
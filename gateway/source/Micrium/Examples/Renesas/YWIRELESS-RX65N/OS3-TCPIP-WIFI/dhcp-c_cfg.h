@@ -74,6 +74,9 @@
 *           (4) Once the DHCP server has assigned the client an address, the later may perform a final
 *               check prior to use this address in order to make sure it is not being used by another
 *               host on the network.
+*
+*           (5) A lease saved by the application may be re-confirmed with a single REQUEST from the
+*               INIT-REBOOT state (see 'dhcp-c.c  DHCPc_StartReboot()').
 *********************************************************************************************************
 */
 
@@ -98,6 +101,11 @@
 #define  DHCPc_CFG_LOCAL_LINK_MAX_RETRY                    3    /* Configure maximum number of retry to get a           */
                                                                 /* link-local address.                                  */
 
+#define  DHCPc_CFG_INIT_REBOOT_EN                DEF_ENABLED    /* Configure INIT-REBOOT with a saved lease ...         */
+                                                                /* ... (see Note #5) :                                  */
+                                                                /*   DEF_DISABLED  INIT-REBOOT DISABLED                 */
+                                                                /*   DEF_ENABLED   INIT-REBOOT ENABLED                  */
+
 
 /*
 *********************************************************************************************************
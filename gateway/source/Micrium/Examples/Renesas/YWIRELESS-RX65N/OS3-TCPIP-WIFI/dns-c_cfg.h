@@ -94,6 +94,33 @@
                                                                 /* DEF_DISABLED     Blocking option DISABLED            */
                                                                 /* DEF_ENABLED      Blocking option ENABLED             */
 
+
+/*
+*********************************************************************************************************
+*                                  DNSc CACHE REFRESH CONFIGURATION
+*
+* Note(s) : (1) Configure DNSc_CFG_CACHE_REFRESH_EN to enable/disable the refresh of cached hosts :
+*
+*               (a) When ENABLED,  DNSc's task resolves again the used hosts whose addresses are about to
+*                   expire.  Expired addresses are returned while they are resolved again so that a slow or
+*                   unreachable DNS server does not delay the application (see RFC #8767).
+*
+*               (b) When DISABLED, Expired addresses are removed from the cache.
+*
+*               Requires DNSc_CFG_MODE_ASYNC_EN to be ENABLED.
+*
+*           (2) Configure DNSc_CFG_CACHE_STALE_MAX_SEC to the maximum time expired addresses may be returned.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure cache refresh feature, See Note #1 ...     */
+#define  DNSc_CFG_CACHE_REFRESH_EN                  DEF_ENABLED
+                                                                /* DEF_DISABLED     Cache refresh DISABLED              */
+                                                                /* DEF_ENABLED      Cache refresh ENABLED               */
+
+                                                                /* Configure stale addr max time, See Note #2 ...       */
+#define  DNSc_CFG_CACHE_STALE_MAX_SEC               86400u
+
 /*
 *********************************************************************************************************
 *                                DNSc RUN-TIME STRUCTURE CONFIGURATION
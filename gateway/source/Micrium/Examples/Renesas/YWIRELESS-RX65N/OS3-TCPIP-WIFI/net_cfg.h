@@ -103,19 +103,16 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *********************************************************************************************************
 *                                        TASKS Q CONFIGURATION
 *
-* Note(s) : (1) Rx queue size should be configured such that it reflects the total number of DMA receive descriptors on all
-*               devices. If DMA is not available, or a combination of DMA and I/O based interfaces are configured then this
-*               number reflects the maximum number of packets that can be acknowledged and signalled during a single receive
-*               interrupt event for all interfaces.
-*
-*           (2) Tx queue size should be defined to be the total number of small and large transmit buffers declared for
+* Note(s) : (1) Tx queue size should be defined to be the total number of small and large transmit buffers declared for
 *               all interfaces.
+*
+*           (2) There is no Rx queue : received packets are counted per interface & the receive task is only woken by a
+*               semaphore (see 'net_if.c  NetIF_RxTaskSignal()  Note #2').  NET_CFG_IF_RX_Q_SIZE is obsolete & ignored.
 *********************************************************************************************************
 *********************************************************************************************************
 */
 
-#define  NET_CFG_IF_RX_Q_SIZE                   50u             /*Configure RX queue size (See Note #1).                */
-#define  NET_CFG_IF_TX_DEALLOC_Q_SIZE           50u             /*Configure TX queue size (See Note #2).                */
+#define  NET_CFG_IF_TX_DEALLOC_Q_SIZE           50u             /*Configure TX queue size (See Note #1).                */
 
 
 
@@ -273,6 +270,13 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 #define  NET_IF_CFG_TX_SUSPEND_TIMEOUT_MS       1u              /* Configure interface transmit suspend timeout in ms.  */
 
+                                                                /* Configure transmit of external buffer data ...       */
+                                                                /* ... (see 'net_buf.h  NETWORK BUFFER EXTERNAL ...     */
+                                                                /* ... DATA DEFINES  Note #1') :                        */
+#define  NET_BUF_CFG_EXT_DATA_EN                DEF_ENABLED
+                                                                /*   DEF_DISABLED  App data ALWAYS copied into net bufs */
+                                                                /*   DEF_ENABLED   App data MAY be referenced in place  */
+
 
 
 /*
@@ -450,6 +454,14 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 /*     #define  NET_SOCK_DFLT_TIMEOUT_CONN_REQ_MS             10000u                                                    */
 /*     #define  NET_SOCK_DFLT_TIMEOUT_CONN_ACCEPT_MS          10000u                                                    */
 /*     #define  NET_SOCK_DFLT_TIMEOUT_CONN_CLOSE_MS           10000u                                                    */
+/*                                                                                                                      */
+/* Received packets are matched to their connection through two hash tables: one indexed by the local & remote address */
+/* & port of connected sockets, the other by the local address & port of listening/non-connected sockets. Redefine the  */
+/* following defines to change the number of buckets in each table (MUST be a power of 2) or to search the connection   */
+/* lists linearly instead.                                                                                              */
+/*                                                                                                                      */
+/*     #define  NET_CONN_CFG_HASH_EN                          DEF_ENABLED                                               */
+/*     #define  NET_CONN_CFG_HASH_TBL_SIZE                    16u                                                       */
 /* ==================================================================================================================== */
 
 
@@ -510,6 +522,15 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 /* to never time out. Note that it's possible to change at runtime any timeout values using Socket option API.          */
 /*     #define  NET_TCP_DFLT_TIMEOUT_CONN_RX_Q_MS           1000u                                                       */
 /*     #define  NET_TCP_DFLT_TIMEOUT_CONN_TX_Q_MS           1000u                                                       */
+/*                                                                                                                      */
+/* The Window Scale, Selective Acknowledgement (SACK) and Timestamp options (see RFC #7323 & RFC #2018) are offered on  */
+/* every connection and used when the remote host offers them too. Each option may be compiled out by redefining the    */
+/* following defines; the options offered by a given connection may also be changed before it is opened using           */
+/* NetTCP_ConnCfgOpt(). Note that the Timestamp option reduces the data carried by each segment by 12 octets.           */
+/*                                                                                                                      */
+/*     #define  NET_TCP_CFG_WIN_SCALE_EN                    DEF_ENABLED                                                 */
+/*     #define  NET_TCP_CFG_SACK_EN                         DEF_ENABLED                                                 */
+/*     #define  NET_TCP_CFG_TS_EN                           DEF_ENABLED                                                 */
 /* ==================================================================================================================== */
 
 
@@ -592,6 +613,14 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 *          (2) The network security port must be also added to the project. Security port can be found under the folder:
 *
 *                 $uC-TCPIP/Secure/<module>
+*
+*          (3) Consecutive small writes to a secure socket MAY be coalesced into a single record, transmitted
+*              once the coalesce buffer is full, the timeout expires, or the socket receives or closes.  The
+*              timeout is rounded up to a whole network timer tick (see 'NET_TMR_CFG_TASK_FREQ').
+*
+*          (4) A client MAY request the TLS maximum fragment length extension (RFC 6066) so that records,
+*              & the buffers holding them, stay small.  Valid lengths are 512, 1024, 2048 & 4096 octets;
+*              0 does NOT request the extension.
 *********************************************************************************************************
 *********************************************************************************************************
 */
@@ -611,6 +640,15 @@ extern  const  NET_TASK_CFG  NetTmrTaskCfg;
 
 #define  NET_SECURE_CFG_MAX_CA_CERT_LEN         1600u           /* Configure CA certificate maximum length (bytes)      */
 
+                                                                /* Configure small record coalescing (see Note #3):     */
+#define  NET_SECURE_CFG_TX_COALESCE_EN          DEF_ENABLED
+                                                                /*   DEF_DISABLED  Coalescing DISABLED                  */
+                                                                /*   DEF_ENABLED   Coalescing ENABLED                   */
+#define  NET_SECURE_CFG_TX_COALESCE_LEN         512u            /* Configure coalesce buffer length (bytes)             */
+#define  NET_SECURE_CFG_TX_COALESCE_TIMEOUT_MS   10u            /* Configure coalesce flush timeout (ms)                */
+
+#define  NET_SECURE_CFG_MAX_FRAG_LEN            1024u           /* Configure client max fragment len (see Note #4).     */
+
 
 
 /*
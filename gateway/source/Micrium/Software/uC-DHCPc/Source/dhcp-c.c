@@ -124,6 +124,15 @@
 */
 
 #ifdef  NET_IPv4_MODULE_EN
+                                                                                    /* ---------- START FNCTS --------- */
+static  void            DHCPc_StartHandler           (NET_IF_NBR          if_nbr,
+                                                      DHCPc_OPT_CODE     *preq_param_tbl,
+                                                      CPU_INT08U          req_param_tbl_qty,
+                                                      DHCPc_LEASE        *please,
+                                                      CPU_BOOLEAN         resume,
+                                                      DHCPc_ERR          *perr);
+
+
                                                                                     /* -------- IF INFO FNCTS --------- */
 static  void            DHCPc_IF_InfoInit            (DHCPc_ERR          *perr);
 
@@ -194,6 +203,14 @@ static  NET_SOCK_ID     DHCPc_InitSock               (NET_IPv4_ADDR       ip_add
 static  void            DHCPc_InitStateHandler       (DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_ERR          *perr);
 
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+static  CPU_BOOLEAN     DHCPc_InitRebootStateHandler (DHCPc_IF_INFO      *pif_info,
+                                                      NET_SOCK_ID         sock_id,
+                                                      CPU_INT08U         *paddr_hw,
+                                                      CPU_INT08U          addr_hw_len,
+                                                      DHCPc_ERR          *perr);
+#endif
+
 static  void            DHCPc_RenewRebindStateHandler(DHCPc_IF_INFO      *pif_info,
                                                       DHCPc_COMM_MSG      exp_tmr_msg,
                                                       DHCPc_ERR          *perr);
@@ -441,14 +458,7 @@ DHCPc_ERR  DHCPc_Init (void)
 *********************************************************************************************************
 *                                            DHCPc_Start()
 *
-* Description : (1) Start DHCP address configuration/management on specified interface :
-*
-*                   (a) Acquire  DHCPc lock
-*                   (b) Get      interface information structure
-*                   (c) Copy     requested DHCP options.
-*                   (d) Post     message to DHCP client task
-*                   (e) Release  DHCPc lock
-*
+* Description : Start DHCP address configuration/management on specified interface.
 *
 * Argument(s) : if_nbr              Interface number to start DHCP configuration/management.
 *
@@ -458,22 +468,17 @@ DHCPc_ERR  DHCPc_Init (void)
 *
 *               perr        Pointer to variable that will receive the return error code from this function :
 *
+*                                                               ------ RETURNED BY DHCPc_StartHandler() : ------
 *                               DHCPc_ERR_NONE                  Address DHCP negotiation successfully started.
 *                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
 *                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
 *                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
 *                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
 *                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
-*
-*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
 *                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
-*
-*                                                               ------- RETURNED BY DHCPc_IF_InfoGet() : -------
 *                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
 *                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
 *                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
-*
-*                                                               -------- RETURNED BY DHCPc_CommGet() : ---------
 *                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
 *
 * Return(s)   : none.
@@ -483,18 +488,7 @@ DHCPc_ERR  DHCPc_Init (void)
 *               This function is a DHCP client application programming interface (API) function &
 *               MAY be called by application function(s).
 *
-* Note(s)     : (2) DHCPc_Start() MUST be called AFTER the interface has been properly configured &
-*                   enabled.  Failure to do so could cause unknown results.
-*
-*               (3) DHCPc_Start() NOT executed until DHCP client initialization completes.
-*
-*               (4) DHCPc_Start() blocks ALL other DHCP client tasks by pending on & acquiring the
-*                   global DHCPc lock (see dhcp-c.h  Note #2').
-*
-*               (5) DHCPc_Start() execution is asynchronous--i.e. interface will NOT necessarily be
-*                   started upon return from this function.  The application SHOULD periodically call
-*                   DHCPc_ChkStatus() until the interface's DHCP management is successfully started
-*                   and configured.
+* Note(s)     : (1) See 'DHCPc_StartHandler()  Notes #2, #3, #4, & #5'.
 *********************************************************************************************************
 */
 
@@ -504,89 +498,115 @@ void  DHCPc_Start (NET_IF_NBR       if_nbr,
                    DHCPc_ERR       *perr)
 {
 #ifdef  NET_IPv4_MODULE_EN
-    CPU_BOOLEAN      if_en;
-    DHCPc_IF_INFO   *pif_info;
-    DHCPc_COMM      *pcomm;
-    DHCPc_COMM_MSG   comm_msg;
-    NET_ERR          err_net;
-
-
-#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (req_param_tbl_qty > 0) {
-        if (preq_param_tbl == (DHCPc_OPT_CODE *)0) {
-           *perr = DHCPc_ERR_NULL_PTR;
-            return;
-        }
-    }
+    DHCPc_StartHandler((NET_IF_NBR      ) if_nbr,
+                       (DHCPc_OPT_CODE *) preq_param_tbl,
+                       (CPU_INT08U      ) req_param_tbl_qty,
+                       (DHCPc_LEASE    *) 0,
+                       (CPU_BOOLEAN     ) DEF_NO,
+                       (DHCPc_ERR      *) perr);
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
+}
 
-    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #3).            */
-       *perr = DHCPc_ERR_INIT_INCOMPLETE;
-        return;
-    }
-
-
-    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
-    if (if_en != DEF_YES) {
-       *perr = DHCPc_ERR_IF_INVALID;
-        return;
-    }
-
-    if (req_param_tbl_qty > DHCPc_CFG_PARAM_REQ_TBL_SIZE) {     /* If param req qty > param req tbl, ...                */
-       *perr = DHCPc_ERR_PARAM_REQ_TBL_SIZE;                    /* ... rtn err.                                         */
-        return;
-    }
-
-                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
-    DHCPc_OS_Lock(perr);                                        /* See Note #4.                                         */
-    if (*perr != DHCPc_OS_ERR_NONE) {
-        return;
-    }
-
-                                                                /* ------------------- GET IF INFO -------------------- */
-    pif_info = DHCPc_IF_InfoGet(if_nbr, perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        DHCPc_OS_Unlock();
-        return;
-    }
-
-    pif_info->ClientState = DHCP_STATE_INIT;                    /* Client in INIT state.                                */
-
-
-                                                                /* ----------------- COPY REQ DHCP OPT -----------------*/
-    Mem_Copy((void     *)&pif_info->ParamReqTbl[0],
-             (void     *) preq_param_tbl,
-             (CPU_SIZE_T) req_param_tbl_qty);
 
-    pif_info->ParamReqQty = req_param_tbl_qty;
+/*
+*********************************************************************************************************
+*                                         DHCPc_StartReboot()
+*
+* Description : Start DHCP address configuration/management on specified interface by re-confirming a
+*                   saved lease.
+*
+* Argument(s) : if_nbr              Interface number to start DHCP configuration/management.
+*
+*               preq_param_tbl      Pointer to table of requested DHCP parameters.
+*
+*               req_param_tbl_qty   Size of requested parameter table.
+*
+*               please              Pointer to lease saved from DHCPc_LeaseGet() (see Note #1).
+*
+*               resume              Indicate whether to use the saved lease while it is re-confirmed :
+*
+*                                       DEF_YES     Configure saved lease's address immediately
+*                                                       (see Note #3).
+*                                       DEF_NO      Configure address ONLY once re-confirmed.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NULL_PTR              Argument 'please' passed a NULL pointer.
+*                               DHCPc_ERR_LEASE_INVALID         Argument 'please' has NO address.
+*
+*                                                               ------ RETURNED BY DHCPc_StartHandler() : ------
+*                               DHCPc_ERR_NONE                  Address DHCP negotiation successfully started.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
+*                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function &
+*               MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'dhcp-c.h  DHCPc LEASE DATA TYPE'.
+*
+*               (2) RFC #2131, Section 3.2 states that a client that "remembers and wishes to reuse a
+*                   previously allocated network address [...] broadcasts a DHCPREQUEST message [...]
+*                   with the 'requested IP address' option filled in with the client's notion of its
+*                   previously assigned address".  If NO ACK is received for the REQUEST, or if a NAK is
+*                   received, a new lease is negotiated from the INIT state.
+*
+*                   See also 'DHCPc_InitRebootStateHandler()'.
+*
+*               (3) If 'resume' is DEF_YES & the saved lease has time remaining, the interface is
+*                   configured with the saved address & reported configured (see 'DHCPc_ChkStatus()')
+*                   BEFORE the lease is re-confirmed.  Should the lease NOT be re-confirmed, the saved
+*                   address is removed from the interface.
+*
+*               (4) See also 'DHCPc_StartHandler()  Notes #2, #3, #4, & #5'.
+*********************************************************************************************************
+*/
 
-                                                                /* -------------- POST MSG TO DHCP TASK --------------- */
-    comm_msg = DHCPc_COMM_MSG_START;
-    pcomm    = DHCPc_CommGet(if_nbr, comm_msg, perr);
-    if (*perr != DHCPc_ERR_NONE) {
-        DHCPc_IF_InfoFree(pif_info);
-        DHCPc_OS_Unlock();
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+void  DHCPc_StartReboot (NET_IF_NBR       if_nbr,
+                         DHCPc_OPT_CODE  *preq_param_tbl,
+                         CPU_INT08U       req_param_tbl_qty,
+                         DHCPc_LEASE     *please,
+                         CPU_BOOLEAN      resume,
+                         DHCPc_ERR       *perr)
+{
+#ifdef  NET_IPv4_MODULE_EN
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (please == (DHCPc_LEASE *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
         return;
     }
+#endif
 
-    DHCPc_OS_MsgPost((void      *)pcomm,
-                     (DHCPc_ERR *)perr);
-    if (*perr != DHCPc_OS_ERR_NONE) {
-       *perr = DHCPc_ERR_MSG_Q;
-        DHCPc_CommFree(pcomm);
-        DHCPc_IF_InfoFree(pif_info);
-        DHCPc_OS_Unlock();
+    if (please->Addr == NET_IPv4_ADDR_NONE) {                   /* If NO saved addr, ...                                */
+       *perr = DHCPc_ERR_LEASE_INVALID;                         /* ... rtn err.                                         */
         return;
     }
 
-                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
-    DHCPc_OS_Unlock();
-
-   *perr = DHCPc_ERR_NONE;
+    DHCPc_StartHandler((NET_IF_NBR      ) if_nbr,
+                       (DHCPc_OPT_CODE *) preq_param_tbl,
+                       (CPU_INT08U      ) req_param_tbl_qty,
+                       (DHCPc_LEASE    *) please,
+                       (CPU_BOOLEAN     ) resume,
+                       (DHCPc_ERR      *) perr);
 #else
    *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
 #endif
 }
+#endif
 
 
 /*
@@ -933,6 +953,161 @@ void  DHCPc_GetOptVal (NET_IF_NBR       if_nbr,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          DHCPc_LeaseGet()
+*
+* Description : (1) Get the current lease of a given interface, so that it may be saved by the application :
+*
+*                   (a) Acquire DHCPc lock
+*                   (b) Get interface information structure
+*                   (c) Get lease addresses & remaining time
+*                   (d) Release DHCPc lock
+*
+*
+* Argument(s) : if_nbr      Interface number to get lease.
+*
+*               please      Pointer to variable that will receive the lease (see Note #4).
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Lease successfully returned.
+*                               DHCPc_ERR_NULL_PTR              Argument 'please' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_NOT_MANAGED        Interface NOT managed by the DHCP client.
+*                               DHCPc_ERR_IF_NOT_CFG            Interface NOT bound to a DHCP lease.
+*
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a DHCP client application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (2) DHCPc_LeaseGet() NOT executed until DHCP client initialization completes.
+*
+*               (3) DHCPc_LeaseGet() blocks ALL other DHCP client tasks by pending on & acquiring the
+*                   global DHCPc lock (see 'dhcp-c.h  Note #2').
+*
+*               (4) See 'dhcp-c.h  DHCPc LEASE DATA TYPE'.
+*
+*               (5) The remaining lease time is computed from the start of the last lease negotiation &
+*                   is therefore NEVER later than the actual lease expiration.
+*********************************************************************************************************
+*/
+
+void  DHCPc_LeaseGet (NET_IF_NBR    if_nbr,
+                      DHCPc_LEASE  *please,
+                      DHCPc_ERR    *perr)
+{
+#ifdef  NET_IPv4_MODULE_EN
+    DHCPc_IF_INFO  *pif_info;
+    DHCPc_MSG      *pmsg;
+    DHCP_MSG_HDR   *pmsg_hdr;
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    CPU_INT32U      time_cur;
+    CPU_INT32U      time_elapsed_sec;
+
+
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                   /* ------------------ VALIDATE PTR -------------------- */
+    if (please == (DHCPc_LEASE *)0) {
+       *perr = DHCPc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #2).            */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
+
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #3.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------------- GET IF INFO -------------------- */
+    pif_info = DHCPc_IF_InfoGetCfgd(if_nbr);
+    if (pif_info == (DHCPc_IF_INFO *)0) {                       /* If IF NOT managed by DHCPc, ...                      */
+       *perr = DHCPc_ERR_IF_NOT_MANAGED;                        /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    switch (pif_info->ClientState) {                            /* If IF NOT bound to a lease, ...                      */
+        case DHCP_STATE_BOUND:
+        case DHCP_STATE_RENEWING:
+        case DHCP_STATE_REBINDING:
+             break;
+
+
+        default:
+            *perr = DHCPc_ERR_IF_NOT_CFG;                       /* ... rtn err.                                         */
+             DHCPc_OS_Unlock();
+             return;
+    }
+
+    pmsg = pif_info->MsgPtr;
+    if (pmsg == (DHCPc_MSG *)0) {                               /* If NO DHCP msg for IF, ...                           */
+       *perr = DHCPc_ERR_IF_NOT_CFG;                            /* ... rtn err.                                         */
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+                                                                /* ------------------ GET LEASE ADDRS ----------------- */
+    pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+
+    NET_UTIL_VAL_COPY_32(&please->Addr, &pmsg_hdr->yiaddr);    /* Copy addrs in net order (see Note #4).               */
+
+    please->AddrSubnetMask  = NET_IPv4_ADDR_NONE;
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SUBNET_MASK,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_32(&please->AddrSubnetMask, popt);
+    }
+
+    please->AddrDfltGateway = NET_IPv4_ADDR_NONE;
+    popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_ROUTER,
+                           (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                           (CPU_INT16U    ) pmsg->MsgLen,
+                           (CPU_INT08U   *)&opt_val_len);
+    if (popt != (CPU_INT08U *)0) {
+        NET_UTIL_VAL_COPY_32(&please->AddrDfltGateway, popt);
+    }
+
+    please->ServerID = pif_info->ServerID;
+
+                                                                /* ---------------- GET LEASE REM TIME ---------------- */
+    if (pif_info->LeaseTime_sec == DHCP_LEASE_INFINITE) {
+        please->LeaseRemain_sec = DHCP_LEASE_INFINITE;
+
+    } else {                                                    /* See Note #5.                                         */
+        time_cur         = DHCPc_OS_TimeGet_tick();
+        time_elapsed_sec = DHCPc_OS_TimeCalcElapsed_sec(pif_info->NegoStartTime, time_cur);
+        if (pif_info->LeaseTime_sec > time_elapsed_sec) {
+            please->LeaseRemain_sec = pif_info->LeaseTime_sec - time_elapsed_sec;
+        } else {
+            please->LeaseRemain_sec = 0u;
+        }
+    }
+
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
+
+   *perr = DHCPc_ERR_NONE;
+#else
+   *perr = DHCPc_ERR_IPv4_NOT_PRESENT;
+#endif
+}
+
+
 /*
 *********************************************************************************************************
 *                                         DHCPc_TaskHandler()
@@ -1118,6 +1293,178 @@ void  DHCPc_TmrTaskHandler (void)
 
 #ifdef  NET_IPv4_MODULE_EN
 
+/*
+*********************************************************************************************************
+*                                        DHCPc_StartHandler()
+*
+* Description : (1) Start DHCP address configuration/management on specified interface :
+*
+*                   (a) Acquire  DHCPc lock
+*                   (b) Get      interface information structure
+*                   (c) Copy     requested DHCP options.
+*                   (d) Copy     saved lease, if any
+*                   (e) Post     message to DHCP client task
+*                   (f) Release  DHCPc lock
+*
+*
+* Argument(s) : if_nbr              Interface number to start DHCP configuration/management.
+*
+*               preq_param_tbl      Pointer to table of requested DHCP parameters.
+*
+*               req_param_tbl_qty   Size of requested parameter table.
+*
+*               please              Pointer to saved lease to re-confirm, if any (see Note #6).
+*
+*               resume              Indicate whether to use the saved lease while it is re-confirmed
+*                                       (see 'DHCPc_StartReboot()  Note #3').
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Address DHCP negotiation successfully started.
+*                               DHCPc_ERR_NULL_PTR              Argument 'preq_param_tbl' passed a NULL pointer.
+*                               DHCPc_ERR_INIT_INCOMPLETE       DHCP client initialization NOT complete.
+*                               DHCPc_ERR_IF_INVALID            Interface invalid or disabled.
+*                               DHCPc_ERR_PARAM_REQ_TBL_SIZE    Requested parameter table size too small.
+*                               DHCPc_ERR_MSG_Q                 Error posting start command to message queue.
+*
+*                                                               -------- RETURNED BY DHCPc_OS_Lock() : ---------
+*                               DHCPc_OS_ERR_LOCK               DHCPc access NOT acquired.
+*
+*                                                               ------- RETURNED BY DHCPc_IF_InfoGet() : -------
+*                               DHCPc_ERR_IF_INFO_IF_USED       Interface information already in use.
+*                               DHCPc_ERR_INVALID_HW_ADDR       Error retrieving interface's hardware address.
+*                               DHCPc_ERR_IF_INFO_NONE_AVAIL    Interface information pool empty.
+*
+*                                                               -------- RETURNED BY DHCPc_CommGet() : ---------
+*                               DHCPc_ERR_COMM_NONE_AVAIL       Communication object pool empty.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : DHCPc_Start(),
+*               DHCPc_StartReboot().
+*
+* Note(s)     : (2) DHCPc_Start() MUST be called AFTER the interface has been properly configured &
+*                   enabled.  Failure to do so could cause unknown results.
+*
+*               (3) DHCPc_Start() NOT executed until DHCP client initialization completes.
+*
+*               (4) DHCPc_Start() blocks ALL other DHCP client tasks by pending on & acquiring the
+*                   global DHCPc lock (see dhcp-c.h  Note #2').
+*
+*               (5) DHCPc_Start() execution is asynchronous--i.e. interface will NOT necessarily be
+*                   started upon return from this function.  The application SHOULD periodically call
+*                   DHCPc_ChkStatus() until the interface's DHCP management is successfully started
+*                   and configured.
+*
+*               (6) If a saved lease is given, the DHCP client starts in the INIT-REBOOT state instead of
+*                   the INIT state (see 'DHCPc_StartReboot()  Note #2').
+*********************************************************************************************************
+*/
+
+static  void  DHCPc_StartHandler (NET_IF_NBR       if_nbr,
+                                 DHCPc_OPT_CODE  *preq_param_tbl,
+                                 CPU_INT08U       req_param_tbl_qty,
+                                 DHCPc_LEASE     *please,
+                                 CPU_BOOLEAN      resume,
+                                 DHCPc_ERR       *perr)
+{
+    CPU_BOOLEAN      if_en;
+    DHCPc_IF_INFO   *pif_info;
+    DHCPc_COMM      *pcomm;
+    DHCPc_COMM_MSG   comm_msg;
+    NET_ERR          err_net;
+
+
+#if (DHCPc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (req_param_tbl_qty > 0) {
+        if (preq_param_tbl == (DHCPc_OPT_CODE *)0) {
+           *perr = DHCPc_ERR_NULL_PTR;
+            return;
+        }
+    }
+#endif
+
+    if (DHCPc_InitDone != DEF_YES) {                            /* If init NOT complete, exit (see Note #3).            */
+       *perr = DHCPc_ERR_INIT_INCOMPLETE;
+        return;
+    }
+
+
+    if_en  = NetIF_IsEnCfgd(if_nbr, &err_net);                  /* Validate IF en.                                      */
+    if (if_en != DEF_YES) {
+       *perr = DHCPc_ERR_IF_INVALID;
+        return;
+    }
+
+    if (req_param_tbl_qty > DHCPc_CFG_PARAM_REQ_TBL_SIZE) {     /* If param req qty > param req tbl, ...                */
+       *perr = DHCPc_ERR_PARAM_REQ_TBL_SIZE;                    /* ... rtn err.                                         */
+        return;
+    }
+
+                                                                /* ---------------- ACQUIRE DHCPc LOCK ---------------- */
+    DHCPc_OS_Lock(perr);                                        /* See Note #4.                                         */
+    if (*perr != DHCPc_OS_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------------- GET IF INFO -------------------- */
+    pif_info = DHCPc_IF_InfoGet(if_nbr, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    pif_info->ClientState = DHCP_STATE_INIT;                    /* Client in INIT state.                                */
+
+
+                                                                /* ----------------- COPY REQ DHCP OPT -----------------*/
+    Mem_Copy((void     *)&pif_info->ParamReqTbl[0],
+             (void     *) preq_param_tbl,
+             (CPU_SIZE_T) req_param_tbl_qty);
+
+    pif_info->ParamReqQty = req_param_tbl_qty;
+
+                                                                /* ------------------ COPY SAVED LEASE ---------------- */
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+    if (please != (DHCPc_LEASE *)0) {                           /* If saved lease avail, ...                            */
+        Mem_Copy((void     *)&pif_info->LeaseSaved,
+                 (void     *) please,
+                 (CPU_SIZE_T) sizeof(pif_info->LeaseSaved));
+
+        pif_info->LeaseResume = resume;
+        pif_info->ClientState = DHCP_STATE_INIT_REBOOT;         /* ... re-confirm it (see Note #6).                     */
+    }
+#else
+   (void)&please;                                               /* Prevent 'variable unused' compiler warnings.         */
+   (void)&resume;
+#endif
+
+                                                                /* -------------- POST MSG TO DHCP TASK --------------- */
+    comm_msg = DHCPc_COMM_MSG_START;
+    pcomm    = DHCPc_CommGet(if_nbr, comm_msg, perr);
+    if (*perr != DHCPc_ERR_NONE) {
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+    DHCPc_OS_MsgPost((void      *)pcomm,
+                     (DHCPc_ERR *)perr);
+    if (*perr != DHCPc_OS_ERR_NONE) {
+       *perr = DHCPc_ERR_MSG_Q;
+        DHCPc_CommFree(pcomm);
+        DHCPc_IF_InfoFree(pif_info);
+        DHCPc_OS_Unlock();
+        return;
+    }
+
+                                                                /* ---------------- RELEASE DHCPc LOCK ---------------- */
+    DHCPc_OS_Unlock();
+
+   *perr = DHCPc_ERR_NONE;
+}
+
+
 /*
 *********************************************************************************************************
 *                                         DHCPc_IF_InfoInit()
@@ -1482,6 +1829,13 @@ static  void  DHCPc_IF_InfoClr (DHCPc_IF_INFO  *pif_info)
 
     pif_info->Tmr               = (DHCPc_TMR     *)0;
 
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+    Mem_Clr((void     *)&pif_info->LeaseSaved,
+            (CPU_SIZE_T) sizeof(pif_info->LeaseSaved));
+
+    pif_info->LeaseResume       =  DEF_NO;
+#endif
+
     pif_info->Flags             =  DHCPc_FLAG_NONE;
 }
 
@@ -2696,9 +3050,10 @@ static  NET_SOCK_ID  DHCPc_InitSock (NET_IPv4_ADDR  ip_addr_local,
 *                   (a) Get      interface's hardware address
 *                   (b) Initialize socket
 *                   (c) Start    interface's dynamic configuration
-*                   (d) Transmit DISCOVER & select OFFER
-*                   (e) Transmit REQUEST  & get    reply
-*                   (f) Configure interface & lease timer
+*                   (d) Re-confirm saved lease, if any                                    See Note #5
+*                   (e) Transmit DISCOVER & select OFFER
+*                   (f) Transmit REQUEST  & get    reply
+*                   (g) Configure interface & lease timer
 *
 *
 * Argument(s) : pif_info    Pointer to DHCP interface information.
@@ -2757,6 +3112,12 @@ static  NET_SOCK_ID  DHCPc_InitSock (NET_IPv4_ADDR  ip_addr_local,
 *               (4) RFC #2131, section 'Client-Server interaction - allocating a network address', states
 *                   that "The client SHOULD wait a mininum of ten seconds before restarting the
 *                   configuration process to avoid excessive network traffic in case of looping".
+*
+*               (5) (a) If the DHCP client was started with a saved lease, the lease is first re-confirmed
+*                       from the INIT-REBOOT state (see 'DHCPc_InitRebootStateHandler()').  If it is NOT
+*                       re-confirmed, a new lease is negotiated from the INIT state without delay.
+*
+*                   (b) A re-confirmed address was already in use by this host & is NOT re-validated.
 *********************************************************************************************************
 */
 
@@ -2771,6 +3132,7 @@ static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
     CPU_INT16U      nego_retry_cnt;
     CPU_BOOLEAN     nego_done;
     CPU_BOOLEAN     nego_dly;
+    CPU_BOOLEAN     addr_cfgd;
 #if (DHCPc_CFG_ADDR_VALIDATE_EN == DEF_ENABLED)
     DHCPc_MSG      *pmsg;
     DHCP_MSG_HDR   *pmsg_hdr;
@@ -2814,11 +3176,26 @@ static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
     }
 
 
-                                                                /* ------------ TX DISCOVER & SELECT OFFER ------------ */
     nego_retry_cnt = 0;
     nego_done      = DEF_NO;
     nego_dly       = DEF_NO;
+    addr_cfgd      = DEF_NO;
+
+                                                                /* -------------- RE-CONFIRM SAVED LEASE -------------- */
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+    if (pif_info->ClientState == DHCP_STATE_INIT_REBOOT) {      /* If saved lease avail, ...                            */
+        addr_cfgd = DHCPc_InitRebootStateHandler(pif_info,      /* ... re-confirm it (see Note #5a).                    */
+                                                 sock_id,
+                                                &addr_hw[0],
+                                                 addr_hw_len,
+                                                 perr);
+        if (*perr == DHCPc_ERR_NONE) {                          /* If lease re-confirmed, ...                           */
+            nego_done = DEF_YES;                                /* ... skip DISCOVER (see Note #5b).                    */
+        }
+    }
+#endif
 
+                                                                /* ------------ TX DISCOVER & SELECT OFFER ------------ */
     while ((nego_retry_cnt <  DHCPc_NEGO_MAX_RETRY) &&
            (nego_done      != DEF_YES)) {
 
@@ -2899,8 +3276,9 @@ static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
                                                                 /* ------------- CFG IF WITH NEGO'D LEASE ------------- */
     switch (*perr) {
         case DHCPc_ERR_NONE:                                    /* If lease successfully acquired, ...                  */
-
-             DHCPc_AddrCfg(pif_info, perr);                     /* ... cfg net addr                ...                  */
+             if (addr_cfgd != DEF_YES) {                        /* ... & net addr NOT yet cfg'd,   ...                  */
+                 DHCPc_AddrCfg(pif_info, perr);                 /* ... cfg net addr                ...                  */
+             }
              if (*perr == DHCPc_ERR_NONE) {
                  DHCPc_LeaseTimeCalc(pif_info, perr);           /* ... calc lease time & set tmr.                       */
                  if (*perr != DHCPc_ERR_NONE) {                 /* If err setting tmr, ...                              */
@@ -2941,6 +3319,156 @@ static  void  DHCPc_InitStateHandler (DHCPc_IF_INFO  *pif_info,
 }
 
 
+/*
+*********************************************************************************************************
+*                                    DHCPc_InitRebootStateHandler()
+*
+* Description : (1) Perform actions associated with the INIT-REBOOT state :
+*
+*                   (a) Configure interface with saved lease, if resumed                 See Note #3
+*                   (b) Transmit  REQUEST for saved lease & get reply
+*                   (c) Get       server identifier
+*                   (d) Remove    saved lease from interface, if NOT re-confirmed
+*
+*
+* Argument(s) : pif_info        Pointer to DHCP interface information.
+*               --------        Argument validated in DHCPc_MsgRxHandler().
+*
+*               sock_id         Socket ID of socket to transmit & receive DHCPc data.
+*
+*               paddr_hw        Pointer to hardware address buffer.
+*
+*               addr_hw_len     Length of the hardware address buffer pointed to by 'paddr_hw'.
+*
+*               perr        Pointer to variable that will receive the return error code from this function :
+*
+*                               DHCPc_ERR_NONE                  Saved lease successfully re-confirmed.
+*
+*                                                               ---------- RETURNED BY DHCPc_Req() : ------------
+*                               DHCPc_ERR_NULL_PTR              Argument(s) passed a NULL pointer.
+*                               DHCPc_ERR_RX_NAK                NAK message received from server.
+*                               DHCPc_ERR_MSG_NONE_AVAIL        Message pool empty.
+*                               DHCPc_ERR_INVALID_MSG_SIZE      Argument 'pmsg_buf' size invalid.
+*                               DHCPc_ERR_INVALID_MSG           Invalid DHCP message.
+*                               DHCPc_ERR_TX                    Transmit error.
+*                               DHCPc_ERR_RX_MSG_TYPE           Error extracting message type from reply message.
+*                               DHCPc_ERR_RX_OVF                Receive error, data buffer overflow.
+*                               DHCPc_ERR_RX                    Receive error.
+*
+* Return(s)   : DEF_YES, if saved lease re-confirmed & its address still configured on the interface
+*                            (see Note #3b).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DHCPc_InitStateHandler().
+*
+* Note(s)     : (2) RFC #2131, Section 4.3.2 states that a REQUEST generated during INIT-REBOOT "MUST
+*                   NOT" fill in the 'server identifier' option, "MUST" fill in the 'requested IP address'
+*                   option with the previously assigned address, & that 'ciaddr' "MUST be zero".
+*
+*                   See also 'DHCPc_TxMsgPrepare()'.
+*
+*               (3) (a) If the saved lease is resumed, the interface is configured with the saved lease's
+*                       address & reported configured BEFORE the REQUEST is transmitted, so that the
+*                       application may use the interface without waiting for the server's reply.
+*
+*                   (b) If the lease is re-confirmed for the same address, the interface's configuration
+*                       is kept; otherwise, ALL addresses are removed from the interface, which returns
+*                       to the dynamic configuration start state, & the interface is reported in
+*                       progress.
+*
+*               (4) Addresses already configured on the interface are NOT re-validated (see
+*                   'DHCPc_InitStateHandler()  Note #5').
+*********************************************************************************************************
+*/
+
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  DHCPc_InitRebootStateHandler (DHCPc_IF_INFO  *pif_info,
+                                                   NET_SOCK_ID     sock_id,
+                                                   CPU_INT08U     *paddr_hw,
+                                                   CPU_INT08U      addr_hw_len,
+                                                   DHCPc_ERR      *perr)
+{
+    DHCPc_LEASE    *please;
+    DHCPc_MSG      *pmsg;
+    DHCP_MSG_HDR   *pmsg_hdr;
+    CPU_INT08U     *popt;
+    CPU_INT08U      opt_val_len;
+    NET_IF_NBR      if_nbr;
+    NET_IPv4_ADDR   addr_host;
+    NET_IPv4_ADDR   addr_subnet_mask;
+    NET_IPv4_ADDR   addr_dflt_gateway;
+    NET_IPv4_ADDR   addr_ack;
+    CPU_BOOLEAN     resumed;
+    CPU_BOOLEAN     cfgd;
+    NET_ERR         err_net;
+    CPU_SR_ALLOC();
+
+
+    if_nbr  =  pif_info->IF_Nbr;
+    please  = &pif_info->LeaseSaved;
+    resumed =  DEF_NO;
+
+                                                                /* ---------------- RESUME SAVED LEASE ---------------- */
+    if ((pif_info->LeaseResume == DEF_YES) &&                   /* If saved lease resumed & NOT expired, ...            */
+        (please->LeaseRemain_sec >  0u)) {
+        NET_UTIL_VAL_COPY_GET_NET_32(&addr_host,         &please->Addr);
+        NET_UTIL_VAL_COPY_GET_NET_32(&addr_subnet_mask,  &please->AddrSubnetMask);
+        NET_UTIL_VAL_COPY_GET_NET_32(&addr_dflt_gateway, &please->AddrDfltGateway);
+                                                                /* ... cfg IF with saved addr (see Note #3a).           */
+        cfgd = NetIPv4_CfgAddrAddDynamic(if_nbr, addr_host, addr_subnet_mask, addr_dflt_gateway, &err_net);
+        if (cfgd == DEF_OK) {
+            resumed = DEF_YES;
+
+            CPU_CRITICAL_ENTER();
+            pif_info->LeaseStatus = DHCP_STATUS_CFGD;
+            CPU_CRITICAL_EXIT();
+        }
+    }
+
+                                                                /* -------------- TX REQUEST & GET REPLY -------------- */
+    pif_info->ClientState = DHCP_STATE_INIT_REBOOT;
+    pif_info->TransactionID++;                                  /* Inc last transaction ID (see 'DHCPc_Discover()  ...  */
+                                                                /* ... Note #2').                                       */
+    DHCPc_Req(sock_id, pif_info, paddr_hw, addr_hw_len, perr);  /* See Note #2.                                         */
+
+    addr_ack = NET_IPv4_ADDR_NONE;
+    if (*perr == DHCPc_ERR_NONE) {
+        pmsg     = (DHCPc_MSG    *) pif_info->MsgPtr;
+        pmsg_hdr = (DHCP_MSG_HDR *)&pmsg->MsgBuf[0];
+        NET_UTIL_VAL_COPY_32(&addr_ack, &pmsg_hdr->yiaddr);
+
+                                                                /* ---------------- GET SERVER ID ------------------- */
+        popt = DHCPc_MsgGetOpt((DHCPc_OPT_CODE) DHCP_OPT_SERVER_IDENTIFIER,
+                               (CPU_INT08U   *)&pmsg->MsgBuf[0],
+                               (CPU_INT16U    ) pmsg->MsgLen,
+                               (CPU_INT08U   *)&opt_val_len);
+        if (popt != (CPU_INT08U *)0) {
+            NET_UTIL_VAL_COPY_32(&pif_info->ServerID, popt);
+        } else {
+            pif_info->ServerID = please->ServerID;
+        }
+
+        if ((resumed  == DEF_YES) &&                            /* If same addr re-confirmed, ...                       */
+            (addr_ack == please->Addr)) {
+            return (DEF_YES);                                   /* ... keep IF cfg (see Note #3b).                      */
+        }
+    }
+
+                                                                /* -------------- REMOVE SAVED LEASE ------------------ */
+    if (resumed == DEF_YES) {                                   /* See Note #3b.                                        */
+        CPU_CRITICAL_ENTER();
+        pif_info->LeaseStatus = DHCP_STATUS_CFG_IN_PROGRESS;
+        CPU_CRITICAL_EXIT();
+
+        NetIPv4_CfgAddrAddDynamicStart(if_nbr, &err_net);
+    }
+
+    return (DEF_NO);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   DHCPc_RenewRebindStateHandler()
@@ -3519,6 +4047,7 @@ static  void  DHCPc_Discover (NET_SOCK_ID     sock_id,
 * Return(s)   : none.
 *
 * Caller(s)   : DHCPc_InitStateHandler(),
+*               DHCPc_InitRebootStateHandler(),
 *               DHCPc_RenewRebindStateHandler()
 *
 * Note(s)     : (2) If NO DHCP message is received following a DHCP REQUEST transmission, the caller is
@@ -4897,6 +5426,10 @@ static  CPU_INT16U  DHCPc_Rx (NET_SOCK_ID         sock_id,
 *                   DHCP_MSG_TX_MIN_LEN octets.
 *
 *                   See also 'dhcp-c.h  DHCP MESSAGE DEFINES  Note #2'.
+*
+*               (6) A REQUEST transmitted from the INIT-REBOOT state requests the saved lease's address
+*                   since NO message has been received from the server (see 'DHCPc_InitRebootStateHandler()
+*                   Note #2').
 *********************************************************************************************************
 */
 
@@ -4912,6 +5445,7 @@ static  CPU_INT16U  DHCPc_TxMsgPrepare (DHCPc_IF_INFO   *pif_info,
     CPU_INT08U    *pmsg_opt;
     DHCPc_MSG     *pmsg_last_rx;
     DHCP_MSG_HDR  *pmsg_last_rx_hdr;
+    void          *paddr_req;
     CPU_INT16U     msg_size;
     CPU_INT16U     flag;
     CPU_INT32U     ciaddr;
@@ -5027,6 +5561,13 @@ static  CPU_INT16U  DHCPc_TxMsgPrepare (DHCPc_IF_INFO   *pif_info,
 
     pmsg_last_rx     = (DHCPc_MSG    *) pif_info->MsgPtr;
     pmsg_last_rx_hdr = (DHCP_MSG_HDR *)&pmsg_last_rx->MsgBuf[0];
+    paddr_req        = (void         *)&pmsg_last_rx_hdr->yiaddr;
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+    if ((msg_type              == DHCP_MSG_REQUEST) &&          /* If INIT-REBOOT REQUEST, ...                          */
+        (pif_info->ClientState == DHCP_STATE_INIT_REBOOT)) {
+        paddr_req = (void *)&pif_info->LeaseSaved.Addr;         /* ... req saved lease addr (see Note #6).              */
+    }
+#endif
 
     if (get_local_addr == DEF_YES) {
         NET_UTIL_VAL_COPY_32(&ciaddr, &pmsg_last_rx_hdr->yiaddr);
@@ -5076,7 +5617,7 @@ static  CPU_INT16U  DHCPc_TxMsgPrepare (DHCPc_IF_INFO   *pif_info,
     if (wr_req_ip_addr == DEF_YES) {                            /* Requested IP address.                                */
        *popt++  = DHCP_OPT_REQUESTED_IP_ADDRESS;
        *popt++  = 4;
-        NET_UTIL_VAL_COPY_32(popt, &pmsg_last_rx_hdr->yiaddr);
+        NET_UTIL_VAL_COPY_32(popt, paddr_req);
         popt   += 4;
     }
 
@@ -209,6 +209,10 @@
 *               receive unicast packets when not fully configured.  This is the case of the uC/TCPIP
 *               stack, so this define MUST be set to DEF_ENABLED when this DHCP client is used with the
 *               Micrium's uC/TCP-IP stack.
+*
+*           (2) Configure DHCPc_CFG_INIT_REBOOT_EN to DEF_ENABLED to allow the DHCP client to re-confirm a
+*               lease saved by the application with a single REQUEST (see RFC #2131, Section 3.2), instead
+*               of negotiating a new lease from the INIT state.
 *********************************************************************************************************
 */
 
@@ -218,6 +222,12 @@
                                                                 /*   DEF_ENABLED   Broadcast bit     set                */
 #endif
 
+#ifndef  DHCPc_CFG_INIT_REBOOT_EN
+#define  DHCPc_CFG_INIT_REBOOT_EN                DEF_ENABLED    /* Configure INIT-REBOOT                 (see Note #2) :*/
+                                                                /*   DEF_DISABLED  INIT-REBOOT DISABLED                 */
+                                                                /*   DEF_ENABLED   INIT-REBOOT ENABLED                  */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -275,6 +285,8 @@ typedef  enum dhcp_c_err {
 
     DHCPc_ERR_IPv4_NOT_PRESENT                       =  130,    /* DHCPc requires NET_IP_CFG_IPv4_EN set to DEF_ENABLED */
 
+    DHCPc_ERR_LEASE_INVALID                          =  140,    /* Invalid saved lease.                                 */
+
 
 
     DHCPc_OS_ERR_NONE                                =  200,
@@ -858,6 +870,30 @@ typedef  struct dhcp_msg_hdr {
 #define  DHCPc_MSG_OPT_SIZE  (DHCP_PKT_BUF_SIZE - DHCP_MSG_HDR_SIZE)
 
 
+/*
+*********************************************************************************************************
+*                                        DHCPc LEASE DATA TYPE
+*
+* Note(s) : (1) A lease is retrieved with DHCPc_LeaseGet() so that the application may save it, in any
+*               memory preserved across resets, & later re-confirm it with DHCPc_StartReboot().
+*
+*           (2) ALL addresses are in network order.
+*
+*           (3) 'LeaseRemain_sec' is the lease time remaining when the lease was retrieved.  Before the
+*               lease is re-confirmed, the application SHOULD subtract the time elapsed since then, when
+*               known.
+*********************************************************************************************************
+*/
+
+typedef  struct  dhcpc_lease {
+    NET_IPv4_ADDR       Addr;                                   /* Leased addr.                                         */
+    NET_IPv4_ADDR       AddrSubnetMask;                         /* Leased addr's subnet mask.                           */
+    NET_IPv4_ADDR       AddrDfltGateway;                        /* Leased addr's dflt gateway.                          */
+    NET_IPv4_ADDR       ServerID;                               /* Server responsible for lease.                        */
+    CPU_INT32U          LeaseRemain_sec;                        /* Remaining lease time (see Note #3).                  */
+} DHCPc_LEASE;
+
+
 /*
 *********************************************************************************************************
 *                                      DHCPc INTERNAL DATA TYPES
@@ -929,6 +965,11 @@ struct dhcpc_if_info {
 
     DHCPc_TMR          *Tmr;                                    /* Ptr to DHCP tmr.                                     */
 
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+    DHCPc_LEASE         LeaseSaved;                             /* Saved lease to re-confirm in INIT-REBOOT state.      */
+    CPU_BOOLEAN         LeaseResume;                            /* Use saved lease while re-confirming it.              */
+#endif
+
     CPU_INT16U          Flags;                                  /* IF info flags.                                       */
 };
 
@@ -1017,6 +1058,16 @@ void           DHCPc_Start        (NET_IF_NBR       if_nbr,
                                    CPU_INT08U       req_param_tbl_qty,
                                    DHCPc_ERR       *perr);
 
+#if (DHCPc_CFG_INIT_REBOOT_EN == DEF_ENABLED)
+                                                                /* Start DHCP service with saved lease.                 */
+void           DHCPc_StartReboot  (NET_IF_NBR       if_nbr,
+                                   DHCPc_OPT_CODE  *preq_param_tbl,
+                                   CPU_INT08U       req_param_tbl_qty,
+                                   DHCPc_LEASE     *please,
+                                   CPU_BOOLEAN      resume,
+                                   DHCPc_ERR       *perr);
+#endif
+
                                                                 /* Stop  DHCP service for specified interface.          */
 void           DHCPc_Stop         (NET_IF_NBR       if_nbr,
                                    DHCPc_ERR       *perr);
@@ -1032,6 +1083,11 @@ void          DHCPc_GetOptVal     (NET_IF_NBR       if_nbr,
                                    CPU_INT16U      *pval_buf_len,
                                    DHCPc_ERR       *perr);
 
+                                                                /* Get current lease for a given interface.             */
+void          DHCPc_LeaseGet      (NET_IF_NBR       if_nbr,
+                                   DHCPc_LEASE     *please,
+                                   DHCPc_ERR       *perr);
+
 
 void          DHCPc_TmrTaskHandler(void);
 
@@ -1146,6 +1202,20 @@ CPU_INT32U   DHCPc_OS_TimeCalcElapsed_sec(CPU_INT32U   time_start,  /* Calculate
 
 
 
+#ifndef  DHCPc_CFG_INIT_REBOOT_EN
+#error  "DHCPc_CFG_INIT_REBOOT_EN                not #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+
+#elif  ((DHCPc_CFG_INIT_REBOOT_EN != DEF_DISABLED) && \
+        (DHCPc_CFG_INIT_REBOOT_EN != DEF_ENABLED ))
+#error  "DHCPc_CFG_INIT_REBOOT_EN          illegally #define'd in 'dhcp-c_cfg.h'"
+#error  "                                  [MUST be  DEF_DISABLED]              "
+#error  "                                  [     ||  DEF_ENABLED ]              "
+#endif
+
+
+
 #ifndef  DHCPc_CFG_PARAM_REQ_TBL_SIZE
 #error  "DHCPc_CFG_PARAM_REQ_TBL_SIZE            not #define'd in 'dhcp-c_cfg.h'"
 #error  "                                  [MUST be  >= 1  ]                    "
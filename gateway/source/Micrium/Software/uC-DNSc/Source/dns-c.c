@@ -666,3 +666,95 @@ void  DNSc_CacheClrHost (CPU_CHAR  *p_host_name,
     DNScCache_HostSrchRemove(p_host_name, p_err);
 }
 
+
+
+/*
+*********************************************************************************************************
+*                                         DNSc_CacheEntryGet()
+*
+* Description : Get a cached host's addresses so that they may be kept across a restart.
+*
+* Argument(s) : p_host_name Pointer to a string that contains the host name.
+*
+*               p_entry     Pointer to cache entry that will receive the host's addresses.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE           Cache entry successfully returned.
+*                               DNSc_ERR_NULL_PTR       Invalid pointer.
+*
+*                               RETURNED BY DNScCache_EntryGet():
+*                                   See DNScCache_EntryGet() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The cache entry may be restored with DNSc_CacheEntrySet() after a restart.
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheEntryGet (CPU_CHAR          *p_host_name,
+                          DNSc_CACHE_ENTRY  *p_entry,
+                          DNSc_ERR          *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_host_name == DEF_NULL) ||
+        (p_entry     == DEF_NULL)) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    DNScCache_EntryGet(p_host_name, p_entry, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNSc_CacheEntrySet()
+*
+* Description : Add a host to the cache from a cache entry kept across a restart.
+*
+* Argument(s) : p_entry     Pointer to cache entry (see 'DNSc_CacheEntryGet()').
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE           Cache entry successfully added.
+*                               DNSc_ERR_NULL_PTR       Invalid pointer.
+*
+*                               RETURNED BY DNScCache_EntrySet():
+*                                   See DNScCache_EntrySet() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) DNSc_CacheEntrySet() MUST be called after DNSc_Init().
+*
+*               (2) The host's addresses are treated as stale : they are returned by DNSc_GetHost() ONLY
+*                   if DNSc_CFG_CACHE_REFRESH_EN is enabled & while the host is resolved again (see
+*                   'dns-c_cache.c  DNScCache_EntrySet()  Note #2').
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheEntrySet (DNSc_CACHE_ENTRY  *p_entry,
+                          DNSc_ERR          *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_entry == DEF_NULL) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    DNScCache_EntrySet(p_entry, p_err);
+}
@@ -194,6 +194,17 @@
 #endif
 
 
+#ifndef  DNSc_CFG_CACHE_REFRESH_EN
+    #define  DNSc_CFG_CACHE_REFRESH_EN             DEF_DISABLED
+#elif  ((DNSc_CFG_CACHE_REFRESH_EN != DEF_ENABLED ) && \
+        (DNSc_CFG_CACHE_REFRESH_EN != DEF_DISABLED))
+    #error  "DNSc_CFG_CACHE_REFRESH_EN not #define'd in 'dns-c_cfg.h' [MUST be  DEF_DISABLED ||  DEF_ENABLED ] "
+#elif  ((DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED ) && \
+        (DNSc_CFG_MODE_ASYNC_EN    != DEF_ENABLED ))
+    #error  "DNSc_CFG_CACHE_REFRESH_EN illegally #define'd in 'dns-c_cfg.h' [REQUIRES DNSc_CFG_MODE_ASYNC_EN] "
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -205,6 +216,25 @@
 #define  DNSc_DFLT_TASK_DLY_MS                 50u
 #define  DNSc_DFLT_REQ_RETRY_NBR_MAX            2u
 #define  DNSc_DFLT_REQ_RETRY_TIMEOUT_MS      1000u
+#define  DNSc_DFLT_CACHE_STALE_MAX_SEC      86400u              /* 1 day (see RFC #8767, Section 5).                    */
+
+#define  DNSc_CACHE_TTL_MAX_SEC            604800u              /* 7 days (see RFC #8767, Section 4).                   */
+
+#ifndef  DNSc_CACHE_ENTRY_NAME_LEN_MAX
+#define  DNSc_CACHE_ENTRY_NAME_LEN_MAX        128u
+#endif
+
+#ifndef  DNSc_CACHE_ENTRY_ADDR_NBR_MAX
+#define  DNSc_CACHE_ENTRY_ADDR_NBR_MAX          2u
+#endif
+
+#if  (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+    #ifndef  DNSc_CFG_CACHE_STALE_MAX_SEC
+        #define  DNSc_CFG_CACHE_STALE_MAX_SEC      DNSc_DFLT_CACHE_STALE_MAX_SEC
+    #elif   (DNSc_CFG_CACHE_STALE_MAX_SEC > DNSc_CACHE_TTL_MAX_SEC)
+        #error  "DNSc_CFG_CACHE_STALE_MAX_SEC illegally #define'd in 'dns-c_cfg.h' [MUST be <= DNSc_CACHE_TTL_MAX_SEC] "
+    #endif
+#endif
 
 
 
@@ -354,10 +384,36 @@ typedef  struct  DNSc_host {
     DNSc_REQ_CFG    *ReqCfgPtr;
 #ifdef  DNSc_SIGNAL_TASK_MODULE_EN
     KAL_SEM_HANDLE   TaskSignal;
+#endif
+    CPU_INT32U       TTL_sec;                                   /* TTL of cached addrs.                                 */
+    CPU_INT32U       ReqTTL_sec;                                /* Lowest TTL rx'd by the current resolution.           */
+    NET_TS_MS        ResolvedTS_ms;                             /* TS at which cached addrs were resolved.              */
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+    NET_TS_MS        RefreshTS_ms;                              /* TS of last failed refresh.                           */
+    CPU_BOOLEAN      Refresh;                                   /* Refresh in progress.                                 */
+    CPU_BOOLEAN      RefreshDly;                                /* Last refresh failed; dly next one.                   */
+    CPU_BOOLEAN      AddrsStale;                                /* Cached addrs NOT yet replaced by refresh.            */
+    CPU_BOOLEAN      Used;                                      /* Cached addrs rtn'd since resolved.                   */
 #endif
 } DNSc_HOST_OBJ;
 
 
+/*
+*********************************************************************************************************
+*                                       DNSc CACHE ENTRY DATA TYPE
+*
+* Note(s) : (1) A cache entry holds the addresses of a cached host so that the application may keep them
+*               across a restart (see 'dns-c.c  DNSc_CacheEntryGet()' & 'dns-c.c  DNSc_CacheEntrySet()').
+*********************************************************************************************************
+*/
+
+typedef  struct  DNSc_cache_entry {
+    CPU_CHAR         Name[DNSc_CACHE_ENTRY_NAME_LEN_MAX];       /* Host name.                                           */
+    DNSc_ADDR_OBJ    Addrs[DNSc_CACHE_ENTRY_ADDR_NBR_MAX];      /* Host addrs.                                          */
+    CPU_INT08U       AddrNbr;                                   /* Nbr of host addrs.                                   */
+} DNSc_CACHE_ENTRY;
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -395,5 +451,12 @@ void         DNSc_CacheClrAll     (       DNSc_ERR       *p_err);
 void         DNSc_CacheClrHost    (       CPU_CHAR       *p_host_name,
                                           DNSc_ERR       *p_err);
 
+void         DNSc_CacheEntryGet   (       CPU_CHAR          *p_host_name,
+                                          DNSc_CACHE_ENTRY  *p_entry,
+                                          DNSc_ERR          *p_err);
+
+void         DNSc_CacheEntrySet   (       DNSc_CACHE_ENTRY  *p_entry,
+                                          DNSc_ERR          *p_err);
+
 #endif
 
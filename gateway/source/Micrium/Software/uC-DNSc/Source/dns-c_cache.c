@@ -53,12 +53,34 @@
 
 #include  "dns-c_cache.h"
 #include  "dns-c_req.h"
+#include  "dns-c_task.h"
 #include  <Source/net_ascii.h>
 #include  <Source/net_util.h>
 #include  <IF/net_if.h>
 #include  <lib_mem.h>
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) A host's addresses are refreshed once less than 1/DNSc_CACHE_REFRESH_TTL_DIV of their TTL
+*               remains (see 'DNScCache_HostAgeGet()').
+*
+*           (2) RFC #8767, Section 5 recommends that a failed refresh NOT be retried for 30 seconds.
+*
+*           (3) An answer without any address is cached for 30 seconds only (see 'DNScCache_HostResolveEnd()
+*               Note #1').
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_CACHE_REFRESH_TTL_DIV                        8u   /* See Note #1.                                         */
+#define  DNSc_CACHE_REFRESH_RETRY_MS                   30000u   /* See Note #2.                                         */
+#define  DNSc_CACHE_TTL_NO_ADDR_SEC                       30u   /* See Note #3.                                         */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -67,6 +89,13 @@
 *********************************************************************************************************
 */
 
+typedef  enum  DNSc_cache_age {
+    DNSc_CACHE_AGE_FRESH,                                       /* Addrs within TTL.                                    */
+    DNSc_CACHE_AGE_REFRESH,                                     /* Addrs within TTL but due for refresh.                */
+    DNSc_CACHE_AGE_STALE,                                       /* Addrs past TTL but within stale period.              */
+    DNSc_CACHE_AGE_EXPIRED                                      /* Addrs past TTL & stale period.                       */
+} DNSc_CACHE_AGE;
+
 
 /*
 *********************************************************************************************************
@@ -86,6 +115,8 @@ static        MEM_DYN_POOL     DNScCache_AddrObjPool;
 
 static        DNSc_CACHE_ITEM  *DNSc_CacheItemListHead;
 
+static  const DNSc_CFG         *DNScCache_CfgPtr;
+
 
 /*
 *********************************************************************************************************
@@ -129,6 +160,15 @@ static  void              DNScCache_HostRelease      (       DNSc_HOST_OBJ    *p
 
 static  void              DNScCache_HostAddrClr      (       DNSc_HOST_OBJ    *p_host);
 
+static  DNSc_CACHE_AGE    DNScCache_HostAgeGet       (       DNSc_HOST_OBJ    *p_host);
+
+static  void              DNScCache_HostResolveEnd   (       DNSc_HOST_OBJ    *p_host,
+                                                             DNSc_STATUS       status);
+
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+static  CPU_BOOLEAN       DNScCache_HostRefreshStart (       DNSc_HOST_OBJ    *p_host);
+#endif
+
 static  DNSc_STATUS       DNScCache_Resolve          (const  DNSc_CFG         *p_cfg,
                                                              DNSc_HOST_OBJ    *p_host,
                                                              DNSc_ERR         *p_err);
@@ -173,6 +213,8 @@ void  DNScCache_Init (const  DNSc_CFG  *p_cfg,
     KAL_ERR     kal_err;
 
 
+    DNScCache_CfgPtr     = p_cfg;
+
     DNScCache_LockHandle = KAL_LockCreate("DNSc Lock",
                                          KAL_OPT_CREATE_NONE,
                                          &kal_err);
@@ -314,6 +356,12 @@ void  DNScCache_Clr (DNSc_ERR  *p_err)
 
     while (p_cache != DEF_NULL) {
         p_cache_next = p_cache->NextPtr;
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if (p_cache->HostPtr->Refresh == DEF_YES) {             /* Host being refreshed by DNSc's task.                 */
+            p_cache = p_cache_next;
+            continue;
+        }
+#endif
         switch (p_cache->HostPtr->State) {
             case DNSc_STATE_INIT_REQ:
             case DNSc_STATE_TX_REQ_IPv4:
@@ -452,6 +500,12 @@ void  DNScCache_HostSrchRemove (CPU_CHAR  *p_host_name,
 
     p_host = DNScCache_HostSrchByName(p_host_name);
     if (p_host != DEF_NULL) {
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if (p_host->Refresh == DEF_YES) {                       /* Host being refreshed by DNSc's task.                 */
+           *p_err  = DNSc_ERR_CACHE_HOST_PENDING;
+            goto exit_release;
+        }
+#endif
         switch(p_host->State) {
             case DNSc_STATE_TX_REQ_IPv4:
             case DNSc_STATE_RX_RESP_IPv4:
@@ -556,7 +610,18 @@ exit:
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) (a) A host's addresses are returned ONLY within their TTL.  Once expired, the host is
+*                       removed from the cache & must be resolved again.
+*
+*                   (b) If DNSc_CFG_CACHE_REFRESH_EN is enabled :
+*
+*                       (1) Addresses due for refresh are returned & refreshed by DNSc's task.
+*
+*                       (2) Addresses past their TTL are returned for up to DNSc_CFG_CACHE_STALE_MAX_SEC
+*                           while they are refreshed, so that a slow or unreachable DNS server does NOT
+*                           delay the caller (see RFC #8767, Section 5).
+*
+*                       (3) Addresses being refreshed are returned until replaced.
 *********************************************************************************************************
 */
 
@@ -574,6 +639,10 @@ DNSc_STATUS  DNScCache_Srch (CPU_CHAR       *p_host_name,
     DNSc_STATUS      status  = DNSc_STATUS_FAILED;
     CPU_BOOLEAN      no_ipv4 = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv6_ONLY);
     CPU_BOOLEAN      no_ipv6 = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv4_ONLY);
+    DNSc_CACHE_AGE   age;
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+    CPU_BOOLEAN      refresh;
+#endif
 
 
    *p_addr_nbr_rtn = 0u;
@@ -586,6 +655,12 @@ DNSc_STATUS  DNScCache_Srch (CPU_CHAR       *p_host_name,
 
     p_host = DNScCache_HostSrchByName(p_host_name);
     if (p_host != DEF_NULL) {
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if (p_host->Refresh == DEF_YES) {                       /* If host being refreshed, ...                         */
+            status = DNSc_STATUS_RESOLVED;                      /* ... rtn cached addrs (see Note #1b3).                */
+            goto exit_found;
+        }
+#endif
         switch(p_host->State) {
             case DNSc_STATE_TX_REQ_IPv4:
             case DNSc_STATE_RX_RESP_IPv4:
@@ -596,6 +671,31 @@ DNSc_STATUS  DNScCache_Srch (CPU_CHAR       *p_host_name,
                  goto exit_release;
 
             case DNSc_STATE_RESOLVED:
+                 age = DNScCache_HostAgeGet(p_host);
+                 switch (age) {
+                     case DNSc_CACHE_AGE_FRESH:
+                          break;
+
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+                     case DNSc_CACHE_AGE_REFRESH:               /* See Note #1b1.                                       */
+                     case DNSc_CACHE_AGE_STALE:                 /* See Note #1b2.                                       */
+                          refresh = DNScCache_HostRefreshStart(p_host);
+                          if (refresh == DEF_YES) {
+                              DNScTask_ReqSignal();
+                          }
+                          break;
+#endif
+
+                     case DNSc_CACHE_AGE_EXPIRED:               /* See Note #1a.                                        */
+                     default:
+                          DNScCache_HostRemoveHandler(p_host);
+                         *p_err = DNSc_ERR_CACHE_HOST_NOT_FOUND;
+                          goto exit_release;
+                 }
+
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+                 p_host->Used = DEF_YES;
+#endif
                  status = DNSc_STATUS_RESOLVED;
                  goto exit_found;
 
@@ -773,6 +873,17 @@ DNSc_HOST_OBJ  *DNScCache_HostObjGet (CPU_CHAR      *p_host_name,
     p_host->State      = DNSc_STATE_INIT_REQ;
     p_host->ReqCfgPtr  = p_cfg;
 
+    p_host->TTL_sec       = 0u;
+    p_host->ReqTTL_sec    = DNSc_CACHE_TTL_MAX_SEC;
+    p_host->ResolvedTS_ms = 0u;
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+    p_host->RefreshTS_ms  = 0u;
+    p_host->Refresh       = DEF_NO;
+    p_host->RefreshDly    = DEF_NO;
+    p_host->AddrsStale    = DEF_NO;
+    p_host->Used          = DEF_NO;
+#endif
+
     DNScCache_HostObjNameSet(p_host, p_host_name, p_err);
     if (*p_err != DNSc_ERR_NONE) {
          goto exit_release;
@@ -855,9 +966,11 @@ void  DNScCache_HostObjFree (DNSc_HOST_OBJ  *p_host)
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScReq_RxRespAddAddr().
+* Caller(s)   : DNScCache_EntrySet(),
+*               DNScReq_RxRespAddAddr().
 *
-* Note(s)     : None.
+* Note(s)     : (1) The addresses of a host being refreshed are replaced by the first address received
+*                   (see 'DNScCache_Srch()  Note #1b3').
 *********************************************************************************************************
 */
 
@@ -890,6 +1003,16 @@ void  DNScCache_HostAddrInsert (const  DNSc_CFG       *p_cfg,
              goto exit;
     }
 
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+    if (p_host->AddrsStale == DEF_YES) {                        /* If cached addrs NOT yet replaced, ...                */
+        DNScCache_HostAddrClr(p_host);                          /* ... clr them (see Note #1).                          */
+        p_host->AddrsCount     = 0u;
+        p_host->AddrsIPv4Count = 0u;
+        p_host->AddrsIPv6Count = 0u;
+        p_host->AddrsStale     = DEF_NO;
+    }
+#endif
+
     p_item_cur = DNScCache_AddrItemGet(p_err);
     if (*p_err != DNSc_ERR_NONE) {
          goto exit;
@@ -1193,6 +1316,323 @@ exit:
 }
 
 
+/*
+*********************************************************************************************************
+*                                        DNScCache_RefreshChk()
+*
+* Description : (1) Check cache entries' age :
+*
+*                   (a) Start refresh of used entries due for refresh or stale
+*                   (b) Remove entries past their stale period
+*
+*
+* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE   Cache entries successfully checked.
+*
+*                           RETURNED BY DNScCache_LockAcquire():
+*                               See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : Number of refresh started.
+*
+* Caller(s)   : DNScTask().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (2) ONLY entries used since their last resolution are refreshed so that unused entries
+*                   do NOT generate DNS traffic; they are refreshed on their next use instead (see
+*                   'DNScCache_Srch()  Note #1b').
+*
+*               (3) Entries are removed once past their stale period so that their age never overflows
+*                   the network timestamp.
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+CPU_INT16U  DNScCache_RefreshChk (DNSc_ERR  *p_err)
+{
+    DNSc_CACHE_ITEM  *p_item;
+    DNSc_CACHE_ITEM  *p_item_next;
+    DNSc_HOST_OBJ    *p_host;
+    DNSc_CACHE_AGE    age;
+    CPU_BOOLEAN       refresh;
+    CPU_INT16U        refresh_ctr = 0u;
+
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+
+    p_item = DNSc_CacheItemListHead;
+
+    while (p_item != DEF_NULL) {
+        p_item_next = p_item->NextPtr;
+        p_host      = p_item->HostPtr;
+
+        if (p_host->State == DNSc_STATE_RESOLVED) {
+            age = DNScCache_HostAgeGet(p_host);
+            switch (age) {
+                case DNSc_CACHE_AGE_REFRESH:                    /* See Note #1a.                                        */
+                case DNSc_CACHE_AGE_STALE:
+                     if (p_host->Used == DEF_YES) {             /* See Note #2.                                         */
+                         refresh = DNScCache_HostRefreshStart(p_host);
+                         if (refresh == DEF_YES) {
+                             refresh_ctr++;
+                         }
+                     }
+                     break;
+
+
+                case DNSc_CACHE_AGE_EXPIRED:                    /* See Notes #1b & #3.                                  */
+                     DNScCache_ItemRelease(p_item);
+                     break;
+
+
+                case DNSc_CACHE_AGE_FRESH:
+                default:
+                     break;
+            }
+        }
+
+        p_item = p_item_next;
+    }
+
+
+   *p_err = DNSc_ERR_NONE;
+
+    DNScCache_LockRelease();
+
+
+exit:
+    return (refresh_ctr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_EntryGet()
+*
+* Description : Get a cached host's addresses.
+*
+* Argument(s) : p_host_name     Pointer to a string that contains the host name.
+*
+*               p_entry         Pointer to cache entry that will receive the host's addresses.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   DNSc_ERR_NONE                   Cache entry successfully returned.
+*                                   DNSc_ERR_CACHE_HOST_NOT_FOUND   Host not found in the cache.
+*                                   DNSc_ERR_CACHE_HOST_PENDING     Host resolution is pending.
+*                                   DNSc_ERR_INVALID_HOST_NAME      Host name too long for a cache entry.
+*
+*                                   RETURNED BY DNScCache_LockAcquire():
+*                                       See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_CacheEntryGet().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Addresses are returned regardless of their age.
+*********************************************************************************************************
+*/
+
+void  DNScCache_EntryGet (CPU_CHAR          *p_host_name,
+                          DNSc_CACHE_ENTRY  *p_entry,
+                          DNSc_ERR          *p_err)
+{
+    DNSc_HOST_OBJ   *p_host;
+    DNSc_ADDR_ITEM  *p_item;
+    CPU_SIZE_T       name_len;
+    CPU_INT08U       i;
+
+
+    name_len = Str_Len_N(p_host_name, DNSc_CACHE_ENTRY_NAME_LEN_MAX);
+    if (name_len >= DNSc_CACHE_ENTRY_NAME_LEN_MAX) {
+       *p_err = DNSc_ERR_INVALID_HOST_NAME;
+        goto exit;
+    }
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+
+    p_host = DNScCache_HostSrchByName(p_host_name);
+    if (p_host == DEF_NULL) {
+       *p_err = DNSc_ERR_CACHE_HOST_NOT_FOUND;
+        goto exit_release;
+    }
+
+    if (p_host->State != DNSc_STATE_RESOLVED) {
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if (p_host->Refresh != DEF_YES) {
+           *p_err = DNSc_ERR_CACHE_HOST_PENDING;
+            goto exit_release;
+        }
+#else
+       *p_err = DNSc_ERR_CACHE_HOST_PENDING;
+        goto exit_release;
+#endif
+    }
+
+                                                                /* ------------------ COPY HOST ADDRS ----------------- */
+    Mem_Clr(p_entry, sizeof(DNSc_CACHE_ENTRY));
+    Str_Copy_N(p_entry->Name, p_host_name, DNSc_CACHE_ENTRY_NAME_LEN_MAX);
+
+    p_item = p_host->AddrsFirstPtr;
+    i      = 0u;
+    while ((p_item != DEF_NULL) &&
+           (i      <  DNSc_CACHE_ENTRY_ADDR_NBR_MAX)) {
+        p_entry->Addrs[i] = *p_item->AddrPtr;
+        i++;
+        p_item = p_item->NextPtr;
+    }
+    p_entry->AddrNbr = i;
+
+   *p_err = DNSc_ERR_NONE;
+
+exit_release:
+    DNScCache_LockRelease();
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_EntrySet()
+*
+* Description : Add a host to the cache from a cache entry.
+*
+* Argument(s) : p_entry     Pointer to cache entry.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE               Cache entry successfully added.
+*                               DNSc_ERR_INVALID_ARG        Invalid cache entry.
+*
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
+*
+*                               RETURNED BY DNScCache_HostObjGet():
+*                                   See DNScCache_HostObjGet() for additional return error codes.
+*
+*                               RETURNED BY DNScCache_AddrObjGet():
+*                                   See DNScCache_AddrObjGet() for additional return error codes.
+*
+*                               RETURNED BY DNScCache_HostAddrInsert():
+*                                   See DNScCache_HostAddrInsert() for additional return error codes.
+*
+*                               RETURNED BY DNScCache_HostInsert():
+*                                   See DNScCache_HostInsert() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_CacheEntrySet().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) A host already in the cache is NOT replaced since its addresses are at least as recent
+*                   as the entry's.
+*
+*               (2) The age of the entry's addresses is unknown.  The host is therefore added with an
+*                   expired TTL so that its addresses are ONLY returned as stale while they are refreshed
+*                   (see 'DNScCache_Srch()  Note #1').
+*********************************************************************************************************
+*/
+
+void  DNScCache_EntrySet (DNSc_CACHE_ENTRY  *p_entry,
+                          DNSc_ERR          *p_err)
+{
+    DNSc_HOST_OBJ  *p_host;
+    DNSc_ADDR_OBJ  *p_addr;
+    CPU_SIZE_T      name_len;
+    CPU_INT08U      i;
+
+
+    name_len = Str_Len_N(p_entry->Name, DNSc_CACHE_ENTRY_NAME_LEN_MAX);
+    if ((name_len         <  1u)                            ||
+        (name_len         >= DNSc_CACHE_ENTRY_NAME_LEN_MAX) ||
+        (p_entry->AddrNbr <  1u)                            ||
+        (p_entry->AddrNbr >  DNSc_CACHE_ENTRY_ADDR_NBR_MAX)) {
+       *p_err = DNSc_ERR_INVALID_ARG;
+        goto exit;
+    }
+
+                                                                /* ------------- CHK HOST NOT YET CACHED -------------- */
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+    p_host = DNScCache_HostSrchByName(p_entry->Name);
+
+    DNScCache_LockRelease();
+
+    if (p_host != DEF_NULL) {                                   /* See Note #1.                                         */
+       *p_err = DNSc_ERR_NONE;
+        goto exit;
+    }
+
+                                                                /* ------------------ SET HOST ADDRS ------------------ */
+    p_host = DNScCache_HostObjGet(p_entry->Name, DNSc_FLAG_NO_BLOCK, DEF_NULL, p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit_free_host;
+    }
+
+    for (i = 0u; i < p_entry->AddrNbr; i++) {
+        p_addr = DNScCache_AddrObjGet(p_err);
+        if (*p_err != DNSc_ERR_NONE) {
+             goto exit_release;
+        }
+
+       *p_addr = p_entry->Addrs[i];
+
+        DNScCache_HostAddrInsert(DNScCache_CfgPtr, p_host, p_addr, p_err);
+        if (*p_err != DNSc_ERR_NONE) {
+             DNScCache_AddrObjFree(p_addr);
+             goto exit_release;
+        }
+    }
+
+    p_host->TTL_sec       = 0u;                                 /* See Note #2.                                         */
+    p_host->ResolvedTS_ms = NetUtil_TS_Get_ms();
+    p_host->State         = DNSc_STATE_RESOLVED;
+
+    DNScCache_LockRelease();
+
+                                                                /* ------------------- INSERT HOST -------------------- */
+    DNScCache_HostInsert(p_host, p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit_free_host;
+    }
+
+    goto exit;
+
+
+exit_release:
+    DNScCache_LockRelease();
+
+exit_free_host:
+    DNScCache_HostObjFree(p_host);
+
+exit:
+    return;
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1215,10 +1655,13 @@ exit:
 * Return(s)   : None.
 *
 * Caller(s)   : DNScCache_Clr(),
+*               DNScCache_EntryGet(),
+*               DNScCache_EntrySet(),
 *               DNScCache_HostInsert(),
 *               DNScCache_HostObjGet(),
 *               DNScCache_HostRemove(),
 *               DNScCache_HostSrchRemove(),
+*               DNScCache_RefreshChk(),
 *               DNScCache_ResolveAll(),
 *               DNScCache_ResolveHost(),
 *               DNScCache_Srch().
@@ -1257,10 +1700,13 @@ exit:
 * Return(s)   : None.
 *
 * Caller(s)   : DNScCache_Clr(),
+*               DNScCache_EntryGet(),
+*               DNScCache_EntrySet(),
 *               DNScCache_HostInsert(),
 *               DNScCache_HostObjGet(),
 *               DNScCache_HostRemove(),
 *               DNScCache_HostSrchRemove(),
+*               DNScCache_RefreshChk(),
 *               DNScCache_ResolveAll(),
 *               DNScCache_ResolveHost(),
 *               DNScCache_Srch().
@@ -1289,7 +1735,8 @@ static  void  DNScCache_LockRelease (void)
 * Return(s)   : None.
 *
 * Caller(s)   : DNScCache_HostRemove(),
-*               DNScCache_HostSrchRemove().
+*               DNScCache_HostSrchRemove(),
+*               DNScCache_Srch().
 *
 * Note(s)     : None.
 *********************************************************************************************************
@@ -1356,7 +1803,9 @@ static  void  DNScCache_HostObjNameSet (DNSc_HOST_OBJ  *p_host,
 *
 *               DEF_NULL, Otherwise.
 *
-* Caller(s)   : DNScCache_HostSrchRemove(),
+* Caller(s)   : DNScCache_EntryGet(),
+*               DNScCache_EntrySet(),
+*               DNScCache_HostSrchRemove(),
 *               DNScCache_Srch().
 *
 * Note(s)     : None.
@@ -1562,7 +2011,8 @@ exit:
 * Return(s)   : None.
 *
 * Caller(s)   : DNScCache_Clr(),
-*               DNScCache_HostRemoveHandler().
+*               DNScCache_HostRemoveHandler(),
+*               DNScCache_RefreshChk().
 *
 * Note(s)     : None.
 *********************************************************************************************************
@@ -1610,6 +2060,8 @@ static  void  DNScCache_ItemRemove (DNSc_CACHE_ITEM  *p_cache)
                 p_cache_prev->NextPtr = p_cache_cur->NextPtr;
                 goto exit_found;
             }
+            p_cache_prev = p_cache_cur;
+            p_cache_cur  = p_cache_cur->NextPtr;
         }
     }
 
@@ -1734,7 +2186,8 @@ static  void  DNScCache_HostRelease (DNSc_HOST_OBJ  *p_host)
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScCache_HostObjFree(),
+* Caller(s)   : DNScCache_HostAddrInsert(),
+*               DNScCache_HostObjFree(),
 *               DNScCache_HostRelease(),
 *               DNScCache_ItemHostGet().
 *
@@ -1761,6 +2214,175 @@ static  void  DNScCache_HostAddrClr (DNSc_HOST_OBJ  *p_host)
 }
 
 
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostAgeGet()
+*
+* Description : Get the age of a host's cached addresses.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : Age of the host's cached addresses :
+*                       DNSc_CACHE_AGE_FRESH        Addresses within their TTL.
+*                       DNSc_CACHE_AGE_REFRESH      Addresses within their TTL but due for refresh.
+*                       DNSc_CACHE_AGE_STALE        Addresses past their TTL but within the stale period.
+*                       DNSc_CACHE_AGE_EXPIRED      Addresses past their TTL & the stale period.
+*
+* Caller(s)   : DNScCache_RefreshChk(),
+*               DNScCache_Srch().
+*
+* Note(s)     : (1) Addresses are ONLY due for refresh & stale if DNSc_CFG_CACHE_REFRESH_EN is enabled.
+*
+*               (2) A host's TTL is limited to DNSc_CACHE_TTL_MAX_SEC (see 'DNScReq_RxRespMsg()  Note #1')
+*                   so that its TTL in milliseconds does NOT overflow.
+*********************************************************************************************************
+*/
+
+static  DNSc_CACHE_AGE  DNScCache_HostAgeGet (DNSc_HOST_OBJ  *p_host)
+{
+    DNSc_CACHE_AGE  age;
+    NET_TS_MS       ts_cur_ms;
+    NET_TS_MS       age_ms;
+    NET_TS_MS       ttl_ms;
+
+
+    ts_cur_ms = NetUtil_TS_Get_ms();
+    age_ms    = ts_cur_ms - p_host->ResolvedTS_ms;
+    ttl_ms    = p_host->TTL_sec * DEF_TIME_NBR_mS_PER_SEC;      /* See Note #2.                                         */
+
+    if (age_ms < ttl_ms) {
+        age = DNSc_CACHE_AGE_FRESH;
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)                  /* See Note #1.                                         */
+        if (age_ms >= (ttl_ms - (ttl_ms / DNSc_CACHE_REFRESH_TTL_DIV))) {
+            age = DNSc_CACHE_AGE_REFRESH;
+        }
+#endif
+
+    } else {
+        age = DNSc_CACHE_AGE_EXPIRED;
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if ((age_ms - ttl_ms) < (DNSc_CFG_CACHE_STALE_MAX_SEC * DEF_TIME_NBR_mS_PER_SEC)) {
+            age = DNSc_CACHE_AGE_STALE;
+        }
+#endif
+    }
+
+    return (age);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostResolveEnd()
+*
+* Description : Update a host's cached addresses once its resolution is completed.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+*               status  Resolution status.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_Resolve().
+*
+* Note(s)     : (1) A resolution that returned NO address is cached for DNSc_CACHE_TTL_NO_ADDR_SEC at most.
+*
+*               (2) If a refresh fails or returns NO address, the host's cached addresses are kept & the
+*                   refresh is retried once DNSc_CACHE_REFRESH_RETRY_MS has elapsed.
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_HostResolveEnd (DNSc_HOST_OBJ  *p_host,
+                                        DNSc_STATUS     status)
+{
+    CPU_BOOLEAN  resolved = DEF_NO;
+
+
+    if (status == DNSc_STATUS_RESOLVED) {
+        resolved = DEF_YES;
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if (p_host->AddrsStale == DEF_YES) {                    /* If refresh rx'd NO addr, ...                         */
+            resolved = DEF_NO;                                  /* ... keep cached addrs (see Note #2).                 */
+        }
+#endif
+    }
+
+    if (resolved == DEF_YES) {
+        p_host->TTL_sec = p_host->ReqTTL_sec;
+        if ((p_host->AddrsCount == 0u) &&                       /* See Note #1.                                         */
+            (p_host->TTL_sec    >  DNSc_CACHE_TTL_NO_ADDR_SEC)) {
+            p_host->TTL_sec = DNSc_CACHE_TTL_NO_ADDR_SEC;
+        }
+        p_host->ResolvedTS_ms = NetUtil_TS_Get_ms();
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        p_host->Refresh       = DEF_NO;
+        p_host->RefreshDly    = DEF_NO;
+        p_host->Used          = DEF_NO;
+#endif
+
+    } else {
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        if (p_host->Refresh == DEF_YES) {                       /* See Note #2.                                         */
+            p_host->State        = DNSc_STATE_RESOLVED;
+            p_host->Refresh      = DEF_NO;
+            p_host->AddrsStale   = DEF_NO;
+            p_host->RefreshDly   = DEF_YES;
+            p_host->RefreshTS_ms = NetUtil_TS_Get_ms();
+        }
+#endif
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     DNScCache_HostRefreshStart()
+*
+* Description : Start the refresh of a host's cached addresses.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : DEF_YES, if refresh started.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNScCache_RefreshChk(),
+*               DNScCache_Srch().
+*
+* Note(s)     : (1) The host is resolved again by DNSc's task with the default request configuration, as
+*                   the configuration of the original request may no longer be valid.
+*
+*               (2) The host's cached addresses are kept until new ones are received (see
+*                   'DNScCache_HostAddrInsert()  Note #1').
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  DNScCache_HostRefreshStart (DNSc_HOST_OBJ  *p_host)
+{
+    NET_TS_MS  ts_cur_ms;
+    NET_TS_MS  ts_delta_ms;
+
+
+    if (p_host->RefreshDly == DEF_YES) {                        /* If last refresh failed, ...                          */
+        ts_cur_ms   = NetUtil_TS_Get_ms();
+        ts_delta_ms = ts_cur_ms - p_host->RefreshTS_ms;
+        if (ts_delta_ms < DNSc_CACHE_REFRESH_RETRY_MS) {        /* ... dly next one (see 'DNScCache_HostResolveEnd() .. */
+            return (DEF_NO);                                    /* ... Note #2').                                       */
+        }
+    }
+
+    p_host->ReqCfgPtr  = DEF_NULL;                              /* See Note #1.                                         */
+    p_host->IF_Nbr     = NET_IF_NBR_WILDCARD;
+    p_host->State      = DNSc_STATE_INIT_REQ;
+    p_host->Refresh    = DEF_YES;
+    p_host->AddrsStale = DEF_YES;                               /* See Note #2.                                         */
+
+    return (DEF_YES);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          DNScCache_Resolve()
@@ -1802,6 +2424,7 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                                                DNSc_ERR       *p_err)
 {
     DNSc_STATUS     status        = DNSc_STATUS_PENDING;
+    DNSc_STATE      state_prev    = p_host->State;
     DNSc_ADDR_OBJ  *p_server_addr = DEF_NULL;
     NET_PORT_NBR    server_port   = NET_PORT_NBR_NONE;
 
@@ -1819,9 +2442,10 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                  goto exit;
              }
 
-             p_host->ReqCtr = 0u;
-             p_host->State  = DNSc_STATE_IF_SEL;
-             status         = DNSc_STATUS_PENDING;
+             p_host->ReqCtr     = 0u;
+             p_host->ReqTTL_sec = DNSc_CACHE_TTL_MAX_SEC;
+             p_host->State      = DNSc_STATE_IF_SEL;
+             status             = DNSc_STATUS_PENDING;
              break;
 
 
@@ -1886,6 +2510,11 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
 
 
 exit:
+    if ((state_prev != DNSc_STATE_RESOLVED) &&                  /* If resolution completed, ...                         */
+        (status     != DNSc_STATUS_PENDING)) {
+        DNScCache_HostResolveEnd(p_host, status);               /* ... update cached addrs' age.                        */
+    }
+
     return (status);
 }
 
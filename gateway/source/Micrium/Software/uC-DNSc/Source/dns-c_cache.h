@@ -136,4 +136,15 @@ DNSc_STATUS     DNScCache_ResolveHost   (const  DNSc_CFG       *p_cfg,
 CPU_INT16U      DNScCache_ResolveAll    (const  DNSc_CFG       *p_cfg,
                                                 DNSc_ERR       *p_err);
 
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+CPU_INT16U      DNScCache_RefreshChk    (       DNSc_ERR          *p_err);
+#endif
+
+void            DNScCache_EntryGet      (       CPU_CHAR          *p_host_name,
+                                                DNSc_CACHE_ENTRY  *p_entry,
+                                                DNSc_ERR          *p_err);
+
+void            DNScCache_EntrySet      (       DNSc_CACHE_ENTRY  *p_entry,
+                                                DNSc_ERR          *p_err);
+
 #endif /* DNSc_CACHE_PRESENT */
@@ -101,6 +101,8 @@
 #define  DNSc_PKT_CLASS_SIZE                               2u
 #define  DNSc_PKT_TTL_SIZE                                 4u
 
+#define  DNSc_TTL_MAX                             0x7FFFFFFFu   /* See 'DNScReq_RxRespMsg()  Note #1b'.                 */
+
 #define  DNSc_HDR_MSG_LEN_MAX       (DNSc_PKT_MAX_SIZE - DNSc_PKT_HDR_SIZE)
 
 #define  DNSc_NAME_LEN_SIZE                                1u
@@ -1038,7 +1040,12 @@ exit:
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The host's addresses are cached for the lowest TTL of the answers :
+*
+*                   (a) Limited to DNSc_CACHE_TTL_MAX_SEC (see RFC #8767, Section 4).
+*
+*                   (b) A TTL with its most significant bit set is treated as zero (see RFC #2181,
+*                       Section 8).
 *********************************************************************************************************
 */
 
@@ -1056,6 +1063,7 @@ static  void  DNScReq_RxRespMsg (const  DNSc_CFG       *p_cfg,
     CPU_INT08U  *p_data;
     CPU_INT16U   answer_type;
     CPU_INT16U   data_16;
+    CPU_INT32U   ttl;
     CPU_INT08U   ix;
 
 
@@ -1151,9 +1159,19 @@ static  void  DNScReq_RxRespMsg (const  DNSc_CFG       *p_cfg,
         Mem_Copy(&answer_type, p_data, sizeof(CPU_INT16U));
         answer_type =  NET_UTIL_NET_TO_HOST_16(answer_type);    /* Get answer TYPE.                                     */
 
-        p_data += (DNSc_PKT_TYPE_SIZE  +                        /* Skip over the CLASS & the TTL.                       */
-                   DNSc_PKT_CLASS_SIZE +
-                   DNSc_PKT_TTL_SIZE);
+        p_data += (DNSc_PKT_TYPE_SIZE  +                        /* Skip over the TYPE & the CLASS.                      */
+                   DNSc_PKT_CLASS_SIZE);
+
+        Mem_Copy(&ttl, p_data, sizeof(CPU_INT32U));
+        ttl     =  NET_UTIL_NET_TO_HOST_32(ttl);                /* Get answer TTL (see Note #1).                        */
+        if (ttl > DNSc_TTL_MAX) {
+            ttl = 0u;
+        }
+        if (ttl < p_host->ReqTTL_sec) {                         /* Keep lowest TTL.                                     */
+            p_host->ReqTTL_sec = ttl;
+        }
+
+        p_data +=  DNSc_PKT_TTL_SIZE;                           /* Skip over the TTL.                                   */
 
 
         Mem_Copy(&data_16, p_data, sizeof(CPU_INT16U));
@@ -53,6 +53,23 @@
 #include  "KAL/kal.h"
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) If DNSc_CFG_CACHE_REFRESH_EN is enabled, DNSc's task wakes up at least every
+*               DNSc_TASK_REFRESH_CHK_PERIOD_MS to refresh cached hosts (see 'dns-c_cache.c
+*               DNScCache_RefreshChk()').
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+#define  DNSc_TASK_REFRESH_CHK_PERIOD_MS                1000u   /* See Note #1.                                         */
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -308,6 +325,36 @@ exit:
 }
 
 
+/*
+*********************************************************************************************************
+*                                         DNScTask_ReqSignal()
+*
+* Description : Signal DNSc's task that a host resolution was submitted from the cache.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_Srch().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  DNScTask_ReqSignal (void)
+{
+#ifdef  DNSc_TASK_MODULE_EN
+    KAL_ERR  err;
+
+
+    KAL_SemPost(DNScTask_SignalHandle, KAL_OPT_POST_NONE, &err);
+   (void)&err;
+#endif
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -328,7 +375,7 @@ exit:
 *
 * Caller(s)   : Referenced by DNScTask_Init().
 *
-* Note(s)     : None.
+* Note(s)     : (1) See 'DEFINES  Note #1'.
 *********************************************************************************************************
 */
 #ifdef  DNSc_TASK_MODULE_EN
@@ -337,19 +384,24 @@ static  void  DNScTask (void  *p_arg)
     const  DNSc_CFG    *p_cfg           = (const DNSc_CFG *)p_arg;
            CPU_INT16U   nb_req_active   =  0u;
            CPU_INT16U   nb_req_resolved =  0u;
+           CPU_INT32U   timeout_ms      =  0u;
            KAL_OPT      opt;
            KAL_ERR      kal_err;
            DNSc_ERR     dns_err;
 
 
 
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+    timeout_ms = DNSc_TASK_REFRESH_CHK_PERIOD_MS;               /* See Note #1.                                         */
+#endif
+
     while (DEF_ON) {
         opt = KAL_OPT_PEND_NONE;
         if (nb_req_active > 0u) {
             DEF_BIT_SET(opt, KAL_OPT_PEND_NON_BLOCKING);
         }
 
-        KAL_SemPend(DNScTask_SignalHandle, opt, 0, &kal_err);
+        KAL_SemPend(DNScTask_SignalHandle, opt, timeout_ms, &kal_err);
         switch (kal_err) {
             case KAL_ERR_NONE:
                  nb_req_active++;
@@ -359,6 +411,10 @@ static  void  DNScTask (void  *p_arg)
                  break;
         }
 
+#if (DNSc_CFG_CACHE_REFRESH_EN == DEF_ENABLED)
+        nb_req_active += DNScCache_RefreshChk(&dns_err);
+#endif
+
         nb_req_resolved = DNScCache_ResolveAll(p_cfg, &dns_err);
         if (nb_req_resolved < nb_req_active) {
             nb_req_active  -= nb_req_resolved;
@@ -79,4 +79,6 @@ DNSc_STATUS  DNScTask_HostResolve(       DNSc_HOST_OBJ  *p_host,
                                          DNSc_REQ_CFG   *p_cfg,
                                          DNSc_ERR       *p_err);
 
+void         DNScTask_ReqSignal  (       void);
+
 #endif  /* DNSc_KAL_PRESENT */
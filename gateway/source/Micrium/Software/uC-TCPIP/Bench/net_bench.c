@@ -0,0 +1,1737 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                    NETWORK PROTOCOL SUITE BENCHMARK
+*
+* Filename : net_bench.c
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host (Linux) benchmark of uC/TCP-IP on uC/OS-III (POSIX port).  It measures the stack
+*                without the target board or a Wi-Fi network, so that performance regressions show up
+*                in a local run.
+*
+*            (2) Every workload runs over two interfaces :
+*
+*                    lo          The loopback interface (client connects to 127.0.0.1).
+*                    pipe        An Ethernet interface on the impaired reflecting pipe device (client
+*                                connects to the pipe's peer; see 'net_bench_pipe.h  Note #2').
+*
+*            (3) Workloads (a client task & a server task, TCP but for udp) :
+*
+*                    bulk        Send a large stream to a sink, which reads it until the client closes.
+*                    rr          Send a small request on one connection & wait for its echo, repeatedly.
+*                    conn        Open a connection, exchange one request & its echo, close, repeatedly.
+*                    udp         Send a datagram by reference to a UDP sink & wait for it, repeatedly
+*                                (see 'NetBench_UDP()  Note #1').
+*
+*            (4) For every workload the benchmark reports, as one JSON document on stdout :
+*
+*                (a) Throughput (bulk : application octets delivered to the sink per second) & ops/s.
+*
+*                (b) Latency percentiles of each op : a transmit call (bulk), a request/echo round trip
+*                    (rr), a whole connection (conn) or a datagram's delivery (udp).
+*
+*                (c) TCP segments transmitted & retransmitted, from the stack's statistics counters.
+*
+*                (d) Process CPU time per application octet.  It includes the host's emulation of the
+*                    kernel & of the pipe device, so it is only meaningful compared with another run.
+*
+*                (e) Pipe device counters (pipe only) : frames lost, held back & dropped on receive, &
+*                    frames gathered with external data.
+*
+*            (5) Usage : net_bench [-q] [-s <seed>] [-l <loss ppm>] [-d <dly ms>] [-j <jitter ms>]
+*                                  [-r <reorder ppm>] [-i lo,pipe]
+*
+*                    -q    quick run (a quarter of the default sizes).
+*                    -l    probability (ppm) for a frame on the pipe to be lost (default 0).
+*                    -d    one-way delay of the pipe (default 0).
+*                    -j    max random delay added to that (default 0).
+*                    -r    probability (ppm) for a frame on the pipe to be held back (default 0).
+*                    -i    interfaces to run on (default both).
+*
+*                The kernel port runs tasks as real-time threads : run as root or after
+*                'ulimit -r unlimited' (see 'Makefile').
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+
+#include  <cpu_core.h>
+#include  <lib_mem.h>
+#include  <lib_math.h>
+#include  <os.h>
+#include  <KAL/kal.h>
+#include  <Source/net.h>
+#include  <Source/net_ascii.h>
+#include  <Source/net_ctr.h>
+#include  <Source/net_sock.h>
+#include  <Source/net_udp.h>
+#include  <Source/net_util.h>
+#include  <IF/net_if.h>
+#include  <IF/net_if_ether.h>
+#include  <IF/net_if_loopback.h>
+#include  <IP/IPv4/net_ipv4.h>
+#include  "net_bench_pipe.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+                                                                /* ----------------------- TASKS ---------------------- */
+#define  NET_BENCH_PIPE_TASK_PRIO                          4u   /* Wire must not lag the stack.                         */
+#define  NET_BENCH_NET_TX_DEALLOC_TASK_PRIO                6u
+#define  NET_BENCH_START_TASK_PRIO                        10u   /* Client.                                              */
+#define  NET_BENCH_SRV_TASK_PRIO                          11u
+#define  NET_BENCH_NET_TMR_TASK_PRIO                      18u
+#define  NET_BENCH_NET_RX_TASK_PRIO                       20u
+
+#define  NET_BENCH_START_TASK_STK_SIZE                  2048u   /* In CPU_STK elements.                                 */
+#define  NET_BENCH_SRV_TASK_STK_SIZE                    8192u   /* In octets.                                           */
+#define  NET_BENCH_NET_TASK_STK_SIZE                    4096u   /* In octets.                                           */
+
+                                                                /* ----------------------- ADDRS ---------------------- */
+#define  NET_BENCH_PIPE_ADDR_HW_STR             "02:00:00:00:00:01"
+#define  NET_BENCH_PIPE_ADDR_STR                "10.0.0.1"
+#define  NET_BENCH_PIPE_PEER_ADDR_STR           "10.0.0.2"      /* Any addr on the pipe's subnet but its own.           */
+#define  NET_BENCH_PIPE_MASK_STR                "255.255.255.0"
+#define  NET_BENCH_LO_ADDR_STR                  "127.0.0.1"
+
+#define  NET_BENCH_PORT_SINK                            5001u
+#define  NET_BENCH_PORT_ECHO                            5002u
+#define  NET_BENCH_PORT_UDP_SRC                         5003u
+#define  NET_BENCH_PORT_UDP_SINK                        5004u
+
+                                                                /* --------------------- WORKLOADS -------------------- */
+#define  NET_BENCH_BULK_SIZE                   (4u * 1024u * 1024u)
+#define  NET_BENCH_BULK_CHUNK_SIZE                      4096u   /* Size of each tx call.                                */
+#define  NET_BENCH_RR_CNT                               2000u
+#define  NET_BENCH_CONN_CNT                              200u
+#define  NET_BENCH_MSG_SIZE                               64u   /* Size of each request & echo.                         */
+#define  NET_BENCH_UDP_CNT                              2000u
+#define  NET_BENCH_UDP_MSG_SIZE                          512u   /* Referenced, not copied (see 'NetBench_UDP()  Note #1').*/
+#define  NET_BENCH_UDP_LOST_MS                           100u   /* Wait past the pipe's delay before a datagram is lost.*/
+#define  NET_BENCH_QUICK_DIV                               4u
+
+#define  NET_BENCH_TIMEOUT_MS                           5000u   /* Max wait for a peer; stops a workload on heavy loss. */
+#define  NET_BENCH_SINK_TIMEOUT_MS                     60000u
+#define  NET_BENCH_LINK_RETRY_MAX                         20u
+#define  NET_BENCH_LINK_DLY_MS                           100u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  net_bench_run {
+    const  CPU_CHAR      *IF_Name;
+    const  CPU_CHAR      *Workload;
+    double               *LatTbl;                               /* Latency per op (us).                                 */
+    CPU_INT32U            OpCnt;
+    CPU_INT32U            OpCntMax;
+    CPU_INT64U            Octets;                               /* App octets delivered.                                */
+    NET_ERR               Err;                                  /* Err that stopped the workload, if any.               */
+    struct  timespec      Start;
+    struct  timespec      End;                                  /* Set by the workload, if not at NetBench_RunEnd().    */
+    struct  timespec      CPU_Start;
+    struct  timespec      OpStart;
+    NET_CTR               TxSegStart;
+    NET_CTR               ReTxSegStart;
+    NET_BENCH_PIPE_STAT   PipeStart;
+} NET_BENCH_RUN;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+                                                                /* ------------------ NET TASK CFGS ------------------- */
+static  const  NET_TASK_CFG  NetBench_RxTaskCfg = {
+    NET_BENCH_NET_RX_TASK_PRIO,
+    NET_BENCH_NET_TASK_STK_SIZE,
+    DEF_NULL
+};
+
+static  const  NET_TASK_CFG  NetBench_TxDeallocTaskCfg = {
+    NET_BENCH_NET_TX_DEALLOC_TASK_PRIO,
+    NET_BENCH_NET_TASK_STK_SIZE,
+    DEF_NULL
+};
+
+static  const  NET_TASK_CFG  NetBench_TmrTaskCfg = {
+    NET_BENCH_NET_TMR_TASK_PRIO,
+    NET_BENCH_NET_TASK_STK_SIZE,
+    DEF_NULL
+};
+
+                                                                /* ------------------- NET DEV CFGS ------------------- */
+const  NET_IF_CFG_LOOPBACK  NetIF_Cfg_Loopback = {              /* Added by Net_Init().                                 */
+    NET_IF_MEM_TYPE_MAIN,                                       /* Rx buf pool type.                                    */
+    1500u,                                                      /* Rx buf large size.                                   */
+      10u,                                                      /* Rx buf large nbr.                                    */
+       4u,                                                      /* Rx buf align octets.                                 */
+       0u,                                                      /* Rx buf ix offset.                                    */
+
+    NET_IF_MEM_TYPE_MAIN,                                       /* Tx buf pool type.                                    */
+    1500u,                                                      /* Tx buf large size.                                   */
+      10u,                                                      /* Tx buf large nbr.                                    */
+      60u,                                                      /* Tx buf small size.                                   */
+      10u,                                                      /* Tx buf small nbr.                                    */
+       4u,                                                      /* Tx buf align octets.                                 */
+       0u,                                                      /* Tx buf ix offset.                                    */
+
+    0u,                                                         /* Mem addr.                                            */
+    0u,                                                         /* Mem size.                                            */
+
+    NET_DEV_CFG_FLAG_NONE                                       /* Flags.                                               */
+};
+
+static  const  NET_DEV_CFG_ETHER  NetBench_PipeCfg = {           /* Buffers as for the target's Ethernet device.         */
+    NET_IF_MEM_TYPE_MAIN,                                       /* Rx buf pool type.                                    */
+    1518u,                                                      /* Rx buf large size.                                   */
+      10u,                                                      /* Rx buf large nbr.                                    */
+       4u,                                                      /* Rx buf align octets.                                 */
+       0u,                                                      /* Rx buf ix offset.                                    */
+
+    NET_IF_MEM_TYPE_MAIN,                                       /* Tx buf pool type.                                    */
+    1518u,                                                      /* Tx buf large size.                                   */
+       5u,                                                      /* Tx buf large nbr.                                    */
+      60u,                                                      /* Tx buf small size.                                   */
+       5u,                                                      /* Tx buf small nbr.                                    */
+       4u,                                                      /* Tx buf align octets.                                 */
+       0u,                                                      /* Tx buf ix offset.                                    */
+
+    0u,                                                         /* Mem addr.                                            */
+    0u,                                                         /* Mem size.                                            */
+
+    NET_DEV_CFG_FLAG_NONE,                                      /* Flags.                                               */
+
+    8u,                                                         /* Rx desc nbr (pipe rx Q size).                        */
+    5u,                                                         /* Tx desc nbr.                                         */
+
+    0u,                                                         /* Base addr.                                           */
+    0u,                                                         /* Data bus size.                                       */
+
+    NET_BENCH_PIPE_ADDR_HW_STR                                  /* HW addr.                                             */
+};
+
+                                                                /* ---------------------- KERNEL ---------------------- */
+static  OS_TCB              NetBench_StartTaskTCB;
+static  CPU_STK             NetBench_StartTaskStk[NET_BENCH_START_TASK_STK_SIZE];
+
+                                                                /* ---------------------- SERVERS --------------------- */
+static  KAL_SEM_HANDLE      NetBench_SinkDone;                  /* Posted when the sink has read a whole stream.        */
+static  CPU_INT64U          NetBench_SinkOctets;
+static  struct  timespec    NetBench_SinkEnd;
+static  NET_ERR             NetBench_SinkErr;
+
+static  KAL_SEM_HANDLE      NetBench_UDP_Rxd;                   /* Posted when the UDP sink has read a datagram.        */
+static  KAL_SEM_HANDLE      NetBench_UDP_Freed;                 /* Posted when a datagram's data is returned.           */
+static  volatile  CPU_INT32U   NetBench_UDP_RxSeq;              /* Seq of the last intact datagram read.                */
+static  volatile  CPU_INT32U   NetBench_UDP_RxBadCtr;           /* Nbr of datagrams read w/ bad len or data.            */
+static  volatile  CPU_INT32U   NetBench_UDP_TxSeq;              /* Seq of the datagram referencing the buf.             */
+static  volatile  CPU_BOOLEAN  NetBench_UDP_TxBufUsed;          /* Buf referenced by the stack.                         */
+static  volatile  CPU_INT32U   NetBench_UDP_FreeCtr;
+static  volatile  CPU_INT32U   NetBench_UDP_FreeErrCtr;         /* Nbr of unexpected returns of the buf.                */
+static  CPU_INT08U          NetBench_UDP_TxBuf[NET_BENCH_UDP_MSG_SIZE];
+
+                                                                /* ----------------------- ARGS ----------------------- */
+static  CPU_BOOLEAN         NetBench_Quick      = DEF_NO;
+static  CPU_BOOLEAN         NetBench_LoEn       = DEF_YES;
+static  CPU_BOOLEAN         NetBench_PipeEn     = DEF_YES;
+static  NET_BENCH_PIPE_CFG  NetBench_PipeImpCfg = { 0u, 0u, 0u, 0u, 1u, NET_BENCH_PIPE_TASK_PRIO };
+
+static  CPU_BOOLEAN         NetBench_First      = DEF_YES;
+static  int                 NetBench_Rtn        = 0;
+static  CPU_INT08U          NetBench_Buf[NET_BENCH_BULK_CHUNK_SIZE];
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void         NetBench_StartTask  (void             *p_arg);
+
+static  CPU_BOOLEAN  NetBench_NetInit    (void);
+
+static  void         NetBench_SrvStart   (CPU_INT16U        port,
+                                          void            (*p_fnct)(void  *p_arg),
+                                          NET_ERR          *p_err);
+
+static  void         NetBench_SinkTask   (void             *p_arg);
+
+static  void         NetBench_EchoTask   (void             *p_arg);
+
+static  void         NetBench_UDP_SinkStart(NET_ERR        *p_err);
+
+static  void         NetBench_UDP_SinkTask (void           *p_arg);
+
+static  void         NetBench_UDP_Free   (void             *p_data,
+                                          void             *p_arg);
+
+static  void         NetBench_UDP_Fill   (CPU_INT08U       *p_buf,
+                                          CPU_INT32U        seq);
+
+static  CPU_INT32U   NetBench_Scale      (CPU_INT32U        val);
+
+static  NET_SOCK_ID  NetBench_Conn       (NET_IPv4_ADDR     addr,
+                                          CPU_INT16U        port,
+                                          NET_ERR          *p_err);
+
+static  CPU_BOOLEAN  NetBench_Xchg       (NET_SOCK_ID       sock_id,
+                                          NET_ERR          *p_err);
+
+static  void         NetBench_RunStart   (NET_BENCH_RUN    *p_run,
+                                          const  CPU_CHAR  *p_if_name,
+                                          const  CPU_CHAR  *p_workload,
+                                          CPU_INT32U        op_cnt_max);
+
+static  void         NetBench_OpStart    (NET_BENCH_RUN    *p_run);
+
+static  void         NetBench_OpEnd      (NET_BENCH_RUN    *p_run);
+
+static  void         NetBench_RunEnd     (NET_BENCH_RUN    *p_run);
+
+static  void         NetBench_LatPrint   (const  CPU_CHAR  *p_name,
+                                          double           *p_tbl,
+                                          CPU_INT32U        cnt);
+
+static  void         NetBench_Bulk       (const  CPU_CHAR  *p_if_name,
+                                          NET_IPv4_ADDR     addr);
+
+static  void         NetBench_RR         (const  CPU_CHAR  *p_if_name,
+                                          NET_IPv4_ADDR     addr);
+
+static  void         NetBench_ConnRR     (const  CPU_CHAR  *p_if_name,
+                                          NET_IPv4_ADDR     addr);
+
+static  void         NetBench_UDP        (const  CPU_CHAR  *p_if_name,
+                                          NET_IPv4_ADDR     addr_src,
+                                          NET_IPv4_ADDR     addr);
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Parse arguments & start the kernel; the workloads run from the start task.
+*
+* Argument(s) : argc        Number of arguments.
+*
+*               argv        Arguments (see 'net_bench.c  Note #5').
+*
+* Return(s)   : 2, on usage error.
+*
+*               1, if the kernel could not be started.
+*
+*               Otherwise, does NOT return; the start task exits the process (see 'NetBench_StartTask()').
+*
+* Caller(s)   : Host C runtime.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    int     arg_ix;
+    OS_ERR  err_os;
+
+
+    for (arg_ix = 1; arg_ix < argc; arg_ix++) {
+        if (strcmp(argv[arg_ix], "-q") == 0) {
+            NetBench_Quick = DEF_YES;
+        } else if ((strcmp(argv[arg_ix], "-s") == 0) && (arg_ix + 1 < argc)) {
+            NetBench_PipeImpCfg.Seed = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-l") == 0) && (arg_ix + 1 < argc)) {
+            NetBench_PipeImpCfg.LossPPM = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-d") == 0) && (arg_ix + 1 < argc)) {
+            NetBench_PipeImpCfg.Dly_ms = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-j") == 0) && (arg_ix + 1 < argc)) {
+            NetBench_PipeImpCfg.Jitter_ms = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-r") == 0) && (arg_ix + 1 < argc)) {
+            NetBench_PipeImpCfg.ReorderPPM = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-i") == 0) && (arg_ix + 1 < argc)) {
+            arg_ix++;
+            NetBench_LoEn   = (strstr(argv[arg_ix], "lo")   != DEF_NULL) ? DEF_YES : DEF_NO;
+            NetBench_PipeEn = (strstr(argv[arg_ix], "pipe") != DEF_NULL) ? DEF_YES : DEF_NO;
+        } else {
+            fprintf(stderr, "usage: %s [-q] [-s <seed>] [-l <loss ppm>] [-d <dly ms>] [-j <jitter ms>]"
+                            " [-r <reorder ppm>] [-i lo,pipe]\n", argv[0]);
+            return (2);
+        }
+    }
+
+    if (NetBench_PipeImpCfg.Seed == 0u) {
+        NetBench_PipeImpCfg.Seed = 1u;
+    }
+
+                                                                /* ---------------------- KERNEL ---------------------- */
+    OSInit(&err_os);
+    if (err_os != OS_ERR_NONE) {
+        fprintf(stderr, "net_bench: OSInit() failed w/err = %d\n", (int)err_os);
+        return (1);
+    }
+
+    OSTaskCreate(&NetBench_StartTaskTCB,
+                 "Bench Start",
+                  NetBench_StartTask,
+                  DEF_NULL,
+                  NET_BENCH_START_TASK_PRIO,
+                 &NetBench_StartTaskStk[0],
+                  NET_BENCH_START_TASK_STK_SIZE / 10u,
+                  NET_BENCH_START_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  DEF_NULL,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err_os);
+    if (err_os != OS_ERR_NONE) {
+        fprintf(stderr, "net_bench: OSTaskCreate() failed w/err = %d\n", (int)err_os);
+        return (1);
+    }
+
+    OSStart(&err_os);                                           /* Does not return on success.                          */
+
+    fprintf(stderr, "net_bench: OSStart() failed w/err = %d\n", (int)err_os);
+    return (1);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        NetBench_StartTask()
+*
+* Description : Initialize the stack, start the servers & run every workload on every enabled interface.
+*
+* Argument(s) : p_arg       Unused.
+*
+* Return(s)   : none.
+*
+* Created by  : main().
+*
+* Note(s)     : (1) The port's main thread waits for a signal once the kernel is started, so the process
+*                   is exited from here, with main()'s return code.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_StartTask (void  *p_arg)
+{
+    NET_IPv4_ADDR  addr;
+    NET_IPv4_ADDR  addr_src;
+    CPU_BOOLEAN    ok;
+    NET_ERR        err;
+
+
+   (void)p_arg;
+
+    CPU_Init();
+    Mem_Init();
+    Math_Init();
+    OS_CPU_SysTickInit();
+
+                                                                /* ----------------------- INIT ----------------------- */
+    ok = NetBench_NetInit();
+    if (ok != DEF_OK) {
+        exit(1);                                                /* See Note #1.                                         */
+    }
+
+                                                                /* ----------------------- RUN ------------------------ */
+    printf("{\n  \"bench\": \"uc-tcpip\",\n  \"quick\": %s,\n  \"seed\": %u,\n  \"loss_ppm\": %u,\n"
+           "  \"dly_ms\": %u,\n  \"jitter_ms\": %u,\n  \"reorder_ppm\": %u,\n  \"results\": [",
+           (NetBench_Quick == DEF_YES) ? "true" : "false",
+           (unsigned)NetBench_PipeImpCfg.Seed,
+           (unsigned)NetBench_PipeImpCfg.LossPPM,
+           (unsigned)NetBench_PipeImpCfg.Dly_ms,
+           (unsigned)NetBench_PipeImpCfg.Jitter_ms,
+           (unsigned)NetBench_PipeImpCfg.ReorderPPM);
+
+    if (NetBench_LoEn == DEF_YES) {
+        addr = NetASCII_Str_to_IPv4(NET_BENCH_LO_ADDR_STR, &err);
+        NetBench_Bulk  ("lo", addr);
+        NetBench_RR    ("lo", addr);
+        NetBench_ConnRR("lo", addr);
+        NetBench_UDP   ("lo", addr, addr);
+    }
+
+    if (NetBench_PipeEn == DEF_YES) {
+        addr     = NetASCII_Str_to_IPv4(NET_BENCH_PIPE_PEER_ADDR_STR, &err);
+        addr_src = NetASCII_Str_to_IPv4(NET_BENCH_PIPE_ADDR_STR,      &err);
+        NetBench_Bulk  ("pipe", addr);
+        NetBench_RR    ("pipe", addr);
+        NetBench_ConnRR("pipe", addr);
+        NetBench_UDP   ("pipe", addr_src, addr);
+    }
+
+    printf("\n  ]\n}\n");
+    fflush(stdout);
+
+    exit(NetBench_Rtn);                                         /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_NetInit()
+*
+* Description : (1) Initialize the network :
+*
+*                   (a) Initialize the stack (which adds the loopback interface)
+*                   (b) Add & start the pipe interface, if enabled
+*                   (c) Start the sink, echo & UDP sink servers
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the network is ready.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetBench_StartTask().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetBench_NetInit (void)
+{
+    NET_IF_NBR     if_nbr;
+    NET_IPv4_ADDR  addr;
+    NET_IPv4_ADDR  mask;
+    NET_ERR        err;
+    KAL_ERR        err_kal;
+
+
+    err = Net_Init(&NetBench_RxTaskCfg,
+                   &NetBench_TxDeallocTaskCfg,
+                   &NetBench_TmrTaskCfg);
+    if (err != NET_ERR_NONE) {
+        fprintf(stderr, "net_bench: Net_Init() failed w/err = %d\n", (int)err);
+        return (DEF_FAIL);
+    }
+
+    if (NetBench_PipeEn == DEF_YES) {
+        NetBenchPipe_CfgSet(&NetBench_PipeImpCfg);
+        if_nbr = NetIF_Add((void *)&NetIF_API_Ether,
+                           (void *)&NetDev_API_BenchPipe,
+                                    DEF_NULL,
+                           (void *)&NetBench_PipeCfg,
+                                    DEF_NULL,
+                                    DEF_NULL,
+                                   &err);
+        if (err != NET_IF_ERR_NONE) {
+            fprintf(stderr, "net_bench: NetIF_Add() failed w/err = %d\n", (int)err);
+            return (DEF_FAIL);
+        }
+
+        NetIF_Start(if_nbr, &err);
+        if (err != NET_IF_ERR_NONE) {
+            fprintf(stderr, "net_bench: NetIF_Start() failed w/err = %d\n", (int)err);
+            return (DEF_FAIL);
+        }
+
+        addr = NetASCII_Str_to_IPv4(NET_BENCH_PIPE_ADDR_STR, &err);
+        mask = NetASCII_Str_to_IPv4(NET_BENCH_PIPE_MASK_STR, &err);
+       (void)NetIPv4_CfgAddrAdd(if_nbr, addr, mask, NET_IPv4_ADDR_NONE, &err);
+        if (err != NET_IPv4_ERR_NONE) {
+            fprintf(stderr, "net_bench: NetIPv4_CfgAddrAdd() failed w/err = %d\n", (int)err);
+            return (DEF_FAIL);
+        }
+
+       (void)NetIF_LinkStateWaitUntilUp(if_nbr, NET_BENCH_LINK_RETRY_MAX, NET_BENCH_LINK_DLY_MS, &err);
+        if (err != NET_IF_ERR_NONE) {
+            fprintf(stderr, "net_bench: pipe link not up w/err = %d\n", (int)err);
+            return (DEF_FAIL);
+        }
+    }
+
+    NetBench_SinkDone = KAL_SemCreate("Bench Sink Done", DEF_NULL, &err_kal);
+    if (err_kal == KAL_ERR_NONE) {
+        NetBench_UDP_Rxd = KAL_SemCreate("Bench UDP Rxd", DEF_NULL, &err_kal);
+    }
+    if (err_kal == KAL_ERR_NONE) {
+        NetBench_UDP_Freed = KAL_SemCreate("Bench UDP Freed", DEF_NULL, &err_kal);
+    }
+    if (err_kal != KAL_ERR_NONE) {
+        fprintf(stderr, "net_bench: could not create sink signal\n");
+        return (DEF_FAIL);
+    }
+
+    NetBench_SrvStart(NET_BENCH_PORT_SINK, NetBench_SinkTask, &err);
+    if (err == NET_SOCK_ERR_NONE) {
+        NetBench_SrvStart(NET_BENCH_PORT_ECHO, NetBench_EchoTask, &err);
+    }
+    if (err == NET_SOCK_ERR_NONE) {
+        NetBench_UDP_SinkStart(&err);
+    }
+    if (err != NET_SOCK_ERR_NONE) {
+        fprintf(stderr, "net_bench: could not start servers w/err = %d\n", (int)err);
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_SrvStart()
+*
+* Description : Open a listening socket on any address & start a server task to accept on it.
+*
+* Argument(s) : port        Port to listen on.
+*
+*               p_fnct      Server task, passed the listening socket's ID.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Server started.
+*                               NET_ERR_FAULT_MEM_ALLOC         Server task NOT created.
+*
+*                                                               - RETURNED BY NetSock_Open()/Bind()/Listen() : -
+*                               See their error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_NetInit().
+*
+* Note(s)     : (1) Listening on any address serves both the loopback & the pipe interface.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_SrvStart (CPU_INT16U    port,
+                                 void        (*p_fnct)(void  *p_arg),
+                                 NET_ERR      *p_err)
+{
+    NET_SOCK_ADDR_IPv4  addr;
+    NET_SOCK_ID         sock_id;
+    KAL_TASK_HANDLE     task_handle;
+    KAL_ERR             err_kal;
+
+
+    sock_id = NetSock_Open(NET_SOCK_PROTOCOL_FAMILY_IP_V4,
+                           NET_SOCK_TYPE_STREAM,
+                           NET_SOCK_PROTOCOL_TCP,
+                           p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        return;
+    }
+
+    Mem_Clr(&addr, sizeof(addr));
+    addr.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+    addr.Port       = NET_UTIL_HOST_TO_NET_16(port);
+    addr.Addr       = NET_UTIL_HOST_TO_NET_32(NET_SOCK_ADDR_IP_V4_WILDCARD);  /* See Note #1.                       */
+
+   (void)NetSock_Bind(sock_id, (NET_SOCK_ADDR *)&addr, sizeof(addr), p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        return;
+    }
+
+   (void)NetSock_Listen(sock_id, NET_SOCK_CFG_CONN_ACCEPT_Q_SIZE_MAX, p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        return;
+    }
+
+    task_handle = KAL_TaskAlloc("Bench Srv", DEF_NULL, NET_BENCH_SRV_TASK_STK_SIZE, DEF_NULL, &err_kal);
+    if (err_kal == KAL_ERR_NONE) {
+        KAL_TaskCreate(task_handle, p_fnct, (void *)(CPU_ADDR)sock_id, NET_BENCH_SRV_TASK_PRIO, DEF_NULL, &err_kal);
+    }
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_ERR_FAULT_MEM_ALLOC;
+        return;
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_SinkTask()
+*
+* Description : Accept one connection at a time & read it until the client closes it; report the octets
+*                   read & the time the last of them arrived.
+*
+* Argument(s) : p_arg       Listening socket's ID.
+*
+* Return(s)   : none.
+*
+* Created by  : NetBench_SrvStart().
+*
+* Note(s)     : (1) A stream that stops for NET_BENCH_TIMEOUT_MS is reported with the error that ended it.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_SinkTask (void  *p_arg)
+{
+    static  CPU_INT08U   buf[NET_BENCH_BULK_CHUNK_SIZE];
+    NET_SOCK_ID          sock_id_listen;
+    NET_SOCK_ID          sock_id;
+    NET_SOCK_ADDR_IPv4   addr;
+    NET_SOCK_ADDR_LEN    addr_len;
+    NET_SOCK_RTN_CODE    rtn;
+    CPU_INT64U           octets;
+    NET_ERR              err;
+    KAL_ERR              err_kal;
+
+
+    sock_id_listen = (NET_SOCK_ID)(CPU_ADDR)p_arg;
+
+    while (DEF_ON) {
+        addr_len = sizeof(addr);
+        sock_id  = NetSock_Accept(sock_id_listen, (NET_SOCK_ADDR *)&addr, &addr_len, &err);
+        if (err != NET_SOCK_ERR_NONE) {
+            continue;
+        }
+
+       (void)NetSock_CfgTimeoutRxQ_Set(sock_id, NET_BENCH_TIMEOUT_MS, &err);
+
+        octets = 0u;
+        do {
+            rtn = NetSock_RxData(sock_id, buf, sizeof(buf), NET_SOCK_FLAG_NONE, &err);
+            if (rtn > 0) {
+                octets += (CPU_INT64U)rtn;
+                clock_gettime(CLOCK_MONOTONIC, &NetBench_SinkEnd);
+            }
+        } while (rtn > 0);
+
+        NetBench_SinkOctets = octets;
+        NetBench_SinkErr    = NET_SOCK_ERR_NONE;
+        if ((rtn != NET_SOCK_BSD_RTN_CODE_CONN_CLOSED) &&       /* See Note #1.                                         */
+            (err != NET_SOCK_ERR_CLOSED)) {
+            NetBench_SinkErr = err;
+        }
+
+       (void)NetSock_Close(sock_id, &err);
+
+        KAL_SemPost(NetBench_SinkDone, KAL_OPT_POST_NONE, &err_kal);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_EchoTask()
+*
+* Description : Accept one connection at a time & echo everything read on it until the client closes it.
+*
+* Argument(s) : p_arg       Listening socket's ID.
+*
+* Return(s)   : none.
+*
+* Created by  : NetBench_SrvStart().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_EchoTask (void  *p_arg)
+{
+    static  CPU_INT08U   buf[NET_BENCH_MSG_SIZE];
+    NET_SOCK_ID          sock_id_listen;
+    NET_SOCK_ID          sock_id;
+    NET_SOCK_ADDR_IPv4   addr;
+    NET_SOCK_ADDR_LEN    addr_len;
+    NET_SOCK_RTN_CODE    rtn;
+    NET_SOCK_RTN_CODE    tx_len;
+    NET_SOCK_RTN_CODE    tx_rtn;
+    NET_ERR              err;
+
+
+    sock_id_listen = (NET_SOCK_ID)(CPU_ADDR)p_arg;
+
+    while (DEF_ON) {
+        addr_len = sizeof(addr);
+        sock_id  = NetSock_Accept(sock_id_listen, (NET_SOCK_ADDR *)&addr, &addr_len, &err);
+        if (err != NET_SOCK_ERR_NONE) {
+            continue;
+        }
+
+       (void)NetSock_CfgTimeoutRxQ_Set(sock_id, NET_BENCH_TIMEOUT_MS, &err);
+
+        do {
+            rtn    = NetSock_RxData(sock_id, buf, sizeof(buf), NET_SOCK_FLAG_NONE, &err);
+            tx_len = 0;
+            while (tx_len < rtn) {
+                tx_rtn = NetSock_TxData(sock_id, &buf[tx_len], (CPU_INT16U)(rtn - tx_len), NET_SOCK_FLAG_NONE, &err);
+                if (tx_rtn <= 0) {
+                    rtn = tx_rtn;
+                    break;
+                }
+                tx_len += tx_rtn;
+            }
+        } while (rtn > 0);
+
+       (void)NetSock_Close(sock_id, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetBench_UDP_SinkStart()
+*
+* Description : Open a datagram socket on any address & start the UDP sink task to read it.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               UDP sink started.
+*                               NET_ERR_FAULT_MEM_ALLOC         UDP sink task NOT created.
+*
+*                                                               ---- RETURNED BY NetSock_Open()/Bind() : ----
+*                               See their error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_NetInit().
+*
+* Note(s)     : (1) See 'NetBench_SrvStart()  Note #1'.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_UDP_SinkStart (NET_ERR  *p_err)
+{
+    NET_SOCK_ADDR_IPv4  addr;
+    NET_SOCK_ID         sock_id;
+    KAL_TASK_HANDLE     task_handle;
+    KAL_ERR             err_kal;
+
+
+    sock_id = NetSock_Open(NET_SOCK_PROTOCOL_FAMILY_IP_V4,
+                           NET_SOCK_TYPE_DATAGRAM,
+                           NET_SOCK_PROTOCOL_UDP,
+                           p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        return;
+    }
+
+    Mem_Clr(&addr, sizeof(addr));
+    addr.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+    addr.Port       = NET_UTIL_HOST_TO_NET_16(NET_BENCH_PORT_UDP_SINK);
+    addr.Addr       = NET_UTIL_HOST_TO_NET_32(NET_SOCK_ADDR_IP_V4_WILDCARD);  /* See Note #1.                       */
+
+   (void)NetSock_Bind(sock_id, (NET_SOCK_ADDR *)&addr, sizeof(addr), p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        return;
+    }
+
+    task_handle = KAL_TaskAlloc("Bench UDP Sink", DEF_NULL, NET_BENCH_SRV_TASK_STK_SIZE, DEF_NULL, &err_kal);
+    if (err_kal == KAL_ERR_NONE) {
+        KAL_TaskCreate(task_handle, NetBench_UDP_SinkTask, (void *)(CPU_ADDR)sock_id, NET_BENCH_SRV_TASK_PRIO, DEF_NULL, &err_kal);
+    }
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_ERR_FAULT_MEM_ALLOC;
+        return;
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetBench_UDP_SinkTask()
+*
+* Description : Read datagrams & check each one's length & data; report the sequence number of every
+*                   intact datagram.
+*
+* Argument(s) : p_arg       Datagram socket's ID.
+*
+* Return(s)   : none.
+*
+* Created by  : NetBench_UDP_SinkStart().
+*
+* Note(s)     : (1) The buffer is one octet larger than a datagram so that a longer datagram is NOT
+*                   truncated to a valid one.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_UDP_SinkTask (void  *p_arg)
+{
+    static  CPU_INT08U   buf[NET_BENCH_UDP_MSG_SIZE + 1u];      /* See Note #1.                                         */
+    static  CPU_INT08U   buf_exp[NET_BENCH_UDP_MSG_SIZE];
+    NET_SOCK_ID          sock_id;
+    NET_SOCK_ADDR_IPv4   addr;
+    NET_SOCK_ADDR_LEN    addr_len;
+    NET_SOCK_RTN_CODE    rtn;
+    CPU_INT32U           seq;
+    CPU_BOOLEAN          same;
+    NET_ERR              err;
+    KAL_ERR              err_kal;
+
+
+    sock_id = (NET_SOCK_ID)(CPU_ADDR)p_arg;
+
+    while (DEF_ON) {
+        addr_len = sizeof(addr);
+        rtn      = NetSock_RxDataFrom(sock_id,
+                                      buf,
+                                      sizeof(buf),
+                                      NET_SOCK_FLAG_NONE,
+                                      (NET_SOCK_ADDR *)&addr,
+                                     &addr_len,
+                                      DEF_NULL,
+                                      0u,
+                                      DEF_NULL,
+                                     &err);
+        if (rtn <= 0) {
+            continue;
+        }
+
+        same = DEF_NO;
+        if (rtn == NET_BENCH_UDP_MSG_SIZE) {
+            Mem_Copy(&seq, buf, sizeof(seq));
+            NetBench_UDP_Fill(buf_exp, seq);
+            same = Mem_Cmp(buf, buf_exp, NET_BENCH_UDP_MSG_SIZE);
+        }
+        if (same != DEF_YES) {
+            NetBench_UDP_RxBadCtr++;
+            continue;
+        }
+
+        NetBench_UDP_RxSeq = seq;
+        KAL_SemPost(NetBench_UDP_Rxd, KAL_OPT_POST_NONE, &err_kal);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_UDP_Free()
+*
+* Description : Take back the transmit buffer once the stack no longer references it.
+*
+* Argument(s) : p_data      Pointer to the data returned.
+*
+*               p_arg       Sequence number of the datagram that referenced it.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetUDP_TxAppDataRefIPv4(), if the data was copied or discarded;
+*               network buffer free handler, once the datagram was transmitted.
+*
+* Note(s)     : (1) Called with the global network lock acquired : only signals the client (see
+*                   'net_udp.c  NetUDP_TxAppDataRefIPv4()  Note #3c').
+*
+*               (2) Data returned twice, not the buffer or for another datagram is counted as an error
+*                   (see 'net_udp.c  NetUDP_TxAppDataRefIPv4()  Note #3b').
+*********************************************************************************************************
+*/
+
+static  void  NetBench_UDP_Free (void  *p_data,
+                                 void  *p_arg)
+{
+    CPU_INT32U  seq;
+    KAL_ERR     err_kal;
+
+
+    seq = (CPU_INT32U)(CPU_ADDR)p_arg;
+    if ((p_data                 != (void *)NetBench_UDP_TxBuf) ||   /* See Note #2.                                     */
+        (NetBench_UDP_TxBufUsed != DEF_YES)                     ||
+        (seq                    != NetBench_UDP_TxSeq)) {
+        NetBench_UDP_FreeErrCtr++;
+    }
+
+    NetBench_UDP_TxBufUsed = DEF_NO;
+    NetBench_UDP_FreeCtr++;
+
+    KAL_SemPost(NetBench_UDP_Freed, KAL_OPT_POST_NONE, &err_kal);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_UDP_Fill()
+*
+* Description : Fill a datagram with its sequence number, followed by a pattern derived from it.
+*
+* Argument(s) : p_buf       Pointer to a buffer of NET_BENCH_UDP_MSG_SIZE octets.
+*
+*               seq         Datagram's sequence number.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_UDP_SinkTask(),
+*               NetBench_UDP().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_UDP_Fill (CPU_INT08U  *p_buf,
+                                 CPU_INT32U   seq)
+{
+    CPU_INT32U  ix;
+
+
+    Mem_Copy(p_buf, &seq, sizeof(seq));
+    for (ix = sizeof(seq); ix < NET_BENCH_UDP_MSG_SIZE; ix++) {
+        p_buf[ix] = (CPU_INT08U)(seq + ix);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBench_Scale()
+*
+* Description : Scale a workload size down for a quick run.
+*
+* Argument(s) : val         Default size.
+*
+* Return(s)   : Size to use.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  NetBench_Scale (CPU_INT32U  val)
+{
+    if (NetBench_Quick == DEF_YES) {
+        val /= NET_BENCH_QUICK_DIV;
+    }
+
+    return (val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetBench_Conn()
+*
+* Description : Open a TCP socket & connect it to a server.
+*
+* Argument(s) : addr        Server's IPv4 address (host order).
+*
+*               port        Server's port.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket connected.
+*
+*                                                               --- RETURNED BY NetSock_Open()/Conn() : ---
+*                               See their error codes.
+*
+* Return(s)   : Socket ID, if connected.
+*
+*               NET_SOCK_BSD_ERR_OPEN, otherwise.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : (1) No call waits on a lossy pipe for longer than NET_BENCH_TIMEOUT_MS.
+*********************************************************************************************************
+*/
+
+static  NET_SOCK_ID  NetBench_Conn (NET_IPv4_ADDR   addr,
+                                    CPU_INT16U      port,
+                                    NET_ERR        *p_err)
+{
+    NET_SOCK_ADDR_IPv4  addr_srv;
+    NET_SOCK_ID         sock_id;
+    NET_ERR             err;
+
+
+    sock_id = NetSock_Open(NET_SOCK_PROTOCOL_FAMILY_IP_V4,
+                           NET_SOCK_TYPE_STREAM,
+                           NET_SOCK_PROTOCOL_TCP,
+                           p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+        return (NET_SOCK_BSD_ERR_OPEN);
+    }
+
+                                                                /* See Note #1.                                         */
+   (void)NetSock_CfgTimeoutRxQ_Set   (sock_id, NET_BENCH_TIMEOUT_MS, &err);
+   (void)NetSock_CfgTimeoutTxQ_Set   (sock_id, NET_BENCH_TIMEOUT_MS, &err);
+   (void)NetSock_CfgTimeoutConnReqSet(sock_id, NET_BENCH_TIMEOUT_MS, &err);
+
+    Mem_Clr(&addr_srv, sizeof(addr_srv));
+    addr_srv.AddrFamily = NET_SOCK_ADDR_FAMILY_IP_V4;
+    addr_srv.Port       = NET_UTIL_HOST_TO_NET_16(port);
+    addr_srv.Addr       = NET_UTIL_HOST_TO_NET_32(addr);
+
+   (void)NetSock_Conn(sock_id, (NET_SOCK_ADDR *)&addr_srv, sizeof(addr_srv), p_err);
+    if (*p_err != NET_SOCK_ERR_NONE) {
+       (void)NetSock_Close(sock_id, &err);
+        return (NET_SOCK_BSD_ERR_OPEN);
+    }
+
+    return (sock_id);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetBench_Xchg()
+*
+* Description : Send a request of NET_BENCH_MSG_SIZE octets & read back its echo.
+*
+* Argument(s) : sock_id     Connected socket's ID.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Echo received.
+*                               NET_SOCK_ERR_CLOSED             Server closed the connection.
+*
+*                                                               --- RETURNED BY NetSock_TxData()/RxData() : ---
+*                               See their error codes.
+*
+* Return(s)   : DEF_OK,   if the whole echo was received.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetBench_RR(),
+*               NetBench_ConnRR().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetBench_Xchg (NET_SOCK_ID   sock_id,
+                                    NET_ERR      *p_err)
+{
+    NET_SOCK_RTN_CODE  rtn;
+    CPU_INT16U         len;
+
+
+    len = 0u;
+    while (len < NET_BENCH_MSG_SIZE) {
+        rtn = NetSock_TxData(sock_id, &NetBench_Buf[len], NET_BENCH_MSG_SIZE - len, NET_SOCK_FLAG_NONE, p_err);
+        if (rtn <= 0) {
+            return (DEF_FAIL);
+        }
+        len += (CPU_INT16U)rtn;
+    }
+
+    len = 0u;
+    while (len < NET_BENCH_MSG_SIZE) {
+        rtn = NetSock_RxData(sock_id, &NetBench_Buf[len], NET_BENCH_MSG_SIZE - len, NET_SOCK_FLAG_NONE, p_err);
+        if (rtn == NET_SOCK_BSD_RTN_CODE_CONN_CLOSED) {
+           *p_err = NET_SOCK_ERR_CLOSED;
+        }
+        if (rtn <= 0) {
+            return (DEF_FAIL);
+        }
+        len += (CPU_INT16U)rtn;
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_RunStart()
+*
+* Description : Start measuring a workload.
+*
+* Argument(s) : p_run           Pointer to run to start.
+*
+*               p_if_name       Name of interface.
+*
+*               p_workload      Name of workload.
+*
+*               op_cnt_max      Maximum number of operations that will be timed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_RunStart (NET_BENCH_RUN    *p_run,
+                                 const  CPU_CHAR  *p_if_name,
+                                 const  CPU_CHAR  *p_workload,
+                                 CPU_INT32U        op_cnt_max)
+{
+    Mem_Clr((void *)p_run, sizeof(NET_BENCH_RUN));
+
+    p_run->IF_Name      = p_if_name;
+    p_run->Workload     = p_workload;
+    p_run->OpCntMax     = op_cnt_max;
+    p_run->Err          = NET_SOCK_ERR_NONE;
+    p_run->LatTbl       = (double *)calloc(op_cnt_max + 1u, sizeof(double));
+    p_run->TxSegStart   = Net_StatCtrs.TCP.TxSegCtr;
+    p_run->ReTxSegStart = Net_StatCtrs.TCP.TxSegConnReTxQ_Ctr;
+    NetBenchPipe_StatGet(&p_run->PipeStart);
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &p_run->CPU_Start);
+    clock_gettime(CLOCK_MONOTONIC,          &p_run->Start);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_OpStart()
+*                                         NetBench_OpEnd()
+*
+* Description : Time one operation of a workload.
+*
+* Argument(s) : p_run       Pointer to run.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_OpStart (NET_BENCH_RUN  *p_run)
+{
+    clock_gettime(CLOCK_MONOTONIC, &p_run->OpStart);
+}
+
+
+static  void  NetBench_OpEnd (NET_BENCH_RUN  *p_run)
+{
+    struct  timespec  now;
+    double            lat_us;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    lat_us = ((double)(now.tv_sec  - p_run->OpStart.tv_sec) * 1e6)
+           + ((double)(now.tv_nsec - p_run->OpStart.tv_nsec) / 1e3);
+
+    if (p_run->OpCnt < p_run->OpCntMax) {
+        p_run->LatTbl[p_run->OpCnt] = lat_us;
+        p_run->OpCnt++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBench_RunEnd()
+*
+* Description : Stop measuring a workload & print its JSON result.
+*
+* Argument(s) : p_run       Pointer to run.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : (1) The run ends when its last octet is delivered, if the workload set 'End' (bulk);
+*                   otherwise when this function is called.  CPU time is always taken here.
+*
+*               (2) A workload stops at its first error; 'err' then holds the error code ('net_err.h')
+*                   & the benchmark returns 1.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_RunEnd (NET_BENCH_RUN  *p_run)
+{
+    struct  timespec     now;
+    struct  timespec     cpu_now;
+    NET_BENCH_PIPE_STAT  pipe_stat;
+    NET_CTR              tx_segs;
+    NET_CTR              retx_segs;
+    double               host_s;
+    double               cpu_ns;
+
+
+    clock_gettime(CLOCK_MONOTONIC,          &now);
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_now);
+    if (p_run->End.tv_sec != 0) {                               /* See Note #1.                                         */
+        now = p_run->End;
+    }
+    host_s = (double)(now.tv_sec  - p_run->Start.tv_sec)
+           + ((double)(now.tv_nsec - p_run->Start.tv_nsec) / 1e9);
+    cpu_ns = ((double)(cpu_now.tv_sec  - p_run->CPU_Start.tv_sec) * 1e9)
+           +  (double)(cpu_now.tv_nsec - p_run->CPU_Start.tv_nsec);
+
+    tx_segs   = Net_StatCtrs.TCP.TxSegCtr           - p_run->TxSegStart;
+    retx_segs = Net_StatCtrs.TCP.TxSegConnReTxQ_Ctr - p_run->ReTxSegStart;
+
+    printf("%s\n    {\"if\": \"%s\", \"workload\": \"%s\", \"ops\": %u, \"octets\": %llu,\n"
+           "     \"host_s\": %.6f, \"ops_per_s\": %.1f, \"mbit_per_s\": %.3f, \"cpu_ns_per_octet\": %.2f,\n"
+           "     \"tcp_tx_segs\": %u, \"tcp_retx_segs\": %u",
+           (NetBench_First == DEF_YES) ? "" : ",",
+           p_run->IF_Name,
+           p_run->Workload,
+           (unsigned)p_run->OpCnt,
+           (unsigned long long)p_run->Octets,
+           host_s,
+           (host_s > 0.0)        ? ((double)p_run->OpCnt / host_s)                : 0.0,
+           (host_s > 0.0)        ? (((double)p_run->Octets * 8.0) / host_s / 1e6) : 0.0,
+           (p_run->Octets > 0u)  ? (cpu_ns / (double)p_run->Octets)               : 0.0,
+           (unsigned)tx_segs,
+           (unsigned)retx_segs);
+    NetBench_First = DEF_NO;
+
+    if (p_run->Err != NET_SOCK_ERR_NONE) {                      /* See Note #2.                                         */
+        printf(", \"err\": %d", (int)p_run->Err);
+        NetBench_Rtn = 1;
+    }
+
+    if (strcmp(p_run->IF_Name, "pipe") == 0) {
+        NetBenchPipe_StatGet(&pipe_stat);
+        printf(",\n     \"pipe\": {\"tx_frames\": %llu, \"rx_frames\": %llu, \"lost\": %llu, \"held_back\": %llu,"
+               " \"rx_ovf\": %llu, \"tx_ext_frames\": %llu}",
+               (unsigned long long)(pipe_stat.TxFrameCtr    - p_run->PipeStart.TxFrameCtr),
+               (unsigned long long)(pipe_stat.RxFrameCtr    - p_run->PipeStart.RxFrameCtr),
+               (unsigned long long)(pipe_stat.LostCtr       - p_run->PipeStart.LostCtr),
+               (unsigned long long)(pipe_stat.ReorderCtr    - p_run->PipeStart.ReorderCtr),
+               (unsigned long long)(pipe_stat.RxOvfCtr      - p_run->PipeStart.RxOvfCtr),
+               (unsigned long long)(pipe_stat.TxExtFrameCtr - p_run->PipeStart.TxExtFrameCtr));
+    }
+
+    printf(",\n     ");
+    NetBench_LatPrint("lat_us", p_run->LatTbl, p_run->OpCnt);
+    printf("}");
+    fflush(stdout);
+
+    free(p_run->LatTbl);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBench_LatPrint()
+*
+* Description : Print latency percentiles as a JSON member.
+*
+* Argument(s) : p_name      Name of member.
+*
+*               p_tbl       Table of latencies (sorted in place).
+*
+*               cnt         Number of latencies.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_RunEnd().
+*
+* Note(s)     : (1) Nearest-rank percentiles.
+*********************************************************************************************************
+*/
+
+static  int  NetBench_LatCmp (const  void  *p_a,
+                              const  void  *p_b)
+{
+    double  a;
+    double  b;
+
+
+    a = *(const double *)p_a;
+    b = *(const double *)p_b;
+    if (a < b) {
+        return (-1);
+    }
+    if (a > b) {
+        return (1);
+    }
+    return (0);
+}
+
+
+static  void  NetBench_LatPrint (const  CPU_CHAR  *p_name,
+                                 double           *p_tbl,
+                                 CPU_INT32U        cnt)
+{
+    if (cnt == 0u) {
+        printf("\"%s\": null", p_name);
+        return;
+    }
+
+    qsort(p_tbl, cnt, sizeof(double), NetBench_LatCmp);
+    printf("\"%s\": {\"p50\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"max\": %.2f}",   /* See Note #1.          */
+           p_name,
+           p_tbl[((cnt - 1u) * 50u) / 100u],
+           p_tbl[((cnt - 1u) * 90u) / 100u],
+           p_tbl[((cnt - 1u) * 99u) / 100u],
+           p_tbl[cnt - 1u]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetBench_Bulk()
+*
+* Description : Bulk transfer workload.
+*
+* Argument(s) : p_if_name   Name of interface.
+*
+*               addr        Server's IPv4 address (host order).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_StartTask().
+*
+* Note(s)     : (1) Throughput counts the octets the sink read, up to the time it read the last of them;
+*                   the close handshake is not included.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_Bulk (const  CPU_CHAR  *p_if_name,
+                             NET_IPv4_ADDR     addr)
+{
+    NET_BENCH_RUN      run;
+    NET_SOCK_ID        sock_id;
+    NET_SOCK_RTN_CODE  rtn;
+    CPU_INT32U         size;
+    CPU_INT32U         len;
+    CPU_INT32U         chunk_len;
+    CPU_INT32U         op_cnt;
+    NET_ERR            err;
+    KAL_ERR            err_kal;
+
+
+    size   = NetBench_Scale(NET_BENCH_BULK_SIZE);
+    op_cnt = size / NET_BENCH_BULK_CHUNK_SIZE;
+    Mem_Set(NetBench_Buf, 0xA5u, sizeof(NetBench_Buf));
+
+    NetBench_RunStart(&run, p_if_name, "bulk", op_cnt);
+
+    sock_id = NetBench_Conn(addr, NET_BENCH_PORT_SINK, &err);
+    if (err != NET_SOCK_ERR_NONE) {
+        run.Err = err;
+        NetBench_RunEnd(&run);
+        return;
+    }
+
+    len = 0u;
+    while (len < size) {
+        chunk_len = size - len;
+        if (chunk_len > NET_BENCH_BULK_CHUNK_SIZE) {
+            chunk_len = NET_BENCH_BULK_CHUNK_SIZE;
+        }
+        NetBench_OpStart(&run);
+        rtn = NetSock_TxData(sock_id, NetBench_Buf, (CPU_INT16U)chunk_len, NET_SOCK_FLAG_NONE, &err);
+        NetBench_OpEnd(&run);
+        if (rtn <= 0) {
+            run.Err = err;
+            break;
+        }
+        len += (CPU_INT32U)rtn;
+    }
+
+   (void)NetSock_Close(sock_id, &err);
+
+    KAL_SemPend(NetBench_SinkDone, KAL_OPT_PEND_BLOCKING, NET_BENCH_SINK_TIMEOUT_MS, &err_kal);
+    if (err_kal != KAL_ERR_NONE) {
+        if (run.Err == NET_SOCK_ERR_NONE) {
+            run.Err = NET_ERR_FAULT_UNKNOWN_ERR;
+        }
+    } else {
+        run.Octets = NetBench_SinkOctets;                       /* See Note #1.                                         */
+        run.End    = NetBench_SinkEnd;
+        if (run.Err == NET_SOCK_ERR_NONE) {
+            run.Err = NetBench_SinkErr;
+        }
+    }
+
+    NetBench_RunEnd(&run);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            NetBench_RR()
+*
+* Description : Request/response workload, on one connection.
+*
+* Argument(s) : p_if_name   Name of interface.
+*
+*               addr        Server's IPv4 address (host order).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_StartTask().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_RR (const  CPU_CHAR  *p_if_name,
+                           NET_IPv4_ADDR     addr)
+{
+    NET_BENCH_RUN  run;
+    NET_SOCK_ID    sock_id;
+    CPU_INT32U     op_cnt;
+    CPU_INT32U     op_ix;
+    CPU_BOOLEAN    ok;
+    NET_ERR        err;
+
+
+    op_cnt = NetBench_Scale(NET_BENCH_RR_CNT);
+
+    NetBench_RunStart(&run, p_if_name, "rr", op_cnt);
+
+    sock_id = NetBench_Conn(addr, NET_BENCH_PORT_ECHO, &err);
+    if (err != NET_SOCK_ERR_NONE) {
+        run.Err = err;
+        NetBench_RunEnd(&run);
+        return;
+    }
+
+    for (op_ix = 0u; op_ix < op_cnt; op_ix++) {
+        NetBench_OpStart(&run);
+        ok = NetBench_Xchg(sock_id, &err);
+        if (ok != DEF_OK) {
+            run.Err = err;
+            break;
+        }
+        NetBench_OpEnd(&run);
+        run.Octets += NET_BENCH_MSG_SIZE;
+    }
+
+   (void)NetSock_Close(sock_id, &err);
+
+    NetBench_RunEnd(&run);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBench_ConnRR()
+*
+* Description : Many-connection workload : one request/response per connection.
+*
+* Argument(s) : p_if_name   Name of interface.
+*
+*               addr        Server's IPv4 address (host order).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_StartTask().
+*
+* Note(s)     : (1) Each op is timed from the socket open to the close returning, so that connection setup
+*                   & teardown costs are included.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_ConnRR (const  CPU_CHAR  *p_if_name,
+                               NET_IPv4_ADDR     addr)
+{
+    NET_BENCH_RUN  run;
+    NET_SOCK_ID    sock_id;
+    CPU_INT32U     op_cnt;
+    CPU_INT32U     op_ix;
+    CPU_BOOLEAN    ok;
+    NET_ERR        err;
+    NET_ERR        err_close;
+
+
+    op_cnt = NetBench_Scale(NET_BENCH_CONN_CNT);
+
+    NetBench_RunStart(&run, p_if_name, "conn", op_cnt);
+
+    for (op_ix = 0u; op_ix < op_cnt; op_ix++) {
+        NetBench_OpStart(&run);                                 /* See Note #1.                                         */
+        sock_id = NetBench_Conn(addr, NET_BENCH_PORT_ECHO, &err);
+        if (err != NET_SOCK_ERR_NONE) {
+            run.Err = err;
+            break;
+        }
+        ok = NetBench_Xchg(sock_id, &err);
+       (void)NetSock_Close(sock_id, &err_close);
+        if (ok != DEF_OK) {
+            run.Err = err;
+            break;
+        }
+        NetBench_OpEnd(&run);
+        run.Octets += NET_BENCH_MSG_SIZE;
+    }
+
+    NetBench_RunEnd(&run);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetBench_UDP()
+*
+* Description : UDP workload : send datagrams by reference, one at a time, & check that each one is
+*                   delivered intact & its data returned exactly once.
+*
+* Argument(s) : p_if_name   Name of interface.
+*
+*               addr_src    Interface's IPv4 address (host order).
+*
+*               addr        Sink's IPv4 address (host order).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBench_StartTask().
+*
+* Note(s)     : (1) Datagrams are sent with NetUDP_TxAppDataRefIPv4() :
+*
+*                   (a) On the pipe, which gathers external data (see 'net_bench_pipe.c  NetBenchPipe_Tx()
+*                       Note #3'), each datagram MUST be transmitted by reference.
+*
+*                   (b) On loopback, the sink is this host & each datagram is copied (see 'net_udp.c
+*                       NetUDP_TxAppDataHandlerIPv4()  Note #7a4').
+*
+*                   Either way, the data MUST be returned exactly once before the next datagram reuses it.
+*
+*               (2) Each op is timed from the transmit call to the sink reading the datagram.  A datagram
+*                   NOT read within the pipe's delay plus NET_BENCH_UDP_LOST_MS is lost, which is ONLY
+*                   allowed on a lossy pipe.
+*********************************************************************************************************
+*/
+
+static  void  NetBench_UDP (const  CPU_CHAR  *p_if_name,
+                            NET_IPv4_ADDR     addr_src,
+                            NET_IPv4_ADDR     addr)
+{
+    NET_BENCH_RUN        run;
+    NET_BENCH_PIPE_STAT  pipe_stat;
+    CPU_BOOLEAN          pipe;
+    CPU_INT32U           op_cnt;
+    CPU_INT32U           seq;
+    CPU_INT32U           tx_cnt;
+    CPU_INT32U           lost_cnt;
+    CPU_INT32U           rx_bad_start;
+    CPU_INT32U           lost_ms;
+    NET_ERR              err;
+    KAL_ERR              err_kal;
+
+
+    op_cnt  = NetBench_Scale(NET_BENCH_UDP_CNT);
+    pipe    = (strcmp(p_if_name, "pipe") == 0) ? DEF_YES : DEF_NO;
+    lost_ms = NET_BENCH_UDP_LOST_MS;
+    if (pipe == DEF_YES) {                                      /* See Note #2.                                         */
+        lost_ms += NetBench_PipeImpCfg.Dly_ms + NetBench_PipeImpCfg.Jitter_ms + NET_BENCH_PIPE_REORDER_HOLD_MS;
+    }
+
+    NetBench_UDP_FreeCtr    = 0u;
+    NetBench_UDP_FreeErrCtr = 0u;
+    rx_bad_start            = NetBench_UDP_RxBadCtr;
+    tx_cnt                  = 0u;
+    lost_cnt                = 0u;
+
+    NetBench_RunStart(&run, p_if_name, "udp", op_cnt);
+
+    for (seq = 1u; seq <= op_cnt; seq++) {
+        NetBench_UDP_Fill(NetBench_UDP_TxBuf, seq);
+        NetBench_UDP_TxSeq     = seq;
+        NetBench_UDP_TxBufUsed = DEF_YES;
+
+        NetBench_OpStart(&run);
+        tx_cnt++;
+       (void)NetUDP_TxAppDataRefIPv4(NetBench_UDP_TxBuf,        /* See Note #1.                                         */
+                                     NET_BENCH_UDP_MSG_SIZE,
+                                     NetBench_UDP_Free,
+                                     (void *)(CPU_ADDR)seq,
+                                     addr_src,
+                                     NET_BENCH_PORT_UDP_SRC,
+                                     addr,
+                                     NET_BENCH_PORT_UDP_SINK,
+                                     NET_IPv4_TOS_DFLT,
+                                     NET_IPv4_TTL_DFLT,
+                                     NET_UDP_FLAG_NONE,
+                                     NET_IPv4_FLAG_NONE,
+                                     DEF_NULL,
+                                    &err);
+                                                                /* Wait for data to be rtn'd before reuse.              */
+        KAL_SemPend(NetBench_UDP_Freed, KAL_OPT_PEND_BLOCKING, NET_BENCH_TIMEOUT_MS, &err_kal);
+        if (err_kal != KAL_ERR_NONE) {
+            NetBench_UDP_FreeErrCtr++;
+            break;
+        }
+        if (err != NET_UDP_ERR_NONE) {
+            run.Err = err;
+            break;
+        }
+
+        do {                                                    /* Wait for this datagram, skipping late ones.          */
+            KAL_SemPend(NetBench_UDP_Rxd, KAL_OPT_PEND_BLOCKING, lost_ms, &err_kal);
+        } while ((err_kal            == KAL_ERR_NONE) &&
+                 (NetBench_UDP_RxSeq != seq));
+        if (err_kal != KAL_ERR_NONE) {
+            lost_cnt++;
+            continue;
+        }
+
+        NetBench_OpEnd(&run);
+        run.Octets += NET_BENCH_UDP_MSG_SIZE;
+    }
+
+                                                                /* ------------------ CHK DELIVERY -------------------- */
+    if ((NetBench_UDP_FreeErrCtr != 0u) ||
+        (NetBench_UDP_FreeCtr    != tx_cnt)) {
+        fprintf(stderr, "net_bench: udp on %s: %u datagrams sent, data returned %u times (%u unexpected)\n",
+                p_if_name, (unsigned)tx_cnt, (unsigned)NetBench_UDP_FreeCtr, (unsigned)NetBench_UDP_FreeErrCtr);
+        run.Err = NET_ERR_FAULT_UNKNOWN_ERR;
+    }
+
+    if (NetBench_UDP_RxBadCtr != rx_bad_start) {
+        fprintf(stderr, "net_bench: udp on %s: %u datagrams read with bad length or data\n",
+                p_if_name, (unsigned)(NetBench_UDP_RxBadCtr - rx_bad_start));
+        run.Err = NET_ERR_RX;
+    }
+
+    if ((lost_cnt != 0u) &&
+       ((pipe != DEF_YES) || (NetBench_PipeImpCfg.LossPPM == 0u))) {
+        fprintf(stderr, "net_bench: udp on %s: %u datagrams lost\n", p_if_name, (unsigned)lost_cnt);
+        run.Err = NET_ERR_RX;
+    }
+
+    if (pipe == DEF_YES) {                                      /* Chk every datagram was ref'd (see Note #1a).         */
+        NetBenchPipe_StatGet(&pipe_stat);
+        if ((pipe_stat.TxExtFrameCtr - run.PipeStart.TxExtFrameCtr) != tx_cnt) {
+            fprintf(stderr, "net_bench: udp on %s: %u of %u datagrams sent by reference\n",
+                    p_if_name, (unsigned)(pipe_stat.TxExtFrameCtr - run.PipeStart.TxExtFrameCtr), (unsigned)tx_cnt);
+            run.Err = NET_ERR_TX;
+        }
+    }
+
+    NetBench_RunEnd(&run);
+}
@@ -0,0 +1,1273 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                    NETWORK PROTOCOL SUITE BENCHMARK
+*
+*                                   IMPAIRED REFLECTING PIPE DEVICE
+*
+* Filename : net_bench_pipe.c
+* Version  : V3.04.00
+*
+* Note(s)  : (1) See 'net_bench_pipe.h  Note(s)' for the device & wire model.
+*
+*            (2) The device is called from tasks only :
+*
+*                (a) Tx()  from the task transmitting, with the global network lock acquired;
+*                (b) Rx()  from the IF receive task;
+*                (c) the wire task.
+*
+*                The frame queues & the statistics are therefore protected by critical sections
+*                only; the PRNG is only used by Tx() & so is protected by the network lock.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#define    NET_BENCH_PIPE_MODULE
+#include  <stdlib.h>
+#include  <lib_mem.h>
+#include  <KAL/kal.h>
+#include  <Source/net.h>
+#include  <Source/net_ascii.h>
+#include  <Source/net_buf.h>
+#include  <IF/net_if.h>
+#include  "net_bench_pipe.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  NET_BENCH_PIPE_PPM                          1000000u
+
+#define  NET_BENCH_PIPE_TASK_NAME               "Bench Pipe Wire"
+#define  NET_BENCH_PIPE_TASK_STK_SIZE                   1024u
+#define  NET_BENCH_PIPE_SEM_NAME                "Bench Pipe Wire Signal"
+
+                                                                /* ----------------- ETHER FRAME FMT ------------------ */
+#define  NET_BENCH_PIPE_HW_ADDR_SIZE                       6u
+#define  NET_BENCH_PIPE_ETHER_IX_DST                       0u
+#define  NET_BENCH_PIPE_ETHER_IX_SRC                       6u
+#define  NET_BENCH_PIPE_ETHER_IX_TYPE                     12u
+#define  NET_BENCH_PIPE_ETHER_HDR_SIZE                    14u
+#define  NET_BENCH_PIPE_ETHER_TYPE_IPv4               0x0800u
+#define  NET_BENCH_PIPE_ETHER_TYPE_ARP                0x0806u
+#define  NET_BENCH_PIPE_ETHER_ADDR_MCAST          DEF_BIT_00    /* I/G bit of first dest addr octet.                    */
+
+                                                                /* ------------------ ARP PKT FMT --------------------- */
+#define  NET_BENCH_PIPE_ARP_IX_OP                          6u
+#define  NET_BENCH_PIPE_ARP_IX_SHA                         8u
+#define  NET_BENCH_PIPE_ARP_IX_SPA                        14u
+#define  NET_BENCH_PIPE_ARP_IX_THA                        18u
+#define  NET_BENCH_PIPE_ARP_IX_TPA                        24u
+#define  NET_BENCH_PIPE_ARP_PKT_SIZE                      28u
+#define  NET_BENCH_PIPE_ARP_OP_REQ                         1u
+#define  NET_BENCH_PIPE_ARP_OP_REPLY                       2u
+#define  NET_BENCH_PIPE_IP_ADDR_SIZE                       4u
+
+                                                                /* ------------------ IPv4 HDR FMT -------------------- */
+#define  NET_BENCH_PIPE_IPv4_IX_SRC                       12u
+#define  NET_BENCH_PIPE_IPv4_IX_DST                       16u
+#define  NET_BENCH_PIPE_IPv4_HDR_SIZE_MIN                 20u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  net_bench_pipe_frame  NET_BENCH_PIPE_FRAME;
+
+struct  net_bench_pipe_frame {
+    NET_BENCH_PIPE_FRAME  *NextPtr;
+    KAL_TICK               Due;                                 /* Tick at which the frame leaves the wire.             */
+    CPU_INT16U             Len;
+    CPU_INT08U             Data[NET_IF_ETHER_FRAME_MAX_SIZE];
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  NET_BENCH_PIPE_CFG     NetBenchPipe_Cfg;
+static  NET_BENCH_PIPE_STAT    NetBenchPipe_Stat;
+static  CPU_INT32U             NetBenchPipe_Seed = 1u;
+
+static  NET_IF_NBR             NetBenchPipe_IF_Nbr;
+static  CPU_INT08U             NetBenchPipe_PeerAddrHW[NET_BENCH_PIPE_HW_ADDR_SIZE];
+
+static  KAL_SEM_HANDLE         NetBenchPipe_WireSignal;
+static  NET_BENCH_PIPE_FRAME  *NetBenchPipe_WireHeadPtr;       /* Frames on the wire, by due tick.                     */
+
+static  NET_BENCH_PIPE_FRAME  *NetBenchPipe_RxHeadPtr;         /* Frames signaled to the IF rx task.                   */
+static  NET_BENCH_PIPE_FRAME  *NetBenchPipe_RxTailPtr;
+static  NET_BUF_QTY            NetBenchPipe_RxCnt;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+                                                                /* ------------ FNCT'S COMMON TO ALL DEV'S ------------ */
+static  void         NetBenchPipe_Init               (NET_IF                *p_if,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_Start              (NET_IF                *p_if,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_Stop               (NET_IF                *p_if,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_Rx                 (NET_IF                *p_if,
+                                                      CPU_INT08U           **p_data,
+                                                      CPU_INT16U            *p_size,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_Tx                 (NET_IF                *p_if,
+                                                      CPU_INT08U            *p_data,
+                                                      CPU_INT16U             size,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_AddrMulticastAdd   (NET_IF                *p_if,
+                                                      CPU_INT08U            *p_addr_hw,
+                                                      CPU_INT08U             addr_hw_len,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_AddrMulticastRemove(NET_IF                *p_if,
+                                                      CPU_INT08U            *p_addr_hw,
+                                                      CPU_INT08U             addr_hw_len,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_ISR_Handler        (NET_IF                *p_if,
+                                                      NET_DEV_ISR_TYPE       type);
+
+static  void         NetBenchPipe_IO_Ctrl            (NET_IF                *p_if,
+                                                      CPU_INT08U             opt,
+                                                      void                  *p_data,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_MII_Rd             (NET_IF                *p_if,
+                                                      CPU_INT08U             phy_addr,
+                                                      CPU_INT08U             reg_addr,
+                                                      CPU_INT16U            *p_data,
+                                                      NET_ERR               *p_err);
+
+static  void         NetBenchPipe_MII_Wr             (NET_IF                *p_if,
+                                                      CPU_INT08U             phy_addr,
+                                                      CPU_INT08U             reg_addr,
+                                                      CPU_INT16U             data,
+                                                      NET_ERR               *p_err);
+
+                                                                /* ----------------------- WIRE ----------------------- */
+static  void         NetBenchPipe_WireTask           (void                  *p_arg);
+
+static  CPU_BOOLEAN  NetBenchPipe_WireXfer           (NET_BENCH_PIPE_FRAME  *p_frame,
+                                                      CPU_INT32U            *p_dly_ms);
+
+static  void         NetBenchPipe_WireInsert         (NET_BENCH_PIPE_FRAME  *p_frame);
+
+static  void         NetBenchPipe_RxDeliver          (NET_BENCH_PIPE_FRAME  *p_frame);
+
+static  void         NetBenchPipe_Flush              (NET_BENCH_PIPE_FRAME **p_head);
+
+static  CPU_INT32U   NetBenchPipe_Rand               (void);
+
+
+/*
+*********************************************************************************************************
+*                                      NETWORK DEVICE DRIVER API
+*********************************************************************************************************
+*/
+
+const  NET_DEV_API_ETHER  NetDev_API_BenchPipe = {                          /* Bench pipe dev API fnct ptrs :   */
+                                                   &NetBenchPipe_Init,                 /*   Init/add                */
+                                                   &NetBenchPipe_Start,                /*   Start                   */
+                                                   &NetBenchPipe_Stop,                 /*   Stop                    */
+                                                   &NetBenchPipe_Rx,                   /*   Rx                      */
+                                                   &NetBenchPipe_Tx,                   /*   Tx                      */
+                                                   &NetBenchPipe_AddrMulticastAdd,     /*   Multicast addr add      */
+                                                   &NetBenchPipe_AddrMulticastRemove,  /*   Multicast addr remove   */
+                                                   &NetBenchPipe_ISR_Handler,          /*   ISR handler             */
+                                                   &NetBenchPipe_IO_Ctrl,              /*   I/O ctrl                */
+                                                   &NetBenchPipe_MII_Rd,               /*   Phy reg rd              */
+                                                   &NetBenchPipe_MII_Wr                /*   Phy reg wr              */
+                                                 };
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       NetBenchPipe_CfgSet()
+*
+* Description : Set the wire impairments & the wire task priority.
+*
+* Argument(s) : p_cfg       Pointer to wire configuration (see 'net_bench_pipe.h  Note #3').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) MUST be called before the device is added (NetIF_Add()).
+*********************************************************************************************************
+*/
+
+void  NetBenchPipe_CfgSet (const  NET_BENCH_PIPE_CFG  *p_cfg)
+{
+    NetBenchPipe_Cfg  = *p_cfg;
+    NetBenchPipe_Seed =  p_cfg->Seed;
+    if (NetBenchPipe_Seed == 0u) {
+        NetBenchPipe_Seed = 1u;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetBenchPipe_StatGet()
+*
+* Description : Get the wire statistics.
+*
+* Argument(s) : p_stat      Pointer to variable that will receive the statistics.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Counters are never reset; callers diff two snapshots.
+*********************************************************************************************************
+*/
+
+void  NetBenchPipe_StatGet (NET_BENCH_PIPE_STAT  *p_stat)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+   *p_stat = NetBenchPipe_Stat;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        NetBenchPipe_Init()
+*
+* Description : (1) Initialize the pipe device :
+*
+*                   (a) Get the peer's hardware address
+*                   (b) Create the wire task & its signal
+*
+*
+* Argument(s) : p_if        Pointer to the interface to initialize.
+*               ----        Argument validated in NetIF_Add().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Device successfully initialized.
+*                               NET_DEV_ERR_INIT                Wire task or signal NOT created.
+*                               NET_DEV_ERR_INVALID_CFG         A second pipe device was added.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IF_Add() via 'p_dev_api->Init()'.
+*
+* Note(s)     : (2) See 'net_bench_pipe.h  Note #5'.
+*
+*               (3) The wire gathers a frame's external data as the target's Wi-Fi driver does (see
+*                   'NetBenchPipe_Tx()  Note #3').
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_Init (NET_IF   *p_if,
+                                 NET_ERR  *p_err)
+{
+    KAL_TASK_HANDLE  task_handle;
+    NET_ERR          err;
+    KAL_ERR          err_kal;
+
+
+                                                                /* See Note #2.                                         */
+    if (KAL_SEM_HANDLE_IS_NULL(NetBenchPipe_WireSignal) != DEF_YES) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+
+    NetASCII_Str_to_MAC(NET_BENCH_PIPE_PEER_ADDR_HW_STR,
+                        NetBenchPipe_PeerAddrHW,
+                       &err);
+
+    NetBenchPipe_WireSignal = KAL_SemCreate(NET_BENCH_PIPE_SEM_NAME,
+                                            DEF_NULL,
+                                           &err_kal);
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_INIT;
+        return;
+    }
+
+    task_handle = KAL_TaskAlloc(NET_BENCH_PIPE_TASK_NAME,
+                                DEF_NULL,
+                                NET_BENCH_PIPE_TASK_STK_SIZE,
+                                DEF_NULL,
+                               &err_kal);
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_INIT;
+        return;
+    }
+
+    KAL_TaskCreate(task_handle,
+                   NetBenchPipe_WireTask,
+                   DEF_NULL,
+                   NetBenchPipe_Cfg.TaskPrio,
+                   DEF_NULL,
+                  &err_kal);
+    if (err_kal != KAL_ERR_NONE) {
+       *p_err = NET_DEV_ERR_INIT;
+        return;
+    }
+
+    NetBenchPipe_IF_Nbr = p_if->Nbr;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    p_if->DevTxExtDataEn = DEF_YES;                             /* See Note #3.                                         */
+#endif
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBenchPipe_Start()
+*
+* Description : Start the pipe device :
+*
+*                   (a) Set the hardware address from the device configuration
+*                   (b) Initialize the transmit semaphore count
+*
+*
+* Argument(s) : p_if        Pointer to the interface to start.
+*               ----        Argument validated in NetIF_Start().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Device successfully started.
+*                               NET_DEV_ERR_INVALID_CFG         Invalid hardware address configured.
+*
+*                                                               - RETURNED BY NetIF_DevCfgTxRdySignal() : -
+*                               NET_IF_ERR_DEV_TX_RDY_VAL       Invalid transmit ready count.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IF_Start() via 'p_dev_api->Start()'.
+*
+* Note(s)     : (1) Transmit completes within Tx() (see 'NetBenchPipe_Tx()  Note #1'); the count only
+*                   bounds the frames a transmitting task may queue before the dealloc task runs.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_Start (NET_IF   *p_if,
+                                  NET_ERR  *p_err)
+{
+    NET_DEV_CFG_ETHER  *p_dev_cfg;
+    CPU_INT08U          hw_addr[NET_BENCH_PIPE_HW_ADDR_SIZE];
+    NET_ERR             err;
+
+
+    p_dev_cfg = (NET_DEV_CFG_ETHER *)p_if->Dev_Cfg;
+
+                                                                /* ------------------- CFG HW ADDR -------------------- */
+    NetASCII_Str_to_MAC(p_dev_cfg->HW_AddrStr,
+                        hw_addr,
+                       &err);
+    if (err != NET_ASCII_ERR_NONE) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+
+    NetIF_AddrHW_SetHandler(p_if->Nbr,
+                            hw_addr,
+                            sizeof(hw_addr),
+                           &err);
+    if (err != NET_IF_ERR_NONE) {
+       *p_err = NET_DEV_ERR_INVALID_CFG;
+        return;
+    }
+
+                                                                /* -------------- INIT TX SEM CNT (see Note #1) ------- */
+    NetIF_DevCfgTxRdySignal(p_if,
+                            p_dev_cfg->TxDescNbr,
+                            p_err);
+    if (*p_err != NET_IF_ERR_NONE) {
+         return;
+    }
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetBenchPipe_Stop()
+*
+* Description : Stop the pipe device; frames on the wire or awaiting reception are lost.
+*
+* Argument(s) : p_if        Pointer to the interface to stop.
+*               ----        Argument validated in NetIF_Stop().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Device successfully stopped.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IF_Stop() via 'p_dev_api->Stop()'.
+*
+* Note(s)     : (1) Frames already signaled to the IF receive task are left in place : each signal
+*                   is consumed by a call to Rx(), which returns an error once the queue is empty.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_Stop (NET_IF   *p_if,
+                                 NET_ERR  *p_err)
+{
+    NET_BENCH_PIPE_FRAME  *p_head;
+    CPU_SR_ALLOC();
+
+
+   (void)p_if;
+
+    CPU_CRITICAL_ENTER();
+    p_head                   = NetBenchPipe_WireHeadPtr;
+    NetBenchPipe_WireHeadPtr = DEF_NULL;
+    CPU_CRITICAL_EXIT();
+
+    NetBenchPipe_Flush(&p_head);
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBenchPipe_Rx()
+*
+* Description : Return the frame at the head of the receive queue.
+*
+* Argument(s) : p_if        Pointer to the interface to receive from.
+*               ----        Argument validated in NetIF_RxHandler().
+*
+*               p_data      Pointer to variable that will receive the received frame's network buffer data area.
+*
+*               p_size      Pointer to variable that will receive the received frame's size (in octets).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Frame successfully received.
+*                               NET_DEV_ERR_RX                  No frame queued, or no receive buffer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_RxHandler() via 'p_dev_api->Rx()'.
+*
+* Note(s)     : (1) A frame that cannot be given a receive buffer is dropped, as a device would.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_Rx (NET_IF       *p_if,
+                               CPU_INT08U  **p_data,
+                               CPU_INT16U   *p_size,
+                               NET_ERR      *p_err)
+{
+    NET_BENCH_PIPE_FRAME  *p_frame;
+    CPU_INT08U            *p_buf;
+    NET_ERR                err;
+    CPU_SR_ALLOC();
+
+
+   *p_data = DEF_NULL;
+   *p_size = 0u;
+
+    CPU_CRITICAL_ENTER();
+    p_frame = NetBenchPipe_RxHeadPtr;
+    if (p_frame != DEF_NULL) {
+        NetBenchPipe_RxHeadPtr = p_frame->NextPtr;
+        if (NetBenchPipe_RxHeadPtr == DEF_NULL) {
+            NetBenchPipe_RxTailPtr  = DEF_NULL;
+        }
+        NetBenchPipe_RxCnt--;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_frame == DEF_NULL) {
+       *p_err = NET_DEV_ERR_RX;
+        return;
+    }
+
+    p_buf = NetBuf_GetDataPtr(p_if,
+                              NET_TRANSACTION_RX,
+                              NET_IF_ETHER_FRAME_MAX_SIZE,
+                              NET_IF_IX_RX,
+                              DEF_NULL,
+                              DEF_NULL,
+                              DEF_NULL,
+                             &err);
+    if (err != NET_BUF_ERR_NONE) {                              /* See Note #1.                                         */
+        CPU_CRITICAL_ENTER();
+        NetBenchPipe_Stat.RxOvfCtr++;
+        CPU_CRITICAL_EXIT();
+        free(p_frame);
+       *p_err = NET_DEV_ERR_RX;
+        return;
+    }
+
+    Mem_Copy(p_buf, p_frame->Data, p_frame->Len);
+   *p_data = p_buf;
+   *p_size = p_frame->Len;
+
+    CPU_CRITICAL_ENTER();
+    NetBenchPipe_Stat.RxFrameCtr++;
+    CPU_CRITICAL_EXIT();
+    free(p_frame);
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetBenchPipe_Tx()
+*
+* Description : Put a frame on the wire.
+*
+* Argument(s) : p_if        Pointer to the interface to transmit on.
+*               ----        Argument validated in NetIF_TxHandler().
+*
+*               p_data      Pointer to the frame's network buffer data area.
+*
+*               size        Size of the frame (in octets).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                Frame successfully transmitted.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_TxHandler() via 'p_dev_api->Tx()'.
+*
+* Note(s)     : (1) The frame is copied, so transmit completes at once : the buffer is handed to the
+*                   dealloc task & the device signaled ready before returning.  The network lock held by
+*                   the caller keeps the dealloc task off the buffer until then.
+*
+*               (2) A frame that is lost or not reflected is still transmitted successfully, as on a
+*                   real wire.
+*
+*               (3) A frame with external data is gathered from its headers, at 'p_data', & its external
+*                   data (see 'net_if.h  NETWORK INTERFACE DATA TYPE  Note #4b').
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_Tx (NET_IF      *p_if,
+                               CPU_INT08U  *p_data,
+                               CPU_INT16U   size,
+                               NET_ERR     *p_err)
+{
+    NET_BENCH_PIPE_FRAME  *p_frame;
+    CPU_INT16U             hdr_len;
+    CPU_BOOLEAN            xfer;
+    CPU_INT32U             dly_ms;
+    KAL_TICK               dly_tick;
+    NET_ERR                err;
+    KAL_ERR                err_kal;
+    CPU_SR_ALLOC();
+
+
+    p_frame = DEF_NULL;
+    if (size <= NET_IF_ETHER_FRAME_MAX_SIZE) {
+        p_frame = (NET_BENCH_PIPE_FRAME *)malloc(sizeof(NET_BENCH_PIPE_FRAME));
+    }
+    if (p_frame != DEF_NULL) {
+        hdr_len = size;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+        if (p_if->DevTxExtDataPtr != DEF_NULL) {                /* Gather ext data (see Note #3).                       */
+            hdr_len = size - p_if->DevTxExtDataLen;
+            Mem_Copy(&p_frame->Data[hdr_len], p_if->DevTxExtDataPtr, p_if->DevTxExtDataLen);
+        }
+#endif
+        Mem_Copy(p_frame->Data, p_data, hdr_len);
+        p_frame->Len     = size;
+        p_frame->NextPtr = DEF_NULL;
+    }
+
+                                                                /* -------------- COMPLETE TX (see Note #1) ----------- */
+    NetIF_TxDeallocTaskPost(p_data, &err);
+    NetIF_DevTxRdySignal(p_if);
+
+    CPU_CRITICAL_ENTER();
+    NetBenchPipe_Stat.TxFrameCtr++;
+    NetBenchPipe_Stat.TxOctetCtr += size;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    if (p_if->DevTxExtDataPtr != DEF_NULL) {
+        NetBenchPipe_Stat.TxExtFrameCtr++;
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+   *p_err = NET_DEV_ERR_NONE;                                   /* See Note #2.                                         */
+
+    if (p_frame == DEF_NULL) {
+        CPU_CRITICAL_ENTER();
+        NetBenchPipe_Stat.DiscardCtr++;
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+                                                                /* ------------------ CROSS THE WIRE ------------------ */
+    xfer = NetBenchPipe_WireXfer(p_frame, &dly_ms);
+    if (xfer != DEF_YES) {
+        free(p_frame);
+        return;
+    }
+
+    if (dly_ms == 0u) {                                         /* See 'net_bench_pipe.h  Note #4'.                     */
+        NetBenchPipe_RxDeliver(p_frame);
+        return;
+    }
+
+    dly_tick       = (KAL_TICK)(((dly_ms * KAL_TickRate) + (DEF_TIME_NBR_mS_PER_SEC - 1u)) / DEF_TIME_NBR_mS_PER_SEC);
+    p_frame->Due   =  KAL_TickGet(&err_kal) + dly_tick;
+    NetBenchPipe_WireInsert(p_frame);
+
+    KAL_SemPost(NetBenchPipe_WireSignal,
+                KAL_OPT_POST_NONE,
+               &err_kal);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   NetBenchPipe_AddrMulticastAdd()
+*                                  NetBenchPipe_AddrMulticastRemove()
+*
+* Description : Configure the multicast address filter; the wire never delivers multicast frames.
+*
+* Argument(s) : p_if            Pointer to the interface.
+*
+*               p_addr_hw       Pointer to multicast hardware address.
+*
+*               addr_hw_len     Length of hardware address.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_DEV_ERR_NONE            Always.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_AddrMulticastAdd()/NetIF_AddrMulticastRemove() via the device API.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_AddrMulticastAdd (NET_IF      *p_if,
+                                             CPU_INT08U  *p_addr_hw,
+                                             CPU_INT08U   addr_hw_len,
+                                             NET_ERR     *p_err)
+{
+   (void)p_if;
+   (void)p_addr_hw;
+   (void)addr_hw_len;
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+static  void  NetBenchPipe_AddrMulticastRemove (NET_IF      *p_if,
+                                                CPU_INT08U  *p_addr_hw,
+                                                CPU_INT08U   addr_hw_len,
+                                                NET_ERR     *p_err)
+{
+   (void)p_if;
+   (void)p_addr_hw;
+   (void)addr_hw_len;
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetBenchPipe_ISR_Handler()
+*
+* Description : None; the pipe device raises no interrupt.
+*
+* Argument(s) : p_if        Pointer to the interface.
+*
+*               type        Type of interrupt.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_ISR_Handler() via the device API.
+*
+* Note(s)     : (1) The uC/OS-III POSIX port runs an ISR in the thread of the task it interrupts, which
+*                   must then be the current task.  A host thread playing the wire cannot satisfy that,
+*                   so the wire is a task & signals reception directly (see 'net_bench_pipe.h  Note #4').
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_ISR_Handler (NET_IF            *p_if,
+                                        NET_DEV_ISR_TYPE   type)
+{
+   (void)p_if;
+   (void)type;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetBenchPipe_IO_Ctrl()
+*
+* Description : Handle the device I/O control options; the link is always up at 1 Gbps full-duplex.
+*
+* Argument(s) : p_if        Pointer to the interface.
+*
+*               opt         Option code representing desired function to perform :
+*
+*                               NET_IF_IO_CTRL_LINK_STATE_GET_INFO      Get link state info.
+*                               NET_IF_IO_CTRL_LINK_STATE_UPDATE        Update link state (no-op).
+*
+*               p_data      Pointer to optional data for either sending or receiving additional function
+*                               arguments or return data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NONE                I/O control option successfully handled.
+*                               NET_IF_ERR_INVALID_IO_CTRL_OPT  Invalid I/O control option.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetIF_Ether_IO_CtrlHandler() via 'p_dev_api->IO_Ctrl()'.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_IO_Ctrl (NET_IF      *p_if,
+                                    CPU_INT08U   opt,
+                                    void        *p_data,
+                                    NET_ERR     *p_err)
+{
+    NET_DEV_LINK_ETHER  *p_link_state;
+
+
+   (void)p_if;
+
+    switch (opt) {
+        case NET_IF_IO_CTRL_LINK_STATE_GET_INFO:
+             p_link_state         = (NET_DEV_LINK_ETHER *)p_data;
+             p_link_state->Spd    =  NET_PHY_SPD_1000;
+             p_link_state->Duplex =  NET_PHY_DUPLEX_FULL;
+             break;
+
+
+        case NET_IF_IO_CTRL_LINK_STATE_UPDATE:
+             break;
+
+
+        default:
+            *p_err = NET_IF_ERR_INVALID_IO_CTRL_OPT;
+             return;
+    }
+
+   *p_err = NET_DEV_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBenchPipe_MII_Rd()
+*                                        NetBenchPipe_MII_Wr()
+*
+* Description : None; the pipe device has no Phy (it is added without a Phy API).
+*
+* Argument(s) : p_if        Pointer to the interface.
+*
+*               phy_addr    Phy address.
+*
+*               reg_addr    Phy register.
+*
+*               p_data      Pointer to variable that will receive the register value (0).
+*
+*               data        Value to write.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_DEV_ERR_NOT_SUPPORTED       Always.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_MII_Rd (NET_IF      *p_if,
+                                   CPU_INT08U   phy_addr,
+                                   CPU_INT08U   reg_addr,
+                                   CPU_INT16U  *p_data,
+                                   NET_ERR     *p_err)
+{
+   (void)p_if;
+   (void)phy_addr;
+   (void)reg_addr;
+
+   *p_data = 0u;
+   *p_err  = NET_DEV_ERR_NOT_SUPPORTED;
+}
+
+
+static  void  NetBenchPipe_MII_Wr (NET_IF      *p_if,
+                                   CPU_INT08U   phy_addr,
+                                   CPU_INT08U   reg_addr,
+                                   CPU_INT16U   data,
+                                   NET_ERR     *p_err)
+{
+   (void)p_if;
+   (void)phy_addr;
+   (void)reg_addr;
+   (void)data;
+
+   *p_err = NET_DEV_ERR_NOT_SUPPORTED;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetBenchPipe_WireTask()
+*
+* Description : Deliver each delayed frame once its due tick is reached.
+*
+* Argument(s) : p_arg       Unused.
+*
+* Return(s)   : none.
+*
+* Created by  : NetBenchPipe_Init().
+*
+* Note(s)     : (1) The task pends until the head frame is due or a frame is put on the wire, whichever
+*                   is first.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_WireTask (void  *p_arg)
+{
+    NET_BENCH_PIPE_FRAME  *p_frame;
+    KAL_TICK               now;
+    KAL_TICK               wait_tick;
+    CPU_INT32U             timeout_ms;
+    KAL_ERR                err_kal;
+    CPU_SR_ALLOC();
+
+
+   (void)p_arg;
+
+    while (DEF_ON) {
+        now        = KAL_TickGet(&err_kal);
+        timeout_ms = KAL_TIMEOUT_INFINITE;
+        do {
+            CPU_CRITICAL_ENTER();
+            p_frame = NetBenchPipe_WireHeadPtr;
+            if (p_frame != DEF_NULL) {
+                if ((CPU_INT32S)(now - p_frame->Due) >= 0) {    /* If head frame due, ...                               */
+                    NetBenchPipe_WireHeadPtr = p_frame->NextPtr;
+                } else {                                        /* ... else wait for it (see Note #1).                  */
+                    wait_tick  = p_frame->Due - now;
+                    timeout_ms = ((wait_tick * DEF_TIME_NBR_mS_PER_SEC) + (KAL_TickRate - 1u)) / KAL_TickRate;
+                    p_frame    = DEF_NULL;
+                }
+            }
+            CPU_CRITICAL_EXIT();
+
+            if (p_frame != DEF_NULL) {
+                NetBenchPipe_RxDeliver(p_frame);
+            }
+        } while (p_frame != DEF_NULL);
+
+        KAL_SemPend(NetBenchPipe_WireSignal,
+                    KAL_OPT_PEND_BLOCKING,
+                    timeout_ms,
+                   &err_kal);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetBenchPipe_WireXfer()
+*
+* Description : (1) Carry a frame across the wire :
+*
+*                   (a) Answer an ARP request                       See 'net_bench_pipe.h  Note #2a'
+*                   (b) Reflect an IPv4 unicast frame               See 'net_bench_pipe.h  Note #2b'
+*                   (c) Impair  an IPv4 unicast frame               See 'net_bench_pipe.h  Note #3'
+*
+*
+* Argument(s) : p_frame     Pointer to frame, rewritten in place.
+*
+*               p_dly_ms    Pointer to variable that will receive the frame's delay on the wire.
+*
+* Return(s)   : DEF_YES, if the frame must be delivered after '*p_dly_ms'.
+*
+*               DEF_NO,  if the frame is lost or discarded.
+*
+* Caller(s)   : NetBenchPipe_Tx().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetBenchPipe_WireXfer (NET_BENCH_PIPE_FRAME  *p_frame,
+                                            CPU_INT32U            *p_dly_ms)
+{
+    CPU_INT08U  *p_hdr;
+    CPU_INT08U  *p_pkt;
+    CPU_INT08U   addr[NET_BENCH_PIPE_HW_ADDR_SIZE];
+    CPU_INT16U   type;
+    CPU_INT16U   op;
+    CPU_BOOLEAN  lost;
+    CPU_BOOLEAN  reorder;
+    CPU_SR_ALLOC();
+
+
+   *p_dly_ms = 0u;
+    if (p_frame->Len < NET_BENCH_PIPE_ETHER_HDR_SIZE) {
+        goto exit_discard;
+    }
+
+    p_hdr =  p_frame->Data;
+    p_pkt = &p_hdr[NET_BENCH_PIPE_ETHER_HDR_SIZE];
+    type  =  MEM_VAL_GET_INT16U_BIG(&p_hdr[NET_BENCH_PIPE_ETHER_IX_TYPE]);
+    switch (type) {
+        case NET_BENCH_PIPE_ETHER_TYPE_ARP:                     /* ------------------ ANSWER ARP REQ ------------------ */
+             if (p_frame->Len < NET_BENCH_PIPE_ETHER_HDR_SIZE + NET_BENCH_PIPE_ARP_PKT_SIZE) {
+                 goto exit_discard;
+             }
+             op = MEM_VAL_GET_INT16U_BIG(&p_pkt[NET_BENCH_PIPE_ARP_IX_OP]);
+             if (op != NET_BENCH_PIPE_ARP_OP_REQ) {
+                 goto exit_discard;
+             }
+             if (Mem_Cmp(&p_pkt[NET_BENCH_PIPE_ARP_IX_SPA],     /* Gratuitous ARP.                                      */
+                         &p_pkt[NET_BENCH_PIPE_ARP_IX_TPA],
+                          NET_BENCH_PIPE_IP_ADDR_SIZE) == DEF_YES) {
+                 goto exit_discard;
+             }
+                                                                /* Reply from the peer to the requester.                */
+             Mem_Copy(&p_hdr[NET_BENCH_PIPE_ETHER_IX_DST], &p_pkt[NET_BENCH_PIPE_ARP_IX_SHA], NET_BENCH_PIPE_HW_ADDR_SIZE);
+             Mem_Copy(&p_hdr[NET_BENCH_PIPE_ETHER_IX_SRC],   NetBenchPipe_PeerAddrHW,         NET_BENCH_PIPE_HW_ADDR_SIZE);
+             MEM_VAL_SET_INT16U_BIG(&p_pkt[NET_BENCH_PIPE_ARP_IX_OP], NET_BENCH_PIPE_ARP_OP_REPLY);
+             Mem_Copy(&p_pkt[NET_BENCH_PIPE_ARP_IX_THA], &p_pkt[NET_BENCH_PIPE_ARP_IX_SHA], NET_BENCH_PIPE_HW_ADDR_SIZE);
+             Mem_Copy(&p_pkt[NET_BENCH_PIPE_ARP_IX_SHA],  NetBenchPipe_PeerAddrHW,          NET_BENCH_PIPE_HW_ADDR_SIZE);
+             Mem_Copy( addr,                             &p_pkt[NET_BENCH_PIPE_ARP_IX_TPA], NET_BENCH_PIPE_IP_ADDR_SIZE);
+             Mem_Copy(&p_pkt[NET_BENCH_PIPE_ARP_IX_TPA], &p_pkt[NET_BENCH_PIPE_ARP_IX_SPA], NET_BENCH_PIPE_IP_ADDR_SIZE);
+             Mem_Copy(&p_pkt[NET_BENCH_PIPE_ARP_IX_SPA],  addr,                             NET_BENCH_PIPE_IP_ADDR_SIZE);
+
+             CPU_CRITICAL_ENTER();
+             NetBenchPipe_Stat.ARP_ReplyCtr++;
+             CPU_CRITICAL_EXIT();
+            *p_dly_ms = NetBenchPipe_Cfg.Dly_ms;                /* Never lost (see 'net_bench_pipe.h  Note #3').        */
+             return (DEF_YES);
+
+
+        case NET_BENCH_PIPE_ETHER_TYPE_IPv4:                    /* ------------------ REFLECT IPv4 -------------------- */
+             if (DEF_BIT_IS_SET(p_hdr[NET_BENCH_PIPE_ETHER_IX_DST], NET_BENCH_PIPE_ETHER_ADDR_MCAST) == DEF_YES) {
+                 goto exit_discard;
+             }
+             if (p_frame->Len < NET_BENCH_PIPE_ETHER_HDR_SIZE + NET_BENCH_PIPE_IPv4_HDR_SIZE_MIN) {
+                 goto exit_discard;
+             }
+             Mem_Copy(&p_hdr[NET_BENCH_PIPE_ETHER_IX_DST], &p_hdr[NET_BENCH_PIPE_ETHER_IX_SRC], NET_BENCH_PIPE_HW_ADDR_SIZE);
+             Mem_Copy(&p_hdr[NET_BENCH_PIPE_ETHER_IX_SRC],  NetBenchPipe_PeerAddrHW,            NET_BENCH_PIPE_HW_ADDR_SIZE);
+             Mem_Copy( addr,                              &p_pkt[NET_BENCH_PIPE_IPv4_IX_SRC], NET_BENCH_PIPE_IP_ADDR_SIZE);
+             Mem_Copy(&p_pkt[NET_BENCH_PIPE_IPv4_IX_SRC], &p_pkt[NET_BENCH_PIPE_IPv4_IX_DST], NET_BENCH_PIPE_IP_ADDR_SIZE);
+             Mem_Copy(&p_pkt[NET_BENCH_PIPE_IPv4_IX_DST],  addr,                              NET_BENCH_PIPE_IP_ADDR_SIZE);
+
+                                                                /* ------------------ IMPAIR IPv4 --------------------- */
+             lost = DEF_NO;
+             if (NetBenchPipe_Cfg.LossPPM > 0u) {
+                 if ((NetBenchPipe_Rand() % NET_BENCH_PIPE_PPM) < NetBenchPipe_Cfg.LossPPM) {
+                     lost = DEF_YES;
+                 }
+             }
+             if (lost == DEF_YES) {
+                 CPU_CRITICAL_ENTER();
+                 NetBenchPipe_Stat.LostCtr++;
+                 CPU_CRITICAL_EXIT();
+                 return (DEF_NO);
+             }
+
+            *p_dly_ms = NetBenchPipe_Cfg.Dly_ms;
+             if (NetBenchPipe_Cfg.Jitter_ms > 0u) {
+                *p_dly_ms += NetBenchPipe_Rand() % (NetBenchPipe_Cfg.Jitter_ms + 1u);
+             }
+
+             reorder = DEF_NO;
+             if (NetBenchPipe_Cfg.ReorderPPM > 0u) {
+                 if ((NetBenchPipe_Rand() % NET_BENCH_PIPE_PPM) < NetBenchPipe_Cfg.ReorderPPM) {
+                     reorder = DEF_YES;
+                 }
+             }
+             if (reorder == DEF_YES) {
+                *p_dly_ms += NET_BENCH_PIPE_REORDER_HOLD_MS;
+                 CPU_CRITICAL_ENTER();
+                 NetBenchPipe_Stat.ReorderCtr++;
+                 CPU_CRITICAL_EXIT();
+             }
+             return (DEF_YES);
+
+
+        default:
+             break;
+    }
+
+
+exit_discard:
+    CPU_CRITICAL_ENTER();
+    NetBenchPipe_Stat.DiscardCtr++;
+    CPU_CRITICAL_EXIT();
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetBenchPipe_WireInsert()
+*
+* Description : Insert a frame on the wire, after every frame due no later than it.
+*
+* Argument(s) : p_frame     Pointer to frame, with its due tick set.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBenchPipe_Tx().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_WireInsert (NET_BENCH_PIPE_FRAME  *p_frame)
+{
+    NET_BENCH_PIPE_FRAME  **p_link;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_link = &NetBenchPipe_WireHeadPtr;
+    while ((*p_link != DEF_NULL) &&
+           ((CPU_INT32S)(p_frame->Due - (*p_link)->Due) >= 0)) {
+        p_link = &(*p_link)->NextPtr;
+    }
+    p_frame->NextPtr = *p_link;
+   *p_link           =  p_frame;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetBenchPipe_RxDeliver()
+*
+* Description : Queue a frame that left the wire for reception & signal the IF receive task.
+*
+* Argument(s) : p_frame     Pointer to frame.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBenchPipe_Tx(),
+*               NetBenchPipe_WireTask().
+*
+* Note(s)     : (1) The receive queue holds as many frames as the device has receive descriptors; a
+*                   frame that finds it full is dropped.
+*
+*               (2) Each signal is consumed by one call to Rx(), which takes the head frame.  A frame
+*                   that was NOT signaled is therefore unlinked again rather than left queued.  A failed
+*                   wakeup still counts as signaled (see 'net_if.c  NetIF_RxTaskSignal()  Note #3b').
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_RxDeliver (NET_BENCH_PIPE_FRAME  *p_frame)
+{
+    NET_IF               *p_if;
+    NET_DEV_CFG_ETHER    *p_dev_cfg;
+    NET_BENCH_PIPE_FRAME **p_link;
+    CPU_BOOLEAN           full;
+    NET_ERR               err;
+    CPU_SR_ALLOC();
+
+
+    p_if      = NetIF_Get(NetBenchPipe_IF_Nbr, &err);
+    p_dev_cfg = (NET_DEV_CFG_ETHER *)p_if->Dev_Cfg;
+
+    p_frame->NextPtr = DEF_NULL;
+    CPU_CRITICAL_ENTER();
+    full = DEF_NO;
+    if (NetBenchPipe_RxCnt >= p_dev_cfg->RxDescNbr) {           /* See Note #1.                                         */
+        NetBenchPipe_Stat.RxOvfCtr++;
+        full = DEF_YES;
+    } else {
+        if (NetBenchPipe_RxTailPtr == DEF_NULL) {
+            NetBenchPipe_RxHeadPtr           = p_frame;
+        } else {
+            NetBenchPipe_RxTailPtr->NextPtr  = p_frame;
+        }
+        NetBenchPipe_RxTailPtr = p_frame;
+        NetBenchPipe_RxCnt++;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (full == DEF_YES) {
+        free(p_frame);
+        return;
+    }
+
+    NetIF_RxTaskSignal(NetBenchPipe_IF_Nbr, &err);
+    if ((err == NET_IF_ERR_NONE) ||
+        (err == NET_IF_ERR_RX_Q_SIGNAL_FAULT)) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    p_link = &NetBenchPipe_RxHeadPtr;
+    while ((*p_link != DEF_NULL) &&
+           (*p_link != p_frame)) {
+        p_link = &(*p_link)->NextPtr;
+    }
+    if (*p_link == p_frame) {
+       *p_link = p_frame->NextPtr;
+        if (NetBenchPipe_RxTailPtr == p_frame) {
+            NetBenchPipe_RxTailPtr  = DEF_NULL;
+            p_link = &NetBenchPipe_RxHeadPtr;
+            while (*p_link != DEF_NULL) {
+                NetBenchPipe_RxTailPtr = *p_link;
+                p_link = &(*p_link)->NextPtr;
+            }
+        }
+        NetBenchPipe_RxCnt--;
+    }
+    NetBenchPipe_Stat.RxOvfCtr++;
+    CPU_CRITICAL_EXIT();
+
+    free(p_frame);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBenchPipe_Flush()
+*
+* Description : Free a list of frames.
+*
+* Argument(s) : p_head      Pointer to the list's head pointer, cleared on return.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBenchPipe_Stop().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetBenchPipe_Flush (NET_BENCH_PIPE_FRAME  **p_head)
+{
+    NET_BENCH_PIPE_FRAME  *p_frame;
+
+
+    while (*p_head != DEF_NULL) {
+        p_frame = *p_head;
+       *p_head  =  p_frame->NextPtr;
+        free(p_frame);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBenchPipe_Rand()
+*
+* Description : Get next pseudo-random number (xorshift32) for the wire impairments.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Pseudo-random number.
+*
+* Caller(s)   : NetBenchPipe_WireXfer().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  NetBenchPipe_Rand (void)
+{
+    CPU_INT32U  x;
+
+
+    x  = NetBenchPipe_Seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x <<  5;
+    NetBenchPipe_Seed = x;
+
+    return (x);
+}
+
@@ -0,0 +1,159 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                    NETWORK PROTOCOL SUITE BENCHMARK
+*
+*                                   IMPAIRED REFLECTING PIPE DEVICE
+*
+* Filename : net_bench_pipe.h
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host-only.  An in-process Ethernet device whose "wire" hands every frame back to the
+*                same interface, so that a single uC/TCP-IP instance can talk to itself through an
+*                Ethernet driver, the ARP cache & the IF receive task, i.e. the path taken on target.
+*                A TAP device would need privileges (& a peer stack) the benchmark should not depend on.
+*
+*            (2) The wire plays a peer host :
+*
+*                (a) An ARP request for any address but the sender's own is answered with the peer's
+*                    hardware address (NET_BENCH_PIPE_PEER_ADDR_HW_STR).
+*
+*                (b) An IPv4 unicast frame is reflected : its IPv4 source & destination addresses are
+*                    swapped & it is re-addressed from the peer to the sender.  Swapping the addresses
+*                    leaves the IPv4 & TCP/UDP checksums valid.  Thus a connection from A:x to B:y is
+*                    received as one from B:x to A:y; if a server on A listens on y, the client &
+*                    the server each see the other as the (remote) host B.
+*
+*                (c) Any other frame (multicast/broadcast IPv4, other protocols) is discarded.
+*
+*            (3) IPv4 frames cross the wire impaired as configured by NetBenchPipe_CfgSet() :
+*
+*                (a) A frame is lost with probability 'LossPPM'.
+*
+*                (b) A frame is delayed by 'Dly_ms', plus a random 0..'Jitter_ms' (which alone may
+*                    reorder frames).
+*
+*                (c) A frame is held back a further NET_BENCH_PIPE_REORDER_HOLD_MS with probability
+*                    'ReorderPPM', so that the frames sent after it overtake it.
+*
+*                ARP replies are delayed but never lost, so that loss only hits the traffic measured.
+*
+*            (4) Delayed frames are kept by the wire task, at OS tick resolution.  Frames that are not
+*                delayed are handed to the IF receive task straight from the transmit call, as for the
+*                loopback interface.
+*
+*            (5) One pipe device may be added.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  NET_BENCH_PIPE_MODULE_PRESENT
+#define  NET_BENCH_PIPE_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <IF/net_if_ether.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  NET_BENCH_PIPE_PEER_ADDR_HW_STR        "02:00:00:00:00:02"
+#define  NET_BENCH_PIPE_REORDER_HOLD_MS                    2u   /* See Note #3c.                                        */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  net_bench_pipe_cfg {
+    CPU_INT32U   LossPPM;                                       /* Probability (ppm) for an IPv4 frame to be lost.      */
+    CPU_INT32U   Dly_ms;                                        /* One-way delay.                                       */
+    CPU_INT32U   Jitter_ms;                                     /* Max random delay added to 'Dly_ms'.                  */
+    CPU_INT32U   ReorderPPM;                                    /* Probability (ppm) for an IPv4 frame to be held back. */
+    CPU_INT32U   Seed;                                          /* PRNG seed (non-zero).                                */
+    CPU_INT08U   TaskPrio;                                      /* Wire task prio.                                      */
+} NET_BENCH_PIPE_CFG;
+
+
+typedef  struct  net_bench_pipe_stat {
+    CPU_INT64U   TxFrameCtr;                                    /* Nbr of frames tx'd by the stack.                     */
+    CPU_INT64U   TxOctetCtr;                                    /* Nbr of octets tx'd by the stack.                     */
+    CPU_INT64U   TxExtFrameCtr;                                 /* Nbr of frames tx'd w/ ext data gathered.             */
+    CPU_INT64U   RxFrameCtr;                                    /* Nbr of frames rx'd by the stack.                     */
+    CPU_INT64U   LostCtr;                                       /* Nbr of frames lost on the wire.                      */
+    CPU_INT64U   ReorderCtr;                                    /* Nbr of frames held back.                             */
+    CPU_INT64U   ARP_ReplyCtr;                                  /* Nbr of ARP requests answered.                        */
+    CPU_INT64U   DiscardCtr;                                    /* Nbr of frames not reflected (see Note #2c).          */
+    CPU_INT64U   RxOvfCtr;                                      /* Nbr of frames dropped for lack of rx resources.      */
+} NET_BENCH_PIPE_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  const  NET_DEV_API_ETHER  NetDev_API_BenchPipe;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  NetBenchPipe_CfgSet (const  NET_BENCH_PIPE_CFG   *p_cfg);     /* Set wire impairments; call before NetIF_Add(). */
+
+void  NetBenchPipe_StatGet(       NET_BENCH_PIPE_STAT  *p_stat);    /* Get wire stats.                                */
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of net bench pipe module include.                */
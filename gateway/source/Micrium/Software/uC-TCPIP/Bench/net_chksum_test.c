@@ -0,0 +1,749 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  NETWORK CHECK-SUM HOST TEST
+*
+* Filename : net_chksum_test.c
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host (Linux) test of the 16-bit one's-complement check-sum paths against a byte-wise
+*                RFC #1071 reference ('NetChkSumTest_RefSum()').  No kernel is started & no interface is
+*                added : packets are built by hand in statically allocated network buffers & handed to
+*                the same functions the transport layers call.
+*
+*            (2) Tests :
+*
+*                    sum_chain       Packet data split over 1 to 4 buffers at random points, each buffer's
+*                                    data at a random alignment, w/ a pseudo-header of random (odd or even)
+*                                    length : 'NetUtil_16BitOnesCplChkSumDataCalc()' walks the chain
+*                                    word at a time ('NetUtil_16BitSumDataCalc()').
+*                    copy_sum        Transport data written by 'NetBuf_DataWrChkSum()' in 1 to 4 appended
+*                                    pieces from sources of random alignment : the data MUST be copied
+*                                    intact, its cached sum MUST cover all of it & the check-sum computed
+*                                    from the cache MUST match the reference.
+*                    ext_data        Transport data referenced in external memory of random alignment
+*                                    (see 'net_util.c  NetUtil_16BitOnesCplSumDataCalc()  Note #7').
+*
+*            (3) Usage : net_chksum_test [-n <iterations per test>] [-s <seed>]
+*
+*                The test reports, as one JSON document on stdout, each test's result & returns 1 if any
+*                test failed.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  <cpu_core.h>
+#include  <lib_mem.h>
+#include  <Source/net.h>
+#include  <Source/net_buf.h>
+#include  <Source/net_util.h>
+#include  <IF/net_if_loopback.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  NET_CHKSUM_TEST_ITER_NBR_DFLT                 20000u
+#define  NET_CHKSUM_TEST_SEED_DFLT                0x2545F491u
+
+#define  NET_CHKSUM_TEST_BUF_NBR_MAX                       4u   /* Max bufs per pkt & pieces per wr.                    */
+#define  NET_CHKSUM_TEST_BUF_SIZE                       1600u
+#define  NET_CHKSUM_TEST_ALIGN_MAX                         8u   /* Data starts at 0 to 7 octets into its buf.           */
+
+#define  NET_CHKSUM_TEST_DATA_LEN_MAX                   1460u
+#define  NET_CHKSUM_TEST_PSEUDO_HDR_LEN_MAX               40u
+#define  NET_CHKSUM_TEST_HDR_LEN_MAX                      60u   /* TCP hdr w/ max opts.                                 */
+
+#define  NET_CHKSUM_TEST_PKT_LEN_MAX                   (NET_CHKSUM_TEST_PSEUDO_HDR_LEN_MAX + \
+                                                        NET_CHKSUM_TEST_HDR_LEN_MAX        + \
+                                                        NET_CHKSUM_TEST_DATA_LEN_MAX)
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  NET_BUF      NetChkSumTest_Buf    [NET_CHKSUM_TEST_BUF_NBR_MAX];
+static  CPU_INT32U   NetChkSumTest_BufData[NET_CHKSUM_TEST_BUF_NBR_MAX][NET_CHKSUM_TEST_BUF_SIZE / sizeof(CPU_INT32U)];
+
+static  CPU_INT32U   NetChkSumTest_Src    [(NET_CHKSUM_TEST_PKT_LEN_MAX + NET_CHKSUM_TEST_ALIGN_MAX) / sizeof(CPU_INT32U) + 1u];
+static  CPU_INT08U   NetChkSumTest_Pkt    [NET_CHKSUM_TEST_PKT_LEN_MAX];  /* Pkt as summed by the ref.            */
+
+static  CPU_INT32U   NetChkSumTest_IterNbr = NET_CHKSUM_TEST_ITER_NBR_DFLT;
+static  CPU_INT32U   NetChkSumTest_Seed    = NET_CHKSUM_TEST_SEED_DFLT;
+static  CPU_INT32U   NetChkSumTest_Rand;
+
+static  CPU_BOOLEAN  NetChkSumTest_First   = DEF_YES;
+static  int          NetChkSumTest_Rtn     = 0;
+
+                                                                /* ------------------- NET DEV CFGS ------------------- */
+const  NET_IF_CFG_LOOPBACK  NetIF_Cfg_Loopback = {              /* Linked by the stack; Net_Init() is NOT called.       */
+    NET_IF_MEM_TYPE_MAIN,                                       /* Rx buf pool type.                                    */
+    1500u,                                                      /* Rx buf large size.                                   */
+       1u,                                                      /* Rx buf large nbr.                                    */
+       4u,                                                      /* Rx buf align octets.                                 */
+       0u,                                                      /* Rx buf ix offset.                                    */
+
+    NET_IF_MEM_TYPE_MAIN,                                       /* Tx buf pool type.                                    */
+    1500u,                                                      /* Tx buf large size.                                   */
+       1u,                                                      /* Tx buf large nbr.                                    */
+      60u,                                                      /* Tx buf small size.                                   */
+       1u,                                                      /* Tx buf small nbr.                                    */
+       4u,                                                      /* Tx buf align octets.                                 */
+       0u,                                                      /* Tx buf ix offset.                                    */
+
+    0u,                                                         /* Mem addr.                                            */
+    0u,                                                         /* Mem size.                                            */
+
+    NET_DEV_CFG_FLAG_NONE                                       /* Flags.                                               */
+};
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void         NetChkSumTest_SumChain(void);
+
+static  void         NetChkSumTest_CopySum (void);
+
+static  void         NetChkSumTest_ExtData (void);
+
+static  NET_BUF     *NetChkSumTest_BufGet  (CPU_INT08U     buf_ix);
+
+static  CPU_INT16U   NetChkSumTest_RefSum  (CPU_INT08U    *p_data,
+                                            CPU_INT32U     len);
+
+static  CPU_INT16U   NetChkSumTest_RefChkSum(CPU_INT32U    len);
+
+static  CPU_INT32U   NetChkSumTest_RandGet (CPU_INT32U     range);
+
+static  void         NetChkSumTest_RandFill(CPU_INT08U    *p_data,
+                                            CPU_INT32U     len);
+
+static  void         NetChkSumTest_Print   (const  CPU_CHAR  *p_name,
+                                            CPU_INT32U     iter_nbr,
+                                            CPU_INT32U     fail_nbr,
+                                            CPU_INT32U     cached_nbr);
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run every test (see 'net_chksum_test.c  Note #2').
+*
+* Argument(s) : argc        Number of arguments.
+*
+*               argv        Arguments (see 'net_chksum_test.c  Note #3').
+*
+* Return(s)   : 0, if every test passed.
+*
+*               1, if any test failed.
+*
+*               2, on usage error.
+*
+* Caller(s)   : Host C runtime.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    int  arg_ix;
+
+
+    for (arg_ix = 1; arg_ix < argc; arg_ix++) {
+        if ((strcmp(argv[arg_ix], "-n") == 0) && (arg_ix + 1 < argc)) {
+            NetChkSumTest_IterNbr = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-s") == 0) && (arg_ix + 1 < argc)) {
+            NetChkSumTest_Seed    = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [-n <iterations per test>] [-s <seed>]\n", argv[0]);
+            return (2);
+        }
+    }
+    if (NetChkSumTest_Seed == 0u) {                             /* Xorshift state MUST NOT be null.                     */
+        NetChkSumTest_Seed = NET_CHKSUM_TEST_SEED_DFLT;
+    }
+    NetChkSumTest_Rand = NetChkSumTest_Seed;
+
+    printf("{\n  \"test\": \"uc-tcpip-chksum\",\n  \"seed\": %u,\n  \"iterations\": %u,\n  \"results\": [",
+           (unsigned)NetChkSumTest_Seed,
+           (unsigned)NetChkSumTest_IterNbr);
+
+    NetChkSumTest_SumChain();
+    NetChkSumTest_CopySum();
+    NetChkSumTest_ExtData();
+
+    printf("\n  ]\n}\n");
+    fflush(stdout);
+
+    return (NetChkSumTest_Rtn);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      NetChkSumTest_SumChain()
+*
+* Description : Check-sum packet data split over a chain of buffers (see 'net_chksum_test.c  Note #2').
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The data is summed as a whole packet's, w/ NO transport header : every buffer's data
+*                   is summed word at a time, w/ any odd octet carried over to the next buffer.
+*********************************************************************************************************
+*/
+
+static  void  NetChkSumTest_SumChain (void)
+{
+    NET_BUF      *p_buf;
+    NET_BUF      *p_buf_head;
+    NET_BUF      *p_buf_prev;
+    CPU_INT08U   *p_pseudo_hdr;
+    CPU_INT32U    pseudo_hdr_len;
+    CPU_INT32U    data_len;
+    CPU_INT32U    data_ix;
+    CPU_INT32U    seg_len;
+    CPU_INT32U    seg_ix;
+    CPU_INT32U    buf_nbr;
+    CPU_INT32U    buf_ix;
+    CPU_INT32U    iter;
+    CPU_INT32U    fail_nbr;
+    NET_CHK_SUM   chk_sum;
+    NET_ERR       err;
+
+
+    fail_nbr = 0u;
+    for (iter = 0u; iter < NetChkSumTest_IterNbr; iter++) {
+        pseudo_hdr_len = NetChkSumTest_RandGet(NET_CHKSUM_TEST_PSEUDO_HDR_LEN_MAX + 1u);
+        data_len       = NetChkSumTest_RandGet(NET_CHKSUM_TEST_DATA_LEN_MAX) + 1u;
+        buf_nbr        = NetChkSumTest_RandGet(NET_CHKSUM_TEST_BUF_NBR_MAX)  + 1u;
+        if (buf_nbr > data_len) {
+            buf_nbr = data_len;
+        }
+                                                                /* Pseudo-hdr at a random alignment too.                */
+        p_pseudo_hdr = (CPU_INT08U *)NetChkSumTest_Src + NetChkSumTest_RandGet(NET_CHKSUM_TEST_ALIGN_MAX);
+        NetChkSumTest_RandFill(p_pseudo_hdr, pseudo_hdr_len);
+        Mem_Copy(&NetChkSumTest_Pkt[0], p_pseudo_hdr, pseudo_hdr_len);
+
+        p_buf_head = DEF_NULL;
+        p_buf_prev = DEF_NULL;
+        data_ix    = 0u;
+        for (buf_ix = 0u; buf_ix < buf_nbr; buf_ix++) {         /* Split data at random points.                         */
+            if (buf_ix == buf_nbr - 1u) {
+                seg_len = data_len - data_ix;
+            } else {                                            /* Leave at least 1 octet for every later buf.          */
+                seg_len = NetChkSumTest_RandGet(data_len - data_ix - (buf_nbr - 1u - buf_ix)) + 1u;
+            }
+            seg_ix = NetChkSumTest_RandGet(NET_CHKSUM_TEST_ALIGN_MAX);
+
+            p_buf  = NetChkSumTest_BufGet(buf_ix);
+            p_buf->Hdr.ProtocolHdrType = NET_PROTOCOL_TYPE_UDP_V4;
+            p_buf->Hdr.TransportHdrIx  = (CPU_INT16U  )seg_ix;
+            p_buf->Hdr.TransportHdrLen = 0u;
+            p_buf->Hdr.DataLen         = (NET_BUF_SIZE)seg_len;
+            NetChkSumTest_RandFill(&p_buf->DataPtr[seg_ix], seg_len);
+            Mem_Copy(&NetChkSumTest_Pkt[pseudo_hdr_len + data_ix], &p_buf->DataPtr[seg_ix], seg_len);
+
+            if (p_buf_prev != DEF_NULL) {
+                p_buf_prev->Hdr.NextBufPtr = p_buf;
+            } else {
+                p_buf_head                 = p_buf;
+            }
+            p_buf_prev = p_buf;
+            data_ix   += seg_len;
+        }
+
+        chk_sum = NetUtil_16BitOnesCplChkSumDataCalc((void *)p_buf_head,
+                                                     (pseudo_hdr_len > 0u) ? (void *)p_pseudo_hdr : DEF_NULL,
+                                                     (CPU_INT16U)pseudo_hdr_len,
+                                                    &err);
+        if ((err     != NET_UTIL_ERR_NONE) ||
+            (chk_sum != NetChkSumTest_RefChkSum(pseudo_hdr_len + data_len))) {
+            fail_nbr++;
+        }
+    }
+
+    NetChkSumTest_Print("sum_chain", NetChkSumTest_IterNbr, fail_nbr, 0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetChkSumTest_CopySum()
+*
+* Description : Write transport data w/ the fused copy & sum & check-sum the packet from the cached sum
+*               (see 'net_chksum_test.c  Note #2').
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The transport header is even-length, as UDP's & TCP's always are, & the pseudo-header
+*                   is IPv4's (12 octets), so that the cached sum is used (see 'net_util.c
+*                   NetUtil_16BitOnesCplSumDataCalc()  Note #6').  One iteration in 4 uses an odd-length
+*                   pseudo-header instead, for which the data MUST be summed again.
+*
+*               (2) Every piece is written from a source of its own random alignment, so that both the
+*                   one-pass copy & sum & the copy-then-sum path are taken (see 'net_util.c
+*                   NetUtil_16BitSumDataCopy()  Note #1').
+*
+*               (3) The cached sum is a network-order 16-bit sum, like the reference's, but either may
+*                   hold a zero sum as 0x0000 or 0xFFFF : they are compared modulo 0xFFFF.
+*********************************************************************************************************
+*/
+
+static  void  NetChkSumTest_CopySum (void)
+{
+    NET_BUF      *p_buf;
+    CPU_INT08U   *p_src;
+    CPU_INT08U   *p_pseudo_hdr;
+    CPU_INT32U    pseudo_hdr_len;
+    CPU_INT32U    hdr_ix;
+    CPU_INT32U    hdr_len;
+    CPU_INT32U    data_len;
+    CPU_INT32U    data_ix;
+    CPU_INT32U    piece_len;
+    CPU_INT32U    piece_nbr;
+    CPU_INT32U    piece_ix;
+    CPU_INT32U    iter;
+    CPU_INT32U    fail_nbr;
+    CPU_INT32U    cached_nbr;
+    CPU_INT16U    sum_ref;
+    CPU_BOOLEAN   ok;
+    NET_CHK_SUM   chk_sum;
+    NET_ERR       err;
+
+
+    fail_nbr   = 0u;
+    cached_nbr = 0u;
+    for (iter = 0u; iter < NetChkSumTest_IterNbr; iter++) {
+        pseudo_hdr_len = (NetChkSumTest_RandGet(4u) == 0u) ? 13u : 12u;     /* See Note #1.                             */
+        hdr_len        = 8u + 2u * NetChkSumTest_RandGet((NET_CHKSUM_TEST_HDR_LEN_MAX - 8u) / 2u + 1u);
+        hdr_ix         = NetChkSumTest_RandGet(NET_CHKSUM_TEST_ALIGN_MAX);
+        data_len       = NetChkSumTest_RandGet(NET_CHKSUM_TEST_DATA_LEN_MAX) + 1u;
+        piece_nbr      = NetChkSumTest_RandGet(NET_CHKSUM_TEST_BUF_NBR_MAX)  + 1u;
+        if (piece_nbr > data_len) {
+            piece_nbr = data_len;
+        }
+
+        p_pseudo_hdr = &NetChkSumTest_Pkt[0];
+        NetChkSumTest_RandFill(p_pseudo_hdr, pseudo_hdr_len);
+
+        p_buf = NetChkSumTest_BufGet(0u);
+        p_buf->Hdr.ProtocolHdrType = NET_PROTOCOL_TYPE_UDP_V4;
+        p_buf->Hdr.TransportHdrIx  = (CPU_INT16U  )hdr_ix;
+        p_buf->Hdr.TransportHdrLen = (CPU_INT16U  )hdr_len;
+        p_buf->Hdr.DataLen         = (NET_BUF_SIZE)data_len;
+        NetChkSumTest_RandFill(&p_buf->DataPtr[hdr_ix], hdr_len);
+        Mem_Copy(&NetChkSumTest_Pkt[pseudo_hdr_len], &p_buf->DataPtr[hdr_ix], hdr_len);
+
+        ok      = DEF_OK;
+        data_ix = 0u;
+        for (piece_ix = 0u; piece_ix < piece_nbr; piece_ix++) { /* Wr data in appended pieces.                          */
+            if (piece_ix == piece_nbr - 1u) {
+                piece_len = data_len - data_ix;
+            } else {
+                piece_len = NetChkSumTest_RandGet(data_len - data_ix - (piece_nbr - 1u - piece_ix)) + 1u;
+            }
+                                                                /* Src of its own alignment (see Note #2).              */
+            p_src = (CPU_INT08U *)NetChkSumTest_Src + NetChkSumTest_RandGet(NET_CHKSUM_TEST_ALIGN_MAX);
+            NetChkSumTest_RandFill(p_src, piece_len);
+            Mem_Copy(&NetChkSumTest_Pkt[pseudo_hdr_len + hdr_len + data_ix], p_src, piece_len);
+
+            NetBuf_DataWrChkSum(p_buf,
+                                (NET_BUF_SIZE)(hdr_ix + hdr_len + data_ix),
+                                (NET_BUF_SIZE) piece_len,
+                                               p_src,
+                                              &err);
+            if (err != NET_BUF_ERR_NONE) {
+                ok = DEF_FAIL;
+            }
+            data_ix += piece_len;
+        }
+                                                                /* Chk data copied intact ...                           */
+        if (Mem_Cmp(&p_buf->DataPtr[hdr_ix + hdr_len], &NetChkSumTest_Pkt[pseudo_hdr_len + hdr_len], data_len) != DEF_YES) {
+            ok = DEF_FAIL;
+        }
+                                                                /* ... & cache covering all of it ...                   */
+        if ((p_buf->Hdr.ChkSumDataIx  != (CPU_INT16U  )(hdr_ix + hdr_len)) ||
+            (p_buf->Hdr.ChkSumDataLen != (NET_BUF_SIZE) data_len)) {
+            ok = DEF_FAIL;
+        }
+                                                                /* ... w/ the data's sum (see Note #3).                 */
+        sum_ref = NetChkSumTest_RefSum(&NetChkSumTest_Pkt[pseudo_hdr_len + hdr_len], data_len);
+        if ((p_buf->Hdr.ChkSumData % 0xFFFFu) != (sum_ref % 0xFFFFu)) {
+            ok = DEF_FAIL;
+        }
+
+        chk_sum = NetUtil_16BitOnesCplChkSumDataCalc((void *)p_buf,
+                                                     (void *)p_pseudo_hdr,
+                                                     (CPU_INT16U)pseudo_hdr_len,
+                                                    &err);
+        if ((err     != NET_UTIL_ERR_NONE) ||
+            (chk_sum != NetChkSumTest_RefChkSum(pseudo_hdr_len + hdr_len + data_len))) {
+            ok = DEF_FAIL;
+        }
+
+        if ((pseudo_hdr_len % 2u) == 0u) {
+            cached_nbr++;
+        }
+        if (ok != DEF_OK) {
+            fail_nbr++;
+        }
+    }
+
+    NetChkSumTest_Print("copy_sum", NetChkSumTest_IterNbr, fail_nbr, cached_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetChkSumTest_ExtData()
+*
+* Description : Check-sum a packet whose transport data is referenced in external memory (see
+*               'net_chksum_test.c  Note #2').
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) Odd-length transport headers are allowed here, so that an octet is carried over from
+*                   the header in the buffer to the external data.
+*********************************************************************************************************
+*/
+
+static  void  NetChkSumTest_ExtData (void)
+{
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    NET_BUF      *p_buf;
+    CPU_INT08U   *p_ext;
+    CPU_INT08U   *p_pseudo_hdr;
+    CPU_INT32U    pseudo_hdr_len;
+    CPU_INT32U    hdr_ix;
+    CPU_INT32U    hdr_len;
+    CPU_INT32U    data_len;
+    CPU_INT32U    iter;
+    CPU_INT32U    fail_nbr;
+    NET_CHK_SUM   chk_sum;
+    NET_ERR       err;
+
+
+    fail_nbr = 0u;
+    for (iter = 0u; iter < NetChkSumTest_IterNbr; iter++) {
+        pseudo_hdr_len = NetChkSumTest_RandGet(NET_CHKSUM_TEST_PSEUDO_HDR_LEN_MAX + 1u);
+        hdr_len        = NetChkSumTest_RandGet(NET_CHKSUM_TEST_HDR_LEN_MAX) + 1u;   /* See Note #1.                 */
+        hdr_ix         = NetChkSumTest_RandGet(NET_CHKSUM_TEST_ALIGN_MAX);
+        data_len       = NetChkSumTest_RandGet(NET_CHKSUM_TEST_DATA_LEN_MAX) + 1u;
+
+        p_pseudo_hdr = &NetChkSumTest_Pkt[0];
+        NetChkSumTest_RandFill(p_pseudo_hdr, pseudo_hdr_len);
+
+        p_buf = NetChkSumTest_BufGet(0u);
+        p_buf->Hdr.ProtocolHdrType = NET_PROTOCOL_TYPE_UDP_V4;
+        p_buf->Hdr.TransportHdrIx  = (CPU_INT16U  )hdr_ix;
+        p_buf->Hdr.TransportHdrLen = (CPU_INT16U  )hdr_len;
+        p_buf->Hdr.DataLen         = (NET_BUF_SIZE)data_len;
+        NetChkSumTest_RandFill(&p_buf->DataPtr[hdr_ix], hdr_len);
+        Mem_Copy(&NetChkSumTest_Pkt[pseudo_hdr_len], &p_buf->DataPtr[hdr_ix], hdr_len);
+
+        p_ext = (CPU_INT08U *)NetChkSumTest_Src + NetChkSumTest_RandGet(NET_CHKSUM_TEST_ALIGN_MAX);
+        NetChkSumTest_RandFill(p_ext, data_len);
+        Mem_Copy(&NetChkSumTest_Pkt[pseudo_hdr_len + hdr_len], p_ext, data_len);
+        p_buf->Hdr.ExtDataPtr = p_ext;
+
+        chk_sum = NetUtil_16BitOnesCplChkSumDataCalc((void *)p_buf,
+                                                     (pseudo_hdr_len > 0u) ? (void *)p_pseudo_hdr : DEF_NULL,
+                                                     (CPU_INT16U)pseudo_hdr_len,
+                                                    &err);
+        if ((err     != NET_UTIL_ERR_NONE) ||
+            (chk_sum != NetChkSumTest_RefChkSum(pseudo_hdr_len + hdr_len + data_len))) {
+            fail_nbr++;
+        }
+    }
+
+    NetChkSumTest_Print("ext_data", NetChkSumTest_IterNbr, fail_nbr, 0u);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetChkSumTest_BufGet()
+*
+* Description : Get a cleared network buffer.
+*
+* Argument(s) : buf_ix      Index of the buffer (0 to NET_CHKSUM_TEST_BUF_NBR_MAX - 1).
+*
+* Return(s)   : Pointer to the buffer.
+*
+* Caller(s)   : NetChkSumTest_SumChain(),
+*               NetChkSumTest_CopySum(),
+*               NetChkSumTest_ExtData().
+*
+* Note(s)     : (1) The buffer's header is cleared, but for its type & size, so that NO cached sum, chained
+*                   buffer or external data is left from an earlier iteration.  Its DATA area is filled w/
+*                   a pattern, so that data NOT written by a test is NOT summed unnoticed.
+*********************************************************************************************************
+*/
+
+static  NET_BUF  *NetChkSumTest_BufGet (CPU_INT08U  buf_ix)
+{
+    NET_BUF  *p_buf;
+
+
+    p_buf = &NetChkSumTest_Buf[buf_ix];
+    Mem_Clr(&p_buf->Hdr, sizeof(p_buf->Hdr));
+    p_buf->Hdr.Type = NET_BUF_TYPE_TX_LARGE;
+    p_buf->Hdr.Size = NET_CHKSUM_TEST_BUF_SIZE;
+    p_buf->DataPtr  = (CPU_INT08U *)&NetChkSumTest_BufData[buf_ix][0];
+    Mem_Set(p_buf->DataPtr, 0xA5u, NET_CHKSUM_TEST_BUF_SIZE);
+
+    return (p_buf);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetChkSumTest_RefSum()
+*
+* Description : Calculate the 16-bit one's-complement sum of data, an octet at a time.
+*
+* Argument(s) : p_data      Pointer to data.
+*
+*               len         Length of data (in octets).
+*
+* Return(s)   : 16-bit one's-complement sum, in host-order.
+*
+* Caller(s)   : NetChkSumTest_CopySum(),
+*               NetChkSumTest_RefChkSum().
+*
+* Note(s)     : (1) RFC #1071, Section 4.1 : adjacent octets are paired into 16-bit words, high-order octet
+*                   first; an odd last octet is padded on the right w/ a zero octet.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetChkSumTest_RefSum (CPU_INT08U  *p_data,
+                                          CPU_INT32U   len)
+{
+    CPU_INT32U  sum;
+    CPU_INT32U  ix;
+
+
+    sum = 0u;
+    for (ix = 0u; ix + 1u < len; ix += 2u) {
+        sum += ((CPU_INT32U)p_data[ix] << DEF_OCTET_NBR_BITS) | (CPU_INT32U)p_data[ix + 1u];
+    }
+    if (ix < len) {
+        sum += (CPU_INT32U)p_data[ix] << DEF_OCTET_NBR_BITS;
+    }
+    while ((sum >> 16u) != 0u) {
+        sum = (sum & 0x0000FFFFu) + (sum >> 16u);
+    }
+
+    return ((CPU_INT16U)sum);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetChkSumTest_RefChkSum()
+*
+* Description : Calculate the reference check-sum of the packet built in 'NetChkSumTest_Pkt'.
+*
+* Argument(s) : len         Length of the packet, pseudo-header included (in octets).
+*
+* Return(s)   : 16-bit one's-complement check-sum, as returned by NetUtil_16BitOnesCplChkSumDataCalc()
+*               (see Note #1).
+*
+* Caller(s)   : NetChkSumTest_SumChain(),
+*               NetChkSumTest_CopySum(),
+*               NetChkSumTest_ExtData().
+*
+* Note(s)     : (1) The stack's check-sum is returned so that it is written into the transport header as is
+*                   (see 'net_util.c  NetUtil_16BitOnesCplChkSumDataCalc()  Note #4') : its octets in memory
+*                   are in network-order.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetChkSumTest_RefChkSum (CPU_INT32U  len)
+{
+    CPU_INT16U  sum;
+    CPU_INT16U  chk_sum;
+
+
+    sum     = NetChkSumTest_RefSum(&NetChkSumTest_Pkt[0], len);
+    chk_sum = (CPU_INT16U)~sum;
+
+    return (NET_UTIL_HOST_TO_NET_16(chk_sum));                  /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetChkSumTest_RandGet()
+*
+* Description : Get a pseudo-random number.
+*
+* Argument(s) : range       Number of values to pick from.
+*
+* Return(s)   : Pseudo-random number, from 0 to range - 1.
+*
+* Caller(s)   : various.
+*
+* Note(s)     : (1) Xorshift32, so that a run is reproduced from its seed on any host.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  NetChkSumTest_RandGet (CPU_INT32U  range)
+{
+    CPU_INT32U  x;
+
+
+    x  = NetChkSumTest_Rand;
+    x ^= x << 13u;
+    x ^= x >> 17u;
+    x ^= x <<  5u;
+    NetChkSumTest_Rand = x;
+
+    return ((range > 0u) ? (x % range) : 0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetChkSumTest_RandFill()
+*
+* Description : Fill a memory buffer w/ pseudo-random octets.
+*
+* Argument(s) : p_data      Pointer to memory buffer.
+*
+*               len         Length of memory buffer (in octets).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : various.
+*
+* Note(s)     : (1) One data set in 8 is all 0xFF octets, the worst case for carries.
+*********************************************************************************************************
+*/
+
+static  void  NetChkSumTest_RandFill (CPU_INT08U  *p_data,
+                                      CPU_INT32U   len)
+{
+    CPU_INT32U  ix;
+
+
+    if (NetChkSumTest_RandGet(8u) == 0u) {                      /* See Note #1.                                         */
+        Mem_Set(p_data, 0xFFu, len);
+        return;
+    }
+
+    for (ix = 0u; ix < len; ix++) {
+        p_data[ix] = (CPU_INT08U)NetChkSumTest_RandGet(256u);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetChkSumTest_Print()
+*
+* Description : Print a test's result.
+*
+* Argument(s) : p_name      Test name.
+*
+*               iter_nbr    Number of packets checked.
+*
+*               fail_nbr    Number of packets that failed a check.
+*
+*               cached_nbr  Number of packets check-summed from a cached sum, if any.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetChkSumTest_SumChain(),
+*               NetChkSumTest_CopySum(),
+*               NetChkSumTest_ExtData().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  NetChkSumTest_Print (const  CPU_CHAR    *p_name,
+                                          CPU_INT32U   iter_nbr,
+                                          CPU_INT32U   fail_nbr,
+                                          CPU_INT32U   cached_nbr)
+{
+    printf("%s\n    {\"test\": \"%s\", \"ok\": %s, \"packets\": %u, \"failed\": %u, \"cached\": %u}",
+           (NetChkSumTest_First == DEF_YES) ? "" : ",",
+           p_name,
+           (fail_nbr == 0u) ? "true" : "false",
+           (unsigned)iter_nbr,
+           (unsigned)fail_nbr,
+           (unsigned)cached_nbr);
+    NetChkSumTest_First = DEF_NO;
+    if (fail_nbr != 0u) {
+        NetChkSumTest_Rtn = 1;
+    }
+}
@@ -0,0 +1,49 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     NETWORK CONFIGURATION FILE
+*
+*                                   HOST (LINUX) QCA400x DRIVER BENCH
+*
+* Filename : net_cfg.h
+* Version  : V3.04.00
+*
+* Note(s)  : (1) The stack's host benchmark configuration (see 'uC-TCPIP/Bench/Cfg/net_cfg.h') with the
+*                Wi-Fi interface enabled so that the QCA400x driver & the GT202 BSP headers compile.
+*                No network interface is added : the bench drives the driver below the stack.
+*********************************************************************************************************
+*/
+
+#ifndef  QCA_BENCH_NET_CFG_MODULE_PRESENT
+#define  QCA_BENCH_NET_CFG_MODULE_PRESENT
+
+#include  "../../../../../Bench/Cfg/net_cfg.h"
+
+#undef   NET_IF_CFG_WIFI_EN
+#define  NET_IF_CFG_WIFI_EN                     DEF_ENABLED
+
+#endif  /* QCA_BENCH_NET_CFG_MODULE_PRESENT */
@@ -0,0 +1,103 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     QCA400x DRIVER HOST BENCH
+*
+*                                   RX651 I/O REGISTERS ON THE HOST
+*
+* Filename : iorx651.h
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host-only.  Found ahead of the board's 'iorx651.h' so that the GT202 BSP compiles
+*                unmodified on the host.  The peripherals the SPI DMA path touches (DMAC, DMAC0, DMAC1,
+*                ICU, RSPI1 & SYSTEM) are redirected from their fixed addresses to plain variables that
+*                the mock peripherals ('qca_bench_spi.c') watch & update.  Any other peripheral keeps
+*                its fixed address & MUST NOT be accessed by the code under test.
+*
+*            (2) GCC ignores the header's '#pragma bit_order left' so bit-fields are laid out in the
+*                opposite order to the target.  The mock peripherals only ever access a register
+*                through the same field the BSP uses, or through a whole-register access with the
+*                BSP's own bit definition, so the layout does not matter.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  QCA_BENCH_IORX651_PRESENT
+#define  QCA_BENCH_IORX651_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define  __evenaccess                                           /* Only defined by the header for IAR.                  */
+#include_next  <iorx651.h>
+
+
+/*
+*********************************************************************************************************
+*                                    MOCK PERIPHERALS (see Note #1)
+*********************************************************************************************************
+*/
+
+extern  volatile  struct  st_dmac    QCABench_DMAC;
+extern  volatile  struct  st_dmac0   QCABench_DMAC0;
+extern  volatile  struct  st_dmac1   QCABench_DMAC1;
+extern  volatile  struct  st_icu     QCABench_ICU;
+extern  volatile  struct  st_rspi    QCABench_RSPI1;
+extern  volatile  struct  st_system  QCABench_SYSTEM;
+
+#undef   DMAC
+#undef   DMAC0
+#undef   DMAC1
+#undef   ICU
+#undef   RSPI1
+#undef   SYSTEM
+
+#define  DMAC                                   QCABench_DMAC
+#define  DMAC0                                  QCABench_DMAC0
+#define  DMAC1                                  QCABench_DMAC1
+#define  ICU                                    QCABench_ICU
+#define  RSPI1                                  QCABench_RSPI1
+#define  SYSTEM                                 QCABench_SYSTEM
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of QCA400x bench iorx651 module include.         */
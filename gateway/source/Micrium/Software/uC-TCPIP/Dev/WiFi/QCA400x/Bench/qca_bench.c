@@ -0,0 +1,557 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     QCA400x DRIVER HOST BENCH
+*
+* Filename : qca_bench.c
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host (Linux) bench of the QCA400x driver's transfer paths, run against a mock target &
+*                host controller ('qca_bench_hcd.h') & mock SPI DMA peripherals ('qca_bench_spi.h').
+*                The driver ('driver_main.c', 'driver_txrx.c', 'htc.c') & the GT202 BSP
+*                ('net_bsp_gt202.c') are built unmodified.
+*
+*            (2) Tests :
+*
+*                    rx_chain        Frames whose trailers carry the next frame's lookahead : the
+*                                    driver reads the chain w/o re-reading the lookahead registers.
+*                    rx_no_trailer   The same frames w/o trailers : one register read per frame.
+*                    rx_not_arrived  A trailer announces a frame not yet in the target's read buffer :
+*                                    the driver MUST NOT read it before it arrives.
+*                    tx_credits      More frames queued than credits : at most
+*                                    DRIVER_CONFIG_TX_PER_PASS_MAX frames per pass, none w/o a credit,
+*                                    the rest sent once a trailer credit report arrives.
+*                    spi_dma         The BSP's DMA transfer path : both directions, either buffer
+*                                    missing, a stalled transfer & a stale transfer end signal.
+*
+*            (3) The bench reports, as one JSON document on stdout, each test's result & the mock
+*                target's counters, & returns 1 if any test failed.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#define    QCA_BENCH_MODULE
+#include  <stdio.h>
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <net_bsp_gt202.h>
+#include  "qca_bench_hcd.h"
+#include  "qca_bench_spi.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  QCA_BENCH_CREDIT_NBR                              8u   /* Credits reported at init : 6 for the data ep.        */
+#define  QCA_BENCH_DATA_EP                                 2u
+#define  QCA_BENCH_CTRL_EP                                 0u
+
+#define  QCA_BENCH_TX_FRAME_NBR                           10u
+#define  QCA_BENCH_TX_FRAME_LEN                          100u
+#define  QCA_BENCH_TX_PER_PASS_MAX                         4u   /* DRIVER_CONFIG_TX_PER_PASS_MAX.                       */
+
+#define  QCA_BENCH_SPI_XFER_LEN                           64u   /* Above the BSP's DMA threshold.                       */
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT16U  QCABench_RxLenTbl[] = {              /* Data lens of the rx tests' frames.                   */
+    100u, 1500u, 60u, 300u
+};
+
+#define  QCA_BENCH_RX_FRAME_NBR            (sizeof(QCABench_RxLenTbl) / sizeof(QCABench_RxLenTbl[0]))
+
+static  CPU_BOOLEAN  QCABench_First = DEF_YES;
+static  int          QCABench_Rtn   = 0;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void         QCABench_RxChain     (CPU_BOOLEAN          look_ahead_en);
+
+static  void         QCABench_RxNotArrived(void);
+
+static  void         QCABench_TxCredits   (void);
+
+static  void         QCABench_SPI_DMA     (void);
+
+static  CPU_BOOLEAN  QCABench_HCD_StatOK  (QCA_BENCH_HCD_STAT  *p_stat);
+
+static  void         QCABench_HCD_Print   (const  CPU_CHAR     *p_name,
+                                           CPU_BOOLEAN          ok);
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Run every test (see 'qca_bench.c  Note #2').
+*
+* Argument(s) : none.
+*
+* Return(s)   : 0, if every test passed.
+*
+*               1, otherwise.
+*
+* Caller(s)   : Host C runtime.
+*
+* Note(s)     : (1) The CPU port's critical sections MUST be initialized before the BSP enters one.
+*********************************************************************************************************
+*/
+
+int  main (void)
+{
+    CPU_IntInit();                                              /* See Note #1.                                         */
+
+    printf("{\n  \"bench\": \"qca400x\",\n  \"results\": [");
+
+    QCABench_RxChain(DEF_YES);
+    QCABench_RxChain(DEF_NO);
+    QCABench_RxNotArrived();
+    QCABench_TxCredits();
+    QCABench_SPI_DMA();
+
+    printf("\n  ]\n}\n");
+    fflush(stdout);
+
+    return (QCABench_Rtn);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         QCABench_RxChain()
+*
+* Description : Read a burst of frames, already arrived, w/ or w/o lookahead trailers.
+*
+* Argument(s) : look_ahead_en   DEF_YES, for trailers to carry the next frame's lookahead.
+*
+*                               DEF_NO,  otherwise.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) W/ trailers, the lookahead registers are read for the first frame & once more after
+*                   the last, whose trailer carries no valid lookahead.  W/o, they are read for every
+*                   frame & once more.
+*********************************************************************************************************
+*/
+
+static  void  QCABench_RxChain (CPU_BOOLEAN  look_ahead_en)
+{
+    QCA_BENCH_HCD_RX_FRAME  frame;
+    QCA_BENCH_HCD_STAT      stat;
+    CPU_INT32U              look_ahead_rd_nbr;
+    CPU_INT32U              ix;
+    CPU_BOOLEAN             ok;
+
+
+    QCABenchHCD_Init(QCA_BENCH_CREDIT_NBR);
+
+    Mem_Clr(&frame, sizeof(frame));
+    frame.EP          = QCA_BENCH_DATA_EP;
+    frame.LookAheadEn = look_ahead_en;
+    frame.Arrived     = DEF_YES;
+    for (ix = 0u; ix < QCA_BENCH_RX_FRAME_NBR; ix++) {
+        frame.DataLen = QCABench_RxLenTbl[ix];
+        QCABenchHCD_RxQueue(&frame);
+    }
+
+   (void)QCABenchHCD_Run();
+
+    QCABenchHCD_StatGet(&stat);
+    look_ahead_rd_nbr = (look_ahead_en == DEF_YES) ? 2u : (QCA_BENCH_RX_FRAME_NBR + 1u);   /* See Note #1.    */
+    ok = ((QCABench_HCD_StatOK(&stat) == DEF_OK)                   &&
+          (stat.RxDeliverCtr          == QCA_BENCH_RX_FRAME_NBR)   &&
+          (stat.LookAheadRdCtr        == look_ahead_rd_nbr)        &&
+          (QCABenchHCD_RxPending()    == 0u)) ? DEF_OK : DEF_FAIL;
+
+    QCABench_HCD_Print((look_ahead_en == DEF_YES) ? "rx_chain" : "rx_no_trailer", ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       QCABench_RxNotArrived()
+*
+* Description : Read a frame whose trailer announces a frame not yet arrived, then that frame once it
+*               arrives.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The pre-loaded lookahead is valid but the read buffer no longer holds the frame : the
+*                   driver MUST fall back to the registers, which report nothing, & wait for the packet
+*                   interrupt rather than read a frame the target does not have.
+*********************************************************************************************************
+*/
+
+static  void  QCABench_RxNotArrived (void)
+{
+    QCA_BENCH_HCD_RX_FRAME  frame;
+    QCA_BENCH_HCD_STAT      stat;
+    CPU_BOOLEAN             ok;
+
+
+    QCABenchHCD_Init(QCA_BENCH_CREDIT_NBR);
+
+    Mem_Clr(&frame, sizeof(frame));
+    frame.EP          = QCA_BENCH_DATA_EP;
+    frame.DataLen     = QCABench_RxLenTbl[0];
+    frame.LookAheadEn = DEF_YES;
+    frame.Arrived     = DEF_YES;
+    QCABenchHCD_RxQueue(&frame);
+    frame.DataLen     = QCABench_RxLenTbl[1];
+    frame.Arrived     = DEF_NO;
+    QCABenchHCD_RxQueue(&frame);
+
+   (void)QCABenchHCD_Run();                                     /* See Note #1.                                         */
+
+    QCABenchHCD_StatGet(&stat);
+    ok = ((QCABench_HCD_StatOK(&stat) == DEF_OK) &&
+          (stat.RxDeliverCtr          == 1u)     &&
+          (QCABenchHCD_RxPending()    == 1u)) ? DEF_OK : DEF_FAIL;
+
+    QCABenchHCD_RxArrive();
+   (void)QCABenchHCD_Run();
+
+    QCABenchHCD_StatGet(&stat);
+    ok = ((ok                         == DEF_OK) &&
+          (QCABench_HCD_StatOK(&stat) == DEF_OK) &&
+          (stat.RxDeliverCtr          == 2u)     &&
+          (stat.LookAheadRdCtr        == 4u)     &&
+          (QCABenchHCD_RxPending()    == 0u)) ? DEF_OK : DEF_FAIL;
+
+    QCABench_HCD_Print("rx_not_arrived", ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABench_TxCredits()
+*
+* Description : Send more frames than the data endpoint has credits for.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The data endpoint's 6 credits are spent over two passes (4, then 2) before the driver
+*                   reports it may block w/ frames still queued, & so still held.
+*
+*               (2) A credit report for 4 more credits arrives in the trailer of an empty control frame :
+*                   the remaining 4 frames are sent in the pass that reads it.
+*********************************************************************************************************
+*/
+
+static  void  QCABench_TxCredits (void)
+{
+    QCA_BENCH_HCD_RX_FRAME  frame;
+    QCA_BENCH_HCD_STAT      stat;
+    CPU_INT32U              ix;
+    CPU_INT32U              credit_nbr;
+    CPU_BOOLEAN             ok;
+
+
+    QCABenchHCD_Init(QCA_BENCH_CREDIT_NBR);
+    credit_nbr = QCABenchHCD_CreditsGet(QCA_BENCH_DATA_EP);
+
+    for (ix = 0u; ix < QCA_BENCH_TX_FRAME_NBR; ix++) {
+        QCABenchHCD_TxSubmit(QCA_BENCH_DATA_EP, QCA_BENCH_TX_FRAME_LEN);
+    }
+
+   (void)QCABenchHCD_Run();                                     /* See Note #1.                                         */
+
+    QCABenchHCD_StatGet(&stat);
+    ok = ((stat.TxErrCtr                                == 0u)         &&
+          (stat.AssertCtr                               == 0u)         &&
+          (stat.TxFrameCtr                              == credit_nbr) &&
+          (stat.BufNbrUsed                              == QCA_BENCH_TX_FRAME_NBR - credit_nbr) &&
+          (QCABenchHCD_CreditsGet(QCA_BENCH_DATA_EP)    == 0u)) ? DEF_OK : DEF_FAIL;
+
+    Mem_Clr(&frame, sizeof(frame));                             /* See Note #2.                                         */
+    frame.EP       = QCA_BENCH_CTRL_EP;
+    frame.CreditEP = QCA_BENCH_DATA_EP;
+    frame.Credits  = QCA_BENCH_TX_FRAME_NBR - credit_nbr;
+    frame.Arrived  = DEF_YES;
+    QCABenchHCD_RxQueue(&frame);
+
+   (void)QCABenchHCD_Run();
+
+    QCABenchHCD_StatGet(&stat);
+    ok = ((ok                                           == DEF_OK)                    &&
+          (QCABench_HCD_StatOK(&stat)                   == DEF_OK)                    &&
+          (credit_nbr                                   == QCA_BENCH_CREDIT_NBR - 2u) &&
+          (stat.TxFrameCtr                              == QCA_BENCH_TX_FRAME_NBR)    &&
+          (stat.TxDoneCtr                               == QCA_BENCH_TX_FRAME_NBR)    &&
+          (stat.TxPassMax                               == QCA_BENCH_TX_PER_PASS_MAX) &&
+          (QCABenchHCD_CreditsGet(QCA_BENCH_DATA_EP)    == 0u)                        &&
+          (QCABenchHCD_RxPending()                      == 0u)) ? DEF_OK : DEF_FAIL;
+
+    QCABench_HCD_Print("tx_credits", ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         QCABench_SPI_DMA()
+*
+* Description : (1) Run the GT202 BSP's DMA transfer path :
+*
+*                   (a) Write & read
+*                   (b) Read only  : the peer sees all 1's
+*                   (c) Write only : the data read is discarded
+*                   (d) Stalled transfer, after a stale transfer end signal : the transfer MUST time out
+*                       rather than be released by the stale signal, & leave the DMAC & RSPI idle
+*                   (e) Write & read again, once the peer is released
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  QCABench_SPI_DMA (void)
+{
+    const  NET_DEV_BSP_WIFI_SPI  *p_bsp;
+    CPU_INT08U                    wr[QCA_BENCH_SPI_XFER_LEN];
+    CPU_INT08U                    rd[QCA_BENCH_SPI_XFER_LEN];
+    CPU_INT08U                    peer_tx[QCA_BENCH_SPI_XFER_LEN];
+    CPU_INT08U                    peer_rx[QCA_BENCH_SPI_XFER_LEN];
+    CPU_INT08U                    ones[QCA_BENCH_SPI_XFER_LEN];
+    QCA_BENCH_SPI_STAT            stat;
+    CPU_INT16U                    ix;
+    CPU_BOOLEAN                   ok;
+    NET_ERR                       err;
+
+
+    p_bsp = &NetDev_BSP_GT202_OnBoard_SPI;
+    for (ix = 0u; ix < QCA_BENCH_SPI_XFER_LEN; ix++) {
+        wr[ix]      = (CPU_INT08U)(ix * 3u);
+        peer_tx[ix] = (CPU_INT08U)(0xA5u ^ ix);
+    }
+    Mem_Set(&ones[0], 0xFFu, sizeof(ones));
+    QCABenchSPI_PeerTxSet(&peer_tx[0], sizeof(peer_tx));
+
+    p_bsp->SPI_Init(DEF_NULL, &err);
+    ok = (err == NET_DEV_ERR_NONE) ? DEF_OK : DEF_FAIL;
+
+                                                                /* ------------------- (a) WR & RD -------------------- */
+    Mem_Clr(&rd[0], sizeof(rd));
+    p_bsp->SPI_WrRd(DEF_NULL, &wr[0], &rd[0], sizeof(wr), &err);
+    QCABenchSPI_PeerRxGet(&peer_rx[0], sizeof(peer_rx));
+    ok = ((ok                                            == DEF_OK)           &&
+          (err                                           == NET_DEV_ERR_NONE) &&
+          (Mem_Cmp(&rd[0],      &peer_tx[0], sizeof(rd)) == DEF_YES)          &&
+          (Mem_Cmp(&peer_rx[0], &wr[0],      sizeof(wr)) == DEF_YES)          &&
+          (QCABenchSPI_IsIdle()                          == DEF_YES)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* -------------------- (b) RD ONLY ------------------- */
+    Mem_Clr(&rd[0], sizeof(rd));
+    p_bsp->SPI_WrRd(DEF_NULL, DEF_NULL, &rd[0], sizeof(rd), &err);
+    QCABenchSPI_PeerRxGet(&peer_rx[0], sizeof(peer_rx));
+    ok = ((ok                                            == DEF_OK)           &&
+          (err                                           == NET_DEV_ERR_NONE) &&
+          (Mem_Cmp(&rd[0],      &peer_tx[0], sizeof(rd)) == DEF_YES)          &&
+          (Mem_Cmp(&peer_rx[0], &ones[0],    sizeof(wr)) == DEF_YES)          &&
+          (QCABenchSPI_IsIdle()                          == DEF_YES)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* -------------------- (c) WR ONLY ------------------- */
+    p_bsp->SPI_WrRd(DEF_NULL, &wr[0], DEF_NULL, sizeof(wr), &err);
+    QCABenchSPI_PeerRxGet(&peer_rx[0], sizeof(peer_rx));
+    ok = ((ok                                            == DEF_OK)           &&
+          (err                                           == NET_DEV_ERR_NONE) &&
+          (Mem_Cmp(&peer_rx[0], &wr[0],      sizeof(wr)) == DEF_YES)          &&
+          (QCABenchSPI_IsIdle()                          == DEF_YES)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* -------------- (d) STALE SIGNAL & STALL ------------ */
+    QCABenchSPI_ISR_Raise();
+    QCABenchSPI_StallSet(DEF_YES);
+    p_bsp->SPI_WrRd(DEF_NULL, &wr[0], &rd[0], sizeof(wr), &err);
+    QCABenchSPI_StallSet(DEF_NO);
+    ok = ((ok                                            == DEF_OK)            &&
+          (err                                           == NET_DEV_ERR_FAULT) &&
+          (QCABenchSPI_IsIdle()                          == DEF_YES)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* ------------------ (e) WR & RD AGAIN --------------- */
+    Mem_Clr(&rd[0], sizeof(rd));
+    p_bsp->SPI_WrRd(DEF_NULL, &wr[0], &rd[0], sizeof(wr), &err);
+    ok = ((ok                                            == DEF_OK)           &&
+          (err                                           == NET_DEV_ERR_NONE) &&
+          (Mem_Cmp(&rd[0],      &peer_tx[0], sizeof(rd)) == DEF_YES)          &&
+          (QCABenchSPI_IsIdle()                          == DEF_YES)) ? DEF_OK : DEF_FAIL;
+
+    QCABenchSPI_StatGet(&stat);
+    ok = ((ok             == DEF_OK) &&
+          (stat.XferCtr   == 4u)     &&
+          (stat.StallCtr  == 1u)     &&
+          (stat.CfgErrCtr == 0u)) ? DEF_OK : DEF_FAIL;
+
+    printf("%s\n    {\"test\": \"spi_dma\", \"ok\": %s, \"xfers\": %u, \"octets\": %u, \"stalls\": %u,"
+           " \"isrs\": %u, \"cfg_errs\": %u}",
+           (QCABench_First == DEF_YES) ? "" : ",",
+           (ok == DEF_OK) ? "true" : "false",
+           (unsigned)stat.XferCtr,
+           (unsigned)stat.OctetCtr,
+           (unsigned)stat.StallCtr,
+           (unsigned)stat.ISR_Ctr,
+           (unsigned)stat.CfgErrCtr);
+    QCABench_First = DEF_NO;
+    if (ok != DEF_OK) {
+        QCABench_Rtn = 1;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABench_HCD_StatOK()
+*
+* Description : Check the mock target's error counters.
+*
+* Argument(s) : p_stat      Pointer to the target's stats.
+*
+* Return(s)   : DEF_OK,   if no error, failed assert or leaked netbuf was counted.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : QCABench_RxChain(),
+*               QCABench_RxNotArrived(),
+*               QCABench_TxCredits().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  QCABench_HCD_StatOK (QCA_BENCH_HCD_STAT  *p_stat)
+{
+    CPU_BOOLEAN  ok;
+
+
+    ok = ((p_stat->RxRdErrCtr   == 0u) &&
+          (p_stat->RxDataErrCtr == 0u) &&
+          (p_stat->TxErrCtr     == 0u) &&
+          (p_stat->AssertCtr    == 0u) &&
+          (p_stat->BufNbrUsed   == 0u)) ? DEF_OK : DEF_FAIL;
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABench_HCD_Print()
+*
+* Description : Print a mock target test's result & the target's counters.
+*
+* Argument(s) : p_name      Test name.
+*
+*               ok          DEF_OK, if the test passed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : QCABench_RxChain(),
+*               QCABench_RxNotArrived(),
+*               QCABench_TxCredits().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  QCABench_HCD_Print (const  CPU_CHAR     *p_name,
+                                         CPU_BOOLEAN   ok)
+{
+    QCA_BENCH_HCD_STAT  stat;
+
+
+    QCABenchHCD_StatGet(&stat);
+
+    printf("%s\n    {\"test\": \"%s\", \"ok\": %s, \"passes\": %u, \"lookahead_rds\": %u, \"reg_rds\": %u,\n"
+           "     \"rx_frames\": %u, \"rx_delivered\": %u, \"rx_rd_errs\": %u, \"rx_data_errs\": %u,\n"
+           "     \"tx_frames\": %u, \"tx_done\": %u, \"tx_errs\": %u, \"tx_per_pass_max\": %u,\n"
+           "     \"watermarks\": %u, \"asserts\": %u, \"assert_line\": %u, \"bufs_leaked\": %u}",
+           (QCABench_First == DEF_YES) ? "" : ",",
+           p_name,
+           (ok == DEF_OK) ? "true" : "false",
+           (unsigned)stat.PassCtr,
+           (unsigned)stat.LookAheadRdCtr,
+           (unsigned)stat.RegRdCtr,
+           (unsigned)stat.RxFrameCtr,
+           (unsigned)stat.RxDeliverCtr,
+           (unsigned)stat.RxRdErrCtr,
+           (unsigned)stat.RxDataErrCtr,
+           (unsigned)stat.TxFrameCtr,
+           (unsigned)stat.TxDoneCtr,
+           (unsigned)stat.TxErrCtr,
+           (unsigned)stat.TxPassMax,
+           (unsigned)stat.WaterMarkCtr,
+           (unsigned)stat.AssertCtr,
+           (unsigned)stat.AssertLine,
+           (unsigned)stat.BufNbrUsed);
+    QCABench_First = DEF_NO;
+    if (ok != DEF_OK) {
+        QCABench_Rtn = 1;
+    }
+}
@@ -0,0 +1,1657 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     QCA400x DRIVER HOST BENCH
+*
+*                                    MOCK TARGET & HOST CONTROLLER
+*
+* Filename : qca_bench_hcd.c
+* Version  : V3.04.00
+*
+* Note(s)  : (1) See 'qca_bench_hcd.h  Note #1'.  The functions below replace, for the driver objects
+*                linked in the bench :
+*
+*                (a) The HCD ('spi_hcd.c')   : Hcd_...().
+*                (b) The custom layer        : Custom_...(), Api_Rx/TxComplete(), a_netbuf_...(),
+*                                              a_mutex_...() & assert_func().
+*
+*            (2) The target model is driven by the driver's own calls only; the bench never updates
+*                the driver context but through HTC_Start() & Driver_SubmitTxRequest().
+*
+*            (3) Netbufs are taken from the host heap : a netbuf & its buffer are one allocation, so
+*                that any netbuf not freed by the driver is counted.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#define    QCA_BENCH_HCD_MODULE
+#include  <stdlib.h>
+#include  <lib_mem.h>
+#include  <a_config.h>
+#include  <a_types.h>
+#include  <a_osapi.h>
+#include  <driver_cxt.h>
+#include  <common_api.h>
+#include  <custom_api.h>
+#include  <netbuf.h>
+#include  <htc.h>
+#include  <targaddrs.h>
+#include  <spi_hcd_if.h>
+#include  <hif_internal.h>
+#include  <atheros_wifi_api.h>
+#include  <atheros_wifi_internal.h>
+#include  "qca_bench_hcd.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  QCA_BENCH_HCD_TRAILER_CREDIT_LEN       (sizeof(HTC_RECORD_HDR) + sizeof(HTC_CREDIT_REPORT))
+#define  QCA_BENCH_HCD_TRAILER_LOOKAHEAD_LEN    (sizeof(HTC_RECORD_HDR) + sizeof(HTC_LOOKAHEAD_REPORT))
+
+#define  QCA_BENCH_HCD_LOOKAHEAD_PRE_VALID              0x55u   /* Valid guards : pre == ~post.                         */
+#define  QCA_BENCH_HCD_LOOKAHEAD_POST_VALID             0xAAu
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  NET_IF                  QCABenchHCD_IF;
+static  NET_DEV_DATA            QCABenchHCD_DevData;
+static  A_DRIVER_CONTEXT        QCABenchHCD_DrvCxt;
+
+static  QCA_BENCH_HCD_RX_FRAME  QCABenchHCD_RxFrameTbl[QCA_BENCH_HCD_RX_FRAME_NBR_MAX];
+static  CPU_INT32U              QCABenchHCD_RxRdIx;             /* Ix of next frame to rd.                              */
+static  CPU_INT32U              QCABenchHCD_RxWrIx;             /* Ix of next frame to queue.                           */
+static  CPU_INT32U              QCABenchHCD_RxLastIx;           /* Ix of last frame rd, checked on delivery.            */
+
+static  CPU_INT32U              QCABenchHCD_TxSubmitCtr;        /* Nbr of frames queued, seeds the tx data.             */
+static  CPU_INT32U              QCABenchHCD_TxPassCtr;          /* Nbr of frames wr by the current pass.                */
+
+static  QCA_BENCH_HCD_STAT      QCABenchHCD_Stat;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U   QCABenchHCD_RxHdrGet      (CPU_INT32U   frame_ix,
+                                                CPU_INT08U  *p_hdr);
+
+static  CPU_INT32U   QCABenchHCD_RxBytesAvail  (void);
+
+static  void         QCABenchHCD_RxRd          (A_NETBUF    *p_req);
+
+static  void         QCABenchHCD_TxWr          (A_NETBUF    *p_req);
+
+static  A_NETBUF    *QCABenchHCD_BufGet        (CPU_INT16U   headroom,
+                                                CPU_INT16U   size,
+                                                NET_DEV_POOL_TYPE  pool_id);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         QCABenchHCD_Init()
+*
+* Description : (1) Initialize the driver context & the target :
+*
+*                   (a) Empty the target's frame FIFO & clear the stats
+*                   (b) Initialize the driver context as Driver_ContextInit() does
+*                   (c) Start HTC, which distributes the tx credits & unmasks the packet interrupt
+*
+*
+* Argument(s) : credit_cnt  Nbr of tx credits the target reports at init.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (2) Any netbuf still held by a previous run is leaked, as the driver would on target.
+*********************************************************************************************************
+*/
+
+void  QCABenchHCD_Init (CPU_INT16U  credit_cnt)
+{
+    A_DRIVER_CONTEXT  *p_dcxt;
+    CPU_INT08U         ep;
+
+
+                                                                /* ------------------ INIT TARGET --------------------- */
+    QCABenchHCD_RxRdIx      = 0u;
+    QCABenchHCD_RxWrIx      = 0u;
+    QCABenchHCD_RxLastIx    = 0u;
+    QCABenchHCD_TxSubmitCtr = 0u;
+    QCABenchHCD_TxPassCtr   = 0u;
+    Mem_Clr(&QCABenchHCD_RxFrameTbl[0], sizeof(QCABenchHCD_RxFrameTbl));
+    Mem_Clr(&QCABenchHCD_Stat,          sizeof(QCABenchHCD_Stat));
+
+                                                                /* ------------------ INIT DRV CXT -------------------- */
+    p_dcxt = &QCABenchHCD_DrvCxt;
+    Mem_Clr(p_dcxt,               sizeof(QCABenchHCD_DrvCxt));
+    Mem_Clr(&QCABenchHCD_DevData, sizeof(QCABenchHCD_DevData));
+    Mem_Clr(&QCABenchHCD_IF,      sizeof(QCABenchHCD_IF));
+    QCABenchHCD_DevData.CommonCxt = p_dcxt;
+    QCABenchHCD_IF.Dev_Data       = &QCABenchHCD_DevData;
+
+    p_dcxt->enabledSpiInts          = ATH_SPI_INTR_PKT_AVAIL | ATH_SPI_INTR_LOCAL_CPU_INTR;
+    p_dcxt->mboxAddress             = HIF_MBOX_START_ADDR(HIF_ACTIVE_MBOX_INDEX);
+    p_dcxt->blockSize               = HIF_MBOX_BLOCK_SIZE;
+    p_dcxt->blockMask               = p_dcxt->blockSize - 1u;
+    p_dcxt->creditCount             = credit_cnt;
+    p_dcxt->creditSize              = AR4100_BUFFER_SIZE;
+    p_dcxt->rxBufferStatus          = A_TRUE;
+    p_dcxt->hcd.MaxWriteBufferSpace = EXPECTED_MAX_WRITE_BUFFER_SPACE;
+    p_dcxt->hcd.WriteBufferSpace    = EXPECTED_MAX_WRITE_BUFFER_SPACE;
+    for (ep = 0u; ep < ENDPOINT_MANAGED_MAX; ep++) {
+        p_dcxt->ep[ep].epIdx = ep;
+    }
+    A_NETBUF_QUEUE_INIT(&p_dcxt->txQueue);
+
+                                                                /* -------------------- START HTC --------------------- */
+    if (HTC_Start(&QCABenchHCD_IF) != A_OK) {
+        QCABenchHCD_Stat.AssertCtr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchHCD_RxQueue()
+*
+* Description : Announce a frame to be read by the driver.
+*
+* Argument(s) : p_frame     Pointer to frame's description (see 'qca_bench_hcd.h  Note #3').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) A frame queued as arrived raises the packet interrupt, if unmasked.  Frames arrive in
+*                   order, so a frame queued as arrived after one that has not is held back until that
+*                   one arrives.
+*********************************************************************************************************
+*/
+
+void  QCABenchHCD_RxQueue (QCA_BENCH_HCD_RX_FRAME  *p_frame)
+{
+    CPU_BOOLEAN  arrived;
+
+
+    if (QCABenchHCD_RxWrIx >= QCA_BENCH_HCD_RX_FRAME_NBR_MAX) {
+        QCABenchHCD_Stat.RxRdErrCtr++;
+        return;
+    }
+
+    arrived = p_frame->Arrived;
+    QCABenchHCD_RxFrameTbl[QCABenchHCD_RxWrIx]         = *p_frame;
+    QCABenchHCD_RxFrameTbl[QCABenchHCD_RxWrIx].Arrived =  DEF_NO;
+    QCABenchHCD_RxWrIx++;
+
+    if (arrived == DEF_YES) {                                   /* See Note #1.                                         */
+        QCABenchHCD_RxArrive();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchHCD_RxArrive()
+*
+* Description : Make the next announced frame arrive in the target's read buffer & raise the packet
+*               interrupt, if unmasked.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               QCABenchHCD_RxQueue().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  QCABenchHCD_RxArrive (void)
+{
+    CPU_INT32U  ix;
+
+
+    for (ix = QCABenchHCD_RxRdIx; ix < QCABenchHCD_RxWrIx; ix++) {
+        if (QCABenchHCD_RxFrameTbl[ix].Arrived == DEF_NO) {
+            QCABenchHCD_RxFrameTbl[ix].Arrived = DEF_YES;
+            break;
+        }
+    }
+
+    if (DEF_BIT_IS_SET(QCABenchHCD_DrvCxt.hcd.SpiIntEnableShadow, ATH_SPI_INTR_PKT_AVAIL) == DEF_YES) {
+        QCABenchHCD_DrvCxt.hcd.IrqDetected = A_TRUE;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       QCABenchHCD_RxPending()
+*
+* Description : Get the number of frames announced but not read yet by the driver.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Number of frames.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  QCABenchHCD_RxPending (void)
+{
+    return (QCABenchHCD_RxWrIx - QCABenchHCD_RxRdIx);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchHCD_TxSubmit()
+*
+* Description : Queue a frame to be written by the driver, as the network stack does.
+*
+* Argument(s) : ep          Endpoint to send the frame on.
+*
+*               data_len    Len of data to send.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Data octet i of the n-th frame queued is (n * 7 + i); QCABenchHCD_TxWr() checks it to
+*                   catch frames written out of order.
+*********************************************************************************************************
+*/
+
+void  QCABenchHCD_TxSubmit (CPU_INT08U  ep,
+                            CPU_INT16U  data_len)
+{
+    A_NETBUF    *p_req;
+    CPU_INT08U  *p_data;
+    CPU_INT16U   ix;
+
+
+    p_req = QCABenchHCD_BufGet(HTC_HDR_LENGTH, HTC_HDR_LENGTH + data_len, A_TX_NET_POOL);
+    if (p_req == DEF_NULL) {
+        QCABenchHCD_Stat.TxErrCtr++;
+        return;
+    }
+
+    A_NETBUF_PUT(p_req, data_len);
+    p_data = (CPU_INT08U *)A_NETBUF_DATA(p_req);
+    for (ix = 0u; ix < data_len; ix++) {                        /* See Note #1.                                         */
+        p_data[ix] = (CPU_INT08U)(QCABenchHCD_TxSubmitCtr * 7u + ix);
+    }
+    QCABenchHCD_TxSubmitCtr++;
+
+    A_NETBUF_SET_ELEM(p_req, A_REQ_EPID, ep);
+    if (Driver_SubmitTxRequest(&QCABenchHCD_IF, p_req) != A_OK) {
+        QCABenchHCD_Stat.TxErrCtr++;
+        A_NETBUF_FREE(p_req);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       QCABenchHCD_CreditsGet()
+*
+* Description : Get the number of tx credits the driver holds for an endpoint.
+*
+* Argument(s) : ep          Endpoint.
+*
+* Return(s)   : Number of credits.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  QCABenchHCD_CreditsGet (CPU_INT08U  ep)
+{
+    return (Util_GetEndpoint(&QCABenchHCD_IF, ep)->credits);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          QCABenchHCD_Run()
+*
+* Description : Run the driver task's loop until the driver reports it may block.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Number of Driver_Main() passes.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The loop is bounded so that a driver that never settles fails the run rather than
+*                   hanging the bench; such a run is reported as a failed assert.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  QCABenchHCD_Run (void)
+{
+    A_BOOL      can_block;
+    A_UINT16    block_ms;
+    CPU_INT32U  pass_cnt;
+
+
+    can_block = A_FALSE;
+    pass_cnt  = 0u;
+    while ((can_block == A_FALSE) &&
+           (pass_cnt  <  QCA_BENCH_HCD_PASS_NBR_MAX)) {
+        QCABenchHCD_TxPassCtr = 0u;
+        block_ms              = 0u;
+        Driver_Main(&QCABenchHCD_IF, DRIVER_SCOPE_RX | DRIVER_SCOPE_TX, &can_block, &block_ms);
+        pass_cnt++;
+    }
+
+    if (can_block == A_FALSE) {                                 /* See Note #1.                                         */
+        QCABenchHCD_Stat.AssertCtr++;
+    }
+
+    QCABenchHCD_Stat.PassCtr += pass_cnt;
+
+    return (pass_cnt);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchHCD_StatGet()
+*
+* Description : Get the target's statistics.
+*
+* Argument(s) : p_stat      Pointer to variable that will receive the statistics.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  QCABenchHCD_StatGet (QCA_BENCH_HCD_STAT  *p_stat)
+{
+   *p_stat = QCABenchHCD_Stat;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                     HOST CONTROLLER (HCD) MOCK
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          Hcd_SpiInterrupt()
+*
+* Description : Identify the target's interrupt : mask the packet interrupt until the driver has read
+*               every arrived frame, as the HCD does.
+*
+* Argument(s) : pCxt        Driver context.
+*
+* Return(s)   : A_TRUE.
+*
+* Caller(s)   : Driver_Main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_BOOL  Hcd_SpiInterrupt (A_VOID  *pCxt)
+{
+    A_DRIVER_CONTEXT  *p_dcxt;
+
+
+    p_dcxt = GET_DRIVER_COMMON(pCxt);
+    QCABenchHCD_Stat.RegRdCtr++;                                /* Intr cause reg.                                      */
+    if ((DEF_BIT_IS_SET(p_dcxt->hcd.SpiIntEnableShadow, ATH_SPI_INTR_PKT_AVAIL) == DEF_YES) &&
+        (QCABenchHCD_RxBytesAvail() > 0u)) {
+        DEF_BIT_CLR(p_dcxt->hcd.SpiIntEnableShadow, ATH_SPI_INTR_PKT_AVAIL);
+        p_dcxt->hcd.PendingIrqAcks = DEF_BIT_01;
+    }
+
+    return (A_TRUE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Hcd_UnmaskSPIInterrupts()
+*
+* Description : Unmask target interrupts; the packet interrupt is raised again at once if frames are
+*               still held in the read buffer.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               Mask        Interrupts to unmask.
+*
+* Return(s)   : A_OK.
+*
+* Caller(s)   : HTC_Start(),
+*               Driver_RxReady(),
+*               Driver_CompleteRequest().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_STATUS  Hcd_UnmaskSPIInterrupts (A_VOID    *pCxt,
+                                   A_UINT16   Mask)
+{
+    A_DRIVER_CONTEXT  *p_dcxt;
+
+
+    p_dcxt = GET_DRIVER_COMMON(pCxt);
+    DEF_BIT_SET(p_dcxt->hcd.SpiIntEnableShadow, Mask);
+    if ((DEF_BIT_IS_SET(Mask, ATH_SPI_INTR_PKT_AVAIL) == DEF_YES) &&
+        (QCABenchHCD_RxBytesAvail() > 0u)) {
+        p_dcxt->hcd.IrqDetected = A_TRUE;
+    }
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Hcd_GetLookAhead()
+*
+* Description : Read the read buffer space & the lookahead of the frame at its head from the target's
+*               registers, as the HCD does.
+*
+* Argument(s) : pCxt        Driver context.
+*
+* Return(s)   : A_OK.
+*
+* Caller(s)   : Driver_RxReady().
+*
+* Note(s)     : (1) As on target, the lookahead is left untouched if less than a lookahead is buffered.
+*********************************************************************************************************
+*/
+
+A_STATUS  Hcd_GetLookAhead (A_VOID  *pCxt)
+{
+    A_DRIVER_CONTEXT  *p_dcxt;
+    CPU_INT08U         hdr[HTC_HDR_LENGTH];
+
+
+    p_dcxt = GET_DRIVER_COMMON(pCxt);
+    QCABenchHCD_Stat.LookAheadRdCtr++;
+    QCABenchHCD_Stat.RegRdCtr++;                                /* Rd buf bytes avail reg.                              */
+
+    p_dcxt->hcd.ReadBufferSpace = QCABenchHCD_RxBytesAvail();
+    if (p_dcxt->hcd.ReadBufferSpace < sizeof(A_UINT32)) {       /* See Note #1.                                         */
+        return (A_OK);
+    }
+
+    QCABenchHCD_Stat.RegRdCtr += 2u;                            /* Lookahead regs.                                      */
+   (void)QCABenchHCD_RxHdrGet(QCABenchHCD_RxRdIx, &hdr[0]);
+    Mem_Copy(&p_dcxt->lookAhead, &hdr[0], sizeof(p_dcxt->lookAhead));
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Hcd_DoPioInternalAccess()
+*
+* Description : Read or write a target register.  Only the interrupt cause register reads back anything :
+*               the packet interrupt while frames are held in the read buffer.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               addr        Register addr.
+*
+*               pValue      Pointer to value to write, or to variable that will receive the value read.
+*
+*               isRead      A_TRUE to read the register, A_FALSE to write it.
+*
+* Return(s)   : A_OK.
+*
+* Caller(s)   : Driver_RxReady().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_STATUS  Hcd_DoPioInternalAccess (A_VOID    *pCxt,
+                                   A_UINT16   addr,
+                                   A_UINT32  *pValue,
+                                   A_BOOL     isRead)
+{
+    UNUSED_ARGUMENT(pCxt);
+
+    if (isRead == A_FALSE) {
+        return (A_OK);
+    }
+
+    QCABenchHCD_Stat.RegRdCtr++;
+   *pValue = 0u;
+    if ((addr == ATH_SPI_INTR_CAUSE_REG) &&
+        (QCABenchHCD_RxBytesAvail() > 0u)) {
+       *pValue = ATH_SPI_INTR_PKT_AVAIL;
+    }
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Hcd_DoPioExternalAccess()
+*
+* Description : Read or write a target memory location; reads back 0.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               pReq        Transfer request.
+*
+* Return(s)   : A_OK.
+*
+* Caller(s)   : Htc_ReadCreditCounter().
+*
+* Note(s)     : (1) Only reached once the target has signalled its credit counters, which it never
+*                   does in the bench.
+*********************************************************************************************************
+*/
+
+A_STATUS  Hcd_DoPioExternalAccess (A_VOID  *pCxt,
+                                   A_VOID  *pReq)
+{
+    UNUSED_ARGUMENT(pCxt);
+
+    Mem_Clr(A_NETBUF_DATA(pReq), A_NETBUF_LEN(pReq));
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Hcd_GetMboxAddress()
+*
+* Description : Get the mailbox address to transfer a frame at, as the HCD does.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               mbox        Mailbox.
+*
+*               length      Transfer len.
+*
+* Return(s)   : Mailbox address.
+*
+* Caller(s)   : Driver_RecvPacket(),
+*               Driver_SendPacket().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_UINT32  Hcd_GetMboxAddress (A_VOID    *pCxt,
+                              A_UINT16   mbox,
+                              A_UINT32   length)
+{
+    A_ASSERT(mbox == 0u);
+
+    return (GET_DRIVER_COMMON(pCxt)->mboxAddress + HIF_MBOX_WIDTH - length);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Hcd_Request()
+*
+* Description : Transfer a frame to or from the target's mailbox.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               pReq        Transfer request.
+*
+* Return(s)   : A_OK, the transfer completes at once.
+*
+* Caller(s)   : Driver_RecvPacket(),
+*               Driver_SendPacket().
+*
+* Note(s)     : (1) The write buffer space is consumed as by the HCD's ADJUST_WRBUF_SPACE().
+*********************************************************************************************************
+*/
+
+A_STATUS  Hcd_Request (A_VOID  *pCxt,
+                       A_VOID  *pReq)
+{
+    A_DRIVER_CONTEXT  *p_dcxt;
+    A_UINT16           trans_len;
+
+
+    p_dcxt    = GET_DRIVER_COMMON(pCxt);
+    trans_len = A_NETBUF_GET_ELEM(pReq, A_REQ_TRANSFER_LEN);
+
+    if (DEF_BIT_IS_SET(A_NETBUF_GET_ELEM(pReq, A_REQ_COMMAND), ATH_TRANS_READ) == DEF_YES) {
+        QCABenchHCD_RxRd((A_NETBUF *)pReq);
+    } else {
+        QCABenchHCD_TxWr((A_NETBUF *)pReq);
+        p_dcxt->hcd.WriteBufferSpace -= trans_len + ATH_SPI_WRBUF_RSVD_BYTES;   /* See Note #1.                 */
+    }
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    Hcd_RefreshWriteBufferSpace()
+*
+* Description : Read the write buffer space : the target drains its write buffer at once.
+*
+* Argument(s) : pCxt        Driver context.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Driver_TxReady().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  Hcd_RefreshWriteBufferSpace (A_VOID  *pCxt)
+{
+    A_DRIVER_CONTEXT  *p_dcxt;
+
+
+    p_dcxt = GET_DRIVER_COMMON(pCxt);
+    QCABenchHCD_Stat.RegRdCtr++;
+    p_dcxt->hcd.WriteBufferSpace = p_dcxt->hcd.MaxWriteBufferSpace;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  Hcd_ProgramWriteBufferWaterMark()
+*
+* Description : Program the write buffer watermark interrupt; counted only.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               length      Write buffer space to wait for.
+*
+* Return(s)   : A_OK.
+*
+* Caller(s)   : Driver_TxReady().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_STATUS  Hcd_ProgramWriteBufferWaterMark (A_VOID    *pCxt,
+                                           A_UINT32   length)
+{
+    UNUSED_ARGUMENT(pCxt);
+    UNUSED_ARGUMENT(length);
+
+    QCABenchHCD_Stat.WaterMarkCtr++;
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Hcd_ReadCPUInterrupt()
+*                                        Hcd_ClearCPUInterrupt()
+*
+* Description : Read & clear the target's CPU interrupt, which the target never raises in the bench.
+*
+* Argument(s) : pCxt            Driver context.
+*
+*               cpuIntrCause    Pointer to variable that will receive the interrupt cause.
+*
+* Return(s)   : Hcd_ReadCPUInterrupt() : A_FALSE.
+*
+* Caller(s)   : Driver_Main().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_BOOL  Hcd_ReadCPUInterrupt (A_VOID   *pCxt,
+                              A_UINT8  *cpuIntrCause)
+{
+    UNUSED_ARGUMENT(pCxt);
+
+   *cpuIntrCause = 0u;
+
+    return (A_FALSE);
+}
+
+
+A_VOID  Hcd_ClearCPUInterrupt (A_VOID  *pCxt)
+{
+    UNUSED_ARGUMENT(pCxt);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         CUSTOM LAYER MOCK
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        Custom_GetRxRequest()
+*
+* Description : Get a receive request exactly the size of the frame to read, so that the driver
+*               writing past the frame's padded length is caught.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               length      Padded len of frame to read.
+*
+* Return(s)   : Pointer to request, if available.
+*
+*               DEF_NULL,           otherwise.
+*
+* Caller(s)   : Driver_RxReady().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  *Custom_GetRxRequest (A_VOID    *pCxt,
+                              A_UINT16   length)
+{
+    UNUSED_ARGUMENT(pCxt);
+
+    return (QCABenchHCD_BufGet(0u, length, A_RX_NET_POOL));
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Custom_Driver_WakeDriver()
+*
+* Description : Wake the driver task; the bench runs the driver from QCABenchHCD_Run() instead.
+*
+* Argument(s) : pCxt        Driver context.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Driver_SubmitTxRequest().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  Custom_Driver_WakeDriver (A_VOID  *pCxt)
+{
+    UNUSED_ARGUMENT(pCxt);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Api_RxComplete()
+*
+* Description : Check a data frame delivered by the driver against the last frame read, then free it.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               pReq        Receive request, w/ the HTC hdr & trailer removed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Driver_RxComplete().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  Api_RxComplete (A_VOID  *pCxt,
+                        A_VOID  *pReq)
+{
+    QCA_BENCH_HCD_RX_FRAME  *p_frame;
+    CPU_INT08U              *p_data;
+    CPU_INT16U               ix;
+    CPU_BOOLEAN              ok;
+
+
+    UNUSED_ARGUMENT(pCxt);
+
+    p_frame = &QCABenchHCD_RxFrameTbl[QCABenchHCD_RxLastIx];
+    p_data  = (CPU_INT08U *)A_NETBUF_DATA(pReq);
+    ok      = ((A_NETBUF_LEN(pReq)                   == p_frame->DataLen) &&
+               (A_NETBUF_GET_ELEM(pReq, A_REQ_EPID) == p_frame->EP)) ? DEF_YES : DEF_NO;
+    for (ix = 0u; (ok == DEF_YES) && (ix < p_frame->DataLen); ix++) {
+        if (p_data[ix] != (CPU_INT08U)(QCABenchHCD_RxLastIx * 7u + ix)) {
+            ok = DEF_NO;
+        }
+    }
+
+    if (ok == DEF_YES) {
+        QCABenchHCD_Stat.RxDeliverCtr++;
+    } else {
+        QCABenchHCD_Stat.RxDataErrCtr++;
+    }
+
+    A_NETBUF_FREE(pReq);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Api_TxComplete()
+*
+* Description : Count & free a completed transmit request.
+*
+* Argument(s) : pCxt        Driver context.
+*
+*               pReq        Transmit request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Driver_TxComplete().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  Api_TxComplete (A_VOID  *pCxt,
+                        A_VOID  *pReq)
+{
+    UNUSED_ARGUMENT(pCxt);
+
+    QCABenchHCD_Stat.TxDoneCtr++;
+    A_NETBUF_FREE(pReq);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            assert_func()
+*
+* Description : Count a failed driver assert; the driver carries on, as with asserts disabled.
+*
+* Argument(s) : line        Line of the failed assert.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : A_ASSERT().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  assert_func (A_UINT32  line)
+{
+    QCABenchHCD_Stat.AssertCtr++;
+    QCABenchHCD_Stat.AssertLine = line;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           a_mutex_init()
+*                                           a_mutex_lock()
+*                                          a_mutex_unlock()
+*                                          a_mutex_destroy()
+*
+* Description : Driver locks; the bench runs the driver & its callers from a single thread.
+*
+* Argument(s) : mutex       Pointer to lock.
+*
+* Return(s)   : A_OK.
+*
+* Caller(s)   : TXQUEUE_ACCESS_ACQUIRE(), TXQUEUE_ACCESS_RELEASE().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_STATUS  a_mutex_init (KAL_LOCK_HANDLE  *mutex)
+{
+    UNUSED_ARGUMENT(mutex);
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_mutex_lock (KAL_LOCK_HANDLE  *mutex)
+{
+    UNUSED_ARGUMENT(mutex);
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_mutex_unlock (KAL_LOCK_HANDLE  *mutex)
+{
+    UNUSED_ARGUMENT(mutex);
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_mutex_destroy (KAL_LOCK_HANDLE  *mutex)
+{
+    UNUSED_ARGUMENT(mutex);
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           ath_custom_htc
+*
+* Note(s) : (1) No HTC setup exchange with the target : HTC_Start() only distributes the credits.
+*********************************************************************************************************
+*/
+
+ATH_CUSTOM_HTC_T  ath_custom_htc = {
+    DEF_NULL,
+    DEF_NULL,
+    DEF_NULL
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          NETBUF HOST PORT
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        a_netbuf_configure()
+*
+* Description : (Re-)configure a netbuf on a buffer, as 'cust_driver_netbuf.c' does.
+*
+* Argument(s) : buffptr     Pointer to netbuf.
+*
+*               buffer      Pointer to buffer.
+*
+*               headroom    Len of headroom.
+*
+*               length      Len of data.
+*
+*               size        Size of buffer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Htc_ReadCreditCounter(),
+*               QCABenchHCD_BufGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  a_netbuf_configure (A_VOID    *buffptr,
+                            A_VOID    *buffer,
+                            A_UINT16   headroom,
+                            A_UINT16   length,
+                            A_UINT16   size)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)buffptr;
+    Mem_Clr(p_buf, sizeof(A_NETBUF));
+    if (buffer != DEF_NULL) {
+        p_buf->head = (A_UINT8 *)buffer;
+        p_buf->data = &p_buf->head[headroom];
+        p_buf->tail = &p_buf->head[headroom + length];
+        p_buf->end  = &p_buf->head[size];
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          a_netbuf_alloc()
+*                                        a_netbuf_alloc_raw()
+*
+* Description : Allocate a netbuf w/ a buffer of the given size.
+*
+* Argument(s) : size        Size of buffer.
+*
+* Return(s)   : Pointer to netbuf, if available.
+*
+*               DEF_NULL,          otherwise.
+*
+* Caller(s)   : Driver.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  *a_netbuf_alloc (A_INT32  size)
+{
+    return (QCABenchHCD_BufGet(0u, (CPU_INT16U)size, A_WMI_POOL));
+}
+
+
+A_VOID  *a_netbuf_alloc_raw (A_INT32  size)
+{
+    return (QCABenchHCD_BufGet(0u, (CPU_INT16U)size, A_WMI_POOL));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           a_netbuf_free()
+*
+* Description : Free a netbuf & its buffer.
+*
+* Argument(s) : buffptr     Pointer to netbuf.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Driver,
+*               Api_RxComplete(),
+*               Api_TxComplete().
+*
+* Note(s)     : (1) The buffer follows the netbuf (see Note #3).
+*********************************************************************************************************
+*/
+
+A_VOID  a_netbuf_free (A_VOID  *buffptr)
+{
+    if (QCABenchHCD_Stat.BufNbrUsed == 0u) {                    /* Freed twice.                                         */
+        QCABenchHCD_Stat.AssertCtr++;
+        return;
+    }
+
+    QCABenchHCD_Stat.BufNbrUsed--;
+    free(buffptr);                                              /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         a_netbuf_to_data()
+*                                          a_netbuf_to_len()
+*                                        a_netbuf_headroom()
+*                                        a_netbuf_tailroom()
+*
+* Description : Get a netbuf's data, data len (incl fragments), headroom or tailroom.
+*
+* Argument(s) : bufPtr      Pointer to netbuf.
+*
+* Return(s)   : Data pointer or len.
+*
+* Caller(s)   : Driver.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  *a_netbuf_to_data (A_VOID  *bufPtr)
+{
+    return (((A_NETBUF *)bufPtr)->data);
+}
+
+
+A_UINT32  a_netbuf_to_len (A_VOID  *bufPtr)
+{
+    A_NETBUF  *p_buf;
+    A_UINT32   len;
+    A_UINT8    ix;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    len   = (A_UINT32)(p_buf->tail - p_buf->data);
+    for (ix = 0u; ix < p_buf->frag_nbr; ix++) {
+        len += (A_UINT32)p_buf->frag[ix].len;
+    }
+
+    return (len);
+}
+
+
+A_INT32  a_netbuf_headroom (A_VOID  *bufPtr)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+
+    return ((A_INT32)(p_buf->data - p_buf->head));
+}
+
+
+A_INT32  a_netbuf_tailroom (A_VOID  *bufPtr)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+
+    return ((A_INT32)(p_buf->end - p_buf->tail));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           a_netbuf_push()
+*                                         a_netbuf_push_data()
+*                                           a_netbuf_put()
+*                                         a_netbuf_put_data()
+*                                           a_netbuf_pull()
+*                                           a_netbuf_trim()
+*
+* Description : Add or remove octets at the start or end of a netbuf's data; an overflow fails an assert.
+*
+* Argument(s) : bufPtr      Pointer to netbuf.
+*
+*               srcPtr      Pointer to data to copy in (_data() variants only).
+*
+*               len         Nbr of octets.
+*
+* Return(s)   : A_OK,    if octets added or removed.
+*
+*               A_ERROR, otherwise.
+*
+* Caller(s)   : Driver.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_STATUS  a_netbuf_push (A_VOID   *bufPtr,
+                         A_INT32   len)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    if (p_buf->data - p_buf->head < len) {
+        A_ASSERT(0);
+        return (A_ERROR);
+    }
+    p_buf->data -= len;
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_netbuf_push_data (A_VOID   *bufPtr,
+                              A_UINT8  *srcPtr,
+                              A_INT32   len)
+{
+    if (a_netbuf_push(bufPtr, len) != A_OK) {
+        return (A_ERROR);
+    }
+    Mem_Copy(((A_NETBUF *)bufPtr)->data, srcPtr, (CPU_SIZE_T)len);
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_netbuf_put (A_VOID   *bufPtr,
+                        A_INT32   len)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    if (p_buf->end - p_buf->tail < len) {
+        A_ASSERT(0);
+        return (A_ERROR);
+    }
+    p_buf->tail += len;
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_netbuf_put_data (A_VOID   *bufPtr,
+                             A_UINT8  *srcPtr,
+                             A_INT32   len)
+{
+    A_UINT8  *p_tail;
+
+
+    p_tail = ((A_NETBUF *)bufPtr)->tail;
+    if (a_netbuf_put(bufPtr, len) != A_OK) {
+        return (A_ERROR);
+    }
+    Mem_Copy(p_tail, srcPtr, (CPU_SIZE_T)len);
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_netbuf_pull (A_VOID   *bufPtr,
+                         A_INT32   len)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    if (p_buf->tail - p_buf->data < len) {
+        A_ASSERT(0);
+        return (A_ERROR);
+    }
+    p_buf->data += len;
+
+    return (A_OK);
+}
+
+
+A_STATUS  a_netbuf_trim (A_VOID   *bufPtr,
+                         A_INT32   len)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    if (p_buf->tail - p_buf->data < len) {
+        A_ASSERT(0);
+        return (A_ERROR);
+    }
+    p_buf->tail -= len;
+
+    return (A_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       a_netbuf_get_fragment()
+*                                     a_netbuf_append_fragment()
+*
+* Description : Get a netbuf's fragment, or append one, as 'cust_driver_netbuf.c' does.
+*
+* Argument(s) : bufPtr      Pointer to netbuf.
+*
+*               index       Fragment ix; 0 is the contiguous data.
+*
+*               pLen        Pointer to variable that will receive the fragment's len.
+*
+*               frag        Pointer to fragment to append.
+*
+*               len         Len of fragment to append.
+*
+* Return(s)   : a_netbuf_get_fragment() : pointer to fragment, if any; DEF_NULL, otherwise.
+*
+* Caller(s)   : Driver.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+A_VOID  *a_netbuf_get_fragment (A_VOID   *bufPtr,
+                                A_UINT8   index,
+                                A_INT32  *pLen)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    if (index == 0u) {
+       *pLen = (A_INT32)(p_buf->tail - p_buf->data);
+        return (p_buf->data);
+    }
+    if (index <= p_buf->frag_nbr) {
+       *pLen = p_buf->frag[index - 1u].len;
+        return (p_buf->frag[index - 1u].data);
+    }
+
+    return (DEF_NULL);
+}
+
+
+A_VOID  a_netbuf_append_fragment (A_VOID   *bufPtr,
+                                  A_UINT8  *frag,
+                                  A_INT32   len)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)bufPtr;
+    if (p_buf->frag_nbr >= A_NETBUF_FRAG_NBR_MAX) {
+        A_ASSERT(0);
+        return;
+    }
+    p_buf->frag[p_buf->frag_nbr].data = frag;
+    p_buf->frag[p_buf->frag_nbr].len  = len;
+    p_buf->frag_nbr++;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       QCABenchHCD_RxHdrGet()
+*
+* Description : Build a frame's HTC header.
+*
+* Argument(s) : frame_ix    Ix of frame.
+*
+*               p_hdr       Pointer to buffer that will receive the header.
+*
+* Return(s)   : Len of trailer.
+*
+* Caller(s)   : Hcd_GetLookAhead(),
+*               QCABenchHCD_RxBytesAvail(),
+*               QCABenchHCD_RxRd().
+*
+* Note(s)     : (1) See 'qca_bench_hcd.h  Note #3'.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  QCABenchHCD_RxHdrGet (CPU_INT32U   frame_ix,
+                                          CPU_INT08U  *p_hdr)
+{
+    QCA_BENCH_HCD_RX_FRAME  *p_frame;
+    CPU_INT16U               trailer_len;
+    CPU_INT16U               payload_len;
+
+
+    p_frame     = &QCABenchHCD_RxFrameTbl[frame_ix];
+    trailer_len = 0u;
+    if (p_frame->Credits > 0u) {
+        trailer_len += QCA_BENCH_HCD_TRAILER_CREDIT_LEN;
+    }
+    if (p_frame->LookAheadEn == DEF_YES) {
+        trailer_len += QCA_BENCH_HCD_TRAILER_LOOKAHEAD_LEN;
+    }
+    payload_len = p_frame->DataLen + trailer_len;
+
+    p_hdr[0] = p_frame->EP;
+    p_hdr[1] = (trailer_len > 0u) ? HTC_FLAGS_RECV_TRAILER : 0u;
+    p_hdr[2] = (CPU_INT08U)(payload_len & 0xFFu);
+    p_hdr[3] = (CPU_INT08U)(payload_len >> 8u);
+    p_hdr[4] = (CPU_INT08U)trailer_len;
+    p_hdr[5] = (CPU_INT08U)frame_ix;
+
+    return (trailer_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     QCABenchHCD_RxBytesAvail()
+*
+* Description : Get the number of octets held in the target's read buffer : the padded len of every
+*               arrived frame not read yet.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Number of octets.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  QCABenchHCD_RxBytesAvail (void)
+{
+    CPU_INT08U  hdr[HTC_HDR_LENGTH];
+    CPU_INT32U  bytes;
+    CPU_INT32U  ix;
+    CPU_INT16U  payload_len;
+
+
+    bytes = 0u;
+    for (ix = QCABenchHCD_RxRdIx; ix < QCABenchHCD_RxWrIx; ix++) {
+        if (QCABenchHCD_RxFrameTbl[ix].Arrived == DEF_NO) {
+            break;
+        }
+       (void)QCABenchHCD_RxHdrGet(ix, &hdr[0]);
+        payload_len = (CPU_INT16U)(hdr[2] | (hdr[3] << 8u));
+        bytes      += DEV_CALC_RECV_PADDED_LEN(&QCABenchHCD_DrvCxt, payload_len + HTC_HDR_LENGTH);
+    }
+
+    return (bytes);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         QCABenchHCD_RxRd()
+*
+* Description : Read the frame at the head of the target's read buffer into a receive request.
+*
+* Argument(s) : p_req       Receive request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Hcd_Request().
+*
+* Note(s)     : (1) A read that does not match an arrived frame (none arrived, wrong len or lookahead)
+*                   is counted; the request is zeroed, which fails the driver's header check.
+*
+*               (2) The lookahead record carries the next frame's header whether it has arrived or not,
+*                   as the target does for a frame it has queued.
+*********************************************************************************************************
+*/
+
+static  void  QCABenchHCD_RxRd (A_NETBUF  *p_req)
+{
+    QCA_BENCH_HCD_RX_FRAME  *p_frame;
+    CPU_INT08U              *p_data;
+    CPU_INT08U               hdr[HTC_HDR_LENGTH];
+    CPU_INT16U               trailer_len;
+    CPU_INT16U               trans_len;
+    CPU_INT16U               ix;
+    A_UINT32                 look_ahead;
+
+
+    p_data    = (CPU_INT08U *)A_NETBUF_DATA(p_req);
+    trans_len = A_NETBUF_GET_ELEM(p_req, A_REQ_TRANSFER_LEN);
+    Mem_Clr(p_data, A_NETBUF_LEN(p_req));
+    QCABenchHCD_Stat.RxFrameCtr++;
+
+    if ((QCABenchHCD_RxRdIx >= QCABenchHCD_RxWrIx) ||           /* See Note #1.                                         */
+        (QCABenchHCD_RxFrameTbl[QCABenchHCD_RxRdIx].Arrived == DEF_NO)) {
+        QCABenchHCD_Stat.RxRdErrCtr++;
+        return;
+    }
+
+    p_frame     = &QCABenchHCD_RxFrameTbl[QCABenchHCD_RxRdIx];
+    trailer_len =  QCABenchHCD_RxHdrGet(QCABenchHCD_RxRdIx, &hdr[0]);
+    Mem_Copy(&look_ahead, &hdr[0], sizeof(look_ahead));
+    if ((look_ahead != A_NETBUF_GET_ELEM(p_req, A_REQ_LOOKAHEAD)) ||
+        (trans_len  != A_NETBUF_LEN(p_req)) ||
+        (trans_len  != DEV_CALC_RECV_PADDED_LEN(&QCABenchHCD_DrvCxt, HTC_HDR_LENGTH + p_frame->DataLen + trailer_len))) {
+        QCABenchHCD_Stat.RxRdErrCtr++;
+        return;
+    }
+
+                                                                /* ---------------------- HDR ------------------------- */
+    Mem_Copy(p_data, &hdr[0], HTC_HDR_LENGTH);
+    p_data += HTC_HDR_LENGTH;
+                                                                /* ---------------------- DATA ------------------------ */
+    for (ix = 0u; ix < p_frame->DataLen; ix++) {
+        p_data[ix] = (CPU_INT08U)(QCABenchHCD_RxRdIx * 7u + ix);
+    }
+    p_data += p_frame->DataLen;
+                                                                /* -------------------- TRAILER ----------------------- */
+    if (p_frame->Credits > 0u) {
+        p_data[0] = HTC_RECORD_CREDITS;
+        p_data[1] = sizeof(HTC_CREDIT_REPORT);
+        p_data[2] = p_frame->CreditEP;
+        p_data[3] = p_frame->Credits;
+        p_data   += QCA_BENCH_HCD_TRAILER_CREDIT_LEN;
+    }
+    if (p_frame->LookAheadEn == DEF_YES) {                      /* See Note #2.                                         */
+        p_data[0] = HTC_RECORD_LOOKAHEAD;
+        p_data[1] = sizeof(HTC_LOOKAHEAD_REPORT);
+        if (QCABenchHCD_RxRdIx + 1u < QCABenchHCD_RxWrIx) {
+           (void)QCABenchHCD_RxHdrGet(QCABenchHCD_RxRdIx + 1u, &hdr[0]);
+            p_data[2] = QCA_BENCH_HCD_LOOKAHEAD_PRE_VALID;
+            Mem_Copy(&p_data[3], &hdr[0], sizeof(A_UINT32));
+            p_data[7] = QCA_BENCH_HCD_LOOKAHEAD_POST_VALID;
+        }                                                       /* Else guards left invalid (0 != ~0).                  */
+    }
+
+    QCABenchHCD_RxLastIx = QCABenchHCD_RxRdIx;
+    QCABenchHCD_RxRdIx++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         QCABenchHCD_TxWr()
+*
+* Description : Check a frame written to the target's mailbox.
+*
+* Argument(s) : p_req       Transmit request.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Hcd_Request().
+*
+* Note(s)     : (1) The n-th frame written MUST carry the n-th frame queued's data (see
+*                   'QCABenchHCD_TxSubmit()  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  QCABenchHCD_TxWr (A_NETBUF  *p_req)
+{
+    CPU_INT08U  *p_data;
+    CPU_INT32U   len;
+    CPU_INT16U   payload_len;
+    CPU_INT16U   ix;
+    CPU_BOOLEAN  ok;
+
+
+    p_data      = (CPU_INT08U *)A_NETBUF_DATA(p_req);
+    len         =  A_NETBUF_LEN(p_req);
+    payload_len = (CPU_INT16U)(p_data[2] | (p_data[3] << 8u));
+    ok          = ((p_data[0]   == A_NETBUF_GET_ELEM(p_req, A_REQ_EPID)) &&
+                   (payload_len == len - HTC_HDR_LENGTH) &&
+                   (A_NETBUF_GET_ELEM(p_req, A_REQ_TRANSFER_LEN) == DEV_CALC_SEND_PADDED_LEN(&QCABenchHCD_DrvCxt, len))) ? DEF_YES : DEF_NO;
+    for (ix = 0u; (ok == DEF_YES) && (ix < payload_len); ix++) {    /* See Note #1.                                 */
+        if (p_data[HTC_HDR_LENGTH + ix] != (CPU_INT08U)(QCABenchHCD_Stat.TxFrameCtr * 7u + ix)) {
+            ok = DEF_NO;
+        }
+    }
+    if (ok == DEF_NO) {
+        QCABenchHCD_Stat.TxErrCtr++;
+    }
+
+    QCABenchHCD_Stat.TxFrameCtr++;
+    QCABenchHCD_TxPassCtr++;
+    if (QCABenchHCD_Stat.TxPassMax < QCABenchHCD_TxPassCtr) {
+        QCABenchHCD_Stat.TxPassMax = QCABenchHCD_TxPassCtr;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchHCD_BufGet()
+*
+* Description : Allocate a netbuf & its buffer from the host heap.
+*
+* Argument(s) : headroom    Len of headroom.
+*
+*               size        Size of buffer.
+*
+*               pool_id     Pool the netbuf is accounted to.
+*
+* Return(s)   : Pointer to netbuf, if available.
+*
+*               DEF_NULL,          otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) See Note #3.
+*********************************************************************************************************
+*/
+
+static  A_NETBUF  *QCABenchHCD_BufGet (CPU_INT16U         headroom,
+                                       CPU_INT16U         size,
+                                       NET_DEV_POOL_TYPE  pool_id)
+{
+    A_NETBUF  *p_buf;
+
+
+    p_buf = (A_NETBUF *)malloc(sizeof(A_NETBUF) + size);        /* See Note #1.                                         */
+    if (p_buf == DEF_NULL) {
+        return (DEF_NULL);
+    }
+
+    a_netbuf_configure(p_buf, &p_buf[1], headroom, 0u, size);
+    p_buf->pool_id = pool_id;
+    QCABenchHCD_Stat.BufNbrUsed++;
+
+    return (p_buf);
+}
@@ -0,0 +1,154 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     QCA400x DRIVER HOST BENCH
+*
+*                                    MOCK TARGET & HOST CONTROLLER
+*
+* Filename : qca_bench_hcd.h
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host-only.  Replaces the SPI host controller driver (HCD) under the common QCA400x
+*                driver (Driver_Main(), HTC) by a model of the target's mailbox, so that the driver's
+*                receive & transmit paths run unmodified on the host.  The custom layer's netbuf,
+*                request & completion hooks are replaced too.
+*
+*            (2) The target holds a FIFO of HTC frames to be read by the driver.  A frame is either
+*                announced only, or has arrived, i.e. is held in the target's read buffer & counted
+*                in the read buffer space.  Frames arrive in order.
+*
+*            (3) Each frame is built when read, as :
+*
+*                    HTC hdr     EP, flags, payload len, trailer len & the frame's sequence nbr.
+*                    data        'DataLen' octets, octet i = (seq * 7 + i).
+*                    trailer     A credit record if 'Credits' is non-zero, then a lookahead record
+*                                if 'LookAheadEn' : the next frame's HTC hdr if one is announced,
+*                                invalid guards otherwise.
+*                    padding     Up to the mailbox block size.
+*
+*                A frame with no data on endpoint 0 is a credit report.
+*
+*            (4) Only a single interface & driver context is modelled.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  QCA_BENCH_HCD_MODULE_PRESENT
+#define  QCA_BENCH_HCD_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  QCA_BENCH_HCD_RX_FRAME_NBR_MAX                   32u   /* Max nbr of frames queued per test.                   */
+#define  QCA_BENCH_HCD_PASS_NBR_MAX                       64u   /* Max nbr of Driver_Main() passes per run.             */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  qca_bench_hcd_rx_frame {
+    CPU_INT08U   EP;                                            /* Endpoint the frame is rx'd on.                       */
+    CPU_INT16U   DataLen;                                       /* Len of data, excl trailer (see Note #3).             */
+    CPU_BOOLEAN  LookAheadEn;                                   /* Trailer carries a lookahead record.                  */
+    CPU_INT08U   CreditEP;                                      /* Endpoint the trailer's credit record is for.         */
+    CPU_INT08U   Credits;                                       /* Nbr of credits reported (0 : no credit record).      */
+    CPU_BOOLEAN  Arrived;                                       /* Frame held in the target's rd buf (see Note #2).     */
+} QCA_BENCH_HCD_RX_FRAME;
+
+
+typedef  struct  qca_bench_hcd_stat {
+    CPU_INT32U   PassCtr;                                       /* Nbr of Driver_Main() passes.                         */
+    CPU_INT32U   LookAheadRdCtr;                                /* Nbr of lookaheads rd from the target's regs.         */
+    CPU_INT32U   RegRdCtr;                                      /* Nbr of target regs rd.                               */
+    CPU_INT32U   RxFrameCtr;                                    /* Nbr of frames rd by the driver.                      */
+    CPU_INT32U   RxRdErrCtr;                                    /* Nbr of rds not matching an arrived frame.            */
+    CPU_INT32U   RxDeliverCtr;                                  /* Nbr of data frames delivered intact.                 */
+    CPU_INT32U   RxDataErrCtr;                                  /* Nbr of data frames delivered w/ bad len or data.     */
+    CPU_INT32U   TxFrameCtr;                                    /* Nbr of frames wr by the driver.                      */
+    CPU_INT32U   TxErrCtr;                                      /* Nbr of frames wr w/ bad HTC hdr, len or data.        */
+    CPU_INT32U   TxPassMax;                                     /* Max nbr of frames wr by one Driver_Main() pass.      */
+    CPU_INT32U   TxDoneCtr;                                     /* Nbr of tx requests completed.                        */
+    CPU_INT32U   WaterMarkCtr;                                  /* Nbr of wr buf watermarks programmed.                 */
+    CPU_INT32U   AssertCtr;                                     /* Nbr of driver asserts failed.                        */
+    CPU_INT32U   AssertLine;                                    /* Line of the last driver assert failed.               */
+    CPU_INT32U   BufNbrUsed;                                    /* Nbr of netbufs not freed.                            */
+} QCA_BENCH_HCD_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void        QCABenchHCD_Init     (CPU_INT16U               credit_cnt); /* Init the driver & the target.         */
+
+void        QCABenchHCD_RxQueue  (QCA_BENCH_HCD_RX_FRAME  *p_frame);    /* Announce a frame to be rd.            */
+
+void        QCABenchHCD_RxArrive (void);                                /* Next announced frame arrives.         */
+
+CPU_INT32U  QCABenchHCD_RxPending(void);                                /* Nbr of frames not rd yet.             */
+
+void        QCABenchHCD_TxSubmit (CPU_INT08U               ep,          /* Queue a frame to be wr.               */
+                                  CPU_INT16U               data_len);
+
+CPU_INT08U  QCABenchHCD_CreditsGet(CPU_INT08U              ep);         /* Get an endpoint's tx credits.         */
+
+CPU_INT32U  QCABenchHCD_Run      (void);                                /* Run the driver until it may block.    */
+
+void        QCABenchHCD_StatGet  (QCA_BENCH_HCD_STAT      *p_stat);     /* Get the target's stats.               */
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of QCA400x bench HCD module include.             */
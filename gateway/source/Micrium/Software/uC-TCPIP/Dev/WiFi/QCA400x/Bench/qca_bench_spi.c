@@ -0,0 +1,716 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     QCA400x DRIVER HOST BENCH
+*
+*                                    MOCK SPI DMA PERIPHERALS
+*
+* Filename : qca_bench_spi.c
+* Version  : V3.04.00
+*
+* Note(s)  : (1) See 'qca_bench_spi.h  Note #1'.  Besides the peripherals, the functions below replace,
+*                for the BSP linked in the bench :
+*
+*                (a) The kernel & KAL services  : KAL_Sem...(), KAL_Dly(), OSIntEnter() & OSIntExit().
+*                (b) The board services         : BSP_IntVectSet() & BSP_ClkFreqGet().
+*                (c) The stack's ISR entry      : NetIF_ISR_Handler().
+*
+*            (2) The bench runs on a single thread, so a semaphore is a plain count.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#define    QCA_BENCH_SPI_MODULE
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <os.h>
+#include  <KAL/kal.h>
+#include  <IF/net_if.h>
+#include  <bsp_clk.h>
+#include  <bsp_int_vect_tbl.h>
+#include  <iorx651.h>
+#include  "qca_bench_spi.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  QCA_BENCH_SPI_SEM_NBR_MAX                         4u   /* Max nbr of sems created by the BSP.                  */
+#define  QCA_BENCH_SPI_CLK_FREQ_HZ                 120000000u   /* Freq reported for every clk.                         */
+
+#define  QCA_BENCH_SPI_SPDCR_SPBYT                 DEF_BIT_06   /* See 'net_bsp_gt202.c  LOCAL DEFINES  Note #2'.       */
+
+#define  QCA_BENCH_SPI_DMAC_MD_NORMAL                      0u   /* DMAC cfg the BSP's xfers require.                    */
+#define  QCA_BENCH_SPI_DMAC_DTS_NONE                       2u
+#define  QCA_BENCH_SPI_DMAC_SZ_08                          0u
+#define  QCA_BENCH_SPI_DMAC_DCTG_PERIPH                    1u
+#define  QCA_BENCH_SPI_DMAC_ADDR_FIXED                     0u
+#define  QCA_BENCH_SPI_DMAC_ADDR_INCR                      2u
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+volatile  struct  st_dmac    QCABench_DMAC;                     /* Mock peripherals (see 'iorx651.h  Note #1').         */
+volatile  struct  st_dmac0   QCABench_DMAC0;
+volatile  struct  st_dmac1   QCABench_DMAC1;
+volatile  struct  st_icu     QCABench_ICU;
+volatile  struct  st_rspi    QCABench_RSPI1;
+volatile  struct  st_system  QCABench_SYSTEM;
+
+static  CPU_INT32U          QCABenchSPI_SemCntTbl[QCA_BENCH_SPI_SEM_NBR_MAX];   /* See Note #2.                 */
+static  CPU_INT32U          QCABenchSPI_SemNbrUsed;
+
+static  CPU_FNCT_VOID       QCABenchSPI_DMA_ISR;                /* Rx chan xfer end vector set by the BSP.              */
+
+static  CPU_INT08U          QCABenchSPI_PeerTx[QCA_BENCH_SPI_PEER_BUF_SIZE];    /* Octets answered on MISO.     */
+static  CPU_INT08U          QCABenchSPI_PeerRx[QCA_BENCH_SPI_PEER_BUF_SIZE];    /* Octets captured on MOSI.     */
+static  CPU_BOOLEAN         QCABenchSPI_Stall;
+
+static  QCA_BENCH_SPI_STAT  QCABenchSPI_Stat;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  QCABenchSPI_CfgChk (void);
+
+static  void         QCABenchSPI_Xfer   (void);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       QCABenchSPI_PeerTxSet()
+*
+* Description : Set the octets the peer answers the next transfer with.
+*
+* Argument(s) : p_data      Pointer to octets.
+*
+*               len         Nbr of octets.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Octets past 'len' are answered as all 1's, as by an idle target.
+*********************************************************************************************************
+*/
+
+void  QCABenchSPI_PeerTxSet (const  CPU_INT08U  *p_data,
+                                    CPU_INT16U   len)
+{
+    if (len > QCA_BENCH_SPI_PEER_BUF_SIZE) {
+        len = QCA_BENCH_SPI_PEER_BUF_SIZE;
+    }
+
+    Mem_Set(&QCABenchSPI_PeerTx[0], 0xFFu, sizeof(QCABenchSPI_PeerTx));     /* See Note #1.                     */
+    Mem_Copy(&QCABenchSPI_PeerTx[0], p_data, len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       QCABenchSPI_PeerRxGet()
+*
+* Description : Get the octets the peer captured during the last transfer.
+*
+* Argument(s) : p_data      Pointer to buffer that will receive the octets.
+*
+*               len         Nbr of octets.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  QCABenchSPI_PeerRxGet (CPU_INT08U  *p_data,
+                             CPU_INT16U   len)
+{
+    if (len > QCA_BENCH_SPI_PEER_BUF_SIZE) {
+        len = QCA_BENCH_SPI_PEER_BUF_SIZE;
+    }
+
+    Mem_Copy(p_data, &QCABenchSPI_PeerRx[0], len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchSPI_StallSet()
+*
+* Description : Stall the peer, or release it (see 'qca_bench_spi.h  Note #3').
+*
+* Argument(s) : stall       DEF_YES, to stall the peer.
+*
+*                           DEF_NO,  to release it.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  QCABenchSPI_StallSet (CPU_BOOLEAN  stall)
+{
+    QCABenchSPI_Stall = stall;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       QCABenchSPI_ISR_Raise()
+*
+* Description : Raise the receive channel's transfer end interrupt out of any transfer, as left pending by
+*               a transfer aborted after its wait timed out.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               QCABenchSPI_Xfer().
+*
+* Note(s)     : (1) The interrupt request is accepted, & so cleared, as the vector is called.
+*********************************************************************************************************
+*/
+
+void  QCABenchSPI_ISR_Raise (void)
+{
+    QCABench_DMAC1.DMSTS.BIT.DTIF = 1u;
+    if ((QCABench_DMAC1.DMINT.BIT.DTIE != 1u) ||
+        (IEN(DMAC, DMAC1I)             != 1u) ||
+        (QCABenchSPI_DMA_ISR           == DEF_NULL)) {
+        IR(DMAC, DMAC1I) = 1u;                                  /* Left pending.                                        */
+        return;
+    }
+
+    IR(DMAC, DMAC1I) = 0u;                                      /* See Note #1.                                         */
+    QCABenchSPI_Stat.ISR_Ctr++;
+    QCABenchSPI_DMA_ISR();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         QCABenchSPI_IsIdle()
+*
+* Description : Check that the DMAC channels & the RSPI unit are left idle, as after a transfer.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_YES, if both channels, the RSPI unit & its requests are disabled & the RSPI is back
+*                        to its default access width.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  QCABenchSPI_IsIdle (void)
+{
+    CPU_BOOLEAN  idle;
+
+
+    idle = ((QCABench_DMAC0.DMCNT.BIT.DTE  == 0u) &&
+            (QCABench_DMAC1.DMCNT.BIT.DTE  == 0u) &&
+            (QCABench_RSPI1.SPCR.BIT.SPE   == 0u) &&
+            (QCABench_RSPI1.SPCR.BIT.SPTIE == 0u) &&
+            (QCABench_RSPI1.SPCR.BIT.SPRIE == 0u) &&
+            (IEN(RSPI1, SPTI1)             == 0u) &&
+            (IEN(RSPI1, SPRI1)             == 0u) &&
+            (DEF_BIT_IS_CLR(QCABench_RSPI1.SPDCR.BYTE, QCA_BENCH_SPI_SPDCR_SPBYT) == DEF_YES)) ? DEF_YES : DEF_NO;
+
+    return (idle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        QCABenchSPI_StatGet()
+*
+* Description : Get the peripherals' statistics.
+*
+* Argument(s) : p_stat      Pointer to variable that will receive the statistics.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  QCABenchSPI_StatGet (QCA_BENCH_SPI_STAT  *p_stat)
+{
+   *p_stat = QCABenchSPI_Stat;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        KERNEL & BOARD MOCK
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           KAL_SemCreate()
+*
+* Description : Create a semaphore, w/ a count of 0.
+*
+* Argument(s) : p_name      Unused.
+*
+*               p_cfg       Unused.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               RTOS_ERR_NONE
+*                               RTOS_ERR_NO_MORE_RSRC
+*
+* Return(s)   : Handle to semaphore.
+*
+* Caller(s)   : NetDev_WiFi_GT202_SPI_DMA_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+KAL_SEM_HANDLE  KAL_SemCreate (const  CPU_CHAR         *p_name,
+                                      KAL_SEM_EXT_CFG  *p_cfg,
+                                      RTOS_ERR         *p_err)
+{
+    KAL_SEM_HANDLE  handle;
+
+
+   (void)p_name;
+   (void)p_cfg;
+
+    handle.SemObjPtr = DEF_NULL;
+    if (QCABenchSPI_SemNbrUsed >= QCA_BENCH_SPI_SEM_NBR_MAX) {
+       *p_err = RTOS_ERR_NO_MORE_RSRC;
+        return (handle);
+    }
+
+    QCABenchSPI_SemCntTbl[QCABenchSPI_SemNbrUsed] = 0u;
+    handle.SemObjPtr = &QCABenchSPI_SemCntTbl[QCABenchSPI_SemNbrUsed];
+    QCABenchSPI_SemNbrUsed++;
+
+   *p_err = RTOS_ERR_NONE;
+
+    return (handle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_SemPend()
+*
+* Description : Wait on a semaphore.
+*
+* Argument(s) : sem_handle  Handle to semaphore.
+*
+*               opt         Unused.
+*
+*               timeout     Unused : a semaphore not posted once the DMA transfer has run never is.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               RTOS_ERR_NONE
+*                               RTOS_ERR_TIMEOUT
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_WiFi_GT202_SPI_WrRd_DMA().
+*
+* Note(s)     : (1) See 'qca_bench_spi.h  Note #2'.
+*********************************************************************************************************
+*/
+
+void  KAL_SemPend (KAL_SEM_HANDLE   sem_handle,
+                   KAL_OPT          opt,
+                   CPU_INT32U       timeout,
+                   RTOS_ERR        *p_err)
+{
+    CPU_INT32U  *p_cnt;
+
+
+   (void)opt;
+   (void)timeout;
+
+    p_cnt = (CPU_INT32U *)sem_handle.SemObjPtr;
+    if (*p_cnt == 0u) {                                         /* See Note #1.                                         */
+        QCABenchSPI_Xfer();
+    }
+
+    if (*p_cnt == 0u) {
+       *p_err = RTOS_ERR_TIMEOUT;
+        return;
+    }
+
+  (*p_cnt)--;
+   *p_err = RTOS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_SemPost()
+*                                             KAL_SemSet()
+*
+* Description : Post a semaphore, or set its count.
+*
+* Argument(s) : sem_handle  Handle to semaphore.
+*
+*               opt         Unused.
+*
+*               cnt         Count to set.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               RTOS_ERR_NONE
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetDev_WiFiISR_Handler_DMA_GT202(),
+*               NetDev_WiFi_GT202_SPI_WrRd_DMA().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  KAL_SemPost (KAL_SEM_HANDLE   sem_handle,
+                   KAL_OPT          opt,
+                   RTOS_ERR        *p_err)
+{
+   (void)opt;
+
+  (*(CPU_INT32U *)sem_handle.SemObjPtr)++;
+   *p_err = RTOS_ERR_NONE;
+}
+
+
+void  KAL_SemSet (KAL_SEM_HANDLE   sem_handle,
+                  CPU_INT08U       cnt,
+                  RTOS_ERR        *p_err)
+{
+   *(CPU_INT32U *)sem_handle.SemObjPtr = cnt;
+   *p_err = RTOS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                              KAL_Dly()
+*                                            OSIntEnter()
+*                                             OSIntExit()
+*
+* Description : Kernel services the BSP calls outside the DMA transfer path; no effect in the bench.
+*
+* Argument(s) : dly_ms      Unused.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : GT202 BSP.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  KAL_Dly (CPU_INT32U  dly_ms)
+{
+   (void)dly_ms;
+}
+
+
+void  OSIntEnter (void)
+{
+}
+
+
+void  OSIntExit (void)
+{
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntVectSet()
+*
+* Description : Set an interrupt vector; only the DMAC receive channel's transfer end vector is kept.
+*
+* Argument(s) : int_id      Interrupt vector nbr.
+*
+*               isr         Interrupt handler.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : GT202 BSP.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  BSP_IntVectSet (CPU_INT16U     int_id,
+                      CPU_FNCT_VOID  isr)
+{
+    if (int_id == VECT_DMAC_DMAC1I) {
+        QCABenchSPI_DMA_ISR = isr;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_ClkFreqGet()
+*
+* Description : Get a clock's frequency.
+*
+* Argument(s) : clk_id      Unused.
+*
+* Return(s)   : QCA_BENCH_SPI_CLK_FREQ_HZ.
+*
+* Caller(s)   : GT202 BSP.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  BSP_ClkFreqGet (BSP_CLK_ID  clk_id)
+{
+   (void)clk_id;
+
+    return (QCA_BENCH_SPI_CLK_FREQ_HZ);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetIF_ISR_Handler()
+*
+* Description : Stack's device ISR entry, reached by the BSP's GPIO ISRs only, which the bench never raises.
+*
+* Argument(s) : if_nbr      Unused.
+*
+*               type        Unused.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IF_ERR_NONE
+*
+* Return(s)   : none.
+*
+* Caller(s)   : GT202 BSP.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  NetIF_ISR_Handler (NET_IF_NBR         if_nbr,
+                         NET_DEV_ISR_TYPE   type,
+                         NET_ERR           *p_err)
+{
+   (void)if_nbr;
+   (void)type;
+
+   *p_err = NET_IF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        QCABenchSPI_CfgChk()
+*
+* Description : Check the DMAC & RSPI configuration against what a DMA transfer requires.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the transfer can run.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : QCABenchSPI_Xfer().
+*
+* Note(s)     : (1) Both channels are activated by the RSPI requests & move single octets to or from the
+*                   RSPI data register, which MUST be in byte access.
+*
+*               (2) Only the receive channel signals transfer end (see 'NetDev_WiFi_GT202_SPI_DMA_Init()
+*                   Note #2').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  QCABenchSPI_CfgChk (void)
+{
+    CPU_BOOLEAN  ok;
+
+
+                                                                /* -------------------- UNITS ON ---------------------- */
+    ok = ((MSTP(DMAC)                     == 0u) &&
+          (MSTP(RSPI1)                    == 0u) &&
+          (QCABench_DMAC.DMAST.BIT.DMST   == 1u)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* -------------- CHANS (see Note #1) ----------------- */
+    ok = ((ok == DEF_OK) &&
+          (QCABench_ICU.DMRSR0                == VECT_RSPI1_SPTI1)                &&
+          (QCABench_ICU.DMRSR1                == VECT_RSPI1_SPRI1)                &&
+          (QCABench_DMAC0.DMCNT.BIT.DTE       == 1u)                              &&
+          (QCABench_DMAC1.DMCNT.BIT.DTE       == 1u)                              &&
+          (QCABench_DMAC0.DMTMD.BIT.MD        == QCA_BENCH_SPI_DMAC_MD_NORMAL)    &&
+          (QCABench_DMAC1.DMTMD.BIT.MD        == QCA_BENCH_SPI_DMAC_MD_NORMAL)    &&
+          (QCABench_DMAC0.DMTMD.BIT.DTS       == QCA_BENCH_SPI_DMAC_DTS_NONE)     &&
+          (QCABench_DMAC1.DMTMD.BIT.DTS       == QCA_BENCH_SPI_DMAC_DTS_NONE)     &&
+          (QCABench_DMAC0.DMTMD.BIT.SZ        == QCA_BENCH_SPI_DMAC_SZ_08)        &&
+          (QCABench_DMAC1.DMTMD.BIT.SZ        == QCA_BENCH_SPI_DMAC_SZ_08)        &&
+          (QCABench_DMAC0.DMTMD.BIT.DCTG      == QCA_BENCH_SPI_DMAC_DCTG_PERIPH)  &&
+          (QCABench_DMAC1.DMTMD.BIT.DCTG      == QCA_BENCH_SPI_DMAC_DCTG_PERIPH)  &&
+          (QCABench_DMAC0.DMDAR               == (void *)&QCABench_RSPI1.SPDR)    &&
+          (QCABench_DMAC1.DMSAR               == (void *)&QCABench_RSPI1.SPDR)    &&
+          (QCABench_DMAC0.DMAMD.BIT.DM        == QCA_BENCH_SPI_DMAC_ADDR_FIXED)   &&
+          (QCABench_DMAC1.DMAMD.BIT.SM        == QCA_BENCH_SPI_DMAC_ADDR_FIXED)   &&
+          (QCABench_DMAC0.DMCRA               == QCABench_DMAC1.DMCRA)            &&
+          (QCABench_DMAC0.DMCRA                > 0u)                              &&
+          (QCABench_DMAC0.DMCRA               <= QCA_BENCH_SPI_PEER_BUF_SIZE)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* --------------------- RSPI REQS -------------------- */
+    ok = ((ok == DEF_OK) &&
+          (QCABench_RSPI1.SPCR.BIT.SPE        == 1u) &&
+          (QCABench_RSPI1.SPCR.BIT.SPTIE      == 1u) &&
+          (QCABench_RSPI1.SPCR.BIT.SPRIE      == 1u) &&
+          (IEN(RSPI1, SPTI1)                  == 1u) &&
+          (IEN(RSPI1, SPRI1)                  == 1u) &&
+          (DEF_BIT_IS_SET(QCABench_RSPI1.SPDCR.BYTE, QCA_BENCH_SPI_SPDCR_SPBYT) == DEF_YES)) ? DEF_OK : DEF_FAIL;
+
+                                                                /* ---------------- XFER END (see Note #2) ------------ */
+    ok = ((ok == DEF_OK) &&
+          (QCABench_DMAC0.DMINT.BYTE          == 0u) &&
+          (QCABench_DMAC1.DMINT.BIT.DTIE      == 1u) &&
+          (QCABench_DMAC1.DMSTS.BIT.DTIF      == 0u) &&
+          (IEN(DMAC, DMAC1I)                  == 1u) &&
+          (QCABenchSPI_DMA_ISR                != DEF_NULL)) ? DEF_OK : DEF_FAIL;
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         QCABenchSPI_Xfer()
+*
+* Description : Run a DMA transfer (see 'qca_bench_spi.h  Note #2').
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : KAL_SemPend().
+*
+* Note(s)     : (1) An address in incrementing mode moves to the next octet after each transfer; a fixed
+*                   address is the dummy octet the BSP substitutes for a missing buffer.
+*********************************************************************************************************
+*/
+
+static  void  QCABenchSPI_Xfer (void)
+{
+    CPU_INT08U  *p_src;
+    CPU_INT08U  *p_dest;
+    CPU_INT32U   len;
+    CPU_INT32U   ix;
+
+
+    if (QCABenchSPI_CfgChk() != DEF_OK) {
+        QCABenchSPI_Stat.CfgErrCtr++;
+        return;
+    }
+
+    if (QCABenchSPI_Stall == DEF_YES) {                         /* See 'qca_bench_spi.h  Note #3'.                      */
+        QCABenchSPI_Stat.StallCtr++;
+        return;
+    }
+
+    p_src  = (CPU_INT08U *)QCABench_DMAC0.DMSAR;
+    p_dest = (CPU_INT08U *)QCABench_DMAC1.DMDAR;
+    len    =  QCABench_DMAC0.DMCRA;
+    for (ix = 0u; ix < len; ix++) {                             /* See Note #1.                                         */
+        QCABenchSPI_PeerRx[ix] = *p_src;
+       *p_dest                 =  QCABenchSPI_PeerTx[ix];
+        if (QCABench_DMAC0.DMAMD.BIT.SM == QCA_BENCH_SPI_DMAC_ADDR_INCR) {
+            p_src++;
+        }
+        if (QCABench_DMAC1.DMAMD.BIT.DM == QCA_BENCH_SPI_DMAC_ADDR_INCR) {
+            p_dest++;
+        }
+    }
+
+    QCABench_DMAC0.DMCRA = 0u;
+    QCABench_DMAC1.DMCRA = 0u;
+    QCABenchSPI_Stat.XferCtr++;
+    QCABenchSPI_Stat.OctetCtr += len;
+
+    QCABenchSPI_ISR_Raise();
+}
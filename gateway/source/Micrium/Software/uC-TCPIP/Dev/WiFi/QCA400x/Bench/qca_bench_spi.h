@@ -0,0 +1,126 @@
+/*
+*********************************************************************************************************
+*                                             uC/TCP-IP
+*                                      The Embedded TCP/IP Suite
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/TCP-IP is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     QCA400x DRIVER HOST BENCH
+*
+*                                    MOCK SPI DMA PERIPHERALS
+*
+* Filename : qca_bench_spi.h
+* Version  : V3.04.00
+*
+* Note(s)  : (1) Host-only.  Models the RX651 DMAC & RSPI1 units closely enough for the GT202 BSP's DMA
+*                transfer path ('NetDev_WiFi_GT202_SPI_WrRd_DMA()') to run unmodified on the host
+*                (see 'iorx651.h  Note #1').  The kernel services the BSP uses are modelled too.
+*
+*            (2) A DMA transfer runs when the BSP pends on its transfer end signal & the signal is not
+*                already posted, as the transfer would complete while the task waits on target :
+*
+*                (a) The peripherals' configuration is checked against what the transfer requires; a
+*                    mismatch is counted & the transfer is NOT started.
+*
+*                (b) Each octet written is captured by the peer (the target), which answers with the
+*                    next octet of its transmit buffer.
+*
+*                (c) The receive channel's transfer end interrupt is raised & its vector called.
+*
+*            (3) A stalled peer never clocks the bus : the transfer does NOT complete & the BSP's wait
+*                times out.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  QCA_BENCH_SPI_MODULE_PRESENT
+#define  QCA_BENCH_SPI_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  QCA_BENCH_SPI_PEER_BUF_SIZE                     256u   /* Max len of a DMA xfer.                               */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  qca_bench_spi_stat {
+    CPU_INT32U   XferCtr;                                       /* Nbr of DMA xfers completed.                          */
+    CPU_INT32U   OctetCtr;                                      /* Nbr of octets moved.                                 */
+    CPU_INT32U   CfgErrCtr;                                     /* Nbr of xfers w/ bad peripheral cfg (see Note #2a).   */
+    CPU_INT32U   StallCtr;                                      /* Nbr of xfers stalled (see Note #3).                  */
+    CPU_INT32U   ISR_Ctr;                                       /* Nbr of xfer end ints raised.                         */
+} QCA_BENCH_SPI_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void         QCABenchSPI_PeerTxSet(const  CPU_INT08U  *p_data,  /* Set the octets the peer answers with.          */
+                                          CPU_INT16U   len);
+
+void         QCABenchSPI_PeerRxGet(       CPU_INT08U  *p_data,  /* Get the octets the peer captured.              */
+                                          CPU_INT16U   len);
+
+void         QCABenchSPI_StallSet (       CPU_BOOLEAN  stall);  /* Stall the peer (see Note #3).                  */
+
+void         QCABenchSPI_ISR_Raise(void);                       /* Raise the xfer end int out of a xfer.          */
+
+CPU_BOOLEAN  QCABenchSPI_IsIdle   (void);                       /* Chk the DMAC & RSPI are left idle.             */
+
+void         QCABenchSPI_StatGet  (QCA_BENCH_SPI_STAT  *p_stat);    /* Get the peripherals' stats.                */
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of QCA400x bench SPI module include.             */
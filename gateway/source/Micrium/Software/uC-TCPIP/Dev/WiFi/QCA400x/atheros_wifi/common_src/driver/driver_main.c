@@ -51,6 +51,7 @@ Driver_Main(A_VOID *pCxt, A_UINT8 scope, A_BOOL *pCanBlock, A_UINT16 *pBlock_mse
     A_VOID *pReq;
     A_DRIVER_CONTEXT *pDCxt = GET_DRIVER_COMMON(pCxt);
     A_UINT8 cpuIntrCause;
+    A_UINT8 txCnt;
 
     pDCxt->driver_state = DRIVER_STATE_PENDING_CONDITION_A;
 
@@ -103,11 +104,10 @@ Driver_Main(A_VOID *pCxt, A_UINT8 scope, A_BOOL *pCanBlock, A_UINT16 *pBlock_mse
             /* if this happens it is a critical error */
             A_ASSERT(0);
         }
-        /* FIXME: as an optimization the next lookahead may have
-         * been acquired from the trailer of the previous rx packet.
-         * in that case we should pre-load the lookahead so as to
-         * avoid reading it from the registers. */
-        /* reset the lookahead for the next read operation */
+        /* reset the lookahead for the next read operation. if the
+         * trailer of this packet carries the next lookahead it is
+         * pre-loaded by Driver_RxComplete when the request below
+         * completes so that Driver_RxReady can skip the registers. */
         pDCxt->lookAhead = 0;
         /* check to see if a deferred bus request has completed. if so
 	     * process it. */
@@ -123,25 +123,44 @@ Driver_Main(A_VOID *pCxt, A_UINT8 scope, A_BOOL *pCanBlock, A_UINT16 *pBlock_mse
 
     pDCxt->driver_state = DRIVER_STATE_PENDING_CONDITION_D;
 
-    if((scope & DRIVER_SCOPE_TX) && A_TRUE == Driver_TxReady(pCxt)){
+    /* keep sending queued packets for as long as the target has
+     * credits for them rather than one packet per pass. each
+     * request is completed before the next so that Driver_TxReady
+     * sees the credits it consumed. */
+    txCnt = 0;
+    while((scope & DRIVER_SCOPE_TX) && txCnt < DRIVER_CONFIG_TX_PER_PASS_MAX &&
+          A_TRUE == Driver_TxReady(pCxt)){
     	pDCxt->driver_state = DRIVER_STATE_TX_PROCESSING;
         /* after processing any outstanding device interrupts
          * see if there is a packet that requires transmitting
          */
-    	if(pDCxt->txQueue.count){
-    		/* accesslock here to sync with threads calling
-    		 * submit TX
-    		 */
-    		TXQUEUE_ACCESS_ACQUIRE(pCxt);
-    		{
-	    		pReq = A_NETBUF_DEQUEUE(&(pDCxt->txQueue));
-    		}
-    		TXQUEUE_ACCESS_RELEASE(pCxt);
-
-            if(pReq != NULL){
-    		    Driver_SendPacket(pCxt, pReq);
-            }
+    	if(0 == pDCxt->txQueue.count){
+    		break;
+    	}
+    	/* accesslock here to sync with threads calling
+    	 * submit TX
+    	 */
+    	TXQUEUE_ACCESS_ACQUIRE(pCxt);
+    	{
+    		pReq = A_NETBUF_DEQUEUE(&(pDCxt->txQueue));
     	}
+    	TXQUEUE_ACCESS_RELEASE(pCxt);
+
+        if(pReq == NULL){
+            break;
+        }
+    	Driver_SendPacket(pCxt, pReq);
+        txCnt++;
+        /* check to see if the bus request has completed. if so
+	     * process it. */
+	    if(pDCxt->hcd.booleans & SDHD_BOOL_DMA_COMPLETE){
+	        /* get the request */
+	        if(A_OK == Driver_CompleteRequest(pCxt, pDCxt->hcd.pCurrentRequest)){
+		        /* clear the pending request and the boolean */
+		        pDCxt->hcd.pCurrentRequest = NULL;
+		        pDCxt->hcd.booleans &= ~SDHD_BOOL_DMA_COMPLETE;
+	        }
+	    }
     }
 
     pDCxt->driver_state = DRIVER_STATE_PENDING_CONDITION_E;
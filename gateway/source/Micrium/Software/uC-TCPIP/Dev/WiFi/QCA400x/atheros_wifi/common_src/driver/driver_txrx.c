@@ -36,10 +36,17 @@ A_VOID Driver_RxComplete(A_VOID *pCxt, A_VOID *pReq)
 {
     A_UINT32 lookAheads[1];
     A_UINT32 NumLookAheads = 0;
+    A_DRIVER_CONTEXT *pDCxt = GET_DRIVER_COMMON(pCxt);
 
     if(A_OK != Htc_ProcessRecvHeader(pCxt, pReq, lookAheads, &NumLookAheads)){
         A_ASSERT(0);
     }
+    /* pre-load the next packet's lookahead from the trailer so that
+     * Driver_RxReady need not read it from the registers. it is still
+     * checked against the read buffer space left after this packet. */
+    if(NumLookAheads != 0 && lookAheads[0] != 0){
+        pDCxt->lookAhead = lookAheads[0];
+    }
 
     if(A_NETBUF_GET_ELEM(pReq, A_REQ_EPID) == ENDPOINT_0){
         Htc_RxComplete(pCxt, pReq);
@@ -267,8 +274,17 @@ A_STATUS Driver_RecvPacket(A_VOID *pCxt, A_VOID *pReq)
 
     A_STATUS status;
     A_UINT32 address;
+    A_DRIVER_CONTEXT *pDCxt = GET_DRIVER_COMMON(pCxt);
 
     Htc_PrepareRecvPacket(pCxt, pReq);
+    /* account for the bytes this read drains from the device read buffer
+     * so that a lookahead pre-loaded by Driver_RxComplete is only trusted
+     * while the next packet is known to be buffered already. */
+    if(pDCxt->hcd.ReadBufferSpace > A_NETBUF_LEN(pReq)){
+        pDCxt->hcd.ReadBufferSpace -= A_NETBUF_LEN(pReq);
+    }else{
+        pDCxt->hcd.ReadBufferSpace = 0;
+    }
 
     /* init the packet mailbox address - begin with mailbox end address and then subtract the request transfer length */
     address = Hcd_GetMboxAddress(pCxt, HIF_ACTIVE_MBOX_INDEX, A_NETBUF_LEN(pReq));
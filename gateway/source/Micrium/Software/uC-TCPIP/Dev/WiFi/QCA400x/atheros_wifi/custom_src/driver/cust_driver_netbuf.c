@@ -94,6 +94,7 @@ A_VOID a_netbuf_init (A_VOID *p_ctx,
 	p_a_netbuf->data = (A_UINT8 *)((A_UINT32)p_a_netbuf->head + p_dev_cfg->RxBufIxOffset - NET_DEV_ATHEROS_PACKET_HEADER);
 	p_a_netbuf->tail =  p_a_netbuf->data;
     p_a_netbuf->end  = (A_UINT8 *)((A_UINT32)p_a_netbuf->data + p_dev_cfg->RxBufLargeSize);
+    p_a_netbuf->frag_nbr = 0u;
 }
 
 
@@ -193,13 +194,20 @@ A_UINT32 a_netbuf_to_len(A_VOID *bufPtr)
 {
 	A_NETBUF* a_netbuf_ptr = (A_NETBUF*)bufPtr;
     A_UINT32 len = (A_UINT32)a_netbuf_ptr->tail - (A_UINT32)a_netbuf_ptr->data;    
+    A_UINT8  i;
+    
+    for (i = 0u; i < a_netbuf_ptr->frag_nbr; i++) {
+        len += (A_UINT32)a_netbuf_ptr->frag[i].len;
+    }
     
     return len;
 }
 
 /* returns a buffer fragment of a packet.  If the packet is not 
  * fragmented only index == 0 will return a buffer which will be 
- * the whole packet. pLen will hold the length of the buffer in 
+ * the whole packet. Otherwise index == 0 returns the contiguous 
+ * [data, tail) region & the following indexes return the appended 
+ * fragments in order. pLen will hold the length of the buffer in 
  * bytes.
  */
 A_VOID*
@@ -213,12 +221,34 @@ a_netbuf_get_fragment(A_VOID  *bufPtr,
 	if(0==index){
 		pBuf = a_netbuf_to_data(bufPtr);
 		*pLen = (A_INT32)((A_UINT32)a_netbuf_ptr->tail - (A_UINT32)a_netbuf_ptr->data);
-	} else {	
+	} else if(index <= a_netbuf_ptr->frag_nbr){
+		pBuf = a_netbuf_ptr->frag[index - 1u].data;
+		*pLen = a_netbuf_ptr->frag[index - 1u].len;
 	}
 	
 	return pBuf;	
 }
 
+/* appends a fragment to the end of a packet.  The fragment is NOT 
+ * copied; it MUST remain valid until the packet is freed.
+ */
+A_VOID
+a_netbuf_append_fragment(A_VOID  *bufPtr, 
+                         A_UINT8 *frag, 
+                         A_INT32  len)
+{
+	A_NETBUF* a_netbuf_ptr = (A_NETBUF*)bufPtr;
+	
+	if(a_netbuf_ptr->frag_nbr >= A_NETBUF_FRAG_NBR_MAX){
+		A_ASSERT(0);
+		return;
+	}
+	
+	a_netbuf_ptr->frag[a_netbuf_ptr->frag_nbr].data = frag;
+	a_netbuf_ptr->frag[a_netbuf_ptr->frag_nbr].len  = len;
+	a_netbuf_ptr->frag_nbr++;
+}
+
 A_VOID a_netbuf_configure(A_VOID   *buffptr,
                           A_VOID   *buffer, 
                           A_UINT16  headroom, 
@@ -78,6 +78,11 @@ extern "C" {
 
 #define DRIVER_CONFIG_IMPLEMENT_RX_FREE_QUEUE       0//1 or 0
 
+/* DRIVER_CONFIG_TX_PER_PASS_MAX - maximum number of queued TX packets
+ * sent by a single Driver_Main pass while the target endpoints still
+ * have credits. set to 1 to send one packet per pass. */
+#define DRIVER_CONFIG_TX_PER_PASS_MAX               4
+
 /*TCPIP stack offload for AR4001*/
 #define WIFI_ENABLE_STACK_OFFLOAD                   0//1 or 0
 
@@ -29,6 +29,16 @@ typedef  enum net_dev_pool_type {
     A_WMI_POOL    = 3u,
 }NET_DEV_POOL_TYPE;
 
+/* A_NETBUF_FRAG describes a fragment appended to the end of a netbuf's
+ *	contiguous [data, tail) region. Transmit requests use it to reference
+ *	a payload that the network stack left in caller-owned memory. */
+#define A_NETBUF_FRAG_NBR_MAX  1u
+
+typedef struct _ath_netbuf_frag {
+    A_UINT8           *data; // start of fragment
+    A_INT32            len;  // length of fragment in bytes
+} A_NETBUF_FRAG;
+
 /* A_NETBUF represents the data structure for a pReq object (packet)
  * 	throughout the driver. It is part of the custom implementation
  *	because there may be more optimal ways to achieve the same results
@@ -44,6 +54,8 @@ typedef struct _ath_netbuf {
     A_UINT8     	  *end;  // marks the end of packet.
     A_UINT8           *dealloc;  // marks the end of packet
     A_VOID			  *queueLink; // used to enqueue packets
+    A_NETBUF_FRAG      frag[A_NETBUF_FRAG_NBR_MAX]; // fragments following tail
+    A_UINT8            frag_nbr; // number of fragments in use
     A_TRANSPORT_OBJ    trans;       /* container object for netbuf elements */
 } A_NETBUF, *A_NETBUF_PTR;
 
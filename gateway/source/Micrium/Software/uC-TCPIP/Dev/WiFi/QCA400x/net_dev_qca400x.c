@@ -402,6 +402,10 @@ const  NET_DEV_API_WIFI  NetDev_API_QCA400X = {
 *                       should however be ready to accept interrupt requests.
 *                   (b) All device interrupt sources cleared.
 *
+*              (10) The Qualcomm/Atheros driver transfers a packet to the device as a list of fragments &
+*                   can therefore transmit a packet's external data in place (see 'net_if.h  NETWORK
+*                   INTERFACE DATA TYPE  Note #4' & 'NetDev_Tx()  Note #5').
+*
 *********************************************************************************************************
 */
 
@@ -635,6 +639,10 @@ static  void  NetDev_Init (NET_IF   *p_if,
     p_dev_data->WaitRespType        = NET_DEV_MGMT_NONE;
 
     Mem_Clr(p_dev_data->DeviceMacAddr, NET_IF_802x_ADDR_SIZE);
+
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    p_if->DevTxExtDataEn            = DEF_YES;                  /* See Note #10.                                        */
+#endif
 }
 
 /*
@@ -1021,6 +1029,16 @@ static  void  NetDev_Rx (NET_IF       *p_if,
 *
 *                   (b) It may be necessary to round the number of data writes up, OR perform the
 *                       last data write outside of the loop.
+*
+*               (5) A packet whose data is external to its network buffer (see 'net_if.h  NETWORK
+*                   INTERFACE DATA TYPE  Note #4b') is NOT copied :
+*
+*                   (a) The A_NETBUF describes ONLY the packet's headers at 'p_data' ...
+*                   (b) ... & the external data is appended as a fragment, which the bus layer
+*                       transfers right after the headers (see 'hw_api.c  Bus_InOutDescriptorSet()').
+*
+*                   The external data remains valid until the network buffer is freed, which happens
+*                   only once the driver posts 'p_data' to the transmit deallocation task.
 *********************************************************************************************************
 */
 
@@ -1031,16 +1049,32 @@ static  void  NetDev_Tx (NET_IF      *p_if,
 {
     A_NETBUF      *p_a_netbuf;
     A_STATUS       status;
+    CPU_INT16U     size_hdr;
+
+
+    size_hdr = size;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    if (p_if->DevTxExtDataPtr != (CPU_INT08U *)0) {             /* If pkt's data is ext (see Note #5a), ...             */
+        size_hdr -= (CPU_INT16U)p_if->DevTxExtDataLen;          /* ... ONLY its hdrs are at 'p_data'.                   */
+    }
+#endif
                                                                 /* Get and Set the A_NETBUF before submitting the...    */
                                                                 /* ...packet to the driver task.                        */
     p_a_netbuf = NetDev_GetDriverTxANetBuf(p_if,
                                            p_data,
-                                           size,
+                                           size_hdr,
                                            p_err);
     if (*p_err != NET_DEV_ERR_NONE) {
         *p_err  = NET_DEV_ERR_TX_BUSY;
          return;
     }
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    if (p_if->DevTxExtDataPtr != (CPU_INT08U *)0) {             /* Append ext data as a frag (see Note #5b).            */
+        A_NETBUF_APPEND_FRAGMENT(p_a_netbuf,
+                                 p_if->DevTxExtDataPtr,
+                                 (A_INT32)p_if->DevTxExtDataLen);
+    }
+#endif
                                                                 /* Submit the TX packet to the driver task.             */
 
 
@@ -2856,6 +2890,7 @@ static A_NETBUF* NetDev_GetDriverTxANetBuf (NET_IF     *p_if,
         p_a_netbuf->pool_id         = A_TX_NET_POOL;
         p_a_netbuf->dealloc         = p_data;
         p_a_netbuf->RxBufDelivered  = DEF_NO;
+        p_a_netbuf->frag_nbr        = 0u;
     }
 
    *p_err = NET_DEV_ERR_NONE;
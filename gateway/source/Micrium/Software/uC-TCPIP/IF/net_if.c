@@ -117,7 +117,7 @@
 
 
                                                                 /* -------------------- OBJ NAMES --------------------- */
-#define  NET_IF_RX_Q_NAME                   "Net IF Rx Q"
+#define  NET_IF_RX_SIGNAL_NAME              "Net IF Rx Signal"
 #define  NET_IF_TX_DEALLOC_Q_NAME           "Net IF Tx Dealloc Q"
 #define  NET_IF_TX_SUSPEND_NAME             "Net IF Tx Suspend"
 
@@ -171,7 +171,7 @@
 static  KAL_TASK_HANDLE  NetIF_RxTaskHandle;
 static  KAL_TASK_HANDLE  NetIF_TxDeallocTaskHandle;
 
-static  KAL_Q_HANDLE     NetIF_RxQ_Handle;
+static  KAL_SEM_HANDLE   NetIF_RxSignal;                    /* See 'NetIF_RxTaskSignal()  Note #3'.                 */
 static  KAL_Q_HANDLE     NetIF_TxQ_Handle;
 
 
@@ -181,10 +181,7 @@ static  NET_IF_NBR      NetIF_NbrBase;                      /* Net IF tbl base n
 static  NET_IF_NBR      NetIF_NbrNext;                      /* Net IF tbl next nbr to cfg.                          */
 
 
-static  NET_STAT_CTR    NetIF_RxTaskPktCtr;                 /*        Net IF rx task q'd pkts ctr.                  */
-
-static  NET_IF_Q_SIZE   NetIF_RxQ_SizeCfgd;                 /*        Net IF rx q cfg'd size.                       */
-static  NET_IF_Q_SIZE   NetIF_RxQ_SizeCfgdRem;              /*        Net IF rx q cfg'd size rem'ing.               */
+static  NET_IF_NBR      NetIF_RxNbrNext;                    /* Net IF nbr to chk first for rx'd pkts.               */
 
 
 static  NET_BUF        *NetIF_TxListHead;                   /* Ptr to net IF tx list head.                          */
@@ -235,6 +232,8 @@ static  void           NetIF_RxTaskHandler              (       void);
 
 static  NET_IF_NBR     NetIF_RxTaskWait                 (       NET_ERR            *p_err);
 
+static  NET_IF_NBR     NetIF_RxPktNextGet               (       void);
+
 static  void           NetIF_RxHandler                  (       NET_IF_NBR          if_nbr);
 
 #ifdef  NET_LOAD_BAL_MODULE_EN
@@ -245,9 +244,7 @@ static  void           NetIF_RxHandlerLoadBal           (       NET_IF
 static  NET_BUF_SIZE   NetIF_RxPkt                      (       NET_IF             *p_if,
                                                                 NET_ERR            *p_err);
 
-#ifdef  NET_LOAD_BAL_MODULE_EN
 static  void           NetIF_RxPktDec                   (       NET_IF             *p_if);
-#endif
 
 #if ((NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) || \
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
@@ -255,9 +252,6 @@ static  void           NetIF_RxPktDiscard               (       NET_BUF
                                                                 NET_ERR            *p_err);
 #endif
 
-static  void           NetIF_RxQ_SizeCfg                (       NET_IF_Q_SIZE       size);
-
-
                                                                 /* --------------------- TX FNCTS --------------------- */
 static  void           NetIF_TxDeallocTask              (       void               *p_data);
 
@@ -468,12 +462,16 @@ void  NetIF_Init (const  NET_TASK_CFG  *p_rx_task_cfg,
        (void)&NetIF_NbrBase;
 #endif
 
-#ifdef  NET_LOAD_BAL_MODULE_EN
-        NetStat_CtrInit(&p_if->RxPktCtr,     p_err);
-        if (*p_err != NET_STAT_ERR_NONE) {
-             return;
-        }
+        p_if->RxSignalCtr  = 0u;
+        p_if->RxHandledCtr = 0u;
+
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+        p_if->DevTxExtDataEn  =  DEF_NO;                                /* Set by dev init (see 'net_if.h  Note #4a').  */
+        p_if->DevTxExtDataPtr = (CPU_INT08U *)0;
+        p_if->DevTxExtDataLen =  0u;
+#endif
 
+#ifdef  NET_LOAD_BAL_MODULE_EN
         NetStat_CtrInit(&p_if->TxSuspendCtr, p_err);
         if (*p_err != NET_STAT_ERR_NONE) {
              return;
@@ -492,11 +490,7 @@ void  NetIF_Init (const  NET_TASK_CFG  *p_rx_task_cfg,
 #endif
 
 
-                                                                        /* ------------ INIT NET IF CTR's ------------- */
-    NetStat_CtrInit(&NetIF_RxTaskPktCtr, p_err);
-    if (*p_err != NET_STAT_ERR_NONE) {
-         return;
-    }
+    NetIF_RxNbrNext = NetIF_NbrBase;
 
 
                                                                         /* ----------- INIT NET IF TX LIST ------------ */
@@ -624,8 +618,8 @@ void  NetIF_Init (const  NET_TASK_CFG  *p_rx_task_cfg,
 *               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
 *               application function(s) [see also Note #1].
 *
-* Note(s)     : (2) (a) Each added network interfaces MUST decrement its total number of configured receive
-*                       buffers from the remaining network interface receive queue configured size.
+* Note(s)     : (2) (a) Received packets are NOT queued to the network interface receive task (see
+*                       'NetIF_RxTaskSignal()  Note #2'); so receive buffers need NO receive queue size.
 *
 *                   (b) Each added network interfaces MUST decrement its total number of configured transmit
 *                       buffers from the remaining network interface transmit deallocation queue configured
@@ -718,9 +712,6 @@ void  NetIF_BufPoolInit (NET_IF   *p_if,
         if (*p_err != NET_BUF_ERR_NONE) {
              return;
         }
-
-        NetIF_RxQ_SizeCfgdRem -= p_dev_cfg->RxBufLargeNbr;      /* Dec rem'ing rx Q size by nbr large rx bufs ..        */
-                                                                /* .. (see Note #2a).                                   */
     }
 
 
@@ -4861,10 +4852,10 @@ exit_release:
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_IF_ERR_NONE                 Network interface receive queue successfully
+*                               NET_IF_ERR_NONE                 Network interface receive successfully
 *                                                                   signaled.
-*                               NET_IF_ERR_RX_Q_FULL            Network interface receive queue full.
-*                               NET_IF_ERR_RX_Q_SIGNAL_FAULT    Network interface receive queue signal fault.
+*                               NET_IF_ERR_RX_Q_SIGNAL_FAULT    Network interface receive task signal fault;
+*                                                                   packet still queued (see Note #3b).
 *
 *                                                               --- RETURNED BY NetIF_IsValidHandler() : ----
 *                               NET_IF_ERR_INVALID_IF           Invalid network interface number.
@@ -4891,7 +4882,27 @@ exit_release:
 *
 *                   See also 'net_if.c  NetIF_RxPktInc()  Note #1'.
 *
-*               (2) Encoding/decoding the network interface number does NOT require any message size.
+*               (2) (a) A received packet is handed off to the receive task WITHOUT any lock or critical
+*                       section : each network interface counts the packets signaled ('RxSignalCtr') &
+*                       the packets handled ('RxHandledCtr'), & the receive task handles an interface
+*                       while the two counters differ.
+*
+*                   (b) Each counter has a single writer -- 'RxSignalCtr' is ONLY written by the
+*                       interface's device driver (or, for the loopback interface, with the global network
+*                       lock acquired) & 'RxHandledCtr' is ONLY written by the receive task.  Since both
+*                       counters are CPU word-sized, a reader always sees a consistent value.
+*
+*                   (c) Both counters are declared 'volatile' so that each read by the receive task (or
+*                       by the device ISR) fetches the value last written by the other context.
+*
+*               (3) The receive signal ONLY wakes the receive task.  Since the packet is published BEFORE
+*                   the signal is posted (see Note #2a) :
+*
+*                   (a) A packet is never lost if the receive task is already running.
+*
+*                   (b) A failed signal post does NOT discard the packet; it is handled when the receive
+*                       task is next signaled.  The failure is counted & returned to the caller, which MUST
+*                       NOT free the packet on this error.
 *
 *                   See also 'NetIF_RxTaskWait()  Note #2'.
 *********************************************************************************************************
@@ -4900,7 +4911,6 @@ exit_release:
 void  NetIF_RxTaskSignal (NET_IF_NBR   if_nbr,
                           NET_ERR     *p_err)
 {
-    CPU_ADDR  if_nbr_msg;
     KAL_ERR   err_kal;
 
 
@@ -4912,30 +4922,17 @@ void  NetIF_RxTaskSignal (NET_IF_NBR   if_nbr,
     }
 #endif
 
-    if_nbr_msg = (CPU_ADDR)if_nbr;                              /* Encode interface number of signaled receive.         */
-    KAL_QPost(        NetIF_RxQ_Handle,
-              (void *)if_nbr_msg,
-                      KAL_OPT_PEND_NONE,
-                     &err_kal);
-    switch (err_kal) {
-        case KAL_ERR_NONE:
-                                                                /* Increment number of receive packets queued ...       */
-             NetIF_RxPktInc(if_nbr);                            /* ... to a network interface (see Note #1b1A).         */
-            *p_err = NET_IF_ERR_NONE;
-             break;
-
-
-        case KAL_ERR_OVF:
-            *p_err = NET_IF_ERR_RX_Q_FULL;
-             break;
-
-
-        case KAL_ERR_RSRC:
-        case KAL_ERR_OS:
-        default:
-            *p_err = NET_IF_ERR_RX_Q_SIGNAL_FAULT;
-             break;
+                                                                /* Publish rx'd pkt to rx task (see Notes #1b1A & #2).  */
+    NetIF_RxPktInc(if_nbr);
+                                                                /* Wake rx task (see Note #3).                          */
+    KAL_SemPost(NetIF_RxSignal, KAL_OPT_POST_NONE, &err_kal);
+    if (err_kal != KAL_ERR_NONE) {                              /* If signal failed, pkt still q'd (see Note #3b).      */
+        NET_CTR_ERR_INC(Net_ErrCtrs.IFs.RxSignalFaultCtr);
+       *p_err = NET_IF_ERR_RX_Q_SIGNAL_FAULT;
+        return;
     }
+
+   *p_err = NET_IF_ERR_NONE;
 }
 
 
@@ -4995,26 +4992,18 @@ void  NetIF_RxTaskSignal (NET_IF_NBR   if_nbr,
 *                            'NetIF_TxSuspend()        Note #1',
 *                          & 'NetIF_TxSuspendSignal()  Note #1'.
 *
-*               (2) Network interfaces' 'RxPktCtr' variables MUST ALWAYS be accessed exclusively in
-*                   critical sections.
+*               (2) Network interfaces' 'RxSignalCtr' variables are ONLY written by this function & need
+*                   NO critical section (see 'NetIF_RxTaskSignal()  Note #2').
 *********************************************************************************************************
 */
 
 void  NetIF_RxPktInc (NET_IF_NBR  if_nbr)
 {
-    NET_ERR   err;
-#ifdef  NET_LOAD_BAL_MODULE_EN
-    NET_IF   *p_if;
+    NET_IF  *p_if;
 
 
     p_if = &NetIF_Tbl[if_nbr];
-    NetStat_CtrInc(&p_if->RxPktCtr, &err);                       /* Inc net IF's  nbr q'd rx pkts avail (see Note #1b1A).*/
-
-#else
-   (void)&if_nbr;                                               /* Prevent 'variable unused' compiler warning.          */
-#endif
-
-    NetStat_CtrInc(&NetIF_RxTaskPktCtr, &err);                  /* Inc rx task's nbr q'd rx pkts avail.                 */
+    p_if->RxSignalCtr++;                                        /* Inc net IF's nbr q'd rx pkts avail (see Note #1b1A). */
 }
 
 
@@ -5069,7 +5058,7 @@ void  NetIF_RxPktInc (NET_IF_NBR  if_nbr)
 *                       handled; the availability of network receive packets returned is conditionally
 *                       based on the consecutive number of times the availability is checked :
 *
-*                       (1) If the number of available network receive packets queued ('NetIF_RxPktCtr')
+*                       (1) If the number of available network receive packets queued (see Note #3)
 *                           is greater than the consecutive number of times the availability is checked
 *                           ('rx_chk_nbr'), then the actual availability of network receive packet is
 *                           returned.
@@ -5089,8 +5078,9 @@ void  NetIF_RxPktInc (NET_IF_NBR  if_nbr)
 *                               call NetIF_RxPktIsAvail() with 'rx_chk_nbr' initially set to 0 &
 *                               incremented by 1 for each consecutive call thereafter.
 *
-*               (3) Network interfaces' 'RxPktCtr' variables MUST ALWAYS be accessed exclusively in
-*                   critical sections.
+*               (3) The number of available network receive packets queued is the difference between a
+*                   network interface's 'RxSignalCtr' & 'RxHandledCtr'; both are read without a critical
+*                   section (see 'NetIF_RxTaskSignal()  Note #2').
 *********************************************************************************************************
 */
 
@@ -5100,16 +5090,15 @@ CPU_BOOLEAN  NetIF_RxPktIsAvail (NET_IF_NBR  if_nbr,
     CPU_BOOLEAN    rx_pkt_avail;
 #ifdef  NET_LOAD_BAL_MODULE_EN
     NET_IF        *p_if;
-    NET_STAT_CTR  *pstat_ctr;
-    CPU_SR_ALLOC();
+    NET_CTR        rx_pkt_nbr;
 
 
-    p_if      = &NetIF_Tbl[if_nbr];
-    pstat_ctr = &p_if->RxPktCtr;
-
-    CPU_CRITICAL_ENTER();
-    rx_pkt_avail = (pstat_ctr->CurCtr > rx_chk_nbr) ? DEF_YES : DEF_NO;     /* See Note #2a1.                           */
-    CPU_CRITICAL_EXIT();
+    p_if         = &NetIF_Tbl[if_nbr];
+    rx_pkt_nbr   = (NET_CTR)(p_if->RxSignalCtr - p_if->RxHandledCtr);
+    rx_pkt_avail =  DEF_NO;
+    if (rx_pkt_nbr > rx_chk_nbr) {                              /* See Note #2a1.                                       */
+        rx_pkt_avail = DEF_YES;
+    }
 
 #else
    (void)&if_nbr;                                               /* Prevent 'variable unused' compiler warnings.         */
@@ -5755,10 +5744,10 @@ void  NetIF_MTU_SetHandler (NET_IF_NBR   if_nbr,
 *
 *                   (a) (1) Create Network Interface Receive Task
 *
-*                       (2) Implement network interface receive queue by creating a message queue.
+*                       (2) Implement network interface receive signal by creating a counting semaphore.
 *
-*                           (A) Initialize network interface receive queue with no received packets by NOT
-*                               posting any messages to the queue.
+*                           (A) Initialize network interface receive signal with no signal by setting the
+*                               semaphore count to 0 to block the semaphore.
 *
 *                   (b) (1) Create Network Interface Transmit Deallocation Task
 *
@@ -5835,8 +5824,7 @@ static  void  NetIF_InitTaskObj (const  NET_TASK_CFG  *p_rx_task_cfg,
 
 
 
-    NetIF_RxQ_Handle = KAL_QCreate((const CPU_CHAR *)NET_IF_RX_Q_NAME,
-                                                     NET_CFG_IF_RX_Q_SIZE,
+    NetIF_RxSignal = KAL_SemCreate((const CPU_CHAR *)NET_IF_RX_SIGNAL_NAME,
                                                      DEF_NULL,
                                                     &err_kal);
     switch (err_kal) {
@@ -5862,9 +5850,6 @@ static  void  NetIF_InitTaskObj (const  NET_TASK_CFG  *p_rx_task_cfg,
     }
 
 
-    NetIF_RxQ_SizeCfg(NET_CFG_IF_RX_Q_SIZE);                    /* Configure network interface receive queue size.      */
-
-
     KAL_TaskCreate(NetIF_RxTaskHandle,
                    NetIF_RxTask,
                    DEF_NULL,
@@ -6292,15 +6277,13 @@ static  void  NetIF_RxTaskHandler (void)
 *********************************************************************************************************
 *                                          NetIF_RxTaskWait()
 *
-* Description : Wait on network interface receive queue for receive signal.
+* Description : Wait for a received packet on any network interface.
 *
 * Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_IF_ERR_NONE                 Network interface receive queue signal
-*                                                                   successfully  received.
-*                               NET_IF_ERR_RX_Q_EMPTY           Network interface receive queue empty.
-*                               NET_IF_ERR_RX_Q_SIGNAL_FAULT    Network interface receive queue signal
-*                                                                   fault.
+*                               NET_IF_ERR_NONE                 Network interface receive packet available.
+*                               NET_IF_ERR_RX_Q_EMPTY           NO network interface receive packet available.
+*                               NET_IF_ERR_RX_Q_SIGNAL_FAULT    Network interface receive signal fault.
 *
 * Return(s)   : Interface number of signaled receive, if NO error(s).
 *
@@ -6311,39 +6294,51 @@ static  void  NetIF_RxTaskHandler (void)
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : (1) (a) If timeouts NOT desired, wait on network interface receive queue until signaled
+* Note(s)     : (1) (a) If timeouts NOT desired, wait on network interface receive signal until signaled
 *                       (i.e. do NOT exit).
 *
-*                   (b) If timeout      desired, return NET_IF_ERR_RX_Q_EMPTY error on receive queue
+*                   (b) If timeout      desired, return NET_IF_ERR_RX_Q_EMPTY error on receive signal
 *                       timeout.  Implement timeout with OS-dependent functionality.
 *
-*               (2) Encoding/decoding the network interface number does NOT require any message size.
+*               (2) (a) Received packets are checked BEFORE & after waiting on the receive signal.  Since
+*                       the receive signal counts ALL signaled packets but the receive task handles every
+*                       published packet without waiting, the receive signal may wake the receive task
+*                       when NO packet remains; NET_IF_ERR_RX_Q_EMPTY is then returned.
+*
+*                   (b) Network interfaces are checked in round-robin order, starting after the last
+*                       interface handled, so that a busy interface does NOT starve the others.
 *
-*                   See also 'NetIF_RxTaskSignal()  Note #2'.
+*                   See also 'NetIF_RxTaskSignal()  Notes #2 & #3'.
 *********************************************************************************************************
 */
 
 static  NET_IF_NBR  NetIF_RxTaskWait (NET_ERR  *p_err)
 {
-    void         *p_rx_q;
-    CPU_ADDR      if_nbr_msg;
     NET_IF_NBR    if_nbr;
     KAL_ERR       err_kal;
 
-                                                                /* Wait on network interface receive task queue ...     */
+                                                                /* Chk for rx'd pkt (see Note #2a).                     */
+    if_nbr = NetIF_RxPktNextGet();
+    if (if_nbr != NET_IF_NBR_NONE) {
+       *p_err = NET_IF_ERR_NONE;
+        return (if_nbr);
+    }
+                                                                /* Wait on network interface receive signal ...         */
                                                                 /* ... preferably without timeout (see Note #1a).       */
-    p_rx_q = KAL_QPend(NetIF_RxQ_Handle, KAL_OPT_PEND_NONE, 0, &err_kal);
+    KAL_SemPend(NetIF_RxSignal, KAL_OPT_PEND_NONE, 0, &err_kal);
     switch (err_kal) {
         case KAL_ERR_NONE:
-             if_nbr_msg = (CPU_ADDR  )p_rx_q;
-             if_nbr     = (NET_IF_NBR)if_nbr_msg;               /* Decode interface number of signaled receive.         */
-            *p_err      =  NET_IF_ERR_NONE;
+             if_nbr = NetIF_RxPktNextGet();
+             if (if_nbr != NET_IF_NBR_NONE) {
+                *p_err  = NET_IF_ERR_NONE;
+             } else {
+                *p_err  = NET_IF_ERR_RX_Q_EMPTY;                /* See Note #2a.                                        */
+             }
              break;
 
 
         case KAL_ERR_TIMEOUT:
-             if_nbr = NET_IF_NBR_NONE;
-            *p_err   = NET_IF_ERR_RX_Q_EMPTY;                    /* See Note #1b.                                        */
+            *p_err   = NET_IF_ERR_RX_Q_EMPTY;                   /* See Note #1b.                                        */
              break;
 
 
@@ -6352,7 +6347,6 @@ static  NET_IF_NBR  NetIF_RxTaskWait (NET_ERR  *p_err)
         case KAL_ERR_WOULD_BLOCK:
         case KAL_ERR_OS:
         default:
-             if_nbr = NET_IF_NBR_NONE;
             *p_err  = NET_IF_ERR_RX_Q_SIGNAL_FAULT;
              break;
     }
@@ -6361,6 +6355,59 @@ static  NET_IF_NBR  NetIF_RxTaskWait (NET_ERR  *p_err)
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetIF_RxPktNextGet()
+*
+* Description : Get next network interface with received packet(s) to handle.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Number of network interface with received packet(s), if any.
+*
+*               NET_IF_NBR_NONE,                                   otherwise.
+*
+* Caller(s)   : NetIF_RxTaskWait().
+*
+* Note(s)     : (1) See 'NetIF_RxTaskWait()  Note #2b'.
+*
+*               (2) Network interfaces' receive counters are read without a critical section (see
+*                   'NetIF_RxTaskSignal()  Note #2b').
+*********************************************************************************************************
+*/
+
+static  NET_IF_NBR  NetIF_RxPktNextGet (void)
+{
+    NET_IF      *p_if;
+    NET_IF_NBR   if_nbr;
+    NET_IF_NBR   if_nbr_next;
+    NET_IF_NBR   if_ix;
+
+
+    if_nbr = NetIF_RxNbrNext;
+    for (if_ix = NetIF_NbrBase; if_ix < NET_IF_NBR_IF_TOT; if_ix++) {
+        if ((if_nbr <  NetIF_NbrBase) ||                        /* Wrap around IF tbl (see Note #1).                    */
+            (if_nbr >= NET_IF_NBR_IF_TOT)) {
+            if_nbr = NetIF_NbrBase;
+        }
+
+        p_if = &NetIF_Tbl[if_nbr];
+        if (p_if->RxSignalCtr != p_if->RxHandledCtr) {          /* If IF has rx'd pkt(s), ...                           */
+            if_nbr_next = if_nbr + 1u;
+            if (if_nbr_next >= NET_IF_NBR_IF_TOT) {
+                if_nbr_next = NetIF_NbrBase;
+            }
+            NetIF_RxNbrNext = if_nbr_next;                      /* ... chk next IF first on next call.                  */
+            return (if_nbr);
+        }
+
+        if_nbr++;
+    }
+
+    return (NET_IF_NBR_NONE);
+}
+
+
 /*
 *******************************************************************************************************
 *                                           NetIF_RxHandler()
@@ -6383,6 +6430,9 @@ static  NET_IF_NBR  NetIF_RxTaskWait (NET_ERR  *p_err)
 * Caller(s)   : NetIF_RxTaskHandler().
 *
 * Note(s)     : (2) Network buffer already freed by higher layer; only increment error counter.
+*
+*               (3) Each signaled receive packet MUST be consumed exactly once, whether or not it is
+*                   successfully received (see 'NetIF_RxTaskSignal()  Note #2').
 *********************************************************************************************************
 */
 
@@ -6401,7 +6451,7 @@ static  void  NetIF_RxHandler (NET_IF_NBR  if_nbr)
 
 
                                                                 /* ------------------ RX NET IF PKT ------------------- */
-    NetStat_CtrDec(&NetIF_RxTaskPktCtr, &err);                  /* Dec rx task's nbr q'd rx pkts avail.                 */
+    NetIF_RxPktDec(p_if);                                       /* Dec net IF's nbr q'd rx pkts avail (see Note #3).    */
 
     NET_CTR_STAT_INC(Net_StatCtrs.IFs.RxPktCtr);
     NET_CTR_STAT_INC(Net_StatCtrs.IFs.IF[if_nbr].RxNbrPktCtr);
@@ -6519,7 +6569,6 @@ static  void  NetIF_RxHandler (NET_IF_NBR  if_nbr)
 #ifdef  NET_LOAD_BAL_MODULE_EN
 static  void  NetIF_RxHandlerLoadBal (NET_IF  *p_if)
 {
-    NetIF_RxPktDec(p_if);                                        /* Dec net IF's nbr q'd rx pkts avail (see Note #1b1B). */
     NetIF_TxSuspendSignal(p_if);                                 /* Signal net tx suspend              (see Note #1b2B). */
 }
 #endif
@@ -6698,7 +6747,7 @@ static  NET_BUF_SIZE  NetIF_RxPkt (NET_IF   *p_if,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : NetIF_RxHandlerLoadBal().
+* Caller(s)   : NetIF_RxHandler().
 *
 * Note(s)     : (1) To balance network receive versus transmit packet loads for certain network connection
 *                   types (e.g. stream-type connections), network receive & transmit packets on each
@@ -6740,20 +6789,15 @@ static  NET_BUF_SIZE  NetIF_RxPkt (NET_IF   *p_if,
 *                            'NetIF_TxSuspend()        Note #1',
 *                          & 'NetIF_TxSuspendSignal()  Note #1'.
 *
-*               (2) Network interfaces' 'RxPktCtr' variables MUST ALWAYS be accessed exclusively in
-*                   critical sections.
+*               (2) Network interfaces' 'RxHandledCtr' variables are ONLY written by this function & need
+*                   NO critical section (see 'NetIF_RxTaskSignal()  Note #2').
 *********************************************************************************************************
 */
 
-#ifdef  NET_LOAD_BAL_MODULE_EN
 static  void  NetIF_RxPktDec (NET_IF  *p_if)
 {
-    NET_ERR  err;
-
-
-    NetStat_CtrDec(&p_if->RxPktCtr, &err);                       /* Dec net IF's nbr q'd rx pkts avail (see Note #1b1B). */
+    p_if->RxHandledCtr++;                                       /* Dec net IF's nbr q'd rx pkts avail (see Note #1b1B). */
 }
-#endif
 
 
 /*
@@ -6829,39 +6873,6 @@ static  void  NetIF_RxPktDiscard (NET_BUF  *p_buf,
 #endif
 
 
-/*
-*********************************************************************************************************
-*                                          NetIF_RxQ_SizeCfg()
-*
-* Description : Configure the maximum number of receive signals that may be concurrently queued to the
-*                   network interface receive queue.
-*
-* Argument(s) : size    Configured size of network interface receive queue :
-*
-*                           NET_IF_Q_SIZE_MAX                   Maximum configurable queue size
-*                                                                  (i.e. NO limit on queue size).
-*                           In number of receive signals,       otherwise.
-*
-* Return(s)   : none.
-*
-* Caller(s)   : NetIF_InitTaskObj().
-*
-*               This function is a board-support package function & SHOULD be called only by
-*               appropriate product function(s).
-*
-* Note(s)     : none.
-*********************************************************************************************************
-*/
-
-static  void  NetIF_RxQ_SizeCfg (NET_IF_Q_SIZE  size)
-{
-    NetIF_RxQ_SizeCfgd    = size;
-    NetIF_RxQ_SizeCfgdRem = size;
-
-   (void)&NetIF_RxQ_SizeCfgd;
-}
-
-
 /*
 *********************************************************************************************************
 *                                         NetIF_TxDeallocTask()
@@ -7091,6 +7102,11 @@ static  void  NetIF_TxDeallocQ_SizeCfg (NET_IF_Q_SIZE  size)
 * Caller(s)   : NetIF_Tx().
 *
 * Note(s)     : (2) Network buffer already freed by lower layer; only increment error counters.
+*
+*               (3) A packet with external data (see 'net_buf.h  NETWORK BUFFER EXTERNAL DATA DEFINES
+*                   Note #1') can NOT be transmitted by a device that does NOT gather packets -- including
+*                   the loopback interface, which copies transmit packets (see 'net_if.h  NETWORK INTERFACE
+*                   DATA TYPE  Note #4a').
 *********************************************************************************************************
 */
 
@@ -7144,6 +7160,16 @@ static  void  NetIF_TxHandler (NET_BUF  *p_buf,
     }
 
 
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)                    /* -------------- CHK NET IF EXT DATA TX -------------- */
+    if ((p_buf_hdr->ExtDataPtr != (CPU_INT08U *)0) &&           /* If pkt data ext but dev can NOT gather it, ...       */
+        (p_if_tx->DevTxExtDataEn != DEF_YES)) {                 /* ... discard tx pkt (see Note #3).                    */
+         NetIF_TxPktDiscard(p_buf, DEF_YES, &err);
+        *p_err = NET_ERR_TX;
+         return;
+    }
+#endif
+
+
                                                                 /* ------------------ TX NET IF PKT ------------------- */
     switch (if_nbr_tx) {
         case NET_IF_NBR_LOOPBACK:
@@ -7278,6 +7304,10 @@ static  void  NetIF_TxHandler (NET_BUF  *p_buf,
 *               (3) Network buffer already freed by lower layer.
 *
 *               (4) Error codes from network interface/device driver handler functions returned as is.
+*
+*               (5) A packet's external data is passed to the device driver's 'Tx()' function through the
+*                   network interface (see 'net_if.h  NETWORK INTERFACE DATA TYPE  Note #4b'), since the
+*                   generic device API is shared by ALL device drivers.
 *********************************************************************************************************
 */
 
@@ -7362,10 +7392,23 @@ static  NET_BUF_SIZE  NetIF_TxPkt (NET_IF   *p_if,
     DEF_BIT_SET(p_buf_hdr->Flags, NET_BUF_FLAG_TX_LOCK);         /* Protect tx pkt buf from concurrent access by dev hw. */
     NetIF_TxPktListInsert(p_buf);                                /* Insert  tx pkt buf into tx list.                     */
 
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)                     /* Pass any ext data to dev (see Note #5).              */
+    p_if->DevTxExtDataPtr = p_buf_hdr->ExtDataPtr;
+    if (p_buf_hdr->ExtDataPtr != (CPU_INT08U *)0) {
+        p_if->DevTxExtDataLen = p_buf_hdr->DataLen;
+    } else {
+        p_if->DevTxExtDataLen = 0u;
+    }
+#endif
+
 
                                                                 /* ---------------- TX PKT VIA NET DEV ---------------- */
     pdev_api = (NET_DEV_API *)p_if->Dev_API;
     pdev_api->Tx(p_if, p_data, size, p_err);
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    p_if->DevTxExtDataPtr = (CPU_INT08U *)0;
+    p_if->DevTxExtDataLen =  0u;
+#endif
     if (*p_err != NET_DEV_ERR_NONE) {
          NetIF_TxPktListRemove(p_buf);                           /* See Note #2a.                                        */
          NetIF_TxPktDiscard(p_buf, DEF_NO, &err);
@@ -8108,8 +8151,9 @@ static  void  NetIF_TxSuspendWait (NET_IF  *p_if)
 *
 * Caller(s)   : NetIF_BufPoolInit().
 *
-* Note(s)     : (2) (a) All added network interfaces MUST NOT configure a total number of receive  buffers
-*                       greater than the configured network interface receive queue size.
+* Note(s)     : (2) (a) The number of receive buffers is NOT limited by any network interface receive queue
+*                       size, since received packets are NOT queued to the receive task (see
+*                       'NetIF_RxTaskSignal()  Note #2').
 *
 *                   (b) All added network interfaces MUST NOT configure a total number of transmit buffers
 *                       greater than the configured network interface transmit deallocation queue size.
@@ -8180,11 +8224,6 @@ static  void  NetIF_BufPoolCfgValidate (NET_IF_NBR    if_nbr,
 
 
                                                                 /* ---------------- VALIDATE NBR BUFS ----------------- */
-    if (p_dev_cfg->RxBufLargeNbr > NetIF_RxQ_SizeCfgdRem) {     /* Validate nbr rx bufs (see Note #2a).                 */
-       *p_err = NET_IF_ERR_INVALID_POOL_QTY;
-        return;
-    }
-
     if (if_nbr != NET_IF_NBR_LOOPBACK) {                        /* For all non-loopback IF's (see Note #2b1), ...       */
         nbr_bufs_tx = p_dev_cfg->TxBufLargeNbr +
                       p_dev_cfg->TxBufSmallNbr;
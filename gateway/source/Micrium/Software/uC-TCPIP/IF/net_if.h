@@ -302,6 +302,16 @@ struct  net_if_link_subscriber_obj{
 *
 *           (3) Network interface enable/disable independent of physical hardware link state of the
 *               interface's associated device.
+*
+*           (4) (a) A network device driver that can gather a transmit packet from two memory blocks SHOULD
+*                   set 'DevTxExtDataEn' from its 'Init()' function; packets with external data (see
+*                   'net_buf.h  NETWORK BUFFER EXTERNAL DATA DEFINES  Note #1') are ONLY transmitted to
+*                   such devices.
+*
+*               (b) While a packet with external data is passed to the device driver's 'Tx()' function,
+*                   'DevTxExtDataPtr' & 'DevTxExtDataLen' reference the packet's external data; the 'Tx()'
+*                   'size' remains the packet's total size but ONLY its first ('size' - 'DevTxExtDataLen')
+*                   octets are at 'p_data'.  Otherwise, 'DevTxExtDataPtr' is NULL.
 **********************************************************************************************************
 */
 
@@ -336,16 +346,22 @@ struct  net_if {
     NET_TS_MS                    PerfMonTS_Prev_ms;     /* Perf mon prev TS (in ms).                                    */
 #endif
 
-#ifdef  NET_LOAD_BAL_MODULE_EN
-    NET_STAT_CTR                 RxPktCtr;              /* Indicates nbr of rx pkts q'd to IF but NOT yet handled.      */
-
+    volatile  NET_CTR            RxSignalCtr;           /* Nbr of rx pkts signaled by dev.                              */
+    volatile  NET_CTR            RxHandledCtr;          /* Nbr of rx pkts handled  by rx task.                          */
 
+#ifdef  NET_LOAD_BAL_MODULE_EN
     KAL_SEM_HANDLE               TxSuspendSignalObj;
     CPU_INT32U                   TxSuspendTimeout_ms;
     NET_STAT_CTR                 TxSuspendCtr;          /* Indicates nbr of tx conn's for  IF currently suspended.      */
 #endif
 
     KAL_SEM_HANDLE               DevTxRdySignalObj;
+
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    CPU_BOOLEAN                  DevTxExtDataEn;        /* Indicates dev can tx ext data (see Note #4a).                */
+    CPU_INT08U                  *DevTxExtDataPtr;       /* Ptr to cur tx pkt's ext data  (see Note #4b).                */
+    NET_BUF_SIZE                 DevTxExtDataLen;       /* Len of cur tx pkt's ext data  (in octets).                   */
+#endif
 };
 
 
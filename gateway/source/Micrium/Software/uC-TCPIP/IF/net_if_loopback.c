@@ -577,9 +577,6 @@ NET_BUF_SIZE  NetIF_Loopback_Rx (NET_IF   *p_if,
 *                               NET_ERR_TX                      Transmit error; packet discarded.
 *
 *                                                               ----- RETURNED BY NetIF_RxTaskSignal() : ------
-*                               NET_IF_ERR_RX_Q_FULL            Network interface receive queue full.
-*                               NET_IF_ERR_RX_Q_SIGNAL_FAULT    Network interface receive queue signal fault.
-*
 *                                                               ---------- RETURNED BY NetBuf_Get() : ---------
 *                                                               ------ RETURNED BY NetBuf_GetDataPtr() : ------
 *                               NET_IF_ERR_INVALID_IF           Invalid network interface number.
@@ -621,6 +618,10 @@ NET_BUF_SIZE  NetIF_Loopback_Rx (NET_IF   *p_if,
 *               (4) Since loopback transmit packets are NOT asynchronously transmitted from network
 *                   devices, they do NOT need to be asynchronously deallocated by the network interface
 *                   transmit deallocation task (see 'net_if.c  NetIF_TxDeallocTaskHandler()  Note #1a').
+*
+*               (5) A failed receive task signal does NOT discard the loopback receive packet, which is
+*                   handled when the receive task is next signaled (see 'net_if.c  NetIF_RxTaskSignal()
+*                   Note #3b'); so the receive buffer MUST NOT be freed on that error.
 *********************************************************************************************************
 */
 
@@ -758,10 +759,16 @@ NET_BUF_SIZE  NetIF_Loopback_Tx (NET_IF   *p_if,
 
                                                                         /* ------------ SIGNAL IF RX TASK ------------- */
     NetIF_RxTaskSignal(NET_IF_NBR_LOOPBACK, &err);
-    if (err != NET_IF_ERR_NONE) {
-        NetBuf_Free(p_buf_rx);                                          /* See Note #3c.                                */
-        NetIF_Loopback_TxPktDiscard(p_buf_tx, p_err);
-        return (0u);
+    switch (err) {
+        case NET_IF_ERR_NONE:
+        case NET_IF_ERR_RX_Q_SIGNAL_FAULT:                              /* Rx pkt still q'd (see Note #5).              */
+             break;
+
+
+        default:
+             NetBuf_Free(p_buf_rx);                                     /* See Note #3c.                                */
+             NetIF_Loopback_TxPktDiscard(p_buf_tx, p_err);
+             return (0u);
     }
 
 
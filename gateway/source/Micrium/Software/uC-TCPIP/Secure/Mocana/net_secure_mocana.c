@@ -57,6 +57,7 @@
 #include  "net_secure_mocana.h"
 #include  "../../Source/net_cfg_net.h"
 #include  "../../Source/net_sock.h"
+#include  "../../Source/net_tcp.h"
 #include  <lib_str.h>
 
 
@@ -80,6 +81,14 @@
 *********************************************************************************************************
 */
 
+#if ((NET_SECURE_CFG_TX_COALESCE_EN == DEF_ENABLED) && \
+     (defined(__ENABLE_MOCANA_SSL_ZERO_COPY__)))
+#define  NET_SECURE_TX_COALESCE_EN                              /* Coalesced records are flushed in place.              */
+
+#define  NET_SECURE_TX_COALESCE_TIMEOUT_TICK    (((NET_SECURE_CFG_TX_COALESCE_TIMEOUT_MS * NET_TMR_TIME_TICK_PER_SEC) \
+                                                  + DEF_TIME_NBR_mS_PER_SEC - 1u) / DEF_TIME_NBR_mS_PER_SEC)
+#endif
+
 
 
 /*
@@ -113,6 +122,11 @@ typedef  struct  net_secure_session {
     sbyte4                 ConnInstance;
     NET_SOCK_SECURE_TYPE   Type;
     void                  *DescPtr;
+#ifdef  NET_SECURE_TX_COALESCE_EN
+    CPU_INT08U            *TxCoalesceBufPtr;                    /* Clear data pending for the next coalesced rec.       */
+    CPU_INT16U             TxCoalesceLen;
+    NET_TMR               *TxCoalesceTmrPtr;                    /* Flush deadline tmr, if data pending.                 */
+#endif
 } NET_SECURE_SESSION;
 
 
@@ -121,6 +135,9 @@ typedef  struct  net_secure_mem_pools {
     MEM_DYN_POOL                SessionPool;
     MEM_DYN_POOL                ServerDescPool;
     MEM_DYN_POOL                ClientDescPool;
+#ifdef  NET_SECURE_TX_COALESCE_EN
+    MEM_DYN_POOL                TxCoalescePool;
+#endif
 } NET_SECURE_MEM_POOLS;
 
 
@@ -166,6 +183,29 @@ static     certDescriptor            NetSecure_CertKeyConvert            (const
                                                                                  NET_SOCK_SECURE_CERT_KEY_FMT    fmt,
                                                                                  NET_ERR                        *p_err);
 
+#ifdef __ENABLE_MOCANA_SSL_ZERO_COPY__
+static     CPU_INT16U                NetSecure_SockTxInPlace             (       NET_SOCK                       *p_sock,
+                                                                                 NET_SECURE_SESSION             *p_session,
+                                                                                 void                           *p_data_buf,
+                                                                                 CPU_INT16U                      data_buf_len,
+                                                                                 NET_ERR                        *p_err);
+#endif
+
+#ifdef  NET_SECURE_TX_COALESCE_EN
+static     CPU_INT16U                NetSecure_SockTxCoalesce            (       NET_SOCK                       *p_sock,
+                                                                                 NET_SECURE_SESSION             *p_session,
+                                                                                 void                           *p_data_buf,
+                                                                                 CPU_INT16U                      data_buf_len,
+                                                                                 NET_ERR                        *p_err);
+
+static     void                      NetSecure_SockTxCoalesceFlush       (       NET_SOCK                       *p_sock,
+                                                                                 NET_SECURE_SESSION             *p_session,
+                                                                                 CPU_BOOLEAN                     fallback,
+                                                                                 NET_ERR                        *p_err);
+
+static     void                      NetSecure_SockTxCoalesceTimeout     (       void                           *p_sock_timeout);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -214,6 +254,9 @@ static     certDescriptor            NetSecure_CertKeyConvert            (const
 *
 *                   This is required since an application's network protocol suite API function access is
 *                   asynchronous to other network protocol tasks.
+*
+*               (2) With __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__, the CA certificate is parsed once here &
+*                   server chains remembered as verified against the previously installed CA are forgotten.
 *********************************************************************************************************
 */
 
@@ -268,7 +311,18 @@ CPU_BOOLEAN  NetSecure_CA_CertIntall (const  void                 *p_ca_cert,
              goto exit;
     }
 
-   *p_err = NET_SECURE_ERR_NONE;
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__                  /* ---------------- PRE-PARSE TRUST ANCHOR --------------- */
+    SSL_clearCertVerifyCache();                                 /* Chains verified against the previous CA are stale.   */
+    rc = SSL_addTrustAnchor(CaCertDesc.pCertificate, CaCertDesc.certLength);
+    if (rc != OK) {
+       *p_err = NET_SECURE_ERR_INSTALL;
+        rtn_val = DEF_FAIL;
+        goto exit;
+    }
+#endif
+
+   *p_err   = NET_SECURE_ERR_NONE;
+    rtn_val = DEF_OK;
 
 exit:
     Net_GlobalLockRelease();
@@ -457,6 +511,21 @@ void  NetSecure_Init (NET_ERR  *p_err)
         return;
     }
 
+#ifdef  NET_SECURE_TX_COALESCE_EN
+    Mem_DynPoolCreate("SSL Tx Coalesce pool",
+                      &NetSecure_Pools.TxCoalescePool,
+                       DEF_NULL,
+                       NET_SECURE_CFG_TX_COALESCE_LEN,
+                       sizeof(CPU_ALIGN),
+                       0u,
+                       LIB_MEM_BLK_QTY_UNLIMITED,
+                      &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        SSL_TRACE_DBG(("Mem_DynPoolCreate() returned an error"));
+        return;
+    }
+#endif
+
 
 
  #ifdef NET_SECURE_MODULE_EN
@@ -538,6 +607,11 @@ void  NetSecure_InitSession (NET_SOCK  *p_sock,
     p_blk->ConnInstance   = 0u;
     p_blk->DescPtr        = DEF_NULL;
     p_blk->Type           = NET_SOCK_SECURE_TYPE_NONE;
+#ifdef  NET_SECURE_TX_COALESCE_EN
+    p_blk->TxCoalesceBufPtr = DEF_NULL;
+    p_blk->TxCoalesceLen    = 0u;
+    p_blk->TxCoalesceTmrPtr = DEF_NULL;
+#endif
     p_sock->SecureSession = p_blk;
 
 
@@ -1084,7 +1158,8 @@ CPU_BOOLEAN  NetSecure_ClientTrustCallBackSet (NET_SOCK                    *p_so
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) The maximum fragment length is only a request : a server that ignores the extension
+*                   keeps the default record size, & the handshake proceeds.
 *********************************************************************************************************
 */
 
@@ -1138,6 +1213,16 @@ void  NetSecure_SockConn (NET_SOCK  *p_sock,
     }
 #endif
 
+#if ((NET_SECURE_CFG_MAX_FRAG_LEN > 0u)   && \
+     (defined(__ENABLE_RFC3546__))        && \
+     (defined(__ENABLE_TLSEXT_RFC6066__)))
+                                                                /* Req small recs (see Note #1).                        */
+    rc = SSL_setMaxFragmentLength(p_session->ConnInstance, NET_SECURE_CFG_MAX_FRAG_LEN);
+    if (rc != OK) {
+        SSL_TRACE_DBG(("%s: %s returned: %s\n", __FUNCTION__, "SSL_setMaxFragmentLength", MERROR_lookUpErrorCode((MSTATUS)rc)));
+    }
+#endif
+
 
                                                             /* Perform SSL handshake.                                   */
     rc = -1;
@@ -1353,7 +1438,10 @@ exit:
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) A request MUST NOT wait on its own coalesced data : any clear data still held for
+*                   coalescing is transmitted before waiting for the peer's response.  Data that can NOT
+*                   be transmitted right now stays pending & is flushed by its timer (see
+*                   'NetSecure_SockTxCoalesceFlush()  Note #2').
 *********************************************************************************************************
 */
 
@@ -1377,6 +1465,14 @@ NET_SOCK_RTN_CODE  NetSecure_SockRxDataHandler (NET_SOCK    *p_sock,
 
     p_session = (NET_SECURE_SESSION *)p_sock->SecureSession;
 
+#ifdef  NET_SECURE_TX_COALESCE_EN                               /* Flush coalesced data before rx (see Note #1).        */
+    NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_YES, p_err);
+    if (*p_err == NET_ERR_TX) {                                 /* Rtn err only if pending data lost (see Note #1).     */
+       *p_err = NET_ERR_RX;
+        return (NET_SOCK_BSD_ERR_RX);
+    }
+#endif
+
     Net_GlobalLockRelease();
     rc = SSL_recv(          p_session->ConnInstance,
                             p_data_buf,
@@ -1495,7 +1591,12 @@ exit:
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) When the session's records can be formed in place, the clear data is copied once into a
+*                   TCP transmit network buffer & encrypted there (see 'NetSecure_SockTxInPlace()  Note #2');
+*                   otherwise the clear data is transmitted through SSL_send().
+*
+*               (2) Small clear data MAY be held & merged with the following writes into a single record
+*                   (see 'NetSecure_SockTxCoalesce()  Note #1').
 *********************************************************************************************************
 */
 
@@ -1507,10 +1608,48 @@ NET_SOCK_RTN_CODE  NetSecure_SockTxDataHandler (NET_SOCK    *p_sock,
 #ifdef   NET_SECURE_MODULE_EN
     NET_SECURE_SESSION  *p_session;
     sbyte4               rc = -1;
+#ifdef __ENABLE_MOCANA_SSL_ZERO_COPY__
+    CPU_INT16U           tx_len;
+#endif
 
     SSL_TRACE_DBG(("%s: Start\n", __FUNCTION__));
 
     p_session    = (NET_SECURE_SESSION *)p_sock->SecureSession;
+
+#ifdef  NET_SECURE_TX_COALESCE_EN                               /* Coalesce small data, if possible (see Note #2).      */
+    tx_len = NetSecure_SockTxCoalesce(p_sock, p_session, p_data_buf, data_buf_len, p_err);
+    switch (*p_err) {
+        case NET_SOCK_ERR_NONE:
+             SSL_TRACE_DBG(("%s: Normal exit\n", __FUNCTION__));
+             return (tx_len);
+
+
+        case NET_SECURE_ERR_NOT_AVAIL:
+             break;
+
+
+        default:
+             return (NET_SOCK_BSD_ERR_TX);
+    }
+#endif
+
+#ifdef __ENABLE_MOCANA_SSL_ZERO_COPY__                          /* Tx in place, if possible (see Note #1).              */
+    tx_len = NetSecure_SockTxInPlace(p_sock, p_session, p_data_buf, data_buf_len, p_err);
+    switch (*p_err) {
+        case NET_SOCK_ERR_NONE:
+             SSL_TRACE_DBG(("%s: Normal exit\n", __FUNCTION__));
+             return (tx_len);
+
+
+        case NET_SECURE_ERR_NOT_AVAIL:
+             break;
+
+
+        default:
+             return (NET_SOCK_BSD_ERR_TX);
+    }
+#endif
+
     Net_GlobalLockRelease();
     rc = SSL_send(p_session->ConnInstance, p_data_buf, data_buf_len);
     Net_GlobalLockAcquire((void *)&NetSecure_SockTxDataHandler, p_err);
@@ -1539,8 +1678,9 @@ NET_SOCK_RTN_CODE  NetSecure_SockTxDataHandler (NET_SOCK    *p_sock,
 * Description : (1) Close the secure socket :
 *
 *                   (a) Get & validate the SSL session of the socket to close
-*                   (b) Transmit close notify alert to the peer
-*                   (c) Free the SSL session buffer
+*                   (b) Flush coalesced clear data                                      See Note #2
+*                   (c) Transmit close notify alert to the peer
+*                   (d) Free the SSL session buffer
 *
 *
 * Argument(s) : p_sock      Pointer to a socket.
@@ -1559,7 +1699,11 @@ NET_SOCK_RTN_CODE  NetSecure_SockTxDataHandler (NET_SOCK    *p_sock,
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) An application close flushes coalesced clear data through SSL_send(), if needed, in
+*                   NetSecure_SockCloseNotify() (see 'NetSecure_SockCloseNotify()  Note #3') before the
+*                   session is closed.  NetSecure_SockClose() is also called when the connection is closed
+*                   or faulted by the network tasks, which MUST NOT release the global network lock; any
+*                   data still pending then is flushed only if its record can be formed in place.
 *********************************************************************************************************
 */
 
@@ -1572,6 +1716,9 @@ void  NetSecure_SockClose (NET_SOCK  *p_sock,
     NET_SECURE_SERVER_DESC  *p_server_desc;
     NET_SECURE_CLIENT_DESC  *p_client_desc;
     LIB_ERR                  err;
+#ifdef  NET_SECURE_TX_COALESCE_EN
+    NET_ERR                  net_err;
+#endif
 
 
     SSL_TRACE_DBG(("%s: Start\n", __FUNCTION__));
@@ -1579,6 +1726,22 @@ void  NetSecure_SockClose (NET_SOCK  *p_sock,
     p_session = (NET_SECURE_SESSION *)p_sock->SecureSession;
 
     if (p_session != DEF_NULL) {
+#ifdef  NET_SECURE_TX_COALESCE_EN                               /* Flush coalesced data, if possible (see Note #2).     */
+        NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_NO, &net_err);
+        if (p_session->TxCoalesceTmrPtr != DEF_NULL) {
+            NetTmr_Free(p_session->TxCoalesceTmrPtr);
+            p_session->TxCoalesceTmrPtr = DEF_NULL;
+        }
+        if (p_session->TxCoalesceBufPtr != DEF_NULL) {
+            Mem_DynPoolBlkFree(&NetSecure_Pools.TxCoalescePool, p_session->TxCoalesceBufPtr, &err);
+            if (err != LIB_MEM_ERR_NONE) {
+                SSL_TRACE_DBG(("Mem_DynPoolBlkFree() returned an error:\n"));
+            }
+            p_session->TxCoalesceBufPtr = DEF_NULL;
+            p_session->TxCoalesceLen    = 0u;
+        }
+#endif
+
         SSL_TRACE_DBG(("SSL_closeConnection: ConnInstance = %d\n", p_session->ConnInstance));
         status = SSL_closeConnection(p_session->ConnInstance);
         if (status != OK) {
@@ -1682,14 +1845,31 @@ void  NetSecure_SockClose (NET_SOCK  *p_sock,
 *                       connection can be closed by the client. In that case, the SSL session will no
 *                       longer be valid and it will be impossible to send the close notify alert through
 *                       that session.
+*
+*               (3) Clear data held for coalescing was reported as transmitted to the application; it is
+*                   transmitted before the close notify alert, through SSL_send() if its record can NOT
+*                   be formed in place.  As in NetSecure_SockRxDataHandler(), the global network lock is
+*                   released while SSL_send() transmits.
 *********************************************************************************************************
 */
 
 void  NetSecure_SockCloseNotify (NET_SOCK  *p_sock,
                                  NET_ERR   *p_err)
 {
+#ifdef  NET_SECURE_TX_COALESCE_EN
+    NET_SECURE_SESSION  *p_session;
+#endif
+
+
     SSL_TRACE_DBG(("%s: Start\n", __FUNCTION__));
 
+#ifdef  NET_SECURE_TX_COALESCE_EN                               /* Flush coalesced data (see Note #3).                  */
+    p_session = (NET_SECURE_SESSION *)p_sock->SecureSession;
+    if (p_session != DEF_NULL) {
+        NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_YES, p_err);
+    }
+#endif
+
     NetSecure_SockClose(p_sock, p_err);
 
     SSL_TRACE_DBG(("%s: Normal exit\n", __FUNCTION__));
@@ -1731,6 +1911,434 @@ void  NetSecure_MocanaFnctLog (sbyte4   module,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetSecure_SockTxInPlace()
+*
+* Description : Transmit clear data through a secure socket without intermediate copies :
+*
+*                   (a) Get a TCP transmit network buffer with room for the whole SSL record
+*                   (b) Copy the clear data into the network buffer, at the record's payload offset
+*                   (c) Encrypt the record in place
+*                   (d) Queue the network buffer on the TCP connection
+*
+*
+* Argument(s) : p_sock          Pointer to a transmit socket.
+*               ------          Argument checked in NetSock_TxDataHandler().
+*
+*               p_session       Pointer to the socket's secure session.
+*
+*               p_data_buf      Pointer to application data to transmit.
+*               ----------      Argument checked in NetSock_TxDataHandler().
+*
+*               data_buf_len    Length of  application data to transmit (in octets).
+*               ------------    Argument checked in NetSock_TxDataHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Clear data   successfully transmitted.
+*                               NET_SECURE_ERR_NOT_AVAIL        Clear data NOT transmitted; transmit via
+*                                                                   SSL_send() (see Notes #2 & #4).
+*                               NET_ERR_TX                      Transmit error; TCP connection reset
+*                                                                   (see Note #3).
+*
+* Return(s)   : Number of positive data octets transmitted, if NO error(s).
+*
+*               0,                                            otherwise.
+*
+* Caller(s)   : NetSecure_SockTxDataHandler().
+*
+* Note(s)     : (1) NetSecure_SockTxInPlace() MUST be called with the global network lock acquired; the
+*                   lock is held from the network buffer allocation until the record is queued so that the
+*                   record's sequence number matches its position in the TCP stream.
+*
+*               (2) The in-place path is only used when the whole clear data fits in a single record,
+*                   including any negotiated maximum fragment length, & a single TCP segment that can be
+*                   queued immediately; otherwise NO record is formed & the clear data is transmitted
+*                   through the regular SSL_send() path.
+*
+*               (3) Every check that can fail -- transmit window, segment addresses & network buffer -- is
+*                   run by NetTCP_TxConnAppBufGet() BEFORE the record is encrypted.  Once SSL_sendInPlace()
+*                   may have consumed the record's sequence number, the record MUST either be queued or
+*                   the TCP connection reset (see 'NetTCP_TxConnAppBufAbort()  Note #1'); dropping the
+*                   record alone would desynchronize the peer's record sequence.
+*
+*               (4) SSL_sendInPlace() returns ERR_SSL_CONNECTION_BUSY, before consuming anything, while
+*                   the session is blocked by another task (e.g. a close in progress); the clear data is
+*                   NOT transmitted & NET_SECURE_ERR_NOT_AVAIL is returned so that coalesced data is kept
+*                   pending (see 'NetSecure_SockTxCoalesceFlush()  Note #2').
+*********************************************************************************************************
+*/
+
+#ifdef __ENABLE_MOCANA_SSL_ZERO_COPY__
+static  CPU_INT16U  NetSecure_SockTxInPlace (NET_SOCK            *p_sock,
+                                             NET_SECURE_SESSION  *p_session,
+                                             void                *p_data_buf,
+                                             CPU_INT16U           data_buf_len,
+                                             NET_ERR             *p_err)
+{
+    NET_CONN_ID   conn_id_tcp;
+    NET_BUF      *p_buf;
+    NET_BUF_SIZE  data_ix;
+    CPU_INT32U    rec_len_max;
+    ubyte4        hdr_len;
+    ubyte4        trailer_len;
+    ubyte4        data_len_max;
+    ubyte4        rec_len;
+    sbyte4        rc;
+    NET_ERR       err;
+
+
+   *p_err = NET_SECURE_ERR_NOT_AVAIL;
+
+    rc = SSL_getRecordOverhead(p_session->ConnInstance, &hdr_len, &trailer_len, &data_len_max);
+    if (rc != OK) {
+        return (0u);
+    }
+
+    if (data_buf_len > data_len_max) {                          /* Rec would be fragmented (see Note #2).               */
+        return (0u);
+    }
+
+    rec_len_max = hdr_len + data_buf_len + trailer_len;
+    if (rec_len_max > DEF_INT_16U_MAX_VAL) {
+        return (0u);
+    }
+
+    conn_id_tcp = NetConn_ID_TransportGet(p_sock->ID_Conn, &err);
+    if (err != NET_CONN_ERR_NONE) {
+        return (0u);
+    }
+
+                                                                /* ---------------- GET TCP TX NET BUF ---------------- */
+    p_buf = NetTCP_TxConnAppBufGet((NET_TCP_CONN_ID)conn_id_tcp,
+                                   (CPU_INT16U     )rec_len_max,
+                                                   &data_ix,
+                                                   &err);
+    if (err != NET_TCP_ERR_NONE) {
+        return (0u);
+    }
+
+                                                                /* ------------ WR CLEAR DATA AS REC PAYLOAD ---------- */
+    NetBuf_DataWr(p_buf, data_ix + hdr_len, data_buf_len, p_data_buf, &err);
+    if (err != NET_BUF_ERR_NONE) {
+        NetBuf_Free(p_buf);
+        return (0u);
+    }
+
+                                                                /* ----------------- ENCRYPT IN PLACE ----------------- */
+    rc = SSL_sendInPlace(p_session->ConnInstance, &p_buf->DataPtr[data_ix], data_buf_len, &rec_len);
+    if ((rc == ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE) ||          /* NO rec formed (see Note #2) ...                      */
+        (rc == ERR_SSL_CONNECTION_BUSY)) {                      /* ... or session busy (see Note #4).                   */
+        NetBuf_Free(p_buf);
+        return (0u);
+    }
+    if (rc != OK) {                                             /* Rec seq nbr MAY be consumed (see Note #3).           */
+        SSL_TRACE_DBG(("%s: %s returned: %s\n", __FUNCTION__, "SSL_sendInPlace", MERROR_lookUpErrorCode((MSTATUS)rc)));
+        NetTCP_TxConnAppBufAbort((NET_TCP_CONN_ID)conn_id_tcp, p_buf);
+       *p_err = NET_ERR_TX;
+        return (0u);
+    }
+
+                                                                /* ------------------ Q REC ON TCP CONN --------------- */
+   (void)NetTCP_TxConnAppBufQ((NET_TCP_CONN_ID)conn_id_tcp,     /* See Note #3.                                         */
+                                               p_buf,
+                                               data_ix,
+                              (CPU_INT16U     )rec_len,
+                                              &err);
+    if (err != NET_TCP_ERR_NONE) {
+       *p_err = NET_ERR_TX;
+        return (0u);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (data_buf_len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetSecure_SockTxCoalesce()
+*
+* Description : Hold small clear data to be transmitted with the following writes in a single record :
+*
+*                   (a) Flush pending clear data that the new data would NOT fit with
+*                   (b) Append the new data to the session's coalesce buffer
+*                   (c) Start the flush timeout on the first pending octets
+*
+*
+* Argument(s) : p_sock          Pointer to a transmit socket.
+*               ------          Argument checked in NetSock_TxDataHandler().
+*
+*               p_session       Pointer to the socket's secure session.
+*
+*               p_data_buf      Pointer to application data to transmit.
+*               ----------      Argument checked in NetSock_TxDataHandler().
+*
+*               data_buf_len    Length of  application data to transmit (in octets).
+*               ------------    Argument checked in NetSock_TxDataHandler().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Clear data   successfully coalesced.
+*                               NET_SECURE_ERR_NOT_AVAIL        Clear data NOT coalesced; NO data pending,
+*                                                                   transmit directly.
+*                               NET_ERR_TX                      Clear data NOT coalesced; transmit error or
+*                                                                   data still pending (see Note #2).
+*
+* Return(s)   : Number of positive data octets coalesced, if NO error(s).
+*
+*               0,                                         otherwise.
+*
+* Caller(s)   : NetSecure_SockTxDataHandler().
+*
+* Note(s)     : (1) Only data shorter than the coalesce buffer &, once a record is formed, the session's
+*                   maximum record payload is held.  Held data is transmitted in place when the buffer
+*                   can NOT take the next write, when the socket receives or closes, or when the flush
+*                   timeout expires (see 'net_cfg.h  NETWORK SECURITY MANAGER CONFIGURATION  Note #3').
+*
+*               (2) Pending data MUST be flushed before any record is transmitted directly so that the
+*                   clear data stream is NOT reordered; if pending data can NOT be flushed, the new data
+*                   is NOT accepted.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_SECURE_TX_COALESCE_EN
+static  CPU_INT16U  NetSecure_SockTxCoalesce (NET_SOCK            *p_sock,
+                                              NET_SECURE_SESSION  *p_session,
+                                              void                *p_data_buf,
+                                              CPU_INT16U           data_buf_len,
+                                              NET_ERR             *p_err)
+{
+    ubyte4      hdr_len;
+    ubyte4      trailer_len;
+    ubyte4      data_len_max;
+    CPU_INT16U  coalesce_len_max;
+    sbyte4      rc;
+    LIB_ERR     err_lib;
+    NET_ERR     err;
+
+
+    rc = SSL_getRecordOverhead(p_session->ConnInstance, &hdr_len, &trailer_len, &data_len_max);
+    if (rc != OK) {                                             /* Recs can NOT be formed in place (see Note #2).       */
+        NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_YES, p_err);
+       *p_err = (*p_err == NET_SOCK_ERR_NONE) ? NET_SECURE_ERR_NOT_AVAIL : NET_ERR_TX;
+        return (0u);
+    }
+
+    coalesce_len_max = NET_SECURE_CFG_TX_COALESCE_LEN;
+    if (coalesce_len_max > data_len_max) {
+        coalesce_len_max = (CPU_INT16U)data_len_max;
+    }
+
+                                                                /* ------------- FLUSH PENDING, IF NO ROOM ------------ */
+    if ((p_session->TxCoalesceLen + data_buf_len) > coalesce_len_max) {
+        NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_YES, p_err);
+        if (*p_err != NET_SOCK_ERR_NONE) {                      /* Data still pending (see Note #2).                    */
+           *p_err = NET_ERR_TX;
+            return (0u);
+        }
+    }
+
+    if (data_buf_len >= coalesce_len_max) {                     /* Tx large data directly (see Note #1).                */
+       *p_err = NET_SECURE_ERR_NOT_AVAIL;
+        return (0u);
+    }
+
+                                                                /* ------------------- APPEND DATA -------------------- */
+    if (p_session->TxCoalesceBufPtr == DEF_NULL) {
+        p_session->TxCoalesceBufPtr = (CPU_INT08U *)Mem_DynPoolBlkGet(&NetSecure_Pools.TxCoalescePool, &err_lib);
+        if (err_lib != LIB_MEM_ERR_NONE) {
+            p_session->TxCoalesceBufPtr = DEF_NULL;
+           *p_err = NET_SECURE_ERR_NOT_AVAIL;
+            return (0u);
+        }
+    }
+
+    Mem_Copy(&p_session->TxCoalesceBufPtr[p_session->TxCoalesceLen], p_data_buf, data_buf_len);
+    p_session->TxCoalesceLen += data_buf_len;
+
+                                                                /* ------------------ START FLUSH TMR ----------------- */
+    if (p_session->TxCoalesceTmrPtr == DEF_NULL) {
+        p_session->TxCoalesceTmrPtr = NetTmr_Get((CPU_FNCT_PTR )&NetSecure_SockTxCoalesceTimeout,
+                                                 (void        *) p_sock,
+                                                 (NET_TMR_TICK ) NET_SECURE_TX_COALESCE_TIMEOUT_TICK,
+                                                 (NET_TMR_FLAGS) NET_TMR_FLAG_NONE,
+                                                 (NET_ERR     *)&err);
+        if (err != NET_TMR_ERR_NONE) {                          /* If NO tmr avail, flush now.                          */
+            p_session->TxCoalesceTmrPtr = DEF_NULL;
+            NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_YES, p_err);
+            if (*p_err == NET_ERR_TX) {                         /* Data still pending is flushed by next tx/rx/close.   */
+                return (0u);
+            }
+        }
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (data_buf_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   NetSecure_SockTxCoalesceFlush()
+*
+* Description : Transmit the clear data held for coalescing as a single record.
+*
+* Argument(s) : p_sock          Pointer to a transmit socket.
+*
+*               p_session       Pointer to the socket's secure session.
+*
+*               fallback        Indicate whether the data may be transmitted through SSL_send() if the
+*                               record can NOT be formed in place (see Note #1) :
+*
+*                                   DEF_YES                     Fall back to SSL_send().
+*                                   DEF_NO                      Keep the data pending.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               NO clear data pending.
+*                               NET_SECURE_ERR_NOT_AVAIL        Clear data still pending (see Note #2).
+*                               NET_ERR_TX                      Transmit error; pending data discarded
+*                                                                   (see Note #3).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetSecure_SockTxCoalesce(),
+*               NetSecure_SockTxCoalesceTimeout(),
+*               NetSecure_SockRxDataHandler(),
+*               NetSecure_SockCloseNotify(),
+*               NetSecure_SockClose().
+*
+* Note(s)     : (1) SSL_send() acquires the global network lock : it can only be called from a task that
+*                   may release the lock, NOT from the network timer task.
+*
+*               (2) The application was told that coalesced data was transmitted; it is therefore kept
+*                   pending whenever it can NOT be transmitted right now, e.g. while the TCP transmit
+*                   window is closed or while another task holds the session (ERR_SSL_CONNECTION_BUSY).
+*                   The flush timer keeps running until NO data is pending.
+*
+*               (3) Pending data is discarded only if its transmission failed for good : a failed in-place
+*                   record resets the TCP connection (see 'NetSecure_SockTxInPlace()  Note #3') & any other
+*                   SSL_send() error leaves the session unusable.
+*********************************************************************************************************
+*/
+
+static  void  NetSecure_SockTxCoalesceFlush (NET_SOCK            *p_sock,
+                                             NET_SECURE_SESSION  *p_session,
+                                             CPU_BOOLEAN          fallback,
+                                             NET_ERR             *p_err)
+{
+    sbyte4  rc;
+
+
+    if (p_session->TxCoalesceLen == 0u) {
+       *p_err = NET_SOCK_ERR_NONE;
+        return;
+    }
+
+   (void)NetSecure_SockTxInPlace(p_sock,
+                                 p_session,
+                                 p_session->TxCoalesceBufPtr,
+                                 p_session->TxCoalesceLen,
+                                 p_err);
+    switch (*p_err) {
+        case NET_SOCK_ERR_NONE:
+             p_session->TxCoalesceLen = 0u;
+             break;
+
+
+        case NET_SECURE_ERR_NOT_AVAIL:
+             if (fallback != DEF_YES) {                         /* Keep data pending (see Notes #1 & #2).               */
+                 break;
+             }
+             Net_GlobalLockRelease();
+             rc = SSL_send(p_session->ConnInstance, (sbyte *)p_session->TxCoalesceBufPtr, p_session->TxCoalesceLen);
+             Net_GlobalLockAcquire((void *)&NetSecure_SockTxCoalesceFlush, p_err);
+             if (rc == ERR_SSL_CONNECTION_BUSY) {               /* Keep data pending (see Note #2).                     */
+                *p_err = NET_SECURE_ERR_NOT_AVAIL;
+                 break;
+             }
+             p_session->TxCoalesceLen = 0u;
+             if (0 > rc) {
+                 SSL_TRACE_DBG(("%s: %s returned: %s\n", __FUNCTION__, "SSL_send", MERROR_lookUpErrorCode((MSTATUS)rc)));
+                *p_err = NET_ERR_TX;
+                 break;
+             }
+            *p_err = NET_SOCK_ERR_NONE;
+             break;
+
+
+        case NET_ERR_TX:                                        /* TCP conn reset (see Note #3).                        */
+        default:
+             p_session->TxCoalesceLen = 0u;
+             break;
+    }
+
+    if ((p_session->TxCoalesceLen    == 0u) &&                  /* Stop flush tmr once NO data pending.                 */
+        (p_session->TxCoalesceTmrPtr != DEF_NULL)) {
+        NetTmr_Free(p_session->TxCoalesceTmrPtr);
+        p_session->TxCoalesceTmrPtr = DEF_NULL;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                  NetSecure_SockTxCoalesceTimeout()
+*
+* Description : Flush the clear data held for coalescing when its timeout expires.
+*
+* Argument(s) : p_sock_timeout  Pointer to the socket whose coalesce timeout expired.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Referenced in NetSecure_SockTxCoalesce(),
+*                             NetSecure_SockTxCoalesceTimeout().
+*
+* Note(s)     : (1) The network timer is freed by the timer task before this callback is called; its
+*                   pointer MUST be cleared so that it is NOT freed again.
+*
+*               (2) If the record can NOT be formed in place (e.g. the TCP transmit window is closed or
+*                   the session is busy), the timeout is restarted.  The data is also flushed by the
+*                   socket's next transmit, receive or close.
+*********************************************************************************************************
+*/
+
+static  void  NetSecure_SockTxCoalesceTimeout (void  *p_sock_timeout)
+{
+    NET_SOCK            *p_sock;
+    NET_SECURE_SESSION  *p_session;
+    NET_ERR              err;
+
+
+    p_sock    = (NET_SOCK           *)p_sock_timeout;
+    p_session = (NET_SECURE_SESSION *)p_sock->SecureSession;
+    if (p_session == DEF_NULL) {
+        return;
+    }
+
+    p_session->TxCoalesceTmrPtr = DEF_NULL;                     /* See Note #1.                                         */
+
+    NetSecure_SockTxCoalesceFlush(p_sock, p_session, DEF_NO, &err);
+    if (err != NET_SECURE_ERR_NOT_AVAIL) {
+        return;
+    }
+                                                                /* Restart tmr (see Note #2).                           */
+    p_session->TxCoalesceTmrPtr = NetTmr_Get((CPU_FNCT_PTR )&NetSecure_SockTxCoalesceTimeout,
+                                             (void        *) p_sock,
+                                             (NET_TMR_TICK ) NET_SECURE_TX_COALESCE_TIMEOUT_TICK,
+                                             (NET_TMR_FLAGS) NET_TMR_FLAG_NONE,
+                                             (NET_ERR     *)&err);
+    if (err != NET_TMR_ERR_NONE) {
+        p_session->TxCoalesceTmrPtr = DEF_NULL;
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     NetSecure_CertificateStoreVerify()
@@ -332,6 +332,64 @@ CPU_BOOLEAN         NetSecure_CA_CertIntall         (const  void
 #endif
 
 
+#ifndef  NET_SECURE_CFG_TX_COALESCE_EN
+#error  "NET_SECURE_CFG_TX_COALESCE_EN             not #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be  DEF_DISABLED]           "
+#error  "                                    [     ||  DEF_ENABLED ]           "
+
+#elif  ((NET_SECURE_CFG_TX_COALESCE_EN != DEF_DISABLED) && \
+        (NET_SECURE_CFG_TX_COALESCE_EN != DEF_ENABLED ))
+#error  "NET_SECURE_CFG_TX_COALESCE_EN       illegally #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be  DEF_DISABLED]           "
+#error  "                                    [     ||  DEF_ENABLED ]           "
+
+#elif   (NET_SECURE_CFG_TX_COALESCE_EN == DEF_ENABLED)
+
+#ifndef  NET_SECURE_CFG_TX_COALESCE_LEN
+#error  "NET_SECURE_CFG_TX_COALESCE_LEN            not #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be  >= 1    ]               "
+#error  "                                    [     &&  <= 16384]               "
+
+#elif   (DEF_CHK_VAL(NET_SECURE_CFG_TX_COALESCE_LEN, 1, 16384) != DEF_OK)
+#error  "NET_SECURE_CFG_TX_COALESCE_LEN      illegally #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be  >= 1    ]               "
+#error  "                                    [     &&  <= 16384]               "
+#endif
+
+#ifndef  NET_SECURE_CFG_TX_COALESCE_TIMEOUT_MS
+#error  "NET_SECURE_CFG_TX_COALESCE_TIMEOUT_MS     not #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be  > 0]                    "
+
+#elif   (DEF_CHK_VAL_MIN(NET_SECURE_CFG_TX_COALESCE_TIMEOUT_MS, 1) != DEF_OK)
+#error  "NET_SECURE_CFG_TX_COALESCE_TIMEOUT_MS illegally #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be  > 0]                    "
+#endif
+
+#endif
+
+
+#ifndef  NET_SECURE_CFG_MAX_FRAG_LEN
+#error  "NET_SECURE_CFG_MAX_FRAG_LEN               not #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be     0]                   "
+#error  "                                    [     ||   512]                   "
+#error  "                                    [     ||  1024]                   "
+#error  "                                    [     ||  2048]                   "
+#error  "                                    [     ||  4096]                   "
+
+#elif  ((NET_SECURE_CFG_MAX_FRAG_LEN !=    0u) && \
+        (NET_SECURE_CFG_MAX_FRAG_LEN !=  512u) && \
+        (NET_SECURE_CFG_MAX_FRAG_LEN != 1024u) && \
+        (NET_SECURE_CFG_MAX_FRAG_LEN != 2048u) && \
+        (NET_SECURE_CFG_MAX_FRAG_LEN != 4096u))
+#error  "NET_SECURE_CFG_MAX_FRAG_LEN         illegally #define'd in 'net_cfg.h'"
+#error  "                                    [MUST be     0]                   "
+#error  "                                    [     ||   512]                   "
+#error  "                                    [     ||  1024]                   "
+#error  "                                    [     ||  2048]                   "
+#error  "                                    [     ||  4096]                   "
+#endif
+
+
 #endif
 
 
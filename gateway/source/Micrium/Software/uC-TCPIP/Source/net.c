@@ -101,6 +101,11 @@ static  KAL_LOCK_HANDLE    Net_GlobalLock;
 
 static  void              *Net_GlobaLockFcntPtr;
 
+#if ((NET_CTR_CFG_STAT_EN == DEF_ENABLED) && \
+     (CPU_CFG_TS_32_EN    == DEF_ENABLED))
+static  CPU_TS32           Net_GlobalLockTS;                    /* TS of last global lock acquisition.                  */
+#endif
+
         CPU_INT32U         Net_Version = NET_VERSION;
 
 
@@ -550,17 +555,54 @@ void  Net_InitCompSignal (NET_ERR  *p_err)
 *                           from functioning.
 *
 *                   (b) Network access MUST be acquired exclusively by only a single task at any one time.
+*
+*                   (c) Network access is NOT yet split into per-socket or per-connection locks.  Network
+*                       buffer pools, timers, connection tables & interface transmit are shared by every
+*                       protocol layer & would each need their own lock first; this work is deferred.  The
+*                       lock hold time statistics (see Note #2) identify the holders to split first.
+*
+*               (2) (a) If statistic counters are enabled, the lock is first tried without blocking so that
+*                       contended acquisitions & the time waited for them may be counted (see 'net_ctr.h
+*                       GLOBAL LOCK STATISTIC COUNTERS').
+*
+*                   (b) Lock statistics are ONLY updated while the lock is held & thus need NO critical
+*                       section.
 *********************************************************************************************************
 */
 
 void  Net_GlobalLockAcquire (void     *p_fcnt,
                              NET_ERR  *p_err)
 {
-    KAL_ERR  err_kal;
+    KAL_ERR      err_kal;
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)
+    CPU_BOOLEAN  contended;
+#if (CPU_CFG_TS_32_EN    == DEF_ENABLED)
+    CPU_TS32     ts_wait;
+    CPU_TS32     ts_delta;
+#endif
+#endif
+
 
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)                        /* Try lock without blocking (see Note #2a).            */
+    contended = DEF_NO;
+#if (CPU_CFG_TS_32_EN    == DEF_ENABLED)
+    ts_wait   = 0u;
+#endif
+    KAL_LockAcquire(Net_GlobalLock, KAL_OPT_PEND_NON_BLOCKING, 0u, &err_kal);
+    if (err_kal == KAL_ERR_WOULD_BLOCK) {
+        contended = DEF_YES;
+#if (CPU_CFG_TS_32_EN    == DEF_ENABLED)
+        ts_wait   = CPU_TS_Get32();
+#endif
+                                                                /* Acquire exclusive network access (see Note #1b) ...  */
+                                                                /* ... without timeout              (see Note #1a) ...  */
+        KAL_LockAcquire(Net_GlobalLock, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &err_kal);
+    }
+#else
                                                                 /* Acquire exclusive network access (see Note #1b) ...  */
                                                                 /* ... without timeout              (see Note #1a) ...  */
     KAL_LockAcquire(Net_GlobalLock, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &err_kal);
+#endif
     switch (err_kal) {
         case KAL_ERR_NONE:
              Net_GlobaLockFcntPtr = p_fcnt;
@@ -581,8 +623,26 @@ void  Net_GlobalLockAcquire (void     *p_fcnt,
         case KAL_ERR_OS:
         default:
             *p_err = NET_ERR_FAULT_LOCK_ACQUIRE;                               /* See Note #1a1.                                       */
-             break;
+             return;
+    }
+
+
+#if (NET_CTR_CFG_STAT_EN == DEF_ENABLED)                        /* -------------- UPDATE LOCK STATS ----------------- */
+    Net_StatCtrs.Lock.AcquireCtr++;                             /* See Note #2b.                                        */
+    if (contended == DEF_YES) {
+        Net_StatCtrs.Lock.ContendCtr++;
+    }
+#if (CPU_CFG_TS_32_EN    == DEF_ENABLED)
+    Net_GlobalLockTS = CPU_TS_Get32();
+    if (contended == DEF_YES) {
+        ts_delta                       = Net_GlobalLockTS - ts_wait;
+        Net_StatCtrs.Lock.WaitTimeTot += ts_delta;
+        if (ts_delta > Net_StatCtrs.Lock.WaitTimeMax) {
+            Net_StatCtrs.Lock.WaitTimeMax = ts_delta;
+        }
     }
+#endif
+#endif
 }
 
 
@@ -606,14 +666,28 @@ void  Net_GlobalLockAcquire (void     *p_fcnt,
 *                   (a) Failure to release network access will prevent network task(s)/operation(s) from
 *                       functioning.  Thus, network access is assumed to be successfully released since
 *                       NO uC/OS-III error handling could be performed to counteract failure.
+*
+*               (2) Lock hold time is updated BEFORE the lock is released (see 'Net_GlobalLockAcquire()
+*                   Note #2b').
 *********************************************************************************************************
 */
 
 void  Net_GlobalLockRelease (void)
 {
-    KAL_ERR  err_kal;
+    KAL_ERR   err_kal;
+#if ((NET_CTR_CFG_STAT_EN == DEF_ENABLED) && \
+     (CPU_CFG_TS_32_EN    == DEF_ENABLED))
+    CPU_TS32  ts_delta;
 
 
+    ts_delta                       = CPU_TS_Get32() - Net_GlobalLockTS;
+    Net_StatCtrs.Lock.HoldTimeTot += ts_delta;                  /* See Note #2.                                         */
+    if (ts_delta > Net_StatCtrs.Lock.HoldTimeMax) {
+        Net_StatCtrs.Lock.HoldTimeMax        = ts_delta;
+        Net_StatCtrs.Lock.HoldTimeMaxFnctPtr = Net_GlobaLockFcntPtr;
+    }
+#endif
+
     Net_GlobaLockFcntPtr = DEF_NULL;
     KAL_LockRelease(Net_GlobalLock,  &err_kal);                 /* Release exclusive network access.                    */
 
@@ -99,6 +99,10 @@ static  void  NetBuf_FreeHandler(NET_BUF        *p_buf);
 
 static  void  NetBuf_ClrHdr     (NET_BUF_HDR    *p_buf_hdr);
 
+static  void  NetBuf_ChkSumClr  (NET_BUF_HDR    *p_buf_hdr,
+                                 NET_BUF_SIZE    ix,
+                                 NET_BUF_SIZE    len);
+
 static  void  NetBuf_Discard    (NET_IF_NBR      if_nbr,
                                  void           *p_buf,
                                  NET_STAT_POOL  *pstat_pool);
@@ -1868,8 +1872,8 @@ void  NetBuf_DataWr (NET_BUF       *p_buf,
                      CPU_INT08U    *psrc,
                      NET_ERR       *p_err)
 {
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
     NET_BUF_HDR   *p_buf_hdr;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
     NET_BUF_SIZE   len_data;
 #endif
     CPU_INT08U    *p_data;
@@ -1947,6 +1951,158 @@ void  NetBuf_DataWr (NET_BUF       *p_buf,
              (void     *)psrc,
              (CPU_SIZE_T)len);
 
+    p_buf_hdr = &p_buf->Hdr;                                    /* Invalidate any cached DATA chk-sum wr'n over.        */
+    NetBuf_ChkSumClr(p_buf_hdr, ix, len);
+
+   *p_err = NET_BUF_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetBuf_DataWrChkSum()
+*
+* Description : (1) Write data into network buffer's DATA area & cache the data's 16-bit sum :
+*
+*                   (a) Validate data write index & size
+*                   (b) Write    data into buffer & calculate its 16-bit sum
+*                   (c) Update   buffer's cached data check-sum
+*
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area.
+*
+*               len         Number of octets to write (see Note #2).
+*
+*               psrc        Pointer to data to write.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                Write to network buffer DATA area successful.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'psrc' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or unknown.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length (outside buffer's DATA area).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetUDP_TxAppDataHandlerIPv4(),
+*               NetUDP_TxAppDataHandlerIPv6(),
+*               NetTCP_TxConnAppData().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (2) Data write of 0 octets allowed.
+*
+*               (3) Same as NetBuf_DataWr() except that the data is check-summed while it is copied, so
+*                   that the transport layer's transmit check-sum does NOT read the data a second time
+*                   (see 'net_util.c  NetUtil_16BitOnesCplSumDataCalc()  Note #6').
+*
+*                   (a) A write that directly follows the cached region is folded into the cached sum,
+*                       so that data appended to a segment in several writes is still covered.
+*
+*                   (b) Any other write replaces the cached region.
+*
+*                   (c) Any later write over the cached region by NetBuf_DataWr() or NetBuf_DataCopy()
+*                       invalidates the cache.
+*********************************************************************************************************
+*/
+
+void  NetBuf_DataWrChkSum (NET_BUF       *p_buf,
+                           NET_BUF_SIZE   ix,
+                           NET_BUF_SIZE   len,
+                           CPU_INT08U    *psrc,
+                           NET_ERR       *p_err)
+{
+    NET_BUF_HDR   *p_buf_hdr;
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    NET_BUF_SIZE   len_data;
+#endif
+    CPU_INT08U    *p_data;
+    CPU_INT32U     sum;
+    CPU_INT16U     sum_data;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE BUF PTR ------------------ */
+    if (p_buf == (NET_BUF *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+                                                                /* ---------------- VALIDATE BUF TYPE ----------------- */
+    p_buf_hdr = &p_buf->Hdr;
+    switch (p_buf_hdr->Type) {
+        case NET_BUF_TYPE_RX_LARGE:
+        case NET_BUF_TYPE_TX_LARGE:
+        case NET_BUF_TYPE_TX_SMALL:
+             break;
+
+
+        case NET_BUF_TYPE_NONE:
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.Buf.InvTypeCtr);
+            *p_err = NET_BUF_ERR_INVALID_TYPE;
+             return;
+    }
+
+                                                                /* ----------------- VALIDATE SRC PTR ----------------- */
+    if (psrc == (CPU_INT08U *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+#endif
+
+                                                                /* ----------------- VALIDATE IX/SIZE ----------------- */
+    if (len < 1) {                                              /* If req'd len = 0,    rtn null wr (see Note #2).      */
+       *p_err = NET_BUF_ERR_NONE;
+        return;
+    }
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    if (ix >= p_buf_hdr->Size) {                                /* If req'd ix  > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.IxCtr);
+       *p_err = NET_BUF_ERR_INVALID_IX;
+        return;
+    }
+
+    len_data = ix + len;
+    if (len_data > p_buf_hdr->Size) {                           /* If req'd len > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+       *p_err = NET_BUF_ERR_INVALID_LEN;
+        return;
+    }
+#endif
+
+                                                                /* --------------- WR & CHK-SUM BUF DATA -------------- */
+    p_buf_hdr = &p_buf->Hdr;
+    p_data    = &p_buf->DataPtr[ix];
+    sum_data  =  NetUtil_16BitSumDataCopy((void     *)p_data,
+                                          (void     *)psrc,
+                                          (CPU_INT16U)len);
+
+                                                                /* ---------------- UPDATE CACHED SUM ----------------- */
+    if ((p_buf_hdr->ChkSumDataLen                          > 0u) &&
+        (p_buf_hdr->ChkSumDataIx + p_buf_hdr->ChkSumDataLen == ix)) {
+        if ((p_buf_hdr->ChkSumDataLen % 2u) != 0u) {            /* If wr starts on odd offset into cached region, ...   */
+            sum_data = (CPU_INT16U)((sum_data >> DEF_OCTET_NBR_BITS) |   /* ... swap sum octets.                       */
+                                    (sum_data << DEF_OCTET_NBR_BITS));
+        }
+        sum  = (CPU_INT32U)p_buf_hdr->ChkSumData + (CPU_INT32U)sum_data;
+        sum  = (sum & 0x0000FFFFu) + (sum >> 16u);              /* Fold ovf back into 16-bit sum (see Note #3a).        */
+
+        p_buf_hdr->ChkSumData     = (CPU_INT16U)sum;
+        p_buf_hdr->ChkSumDataLen += len;
+
+    } else {                                                    /* Else replace cached region (see Note #3b).           */
+        p_buf_hdr->ChkSumDataIx   = (CPU_INT16U)ix;
+        p_buf_hdr->ChkSumDataLen  =  len;
+        p_buf_hdr->ChkSumData     =  sum_data;
+    }
+
    *p_err = NET_BUF_ERR_NONE;
 }
 
@@ -2118,11 +2274,156 @@ void  NetBuf_DataCopy (NET_BUF       *p_buf_dest,
     Mem_Copy((void     *)p_data_dest,                           /* ... & copy len nbr DATA buf octets      ...          */
              (void     *)p_data_src,                            /* ... from src to dest buf.                            */
              (CPU_SIZE_T)len);
+                                                                /* Invalidate any cached DATA chk-sum wr'n over.        */
+    NetBuf_ChkSumClr(&p_buf_dest->Hdr, ix_dest, len);
 
    *p_err = NET_BUF_ERR_NONE;
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetBuf_ExtDataSet()
+*
+* Description : (1) Set network buffer's application data to reference external data :
+*
+*                   (a) Validate external data index & size
+*                   (b) Link     external data to buffer
+*                   (c) Calculate & cache external data's 16-bit sum, if requested
+*
+*
+* Argument(s) : p_buf       Pointer to a network buffer.
+*
+*               ix          Index into buffer's DATA area where the data would otherwise be written (see
+*                               'net_buf.h  NETWORK BUFFER HEADER DATA TYPE  Note #5').
+*
+*               len         Number of external data octets.
+*
+*               p_data      Pointer to external data.
+*
+*               free_fnct   Pointer to function to return the external data to its owner (see Note #2) :
+*
+*                               NULL                            Data NOT returned to its owner.
+*                               Pointer to function,            otherwise.
+*
+*               p_free_arg  Pointer to argument passed to 'free_fnct'.
+*
+*               chk_sum     Indicate whether to calculate & cache the external data's 16-bit sum (see Note #3) :
+*
+*                               DEF_YES                         Calculate & cache   data's sum.
+*                               DEF_NO                          Do NOT calculate    data's sum.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_BUF_ERR_NONE                External data successfully linked to buffer.
+*                               NET_ERR_FAULT_NULL_PTR          Argument 'p_buf'/'p_data' passed a NULL pointer.
+*                               NET_BUF_ERR_INVALID_TYPE        Argument 'p_buf's TYPE is invalid or NOT a
+*                                                                   transmit buffer.
+*                               NET_BUF_ERR_INVALID_IX          Invalid index  (outside buffer's DATA area).
+*                               NET_BUF_ERR_INVALID_LEN         Invalid length.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetUDP_TxAppDataHandlerIPv4().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (2) The external data MUST remain valid & unmodified until the buffer is freed; the buffer's
+*                   free handler then calls 'free_fnct' to return the data to its owner.  Since buffers are
+*                   freed with the global network lock acquired, 'free_fnct' MUST NOT call any network
+*                   protocol suite application programming interface (API) function & SHOULD only signal
+*                   or release the data's owner.
+*
+*               (3) The data's 16-bit sum is calculated without copying the data & cached as if the data
+*                   was written by NetBuf_DataWrChkSum(), so that the transport layer's transmit check-sum
+*                   does NOT read the external data a second time (see 'net_util.c
+*                   NetUtil_16BitOnesCplSumDataCalc()  Notes #6 & #7').
+*********************************************************************************************************
+*/
+
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+void  NetBuf_ExtDataSet (NET_BUF                *p_buf,
+                         NET_BUF_SIZE            ix,
+                         NET_BUF_SIZE            len,
+                         CPU_INT08U             *p_data,
+                         NET_BUF_EXT_DATA_FNCT   free_fnct,
+                         void                   *p_free_arg,
+                         CPU_BOOLEAN             chk_sum,
+                         NET_ERR                *p_err)
+{
+    NET_BUF_HDR  *p_buf_hdr;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE BUF PTR ------------------ */
+    if (p_buf == (NET_BUF *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+                                                                /* ---------------- VALIDATE BUF TYPE ----------------- */
+    p_buf_hdr = &p_buf->Hdr;
+    switch (p_buf_hdr->Type) {
+        case NET_BUF_TYPE_TX_LARGE:
+        case NET_BUF_TYPE_TX_SMALL:
+             break;
+
+
+        case NET_BUF_TYPE_RX_LARGE:
+        case NET_BUF_TYPE_NONE:
+        default:
+             NET_CTR_ERR_INC(Net_ErrCtrs.Buf.InvTypeCtr);
+            *p_err = NET_BUF_ERR_INVALID_TYPE;
+             return;
+    }
+
+                                                                /* ---------------- VALIDATE DATA PTR ----------------- */
+    if (p_data == (CPU_INT08U *)0) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.NullPtrCtr);
+       *p_err = NET_ERR_FAULT_NULL_PTR;
+        return;
+    }
+
+                                                                /* ----------------- VALIDATE IX/SIZE ----------------- */
+    if (ix > p_buf_hdr->Size) {                                 /* If req'd ix  > size, rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.IxCtr);
+       *p_err = NET_BUF_ERR_INVALID_IX;
+        return;
+    }
+#endif
+
+    if (len < 1) {                                              /* If req'd len = 0,    rtn err.                        */
+        NET_CTR_ERR_INC(Net_ErrCtrs.Buf.LenCtr);
+       *p_err = NET_BUF_ERR_INVALID_LEN;
+        return;
+    }
+
+
+                                                                /* ------------------ LINK EXT DATA ------------------- */
+    p_buf_hdr                  = &p_buf->Hdr;
+    p_buf_hdr->ExtDataPtr      =  p_data;
+    p_buf_hdr->ExtDataFreeFnct =  free_fnct;
+    p_buf_hdr->ExtDataFreeArg  =  p_free_arg;
+
+                                                                /* ---------------- CACHE EXT DATA SUM ---------------- */
+    if (chk_sum == DEF_YES) {                                   /* See Note #3.                                         */
+        p_buf_hdr->ChkSumDataIx  = (CPU_INT16U)ix;
+        p_buf_hdr->ChkSumDataLen =  len;
+        p_buf_hdr->ChkSumData    =  NetUtil_16BitSumDataCopy((void     *)0,
+                                                             (void     *)p_data,
+                                                             (CPU_INT16U)len);
+    } else {
+        p_buf_hdr->ChkSumDataIx  =  NET_BUF_IX_NONE;
+        p_buf_hdr->ChkSumDataLen =  0u;
+        p_buf_hdr->ChkSumData    =  0u;
+    }
+
+   *p_err = NET_BUF_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           NetBuf_IsUsed()
@@ -2774,9 +3075,10 @@ exit_release:
 *
 *                   (a) Configure buffer free by buffer type
 *                   (b) Unlink    buffer from network layer(s)                          See Note #3
-*                   (c) Clear     buffer controls
-*                   (d) Free      buffer & data area back to buffer pools
-*                   (e) Update    buffer pool statistics
+*                   (c) Return    buffer's external data to its owner                   See Note #4
+*                   (d) Clear     buffer controls
+*                   (e) Free      buffer & data area back to buffer pools
+*                   (f) Update    buffer pool statistics
 *
 *
 * Argument(s) : p_buf       Pointer to a network buffer.
@@ -2800,22 +3102,27 @@ exit_release:
 *
 *               (3) If a network buffer's unlink function is available, it is assumed that the function
 *                   correctly unlinks the network buffer from any other network layer(s).
+*
+*               (4) See 'NetBuf_ExtDataSet()  Note #2'.
 *********************************************************************************************************
 */
 
 static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
 {
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    CPU_BOOLEAN     used;
+    CPU_BOOLEAN             used;
 #endif
-    NET_IF_NBR      if_nbr;
-    NET_BUF_HDR    *p_buf_hdr;
-    NET_BUF_POOLS  *ppool;
-    NET_STAT_POOL  *pstat_pool;
-    MEM_POOL       *pmem_pool;
-    NET_BUF_FNCT    unlink_fnct;
-    NET_ERR         err;
-    LIB_ERR         err_lib;
+    NET_IF_NBR              if_nbr;
+    NET_BUF_HDR            *p_buf_hdr;
+    NET_BUF_POOLS          *ppool;
+    NET_STAT_POOL          *pstat_pool;
+    MEM_POOL               *pmem_pool;
+    NET_BUF_FNCT            unlink_fnct;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    NET_BUF_EXT_DATA_FNCT   ext_data_free_fnct;
+#endif
+    NET_ERR                 err;
+    LIB_ERR                 err_lib;
 
 
     p_buf_hdr = &p_buf->Hdr;
@@ -2876,6 +3183,20 @@ static  void  NetBuf_FreeHandler (NET_BUF  *p_buf)
     }
 
 
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)                    /* ------------------ RTN EXT DATA -------------------- */
+    if (p_buf_hdr->ExtDataPtr != (CPU_INT08U *)0) {             /* If buf refs ext data, ...                            */
+        ext_data_free_fnct         =  p_buf_hdr->ExtDataFreeFnct;
+        if (ext_data_free_fnct != (NET_BUF_EXT_DATA_FNCT)0) {   /* ... rtn data to its owner (see Note #4).             */
+            ext_data_free_fnct((void *)p_buf_hdr->ExtDataPtr,
+                                       p_buf_hdr->ExtDataFreeArg);
+        }
+        p_buf_hdr->ExtDataPtr      = (CPU_INT08U          *)0;
+        p_buf_hdr->ExtDataFreeFnct = (NET_BUF_EXT_DATA_FNCT)0;
+        p_buf_hdr->ExtDataFreeArg  = (void                *)0;
+    }
+#endif
+
+
                                                                 /* ---------------------- CLR BUF --------------------- */
     DEF_BIT_CLR(p_buf_hdr->Flags, NET_BUF_FLAG_USED);           /* Set buf as NOT used.                                 */
 
@@ -2987,6 +3308,14 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->DataIx                   =  NET_BUF_IX_NONE;
     p_buf_hdr->DataLen                  =  0u;
     p_buf_hdr->TotLen                   =  0u;
+    p_buf_hdr->ChkSumDataIx             =  NET_BUF_IX_NONE;
+    p_buf_hdr->ChkSumDataLen            =  0u;
+    p_buf_hdr->ChkSumData               =  0u;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    p_buf_hdr->ExtDataPtr               = (CPU_INT08U          *)0;
+    p_buf_hdr->ExtDataFreeFnct          = (NET_BUF_EXT_DATA_FNCT)0;
+    p_buf_hdr->ExtDataFreeArg           = (void                *)0;
+#endif
 
 #ifdef  NET_ARP_MODULE_EN
     p_buf_hdr->ARP_AddrHW_Ptr           = (CPU_INT08U *)0;
@@ -3057,6 +3386,12 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
     p_buf_hdr->TCP_RTT_TS_Rxd_ms        =  NET_TCP_TX_RTT_TS_NONE;
     p_buf_hdr->TCP_RTT_TS_Txd_ms        =  NET_TCP_TX_RTT_TS_NONE;
     p_buf_hdr->TCP_Flags                =  NET_TCP_FLAG_NONE;
+    p_buf_hdr->TCP_OptFlags             =  NET_TCP_OPT_EN_NONE;
+    p_buf_hdr->TCP_WinScale             =  0u;
+    p_buf_hdr->TCP_TS_Val               =  0u;
+    p_buf_hdr->TCP_TS_EchoReply         =  0u;
+    p_buf_hdr->TCP_SACK_OptIx           =  0u;
+    p_buf_hdr->TCP_SACK_BlkNbr          =  0u;
 #endif
 
 
@@ -3068,6 +3403,51 @@ static  void  NetBuf_ClrHdr (NET_BUF_HDR  *p_buf_hdr)
 }
 
 
+/*
+*********************************************************************************************************
+*                                          NetBuf_ChkSumClr()
+*
+* Description : Invalidate network buffer's cached data check-sum if a write overlaps the cached region.
+*
+* Argument(s) : p_buf_hdr   Pointer to network buffer header.
+*               --------    Argument validated in caller(s).
+*
+*               ix          Index into buffer's DATA area of write.
+*
+*               len         Number of octets written.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetBuf_DataWr(),
+*               NetBuf_DataCopy().
+*
+* Note(s)     : (1) See 'NetBuf_DataWrChkSum()  Note #3c'.
+*********************************************************************************************************
+*/
+
+static  void  NetBuf_ChkSumClr (NET_BUF_HDR   *p_buf_hdr,
+                                NET_BUF_SIZE   ix,
+                                NET_BUF_SIZE   len)
+{
+    CPU_INT32U  ix_end;
+    CPU_INT32U  ix_end_chk_sum;
+
+
+    if (p_buf_hdr->ChkSumDataLen < 1) {                         /* If NO cached chk-sum, NO action(s) req'd.            */
+        return;
+    }
+
+    ix_end         = (CPU_INT32U)ix                       + (CPU_INT32U)len;
+    ix_end_chk_sum = (CPU_INT32U)p_buf_hdr->ChkSumDataIx + (CPU_INT32U)p_buf_hdr->ChkSumDataLen;
+    if ((ix     < ix_end_chk_sum) &&                            /* If wr overlaps cached region, ...                    */
+        (ix_end > p_buf_hdr->ChkSumDataIx)) {
+        p_buf_hdr->ChkSumDataIx  = NET_BUF_IX_NONE;             /* ... invalidate cached chk-sum.                       */
+        p_buf_hdr->ChkSumDataLen = 0u;
+        p_buf_hdr->ChkSumData    = 0u;
+    }
+}
+
+
 /*
 *********************************************************************************************************
 *                                          NetBuf_Discard()
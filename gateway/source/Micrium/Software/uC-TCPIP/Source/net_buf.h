@@ -76,6 +76,33 @@
 #define  NET_BUF_ID_INIT                     NET_BUF_ID_NONE
 
 
+/*
+*********************************************************************************************************
+*                                 NETWORK BUFFER EXTERNAL DATA DEFINES
+*
+* Note(s) : (1) A transmit buffer MAY reference its application data in external memory, owned by the
+*               caller, instead of holding a copy of the data in its own DATA area; the buffer's DATA area
+*               then holds ONLY the packet's protocol headers (see 'NETWORK BUFFER HEADER DATA TYPE
+*               Note #5').
+*
+*               (a) NET_BUF_CFG_EXT_DATA_EN MAY be configured in 'net_cfg.h'; external data is ONLY
+*                   transmitted by devices that can gather a packet from two memory blocks (see 'net_if.h
+*                   NETWORK INTERFACE DATA TYPE  Note #3').
+*
+*               (b) Data shorter than NET_BUF_EXT_DATA_LEN_MIN octets is cheaper to copy than to reference
+*                   & is always copied into the buffer's DATA area.  NET_BUF_EXT_DATA_LEN_MIN also ensures
+*                   that a packet with external data is NEVER padded by its network interface (see
+*                   'net_if_802x.c  NetIF_802x_Tx()  Note #5').
+*********************************************************************************************************
+*/
+
+#ifndef  NET_BUF_CFG_EXT_DATA_EN
+    #define  NET_BUF_CFG_EXT_DATA_EN                 DEF_DISABLED
+#endif
+
+#define  NET_BUF_EXT_DATA_LEN_MIN                          64u  /* See Note #1b.                                        */
+
+
 /*
 *********************************************************************************************************
 *                                     NETWORK BUFFER FLAG DEFINES
@@ -92,6 +119,8 @@
 #define  NET_BUF_FLAG_RX_REMOTE                   DEF_BIT_06    /* Indicates pkts rx'd from remote host.                */
 #define  NET_BUF_FLAG_RX_UDP_CHK_SUM_VALID        DEF_BIT_07    /* Indicates UDP  rx chk sum valid.                     */
 
+#define  NET_BUF_FLAG_TX_SACKD                    DEF_BIT_08    /* Indicates TCP  seg SACK'd by remote host.            */
+
 #define  NET_BUF_FLAG_TX_BROADCAST                DEF_BIT_12    /* Indicates pkts to tx via broadcast.                  */
 #define  NET_BUF_FLAG_TX_MULTICAST                DEF_BIT_13    /* Indicates pkts to tx via multicast.                  */
 
@@ -290,11 +319,18 @@ typedef  CPU_INT16U  NET_BUF_SIZE;                              /* Defines   max
 /*
 *********************************************************************************************************
 *                              NETWORK BUFFER FUNCTION POINTER DATA TYPE
+*
+* Note(s) : (1) 'NET_BUF_EXT_DATA_FNCT' returns a buffer's external data to its owner once the buffer is
+*               freed (see 'NETWORK BUFFER EXTERNAL DATA DEFINES  Note #1').
 *********************************************************************************************************
 */
 
 typedef  void  (*NET_BUF_FNCT)(NET_BUF  *p_buf);
 
+                                                                /* Rtn ext data to its owner (see Note #1).             */
+typedef  void  (*NET_BUF_EXT_DATA_FNCT)(void  *p_data,
+                                        void  *p_arg);
+
 
 /*
 *********************************************************************************************************
@@ -400,6 +436,18 @@ typedef  enum  net_buf_type {
 *
 *               (a) TCP transmit acknowledgement code variables ideally declared as 'NET_TCP_ACK_CODE';
 *                       declared as 'CPU_INT08U'.
+*
+*           (4) 'ChkSumData' caches the 16-bit sum of the 'ChkSumDataLen' octets written at 'ChkSumDataIx'
+*               by NetBuf_DataWrChkSum(), so that a transmit check-sum need NOT read the data again.  Any
+*               other write over that region invalidates the cache (see 'NetBuf_DataWrChkSum()  Note #3').
+*
+*           (5) If 'ExtDataPtr' is NOT NULL, the buffer's 'Application' data is NOT held in its DATA area
+*               but in the 'DataLen' octets at 'ExtDataPtr' (see 'NETWORK BUFFER EXTERNAL DATA DEFINES
+*               Note #1'); 'DataIx' still marks where the data would start in the DATA area, so that
+*               'TotLen' remains the packet's protocol headers' length plus 'DataLen'.
+*
+*               When the buffer is freed, 'ExtDataFreeFnct' is called to return the data to its owner
+*               (see 'NetBuf_ExtDataSet()  Note #2').
 *********************************************************************************************************
 */
 
@@ -483,6 +531,16 @@ typedef  struct  net_buf_hdr {
 
     NET_BUF_SIZE           TotLen;                      /* ALL                  DATA len (in octets   ).                */
 
+    CPU_INT16U             ChkSumDataIx;                /* Chk-sum'd            DATA ix  (see Note #4).                 */
+    NET_BUF_SIZE           ChkSumDataLen;               /* Chk-sum'd            DATA len (in octets   ).                */
+    CPU_INT16U             ChkSumData;                  /* 16-bit sum of chk-sum'd DATA  (in net-order).                */
+
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    CPU_INT08U            *ExtDataPtr;                  /* Ptr to ext           DATA     (see Note #5).                 */
+    NET_BUF_EXT_DATA_FNCT  ExtDataFreeFnct;             /* Ptr to fnct to rtn   ext DATA to its owner.                  */
+    void                  *ExtDataFreeArg;              /* Ptr to arg  to pass  to ext DATA free fnct.                  */
+#endif
+
 
 
 #ifdef  NET_ARP_MODULE_EN
@@ -564,6 +622,13 @@ typedef  struct  net_buf_hdr {
     NET_TCP_TX_RTT_TS_MS   TCP_RTT_TS_Txd_ms;           /* TCP RTT TS @ seg tx'd (in ms).                               */
 
     NET_TCP_FLAGS          TCP_Flags;                   /* TCP tx flags.                                                */
+
+    CPU_INT08U             TCP_OptFlags;                /* TCP opts rx'd (see 'net_tcp.h  TCP OPTION ENABLE DEFINES').  */
+    CPU_INT08U             TCP_WinScale;                /* TCP win scale shift rx'd.                                    */
+    NET_TS_MS              TCP_TS_Val;                  /* TCP TS val        rx'd.                                      */
+    NET_TS_MS              TCP_TS_EchoReply;            /* TCP TS echo reply rx'd.                                      */
+    CPU_INT16U             TCP_SACK_OptIx;              /* TCP SACK opt ix (from TCP hdr ix).                           */
+    CPU_INT08U             TCP_SACK_BlkNbr;             /* TCP SACK nbr of blks rx'd.                                   */
 #endif
 
 
@@ -783,6 +848,12 @@ void           NetBuf_DataWr                     (NET_BUF          *p_buf,
                                                   CPU_INT08U       *p_src,
                                                   NET_ERR          *p_err);
 
+void           NetBuf_DataWrChkSum               (NET_BUF          *p_buf,
+                                                  NET_BUF_SIZE      ix,
+                                                  NET_BUF_SIZE      len,
+                                                  CPU_INT08U       *p_src,
+                                                  NET_ERR          *p_err);
+
 void           NetBuf_DataCopy                   (NET_BUF          *p_buf_dest,
                                                   NET_BUF          *p_buf_src,
                                                   NET_BUF_SIZE      ix_dest,
@@ -790,11 +861,38 @@ void           NetBuf_DataCopy                   (NET_BUF          *p_buf_dest,
                                                   NET_BUF_SIZE      len,
                                                   NET_ERR          *p_err);
 
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+void           NetBuf_ExtDataSet                 (NET_BUF          *p_buf,
+                                                  NET_BUF_SIZE      ix,
+                                                  NET_BUF_SIZE      len,
+                                                  CPU_INT08U       *p_data,
+                                                  NET_BUF_EXT_DATA_FNCT  free_fnct,
+                                                  void             *p_free_arg,
+                                                  CPU_BOOLEAN       chk_sum,
+                                                  NET_ERR          *p_err);
+#endif
+
 
                                                                             /* ----------- BUF STATUS FNCTS ----------- */
 CPU_BOOLEAN    NetBuf_IsUsed                     (NET_BUF          *p_buf);
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if    ((NET_BUF_CFG_EXT_DATA_EN != DEF_DISABLED) && \
+        (NET_BUF_CFG_EXT_DATA_EN != DEF_ENABLED ))
+#error  "NET_BUF_CFG_EXT_DATA_EN                   illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  DEF_DISABLED]           "
+#error  "                                         [     ||  DEF_ENABLED ]           "
+#endif
+
+
 
 /*
 *********************************************************************************************************
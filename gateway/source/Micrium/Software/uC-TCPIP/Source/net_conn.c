@@ -77,12 +77,14 @@ static  NET_CONN  *NetConn_ListSrch              (NET_CONN_FAMILY        family,
                                                   CPU_INT08U            *p_addr_local);
 
 
+#if (NET_CONN_CFG_HASH_EN != DEF_ENABLED)
 static  NET_CONN  *NetConn_ChainSrch             (NET_CONN             **p_conn_list,
                                                   NET_CONN              *p_conn_chain,
                                                   CPU_INT08U            *p_addr_local,
                                                   CPU_INT08U            *p_addr_wildcard,
                                                   CPU_INT08U            *p_addr_remote,
                                                   NET_ERR               *p_err);
+#endif
 
 
 static  void       NetConn_ChainInsert           (NET_CONN             **p_conn_list,
@@ -99,6 +101,33 @@ static  void       NetConn_Add                   (NET_CONN             **p_conn_
 static  void       NetConn_Unlink                (NET_CONN              *p_conn);
 
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+static  NET_CONN  *NetConn_HashSrch              (NET_CONN_FAMILY        family,
+                                                  NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                  CPU_INT08U            *p_addr_local,
+                                                  CPU_INT08U            *p_addr_wildcard,
+                                                  CPU_INT08U            *p_addr_remote,
+                                                  NET_ERR               *p_err);
+
+static  NET_CONN  *NetConn_HashBucketSrch        (NET_CONN              *p_bucket,
+                                                  NET_CONN_FAMILY        family,
+                                                  NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                  CPU_INT08U            *p_addr_local,
+                                                  CPU_INT08U            *p_addr_remote,
+                                                  CPU_SIZE_T             addr_len);
+
+static  NET_CONN **NetConn_HashBucketGet         (NET_CONN             **p_hash_tbl,
+                                                  NET_CONN_FAMILY        family,
+                                                  NET_CONN_PROTOCOL_IX   protocol_ix,
+                                                  CPU_INT08U            *p_addr_local,
+                                                  CPU_INT08U            *p_addr_remote);
+
+static  void       NetConn_HashInsert            (NET_CONN              *p_conn);
+
+static  void       NetConn_HashUnlink            (NET_CONN              *p_conn);
+#endif
+
+
 
 static  void       NetConn_Close                 (NET_CONN              *p_conn);
 
@@ -135,7 +164,8 @@ static  void       NetConn_Clr                   (NET_CONN              *p_conn)
 *                   (a) Initialize network connection pool
 *                   (b) Initialize network connection table
 *                   (c) Initialize network connection lists
-*                   (d) Initialize network connection wildcard address(s)
+*                   (d) Initialize network connection hash tables
+*                   (e) Initialize network connection wildcard address(s)
 *
 *
 * Argument(s) : none.
@@ -166,6 +196,9 @@ void  NetConn_Init (void)
     CPU_INT16U           i;
     NET_CONN_LIST_QTY    j;
     NET_ERR              err;
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    CPU_INT16U           k;
+#endif
 
 
                                                                 /* ------------- INIT NET CONN POOL/STATS ------------- */
@@ -209,6 +242,14 @@ void  NetConn_Init (void)
     NetConn_ConnListNextConnPtr  = (NET_CONN *)0;
 
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)                       /* ------------- INIT NET CONN HASH TBLS -------------- */
+    for (k = 0u; k < NET_CONN_CFG_HASH_TBL_SIZE; k++) {
+        NetConn_HashTblFull[k] = DEF_NULL;
+        NetConn_HashTblHalf[k] = DEF_NULL;
+    }
+#endif
+
+
                                                                 /* ----------- INIT NET CONN WILDCARD ADDRS ----------- */
                                                                 /* See Note #3.                                         */
 #ifdef  NET_IPv4_MODULE_EN
@@ -1735,6 +1776,13 @@ void  NetConn_AddrLocalSet (NET_CONN_ID         conn_id,
     p_conn->AddrLocalValid = DEF_YES;
     p_conn->IF_Nbr         = if_nbr;                            /* Set IF nbr.                                          */
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    if (p_conn->HashBucket != DEF_NULL) {                       /* If net conn hashed, re-hash on new addr.             */
+        NetConn_HashUnlink(p_conn);
+        NetConn_HashInsert(p_conn);
+    }
+#endif
+
 
    *p_err = NET_CONN_ERR_NONE;
 }
@@ -1949,6 +1997,13 @@ void  NetConn_AddrRemoteSet (NET_CONN_ID         conn_id,
 
     p_conn->AddrRemoteValid = DEF_YES;
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    if (p_conn->HashBucket != DEF_NULL) {                       /* If net conn hashed, re-hash on new addr.             */
+        NetConn_HashUnlink(p_conn);
+        NetConn_HashInsert(p_conn);
+    }
+#endif
+
 
    *p_err = NET_CONN_ERR_NONE;
 }
@@ -3340,6 +3395,26 @@ exit_release:
 *
 *                           See also 'NetConn_Add()  Note #1'.
 *
+*                   (c) (1) When NET_CONN_CFG_HASH_EN is enabled, the connection lists & chains are still
+*                           maintained (they are walked to close connections & to check port usage) but are
+*                           NOT searched.  Instead, at most four hash buckets are searched, in the order of
+*                           Note #2b2 :
+*
+*                           (A) Full connection table, with the local          & remote addresses
+*                           (B) Full connection table, with the local wildcard & remote addresses
+*                           (C) Half connection table, with the local          address
+*                           (D) Half connection table, with the local wildcard address
+*
+*                       (2) Since no two connections share the same local AND remote connection address(s)
+*                           (see Note #2a3), each bucket search returns the same connection that the
+*                           connection chain search would have.
+*
+*                       (3) Unlike the connection chain search, the hash search does NOT close connections
+*                           whose local address is invalid (see 'NetConn_ChainSrch()  Note #2b') & does NOT
+*                           promote the connection found (see Note #2b3).
+*
+*                       See also 'net_conn.h  NETWORK CONNECTION HASH TABLE DEFINES  Note #1'.
+*
 *
 *                                            |                                                             |
 *                                            |<---------------- List of Connection Chains ---------------->|
@@ -3452,8 +3527,10 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
     NET_CONN_ADDR_LEN   addr_len_chk_size;
 #endif
+#if (NET_CONN_CFG_HASH_EN != DEF_ENABLED)
     NET_CONN          **p_conn_list;
     NET_CONN           *p_conn_chain;
+#endif
     NET_CONN           *p_conn;
     NET_CONN_ID         conn_id;
     CPU_INT08U          addr_wildcard[NET_CONN_ADDR_LEN_MAX];
@@ -3597,6 +3674,18 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
 #endif
 
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)                       /* ---------------- SRCH NET CONN HASH ---------------- */
+    p_conn = NetConn_HashSrch(family,                           /* See Note #2c.                                        */
+                              protocol_ix,
+                              p_addr_local,
+                              p_addr_wildcard,
+                              p_addr_remote,
+                              p_err);
+    if (p_conn == DEF_NULL) {                                   /* NO net conn       found.                             */
+        return (NET_CONN_ID_NONE);                              /* Rtn err from NetConn_HashSrch().                     */
+    }
+
+#else
                                                                 /* ---------------- SRCH NET CONN LIST ---------------- */
     p_conn_list  = &NetConn_ConnListHead[protocol_ix];
     p_conn_chain =  NetConn_ListSrch(family,
@@ -3618,6 +3707,7 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
     if (p_conn == DEF_NULL) {                                   /* NO net conn       found.                             */
         return (NET_CONN_ID_NONE);                              /* Rtn err from NetConn_ChainSrch().                    */
     }
+#endif
 
 
                                                                 /* If net conn       found, rtn conn id's.              */
@@ -3645,6 +3735,7 @@ NET_CONN_ID  NetConn_Srch (NET_CONN_FAMILY        family,
 *                   (a) Get network connection's appropriate connection list
 *                   (b) Get network connection's appropriate connection chain
 *                   (c) Add network connection into          connection list
+*                   (d) Add network connection into          connection hash table, if enabled
 *
 *
 * Argument(s) : conn_id     Handle identifier of network connection to add.
@@ -3738,6 +3829,10 @@ void  NetConn_ListAdd (NET_CONN_ID   conn_id,
                                                                 /* --------- ADD NET CONN INTO NET CONN LIST ---------- */
     NetConn_Add(p_conn_list, p_conn_chain, p_conn);
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)                       /* --------- ADD NET CONN INTO NET CONN HASH ---------- */
+    NetConn_HashInsert(p_conn);
+#endif
+
 
    *p_err = NET_CONN_ERR_NONE;
 }
@@ -3786,6 +3881,9 @@ void  NetConn_ListUnlink (NET_CONN_ID   conn_id,
 
                                                                 /* -------- UNLINK NET CONN FROM NET CONN LIST -------- */
     p_conn = &NetConn_Tbl[conn_id];
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    NetConn_HashUnlink(p_conn);
+#endif
     NetConn_Unlink(p_conn);
 
 
@@ -3996,6 +4094,7 @@ static  NET_CONN  *NetConn_ListSrch (NET_CONN_FAMILY    family,
 *********************************************************************************************************
 */
 
+#if (NET_CONN_CFG_HASH_EN != DEF_ENABLED)
 static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
                                       NET_CONN     *p_conn_chain,
                                       CPU_INT08U   *p_addr_local,
@@ -4149,6 +4248,7 @@ static  NET_CONN  *NetConn_ChainSrch (NET_CONN    **p_conn_list,
 
     return (p_conn);
 }
+#endif
 
 
 /*
@@ -4444,6 +4544,454 @@ static  void  NetConn_Unlink (NET_CONN  *p_conn)
 }
 
 
+/*
+*********************************************************************************************************
+*                                         NetConn_HashSrch()
+*
+* Description : Search the network connection hash tables for network connection with specific local &/or
+*               remote addresses.
+*
+* Argument(s) : family              Network connection family type.
+*               ------              Argument checked   in NetConn_Srch().
+*
+*               protocol_ix         Network connection protocol index.
+*               -----------         Argument checked   in NetConn_Srch().
+*
+*               p_addr_local        Pointer to local          address.
+*               ------------        Argument checked   in NetConn_Srch().
+*
+*               p_addr_wildcard     Pointer to local wildcard address.
+*               ---------------     Argument validated in NetConn_Srch().
+*
+*               p_addr_remote       Pointer to remote         address.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_CONN_ERR_CONN_NONE              NO   network connection found.
+*                               NET_CONN_ERR_CONN_HALF              Half network connection found --
+*                                                                       local            addresses match.
+*                               NET_CONN_ERR_CONN_HALF_WILDCARD     Half network connection found --
+*                                                                       local & wildcard addresses match.
+*                               NET_CONN_ERR_CONN_FULL              Full network connection found --
+*                                                                       local & remote   addresses match.
+*                               NET_CONN_ERR_CONN_FULL_WILDCARD     Full network connection found --
+*                                                                       local & wildcard addresses match
+*                                                                             & remote   addresses match.
+*                               NET_CONN_ERR_INVALID_FAMILY         Invalid network connection family.
+*
+* Return(s)   : Pointer to connection with specific local & remote address, if found.
+*
+*               Pointer to NULL,                                            otherwise.
+*
+* Caller(s)   : NetConn_Srch().
+*
+* Note(s)     : (1) Network connection addresses maintained in network-order.
+*
+*               (2) Matches are resolved from most- to least-specific, in the same order as
+*                   NetConn_ChainSrch() (see 'NetConn_Srch()  Note #2c').
+*
+*               (3) A local wildcard address is only searched when it differs from the local address
+*                   since, otherwise, it would return the same connection as the local address search.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+static  NET_CONN  *NetConn_HashSrch (NET_CONN_FAMILY        family,
+                                     NET_CONN_PROTOCOL_IX   protocol_ix,
+                                     CPU_INT08U            *p_addr_local,
+                                     CPU_INT08U            *p_addr_wildcard,
+                                     CPU_INT08U            *p_addr_remote,
+                                     NET_ERR               *p_err)
+{
+    NET_CONN     **p_bucket;
+    NET_CONN      *p_conn;
+    CPU_BOOLEAN    addr_local_wildcard;
+    CPU_BOOLEAN    addr_wildcard_srch;
+    CPU_SIZE_T     addr_len;
+
+
+    switch (family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_CONN_FAMILY_IP_V4_SOCK:
+             addr_len = (CPU_SIZE_T)NET_SOCK_ADDR_LEN_IP_V4;
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_CONN_FAMILY_IP_V6_SOCK:
+             addr_len = (CPU_SIZE_T)NET_SOCK_ADDR_LEN_IP_V6;
+             break;
+#endif
+
+        default:
+            *p_err =  NET_CONN_ERR_INVALID_FAMILY;
+             return (DEF_NULL);
+    }
+
+    addr_wildcard_srch = DEF_NO;                                /* Srch wildcard addr only if != local addr ...         */
+    if (p_addr_wildcard != DEF_NULL) {                          /* ... (see Note #3).                                   */
+        addr_local_wildcard = Mem_Cmp((void *)p_addr_local,
+                                      (void *)p_addr_wildcard,
+                                              addr_len);
+        if (addr_local_wildcard == DEF_NO) {
+            addr_wildcard_srch = DEF_YES;
+        }
+    }
+
+
+    if (p_addr_remote != DEF_NULL) {                            /* ------------------ SRCH FULL CONNS ----------------- */
+        p_bucket = NetConn_HashBucketGet(&NetConn_HashTblFull[0],
+                                          family,
+                                          protocol_ix,
+                                          p_addr_local,
+                                          p_addr_remote);
+        p_conn   = NetConn_HashBucketSrch(*p_bucket,
+                                           family,
+                                           protocol_ix,
+                                           p_addr_local,
+                                           p_addr_remote,
+                                           addr_len);
+        if (p_conn != DEF_NULL) {                               /* Full conn found.                                     */
+           *p_err = NET_CONN_ERR_CONN_FULL;
+            return (p_conn);
+        }
+
+        if (addr_wildcard_srch == DEF_YES) {
+            p_bucket = NetConn_HashBucketGet(&NetConn_HashTblFull[0],
+                                              family,
+                                              protocol_ix,
+                                              p_addr_wildcard,
+                                              p_addr_remote);
+            p_conn   = NetConn_HashBucketSrch(*p_bucket,
+                                               family,
+                                               protocol_ix,
+                                               p_addr_wildcard,
+                                               p_addr_remote,
+                                               addr_len);
+            if (p_conn != DEF_NULL) {                           /* Full conn found with wildcard addr.                  */
+               *p_err = NET_CONN_ERR_CONN_FULL_WILDCARD;
+                return (p_conn);
+            }
+        }
+    }
+
+
+                                                                /* ------------------ SRCH HALF CONNS ----------------- */
+    p_bucket = NetConn_HashBucketGet(&NetConn_HashTblHalf[0],
+                                      family,
+                                      protocol_ix,
+                                      p_addr_local,
+                                      DEF_NULL);
+    p_conn   = NetConn_HashBucketSrch(*p_bucket,
+                                       family,
+                                       protocol_ix,
+                                       p_addr_local,
+                                       DEF_NULL,
+                                       addr_len);
+    if (p_conn != DEF_NULL) {                                   /* Half conn found.                                     */
+       *p_err = NET_CONN_ERR_CONN_HALF;
+        return (p_conn);
+    }
+
+    if (addr_wildcard_srch == DEF_YES) {
+        p_bucket = NetConn_HashBucketGet(&NetConn_HashTblHalf[0],
+                                          family,
+                                          protocol_ix,
+                                          p_addr_wildcard,
+                                          DEF_NULL);
+        p_conn   = NetConn_HashBucketSrch(*p_bucket,
+                                           family,
+                                           protocol_ix,
+                                           p_addr_wildcard,
+                                           DEF_NULL,
+                                           addr_len);
+        if (p_conn != DEF_NULL) {                               /* Half conn found with wildcard addr.                  */
+           *p_err = NET_CONN_ERR_CONN_HALF_WILDCARD;
+            return (p_conn);
+        }
+    }
+
+
+   *p_err = NET_CONN_ERR_CONN_NONE;                             /* NO   conn found.                                     */
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      NetConn_HashBucketSrch()
+*
+* Description : Search a network connection hash bucket for network connection with specific local &
+*               remote addresses.
+*
+* Argument(s) : p_bucket        Pointer to first connection in hash bucket.
+*
+*               family          Network connection family type.
+*
+*               protocol_ix     Network connection protocol index.
+*
+*               p_addr_local    Pointer to local  address.
+*
+*               p_addr_remote   Pointer to remote address, if searching a full connection;
+*                               NULL,                      if searching a half connection.
+*
+*               addr_len        Length of connection addresses (in octets).
+*
+* Return(s)   : Pointer to connection with specific local & remote address, if found.
+*
+*               Pointer to NULL,                                            otherwise.
+*
+* Caller(s)   : NetConn_HashSrch().
+*
+* Note(s)     : (1) Buckets are shared by colliding connections of any family & protocol; so each
+*                   connection's family & protocol MUST be compared as well as its addresses.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+static  NET_CONN  *NetConn_HashBucketSrch (NET_CONN              *p_bucket,
+                                           NET_CONN_FAMILY        family,
+                                           NET_CONN_PROTOCOL_IX   protocol_ix,
+                                           CPU_INT08U            *p_addr_local,
+                                           CPU_INT08U            *p_addr_remote,
+                                           CPU_SIZE_T             addr_len)
+{
+    NET_CONN     *p_conn;
+    CPU_BOOLEAN   found;
+
+
+    p_conn = p_bucket;
+    while (p_conn != DEF_NULL) {
+        if ((p_conn->Family     == family) &&                   /* See Note #1.                                         */
+            (p_conn->ProtocolIx == protocol_ix)) {
+
+            found = Mem_Cmp((void *)p_addr_local,
+                            (void *)&p_conn->AddrLocal[0],
+                                     addr_len);
+
+            if ((found         == DEF_YES) &&
+                (p_addr_remote != DEF_NULL)) {
+                found = Mem_Cmp((void *)p_addr_remote,
+                                (void *)&p_conn->AddrRemote[0],
+                                         addr_len);
+            }
+
+            if (found == DEF_YES) {
+                return (p_conn);
+            }
+        }
+
+        p_conn = p_conn->NextHashPtr;
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       NetConn_HashBucketGet()
+*
+* Description : Get the network connection hash bucket for specific local &/or remote addresses.
+*
+* Argument(s) : p_hash_tbl      Pointer to a connection hash table.
+*
+*               family          Network connection family type.
+*
+*               protocol_ix     Network connection protocol index.
+*
+*               p_addr_local    Pointer to local  address.
+*
+*               p_addr_remote   Pointer to remote address, for the full connection table;
+*                               NULL,                      for the half connection table.
+*
+* Return(s)   : Pointer to hash bucket.
+*
+* Caller(s)   : NetConn_HashSrch(),
+*               NetConn_HashInsert().
+*
+* Note(s)     : (1) Each address is hashed from its port number through its IP address, i.e. only octets
+*                   that NetConn_HashBucketSrch() also compares.  Connections whose addresses compare
+*                   equal therefore always hash to the same bucket.
+*
+*               (2) The hash is a 32-bit FNV-1a, folded to 16 bits before masking so that the high-order
+*                   octets also select the bucket of small tables.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+static  NET_CONN  **NetConn_HashBucketGet (NET_CONN             **p_hash_tbl,
+                                           NET_CONN_FAMILY        family,
+                                           NET_CONN_PROTOCOL_IX   protocol_ix,
+                                           CPU_INT08U            *p_addr_local,
+                                           CPU_INT08U            *p_addr_remote)
+{
+    CPU_INT08U  *p_octet;
+    CPU_SIZE_T   len;
+    CPU_SIZE_T   i;
+    CPU_INT32U   hash;
+    CPU_INT16U   ix;
+
+
+    switch (family) {                                           /* Get hashed addr len (see Note #1).                   */
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_CONN_FAMILY_IP_V4_SOCK:
+             len = NET_CONN_ADDR_IP_V4_IX_ADDR + NET_CONN_ADDR_IP_V4_LEN_ADDR - NET_CONN_ADDR_IP_IX_PORT;
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_CONN_FAMILY_IP_V6_SOCK:
+             len = NET_CONN_ADDR_IP_V6_IX_ADDR + NET_CONN_ADDR_IP_V6_LEN_ADDR - NET_CONN_ADDR_IP_IX_PORT;
+             break;
+#endif
+
+        default:
+             len = 0u;
+             break;
+    }
+
+    hash = 2166136261u ^ protocol_ix;                           /* FNV-1a (see Note #2).                                */
+
+    p_octet = p_addr_local + NET_CONN_ADDR_IP_IX_PORT;
+    for (i = 0u; i < len; i++) {
+        hash ^= *p_octet;
+        hash *=  16777619u;
+        p_octet++;
+    }
+
+    if (p_addr_remote != DEF_NULL) {
+        p_octet = p_addr_remote + NET_CONN_ADDR_IP_IX_PORT;
+        for (i = 0u; i < len; i++) {
+            hash ^= *p_octet;
+            hash *=  16777619u;
+            p_octet++;
+        }
+    }
+
+    hash ^= hash >> 16u;
+    ix    = (CPU_INT16U)(hash & NET_CONN_HASH_IX_MASK);
+
+    return (&p_hash_tbl[ix]);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetConn_HashInsert()
+*
+* Description : Insert a network connection at the head of its network connection hash bucket.
+*
+* Argument(s) : p_conn      Pointer to a network connection.
+*               ------      Argument validated in NetConn_ListAdd(),
+*                                                 NetConn_AddrLocalSet(),
+*                                                 NetConn_AddrRemoteSet().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetConn_ListAdd(),
+*               NetConn_AddrLocalSet(),
+*               NetConn_AddrRemoteSet().
+*
+* Note(s)     : (1) Connections with a valid remote address are inserted into the full connection table;
+*                   all others into the half connection table.
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+static  void  NetConn_HashInsert (NET_CONN  *p_conn)
+{
+    NET_CONN  **p_bucket;
+
+
+    if (p_conn->AddrRemoteValid == DEF_YES) {                   /* See Note #1.                                         */
+        p_bucket = NetConn_HashBucketGet(&NetConn_HashTblFull[0],
+                                          p_conn->Family,
+                                          p_conn->ProtocolIx,
+                                         &p_conn->AddrLocal[0],
+                                         &p_conn->AddrRemote[0]);
+    } else {
+        p_bucket = NetConn_HashBucketGet(&NetConn_HashTblHalf[0],
+                                          p_conn->Family,
+                                          p_conn->ProtocolIx,
+                                         &p_conn->AddrLocal[0],
+                                          DEF_NULL);
+    }
+
+    p_conn->PrevHashPtr = DEF_NULL;
+    p_conn->NextHashPtr = *p_bucket;
+    if (*p_bucket != DEF_NULL) {                                /* If bucket NOT empty, insert before cur bucket head.  */
+       (*p_bucket)->PrevHashPtr = p_conn;
+    }
+   *p_bucket            = p_conn;
+
+    p_conn->HashBucket  = p_bucket;                             /* Mark conn's hash bucket ownership.                   */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        NetConn_HashUnlink()
+*
+* Description : Unlink a network connection from its network connection hash bucket.
+*
+* Argument(s) : p_conn      Pointer to a network connection.
+*               ------      Argument validated in NetConn_ListUnlink(),
+*                                                 NetConn_AddrLocalSet(),
+*                                                 NetConn_AddrRemoteSet(),
+*                                                 NetConn_FreeHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetConn_ListUnlink(),
+*               NetConn_AddrLocalSet(),
+*               NetConn_AddrRemoteSet(),
+*               NetConn_FreeHandler().
+*
+* Note(s)     : (1) The connection is unlinked through its hash bucket pointer, NOT by re-hashing its
+*                   addresses which may have changed since it was inserted (see 'net_conn.h  NETWORK
+*                   CONNECTION DATA TYPE  Note #3').
+*********************************************************************************************************
+*/
+
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+static  void  NetConn_HashUnlink (NET_CONN  *p_conn)
+{
+    NET_CONN  **p_bucket;
+    NET_CONN   *p_conn_prev;
+    NET_CONN   *p_conn_next;
+
+
+    p_bucket = p_conn->HashBucket;                              /* See Note #1.                                         */
+    if (p_bucket == DEF_NULL) {                                 /* If net conn NOT hashed, ...                          */
+        return;                                                 /* ... exit unlink.                                     */
+    }
+
+    p_conn_prev = p_conn->PrevHashPtr;
+    p_conn_next = p_conn->NextHashPtr;
+
+    if (p_conn_prev != DEF_NULL) {                              /* Point prev conn to next conn.                        */
+        p_conn_prev->NextHashPtr = p_conn_next;
+    } else {
+       *p_bucket                 = p_conn_next;
+    }
+
+    if (p_conn_next != DEF_NULL) {                              /* Point next conn to prev conn.                        */
+        p_conn_next->PrevHashPtr = p_conn_prev;
+    }
+
+    p_conn->PrevHashPtr = DEF_NULL;
+    p_conn->NextHashPtr = DEF_NULL;
+    p_conn->HashBucket  = DEF_NULL;                             /* Clr conn's hash bucket ownership.                    */
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           NetConn_Close()
@@ -4853,6 +5401,9 @@ static  void  NetConn_FreeHandler (NET_CONN  *p_conn)
         NetConn_ConnListNextConnPtr  = p_conn_next;
     }
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    NetConn_HashUnlink(p_conn);                                 /* Unlink net conn from net conn hash.                  */
+#endif
     NetConn_Unlink(p_conn);                                     /* Unlink net conn from net conn list.                  */
 
 
@@ -4899,6 +5450,11 @@ static  void  NetConn_Clr (NET_CONN  *p_conn)
     p_conn->PrevConnPtr           = (NET_CONN  *)0;
     p_conn->NextConnPtr           = (NET_CONN  *)0;
     p_conn->ConnList              = (NET_CONN **)0;
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    p_conn->PrevHashPtr           = (NET_CONN  *)0;
+    p_conn->NextHashPtr           = (NET_CONN  *)0;
+    p_conn->HashBucket            = (NET_CONN **)0;
+#endif
     p_conn->ID_App                =  NET_CONN_ID_NONE;
     p_conn->ID_AppClone           =  NET_CONN_ID_NONE;
     p_conn->ID_Transport          =  NET_CONN_ID_NONE;
@@ -211,6 +211,37 @@
 #define  NET_CONN_TYPE_CONN_FULL                           2u
 
 
+/*
+*********************************************************************************************************
+*                               NETWORK CONNECTION HASH TABLE DEFINES
+*
+* Note(s) : (1) (a) When NET_CONN_CFG_HASH_EN is enabled, connections added to a connection list are also
+*                   indexed in two hash tables so that NetConn_Srch() resolves a packet's connection in
+*                   constant time, regardless of the number of open connections :
+*
+*                   (1) Connections with a remote address are hashed by protocol, local  address/port
+*                       & remote address/port (i.e. the 4-tuple).
+*                   (2) Connections with NO remote address (i.e. listening/non-connected connections)
+*                       are hashed by protocol & local address/port only.
+*
+*               (b) NET_CONN_CFG_HASH_TBL_SIZE configures the number of buckets in each table & MUST be
+*                   a power of 2.  Both tables are statically allocated; each bucket is a pointer.
+*
+*               (c) Both may be #define'd in 'net_cfg.h' to override the default values.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_CONN_CFG_HASH_EN
+#define  NET_CONN_CFG_HASH_EN                     DEF_ENABLED
+#endif
+
+#ifndef  NET_CONN_CFG_HASH_TBL_SIZE
+#define  NET_CONN_CFG_HASH_TBL_SIZE                       16u
+#endif
+
+#define  NET_CONN_HASH_IX_MASK         (NET_CONN_CFG_HASH_TBL_SIZE - 1u)
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -463,6 +494,12 @@ typedef  NET_FLAGS  NET_CONN_FLAGS;
 *                               source route received in a datagram."
 *
 *                   (2) IP transmit options currently NOT implemented      See 'net_tcp.h  Note #1d'
+*
+*           (3) 'HashBucket' points to the hash table bucket the connection is linked into, or NULL if the
+*               connection is NOT hashed.  Since a connection's addresses may change while it is linked,
+*               it is always unlinked through this pointer, never by re-hashing its addresses.
+*
+*               See also 'NETWORK CONNECTION HASH TABLE DEFINES  Note #1'.
 *********************************************************************************************************
 */
 
@@ -478,6 +515,12 @@ struct  net_conn {
 
     NET_CONN               **ConnList;                          /* Conn list.                                           */
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+    NET_CONN                *PrevHashPtr;                       /* Ptr to PREV conn in hash bucket.                     */
+    NET_CONN                *NextHashPtr;                       /* Ptr to NEXT conn in hash bucket.                     */
+    NET_CONN               **HashBucket;                        /* Hash bucket (see Note #3).                           */
+#endif
+
 
     NET_CONN_ID              ID;                                /* Net             conn id.                             */
     NET_CONN_ID              ID_App;                            /* App       layer conn id.                             */
@@ -544,6 +587,11 @@ NET_CONN_EXT  NET_CONN         *NetConn_ConnListNextConnPtr;        /* Ptr to ne
 
 NET_CONN_EXT  CPU_INT16U        NetConn_AccessedTh_nbr;             /* Nbr successful srch's to promote net conns.      */
 
+#if (NET_CONN_CFG_HASH_EN == DEF_ENABLED)                           /* Conn hash tbls.                                  */
+NET_CONN_EXT  NET_CONN         *NetConn_HashTblFull[NET_CONN_CFG_HASH_TBL_SIZE];
+NET_CONN_EXT  NET_CONN         *NetConn_HashTblHalf[NET_CONN_CFG_HASH_TBL_SIZE];
+#endif
+
                                                                     /* Conn addr wildcard cfg.                          */
 NET_CONN_EXT  CPU_BOOLEAN       NetConn_AddrWildCardAvailv4;
 #ifdef  NET_IPv4_MODULE_EN
@@ -794,6 +842,29 @@ void              NetConn_ListUnlink                (NET_CONN_ID              co
 #endif
 
 
+#if    ((NET_CONN_CFG_HASH_EN != DEF_DISABLED) && \
+        (NET_CONN_CFG_HASH_EN != DEF_ENABLED ))
+#error  "NET_CONN_CFG_HASH_EN           illegally #define'd in 'net_cfg.h'"
+#error  "                               [MUST be  DEF_DISABLED]          "
+#error  "                               [     ||  DEF_ENABLED ]          "
+
+
+#elif   (NET_CONN_CFG_HASH_EN == DEF_ENABLED)
+
+#if    ((NET_CONN_CFG_HASH_TBL_SIZE < 1u) || \
+        (NET_CONN_CFG_HASH_TBL_SIZE > 1024u))
+#error  "NET_CONN_CFG_HASH_TBL_SIZE     illegally #define'd in 'net_cfg.h'"
+#error  "                               [MUST be  >= 1   ]               "
+#error  "                               [     &&  <= 1024]               "
+
+#elif   ((NET_CONN_CFG_HASH_TBL_SIZE & NET_CONN_HASH_IX_MASK) != 0u)
+#error  "NET_CONN_CFG_HASH_TBL_SIZE     illegally #define'd in 'net_cfg.h'"
+#error  "                               [MUST be  a power of 2]          "
+#endif
+
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -517,6 +517,30 @@ typedef  struct  net_ctr_sock_stats {
 } NET_CTR_SOCK_STATS;
 
 
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                   GLOBAL LOCK STATISTIC COUNTERS
+*
+* Note(s) : (1) Times are in CPU timestamp timer counts (see 'cpu_core.h  CPU_TS_TmrFreqGet()') & are
+*               ONLY measured if CPU_CFG_TS_32_EN is enabled.
+*
+*           (2) A lock acquisition is contended if the global network lock was held by another task
+*               when it was requested.
+*--------------------------------------------------------------------------------------------------------
+*/
+
+typedef  struct  net_ctr_lock_stats {
+    NET_CTR      AcquireCtr;                                /* Nbr of global lock acquisitions.                         */
+    NET_CTR      ContendCtr;                                /* Nbr of contended    acquisitions (see Note #2).          */
+
+    CPU_INT32U   WaitTimeMax;                               /* Max  time waited to acquire lock (see Note #1).          */
+    CPU_INT64U   WaitTimeTot;                               /* Tot  time waited to acquire lock.                        */
+    CPU_INT32U   HoldTimeMax;                               /* Max  time lock held.                                     */
+    CPU_INT64U   HoldTimeTot;                               /* Tot  time lock held.                                     */
+    void        *HoldTimeMaxFnctPtr;                        /* Fnct that held lock for max time.                        */
+} NET_CTR_LOCK_STATS;
+
+
 /*
 *--------------------------------------------------------------------------------------------------------
 *                                         STATISTIC COUNTERS
@@ -565,6 +589,8 @@ typedef  struct  net_ctr_stats {
     #endif
 
        NET_CTR_SOCK_STATS     Sock;
+
+       NET_CTR_LOCK_STATS     Lock;
 } NET_CTR_STATS;
 
 
@@ -687,6 +713,7 @@ typedef  struct  net_ctr_ifs_errs {
     NET_CTR_IF_ERRS           IF[NET_IF_NBR_IF_TOT];    /* IF-Dev err ctrs.                                     */
 
     NET_CTR                   RxPktDisCtr;              /* Nbr rx'd IF pkts discarded.                          */
+    NET_CTR                   RxSignalFaultCtr;         /* Nbr IF rx task signals NOT successfully posted.      */
     NET_CTR                   TxPktDeallocCtr;          /* Nbr tx'd IF pkts NOT sucessfully dealloc'd.          */
 
     NET_CTR                   TxPktDisCtr;              /* Nbr tx'd IF pkts discarded.                          */
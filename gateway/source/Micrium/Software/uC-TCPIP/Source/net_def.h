@@ -552,6 +552,11 @@
 #endif
 #define  TCP_KEEPCNT                                  0x100C    /*  = NET_SOCK_OPT_KEEP_CNT                             */
 
+#ifdef   TCP_CORK
+#undef   TCP_CORK
+#endif
+#define  TCP_CORK                                     0x100D    /*  = NET_SOCK_OPT_TCP_CORK                             */
+
 #ifdef   IP_TOS
 #undef   IP_TOS
 #endif
@@ -8082,6 +8082,10 @@ exit:
 *                       NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
 *                       NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
 *                                                                                                          value (in seconds)
+*
+*                       NET_SOCK_OPT_TCP_CORK           CPU_BOOLEAN           TCP connection transmit cork status:
+*                                                                                 DEF_ENABLED
+*                                                                                 DEF_DISABLED
 *********************************************************************************************************
 */
 
@@ -8144,6 +8148,7 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
        case NET_SOCK_OPT_TCP_KEEP_CNT:
        case NET_SOCK_OPT_TCP_KEEP_IDLE:
        case NET_SOCK_OPT_TCP_KEEP_INTVL:
+       case NET_SOCK_OPT_TCP_CORK:
             if (level != NET_SOCK_PROTOCOL_TCP) {
                *p_err =  NET_SOCK_ERR_INVALID_OPT_LEVEL;
                 goto exit_lock_fault;                           /* Sock opt incompatible with protocol level.           */
@@ -8305,6 +8310,25 @@ NET_SOCK_RTN_CODE  NetSock_OptGet (NET_SOCK_ID         sock_id,
             break;
 
 
+       case NET_SOCK_OPT_TCP_CORK:
+            if (*p_opt_len < (CPU_INT32S)sizeof(CPU_BOOLEAN)) {
+                *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
+                 goto exit_err_opt_get;
+            }
+
+            conn_id     =  p_sock->ID_Conn;
+            conn_id_tcp =  NetConn_ID_TransportGet(conn_id, p_err);
+            p_conn       = &NetTCP_ConnTbl[conn_id_tcp];
+           *p_opt_len    =  sizeof(CPU_BOOLEAN);
+
+            Mem_Copy(             p_opt_val,
+                     (void     *)&p_conn->TxCorkEn,
+                     (CPU_SIZE_T)*p_opt_len);
+
+           *p_err = NET_SOCK_ERR_NONE;
+            break;
+
+
        case NET_SOCK_OPT_TCP_KEEP_CNT:
             if (*p_opt_len < (CPU_INT32S)sizeof(NET_PKT_CTR)) {
                 *p_err = NET_SOCK_ERR_INVALID_OPT_LEN;
@@ -18492,6 +18516,8 @@ static  NET_SOCK_RTN_CODE  NetSock_TxDataHandlerDatagram (NET_SOCK_ID          s
                                                                 /* See Note #11b.                                       */
                       data_len_tot = NetUDP_TxAppDataHandlerIPv4((void            *) p_data,
                                                                  (CPU_INT16U       ) data_len,
+                                                                 (NET_BUF_EXT_DATA_FNCT) 0,
+                                                                 (void            *) 0,
                                                                  (NET_IPv4_ADDR    ) src_addrv4,
                                                                  (NET_UDP_PORT_NBR ) src_port,
                                                                  (NET_IPv4_ADDR    ) dest_addrv4,
@@ -22565,6 +22591,10 @@ exit:
 *                       NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
 *                       NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
 *                                                                                                          value (in seconds)
+*
+*                       NET_SOCK_OPT_TCP_CORK           CPU_BOOLEAN           TCP connection transmit cork status:
+*                                                                                 DEF_ENABLED
+*                                                                                 DEF_DISABLED
 *********************************************************************************************************
 */
 
@@ -22601,6 +22631,7 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (NET_SOCK_ID         sock_id,
         case NET_SOCK_OPT_TCP_KEEP_CNT:
         case NET_SOCK_OPT_TCP_KEEP_IDLE:
         case NET_SOCK_OPT_TCP_KEEP_INTVL:
+        case NET_SOCK_OPT_TCP_CORK:
              if (level != NET_SOCK_PROTOCOL_TCP) {
                 *p_err =   NET_SOCK_ERR_INVALID_OPT_LEVEL;
                  goto exit_lock_fault;                          /* Sock opt incompatible with protocol level.           */
@@ -22761,6 +22792,21 @@ NET_SOCK_RTN_CODE  NetSock_OptSet (NET_SOCK_ID         sock_id,
                               }
                               break;
 
+                         case NET_SOCK_OPT_TCP_CORK:
+                              if (opt_len != sizeof(CPU_BOOLEAN)) {
+                                 *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
+                                  break;
+                              }
+
+                              p_bool_val = (CPU_BOOLEAN *)p_opt_val;
+                             (void)NetTCP_ConnCfgTxCorkEnHandler((NET_TCP_CONN_ID) conn_id_transport,
+                                                                                  *p_bool_val,
+                                                                                   p_err);
+                              if (*p_err == NET_TCP_ERR_NONE) {
+                                  *p_err  = NET_SOCK_ERR_NONE;
+                              }
+                              break;
+
                          case NET_SOCK_OPT_TCP_KEEP_CNT:
                               if (opt_len != sizeof(NET_PKT_CTR)) {
                                  *p_err = NET_SOCK_ERR_INVALID_DATA_SIZE;
@@ -644,6 +644,7 @@ typedef  enum  net_sock_opt_name {
     NET_SOCK_OPT_TCP_KEEP_CNT                = TCP_KEEPCNT,
     NET_SOCK_OPT_TCP_KEEP_IDLE               = TCP_KEEPIDLE,
     NET_SOCK_OPT_TCP_KEEP_INTVL              = TCP_KEEPINTVL,
+    NET_SOCK_OPT_TCP_CORK                    = TCP_CORK,
 
     NET_SOCK_OPT_IP_TOS                      = IP_TOS,
     NET_SOCK_OPT_IP_TTL                      = IP_TTL,
@@ -42,16 +42,17 @@
 *                                                                                'The Communication of
 *                                                                                  Urgent Information'
 *
-*                     (c) The following TCP options NOT supported :
-*
-*                         (1) Window Scale                                      RFC #1072, Section 2
-*                                                                               RFC #1323, Section 2
-*                         (2) Selective Acknowledgement (SACK)                  RFC #1072, Section 3
-*                                                                               RFC #2018
-*                                                                               RFC #2883
-*                         (3) TCP Echo                                          RFC #1072, Section 4
-*                         (4) Timestamp                                         RFC #1323, Section 3.2
-*                         (5) Protection Against Wrapped Sequences (PAWS)       RFC #1323, Section 4
+*                     (c) The following TCP options are supported with restrictions (see 'net_tcp.h
+*                         TCP OPTION ENABLE DEFINES  Note #1') :
+*
+*                         (1) Window Scale                                      RFC #7323, Section 2
+*                               Remote windows scaled; local window NOT scaled
+*                         (2) Selective Acknowledgement (SACK)                  RFC #2018
+*                               D-SACK                 NOT supported            RFC #2883
+*                         (3) TCP Echo                 NOT supported            RFC #1072, Section 4
+*                         (4) Timestamp                                         RFC #7323, Section 3
+*                         (5) Protection Against Wrapped Sequences (PAWS)       RFC #7323, Section 5
+*                               NOT supported
 *
 *                     (d) IP-Options-to-TCP-Connection                          RFC #1122, Section 4.2.3.8
 *                                Handling NOT supported #### NET-804
@@ -297,6 +298,24 @@ typedef  CPU_INT16U          NET_TCP_CLOSE_CODE;
 typedef  NET_TCP_CLOSE_CODE  NET_TCP_FREE_CODE;
 
 
+/*
+*********************************************************************************************************
+*                                  TCP TRANSMIT OPTIONS DATA TYPE
+*
+* Note(s) : (1) Holds every TCP option configuration a transmitted segment may carry; prepared & chained
+*               by NetTCP_TxConnOptPrepare() (see 'net_tcp.h  TCP HEADER OPTION CONFIGURATION DATA TYPES').
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_tx_opt {
+    NET_TCP_OPT_CFG_MAX_SEG_SIZE  MaxSegSize;
+    NET_TCP_OPT_CFG_WIN_SCALE     WinScale;
+    NET_TCP_OPT_CFG_SACK_PERMIT   SACK_Permit;
+    NET_TCP_OPT_CFG_TS            TS;
+    NET_TCP_OPT_CFG_SACK          SACK;
+} NET_TCP_TX_OPT;
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -341,6 +360,27 @@ static  CPU_BOOLEAN         NetTCP_RxPktValidateOptMaxSegSize     (NET_BUF_HDR
                                                                    CPU_INT08U            *p_opt_len,
                                                                    NET_ERR               *p_err);
 
+static  CPU_BOOLEAN         NetTCP_RxPktValidateOptWinScale       (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_opt,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   NET_ERR               *p_err);
+
+static  CPU_BOOLEAN         NetTCP_RxPktValidateOptSACK_Permit    (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_opt,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   NET_ERR               *p_err);
+
+static  CPU_BOOLEAN         NetTCP_RxPktValidateOptSACK           (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_opt,
+                                                                   CPU_INT16U             opt_ix,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   NET_ERR               *p_err);
+
+static  CPU_BOOLEAN         NetTCP_RxPktValidateOptTS             (NET_BUF_HDR           *p_buf_hdr,
+                                                                   CPU_INT08U            *p_opt,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   NET_ERR               *p_err);
+
 
 
 static  void                NetTCP_RxPktDemuxSeg                  (NET_BUF               *p_buf,
@@ -353,6 +393,10 @@ static  void                NetTCP_RxPktConnHandler               (NET_BUF
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    NET_ERR               *p_err);
 
+static  void                NetTCP_RxPktConnHandlerOpt            (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF               *p_buf,
+                                                                   NET_BUF_HDR           *p_buf_hdr);
+
                                                                 /* See Note #1.                                         */
 static  void                NetTCP_RxPktConnHandlerListen         (NET_TCP_CONN          *p_conn,
                                                                    NET_BUF               *p_buf,
@@ -618,6 +662,17 @@ static  void                NetTCP_TxConnReTxQ_TimeoutSet         (NET_TCP_CONN
                                                                    NET_TCP_CLOSE_CODE     close_code,
                                                                    NET_ERR               *p_err);
 
+static  void                NetTCP_TxConnReTxSeg                  (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF               *pseg,
+                                                                   NET_TCP_CLOSE_CODE     close_code,
+                                                                   NET_ERR               *p_err);
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+static  void                NetTCP_TxConnReTxQ_SACK               (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_CLOSE_CODE     close_code,
+                                                                   NET_ERR               *p_err);
+#endif
+
 
 
 static  void                NetTCP_TxConnPrepareSegAddrs          (NET_TCP_CONN          *p_conn,
@@ -631,6 +686,16 @@ static  void                NetTCP_TxConnPrepareSegAddrs          (NET_TCP_CONN
                                                                    CPU_INT16U             dest_port_len,
                                                                    NET_ERR               *p_err);
 
+static  CPU_INT16U          NetTCP_TxConnOptLenGet                (NET_TCP_CONN          *p_conn,
+                                                                   CPU_BOOLEAN            sync,
+                                                                   CPU_BOOLEAN            sack);
+
+static  void               *NetTCP_TxConnOptPrepare               (NET_TCP_CONN          *p_conn,
+                                                                   NET_TCP_TX_OPT        *p_tx_opt,
+                                                                   NET_TCP_SEQ_NBR        ack_nbr,
+                                                                   CPU_BOOLEAN            sync,
+                                                                   CPU_BOOLEAN            sack);
+
 
 static  void                NetTCP_TxConnRTT_Init                 (NET_TCP_CONN          *p_conn);
 
@@ -716,6 +781,28 @@ static  void                NetTCP_TxPktValidateOptMaxSegSize     (void
                                                                    void                 **p_opt_next,
                                                                    NET_TCP_FLAGS          flags_tcp,
                                                                    NET_ERR               *p_err);
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static  void                NetTCP_TxPktValidateOptWinScale       (void                  *p_opt_tcp,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_TCP_FLAGS          flags_tcp,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+static  void                NetTCP_TxPktValidateOptSACK_Permit    (void                  *p_opt_tcp,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_TCP_FLAGS          flags_tcp,
+                                                                   NET_ERR               *p_err);
+
+static  void                NetTCP_TxPktValidateOptSACK           (void                  *p_opt_tcp,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_TCP_FLAGS          flags_tcp,
+                                                                   NET_ERR               *p_err);
+#endif
 #endif
 
 
@@ -767,6 +854,36 @@ static  void                NetTCP_TxPktPrepareOptMaxSegSize      (void
                                                                    void                 **p_opt_next,
                                                                    NET_ERR               *p_err);
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static  void                NetTCP_TxPktPrepareOptWinScale        (void                  *p_opts_tcp,
+                                                                   CPU_INT08U            *p_opt_hdr,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+static  void                NetTCP_TxPktPrepareOptSACK_Permit     (void                  *p_opts_tcp,
+                                                                   CPU_INT08U            *p_opt_hdr,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_ERR               *p_err);
+
+static  void                NetTCP_TxPktPrepareOptSACK            (void                  *p_opts_tcp,
+                                                                   CPU_INT08U            *p_opt_hdr,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_ERR               *p_err);
+#endif
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+static  void                NetTCP_TxPktPrepareOptTS              (void                  *p_opts_tcp,
+                                                                   CPU_INT08U            *p_opt_hdr,
+                                                                   CPU_INT08U            *p_opt_len,
+                                                                   void                 **p_opt_next,
+                                                                   NET_ERR               *p_err);
+#endif
+
 static  void                NetTCP_TxPktPrepareHdr                (NET_BUF               *p_buf,
                                                                    NET_BUF_HDR           *p_buf_hdr,
                                                                    CPU_INT16U             tcp_hdr_len_tot,
@@ -800,6 +917,9 @@ static  void                NetTCP_ConnCfg                        (NET_TCP_CONN
 
 static  void                NetTCP_ConnCfgMaxSegSize              (NET_TCP_CONN          *p_conn);
 
+static  void                NetTCP_ConnOptNegotiate               (NET_TCP_CONN          *p_conn,
+                                                                   NET_BUF_HDR           *p_buf_hdr);
+
 
 
 static  void                NetTCP_ConnIdleTimeout                (void                  *p_conn_timeout);
@@ -3292,8 +3412,8 @@ void  NetTCP_TxConnReqClose (NET_TCP_CONN_ID   conn_id_tcp,
 *
 *                   (c) On ANY transmit error, any remaining application data transmit is immediately aborted.
 *
-*                   See also 'NetTCP_TxConnTxQ()    Note #14'.
-*                          & 'NetTCP_TxConnReTxQ()  Note #11'.
+*                   See also 'NetTCP_TxConnTxQ()      Note #14'.
+*                          & 'NetTCP_TxConnReTxSeg()  Note #11'.
 *********************************************************************************************************
 */
 
@@ -3598,7 +3718,11 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
             data_len_pkt     = DEF_MIN(data_len_rem_min, p_conn->TxWinSizeCfgdRem);
 
                                                                 /* Wr app data into TCP tx buf.                         */
+#ifndef  NET_TCP_CHK_SUM_OFFLOAD_TX
+            NetBuf_DataWrChkSum(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+#else
             NetBuf_DataWr(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+#endif
             if ( err != NET_BUF_ERR_NONE) {                     /* If wr err, tx Q data corrupted; ...                  */
                                                                 /* ... close TCP conn (see Note #10a).                  */
                 NetTCP_ConnClose(p_conn, DEF_NULL, DEF_YES, NET_TCP_CONN_CLOSE_ALL);
@@ -3655,7 +3779,7 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
 
     NetTCP_GetTxDataIx(if_nbr,
                        proto_type,
-                       0u,
+                       NetTCP_TxConnOptLenGet(p_conn, DEF_NO, DEF_NO),
                        data_len,
                        p_conn,
                       &data_ix_pkt,
@@ -3673,7 +3797,7 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
         data_ix_pkt = 0u;
         NetTCP_GetTxDataIx( if_nbr,
                             proto_type,
-                            0u,
+                            NetTCP_TxConnOptLenGet(p_conn, DEF_NO, DEF_NO),
                             data_len,
                             p_conn,
                            &data_ix_pkt,
@@ -3698,7 +3822,11 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
 
 
         if (tx_err == DEF_NO) {                                 /* Wr app data into TCP tx buf.                         */
+#ifndef  NET_TCP_CHK_SUM_OFFLOAD_TX
+            NetBuf_DataWrChkSum(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+#else
             NetBuf_DataWr(p_buf, data_ix_pkt, data_len_pkt, p_data_pkt, &err);
+#endif
             if (err != NET_BUF_ERR_NONE) {
                 NetTCP_TxPktDiscard(p_buf, &err);
                 tx_err = DEF_YES;
@@ -3853,159 +3981,468 @@ CPU_INT16U  NetTCP_TxConnAppData (NET_TCP_CONN_ID   conn_id_tcp,
 
 /*
 *********************************************************************************************************
-*                                       NetTCP_ConnIsAvailRx()
+*                                      NetTCP_TxConnAppBufGet()
 *
-* Description : (1) Check TCP connection for available receive operation(s) :
-*
-*                   (a) Application receive data
-*                   (b) Receive connection closed
+* Description : Get a network buffer large enough to transmit application data in a single TCP segment;
+*                   the caller formats the application data directly in the buffer & then queues it on the
+*                   TCP connection via NetTCP_TxConnAppBufQ().
 *
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to transmit application data.
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to check for available receive operation(s).
+*               data_len        Length of application data to transmit (in octets).
 *
-*               p_err        Pointer to variable that will receive the return error code from this function :
+*               p_data_ix       Pointer to variable that will receive the index of the application data in
+*                                   the returned network buffer.
 *
-*                               NET_TCP_ERR_NONE                    TCP connection successfully checked for
-*                                                                       available receive operation(s); check
-*                                                                       return value for receive availability.
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
+*                               NET_TCP_ERR_NONE                    Network buffer successfully allocated.
+*                               NET_TCP_ERR_INVALID_DATA_SIZE       Invalid application data size.
 *                               NET_TCP_ERR_INVALID_CONN_OP         Invalid TCP connection operation.
+*                               NET_TCP_ERR_TX_Q_SUSPEND            TCP connection transmit queue suspended.
+*                               NET_TCP_ERR_TX_Q_FULL               Application data does NOT fit in a single
+*                                                                       segment or in the transmit window.
+*                               NET_TCP_ERR_NONE_AVAIL              NO network buffer available.
+*                               NET_TCP_ERR_CONN_FAULT              TCP connection fault.
 *
 *                                                                   --- RETURNED BY NetTCP_ConnIsUsed() : ----
-*                               NET_INIT_ERR_NOT_COMPLETED             Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN            Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
 *
-* Return(s)   : DEF_YES, if TCP connection has any available receive operation(s).
-*
-*               DEF_NO,  otherwise.
-*
-* Caller(s)   : NetSock_IsAvailRxStream().
-*
-* Note(s)     : (2) RFC #793, Section 3.9 'Event Processing : RECEIVE Call' specifies how to handle receive
-*                   data requests from the application layer :
-*
-*                   (a) For the "CLOSED STATE ... return 'error: connection does not exist'".
-*
-*                   (b) (1) For the "LISTEN STATE, SYN-SENT STATE, SYN-RECEIVED STATE ... queue for processing
-*                           after entering ESTABLISHED state".
-*
-*                       (2) The application layer may request to receive application data before the TCP
-*                           connection enters the connected state.  Such requests will block or return
-*                           no data.
-*
-*                   (c) For the "ESTABLISHED STATE, FIN-WAIT-1 STATE, FIN-WAIT-2 STATE" :
+* Return(s)   : Pointer to network buffer, if NO error(s).
 *
-*                       (1) "If insufficient incoming segments are queued to satisfy the request, queue
-*                            the request."
+*               Pointer to NULL,           otherwise.
 *
-*                       (2) "Reassemble queued incoming segments into receive buffer and return to user."
+* Caller(s)   : NetSecure_SockTxDataHandler().
 *
-*                   (d) For the "CLOSE-WAIT STATE ... since the remote side has already sent FIN, RECEIVEs
-*                       must be satisfied by the text already on hand, but not yet delivered to the user.
-*                       If no text is awaiting delivery, the RECEIVE will get a 'error: connection closing'
-*                       response.  Otherwise, any remaining text can be used to satisfy the RECEIVE".
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
 *
-*                   (e) (1) For the "CLOSING STATE, LAST-ACK STATE, TIME-WAIT STATE ... return 'error:
-*                           connection closing'".
+* Note(s)     : (1) NetTCP_TxConnAppBufGet() is called by network protocol suite function(s) & MUST be called
+*                   with the global network lock already acquired; & the lock MUST NOT be released until the
+*                   network buffer is queued by NetTCP_TxConnAppBufQ() or freed.
 *
-*                       (2) Typically, these states will have already received ALL remaining closing
-*                           data from the closing remote host.
+*               (2) NetTCP_TxConnAppBufGet() NEVER blocks; if the application data cannot be transmitted
+*                   immediately in a single TCP segment, NO network buffer is returned & the caller SHOULD
+*                   transmit the application data via NetTCP_TxConnAppData().
 *
-*                           (A) However, in case all receive data from the remote host has NOT yet been
-*                               received, application layer receives from these states are permitted until
-*                               the TCP connection's sequence receive state is closed & the TCP connection's
-*                               application receive queue is empty.
+*               (3) At least NET_TCP_HDR_SIZE_MIN octets preceding the application data index are reserved
+*                   for the TCP header & MAY be used as scratch space until the network buffer is queued.
 *
-*                   See also 'NetTCP_RxAppData()  Note #2'.
+*               (4) ALL checks that can fail are run before the network buffer is returned, including the
+*                   segment's addresses which are stored in the network buffer header; once the caller
+*                   has formed its data, NetTCP_TxConnAppBufQ() is therefore NOT expected to fail (see
+*                   'NetTCP_TxConnAppBufQ()  Note #1').
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnIsAvailRx (NET_TCP_CONN_ID   conn_id_tcp,
-                                   NET_ERR          *p_err)
+NET_BUF  *NetTCP_TxConnAppBufGet (NET_TCP_CONN_ID   conn_id_tcp,
+                                  CPU_INT16U        data_len,
+                                  NET_BUF_SIZE     *p_data_ix,
+                                  NET_ERR          *p_err)
 {
-    NET_TCP_CONN  *p_conn;
-    CPU_BOOLEAN    rx_avail;
+#ifdef  NET_IPv4_MODULE_EN
+    NET_IPv4_ADDR       src_addrv4   = NET_IPv4_ADDR_NONE;
+    NET_IPv4_ADDR       dest_addrv4  = NET_IPv4_ADDR_NONE;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    NET_IPv6_ADDR       src_addrv6   = NET_IPv6_ADDR_NONE;
+    NET_IPv6_ADDR       dest_addrv6  = NET_IPv6_ADDR_NONE;
+#endif
+    NET_TCP_PORT_NBR    src_port     = NET_PORT_NBR_NONE;
+    NET_TCP_PORT_NBR    dest_port    = NET_PORT_NBR_NONE;
+    NET_BUF_HDR        *p_buf_hdr    = DEF_NULL;
+    NET_TCP_CONN       *p_conn       = DEF_NULL;
+    NET_CONN           *p_net_conn   = DEF_NULL;
+    NET_IF_NBR          if_nbr       = NET_IF_NBR_NONE;
+    NET_BUF            *p_buf        = DEF_NULL;
+    NET_BUF_SIZE        buf_size_max = 0u;
+    NET_BUF_SIZE        data_ix      = 0u;
+    NET_BUF_SIZE        data_ix_offset;
+    NET_PROTOCOL_TYPE   proto_type   = NET_PROTOCOL_TYPE_NONE;
+    NET_ERR             err;
 
 
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+                                                                /* ---------------- VALIDATE APP DATA ----------------- */
+    if (p_data_ix == DEF_NULL) {
+       *p_err =  NET_ERR_FAULT_NULL_PTR;
+        return (DEF_NULL);
+    }
+    if (data_len < 1) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxInvalidSizeCtr);
+       *p_err =  NET_TCP_ERR_INVALID_DATA_SIZE;
+        return (DEF_NULL);
+    }
+
+                                                                /* -------------- VALIDATE TCP CONN USED -------------- */
    (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
     if (*p_err != NET_TCP_ERR_NONE) {
-         return (DEF_NO);
+         return (DEF_NULL);
     }
 #endif
 
-                                                                /* -------------- CHK TCP CONN RX AVAIL --------------- */
+                                                                /* ---------------- VALIDATE TCP CONN ----------------- */
     p_conn = &NetTCP_ConnTbl[conn_id_tcp];
 
-    switch (p_conn->ConnState) {
-        case NET_TCP_CONN_STATE_FREE:
-            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
-             return (DEF_NO);
+    switch (p_conn->ConnState) {                                /* Only tx data on sync'd conns ...                     */
+        case NET_TCP_CONN_STATE_CONN:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+             break;
 
 
-        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #2a.                                        */
-            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
-             return (DEF_NO);
+        default:                                                /* ... all other states handled by ...                  */
+                                                                /* ... NetTCP_TxConnAppData() (see Note #2).            */
+            *p_err = NET_TCP_ERR_INVALID_CONN_OP;
+             return (DEF_NULL);
+    }
 
+    switch (p_conn->TxQ_State) {
+        case NET_TCP_TX_Q_STATE_CONN:
+        case NET_TCP_TX_Q_STATE_CLOSING:
+             break;
 
-        case NET_TCP_CONN_STATE_LISTEN:                         /* See Note #2b.                                        */
-        case NET_TCP_CONN_STATE_SYNC_RXD:
-        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
-        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
-        case NET_TCP_CONN_STATE_SYNC_TXD:
-             rx_avail = DEF_NO;                                 /* See Note #2b2.                                       */
+
+        default:
+            *p_err = NET_TCP_ERR_TX_Q_SUSPEND;
+             return (DEF_NULL);
+    }
+
+    if ((data_len > p_conn->TxWinSizeCfgdRem) ||                /* If data does NOT fit in tx win ...                   */
+        (data_len > p_conn->MaxSegSizeConn  )) {                /* ... or in a single seg,        ...                   */
+       *p_err = NET_TCP_ERR_TX_Q_FULL;                          /* ... rtn tx Q full err (see Note #2).                 */
+        return (DEF_NULL);
+    }
+
+
+                                                                /* ------------------ GET APP TX BUF ------------------ */
+    if_nbr = NetConn_IF_NbrGet(p_conn->ID_Conn, &err);
+    if (err != NET_CONN_ERR_NONE) {
+       *p_err = NET_TCP_ERR_CONN_FAULT;
+        return (DEF_NULL);
+    }
+
+    p_net_conn = &NetConn_Tbl[p_conn->ID_Conn];
+    switch (p_net_conn->Family) {
+        case NET_SOCK_PROTOCOL_FAMILY_IP_V4:
+             proto_type = NET_PROTOCOL_TYPE_TCP_V4;
              break;
 
 
-        case NET_TCP_CONN_STATE_CONN:                           /* See Note #2c.                                        */
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:
-                                                                /* Chk TCP conn rx data avail (see Note #2c).           */
-             rx_avail =  (p_conn->RxQ_App_Head != DEF_NULL) ? DEF_YES : DEF_NO;
+        case NET_SOCK_PROTOCOL_FAMILY_IP_V6:
+             proto_type = NET_PROTOCOL_TYPE_TCP_V6;
              break;
 
 
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:                     /* See Note #2d.                                        */
-        case NET_TCP_CONN_STATE_CLOSING:                        /* See Note #2e.                                        */
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
-                                                                /* Chk TCP conn rx data avail (see Note #2d) OR ...     */
-             rx_avail = ((p_conn->RxQ_App_Head != DEF_NULL) ||
-                                                                /* ... TCP conn rx q closed   (see Note #2e2A).         */
-                        ((p_conn->RxQ_App_Head == DEF_NULL) &&
-                         (p_conn->RxQ_State    ==  NET_TCP_RX_Q_STATE_CLOSED))) ? DEF_YES : DEF_NO;
+        default:
+            *p_err = NET_TCP_ERR_CONN_FAULT;
+             return (DEF_NULL);
+    }
+
+    NetTCP_GetTxDataIx(if_nbr,
+                       proto_type,
+                       NetTCP_TxConnOptLenGet(p_conn, DEF_NO, DEF_NO),
+                       data_len,
+                       p_conn,
+                      &data_ix,
+                      &err);
+    switch (err) {
+        case NET_IPv4_ERR_NONE:
+        case NET_IPv6_ERR_NONE:
              break;
 
 
-        case NET_TCP_CONN_STATE_NONE:
         default:
-            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
-             return (DEF_NO);
+            *p_err = NET_TCP_ERR_CONN_FAULT;
+             return (DEF_NULL);
     }
 
+    buf_size_max = NetBuf_GetMaxSize(if_nbr, NET_TRANSACTION_TX, DEF_NULL, data_ix);
+    if (data_len > buf_size_max) {
+       *p_err = NET_TCP_ERR_TX_Q_FULL;
+        return (DEF_NULL);
+    }
 
-   *p_err =  NET_TCP_ERR_NONE;
+                                                                /* Prepare seg addrs (see Note #4).                     */
+    switch (p_net_conn->Family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_SOCK_FAMILY_IP_V4:
+             NetTCP_TxConnPrepareSegAddrs(p_conn,
+                           (CPU_INT08U *)&src_addrv4,
+                           (CPU_INT08U *)&src_port,
+                                          sizeof(src_addrv4),
+                                          sizeof(src_port),
+                           (CPU_INT08U *)&dest_addrv4,
+                           (CPU_INT08U *)&dest_port,
+                                          sizeof(dest_addrv4),
+                                          sizeof(dest_port),
+                                         &err);
+             break;
+#endif
 
-    return (rx_avail);
-}
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_SOCK_FAMILY_IP_V6:
+             NetTCP_TxConnPrepareSegAddrs(p_conn,
+                           (CPU_INT08U *)&src_addrv6,
+                           (CPU_INT08U *)&src_port,
+                                          sizeof(src_addrv6),
+                                          sizeof(src_port),
+                           (CPU_INT08U *)&dest_addrv6,
+                           (CPU_INT08U *)&dest_port,
+                                          sizeof(dest_addrv6),
+                                          sizeof(dest_port),
+                                         &err);
+             break;
+#endif
 
+        default:
+             err = NET_CONN_ERR_INVALID_FAMILY;
+             break;
+    }
+    if (err != NET_TCP_ERR_NONE) {
+       *p_err = NET_TCP_ERR_CONN_FAULT;
+        return (DEF_NULL);
+    }
 
-/*
-*********************************************************************************************************
-*                                        NetTCP_ConnIsRdyTx()
-*
-* Description : Check if TCP connection ready to transmit.
-*
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to check if ready to transmit.
-*
-*               p_err        Pointer to variable that will receive the return error code from this function :
-*
-*                               NET_TCP_ERR_NONE                    TCP connection successfully checked if
-*                                                                       ready for transmit; check return
-*                                                                       value for transmit ready availability.
+    p_buf = NetBuf_Get(if_nbr,
+                       NET_TRANSACTION_TX,
+                       data_len,
+                       data_ix,
+                      &data_ix_offset,
+                       NET_BUF_FLAG_NONE,
+                      &err);
+    if (err != NET_BUF_ERR_NONE) {
+       *p_err = NET_TCP_ERR_NONE_AVAIL;
+        return (DEF_NULL);
+    }
+
+    p_buf_hdr = &p_buf->Hdr;
+    switch (p_net_conn->Family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_SOCK_FAMILY_IP_V4:
+             p_buf_hdr->IP_AddrSrc    = src_addrv4;
+             p_buf_hdr->IP_AddrDest   = dest_addrv4;
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_SOCK_FAMILY_IP_V6:
+             p_buf_hdr->IPv6_AddrSrc  = src_addrv6;
+             p_buf_hdr->IPv6_AddrDest = dest_addrv6;
+             break;
+#endif
+
+        default:
+             break;
+    }
+    p_buf_hdr->TransportPortSrc  = src_port;
+    p_buf_hdr->TransportPortDest = dest_port;
+
+   *p_data_ix = data_ix + data_ix_offset;
+   *p_err     = NET_TCP_ERR_NONE;
+
+    return (p_buf);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_TxConnAppBufQ()
+*
+* Description : Queue a network buffer of application data on a TCP connection's transmit queue & transmit.
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to transmit application data.
+*
+*               p_buf           Pointer to network buffer returned by NetTCP_TxConnAppBufGet().
+*
+*               data_ix         Index  of application data in network buffer.
+*
+*               data_len        Length of application data in network buffer (in octets).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                    Application data successfully queued.
+*                               NET_TCP_ERR_INVALID_DATA_SIZE       Invalid application data size; TCP connection
+*                                                                       closed (see Note #4).
+*
+*                                                                   -------- RETURNED BY NetTCP_TxConnTxQ() : ----------
+*                               NET_TCP_ERR_CONN_CLOSE              TCP connection closed.
+*                               NET_TCP_ERR_TX_PKT                  TCP transmit packet error.
+*
+* Return(s)   : Number of data octets queued, if NO error(s).
+*
+*               0,                            otherwise.
+*
+* Caller(s)   : NetSecure_SockTxDataHandler().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The global network lock MUST NOT have been released since the network buffer was
+*                   returned by NetTCP_TxConnAppBufGet(); the TCP connection's state & transmit window are
+*                   therefore still valid for the application data.
+*
+*               (2) The network buffer is ALWAYS consumed, even on error.
+*
+*               (3) See 'NetTCP_TxConnAppData()  Notes #3, #6b3B1b, #8 & #10'.
+*
+*               (4) The caller MAY have already committed the data in the network buffer (e.g. a secure
+*                   record that consumed a record sequence number); dropping it would leave a gap in the
+*                   data stream the peer can NOT recover from.  Since ALL checks that can fail are run by
+*                   NetTCP_TxConnAppBufGet() (see 'NetTCP_TxConnAppBufGet()  Note #4'), an invalid data
+*                   length here is a caller fault & the TCP connection is closed rather than left open
+*                   with missing data.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  NetTCP_TxConnAppBufQ (NET_TCP_CONN_ID   conn_id_tcp,
+                                  NET_BUF          *p_buf,
+                                  NET_BUF_SIZE      data_ix,
+                                  CPU_INT16U        data_len,
+                                  NET_ERR          *p_err)
+{
+    NET_TCP_CONN        *p_conn       = DEF_NULL;
+    NET_BUF             *p_buf_q_tail = DEF_NULL;
+    NET_BUF_HDR         *p_buf_hdr    = DEF_NULL;
+    NET_ERR              err          = NET_ERR_NONE;
+
+
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
+    if ((data_len < 1) ||                                       /* Validate data len vs. tx win (see Note #1).          */
+        (data_len > p_conn->TxWinSizeCfgdRem)) {
+        NetTCP_TxConnAppBufAbort(conn_id_tcp, p_buf);           /* Close conn (see Note #4).                            */
+       *p_err = NET_TCP_ERR_INVALID_DATA_SIZE;
+        return (0u);
+    }
+
+                                                                /* Init TCP seg tx buf ctrls.                           */
+    p_buf_hdr                    = &p_buf->Hdr;
+    p_buf_hdr->DataIx            =  data_ix;
+    p_buf_hdr->DataLen           =  data_len;
+    p_buf_hdr->TotLen            =  p_buf_hdr->DataLen;
+    p_buf_hdr->ProtocolHdrType   =  NET_PROTOCOL_TYPE_APP;
+                                                                /* Seg addrs set by NetTCP_TxConnAppBufGet().           */
+    p_buf_hdr->TCP_SegLenInit    = data_len;
+    p_buf_hdr->TCP_SegLen        = p_buf_hdr->TCP_SegLenInit;
+    p_buf_hdr->TCP_SegLenData    = p_buf_hdr->TCP_SegLenInit;
+    p_buf_hdr->TCP_SegSync       = DEF_NO;
+    p_buf_hdr->TCP_SegClose      = DEF_NO;
+    p_buf_hdr->TCP_SegAck        = DEF_YES;
+    p_buf_hdr->TCP_SegReset      = DEF_NO;
+
+    p_buf_hdr->TCP_SeqNbrInit    = p_conn->TxSeqNbrNextQ;
+    p_buf_hdr->TCP_SeqNbr        = p_buf_hdr->TCP_SeqNbrInit;
+                                                                /* Set PUSH flag (see Note #3).                         */
+    p_buf_hdr->TCP_Flags         = NET_TCP_FLAG_NONE   |
+                                   NET_TCP_FLAG_TX_ACK |
+                                   NET_TCP_FLAG_TX_PUSH;
+
+                                                                /* Dec TCP conn's tx win size.                          */
+    NetTCP_TxConnWinSizeHandlerCfgd(p_conn, data_len, NET_TCP_CONN_TX_WIN_DEC, &err);
+
+
+                                                                /* ----------------- UPDATE TCP CONN ------------------ */
+    if (p_conn->TxQ_Tail != DEF_NULL) {                         /* If tx Q NOT empty, append seg @ Q tail.              */
+        p_buf_q_tail                      =  p_conn->TxQ_Tail;
+        p_buf_q_tail->Hdr.NextPrimListPtr =  p_buf;
+        p_buf_hdr->PrevPrimListPtr        =  p_buf_q_tail;
+        p_conn->TxQ_Tail                  =  p_buf;
+
+    } else {                                                    /* Else add seg to empty tx Q.                          */
+        p_conn->TxQ_Head                  =  p_buf;
+        p_conn->TxQ_Tail                  =  p_buf;
+    }
+
+    p_conn->TxSeqNbrNextQ += data_len;                          /* Update TCP conn tx seq nbr.                          */
+
+
+                                                                /* ---------------- TX TCP DATA SEG(S) ---------------- */
+    NetTCP_TxConnTxQ(p_conn, 0, NET_TCP_CONN_TX_ACK_NONE, DEF_NO, NET_TCP_CONN_CLOSE_ALL, DEF_YES, p_err);
+    switch (*p_err) {
+        case NET_TCP_ERR_NONE:
+        case NET_TCP_ERR_CONN_ACK_NONE:
+        case NET_TCP_ERR_CONN_ACK_DLYD:
+        case NET_TCP_ERR_CONN_ACK_PREVLY_TXD:
+        case NET_ERR_TX:                                        /* Ignore transitory tx err(s).                         */
+        case NET_ERR_IF_LINK_DOWN:
+             break;
+
+
+        default:                                                /* Data q'd but conn faulted (see Note #2).             */
+             return (0u);
+    }
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (data_len);
+}
+
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxConnAppBufAbort()
+*
+* Description : Discard a network buffer returned by NetTCP_TxConnAppBufGet() whose application data was
+*                   already committed by the caller & close the TCP connection.
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection the network buffer was allocated for.
+*
+*               p_buf           Pointer to network buffer returned by NetTCP_TxConnAppBufGet().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnAppBufQ(),
+*               NetSecure_SockTxInPlace().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Data that the caller can NOT re-form (e.g. a secure record that consumed a record
+*                   sequence number) MUST NOT be silently dropped from the TCP data stream; the TCP
+*                   connection is reset instead so that the peer does NOT receive the stream with a gap.
+*
+*                   See also 'NetTCP_TxConnAppBufQ()  Note #4'.
+*
+*               (2) A network buffer whose data was NOT committed SHOULD simply be freed via NetBuf_Free().
+*********************************************************************************************************
+*/
+
+void  NetTCP_TxConnAppBufAbort (NET_TCP_CONN_ID   conn_id_tcp,
+                                NET_BUF          *p_buf)
+{
+    NET_TCP_CONN  *p_conn;
+    NET_ERR        err;
+
+
+    NetTCP_TxPktDiscard(p_buf, &err);
+
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+    NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,                /* Reset conn (see Note #1).                            */
+                     (NET_BUF_HDR      *)0,
+                     (CPU_BOOLEAN       )DEF_YES,
+                     (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
+}
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_ConnIsAvailRx()
+*
+* Description : (1) Check TCP connection for available receive operation(s) :
+*
+*                   (a) Application receive data
+*                   (b) Receive connection closed
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to check for available receive operation(s).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                    TCP connection successfully checked for
+*                                                                       available receive operation(s); check
+*                                                                       return value for receive availability.
 *
 *                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
 *                               NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
@@ -4015,51 +4452,56 @@ CPU_BOOLEAN  NetTCP_ConnIsAvailRx (NET_TCP_CONN_ID   conn_id_tcp,
 *                               NET_INIT_ERR_NOT_COMPLETED             Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN            Invalid TCP connection number.
 *
-* Return(s)   : DEF_YES, if TCP connection is ready to transmit.
+* Return(s)   : DEF_YES, if TCP connection has any available receive operation(s).
 *
 *               DEF_NO,  otherwise.
 *
-* Caller(s)   : NetSock_IsRdyTxStream().
+* Caller(s)   : NetSock_IsAvailRxStream().
 *
-* Note(s)     : (1) RFC #793, Section 3.9 'Event Processing : SEND Call' specifies how to handle transmit
+* Note(s)     : (2) RFC #793, Section 3.9 'Event Processing : RECEIVE Call' specifies how to handle receive
 *                   data requests from the application layer :
 *
 *                   (a) For the "CLOSED STATE ... return 'error: connection does not exist'".
 *
-*                   (b) For the "LISTEN STATE" :
-*
-*                           (A)TCP Listen state transmit NOT yet implemented. #### NET-815
+*                   (b) (1) For the "LISTEN STATE, SYN-SENT STATE, SYN-RECEIVED STATE ... queue for processing
+*                           after entering ESTABLISHED state".
 *
-*                       (1) "If the foreign socket is specified, then" :
+*                       (2) The application layer may request to receive application data before the TCP
+*                           connection enters the connected state.  Such requests will block or return
+*                           no data.
 *
-*                           (F) "Data associated with SEND may be" ...
-*                               (1) "sent with SYN segment"        ...
-*                               (2) (a) "or queued for transmission after entering ESTABLISHED state."
+*                   (c) For the "ESTABLISHED STATE, FIN-WAIT-1 STATE, FIN-WAIT-2 STATE" :
 *
-*                   (c) For the "SYN-SENT STATE, SYN-RECEIVED STATE" :
+*                       (1) "If insufficient incoming segments are queued to satisfy the request, queue
+*                            the request."
 *
-*                       (1) "Queue the data for transmission after entering ESTABLISHED state."
+*                       (2) "Reassemble queued incoming segments into receive buffer and return to user."
 *
-*                   (d) For the "ESTABLISHED STATE, CLOSE-WAIT STATE" :
+*                   (d) For the "CLOSE-WAIT STATE ... since the remote side has already sent FIN, RECEIVEs
+*                       must be satisfied by the text already on hand, but not yet delivered to the user.
+*                       If no text is awaiting delivery, the RECEIVE will get a 'error: connection closing'
+*                       response.  Otherwise, any remaining text can be used to satisfy the RECEIVE".
 *
-*                       (1) (A) "Segmentize the buffer" ...
-*                           (B) "and send it with a piggybacked acknowledgment."
+*                   (e) (1) For the "CLOSING STATE, LAST-ACK STATE, TIME-WAIT STATE ... return 'error:
+*                           connection closing'".
 *
-*                   (e) For the "FIN-WAIT-1 STATE, FIN-WAIT-2 STATE, CLOSING STATE, LAST-ACK STATE,
-*                       TIME-WAIT STATE" :
+*                       (2) Typically, these states will have already received ALL remaining closing
+*                           data from the closing remote host.
 *
-*                       (1) "Return 'error: connection closing'" ...
-*                       (2) "and do not service request."
+*                           (A) However, in case all receive data from the remote host has NOT yet been
+*                               received, application layer receives from these states are permitted until
+*                               the TCP connection's sequence receive state is closed & the TCP connection's
+*                               application receive queue is empty.
 *
-*                   See also 'NetTCP_TxConnAppData()  Note #2'.
+*                   See also 'NetTCP_RxAppData()  Note #2'.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnIsRdyTx (NET_TCP_CONN_ID   conn_id_tcp,
-                                 NET_ERR          *p_err)
+CPU_BOOLEAN  NetTCP_ConnIsAvailRx (NET_TCP_CONN_ID   conn_id_tcp,
+                                   NET_ERR          *p_err)
 {
     NET_TCP_CONN  *p_conn;
-    CPU_BOOLEAN    tx_rdy;
+    CPU_BOOLEAN    rx_avail;
 
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
@@ -4069,7 +4511,7 @@ CPU_BOOLEAN  NetTCP_ConnIsRdyTx (NET_TCP_CONN_ID   conn_id_tcp,
     }
 #endif
 
-                                                                /* --------------- CHK TCP CONN TX RDY ---------------- */
+                                                                /* -------------- CHK TCP CONN RX AVAIL --------------- */
     p_conn = &NetTCP_ConnTbl[conn_id_tcp];
 
     switch (p_conn->ConnState) {
@@ -4078,30 +4520,38 @@ CPU_BOOLEAN  NetTCP_ConnIsRdyTx (NET_TCP_CONN_ID   conn_id_tcp,
              return (DEF_NO);
 
 
-        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #1a.                                        */
-        case NET_TCP_CONN_STATE_LISTEN:                         /* NOT yet implemented (see Note #1bA).                 */
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:                     /* See Note #1e.                                        */
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:
-        case NET_TCP_CONN_STATE_CLOSING:
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #2a.                                        */
             *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
              return (DEF_NO);
 
 
-        case NET_TCP_CONN_STATE_SYNC_RXD:                       /* See Note #1c.                                        */
+        case NET_TCP_CONN_STATE_LISTEN:                         /* See Note #2b.                                        */
+        case NET_TCP_CONN_STATE_SYNC_RXD:
         case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
         case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
         case NET_TCP_CONN_STATE_SYNC_TXD:
-             tx_rdy = DEF_NO;
+             rx_avail = DEF_NO;                                 /* See Note #2b2.                                       */
              break;
 
 
-        case NET_TCP_CONN_STATE_CONN:                           /* See Note #1d.                                        */
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:
-                                                                /* Chk TCP conn tx data rdy status.                     */
-             tx_rdy = ((p_conn->TxWinSizeCfgdRem > 0) && (p_conn->MaxSegSizeConn > 0)) ? DEF_YES : DEF_NO;
+        case NET_TCP_CONN_STATE_CONN:                           /* See Note #2c.                                        */
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+                                                                /* Chk TCP conn rx data avail (see Note #2c).           */
+             rx_avail =  (p_conn->RxQ_App_Head != DEF_NULL) ? DEF_YES : DEF_NO;
+             break;
+
+
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:                     /* See Note #2d.                                        */
+        case NET_TCP_CONN_STATE_CLOSING:                        /* See Note #2e.                                        */
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+                                                                /* Chk TCP conn rx data avail (see Note #2d) OR ...     */
+             rx_avail = ((p_conn->RxQ_App_Head != DEF_NULL) ||
+                                                                /* ... TCP conn rx q closed   (see Note #2e2A).         */
+                        ((p_conn->RxQ_App_Head == DEF_NULL) &&
+                         (p_conn->RxQ_State    ==  NET_TCP_RX_Q_STATE_CLOSED))) ? DEF_YES : DEF_NO;
              break;
 
 
@@ -4114,31 +4564,156 @@ CPU_BOOLEAN  NetTCP_ConnIsRdyTx (NET_TCP_CONN_ID   conn_id_tcp,
 
    *p_err =  NET_TCP_ERR_NONE;
 
-    return (tx_rdy);
+    return (rx_avail);
 }
 
 
 /*
 *********************************************************************************************************
-*                                          NetTCP_ConnGet()
+*                                        NetTCP_ConnIsRdyTx()
 *
-* Description : (1) Allocate & initialize a TCP connection :
+* Description : Check if TCP connection ready to transmit.
 *
-*                   (a) Get      a TCP connection
-*                   (b) Validate   TCP connection
-*                   (c) Initialize TCP connection
-*                   (d) Update     TCP connection pool statistics
-*                   (e) Return TCP connection handle identifier
-*                         OR
-*                       Null identifier & error code, on failure
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to check if ready to transmit.
 *
-*               (2) The TCP connection pool is implemented as a stack :
+*               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                   (a) 'NetTCP_ConnPoolPtr' points to the head of the TCP connection pool.
+*                               NET_TCP_ERR_NONE                    TCP connection successfully checked if
+*                                                                       ready for transmit; check return
+*                                                                       value for transmit ready availability.
 *
-*                   (b) TCP connections' 'NextPtr's link each TCP connection to form the TCP connection pool stack.
+*                               NET_TCP_ERR_CONN_NOT_USED           TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE      Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP         Invalid TCP connection operation.
 *
-*                   (c) TCP connections are inserted & removed at the head of        the TCP connection pool stack.
+*                                                                   --- RETURNED BY NetTCP_ConnIsUsed() : ----
+*                               NET_INIT_ERR_NOT_COMPLETED             Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN            Invalid TCP connection number.
+*
+* Return(s)   : DEF_YES, if TCP connection is ready to transmit.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : NetSock_IsRdyTxStream().
+*
+* Note(s)     : (1) RFC #793, Section 3.9 'Event Processing : SEND Call' specifies how to handle transmit
+*                   data requests from the application layer :
+*
+*                   (a) For the "CLOSED STATE ... return 'error: connection does not exist'".
+*
+*                   (b) For the "LISTEN STATE" :
+*
+*                           (A)TCP Listen state transmit NOT yet implemented. #### NET-815
+*
+*                       (1) "If the foreign socket is specified, then" :
+*
+*                           (F) "Data associated with SEND may be" ...
+*                               (1) "sent with SYN segment"        ...
+*                               (2) (a) "or queued for transmission after entering ESTABLISHED state."
+*
+*                   (c) For the "SYN-SENT STATE, SYN-RECEIVED STATE" :
+*
+*                       (1) "Queue the data for transmission after entering ESTABLISHED state."
+*
+*                   (d) For the "ESTABLISHED STATE, CLOSE-WAIT STATE" :
+*
+*                       (1) (A) "Segmentize the buffer" ...
+*                           (B) "and send it with a piggybacked acknowledgment."
+*
+*                   (e) For the "FIN-WAIT-1 STATE, FIN-WAIT-2 STATE, CLOSING STATE, LAST-ACK STATE,
+*                       TIME-WAIT STATE" :
+*
+*                       (1) "Return 'error: connection closing'" ...
+*                       (2) "and do not service request."
+*
+*                   See also 'NetTCP_TxConnAppData()  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnIsRdyTx (NET_TCP_CONN_ID   conn_id_tcp,
+                                 NET_ERR          *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+    CPU_BOOLEAN    tx_rdy;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return (DEF_NO);
+    }
+#endif
+
+                                                                /* --------------- CHK TCP CONN TX RDY ---------------- */
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
+             return (DEF_NO);
+
+
+        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #1a.                                        */
+        case NET_TCP_CONN_STATE_LISTEN:                         /* NOT yet implemented (see Note #1bA).                 */
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:                     /* See Note #1e.                                        */
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
+             return (DEF_NO);
+
+
+        case NET_TCP_CONN_STATE_SYNC_RXD:                       /* See Note #1c.                                        */
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+             tx_rdy = DEF_NO;
+             break;
+
+
+        case NET_TCP_CONN_STATE_CONN:                           /* See Note #1d.                                        */
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+                                                                /* Chk TCP conn tx data rdy status.                     */
+             tx_rdy = ((p_conn->TxWinSizeCfgdRem > 0) && (p_conn->MaxSegSizeConn > 0)) ? DEF_YES : DEF_NO;
+             break;
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
+             return (DEF_NO);
+    }
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (tx_rdy);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetTCP_ConnGet()
+*
+* Description : (1) Allocate & initialize a TCP connection :
+*
+*                   (a) Get      a TCP connection
+*                   (b) Validate   TCP connection
+*                   (c) Initialize TCP connection
+*                   (d) Update     TCP connection pool statistics
+*                   (e) Return TCP connection handle identifier
+*                         OR
+*                       Null identifier & error code, on failure
+*
+*               (2) The TCP connection pool is implemented as a stack :
+*
+*                   (a) 'NetTCP_ConnPoolPtr' points to the head of the TCP connection pool.
+*
+*                   (b) TCP connections' 'NextPtr's link each TCP connection to form the TCP connection pool stack.
+*
+*                   (c) TCP connections are inserted & removed at the head of        the TCP connection pool stack.
 *
 *
 *                                    TCP connections are
@@ -4472,38 +5047,796 @@ void  NetTCP_ConnSetStateListen (NET_TCP_CONN_ID                      conn_id_tc
     }
 #endif
 
-    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* VALIDATE CONN IDs                                    */
+    conn_id = p_conn->ID_Conn;
+    used    = NetConn_IsUsed(conn_id, &err);
+    if (used != DEF_YES) {
+       *p_err  = NET_TCP_ERR_INVALID_CONN_ID;
+        return;
+    }
+
+    conn_id_transport =  NetConn_ID_TransportGet(conn_id, &err);
+    if (conn_id_tcp  != (NET_TCP_CONN_ID)conn_id_transport) {
+       *p_err = NET_TCP_ERR_INVALID_CONN_ID;
+        return;
+    }
+#endif
+
+
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
+            *p_err = NET_TCP_ERR_CONN_NOT_USED;
+             return;
+
+
+        case NET_TCP_CONN_STATE_CLOSED:
+             p_conn->FnctAppListenQ_IsAvail = tcp_app_listen_is_avail_fnct;
+             p_conn->ConnState              = NET_TCP_CONN_STATE_LISTEN;
+             break;
+
+
+        case NET_TCP_CONN_STATE_LISTEN:
+        case NET_TCP_CONN_STATE_SYNC_RXD:
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+        case NET_TCP_CONN_STATE_CONN:
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
+            *p_err = NET_TCP_ERR_INVALID_CONN_OP;
+             return;
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
+            *p_err = NET_TCP_ERR_INVALID_CONN_STATE;
+             return;
+    }
+
+
+   *p_err = NET_TCP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_ConnAppAcceptRdySignal()
+*
+* Description : Signal the TCP connection that the connection has been accepted by the application layer.
+*               The Receive window can be configured to let the remote host send data on this connection.
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_TCP_ERR_NONE                No error*
+*                                   NET_TCP_ERR_INVALID_CONN_ID     Invalid connection id.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : NetSock_Accept().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+#ifndef  NET_TCP_CFG_OLD_WINDOW_MGMT_EN
+void  NetTCP_ConnAppAcceptRdySignal (NET_CONN_ID       conn_id_parent,
+                                     NET_TCP_CONN_ID   conn_id_tcp,
+                                     NET_ERR          *p_err)
+{
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    CPU_BOOLEAN    used;
+    NET_CONN_ID    conn_id;
+    NET_CONN_ID    conn_id_transport;
+    NET_ERR        err;
+#endif
+    NET_CONN      *p_conn_parent;
+    NET_TCP_CONN  *p_conn_tcp_parent;
+    NET_TCP_CONN  *p_conn_tcp;
+
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return;
+    }
+#endif
+
+    p_conn_tcp = &NetTCP_ConnTbl[conn_id_tcp];
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* VALIDATE CONN IDs                                    */
+    conn_id = p_conn_tcp->ID_Conn;
+    used    = NetConn_IsUsed(conn_id, &err);
+    if (used != DEF_YES) {
+       *p_err  = NET_TCP_ERR_INVALID_CONN_ID;
+        return;
+    }
+
+    conn_id_transport =  NetConn_ID_TransportGet(conn_id, &err);
+    if (conn_id_tcp  != (NET_TCP_CONN_ID)conn_id_transport) {
+       *p_err = NET_TCP_ERR_INVALID_CONN_ID;
+        return;
+    }
+#endif
+
+    p_conn_parent = &NetConn_Tbl[conn_id_parent];
+
+    if (p_conn_parent->ID_Transport == NET_TCP_CONN_ID_NONE) {
+
+        NetTCP_RxConnWinSizeHandler(p_conn_tcp, DEF_NULL, NET_TCP_DFLT_RX_WIN_SIZE_OCTET, NET_TCP_CONN_RX_WIN_INIT);
+
+    } else {
+
+        p_conn_tcp_parent = &NetTCP_ConnTbl[p_conn_parent->ID_Transport];
+
+        if (p_conn_tcp_parent->RxWinSizeCfgd != 0) {
+            NetTCP_RxConnWinSizeHandler(p_conn_tcp, DEF_NULL, p_conn_tcp_parent->RxWinSizeCfgd, NET_TCP_CONN_RX_WIN_INIT);
+        } else {
+            NetTCP_RxConnWinSizeHandler(p_conn_tcp, DEF_NULL, NET_TCP_DFLT_RX_WIN_SIZE_OCTET, NET_TCP_CONN_RX_WIN_INIT);
+        }
+    }
+
+   *p_err = NET_TCP_ERR_NONE;
+
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_ConnCfgIdleTimeout()
+*
+* Description : (1) Configure TCP connection's   idle timeout :
+*
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection idle timeout
+*                   (d) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure connection idle timeout.
+*
+*               timeout_sec     Desired value for TCP connection idle timeout (in seconds).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               - RETURNED BY NetTCP_ConnCfgIdleTimeoutHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection idle timeout successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid idle timeout.
+*
+*                                                               -------- RETURNED BY NetTCP_ConnIsUsed() : ---------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               ------- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection idle timeout successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgIdleTimeout() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgIdleTimeoutHandler()  Note #2'.
+*
+*               (3) Configured timeout does NOT reschedule any current idle timeout in progress but
+*                   becomes effective the next time a TCP connection sets its idle timeout.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeout (NET_TCP_CONN_ID       conn_id_tcp,
+                                        NET_TCP_TIMEOUT_SEC   timeout_sec,
+                                        NET_ERR              *p_err)
+{
+   CPU_BOOLEAN  cfg_valid;
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgIdleTimeout, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+                                                                /* ----------- CFG TCP CONN TX IDLE TIMEOUT ----------- */
+   cfg_valid = NetTCP_ConnCfgIdleTimeoutHandler(conn_id_tcp, timeout_sec, p_err);
+   goto exit_release;
+
+
+exit_lock_fault:
+    cfg_valid = DEF_FAIL;
+    goto exit;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   cfg_valid = DEF_FAIL;
+#endif
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (cfg_valid);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 NetTCP_ConnCfgIdleTimeoutHandler()
+*
+* Description : (1) Configure TCP connection's   idle timeout :
+*
+*                   (a) Validate  TCP connection idle timeout configuration
+*                   (b) Configure TCP connection idle timeout
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure connection idle timeout.
+*               -----------     Argument checked in NetTCP_ConnCfgIdleTimeout().
+*
+*               timeout_sec     Desired value for TCP connection idle timeout (in seconds).
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection idle timeout
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid idle timeout.
+*
+* Return(s)   : DEF_OK,   TCP connection idle timeout successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetTCP_ConnCfgIdleTimeout().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgIdleTimeoutHandler() is called by network protocol suite function(s)
+*                   & MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetTCP_ConnCfgIdleTimeout()  Note #2'.
+*
+*               (3) Configured timeout does NOT reschedule any current idle timeout in progress but
+*                   becomes effective the next time a TCP connection sets its idle timeout.
+*
+*               (4) Configured timeout converted to 'NET_TMR_TICK' ticks to avoid run-time conversion.
+*
+*               (5) TCP connections' 'TimeoutConn' variables MUST ALWAYS be accessed with the global
+*                   network lock already acquired (see Note #2).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeoutHandler (NET_TCP_CONN_ID       conn_id_tcp,
+                                               NET_TCP_TIMEOUT_SEC   timeout_sec,
+                                               NET_ERR              *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+
+
+                                                                /* ---------- VALIDATE TCP CONN IDLE TIMEOUT ---------- */
+#if (NET_TCP_CONN_TIMEOUT_IDLE_MIN_SEC > 0)
+    if (timeout_sec < NET_TCP_CONN_TIMEOUT_IDLE_MIN_SEC) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
+    }
+#endif
+#if ((NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC < DEF_INT_08U_MAX_VAL)                                                               || \
+    ((NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC < DEF_INT_16U_MAX_VAL) && (NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC > DEF_INT_08U_MAX_VAL)) || \
+    ((NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC < DEF_INT_32U_MAX_VAL) && (NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC > DEF_INT_16U_MAX_VAL)))
+    if (timeout_sec > NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
+    }
+#endif
+
+
+                                                                /* ----------- CFG TCP CONN TX IDLE TIMEOUT ----------- */
+    p_conn                   = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn->TimeoutConn_sec  =  timeout_sec;
+    p_conn->TimeoutConn_tick =  timeout_sec * NET_TMR_TIME_TICK_PER_SEC;
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   NetTCP_ConnCfgMaxSegSizeLocal()
+*
+* Description : (1) Configure TCP connection's   local maximum segment size :
+*
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection local maximum segment size                 See Note #3
+*                   (d) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure local maximum segment size.
+*
+*               max_seg_size    Desired maximum segment size.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               - RETURNED BY NetTCP_ConnCfgMaxSegSizeLocalHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection local maximum segment size
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid local maximum segment size.
+*
+*                                                               ---------- RETURNED BY NetTCP_ConnIsUsed() : -----------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               -------- RETURNED BY Net_GlobalLockAcquire() : ---------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection local maximum segment size successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgMaxSegSizeLocal() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgMaxSegSizeLocalHandler()  Note #2'.
+*
+*               (3) RFC #793, Section 3.1 'Header Format : Options : Maximum Segment Size' states that
+*                   a TCP connection advertises its "maximum receive segment size ... only ... in the
+*                   initial connection request (i.e., in segments with the SYN control bit set)".
+*
+*                   Thus any configuration of the local receive maximum segment size MUST be performed
+*                   by the application layer PRIOR to any TCP connection request/synchronization either
+*                   from a :
+*
+*                   (a) Actively- connected TCP connection
+*                   (b) Passively-connected TCP connection, which is cloned from its previously-
+*                           configured LISTEN-state TCP connection
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocal (NET_TCP_CONN_ID    conn_id_tcp,
+                                            NET_TCP_SEG_SIZE   max_seg_size,
+                                            NET_ERR           *p_err)
+{
+   CPU_BOOLEAN  cfg_valid;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+   if (p_err == (NET_ERR *)0) {
+       CPU_SW_EXCEPTION(DEF_FAIL);
+   }
+#endif
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgMaxSegSizeLocal, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+                                                                /* --------- CFG TCP CONN LOCAL MAX SEG SIZE ---------- */
+   cfg_valid = NetTCP_ConnCfgMaxSegSizeLocalHandler(conn_id_tcp, max_seg_size, p_err);
+
+   goto exit_release;
+
+
+exit_lock_fault:
+    cfg_valid = DEF_FAIL;
+    goto exit;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   cfg_valid = DEF_FAIL;
+#endif
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+    Net_GlobalLockRelease();
+
+exit:
+    return (cfg_valid);
+}
+
+
+/*
+*********************************************************************************************************
+*                               NetTCP_ConnCfgMaxSegSizeLocalHandler()
+*
+* Description : (1) Configure TCP connection's   local maximum segment size :
+*
+*                   (a) Validate  TCP connection local maximum segment size configuration
+*                   (b) Configure TCP connection local maximum segment size                 See Note #3
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure local maximum segment size.
+*               -----------     Argument checked by NetTCP_ConnCfgMaxSegSizeLocal().
+*
+*               max_seg_size    Desired maximum segment size.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection local maximum segment size
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid local maximum segment size.
+*
+* Return(s)   : DEF_OK,   TCP connection local maximum segment size successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetTCP_ConnCfgMaxSegSizeLocal().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgMaxSegSizeLocalHandler() is called by network protocol suite function(s)
+*                   & MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetTCP_ConnCfgMaxSegSizeLocal()  Note #2'.
+*
+*               (3) RFC #793, Section 3.1 'Header Format : Options : Maximum Segment Size' states that
+*                   a TCP connection advertises its "maximum receive segment size ... only ... in the
+*                   initial connection request (i.e., in segments with the SYN control bit set)".
+*
+*                   Thus any configuration of the local receive maximum segment size MUST be performed
+*                   by the application layer PRIOR to any TCP connection request/synchronization either
+*                   from a :
+*
+*                   (a) Actively- connected TCP connection
+*                   (b) Passively-connected TCP connection, which is cloned from its previously-
+*                           configured LISTEN-state TCP connection
+*
+*               (4) TCP connections' 'MaxSegSizeLocal' variables MUST ALWAYS be accessed with the global
+*                   network lock already acquired (see Note #2).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocalHandler (NET_TCP_CONN_ID    conn_id_tcp,
+                                                   NET_TCP_SEG_SIZE   max_seg_size,
+                                                   NET_ERR           *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+
+
+                                                                /* -------------- VALIDATE MAX SEG SIZE --------------- */
+#if (NET_TCP_MAX_SEG_SIZE_MIN > 0)
+    if (max_seg_size < NET_TCP_MAX_SEG_SIZE_MIN) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
+    }
+#endif
+#if ((NET_TCP_MAX_SEG_SIZE_MAX < DEF_INT_08U_MAX_VAL)                                                      || \
+    ((NET_TCP_MAX_SEG_SIZE_MAX < DEF_INT_16U_MAX_VAL) && (NET_TCP_MAX_SEG_SIZE_MAX > DEF_INT_08U_MAX_VAL)) || \
+    ((NET_TCP_MAX_SEG_SIZE_MAX < DEF_INT_32U_MAX_VAL) && (NET_TCP_MAX_SEG_SIZE_MAX > DEF_INT_16U_MAX_VAL)))
+    if (max_seg_size > NET_TCP_MAX_SEG_SIZE_MAX) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
+    }
+#endif
+
+
+                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
+            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
+             return (DEF_FAIL);
+
+
+        case NET_TCP_CONN_STATE_CLOSED:
+        case NET_TCP_CONN_STATE_LISTEN:
+             break;
+
+
+        case NET_TCP_CONN_STATE_SYNC_RXD:
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+        case NET_TCP_CONN_STATE_CONN:
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
+            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
+             return (DEF_FAIL);
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_CONN_ALL);
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
+            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
+             return (DEF_FAIL);
+    }
+
+
+                                                                /* --------- CFG TCP CONN LOCAL MAX SEG SIZE ---------- */
+    p_conn->MaxSegSizeLocalCfgd = max_seg_size;
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnCfgRxWinSize()
+*
+* Description : (1) Configure TCP connection's   receive window size :
+*
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection receive window size                        See Note #3
+*                   (d) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure receive window size.
+*
+*               win_size        Desired receive window size.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               - RETURNED BY NetTCP_ConnCfgRxWinSizeHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection receive window size successfully
+*                                                                   configured.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid receive window size.
+*
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection receive window size successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgRxWinSize() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*                   See also 'NetTCP_ConnCfgRxWinSizeHandler()  Note #2'.
+*
+*               (3) A TCP connection's receive window size SHOULD NOT be updated after the TCP
+*                   connection is connected (see 'NetTCP_RxConnWinSizeHandler()  Notes #2b & #5').
+*                   Thus any configuration of the local receive window size MUST be performed
+*                   by the application layer PRIOR to any TCP connection request/synchronization
+*                   either from a :
+*
+*                   (a) Actively- connected TCP connection
+*                   (b) Passively-connected TCP connection, which is cloned from its previously-
+*                           configured LISTEN-state TCP connection
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgRxWinSize (NET_TCP_CONN_ID    conn_id_tcp,
+                                      NET_TCP_WIN_SIZE   win_size,
+                                      NET_ERR           *p_err)
+{
+   CPU_BOOLEAN  cfg_valid;
+
+
+#if(NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+   if (p_err == (NET_ERR *)0) {
+       CPU_SW_EXCEPTION(DEF_FAIL);
+   }
+#endif
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgRxWinSize, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+                                                                /* ------------- CFG TCP CONN RX WIN SIZE ------------- */
+   cfg_valid = NetTCP_ConnCfgRxWinSizeHandler(conn_id_tcp, win_size, p_err);
+   goto exit_release;
+
+
+exit_lock_fault:
+    cfg_valid = DEF_FAIL;
+    goto exit;
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   cfg_valid = DEF_FAIL;
+#endif
+
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (cfg_valid);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_ConnCfgRxWinSizeHandler()
+*
+* Description : (1) Configure TCP connection's   receive window size :
+*
+*                   (a) Validate  TCP connection receive window size configuration
+*                   (b) Configure TCP connection receive window size                        See Note #3
+*
+*
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure receive window size.
+*               -----------     Argument checked by NetTCP_ConnCfgRxWinSize(),
+*                                                   NetSock_CfgRxQ_Size().
+*
+*               win_size        Desired receive window size.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection receive window size
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid receive window size.
+*
+* Return(s)   : DEF_OK,   TCP connection receive window size successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : NetTCP_ConnCfgRxWinSize(),
+*               NetSock_CfgRxQ_Size().
+*
+*               This function is an INTERNAL network protocol suite function & MUST NOT be called by
+*               application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgRxWinSizeHandler() is called by network protocol suite function(s)
+*                   & MUST be called with the global network lock already acquired.
+*
+*                   See also 'NetTCP_ConnCfgRxWinSize()  Note #2'.
+*
+*               (3) A TCP connection's receive window size SHOULD NOT be updated after the TCP
+*                   connection is connected (see 'NetTCP_RxConnWinSizeHandler()  Notes #2b & #5').
+*                   Thus any configuration of the local receive window size MUST be performed
+*                   by the application layer PRIOR to any TCP connection request/synchronization
+*                   either from a :
+*
+*                   (a) Actively- connected TCP connection
+*                   (b) Passively-connected TCP connection, which is cloned from its previously-
+*                           configured LISTEN-state TCP connection
+*
+*               (4) TCP connections' 'RxWinSizeCfgd' variables MUST ALWAYS be accessed with the global
+*                   network lock already acquired (see Note #2).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgRxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
+                                             NET_TCP_WIN_SIZE   win_size,
+                                             NET_ERR           *p_err)
+{
+    NET_TCP_CONN  *p_conn;
+
 
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* VALIDATE CONN IDs                                    */
-    conn_id = p_conn->ID_Conn;
-    used    = NetConn_IsUsed(conn_id, &err);
-    if (used != DEF_YES) {
-       *p_err  = NET_TCP_ERR_INVALID_CONN_ID;
-        return;
+                                                                /* --------------- VALIDATE RX WIN SIZE --------------- */
+#if (NET_TCP_WIN_SIZE_MIN > 0)
+    if (win_size < NET_TCP_WIN_SIZE_MIN) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
     }
-
-    conn_id_transport =  NetConn_ID_TransportGet(conn_id, &err);
-    if (conn_id_tcp  != (NET_TCP_CONN_ID)conn_id_transport) {
-       *p_err = NET_TCP_ERR_INVALID_CONN_ID;
-        return;
+#endif
+#if ((NET_TCP_WIN_SIZE_MAX < DEF_INT_08U_MAX_VAL)                                                  || \
+    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_16U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_08U_MAX_VAL)) || \
+    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_32U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_16U_MAX_VAL)))
+    if (win_size > NET_TCP_WIN_SIZE_MAX) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
     }
 #endif
 
 
+                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
     switch (p_conn->ConnState) {
         case NET_TCP_CONN_STATE_FREE:
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
-            *p_err = NET_TCP_ERR_CONN_NOT_USED;
-             return;
+            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
+             return (DEF_FAIL);
 
 
         case NET_TCP_CONN_STATE_CLOSED:
-             p_conn->FnctAppListenQ_IsAvail = tcp_app_listen_is_avail_fnct;
-             p_conn->ConnState              = NET_TCP_CONN_STATE_LISTEN;
+        case NET_TCP_CONN_STATE_LISTEN:
              break;
 
 
-        case NET_TCP_CONN_STATE_LISTEN:
         case NET_TCP_CONN_STATE_SYNC_RXD:
         case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
         case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
@@ -4517,141 +5850,65 @@ void  NetTCP_ConnSetStateListen (NET_TCP_CONN_ID                      conn_id_tc
         case NET_TCP_CONN_STATE_LAST_ACK:
         case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
-            *p_err = NET_TCP_ERR_INVALID_CONN_OP;
-             return;
+            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
+             return (DEF_FAIL);
 
 
         case NET_TCP_CONN_STATE_NONE:
         default:
-             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                              (NET_BUF_HDR      *)0,
-                              (CPU_BOOLEAN       )DEF_YES,
-                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
+             NetTCP_ConnClose(p_conn, DEF_NULL, DEF_YES, NET_TCP_CONN_CLOSE_CONN_ALL);
              NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
-            *p_err = NET_TCP_ERR_INVALID_CONN_STATE;
-             return;
-    }
-
-
-   *p_err = NET_TCP_ERR_NONE;
-}
-
-
-/*
-*********************************************************************************************************
-*                                    NetTCP_ConnAppAcceptRdySignal()
-*
-* Description : Signal the TCP connection that the connection has been accepted by the application layer.
-*               The Receive window can be configured to let the remote host send data on this connection.
-*
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection.
-*
-*               p_err           Pointer to variable that will receive the return error code from this function :
-*
-*                                   NET_TCP_ERR_NONE                No error*
-*                                   NET_TCP_ERR_INVALID_CONN_ID     Invalid connection id.
-*
-* Return(s)   : None.
-*
-* Caller(s)   : NetSock_Accept().
-*
-* Note(s)     : none.
-*********************************************************************************************************
-*/
-#ifndef  NET_TCP_CFG_OLD_WINDOW_MGMT_EN
-void  NetTCP_ConnAppAcceptRdySignal (NET_CONN_ID       conn_id_parent,
-                                     NET_TCP_CONN_ID   conn_id_tcp,
-                                     NET_ERR          *p_err)
-{
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    CPU_BOOLEAN    used;
-    NET_CONN_ID    conn_id;
-    NET_CONN_ID    conn_id_transport;
-    NET_ERR        err;
-#endif
-    NET_CONN      *p_conn_parent;
-    NET_TCP_CONN  *p_conn_tcp_parent;
-    NET_TCP_CONN  *p_conn_tcp;
-
-
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
-   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
-    if (*p_err != NET_TCP_ERR_NONE) {
-         return;
-    }
-#endif
-
-    p_conn_tcp = &NetTCP_ConnTbl[conn_id_tcp];
-
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)                 /* VALIDATE CONN IDs                                    */
-    conn_id = p_conn_tcp->ID_Conn;
-    used    = NetConn_IsUsed(conn_id, &err);
-    if (used != DEF_YES) {
-       *p_err  = NET_TCP_ERR_INVALID_CONN_ID;
-        return;
-    }
-
-    conn_id_transport =  NetConn_ID_TransportGet(conn_id, &err);
-    if (conn_id_tcp  != (NET_TCP_CONN_ID)conn_id_transport) {
-       *p_err = NET_TCP_ERR_INVALID_CONN_ID;
-        return;
+            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
+             return (DEF_FAIL);
     }
-#endif
-
-    p_conn_parent = &NetConn_Tbl[conn_id_parent];
-
-    if (p_conn_parent->ID_Transport == NET_TCP_CONN_ID_NONE) {
-
-        NetTCP_RxConnWinSizeHandler(p_conn_tcp, DEF_NULL, NET_TCP_DFLT_RX_WIN_SIZE_OCTET, NET_TCP_CONN_RX_WIN_INIT);
 
-    } else {
 
-        p_conn_tcp_parent = &NetTCP_ConnTbl[p_conn_parent->ID_Transport];
+                                                                /* ------------- CFG TCP CONN RX WIN SIZE ------------- */
+    p_conn->RxWinSizeCfgd = win_size;                           /* Cfg rx win size.                                     */
+    NetTCP_RxConnWinSizeCfg(p_conn);                            /* Cfg rx win ctrls.                                    */
 
-        if (p_conn_tcp_parent->RxWinSizeCfgd != 0) {
-            NetTCP_RxConnWinSizeHandler(p_conn_tcp, DEF_NULL, p_conn_tcp_parent->RxWinSizeCfgd, NET_TCP_CONN_RX_WIN_INIT);
-        } else {
-            NetTCP_RxConnWinSizeHandler(p_conn_tcp, DEF_NULL, NET_TCP_DFLT_RX_WIN_SIZE_OCTET, NET_TCP_CONN_RX_WIN_INIT);
-        }
-    }
 
-   *p_err = NET_TCP_ERR_NONE;
+   *p_err =  NET_TCP_ERR_NONE;
 
+    return (DEF_OK);
 }
-#endif
 
 
 /*
 *********************************************************************************************************
-*                                     NetTCP_ConnCfgIdleTimeout()
+*                                      NetTCP_ConnCfgTxWinSize()
 *
-* Description : (1) Configure TCP connection's   idle timeout :
+* Description : (1) Configure TCP connection's   transmit window size :
 *
 *                   (a) Acquire   network lock
 *                   (b) Validate  TCP connection used
-*                   (c) Configure TCP connection idle timeout
+*                   (c) Configure TCP connection transmit window size                       See Note #3
 *                   (d) Release   network lock
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure connection idle timeout.
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit window size.
 *
-*               timeout_sec     Desired value for TCP connection idle timeout (in seconds).
+*               win_size        Desired transmit window size.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                                                               - RETURNED BY NetTCP_ConnCfgIdleTimeoutHandler() : -
-*                               NET_TCP_ERR_NONE                TCP connection idle timeout successfully configured.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid idle timeout.
+*                                                               - RETURNED BY NetTCP_ConnCfgTxWinSizeHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection transmit window size successfully
+*                                                                   configured.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid transmit window size.
 *
-*                                                               -------- RETURNED BY NetTCP_ConnIsUsed() : ---------
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
 *                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
 *                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
 *
-*                                                               ------- RETURNED BY Net_GlobalLockAcquire() : ------
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
 *                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : DEF_OK,   TCP connection idle timeout successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit window size successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
@@ -4660,7 +5917,7 @@ void  NetTCP_ConnAppAcceptRdySignal (NET_CONN_ID       conn_id_parent,
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgIdleTimeout() is called by application function(s) & ... :
+* Note(s)     : (2) NetTCP_ConnCfgTxWinSize() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -4669,22 +5926,29 @@ void  NetTCP_ConnAppAcceptRdySignal (NET_CONN_ID       conn_id_parent,
 *                   This is required since an application's network protocol suite API function access
 *                   is asynchronous to other network protocol tasks.
 *
-*                   See also 'NetTCP_ConnCfgIdleTimeoutHandler()  Note #2'.
+*                   See also 'NetTCP_ConnCfgTxWinSizeHandler()  Note #2'.
 *
-*               (3) Configured timeout does NOT reschedule any current idle timeout in progress but
-*                   becomes effective the next time a TCP connection sets its idle timeout.
+*               (3) A TCP connection's transmit window size SHOULD NOT be updated after the TCP connection is
+*                   connected.  Thus any configuration of the local transmit window size MUST be performed by
+*                   the application layer PRIOR to any TCP connection request/synchronization either from a :
+*
+*                   (a) Actively- connected TCP connection
+*                   (b) Passively-connected TCP connection, which is cloned from its previously-
+*                           configured LISTEN-state TCP connection
+*
+*                   See also 'NetTCP_TxConnWinSizeHandlerCfgd()  Note #3'.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeout (NET_TCP_CONN_ID       conn_id_tcp,
-                                        NET_TCP_TIMEOUT_SEC   timeout_sec,
-                                        NET_ERR              *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxWinSize (NET_TCP_CONN_ID    conn_id_tcp,
+                                      NET_TCP_WIN_SIZE   win_size,
+                                      NET_ERR           *p_err)
 {
    CPU_BOOLEAN  cfg_valid;
 
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
                                                                 /* See Note #2b.                                        */
-   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgIdleTimeout, p_err);
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxWinSize, p_err);
    if (*p_err != NET_ERR_NONE) {
         goto exit_lock_fault;
    }
@@ -4696,14 +5960,14 @@ CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeout (NET_TCP_CONN_ID       conn_id_tcp,
    }
 #endif
 
-                                                                /* ----------- CFG TCP CONN TX IDLE TIMEOUT ----------- */
-   cfg_valid = NetTCP_ConnCfgIdleTimeoutHandler(conn_id_tcp, timeout_sec, p_err);
+                                                                /* ------------- CFG TCP CONN TX WIN SIZE ------------- */
+   cfg_valid = NetTCP_ConnCfgTxWinSizeHandler(conn_id_tcp, win_size, p_err);
    goto exit_release;
 
 
 exit_lock_fault:
-    cfg_valid = DEF_FAIL;
-    goto exit;
+   cfg_valid = DEF_FAIL;
+   goto exit;
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
 exit_fail:
@@ -4721,77 +5985,130 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                 NetTCP_ConnCfgIdleTimeoutHandler()
+*                                  NetTCP_ConnCfgTxWinSizeHandler()
 *
-* Description : (1) Configure TCP connection's   idle timeout :
+* Description : (1) Configure TCP connection's   transmit window size :
 *
-*                   (a) Validate  TCP connection idle timeout configuration
-*                   (b) Configure TCP connection idle timeout
+*                   (a) Validate  TCP connection transmit window size configuration
+*                   (b) Configure TCP connection transmit window size                       See Note #3
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure connection idle timeout.
-*               -----------     Argument checked in NetTCP_ConnCfgIdleTimeout().
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit window size.
+*               -----------     Argument checked by NetTCP_ConnCfgTxWinSize(),
+*                                                   NetSock_CfgTxQ_Size().
 *
-*               timeout_sec     Desired value for TCP connection idle timeout (in seconds).
+*               win_size        Desired transmit window size.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection idle timeout
+*                               NET_TCP_ERR_NONE                TCP connection transmit window size
 *                                                                   successfully configured.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid idle timeout.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
+*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid transmit window size.
 *
-* Return(s)   : DEF_OK,   TCP connection idle timeout successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit window size successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
-* Caller(s)   : NetTCP_ConnCfgIdleTimeout().
+* Caller(s)   : NetTCP_ConnCfgTxWinSize(),
+*               NetSock_CfgTxQ_Size().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgIdleTimeoutHandler() is called by network protocol suite function(s)
+* Note(s)     : (2) NetTCP_ConnCfgTxWinSizeHandler() is called by network protocol suite function(s)
 *                   & MUST be called with the global network lock already acquired.
 *
-*                   See also 'NetTCP_ConnCfgIdleTimeout()  Note #2'.
+*                   See also 'NetTCP_ConnCfgTxWinSize()  Note #2'.
 *
-*               (3) Configured timeout does NOT reschedule any current idle timeout in progress but
-*                   becomes effective the next time a TCP connection sets its idle timeout.
+*               (3) A TCP connection's transmit window size SHOULD NOT be updated after the TCP connection is
+*                   connected.  Thus any configuration of the local transmit window size MUST be performed by
+*                   the application layer PRIOR to any TCP connection request/synchronization either from a :
 *
-*               (4) Configured timeout converted to 'NET_TMR_TICK' ticks to avoid run-time conversion.
+*                   (a) Actively- connected TCP connection
+*                   (b) Passively-connected TCP connection, which is cloned from its previously-
+*                           configured LISTEN-state TCP connection
 *
-*               (5) TCP connections' 'TimeoutConn' variables MUST ALWAYS be accessed with the global
+*                   See also 'NetTCP_TxConnWinSizeHandlerCfgd()  Note #3'.
+*
+*               (4) TCP connections' 'TxWinSizeCfgd' variables MUST ALWAYS be accessed with the global
 *                   network lock already acquired (see Note #2).
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeoutHandler (NET_TCP_CONN_ID       conn_id_tcp,
-                                               NET_TCP_TIMEOUT_SEC   timeout_sec,
-                                               NET_ERR              *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
+                                             NET_TCP_WIN_SIZE   win_size,
+                                             NET_ERR           *p_err)
 {
     NET_TCP_CONN  *p_conn;
 
 
-                                                                /* ---------- VALIDATE TCP CONN IDLE TIMEOUT ---------- */
-#if (NET_TCP_CONN_TIMEOUT_IDLE_MIN_SEC > 0)
-    if (timeout_sec < NET_TCP_CONN_TIMEOUT_IDLE_MIN_SEC) {
+                                                                /* --------------- VALIDATE TX WIN SIZE --------------- */
+#if (NET_TCP_WIN_SIZE_MIN > 0)
+    if (win_size < NET_TCP_WIN_SIZE_MIN) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
+    }
+#endif
+#if ((NET_TCP_WIN_SIZE_MAX < DEF_INT_08U_MAX_VAL)                                                  || \
+    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_16U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_08U_MAX_VAL)) || \
+    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_32U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_16U_MAX_VAL)))
+    if (win_size > NET_TCP_WIN_SIZE_MAX) {
        *p_err =  NET_TCP_ERR_INVALID_ARG;
         return (DEF_FAIL);
     }
 #endif
-#if ((NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC < DEF_INT_08U_MAX_VAL)                                                               || \
-    ((NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC < DEF_INT_16U_MAX_VAL) && (NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC > DEF_INT_08U_MAX_VAL)) || \
-    ((NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC < DEF_INT_32U_MAX_VAL) && (NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC > DEF_INT_16U_MAX_VAL)))
-    if (timeout_sec > NET_TCP_CONN_TIMEOUT_IDLE_MAX_SEC) {
-       *p_err =  NET_TCP_ERR_INVALID_ARG;
-        return (DEF_FAIL);
+
+
+                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
+    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
+    switch (p_conn->ConnState) {
+        case NET_TCP_CONN_STATE_FREE:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
+            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
+             return (DEF_FAIL);
+
+
+        case NET_TCP_CONN_STATE_CLOSED:
+        case NET_TCP_CONN_STATE_LISTEN:
+             break;
+
+
+        case NET_TCP_CONN_STATE_SYNC_RXD:
+        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
+        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
+        case NET_TCP_CONN_STATE_SYNC_TXD:
+        case NET_TCP_CONN_STATE_CONN:
+        case NET_TCP_CONN_STATE_FIN_WAIT_1:
+        case NET_TCP_CONN_STATE_FIN_WAIT_2:
+        case NET_TCP_CONN_STATE_CLOSING:
+        case NET_TCP_CONN_STATE_TIME_WAIT:
+        case NET_TCP_CONN_STATE_CLOSE_WAIT:
+        case NET_TCP_CONN_STATE_LAST_ACK:
+        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
+            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
+             return (DEF_FAIL);
+
+
+        case NET_TCP_CONN_STATE_NONE:
+        default:
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_CONN_ALL);
+             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
+            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
+             return (DEF_FAIL);
     }
-#endif
 
 
-                                                                /* ----------- CFG TCP CONN TX IDLE TIMEOUT ----------- */
-    p_conn                   = &NetTCP_ConnTbl[conn_id_tcp];
-    p_conn->TimeoutConn_sec  =  timeout_sec;
-    p_conn->TimeoutConn_tick =  timeout_sec * NET_TMR_TIME_TICK_PER_SEC;
+                                                                /* ------------- CFG TCP CONN TX WIN SIZE ------------- */
+    p_conn->TxWinSizeCfgd = win_size;                           /* Cfg tx win size.                                     */
+    NetTCP_TxConnWinSizeCfg(p_conn);                            /* Cfg tx win ctrls.                                    */
 
 
    *p_err =  NET_TCP_ERR_NONE;
@@ -4802,39 +6119,45 @@ CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeoutHandler (NET_TCP_CONN_ID       conn_id_tcp
 
 /*
 *********************************************************************************************************
-*                                   NetTCP_ConnCfgMaxSegSizeLocal()
+*                                      NetTCP_ConnCfgTxNagleEn()
 *
-* Description : (1) Configure TCP connection's   local maximum segment size :
+* Description : (1) Configure TCP connection's   transmit Nagle algorithm enable :
 *
 *                   (a) Acquire   network lock
 *                   (b) Validate  TCP connection used
-*                   (c) Configure TCP connection local maximum segment size                 See Note #3
+*                   (c) Configure TCP connection transmit Nagle algorithm enable            See Note #3
 *                   (d) Release   network lock
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure local maximum segment size.
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit Nagle enable.
 *
-*               max_seg_size    Desired maximum segment size.
+*               nagle_en        Desired value for TCP connection transmit Nagle enable :
+*
+*                                   DEF_ENABLED             TCP connections delay transmitting next data
+*                                                               segment(s) until all unacknowledged data
+*                                                               is acknowledged OR an MSS-sized segment
+*                                                               can be transmitted.
+*
+*                                   DEF_DISABLED            TCP connections transmit all data segment(s)
+*                                                               when permitted by local & remote hosts'
+*                                                               congestion controls.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                                                               - RETURNED BY NetTCP_ConnCfgMaxSegSizeLocalHandler() : -
-*                               NET_TCP_ERR_NONE                TCP connection local maximum segment size
-*                                                                   successfully configured.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid local maximum segment size.
+*                                                               - RETURNED BY NetTCP_ConnCfgTxNagleEnHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection transmit Nagle enable successfully
+*                                                                   configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
 *
-*                                                               ---------- RETURNED BY NetTCP_ConnIsUsed() : -----------
+*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
 *                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
 *                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
 *
-*                                                               -------- RETURNED BY Net_GlobalLockAcquire() : ---------
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
 *                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : DEF_OK,   TCP connection local maximum segment size successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit Nagle enable successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
@@ -4843,7 +6166,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeoutHandler (NET_TCP_CONN_ID       conn_id_tcp
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgMaxSegSizeLocal() is called by application function(s) & ... :
+* Note(s)     : (2) NetTCP_ConnCfgTxNagleEn() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -4852,25 +6175,19 @@ CPU_BOOLEAN  NetTCP_ConnCfgIdleTimeoutHandler (NET_TCP_CONN_ID       conn_id_tcp
 *                   This is required since an application's network protocol suite API function access
 *                   is asynchronous to other network protocol tasks.
 *
-*                   See also 'NetTCP_ConnCfgMaxSegSizeLocalHandler()  Note #2'.
-*
-*               (3) RFC #793, Section 3.1 'Header Format : Options : Maximum Segment Size' states that
-*                   a TCP connection advertises its "maximum receive segment size ... only ... in the
-*                   initial connection request (i.e., in segments with the SYN control bit set)".
+*                   See also 'NetTCP_ConnCfgTxNagleEnHandler()  Note #2'.
 *
-*                   Thus any configuration of the local receive maximum segment size MUST be performed
-*                   by the application layer PRIOR to any TCP connection request/synchronization either
-*                   from a :
+*               (3) RFC #1122, Section 4.2.3.4 also states that "a TCP SHOULD implement the Nagle
+*                   Algorithm ... However, there MUST be a way for an application to disable the
+*                   Nagle algorithm on an individual connection".
 *
-*                   (a) Actively- connected TCP connection
-*                   (b) Passively-connected TCP connection, which is cloned from its previously-
-*                           configured LISTEN-state TCP connection
+*                   See also 'NetTCP_TxConnTxQ()  Note #6'.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocal (NET_TCP_CONN_ID    conn_id_tcp,
-                                            NET_TCP_SEG_SIZE   max_seg_size,
-                                            NET_ERR           *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEn (NET_TCP_CONN_ID   conn_id_tcp,
+                                      CPU_BOOLEAN       nagle_en,
+                                      NET_ERR          *p_err)
 {
    CPU_BOOLEAN  cfg_valid;
 
@@ -4883,7 +6200,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocal (NET_TCP_CONN_ID    conn_id_tcp,
 #endif
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
                                                                 /* See Note #2b.                                        */
-   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgMaxSegSizeLocal, p_err);
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxNagleEn, p_err);
    if (*p_err != NET_ERR_NONE) {
         goto exit_lock_fault;
    }
@@ -4895,15 +6212,14 @@ CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocal (NET_TCP_CONN_ID    conn_id_tcp,
    }
 #endif
 
-                                                                /* --------- CFG TCP CONN LOCAL MAX SEG SIZE ---------- */
-   cfg_valid = NetTCP_ConnCfgMaxSegSizeLocalHandler(conn_id_tcp, max_seg_size, p_err);
-
+                                                                /* ------------- CFG TCP CONN TX NAGLE EN ------------- */
+   cfg_valid = NetTCP_ConnCfgTxNagleEnHandler(conn_id_tcp, nagle_en, p_err);
    goto exit_release;
 
 
 exit_lock_fault:
-    cfg_valid = DEF_FAIL;
-    goto exit;
+   cfg_valid = DEF_FAIL;
+   goto exit;
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
 exit_fail:
@@ -4912,138 +6228,91 @@ exit_fail:
 
 exit_release:
                                                                 /* ----------------- RELEASE NET LOCK ----------------- */
-    Net_GlobalLockRelease();
+   Net_GlobalLockRelease();
 
 exit:
-    return (cfg_valid);
+   return (cfg_valid);
 }
 
 
 /*
 *********************************************************************************************************
-*                               NetTCP_ConnCfgMaxSegSizeLocalHandler()
+*                                  NetTCP_ConnCfgTxNagleEnHandler()
 *
-* Description : (1) Configure TCP connection's   local maximum segment size :
+* Description : (1) Configure TCP connection's   transmit Nagle algorithm enable :
 *
-*                   (a) Validate  TCP connection local maximum segment size configuration
-*                   (b) Configure TCP connection local maximum segment size                 See Note #3
+*                   (a) Validate  TCP connection transmit Nagle algorithm enable configuration
+*                   (b) Configure TCP connection transmit Nagle algorithm enable                See Note #3
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure local maximum segment size.
-*               -----------     Argument checked by NetTCP_ConnCfgMaxSegSizeLocal().
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit Nagle enable.
+*               -----------     Argument checked in NetTCP_ConnCfgTxNagleEn().
 *
-*               max_seg_size    Desired maximum segment size.
+*               nagle_en        Desired value for TCP connection transmit Nagle enable :
+*
+*                                   DEF_ENABLED             TCP connections delay transmitting next data
+*                                                               segment(s) until all unacknowledged data
+*                                                               is acknowledged OR an MSS-sized segment
+*                                                               can be transmitted.
+*
+*                                   DEF_DISABLED            TCP connections transmit all data segment(s)
+*                                                               when permitted by local & remote hosts'
+*                                                               congestion controls.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection local maximum segment size
+*                               NET_TCP_ERR_NONE                TCP connection transmit Nagle enable
 *                                                                   successfully configured.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid local maximum segment size.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
 *
-* Return(s)   : DEF_OK,   TCP connection local maximum segment size successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit Nagle enable successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
-* Caller(s)   : NetTCP_ConnCfgMaxSegSizeLocal().
+* Caller(s)   : NetTCP_ConnCfgTxNagleEn().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgMaxSegSizeLocalHandler() is called by network protocol suite function(s)
+* Note(s)     : (2) NetTCP_ConnCfgTxNagleEnHandler() is called by network protocol suite function(s)
 *                   & MUST be called with the global network lock already acquired.
 *
-*                   See also 'NetTCP_ConnCfgMaxSegSizeLocal()  Note #2'.
-*
-*               (3) RFC #793, Section 3.1 'Header Format : Options : Maximum Segment Size' states that
-*                   a TCP connection advertises its "maximum receive segment size ... only ... in the
-*                   initial connection request (i.e., in segments with the SYN control bit set)".
+*                   See also 'NetTCP_ConnCfgTxNagleEn()  Note #2'.
 *
-*                   Thus any configuration of the local receive maximum segment size MUST be performed
-*                   by the application layer PRIOR to any TCP connection request/synchronization either
-*                   from a :
+*               (3) RFC #1122, Section 4.2.3.4 also states that "a TCP SHOULD implement the Nagle
+*                   Algorithm ... However, there MUST be a way for an application to disable the
+*                   Nagle algorithm on an individual connection".
 *
-*                   (a) Actively- connected TCP connection
-*                   (b) Passively-connected TCP connection, which is cloned from its previously-
-*                           configured LISTEN-state TCP connection
+*                   See also 'NetTCP_TxConnTxQ()  Note #6'.
 *
-*               (4) TCP connections' 'MaxSegSizeLocal' variables MUST ALWAYS be accessed with the global
-*                   network lock already acquired (see Note #2).
+*               (4) TCP connections' 'TxWinSizeNagleEn' variables MUST ALWAYS be accessed with the
+*                   global network lock already acquired (see Note #2).
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocalHandler (NET_TCP_CONN_ID    conn_id_tcp,
-                                                   NET_TCP_SEG_SIZE   max_seg_size,
-                                                   NET_ERR           *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
+                                             CPU_BOOLEAN       nagle_en,
+                                             NET_ERR          *p_err)
 {
     NET_TCP_CONN  *p_conn;
 
 
-                                                                /* -------------- VALIDATE MAX SEG SIZE --------------- */
-#if (NET_TCP_MAX_SEG_SIZE_MIN > 0)
-    if (max_seg_size < NET_TCP_MAX_SEG_SIZE_MIN) {
-       *p_err =  NET_TCP_ERR_INVALID_ARG;
-        return (DEF_FAIL);
-    }
-#endif
-#if ((NET_TCP_MAX_SEG_SIZE_MAX < DEF_INT_08U_MAX_VAL)                                                      || \
-    ((NET_TCP_MAX_SEG_SIZE_MAX < DEF_INT_16U_MAX_VAL) && (NET_TCP_MAX_SEG_SIZE_MAX > DEF_INT_08U_MAX_VAL)) || \
-    ((NET_TCP_MAX_SEG_SIZE_MAX < DEF_INT_32U_MAX_VAL) && (NET_TCP_MAX_SEG_SIZE_MAX > DEF_INT_16U_MAX_VAL)))
-    if (max_seg_size > NET_TCP_MAX_SEG_SIZE_MAX) {
-       *p_err =  NET_TCP_ERR_INVALID_ARG;
-        return (DEF_FAIL);
-    }
-#endif
-
-
-                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
-    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
-
-    switch (p_conn->ConnState) {
-        case NET_TCP_CONN_STATE_FREE:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
-            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
-             return (DEF_FAIL);
-
-
-        case NET_TCP_CONN_STATE_CLOSED:
-        case NET_TCP_CONN_STATE_LISTEN:
+                                                                /* ---------------- VALIDATE NAGLE EN ----------------- */
+    switch (nagle_en) {
+        case DEF_ENABLED:
+        case DEF_DISABLED:
              break;
 
 
-        case NET_TCP_CONN_STATE_SYNC_RXD:
-        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
-        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
-        case NET_TCP_CONN_STATE_SYNC_TXD:
-        case NET_TCP_CONN_STATE_CONN:
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:
-        case NET_TCP_CONN_STATE_CLOSING:
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
-            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
-             return (DEF_FAIL);
-
-
-        case NET_TCP_CONN_STATE_NONE:
         default:
-             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                              (NET_BUF_HDR      *)0,
-                              (CPU_BOOLEAN       )DEF_YES,
-                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_CONN_ALL);
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
-            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
+            *p_err =  NET_TCP_ERR_INVALID_ARG;
              return (DEF_FAIL);
     }
 
 
-                                                                /* --------- CFG TCP CONN LOCAL MAX SEG SIZE ---------- */
-    p_conn->MaxSegSizeLocalCfgd = max_seg_size;
+                                                                /* ------------- CFG TCP CONN TX NAGLE EN ------------- */
+    p_conn                   = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn->TxWinSizeNagleEn =  nagle_en;
 
 
    *p_err =  NET_TCP_ERR_NONE;
@@ -5054,39 +6323,42 @@ CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocalHandler (NET_TCP_CONN_ID    conn_id_tc
 
 /*
 *********************************************************************************************************
-*                                      NetTCP_ConnCfgRxWinSize()
+*                                         NetTCP_ConnCfgOpt()
 *
-* Description : (1) Configure TCP connection's   receive window size :
+* Description : (1) Configure TCP connection's   offered TCP options :
 *
 *                   (a) Acquire   network lock
 *                   (b) Validate  TCP connection used
-*                   (c) Configure TCP connection receive window size                        See Note #3
+*                   (c) Configure TCP connection offered TCP options
 *                   (d) Release   network lock
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure receive window size.
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure offered TCP options.
 *
-*               win_size        Desired receive window size.
+*               opt             TCP options to offer; bit-field flags logically OR'd :
+*
+*                                   NET_TCP_OPT_EN_NONE         Offer NO  TCP options.
+*                                   NET_TCP_OPT_EN_WIN_SCALE    Offer TCP Window Scale option.
+*                                   NET_TCP_OPT_EN_SACK         Offer TCP SACK         option.
+*                                   NET_TCP_OPT_EN_TS           Offer TCP Timestamp    option.
+*                                   NET_TCP_OPT_EN_ALL          Offer ALL compile-time enabled TCP options.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                                                               - RETURNED BY NetTCP_ConnCfgRxWinSizeHandler() : -
-*                               NET_TCP_ERR_NONE                TCP connection receive window size successfully
-*                                                                   configured.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid receive window size.
+*                                                               ---- RETURNED BY NetTCP_ConnCfgOptHandler() : ----
+*                               NET_TCP_ERR_NONE                TCP connection options successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid OR compile-time disabled TCP option(s).
+*                               NET_TCP_ERR_INVALID_CONN_STATE  TCP connection NOT closed or listening.
 *
 *                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
 *                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
 *
-*                                                               ----- RETURNED BY Net_GlobalLockAcquire() : ------
+*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
 *                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : DEF_OK,   TCP connection receive window size successfully configured.
+* Return(s)   : DEF_OK,   TCP connection options successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
@@ -5095,7 +6367,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocalHandler (NET_TCP_CONN_ID    conn_id_tc
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgRxWinSize() is called by application function(s) & ... :
+* Note(s)     : (2) NetTCP_ConnCfgOpt() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -5104,28 +6376,20 @@ CPU_BOOLEAN  NetTCP_ConnCfgMaxSegSizeLocalHandler (NET_TCP_CONN_ID    conn_id_tc
 *                   This is required since an application's network protocol suite API function access
 *                   is asynchronous to other network protocol tasks.
 *
-*                   See also 'NetTCP_ConnCfgRxWinSizeHandler()  Note #2'.
-*
-*               (3) A TCP connection's receive window size SHOULD NOT be updated after the TCP
-*                   connection is connected (see 'NetTCP_RxConnWinSizeHandler()  Notes #2b & #5').
-*                   Thus any configuration of the local receive window size MUST be performed
-*                   by the application layer PRIOR to any TCP connection request/synchronization
-*                   either from a :
+*                   See also 'NetTCP_ConnCfgOptHandler()  Note #2'.
 *
-*                   (a) Actively- connected TCP connection
-*                   (b) Passively-connected TCP connection, which is cloned from its previously-
-*                           configured LISTEN-state TCP connection
+*               (3) See 'net_tcp.h  TCP OPTION ENABLE DEFINES  Note #1'.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgRxWinSize (NET_TCP_CONN_ID    conn_id_tcp,
-                                      NET_TCP_WIN_SIZE   win_size,
-                                      NET_ERR           *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgOpt (NET_TCP_CONN_ID   conn_id_tcp,
+                                CPU_INT08U        opt,
+                                NET_ERR          *p_err)
 {
    CPU_BOOLEAN  cfg_valid;
 
 
-#if(NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
                                                                 /* --------------- VALIDATE RTN ERR PTR --------------- */
    if (p_err == (NET_ERR *)0) {
        CPU_SW_EXCEPTION(DEF_FAIL);
@@ -5133,7 +6397,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgRxWinSize (NET_TCP_CONN_ID    conn_id_tcp,
 #endif
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
                                                                 /* See Note #2b.                                        */
-   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgRxWinSize, p_err);
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgOpt, p_err);
    if (*p_err != NET_ERR_NONE) {
         goto exit_lock_fault;
    }
@@ -5145,14 +6409,14 @@ CPU_BOOLEAN  NetTCP_ConnCfgRxWinSize (NET_TCP_CONN_ID    conn_id_tcp,
    }
 #endif
 
-                                                                /* ------------- CFG TCP CONN RX WIN SIZE ------------- */
-   cfg_valid = NetTCP_ConnCfgRxWinSizeHandler(conn_id_tcp, win_size, p_err);
+                                                                /* ---------------- CFG TCP CONN OPTS ----------------- */
+   cfg_valid = NetTCP_ConnCfgOptHandler(conn_id_tcp, opt, p_err);
    goto exit_release;
 
 
 exit_lock_fault:
-    cfg_valid = DEF_FAIL;
-    goto exit;
+   cfg_valid = DEF_FAIL;
+   goto exit;
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
 exit_fail:
@@ -5170,170 +6434,270 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                  NetTCP_ConnCfgRxWinSizeHandler()
+*                                     NetTCP_ConnCfgOptHandler()
 *
-* Description : (1) Configure TCP connection's   receive window size :
+* Description : (1) Configure TCP connection's   offered TCP options :
 *
-*                   (a) Validate  TCP connection receive window size configuration
-*                   (b) Configure TCP connection receive window size                        See Note #3
+*                   (a) Validate  TCP connection options configuration
+*                   (b) Validate  TCP connection state                                          See Note #3
+*                   (c) Configure TCP connection offered TCP options
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure receive window size.
-*               -----------     Argument checked by NetTCP_ConnCfgRxWinSize(),
-*                                                   NetSock_CfgRxQ_Size().
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure offered TCP options.
+*               -----------     Argument checked in NetTCP_ConnCfgOpt().
 *
-*               win_size        Desired receive window size.
+*               opt             TCP options to offer; bit-field flags logically OR'd (see
+*                                   'NetTCP_ConnCfgOpt()  opt').
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection receive window size
-*                                                                   successfully configured.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid receive window size.
+*                               NET_TCP_ERR_NONE                TCP connection options successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid OR compile-time disabled TCP option(s).
+*                               NET_TCP_ERR_INVALID_CONN_STATE  TCP connection NOT closed or listening.
 *
-* Return(s)   : DEF_OK,   TCP connection receive window size successfully configured.
+* Return(s)   : DEF_OK,   TCP connection options successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
-* Caller(s)   : NetTCP_ConnCfgRxWinSize(),
-*               NetSock_CfgRxQ_Size().
+* Caller(s)   : NetTCP_ConnCfgOpt().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgRxWinSizeHandler() is called by network protocol suite function(s)
-*                   & MUST be called with the global network lock already acquired.
-*
-*                   See also 'NetTCP_ConnCfgRxWinSize()  Note #2'.
+* Note(s)     : (2) NetTCP_ConnCfgOptHandler() is called by network protocol suite function(s) & MUST
+*                   be called with the global network lock already acquired.
 *
-*               (3) A TCP connection's receive window size SHOULD NOT be updated after the TCP
-*                   connection is connected (see 'NetTCP_RxConnWinSizeHandler()  Notes #2b & #5').
-*                   Thus any configuration of the local receive window size MUST be performed
-*                   by the application layer PRIOR to any TCP connection request/synchronization
-*                   either from a :
+*                   See also 'NetTCP_ConnCfgOpt()  Note #2'.
 *
-*                   (a) Actively- connected TCP connection
-*                   (b) Passively-connected TCP connection, which is cloned from its previously-
-*                           configured LISTEN-state TCP connection
+*               (3) TCP options are negotiated ONLY during connection synchronization.  Therefore, a TCP
+*                   connection's offered options may ONLY be configured before the connection is opened
+*                   or while it is listening; connections accepted from a listening connection inherit
+*                   its offered options.
 *
-*               (4) TCP connections' 'RxWinSizeCfgd' variables MUST ALWAYS be accessed with the global
-*                   network lock already acquired (see Note #2).
+*               (4) NET_TCP_OPT_EN_ALL is limited to the compile-time enabled options.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgRxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
-                                             NET_TCP_WIN_SIZE   win_size,
-                                             NET_ERR           *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgOptHandler (NET_TCP_CONN_ID   conn_id_tcp,
+                                       CPU_INT08U        opt,
+                                       NET_ERR          *p_err)
 {
     NET_TCP_CONN  *p_conn;
 
 
-                                                                /* --------------- VALIDATE RX WIN SIZE --------------- */
-#if (NET_TCP_WIN_SIZE_MIN > 0)
-    if (win_size < NET_TCP_WIN_SIZE_MIN) {
-       *p_err =  NET_TCP_ERR_INVALID_ARG;
-        return (DEF_FAIL);
+    if (opt == NET_TCP_OPT_EN_ALL) {                            /* See Note #4.                                         */
+        opt = NET_TCP_OPT_EN_CFG;
     }
-#endif
-#if ((NET_TCP_WIN_SIZE_MAX < DEF_INT_08U_MAX_VAL)                                                  || \
-    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_16U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_08U_MAX_VAL)) || \
-    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_32U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_16U_MAX_VAL)))
-    if (win_size > NET_TCP_WIN_SIZE_MAX) {
+                                                                /* ------------------ VALIDATE OPTS ------------------- */
+    if ((opt & (CPU_INT08U)~NET_TCP_OPT_EN_CFG) != NET_TCP_OPT_EN_NONE) {
        *p_err =  NET_TCP_ERR_INVALID_ARG;
         return (DEF_FAIL);
     }
-#endif
 
-
-                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
     p_conn = &NetTCP_ConnTbl[conn_id_tcp];
-
+                                                                /* -------------- VALIDATE TCP CONN STATE ------------- */
     switch (p_conn->ConnState) {
-        case NET_TCP_CONN_STATE_FREE:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
-            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
-             return (DEF_FAIL);
-
-
-        case NET_TCP_CONN_STATE_CLOSED:
+        case NET_TCP_CONN_STATE_CLOSED:                         /* See Note #3.                                         */
         case NET_TCP_CONN_STATE_LISTEN:
              break;
 
 
-        case NET_TCP_CONN_STATE_SYNC_RXD:
-        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
-        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
-        case NET_TCP_CONN_STATE_SYNC_TXD:
-        case NET_TCP_CONN_STATE_CONN:
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:
-        case NET_TCP_CONN_STATE_CLOSING:
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
-            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
-             return (DEF_FAIL);
-
-
-        case NET_TCP_CONN_STATE_NONE:
         default:
-             NetTCP_ConnClose(p_conn, DEF_NULL, DEF_YES, NET_TCP_CONN_CLOSE_CONN_ALL);
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
             *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
              return (DEF_FAIL);
     }
 
 
-                                                                /* ------------- CFG TCP CONN RX WIN SIZE ------------- */
-    p_conn->RxWinSizeCfgd = win_size;                           /* Cfg rx win size.                                     */
-    NetTCP_RxConnWinSizeCfg(p_conn);                            /* Cfg rx win ctrls.                                    */
+                                                                /* ---------------- CFG TCP CONN OPTS ----------------- */
+    p_conn->OptCfgd = opt;
+
+
+   *p_err =  NET_TCP_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 NetTCP_ConnCfgTxAckImmedRxdPushEn()
+*
+* Description : (1) Configure TCP connection's   transmit immediate acknowledgement for received & pushed
+*                       TCP segments enable :
+*
+*                   (a) Validate  TCP connection transmit immediate acknowledgement enable configuration
+*                   (b) Acquire   network lock
+*                   (c) Validate  TCP connection used
+*                   (d) Configure TCP connection transmit immediate acknowledgement enable      See Note #3
+*                   (e) Release   network lock
+*
+*
+* Argument(s) : conn_id_tcp         Handle identifier of TCP connection to configure transmit immediate
+*                                       acknowledgement for received & pushed TCP segments enable.
+*
+*               tx_immed_ack_en     Desired value for TCP connection transmit immediate acknowledgement
+*                                       for received & pushed TCP segments enable :
+*
+*                                       DEF_ENABLED             TCP connection acknowledgements
+*                                                                   immediately transmitted for any
+*                                                                   pushed TCP segments received.
+*
+*                                       DEF_DISABLED            TCP connection acknowledgements NOT
+*                                                                   immediately transmitted for any
+*                                                                   pushed TCP segments received.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP connection transmit immediate
+*                                                                   acknowledgement successfully configured.
+*
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*
+*                                                               ---- RETURNED BY NetTCP_ConnIsUsed() : -----
+*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
+*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
+*
+*                                                               --- RETURNED BY Net_GlobalLockAcquire() : --
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : DEF_OK,   TCP connection transmit immediate acknowledgement for received & pushed TCP
+*                             segments enable successfully configured.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetTCP_ConnCfgTxAckImmedRxdPushEn() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   This is required since an application's network protocol suite API function access
+*                   is asynchronous to other network protocol tasks.
+*
+*               (3) RFC #813, Section 5 states that "the receiver of data will refrain from sending an
+*                   acknowledgement under certain circumstances ... The most obvious event on which to
+*                   depend is the arrival of another segment.  So, if a segment arrives, postpone sending
+*                   an acknowledgement if ... the push bit is not set in the segment, since it is a
+*                   reasonable assumption that there is more data coming in a subsequent segment."
+*
+*                   See also 'NetTCP_TxConnAck()  Note #4a4'.
+*
+*               (4) TCP connections' 'TxAckImmedRxdPushEn' variables MUST ALWAYS be accessed with the
+*                   global network lock already acquired (see Note #2b).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetTCP_ConnCfgTxAckImmedRxdPushEn (NET_TCP_CONN_ID   conn_id_tcp,
+                                                CPU_BOOLEAN       tx_immed_ack_en,
+                                                NET_ERR          *p_err)
+{
+   NET_TCP_CONN  *p_conn;
+   CPU_BOOLEAN    rtn_val;
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+   if (p_err == (NET_ERR *)0) {
+       CPU_SW_EXCEPTION(DEF_FAIL);
+   }
+#endif
+                                                                /* ------------- VALIDATE TX IMMED ACK EN ------------- */
+   switch (tx_immed_ack_en) {
+       case DEF_ENABLED:
+       case DEF_DISABLED:
+            break;
+
+
+       default:
+           *p_err =  NET_TCP_ERR_INVALID_ARG;
+            return (DEF_FAIL);
+   }
+
+
+                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
+                                                                /* See Note #2b.                                        */
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxAckImmedRxdPushEn, p_err);
+   if (*p_err != NET_ERR_NONE) {
+        goto exit_lock_fault;
+   }
+
+
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
+  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+   if (*p_err != NET_TCP_ERR_NONE) {
+        goto exit_fail;
+   }
+#endif
+
+
+                                                                /* ----------- CFG TCP CONN TX IMMED ACK EN ----------- */
+   p_conn                      = &NetTCP_ConnTbl[conn_id_tcp];
+   p_conn->TxAckImmedRxdPushEn =  tx_immed_ack_en;
+
+
+   rtn_val = DEF_OK;
+  *p_err =  NET_TCP_ERR_NONE;
+   goto exit_release;
+
 
+exit_lock_fault:
+   rtn_val = DEF_FAIL;
+   goto exit;
 
-   *p_err =  NET_TCP_ERR_NONE;
+#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+exit_fail:
+   rtn_val = DEF_FAIL;
+#endif
 
-    return (DEF_OK);
+exit_release:
+                                                                /* ----------------- RELEASE NET LOCK ----------------- */
+   Net_GlobalLockRelease();
+
+exit:
+   return (rtn_val);
 }
 
 
 /*
 *********************************************************************************************************
-*                                      NetTCP_ConnCfgTxWinSize()
+*                                   NetTCP_ConnCfgTxAckDlyTimeout()
 *
-* Description : (1) Configure TCP connection's   transmit window size :
+* Description : (1) Configure TCP connection's   transmit acknowledgement delay timeout :
 *
 *                   (a) Acquire   network lock
 *                   (b) Validate  TCP connection used
-*                   (c) Configure TCP connection transmit window size                       See Note #3
+*                   (c) Configure TCP connection transmit acknowledgement delay timeout     See Note #3
 *                   (d) Release   network lock
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit window size.
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit acknowledgement
+*                                   delay timeout.
 *
-*               win_size        Desired transmit window size.
+*               timeout_ms      Desired value for TCP connection transmit acknowledgement delay timeout
+*                                   (in milliseconds).
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                                                               - RETURNED BY NetTCP_ConnCfgTxWinSizeHandler() : -
-*                               NET_TCP_ERR_NONE                TCP connection transmit window size successfully
-*                                                                   configured.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid transmit window size.
+*                                                               - RETURNED BY NetTCP_ConnCfgTxAckDlyTimeoutHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection transmit acknowledgement delay timeout
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid acknowledgement delay timeout.
 *
-*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
+*                                                               ---------- RETURNED BY NetTCP_ConnIsUsed() : -----------
 *                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
 *                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
 *
-*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
+*                                                               --------- RETURNED BY Net_GlobalLockAcquire() : --------
 *                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : DEF_OK,   TCP connection transmit window size successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit acknowledgement delay timeout successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
@@ -5342,7 +6706,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgRxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgTxWinSize() is called by application function(s) & ... :
+* Note(s)     : (2) NetTCP_ConnCfgTxAckDlyTimeout() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -5351,43 +6715,45 @@ CPU_BOOLEAN  NetTCP_ConnCfgRxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
 *                   This is required since an application's network protocol suite API function access
 *                   is asynchronous to other network protocol tasks.
 *
-*                   See also 'NetTCP_ConnCfgTxWinSizeHandler()  Note #2'.
+*                   See also 'NetTCP_ConnCfgTxAckDlyTimeoutHandler()  Note #2'.
 *
-*               (3) A TCP connection's transmit window size SHOULD NOT be updated after the TCP connection is
-*                   connected.  Thus any configuration of the local transmit window size MUST be performed by
-*                   the application layer PRIOR to any TCP connection request/synchronization either from a :
+*               (3) (a) RFC #1122, Section 4.2.3.2 states that "an ACK should not be excessively delayed;
+*                       in particular, the delay MUST be less than 0.5 seconds".
 *
-*                   (a) Actively- connected TCP connection
-*                   (b) Passively-connected TCP connection, which is cloned from its previously-
-*                           configured LISTEN-state TCP connection
+*                   (b) RFC #2581, Section 4.2 reiterates that "an ACK ... MUST be generated within 500 ms
+*                       of the arrival of the first unacknowledged packet".
 *
-*                   See also 'NetTCP_TxConnWinSizeHandlerCfgd()  Note #3'.
+*                   See also 'NetTCP_TxConnAck()  Note #6a2'.
+*
+*               (4) Configured timeout does NOT reschedule any current acknowledgement delay timeout in
+*                   progress but becomes effective the next time a TCP connection sets an acknowledgement
+*                   delay timeout.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgTxWinSize (NET_TCP_CONN_ID    conn_id_tcp,
-                                      NET_TCP_WIN_SIZE   win_size,
-                                      NET_ERR           *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyTimeout (NET_TCP_CONN_ID      conn_id_tcp,
+                                            NET_TCP_TIMEOUT_MS   timeout_ms,
+                                            NET_ERR             *p_err)
 {
-   CPU_BOOLEAN  cfg_valid;
+    CPU_BOOLEAN  cfg_valid;
 
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
                                                                 /* See Note #2b.                                        */
-   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxWinSize, p_err);
-   if (*p_err != NET_ERR_NONE) {
-        goto exit_lock_fault;
-   }
+    Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxAckDlyTimeout, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
-  (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
-   if (*p_err != NET_TCP_ERR_NONE) {
-        goto exit_fail;
-   }
+   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         goto exit_fail;
+    }
 #endif
 
-                                                                /* ------------- CFG TCP CONN TX WIN SIZE ------------- */
-   cfg_valid = NetTCP_ConnCfgTxWinSizeHandler(conn_id_tcp, win_size, p_err);
-   goto exit_release;
+                                                                /* --------- CFG TCP CONN TX ACK DLY TIMEOUT ---------- */
+    cfg_valid = NetTCP_ConnCfgTxAckDlyTimeoutHandler(conn_id_tcp, timeout_ms, p_err);
+    goto exit_release;
 
 
 exit_lock_fault:
@@ -5410,130 +6776,101 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                  NetTCP_ConnCfgTxWinSizeHandler()
+*                               NetTCP_ConnCfgTxAckDlyTimeoutHandler()
 *
-* Description : (1) Configure TCP connection's   transmit window size :
+* Description : (1) Configure TCP connection's   transmit acknowledgement delay timeout :
 *
-*                   (a) Validate  TCP connection transmit window size configuration
-*                   (b) Configure TCP connection transmit window size                       See Note #3
+*                   (a) Validate  TCP connection transmit acknowledgement delay timeout configuration
+*                   (b) Configure TCP connection transmit acknowledgement delay timeout         See Note #3
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit window size.
-*               -----------     Argument checked by NetTCP_ConnCfgTxWinSize(),
-*                                                   NetSock_CfgTxQ_Size().
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit acknowledgement
+*               -----------         delay timeout.
 *
-*               win_size        Desired transmit window size.
+*                               Argument checked   in NetTCP_ConnCfgTxAckDlyTimeout();
+*                                        validated in NetTCP_ConnClr().
+*
+*               timeout_ms      Desired value for TCP connection transmit acknowledgement delay timeout
+*                                   (in milliseconds).
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection transmit window size
-*                                                                   successfully configured.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*                               NET_TCP_ERR_INVALID_CONN_STATE  Invalid TCP connection state.
-*                               NET_TCP_ERR_INVALID_CONN_OP     Invalid TCP connection operation.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid transmit window size.
+*                               NET_TCP_ERR_NONE                TCP connection transmit acknowledgement
+*                                                                   delay timeout successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid acknowledgement delay timeout.
 *
-* Return(s)   : DEF_OK,   TCP connection transmit window size successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit acknowledgement delay timeout successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
-* Caller(s)   : NetTCP_ConnCfgTxWinSize(),
-*               NetSock_CfgTxQ_Size().
+* Caller(s)   : NetTCP_ConnCfgTxAckDlyTimeout(),
+*               NetTCP_ConnClr().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgTxWinSizeHandler() is called by network protocol suite function(s)
+* Note(s)     : (2) NetTCP_ConnCfgTxAckDlyTimeoutHandler() is called by network protocol suite function(s)
 *                   & MUST be called with the global network lock already acquired.
 *
-*                   See also 'NetTCP_ConnCfgTxWinSize()  Note #2'.
+*                   See also 'NetTCP_ConnCfgTxAckDlyTimeout()  Note #2'.
 *
-*               (3) A TCP connection's transmit window size SHOULD NOT be updated after the TCP connection is
-*                   connected.  Thus any configuration of the local transmit window size MUST be performed by
-*                   the application layer PRIOR to any TCP connection request/synchronization either from a :
+*               (3) (a) (1) RFC #1122, Section 4.2.3.2 states that "an ACK should not be excessively
+*                               delayed; in particular, the delay MUST be less than 0.5 seconds".
 *
-*                   (a) Actively- connected TCP connection
-*                   (b) Passively-connected TCP connection, which is cloned from its previously-
-*                           configured LISTEN-state TCP connection
+*                       (2) RFC #2581, Section 4.2 reiterates that "an ACK ... MUST be generated
+*                           within 500 ms of the arrival of the first unacknowledged packet".
 *
-*                   See also 'NetTCP_TxConnWinSizeHandlerCfgd()  Note #3'.
+*                   (b) If the acknowledgement delay timeout is configured with a non-zero value,
+*                       at least one timer tick MUST be set to ensure that the non-zero timeout
+*                       is implemented.
 *
-*               (4) TCP connections' 'TxWinSizeCfgd' variables MUST ALWAYS be accessed with the global
+*                   See also 'NetTCP_TxConnAck()  Note #6a2'.
+*
+*               (4) Configured timeout does NOT reschedule any current acknowledgement delay timeout in
+*                   progress but becomes effective the next time a TCP connection sets an acknowledgement
+*                   delay timeout.
+*
+*               (5) Configured timeout converted to 'NET_TMR_TICK' ticks to avoid run-time conversion.
+*
+*               (6) TCP connections' 'TxAckDlyTimeout' variables MUST ALWAYS be accessed with the global
 *                   network lock already acquired (see Note #2).
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgTxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
-                                             NET_TCP_WIN_SIZE   win_size,
-                                             NET_ERR           *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyTimeoutHandler (NET_TCP_CONN_ID      conn_id_tcp,
+                                                   NET_TCP_TIMEOUT_MS   timeout_ms,
+                                                   NET_ERR             *p_err)
 {
     NET_TCP_CONN  *p_conn;
+    NET_TMR_TICK   timeout_tick;
 
 
-                                                                /* --------------- VALIDATE TX WIN SIZE --------------- */
-#if (NET_TCP_WIN_SIZE_MIN > 0)
-    if (win_size < NET_TCP_WIN_SIZE_MIN) {
+                                                                /* ----------- VALIDATE TX ACK DLY TIMEOUT ------------ */
+#if (NET_TCP_ACK_DLY_TIME_MIN_MS > 0)
+    if (timeout_ms < NET_TCP_ACK_DLY_TIME_MIN_MS) {
        *p_err =  NET_TCP_ERR_INVALID_ARG;
         return (DEF_FAIL);
     }
 #endif
-#if ((NET_TCP_WIN_SIZE_MAX < DEF_INT_08U_MAX_VAL)                                                  || \
-    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_16U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_08U_MAX_VAL)) || \
-    ((NET_TCP_WIN_SIZE_MAX < DEF_INT_32U_MAX_VAL) && (NET_TCP_WIN_SIZE_MAX > DEF_INT_16U_MAX_VAL)))
-    if (win_size > NET_TCP_WIN_SIZE_MAX) {
+#if ((NET_TCP_ACK_DLY_TIME_MAX_MS < DEF_INT_08U_MAX_VAL)                                                         || \
+    ((NET_TCP_ACK_DLY_TIME_MAX_MS < DEF_INT_16U_MAX_VAL) && (NET_TCP_ACK_DLY_TIME_MAX_MS > DEF_INT_08U_MAX_VAL)) || \
+    ((NET_TCP_ACK_DLY_TIME_MAX_MS < DEF_INT_32U_MAX_VAL) && (NET_TCP_ACK_DLY_TIME_MAX_MS > DEF_INT_16U_MAX_VAL)))
+    if (timeout_ms > NET_TCP_ACK_DLY_TIME_MAX_MS) {
        *p_err =  NET_TCP_ERR_INVALID_ARG;
         return (DEF_FAIL);
     }
 #endif
 
 
-                                                                /* ------------- VALIDATE TCP CONN STATE -------------- */
-    p_conn = &NetTCP_ConnTbl[conn_id_tcp];
-
-    switch (p_conn->ConnState) {
-        case NET_TCP_CONN_STATE_FREE:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.NotUsedCtr);
-            *p_err =  NET_TCP_ERR_CONN_NOT_USED;
-             return (DEF_FAIL);
-
-
-        case NET_TCP_CONN_STATE_CLOSED:
-        case NET_TCP_CONN_STATE_LISTEN:
-             break;
-
-
-        case NET_TCP_CONN_STATE_SYNC_RXD:
-        case NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE:
-        case NET_TCP_CONN_STATE_SYNC_RXD_ACTIVE:
-        case NET_TCP_CONN_STATE_SYNC_TXD:
-        case NET_TCP_CONN_STATE_CONN:
-        case NET_TCP_CONN_STATE_FIN_WAIT_1:
-        case NET_TCP_CONN_STATE_FIN_WAIT_2:
-        case NET_TCP_CONN_STATE_CLOSING:
-        case NET_TCP_CONN_STATE_TIME_WAIT:
-        case NET_TCP_CONN_STATE_CLOSE_WAIT:
-        case NET_TCP_CONN_STATE_LAST_ACK:
-        case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidOpCtr);
-            *p_err =  NET_TCP_ERR_INVALID_CONN_OP;
-             return (DEF_FAIL);
-
-
-        case NET_TCP_CONN_STATE_NONE:
-        default:
-             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                              (NET_BUF_HDR      *)0,
-                              (CPU_BOOLEAN       )DEF_YES,
-                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_CONN_ALL);
-             NET_CTR_ERR_INC(Net_ErrCtrs.TCP.ConnInvalidStateCtr);
-            *p_err =  NET_TCP_ERR_INVALID_CONN_STATE;
-             return (DEF_FAIL);
+                                                                /* --------- CFG TCP CONN TX ACK DLY TIMEOUT ---------- */
+    timeout_tick = (timeout_ms * NET_TMR_TIME_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
+    if (timeout_tick < 1) {                                     /* If < 1 tick, ...                                     */
+        timeout_tick = 1u;                                      /* ... set at least 1 tick (see Note #3b).              */
     }
 
-
-                                                                /* ------------- CFG TCP CONN TX WIN SIZE ------------- */
-    p_conn->TxWinSizeCfgd = win_size;                           /* Cfg tx win size.                                     */
-    NetTCP_TxConnWinSizeCfg(p_conn);                            /* Cfg tx win ctrls.                                    */
+    p_conn                       = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn->TxAckDlyTimeout_ms   =  timeout_ms;
+    p_conn->TxAckDlyTimeout_tick =  timeout_tick;
 
 
    *p_err =  NET_TCP_ERR_NONE;
@@ -5544,45 +6881,37 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
 
 /*
 *********************************************************************************************************
-*                                      NetTCP_ConnCfgTxNagleEn()
+*                                    NetTCP_ConnCfgTxAckDlyCntTh()
 *
-* Description : (1) Configure TCP connection's   transmit Nagle algorithm enable :
+* Description : (1) Configure TCP connection's   transmit acknowledgement delay count threshold :
 *
 *                   (a) Acquire   network lock
 *                   (b) Validate  TCP connection used
-*                   (c) Configure TCP connection transmit Nagle algorithm enable            See Note #3
+*                   (c) Configure TCP connection transmit acknowledgement delay count threshold See Note #3
 *                   (d) Release   network lock
 *
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit Nagle enable.
-*
-*               nagle_en        Desired value for TCP connection transmit Nagle enable :
-*
-*                                   DEF_ENABLED             TCP connections delay transmitting next data
-*                                                               segment(s) until all unacknowledged data
-*                                                               is acknowledged OR an MSS-sized segment
-*                                                               can be transmitted.
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit acknowledgement
+*                                   delay count threshold.
 *
-*                                   DEF_DISABLED            TCP connections transmit all data segment(s)
-*                                                               when permitted by local & remote hosts'
-*                                                               congestion controls.
+*               cnt_th          Desired number of received segments to acknowledge per delayed acknowledgement.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                                                               - RETURNED BY NetTCP_ConnCfgTxNagleEnHandler() : -
-*                               NET_TCP_ERR_NONE                TCP connection transmit Nagle enable successfully
-*                                                                   configured.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*                                                               - RETURNED BY NetTCP_ConnCfgTxAckDlyCntThHandler() : -
+*                               NET_TCP_ERR_NONE                TCP connection transmit acknowledgement delay count
+*                                                                   threshold successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid acknowledgement delay count threshold.
 *
-*                                                               ------- RETURNED BY NetTCP_ConnIsUsed() : --------
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                                                               --------- RETURNED BY NetTCP_ConnIsUsed() : ---------
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
 *                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
 *
-*                                                               ------ RETURNED BY Net_GlobalLockAcquire() : -----
+*                                                               -------- RETURNED BY Net_GlobalLockAcquire() : ------
 *                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : DEF_OK,   TCP connection transmit Nagle enable successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit acknowledgement delay count threshold successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
@@ -5591,7 +6920,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgTxNagleEn() is called by application function(s) & ... :
+* Note(s)     : (2) NetTCP_ConnCfgTxAckDlyCntTh() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -5600,19 +6929,15 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxWinSizeHandler (NET_TCP_CONN_ID    conn_id_tcp,
 *                   This is required since an application's network protocol suite API function access
 *                   is asynchronous to other network protocol tasks.
 *
-*                   See also 'NetTCP_ConnCfgTxNagleEnHandler()  Note #2'.
-*
-*               (3) RFC #1122, Section 4.2.3.4 also states that "a TCP SHOULD implement the Nagle
-*                   Algorithm ... However, there MUST be a way for an application to disable the
-*                   Nagle algorithm on an individual connection".
+*                   See also 'NetTCP_ConnCfgTxAckDlyCntThHandler()  Note #2'.
 *
-*                   See also 'NetTCP_TxConnTxQ()  Note #6'.
+*               (3) See 'net_tcp.h  TCP CONGESTION CONTROL DEFINES  Note #6a'.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEn (NET_TCP_CONN_ID   conn_id_tcp,
-                                      CPU_BOOLEAN       nagle_en,
-                                      NET_ERR          *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyCntTh (NET_TCP_CONN_ID   conn_id_tcp,
+                                          CPU_INT16U        cnt_th,
+                                          NET_ERR          *p_err)
 {
    CPU_BOOLEAN  cfg_valid;
 
@@ -5625,7 +6950,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEn (NET_TCP_CONN_ID   conn_id_tcp,
 #endif
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
                                                                 /* See Note #2b.                                        */
-   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxNagleEn, p_err);
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxAckDlyCntTh, p_err);
    if (*p_err != NET_ERR_NONE) {
         goto exit_lock_fault;
    }
@@ -5637,8 +6962,8 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEn (NET_TCP_CONN_ID   conn_id_tcp,
    }
 #endif
 
-                                                                /* ------------- CFG TCP CONN TX NAGLE EN ------------- */
-   cfg_valid = NetTCP_ConnCfgTxNagleEnHandler(conn_id_tcp, nagle_en, p_err);
+                                                                /* --------- CFG TCP CONN TX ACK DLY CNT TH ----------- */
+   cfg_valid = NetTCP_ConnCfgTxAckDlyCntThHandler(conn_id_tcp, cnt_th, p_err);
    goto exit_release;
 
 
@@ -5662,82 +6987,64 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                  NetTCP_ConnCfgTxNagleEnHandler()
+*                                 NetTCP_ConnCfgTxAckDlyCntThHandler()
 *
-* Description : (1) Configure TCP connection's   transmit Nagle algorithm enable :
-*
-*                   (a) Validate  TCP connection transmit Nagle algorithm enable configuration
-*                   (b) Configure TCP connection transmit Nagle algorithm enable                See Note #3
+* Description : (1) Configure TCP connection's   transmit acknowledgement delay count threshold :
 *
+*                   (a) Validate  TCP connection transmit acknowledgement delay count threshold
+*                   (b) Configure TCP connection transmit acknowledgement delay count threshold
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit Nagle enable.
-*               -----------     Argument checked in NetTCP_ConnCfgTxNagleEn().
 *
-*               nagle_en        Desired value for TCP connection transmit Nagle enable :
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit acknowledgement
+*               -----------         delay count threshold.
 *
-*                                   DEF_ENABLED             TCP connections delay transmitting next data
-*                                                               segment(s) until all unacknowledged data
-*                                                               is acknowledged OR an MSS-sized segment
-*                                                               can be transmitted.
+*                               Argument checked in NetTCP_ConnCfgTxAckDlyCntTh().
 *
-*                                   DEF_DISABLED            TCP connections transmit all data segment(s)
-*                                                               when permitted by local & remote hosts'
-*                                                               congestion controls.
+*               cnt_th          Desired number of received segments to acknowledge per delayed acknowledgement.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection transmit Nagle enable
-*                                                                   successfully configured.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
+*                               NET_TCP_ERR_NONE                TCP connection transmit acknowledgement delay
+*                                                                   count threshold successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid acknowledgement delay count threshold.
 *
-* Return(s)   : DEF_OK,   TCP connection transmit Nagle enable successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit acknowledgement delay count threshold successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
-* Caller(s)   : NetTCP_ConnCfgTxNagleEn().
+* Caller(s)   : NetTCP_ConnCfgTxAckDlyCntTh().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgTxNagleEnHandler() is called by network protocol suite function(s)
+* Note(s)     : (2) NetTCP_ConnCfgTxAckDlyCntThHandler() is called by network protocol suite function(s)
 *                   & MUST be called with the global network lock already acquired.
 *
-*                   See also 'NetTCP_ConnCfgTxNagleEn()  Note #2'.
-*
-*               (3) RFC #1122, Section 4.2.3.4 also states that "a TCP SHOULD implement the Nagle
-*                   Algorithm ... However, there MUST be a way for an application to disable the
-*                   Nagle algorithm on an individual connection".
-*
-*                   See also 'NetTCP_TxConnTxQ()  Note #6'.
+*                   See also 'NetTCP_ConnCfgTxAckDlyCntTh()  Note #2'.
 *
-*               (4) TCP connections' 'TxWinSizeNagleEn' variables MUST ALWAYS be accessed with the
-*                   global network lock already acquired (see Note #2).
+*               (3) Configured threshold does NOT affect the acknowledgement delay timeout; any delayed
+*                   acknowledgement is still transmitted within the configured timeout.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
-                                             CPU_BOOLEAN       nagle_en,
-                                             NET_ERR          *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyCntThHandler (NET_TCP_CONN_ID   conn_id_tcp,
+                                                 CPU_INT16U        cnt_th,
+                                                 NET_ERR          *p_err)
 {
     NET_TCP_CONN  *p_conn;
 
 
-                                                                /* ---------------- VALIDATE NAGLE EN ----------------- */
-    switch (nagle_en) {
-        case DEF_ENABLED:
-        case DEF_DISABLED:
-             break;
-
-
-        default:
-            *p_err =  NET_TCP_ERR_INVALID_ARG;
-             return (DEF_FAIL);
+                                                                /* ------------ VALIDATE TX ACK DLY CNT TH ------------ */
+    if ((cnt_th < NET_TCP_ACK_DLY_CNT_TH_MIN) ||
+        (cnt_th > NET_TCP_ACK_DLY_CNT_TH_MAX)) {
+       *p_err =  NET_TCP_ERR_INVALID_ARG;
+        return (DEF_FAIL);
     }
 
 
-                                                                /* ------------- CFG TCP CONN TX NAGLE EN ------------- */
-    p_conn                   = &NetTCP_ConnTbl[conn_id_tcp];
-    p_conn->TxWinSizeNagleEn =  nagle_en;
+                                                                /* --------- CFG TCP CONN TX ACK DLY CNT TH ----------- */
+    p_conn                = &NetTCP_ConnTbl[conn_id_tcp];
+    p_conn->TxAckDlyCntTh =  cnt_th;
 
 
    *p_err =  NET_TCP_ERR_NONE;
@@ -5748,49 +7055,42 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
 
 /*
 *********************************************************************************************************
-*                                 NetTCP_ConnCfgTxAckImmedRxdPushEn()
+*                                       NetTCP_ConnCfgTxCorkEn()
 *
-* Description : (1) Configure TCP connection's   transmit immediate acknowledgement for received & pushed
-*                       TCP segments enable :
+* Description : (1) Configure TCP connection's   transmit cork enable :
 *
-*                   (a) Validate  TCP connection transmit immediate acknowledgement enable configuration
-*                   (b) Acquire   network lock
-*                   (c) Validate  TCP connection used
-*                   (d) Configure TCP connection transmit immediate acknowledgement enable      See Note #3
-*                   (e) Release   network lock
+*                   (a) Acquire   network lock
+*                   (b) Validate  TCP connection used
+*                   (c) Configure TCP connection transmit cork enable                       See Note #3
+*                   (d) Release   network lock
 *
 *
-* Argument(s) : conn_id_tcp         Handle identifier of TCP connection to configure transmit immediate
-*                                       acknowledgement for received & pushed TCP segments enable.
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit cork enable.
 *
-*               tx_immed_ack_en     Desired value for TCP connection transmit immediate acknowledgement
-*                                       for received & pushed TCP segments enable :
+*               cork_en         Desired value for TCP connection transmit cork enable :
 *
-*                                       DEF_ENABLED             TCP connection acknowledgements
-*                                                                   immediately transmitted for any
-*                                                                   pushed TCP segments received.
+*                                   DEF_ENABLED             TCP connections hold less-than-MSS-sized data
+*                                                               segment(s) until uncorked.
 *
-*                                       DEF_DISABLED            TCP connection acknowledgements NOT
-*                                                                   immediately transmitted for any
-*                                                                   pushed TCP segments received.
+*                                   DEF_DISABLED            TCP connections transmit held data segment(s)
+*                                                               immediately & resume normal transmit.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection transmit immediate
-*                                                                   acknowledgement successfully configured.
-*
+*                                                               --- RETURNED BY NetTCP_ConnCfgTxCorkEnHandler() : ---
+*                               NET_TCP_ERR_NONE                TCP connection transmit cork enable successfully
+*                                                                   configured.
 *                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
 *
-*                                                               ---- RETURNED BY NetTCP_ConnIsUsed() : -----
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
+*                                                               --------- RETURNED BY NetTCP_ConnIsUsed() : ---------
+*                               NET_INIT_ERR_NOT_COMPLETED      Network initialization NOT complete.
 *                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
 *                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
 *
-*                                                               --- RETURNED BY Net_GlobalLockAcquire() : --
+*                                                               -------- RETURNED BY Net_GlobalLockAcquire() : ------
 *                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
 *
-* Return(s)   : DEF_OK,   TCP connection transmit immediate acknowledgement for received & pushed TCP
-*                             segments enable successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit cork enable successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
@@ -5799,7 +7099,7 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
 *               This function is a network protocol suite application programming interface (API) function
 *               & MAY be called by application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgTxAckImmedRxdPushEn() is called by application function(s) & ... :
+* Note(s)     : (2) NetTCP_ConnCfgTxCorkEn() is called by application function(s) & ... :
 *
 *                   (a) MUST NOT be called with the global network lock already acquired; ...
 *                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
@@ -5808,25 +7108,21 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxNagleEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
 *                   This is required since an application's network protocol suite API function access
 *                   is asynchronous to other network protocol tasks.
 *
-*               (3) RFC #813, Section 5 states that "the receiver of data will refrain from sending an
-*                   acknowledgement under certain circumstances ... The most obvious event on which to
-*                   depend is the arrival of another segment.  So, if a segment arrives, postpone sending
-*                   an acknowledgement if ... the push bit is not set in the segment, since it is a
-*                   reasonable assumption that there is more data coming in a subsequent segment."
+*                   See also 'NetTCP_ConnCfgTxCorkEnHandler()  Note #2'.
 *
-*                   See also 'NetTCP_TxConnAck()  Note #4a4'.
+*               (3) Corking lets an application build one message from several writes (e.g. a protocol
+*                   header & its payload) & transmit it as a single segment when uncorked, regardless of
+*                   the Nagle algorithm.
 *
-*               (4) TCP connections' 'TxAckImmedRxdPushEn' variables MUST ALWAYS be accessed with the
-*                   global network lock already acquired (see Note #2b).
+*                   See also 'NetTCP_TxConnTxQ()  Note #15'.
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgTxAckImmedRxdPushEn (NET_TCP_CONN_ID   conn_id_tcp,
-                                                CPU_BOOLEAN       tx_immed_ack_en,
-                                                NET_ERR          *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxCorkEn (NET_TCP_CONN_ID   conn_id_tcp,
+                                     CPU_BOOLEAN       cork_en,
+                                     NET_ERR          *p_err)
 {
-   NET_TCP_CONN  *p_conn;
-   CPU_BOOLEAN    rtn_val;
+   CPU_BOOLEAN  cfg_valid;
 
 
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -5835,27 +7131,13 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxAckImmedRxdPushEn (NET_TCP_CONN_ID   conn_id_tcp,
        CPU_SW_EXCEPTION(DEF_FAIL);
    }
 #endif
-                                                                /* ------------- VALIDATE TX IMMED ACK EN ------------- */
-   switch (tx_immed_ack_en) {
-       case DEF_ENABLED:
-       case DEF_DISABLED:
-            break;
-
-
-       default:
-           *p_err =  NET_TCP_ERR_INVALID_ARG;
-            return (DEF_FAIL);
-   }
-
-
                                                                 /* ----------------- ACQUIRE NET LOCK ----------------- */
                                                                 /* See Note #2b.                                        */
-   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxAckImmedRxdPushEn, p_err);
+   Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxCorkEn, p_err);
    if (*p_err != NET_ERR_NONE) {
         goto exit_lock_fault;
    }
 
-
 #if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
    if (*p_err != NET_TCP_ERR_NONE) {
@@ -5863,127 +7145,11 @@ CPU_BOOLEAN  NetTCP_ConnCfgTxAckImmedRxdPushEn (NET_TCP_CONN_ID   conn_id_tcp,
    }
 #endif
 
-
-                                                                /* ----------- CFG TCP CONN TX IMMED ACK EN ----------- */
-   p_conn                      = &NetTCP_ConnTbl[conn_id_tcp];
-   p_conn->TxAckImmedRxdPushEn =  tx_immed_ack_en;
-
-
-   rtn_val = DEF_OK;
-  *p_err =  NET_TCP_ERR_NONE;
+                                                                /* ------------- CFG TCP CONN TX CORK EN -------------- */
+   cfg_valid = NetTCP_ConnCfgTxCorkEnHandler(conn_id_tcp, cork_en, p_err);
    goto exit_release;
 
 
-exit_lock_fault:
-   rtn_val = DEF_FAIL;
-   goto exit;
-
-#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-exit_fail:
-   rtn_val = DEF_FAIL;
-#endif
-
-exit_release:
-                                                                /* ----------------- RELEASE NET LOCK ----------------- */
-   Net_GlobalLockRelease();
-
-exit:
-   return (rtn_val);
-}
-
-
-/*
-*********************************************************************************************************
-*                                   NetTCP_ConnCfgTxAckDlyTimeout()
-*
-* Description : (1) Configure TCP connection's   transmit acknowledgement delay timeout :
-*
-*                   (a) Acquire   network lock
-*                   (b) Validate  TCP connection used
-*                   (c) Configure TCP connection transmit acknowledgement delay timeout     See Note #3
-*                   (d) Release   network lock
-*
-*
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit acknowledgement
-*                                   delay timeout.
-*
-*               timeout_ms      Desired value for TCP connection transmit acknowledgement delay timeout
-*                                   (in milliseconds).
-*
-*               p_err        Pointer to variable that will receive the return error code from this function :
-*
-*                                                               - RETURNED BY NetTCP_ConnCfgTxAckDlyTimeoutHandler() : -
-*                               NET_TCP_ERR_NONE                TCP connection transmit acknowledgement delay timeout
-*                                                                   successfully configured.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid acknowledgement delay timeout.
-*
-*                                                               ---------- RETURNED BY NetTCP_ConnIsUsed() : -----------
-*                               NET_INIT_ERR_NOT_COMPLETED         Network initialization NOT complete.
-*                               NET_TCP_ERR_INVALID_CONN        Invalid TCP connection number.
-*                               NET_TCP_ERR_CONN_NOT_USED       TCP connection NOT currently used.
-*
-*                                                               --------- RETURNED BY Net_GlobalLockAcquire() : --------
-*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
-*
-* Return(s)   : DEF_OK,   TCP connection transmit acknowledgement delay timeout successfully configured.
-*
-*               DEF_FAIL, otherwise.
-*
-* Caller(s)   : Application.
-*
-*               This function is a network protocol suite application programming interface (API) function
-*               & MAY be called by application function(s) [see also Note #2].
-*
-* Note(s)     : (2) NetTCP_ConnCfgTxAckDlyTimeout() is called by application function(s) & ... :
-*
-*                   (a) MUST NOT be called with the global network lock already acquired; ...
-*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
-*                       network lock (see 'net.h  Note #3').
-*
-*                   This is required since an application's network protocol suite API function access
-*                   is asynchronous to other network protocol tasks.
-*
-*                   See also 'NetTCP_ConnCfgTxAckDlyTimeoutHandler()  Note #2'.
-*
-*               (3) (a) RFC #1122, Section 4.2.3.2 states that "an ACK should not be excessively delayed;
-*                       in particular, the delay MUST be less than 0.5 seconds".
-*
-*                   (b) RFC #2581, Section 4.2 reiterates that "an ACK ... MUST be generated within 500 ms
-*                       of the arrival of the first unacknowledged packet".
-*
-*                   See also 'NetTCP_TxConnAck()  Note #6a2'.
-*
-*               (4) Configured timeout does NOT reschedule any current acknowledgement delay timeout in
-*                   progress but becomes effective the next time a TCP connection sets an acknowledgement
-*                   delay timeout.
-*********************************************************************************************************
-*/
-
-CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyTimeout (NET_TCP_CONN_ID      conn_id_tcp,
-                                            NET_TCP_TIMEOUT_MS   timeout_ms,
-                                            NET_ERR             *p_err)
-{
-    CPU_BOOLEAN  cfg_valid;
-
-                                                                /* ----------------- ACQUIRE NET LOCK ----------------- */
-                                                                /* See Note #2b.                                        */
-    Net_GlobalLockAcquire((void *)&NetTCP_ConnCfgTxAckDlyTimeout, p_err);
-    if (*p_err != NET_ERR_NONE) {
-         goto exit_lock_fault;
-    }
-
-#if (NET_ERR_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE TCP CONN USED -------------- */
-   (void)NetTCP_ConnIsUsed(conn_id_tcp, p_err);
-    if (*p_err != NET_TCP_ERR_NONE) {
-         goto exit_fail;
-    }
-#endif
-
-                                                                /* --------- CFG TCP CONN TX ACK DLY TIMEOUT ---------- */
-    cfg_valid = NetTCP_ConnCfgTxAckDlyTimeoutHandler(conn_id_tcp, timeout_ms, p_err);
-    goto exit_release;
-
-
 exit_lock_fault:
    cfg_valid = DEF_FAIL;
    goto exit;
@@ -6004,101 +7170,104 @@ exit:
 
 /*
 *********************************************************************************************************
-*                               NetTCP_ConnCfgTxAckDlyTimeoutHandler()
-*
-* Description : (1) Configure TCP connection's   transmit acknowledgement delay timeout :
+*                                   NetTCP_ConnCfgTxCorkEnHandler()
 *
-*                   (a) Validate  TCP connection transmit acknowledgement delay timeout configuration
-*                   (b) Configure TCP connection transmit acknowledgement delay timeout         See Note #3
+* Description : (1) Configure TCP connection's   transmit cork enable :
 *
+*                   (a) Validate  TCP connection transmit cork enable configuration
+*                   (b) Configure TCP connection transmit cork enable
+*                   (c) Flush     TCP connection transmit queue, if uncorked                     See Note #3
 *
-* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit acknowledgement
-*               -----------         delay timeout.
 *
-*                               Argument checked   in NetTCP_ConnCfgTxAckDlyTimeout();
-*                                        validated in NetTCP_ConnClr().
+* Argument(s) : conn_id_tcp     Handle identifier of TCP connection to configure transmit cork enable.
+*               -----------     Argument checked in NetTCP_ConnCfgTxCorkEn(),
+*                                                   NetSock_OptSet().
 *
-*               timeout_ms      Desired value for TCP connection transmit acknowledgement delay timeout
-*                                   (in milliseconds).
+*               cork_en         Desired value for TCP connection transmit cork enable (see
+*                                   'NetTCP_ConnCfgTxCorkEn()  cork_en').
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
-*                               NET_TCP_ERR_NONE                TCP connection transmit acknowledgement
-*                                                                   delay timeout successfully configured.
-*                               NET_TCP_ERR_INVALID_ARG         Invalid acknowledgement delay timeout.
+*                               NET_TCP_ERR_NONE                TCP connection transmit cork enable
+*                                                                   successfully configured.
+*                               NET_TCP_ERR_INVALID_ARG         Invalid enable/disable configuration.
 *
-* Return(s)   : DEF_OK,   TCP connection transmit acknowledgement delay timeout successfully configured.
+* Return(s)   : DEF_OK,   TCP connection transmit cork enable successfully configured.
 *
 *               DEF_FAIL, otherwise.
 *
-* Caller(s)   : NetTCP_ConnCfgTxAckDlyTimeout(),
-*               NetTCP_ConnClr().
+* Caller(s)   : NetTCP_ConnCfgTxCorkEn(),
+*               NetSock_OptSet().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
 *               application function(s) [see also Note #2].
 *
-* Note(s)     : (2) NetTCP_ConnCfgTxAckDlyTimeoutHandler() is called by network protocol suite function(s)
+* Note(s)     : (2) NetTCP_ConnCfgTxCorkEnHandler() is called by network protocol suite function(s)
 *                   & MUST be called with the global network lock already acquired.
 *
-*                   See also 'NetTCP_ConnCfgTxAckDlyTimeout()  Note #2'.
-*
-*               (3) (a) (1) RFC #1122, Section 4.2.3.2 states that "an ACK should not be excessively
-*                               delayed; in particular, the delay MUST be less than 0.5 seconds".
-*
-*                       (2) RFC #2581, Section 4.2 reiterates that "an ACK ... MUST be generated
-*                           within 500 ms of the arrival of the first unacknowledged packet".
-*
-*                   (b) If the acknowledgement delay timeout is configured with a non-zero value,
-*                       at least one timer tick MUST be set to ensure that the non-zero timeout
-*                       is implemented.
-*
-*                   See also 'NetTCP_TxConnAck()  Note #6a2'.
+*                   See also 'NetTCP_ConnCfgTxCorkEn()  Note #2'.
 *
-*               (4) Configured timeout does NOT reschedule any current acknowledgement delay timeout in
-*                   progress but becomes effective the next time a TCP connection sets an acknowledgement
-*                   delay timeout.
+*               (3) (a) Held data is flushed ONLY from states that transmit application data; any flush
+*                       error is handled by NetTCP_TxConnTxQ() & does NOT fail the configuration.
 *
-*               (5) Configured timeout converted to 'NET_TMR_TICK' ticks to avoid run-time conversion.
+*                   (b) Held data NOT transmitted by the flush (e.g. because of the remote host's window)
+*                       remains queued & is transmitted by the normal transmit controls.
 *
-*               (6) TCP connections' 'TxAckDlyTimeout' variables MUST ALWAYS be accessed with the global
-*                   network lock already acquired (see Note #2).
+*               (4) TCP connections' 'TxCork' variables MUST ALWAYS be accessed with the global network
+*                   lock already acquired (see Note #2).
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  NetTCP_ConnCfgTxAckDlyTimeoutHandler (NET_TCP_CONN_ID      conn_id_tcp,
-                                                   NET_TCP_TIMEOUT_MS   timeout_ms,
-                                                   NET_ERR             *p_err)
+CPU_BOOLEAN  NetTCP_ConnCfgTxCorkEnHandler (NET_TCP_CONN_ID   conn_id_tcp,
+                                            CPU_BOOLEAN       cork_en,
+                                            NET_ERR          *p_err)
 {
     NET_TCP_CONN  *p_conn;
-    NET_TMR_TICK   timeout_tick;
+    CPU_BOOLEAN    tx_flush;
+    NET_ERR        err;
 
 
-                                                                /* ----------- VALIDATE TX ACK DLY TIMEOUT ------------ */
-#if (NET_TCP_ACK_DLY_TIME_MIN_MS > 0)
-    if (timeout_ms < NET_TCP_ACK_DLY_TIME_MIN_MS) {
-       *p_err =  NET_TCP_ERR_INVALID_ARG;
-        return (DEF_FAIL);
-    }
-#endif
-#if ((NET_TCP_ACK_DLY_TIME_MAX_MS < DEF_INT_08U_MAX_VAL)                                                         || \
-    ((NET_TCP_ACK_DLY_TIME_MAX_MS < DEF_INT_16U_MAX_VAL) && (NET_TCP_ACK_DLY_TIME_MAX_MS > DEF_INT_08U_MAX_VAL)) || \
-    ((NET_TCP_ACK_DLY_TIME_MAX_MS < DEF_INT_32U_MAX_VAL) && (NET_TCP_ACK_DLY_TIME_MAX_MS > DEF_INT_16U_MAX_VAL)))
-    if (timeout_ms > NET_TCP_ACK_DLY_TIME_MAX_MS) {
-       *p_err =  NET_TCP_ERR_INVALID_ARG;
-        return (DEF_FAIL);
+                                                                /* ----------------- VALIDATE CORK EN ----------------- */
+    switch (cork_en) {
+        case DEF_ENABLED:
+        case DEF_DISABLED:
+             break;
+
+
+        default:
+            *p_err =  NET_TCP_ERR_INVALID_ARG;
+             return (DEF_FAIL);
     }
-#endif
 
 
-                                                                /* --------- CFG TCP CONN TX ACK DLY TIMEOUT ---------- */
-    timeout_tick = (timeout_ms * NET_TMR_TIME_TICK_PER_SEC) / DEF_TIME_NBR_mS_PER_SEC;
-    if (timeout_tick < 1) {                                     /* If < 1 tick, ...                                     */
-        timeout_tick = 1u;                                      /* ... set at least 1 tick (see Note #3b).              */
+                                                                /* -------------- CFG TCP CONN TX CORK EN ------------- */
+    p_conn   = &NetTCP_ConnTbl[conn_id_tcp];
+    tx_flush =  DEF_NO;
+    if ((p_conn->TxCorkEn == DEF_ENABLED) &&                    /* If uncork'd ...                                      */
+        (cork_en          == DEF_DISABLED)) {
+        if (p_conn->TxQ_Head != DEF_NULL) {                     /* ... with held data, ...                              */
+            switch (p_conn->ConnState) {
+                case NET_TCP_CONN_STATE_CONN:
+                case NET_TCP_CONN_STATE_CLOSE_WAIT:
+                     tx_flush = DEF_YES;                        /* ... flush tx Q (see Note #3a).                       */
+                     break;
+
+
+                default:
+                     break;
+            }
+        }
     }
 
-    p_conn                       = &NetTCP_ConnTbl[conn_id_tcp];
-    p_conn->TxAckDlyTimeout_ms   =  timeout_ms;
-    p_conn->TxAckDlyTimeout_tick =  timeout_tick;
+    p_conn->TxCorkEn = cork_en;
+
+
+                                                                /* ------------------ FLUSH TCP TX Q ------------------ */
+    if (tx_flush == DEF_YES) {
+        p_conn->TxCorkFlush = DEF_YES;
+        NetTCP_TxConnTxQ(p_conn, DEF_NULL, NET_TCP_CONN_TX_ACK_NONE, DEF_NO, NET_TCP_CONN_CLOSE_ALL, DEF_NO, &err);
+        p_conn->TxCorkFlush = DEF_NO;                           /* See Note #3b.                                        */
+    }
 
 
    *p_err =  NET_TCP_ERR_NONE;
@@ -8001,6 +9170,7 @@ static  void  NetTCP_RxPktValidateOpt (NET_BUF_HDR  *p_buf_hdr,
     CPU_INT08U    opt_list_len_rem;
     CPU_INT08U    opt_len;
     CPU_INT08U    opt_nbr_max_seg_size;
+    CPU_INT16U    opt_ix;
     CPU_BOOLEAN   opt_err;
     CPU_BOOLEAN   opt_list_end;
 
@@ -8064,15 +9234,52 @@ static  void  NetTCP_RxPktValidateOpt (NET_BUF_HDR  *p_buf_hdr,
                  opt_nbr_max_seg_size++;
 
                  opt_err = NetTCP_RxPktValidateOptMaxSegSize(p_buf_hdr, p_opts, &opt_len, p_err);
+                 break;
+
+
+            case NET_TCP_HDR_OPT_WIN_SCALE:                     /* ------------------ WIN SCALE OPT ------------------- */
+                 if (opt_list_end != DEF_NO) {                  /* If opt found AFTER end of opt list, rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_END;
+                     return;
+                 }
+                 opt_err = NetTCP_RxPktValidateOptWinScale(p_buf_hdr, p_opts, &opt_len, p_err);
+                 break;
+
+
+            case NET_TCP_HDR_OPT_SACK_PERMIT:                   /* ----------------- SACK PERMIT OPT ------------------ */
+                 if (opt_list_end != DEF_NO) {                  /* If opt found AFTER end of opt list, rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_END;
+                     return;
+                 }
+                 opt_err = NetTCP_RxPktValidateOptSACK_Permit(p_buf_hdr, p_opts, &opt_len, p_err);
+                 break;
+
+
+            case NET_TCP_HDR_OPT_SACK:                          /* --------------------- SACK OPT --------------------- */
+                 if (opt_list_end != DEF_NO) {                  /* If opt found AFTER end of opt list, rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_END;
+                     return;
+                 }
+                 opt_ix  = (CPU_INT16U)(p_opts - (CPU_INT08U *)p_tcp_hdr);
+                 opt_err =  NetTCP_RxPktValidateOptSACK(p_buf_hdr, p_opts, opt_ix, &opt_len, p_err);
+                 break;
+
+
+            case NET_TCP_HDR_OPT_TS:                            /* ---------------------- TS OPT ---------------------- */
+                 if (opt_list_end != DEF_NO) {                  /* If opt found AFTER end of opt list, rtn err.         */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_END;
+                     return;
+                 }
+                 opt_err = NetTCP_RxPktValidateOptTS(p_buf_hdr, p_opts, &opt_len, p_err);
                  break;
                                                                 /* --------------- UNSUPPORTED TCP OPTS --------------- */
                                                                 /* See Notes #1b & #2b2.                                */
-            case NET_TCP_HDR_OPT_WIN_SCALE:
-            case NET_TCP_HDR_OPT_SACK_PERMIT:
-            case NET_TCP_HDR_OPT_SACK:
             case NET_TCP_HDR_OPT_ECHO_REQ:
             case NET_TCP_HDR_OPT_ECHO_REPLY:
-            case NET_TCP_HDR_OPT_TS:
             default:                                            /* ----------------- INVALID TCP OPTS ----------------- */
                  opt_len = *(p_opts + 1);                       /* Ignore unknown opts      (see Note #2b2).            */
                  if (opt_len < NET_TCP_HDR_OPT_LEN_MIN_LEN) {   /* If opt len < min opt len (see Note #2b3), rtn err.   */
@@ -8164,15 +9371,250 @@ static  CPU_BOOLEAN  NetTCP_RxPktValidateOptMaxSegSize (NET_BUF_HDR  *p_buf_hdr,
     p_opt++;
     max_seg_size  += *p_opt;
 
-    if (max_seg_size > NET_TCP_MAX_SEG_SIZE_MAX) {              /* If max seg size > max, rtn err.                      */
+    if (max_seg_size > NET_TCP_MAX_SEG_SIZE_MAX) {              /* If max seg size > max, rtn err.                      */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+       *p_err =  NET_TCP_ERR_INVALID_OPT_LEN;
+        return (DEF_YES);
+    }
+
+    p_buf_hdr->TCP_MaxSegSize = max_seg_size;
+
+   *p_err                     = NET_TCP_ERR_NONE;
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_RxPktValidateOptWinScale()
+*
+* Description : Validate & process received TCP Window Scale option.
+*
+* Argument(s) : p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               --------    Argument validated in NetTCP_Rx().
+*
+*               p_opt        Pointer to Window Scale option.
+*               ----        Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP option length (in octets).
+*               --------    Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP option validated & processed.
+*                               NET_TCP_ERR_INVALID_OPT_LEN     Invalid TCP option length.
+*
+* Return(s)   : DEF_NO,  NO Window Scale option error.
+*
+*               DEF_YES, otherwise.
+*
+* Caller(s)   : NetTCP_RxPktValidateOpt().
+*
+* Note(s)     : (1) RFC #7323, Section 2.3 states that if "a Window Scale option is received with a shift.cnt
+*                   value larger than 14, the TCP SHOULD log the error but MUST use 14 instead of the
+*                   specified value".
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetTCP_RxPktValidateOptWinScale (NET_BUF_HDR  *p_buf_hdr,
+                                                      CPU_INT08U   *p_opt,
+                                                      CPU_INT08U   *p_opt_len,
+                                                      NET_ERR      *p_err)
+{
+    CPU_INT08U  shift;
+
+
+   *p_opt_len = NET_TCP_HDR_OPT_LEN_WIN_SCALE;
+
+    if (p_opt[1] != *p_opt_len) {                               /* If opt len != win scale opt len, rtn err.            */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_LEN;
+        return (DEF_YES);
+    }
+
+    shift = p_opt[2];
+    if (shift > NET_TCP_OPT_WIN_SCALE_SHIFT_MAX) {              /* Lim shift (see Note #1).                             */
+        shift = NET_TCP_OPT_WIN_SCALE_SHIFT_MAX;
+    }
+
+    p_buf_hdr->TCP_WinScale  = shift;
+    DEF_BIT_SET(p_buf_hdr->TCP_OptFlags, NET_TCP_OPT_EN_WIN_SCALE);
+
+   *p_err                    = NET_TCP_ERR_NONE;
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                 NetTCP_RxPktValidateOptSACK_Permit()
+*
+* Description : Validate & process received TCP SACK Permitted option.
+*
+* Argument(s) : p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               --------    Argument validated in NetTCP_Rx().
+*
+*               p_opt        Pointer to SACK Permitted option.
+*               ----        Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP option length (in octets).
+*               --------    Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP option validated & processed.
+*                               NET_TCP_ERR_INVALID_OPT_LEN     Invalid TCP option length.
+*
+* Return(s)   : DEF_NO,  NO SACK Permitted option error.
+*
+*               DEF_YES, otherwise.
+*
+* Caller(s)   : NetTCP_RxPktValidateOpt().
+*
+* Note(s)     : (1) SACK Permitted option flags SACK offered in the received segment; the SACK option
+*                   is enabled on the connection by NetTCP_ConnOptNegotiate().
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetTCP_RxPktValidateOptSACK_Permit (NET_BUF_HDR  *p_buf_hdr,
+                                                         CPU_INT08U   *p_opt,
+                                                         CPU_INT08U   *p_opt_len,
+                                                         NET_ERR      *p_err)
+{
+   *p_opt_len = NET_TCP_HDR_OPT_LEN_SACK_PERMIT;
+
+    if (p_opt[1] != *p_opt_len) {                               /* If opt len != SACK permit opt len, rtn err.          */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_LEN;
+        return (DEF_YES);
+    }
+
+    DEF_BIT_SET(p_buf_hdr->TCP_OptFlags, NET_TCP_OPT_EN_SACK);  /* See Note #1.                                         */
+
+   *p_err = NET_TCP_ERR_NONE;
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_RxPktValidateOptSACK()
+*
+* Description : Validate & process received TCP SACK option.
+*
+* Argument(s) : p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               --------    Argument validated in NetTCP_Rx().
+*
+*               p_opt        Pointer to SACK option.
+*               ----        Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               opt_ix       Index of SACK option from the start of the TCP header.
+*
+*               p_opt_len    Pointer to variable that will receive the TCP option length (in octets).
+*               --------    Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP option validated & processed.
+*                               NET_TCP_ERR_INVALID_OPT_LEN     Invalid TCP option length.
+*
+* Return(s)   : DEF_NO,  NO SACK option error.
+*
+*               DEF_YES, otherwise.
+*
+* Caller(s)   : NetTCP_RxPktValidateOpt().
+*
+* Note(s)     : (1) The SACK blocks are NOT copied; only their location & number are saved so that
+*                   NetTCP_RxPktConnHandlerOpt() may decode them once the segment has been validated for
+*                   its connection.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetTCP_RxPktValidateOptSACK (NET_BUF_HDR  *p_buf_hdr,
+                                                  CPU_INT08U   *p_opt,
+                                                  CPU_INT16U    opt_ix,
+                                                  CPU_INT08U   *p_opt_len,
+                                                  NET_ERR      *p_err)
+{
+    CPU_INT08U  blk_nbr;
+
+
+   *p_opt_len = p_opt[1];
+    if ((*p_opt_len < (NET_TCP_HDR_OPT_LEN_MIN_LEN + NET_TCP_OPT_SACK_BLK_SIZE)) ||
+       (((*p_opt_len - NET_TCP_HDR_OPT_LEN_MIN_LEN) % NET_TCP_OPT_SACK_BLK_SIZE) != 0u)) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_LEN;
+        return (DEF_YES);
+    }
+
+    blk_nbr = (*p_opt_len - NET_TCP_HDR_OPT_LEN_MIN_LEN) / NET_TCP_OPT_SACK_BLK_SIZE;
+    if (blk_nbr > NET_TCP_OPT_SACK_BLK_NBR_MAX) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_LEN;
+        return (DEF_YES);
+    }
+                                                                /* Save SACK blks' location (see Note #1).              */
+    p_buf_hdr->TCP_SACK_OptIx  = opt_ix;
+    p_buf_hdr->TCP_SACK_BlkNbr = blk_nbr;
+
+   *p_err                      = NET_TCP_ERR_NONE;
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_RxPktValidateOptTS()
+*
+* Description : Validate & process received TCP Timestamp option.
+*
+* Argument(s) : p_buf_hdr    Pointer to network buffer header that received TCP packet.
+*               --------    Argument validated in NetTCP_Rx().
+*
+*               p_opt        Pointer to Timestamp option.
+*               ----        Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP option length (in octets).
+*               --------    Argument validated in NetTCP_RxPktValidateOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP option validated & processed.
+*                               NET_TCP_ERR_INVALID_OPT_LEN     Invalid TCP option length.
+*
+* Return(s)   : DEF_NO,  NO Timestamp option error.
+*
+*               DEF_YES, otherwise.
+*
+* Caller(s)   : NetTCP_RxPktValidateOpt().
+*
+* Note(s)     : (1) Since TCP options are NOT required or guaranteed to align multi-octet words on
+*                   appropriate word boundaries, timestamp values are read with unaligned-safe macro's.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  NetTCP_RxPktValidateOptTS (NET_BUF_HDR  *p_buf_hdr,
+                                                CPU_INT08U   *p_opt,
+                                                CPU_INT08U   *p_opt_len,
+                                                NET_ERR      *p_err)
+{
+   *p_opt_len = NET_TCP_HDR_OPT_LEN_TS;
+
+    if (p_opt[1] != *p_opt_len) {                               /* If opt len != TS opt len, rtn err.                   */
         NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
-       *p_err =  NET_TCP_ERR_INVALID_OPT_LEN;
+       *p_err = NET_TCP_ERR_INVALID_OPT_LEN;
         return (DEF_YES);
     }
+                                                                /* Get TS val & echo reply (see Note #1).               */
+    p_buf_hdr->TCP_TS_Val       = (NET_TS_MS)NET_UTIL_VAL_GET_NET_32(&p_opt[2]);
+    p_buf_hdr->TCP_TS_EchoReply = (NET_TS_MS)NET_UTIL_VAL_GET_NET_32(&p_opt[6]);
+    DEF_BIT_SET(p_buf_hdr->TCP_OptFlags, NET_TCP_OPT_EN_TS);
 
-    p_buf_hdr->TCP_MaxSegSize = max_seg_size;
-
-   *p_err                     = NET_TCP_ERR_NONE;
+   *p_err = NET_TCP_ERR_NONE;
 
     return (DEF_NO);
 }
@@ -8988,6 +10430,148 @@ static  void  NetTCP_RxPktConnHandler (NET_BUF      *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                    NetTCP_RxPktConnHandlerOpt()
+*
+* Description : (1) Handle received packet's TCP options for a synchronized TCP connection :
+*
+*                   (a) Scale received window size by remote host's window scale      See Note #2a
+*                   (b) Update most recent timestamp to echo to remote host           See Note #2b
+*                   (c) Mark re-transmit queue segments reported by SACK blocks       See Note #2c
+*
+*
+* Argument(s) : p_conn       Pointer to TCP connection.
+*               ------      Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_buf        Pointer to network buffer that received TCP packet.
+*               -----       Argument checked   in NetTCP_Rx().
+*
+*               p_buf_hdr    Pointer to network buffer header.
+*               ---------   Argument validated in NetTCP_Rx().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerSeg().
+*
+* Note(s)     : (2) (a) RFC #7323, Section 2.3 states that "the window field in a segment where the SYN bit
+*                       is set ... MUST NOT be scaled".  Since TCP windows are 16-bit, scaled windows are
+*                       limited to the maximum window size (see 'net_tcp.h  TCP OPTION ENABLE DEFINES
+*                       Note #1c1').
+*
+*                   (b) RFC #7323, Section 4.3 states that "if SEG.TSval >= TS.Recent and SEG.SEQ <=
+*                       Last.ACK.sent then SEG.TSval is copied to TS.Recent".  Since PAWS is NOT enforced,
+*                       the timestamp value is NOT compared to the most recent timestamp.
+*
+*                   (c) (1) RFC #2018, Section 8 states that "the data receiver is permitted to discard
+*                           data in its queue that has not been acknowledged to the data sender, even
+*                           if the data has already been reported in a SACK option".
+*
+*                       (2) SACK'd segments are therefore NOT removed from the re-transmit queue; they
+*                           are only skipped by NetTCP_TxConnReTxQ_SACK().
+*
+*               (3) Synchronization segments' options are handled by NetTCP_ConnOptNegotiate().
+*
+*               (4) RFC #7323, Section 4.3 states that TS.Recent is updated only from a segment that "is
+*                   acceptable".  Options are therefore handled ONLY after the connection state handler
+*                   has validated the segment (see 'NetTCP_RxPktConnHandlerSeg()  Note #9'), so that an
+*                   out-of-window or otherwise invalid segment updates neither the most recent timestamp
+*                   nor the SACK'd re-transmit queue segments.
+*********************************************************************************************************
+*/
+
+static  void  NetTCP_RxPktConnHandlerOpt (NET_TCP_CONN  *p_conn,
+                                          NET_BUF       *p_buf,
+                                          NET_BUF_HDR   *p_buf_hdr)
+{
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+    CPU_INT32U        win_size;
+#endif
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    CPU_INT08U       *p_blk;
+    NET_BUF          *p_buf_q;
+    NET_BUF_HDR      *p_buf_q_hdr;
+    NET_TCP_SEQ_NBR   left_edge;
+    NET_TCP_SEQ_NBR   blk_len;
+    NET_TCP_SEQ_NBR   seq_delta;
+    NET_TCP_SEQ_NBR   seq_delta_next;
+    CPU_INT08U        blk_ix;
+#endif
+    CPU_BOOLEAN       opt_en;
+    CPU_BOOLEAN       opt_rxd;
+
+
+    if (p_conn->OptEn == NET_TCP_OPT_EN_NONE) {                 /* If NO opts en'd on conn, ...                         */
+        return;                                                 /* ... nothing to handle.                               */
+    }
+
+    if (p_buf_hdr->TCP_SegSync != DEF_NO) {                     /* See Note #3.                                         */
+        return;
+    }
+
+   (void)&p_buf;                                                /* Prevent possible 'variable unused' warning.          */
+   (void)&opt_en;
+   (void)&opt_rxd;
+
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)                   /* ------------------ SCALE RX'D WIN ------------------ */
+    opt_en = DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_WIN_SCALE);
+    if ((opt_en                   == DEF_YES) &&
+        (p_conn->TxWinScaleRemote >  0u     )) {
+        win_size = (CPU_INT32U)p_buf_hdr->TCP_WinSize << p_conn->TxWinScaleRemote;
+        if (win_size > NET_TCP_WIN_SIZE_MAX) {                  /* Lim scaled win size (see Note #2a).                  */
+            win_size = NET_TCP_WIN_SIZE_MAX;
+        }
+        p_buf_hdr->TCP_WinSize = (NET_TCP_WIN_SIZE)win_size;
+    }
+#endif
+
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)                          /* ------------------ UPDATE RECENT TS ---------------- */
+    opt_en  = DEF_BIT_IS_SET(p_conn->OptEn,         NET_TCP_OPT_EN_TS);
+    opt_rxd = DEF_BIT_IS_SET(p_buf_hdr->TCP_OptFlags, NET_TCP_OPT_EN_TS);
+    if ((opt_en  == DEF_YES) &&
+        (opt_rxd == DEF_YES)) {
+                                                                /* If seg covers last ack tx'd, save TS (see Note #2b). */
+        if ((NET_TCP_SEQ_NBR)(p_conn->TS_LastAckSent - p_buf_hdr->TCP_SeqNbr) <= p_buf_hdr->TCP_SegLen) {
+            p_conn->TS_Recent = p_buf_hdr->TCP_TS_Val;
+        }
+    }
+#endif
+
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)                        /* ------------------ HANDLE SACK BLKS ---------------- */
+    opt_en = DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_SACK);
+    if ((opt_en                     == DEF_YES) &&
+        (p_buf_hdr->TCP_SACK_BlkNbr >  0u     )) {
+
+        p_blk = &p_buf->DataPtr[p_buf_hdr->TransportHdrIx  +
+                                p_buf_hdr->TCP_SACK_OptIx  +
+                                NET_TCP_HDR_OPT_LEN_MIN_LEN];
+
+        for (blk_ix = 0u; blk_ix < p_buf_hdr->TCP_SACK_BlkNbr; blk_ix++) {
+            left_edge = (NET_TCP_SEQ_NBR)NET_UTIL_VAL_GET_NET_32(p_blk);
+            blk_len   = (NET_TCP_SEQ_NBR)NET_UTIL_VAL_GET_NET_32(p_blk + sizeof(NET_TCP_SEQ_NBR)) - left_edge;
+            p_blk    +=  NET_TCP_OPT_SACK_BLK_SIZE;
+                                                                /* Mark ALL re-tx Q segs fully in blk (see Note #2c).   */
+            p_buf_q   =  p_conn->ReTxQ_Head;
+            while (p_buf_q != DEF_NULL) {
+                p_buf_q_hdr    = &p_buf_q->Hdr;
+                seq_delta      =  p_buf_q_hdr->TCP_SeqNbr - left_edge;
+                seq_delta_next =  seq_delta + p_buf_q_hdr->TCP_SegLen;
+                if ((seq_delta      <= blk_len) &&
+                    (seq_delta_next <= blk_len) &&
+                    (seq_delta      <= seq_delta_next)) {
+                    DEF_BIT_SET(p_buf_q_hdr->Flags, NET_BUF_FLAG_TX_SACKD);
+                }
+                p_buf_q = p_buf_q_hdr->NextPrimListPtr;
+            }
+        }
+    }
+#endif
+}
+
+
 /*
 *********************************************************************************************************
 *                                   NetTCP_RxPktConnHandlerListen()
@@ -9515,6 +11099,8 @@ static  void  NetTCP_RxPktConnHandlerListen (NET_TCP_CONN  *p_conn,
                                      ?  p_buf_hdr->TCP_MaxSegSize
                                      :  mss_dflt_tx;
 
+    NetTCP_ConnOptNegotiate(p_conn_tx_sync, p_buf_hdr);         /* Negotiate opts offered by remote host.               */
+
     state                     = p_conn_tx_sync->ConnState;
     p_conn_tx_sync->ConnState = NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE;
 
@@ -10327,6 +11913,8 @@ static  void  NetTCP_RxPktConnHandlerSyncTxd (NET_TCP_CONN  *p_conn,
                              ?  p_buf_hdr->TCP_MaxSegSize
                              :  mss_dflt_tx;
 
+    NetTCP_ConnOptNegotiate(p_conn, p_buf_hdr);                 /* Negotiate opts accepted/offered by remote host.      */
+
 
                                                                 /* ----------------- HANDLE RX'D SEG ------------------ */
     NetTCP_RxPktConnHandlerSeg(p_conn, ack_code, p_buf, p_buf_hdr, &err_rtn);
@@ -14280,12 +15868,13 @@ static  void  NetTCP_RxPktConnHandlerLastAck (NET_TCP_CONN  *p_conn,
 *
 * Description : (1) Handle TCP connection's received segments :
 *
-*                   (a) Update TCP connection    transmit remote window                     See Note  #6
-*                   (b) Update TCP connection controls on transition to connected state(s)
-*                   (c) Handle TCP connection re-transmit queue                             See Notes #2b & #5
-*                   (d) Update TCP connection    transmit congestion controls               See Note  #7
-*                   (e) Handle TCP connection    receive  queue(s)                          See Note  #3
-*                   (f) Handle TCP connection    receive  data                              See Notes #2a & #3
+*                   (a) Handle TCP connection    received options                           See Note  #9
+*                   (b) Update TCP connection    transmit remote window                     See Note  #6
+*                   (c) Update TCP connection controls on transition to connected state(s)
+*                   (d) Handle TCP connection re-transmit queue                             See Notes #2b & #5
+*                   (e) Update TCP connection    transmit congestion controls               See Note  #7
+*                   (f) Handle TCP connection    receive  queue(s)                          See Note  #3
+*                   (g) Handle TCP connection    receive  data                              See Notes #2a & #3
 *
 *
 * Argument(s) : p_conn       Pointer to a TCP connection.
@@ -14410,6 +15999,12 @@ static  void  NetTCP_RxPktConnHandlerLastAck (NET_TCP_CONN  *p_conn,
 *               (8) Some  transitory errors were ignored &/or not returned from previous handler function(s).
 *                   These transitory errors are included for completeness & as an extra precaution in case
 *                   these transitory errors are returned by handler function(s).
+*
+*               (9) Received options are handled ONLY once the segment's sequence, reset & acknowledgement
+*                   numbers have been validated by the connection state handler, & prior to any use of the
+*                   received window or of the re-transmit queue.
+*
+*                   See also 'NetTCP_RxPktConnHandlerOpt()  Note #4'.
 *********************************************************************************************************
 */
 
@@ -14422,6 +16017,9 @@ static  void  NetTCP_RxPktConnHandlerSeg (NET_TCP_CONN      *p_conn,
     NET_ERR  err_rtn;
 
 
+                                                                /* ---------------- HANDLE RX'D OPTS ------------------ */
+    NetTCP_RxPktConnHandlerOpt(p_conn, p_buf, p_buf_hdr);       /* See Note #9.                                         */
+
 
     switch (p_conn->ConnState) {
         case NET_TCP_CONN_STATE_FREE:
@@ -15403,6 +17001,8 @@ static  void  NetTCP_RxPktConnHandlerRxQ_Conn (NET_TCP_CONN  *p_conn,
                      (seq_unordered_cur  == DEF_YES)) ? DEF_YES : DEF_NO;
 
     if (seq_unordered != DEF_NO) {                              /* If out-of-order seg(s) rx'd   (see Note #5a) ...     */
+                                                                /* ... save last q'd seq for SACK blk order      ...    */
+        p_conn->RxSACK_SeqNbrLast = p_buf_hdr->TCP_SeqNbr;      /* ... [see 'NetTCP_TxConnOptPrepare()  Note #3b'];     */
         if (p_conn->RxQ_State != NET_TCP_RX_Q_STATE_SYNC) {     /* ... in non-sync state,                       ...     */
                                                                 /* ... req immed TCP conn ack tx (see Note #5c).        */
             p_buf_hdr->TCP_SegAckTxReqCode = NET_TCP_CONN_TX_ACK_IMMED;
@@ -16323,6 +17923,13 @@ static  void  NetTCP_RxPktConnHandlerTxWinRemote (NET_TCP_CONN      *p_conn,
 *
 *                       See also 'NetTCP_TxConnReTxQ()  Note #2b1A'.
 *
+*                   (c) RFC #7323, Section 4.1 states that "when timestamps are used, every segment ...
+*                       provides an RTT sample" since the echoed timestamp identifies the transmission
+*                       being acknowledged, which removes the ambiguity that Karn's algorithm guards
+*                       against (see Note #8a2).  Thus when the Timestamp option is negotiated & the
+*                       acknowledgement echoes a timestamp, the RTT is sampled from the echoed timestamp,
+*                       even if segment(s) were re-transmitted.
+*
 *               (9) RFC #793 does NOT provide nor suggest any logic to determine/handle sequence number
 *                   comparisons for sequence number windows that overflow the sequence number space.
 *
@@ -16389,6 +17996,7 @@ static  void  NetTCP_RxPktConnHandlerReTxQ (NET_TCP_CONN      *p_conn,
     CPU_BOOLEAN            seqs_ackd                  = DEF_NO;
     CPU_BOOLEAN            done                       = DEF_NO;
     CPU_BOOLEAN            tmr_update                 = DEF_NO;
+    CPU_BOOLEAN            ts_rtt                     = DEF_NO;
     NET_BUF               *p_buf_q                    = DEF_NULL;
     NET_BUF               *p_buf_q_head               = DEF_NULL;
     NET_BUF               *p_buf_q_prev               = DEF_NULL;
@@ -16634,7 +18242,20 @@ static  void  NetTCP_RxPktConnHandlerReTxQ (NET_TCP_CONN      *p_conn,
 
                                                                 /* --------------- UPDATE TCP CONN RTO ---------------- */
     if (seqs_ackd == DEF_YES) {                                 /* If ANY  re-tx Q seq(s) ack'd                     ..  */
-        if (segs_re_txd == DEF_NO) {                            /* .. & NO re-tx Q seg(s) re-tx'd (see Note #8a2);  ..  */
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+        if ((DEF_BIT_IS_SET(p_conn->OptEn,            NET_TCP_OPT_EN_TS) == DEF_YES) &&
+            (DEF_BIT_IS_SET(p_buf_hdr->TCP_OptFlags,  NET_TCP_OPT_EN_TS) == DEF_YES) &&
+            (p_buf_hdr->TCP_TS_EchoReply != NET_TCP_TX_RTT_TS_NONE)) {
+            ts_rtt = DEF_YES;
+        }
+#endif
+
+        if (ts_rtt == DEF_YES) {                                /* .. & TS echo rx'd, calc RTT from TS (see Note #8c).  */
+            seg_rtt_ts_txd_ms = (NET_TCP_TX_RTT_TS_MS)p_buf_hdr->TCP_TS_EchoReply;
+            seg_rtt_ts_rxd_ms =  p_buf_hdr->TCP_RTT_TS_Rxd_ms;
+            NetTCP_TxConnRTT_RTO_Calc(p_conn, NET_TCP_CONN_TX_RTT_RTO_CALC, seg_rtt_ts_txd_ms, seg_rtt_ts_rxd_ms);
+
+        } else if (segs_re_txd == DEF_NO) {                     /* .. & NO re-tx Q seg(s) re-tx'd (see Note #8a2);  ..  */
                                                                 /* ..   get tx'd seg RTT ts       (see Note #8a1A1) ..  */
             p_buf_q_head_hdr  = &p_buf_q_head->Hdr;
             seg_rtt_ts_txd_ms =  p_buf_q_head_hdr->TCP_RTT_TS_Txd_ms;
@@ -19807,7 +21428,7 @@ static  void  NetTCP_TxConnWinSizeCongSet (NET_TCP_CONN      *p_conn,
 *
 *                           (B) However, since TCP connection transmit congestion controls are
 *                               updated following any TCP connection re-transmit queue handling
-*                               (see 'NetTCP_RxPktConnHandlerSeg()  Notes #1c & #1d'); the saved
+*                               (see 'NetTCP_RxPktConnHandlerSeg()  Notes #1d & #1e'); the saved
 *                               previous value of the TCP connection's last unacknowledged
 *                               transmit sequence number ('TxSeqNbrUnackdPrev') MUST be used
 *                               (see 'NetTCP_RxPktConnHandlerReTxQ()  Note #4').
@@ -20498,8 +22119,13 @@ static  void  NetTCP_TxConnWinSizeZeroWinTimeout (void  *p_conn_timeout)
 *               NetTCP_RxPktConnHandlerListen(),
 *               NetTCP_RxPktConnHandlerSyncTxd().
 *
-* Note(s)     : (4) RFC #1122, Section 4.2.2.6 states that a "TCP SHOULD send an MSS (Maximum Segment Size)
-*                   option in every SYN segment".
+* Note(s)     : (4) (a) RFC #1122, Section 4.2.2.6 states that a "TCP SHOULD send an MSS (Maximum Segment
+*                       Size) option in every SYN segment".
+*
+*                   (b) The Window Scale, SACK-Permitted & Timestamp options are offered only if enabled on
+*                       the TCP connection.  An active open offers all the connection's configured options;
+*                       a reply to a remote host's synchronization segment offers only the options already
+*                       negotiated by NetTCP_ConnOptNegotiate() (see 'NetTCP_TxConnOptPrepare()  Note #2a').
 *
 *               (5) Network resources MUST be appropriately allocated/deallocated :
 *
@@ -20568,8 +22194,8 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
     NET_TCP_WIN_SIZE               win_size;
     NET_PROTOCOL_TYPE              protocol;
     CPU_INT16U                     payload_max;
-    NET_TCP_OPT_CFG_MAX_SEG_SIZE  *p_opt_cfg_max_seg_size;
-    NET_TCP_OPT_CFG_MAX_SEG_SIZE   opt_cfg_max_seg_size;
+    void                          *p_opt_cfg;
+    NET_TCP_TX_OPT                 tx_opt;
     NET_TCP_FLAGS                  flags_tcp;
     NET_PROTOCOL_TYPE              proto_type = NET_PROTOCOL_TYPE_NONE;
     NET_ERR                        err;
@@ -20647,9 +22273,19 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
 
     }
 
+    if (state == NET_TCP_CONN_STATE_CLOSED) {                   /* For active open, offer cfg'd opts (see Note #4b).    */
+        p_conn->OptEn = p_conn->OptCfgd;
+    }
+
     data_ix = 0u;
 
-    NetTCP_GetTxDataIx(if_nbr, proto_type, 4u, data_len, p_conn, &data_ix, p_err);
+    NetTCP_GetTxDataIx(if_nbr,
+                       proto_type,
+                       NetTCP_TxConnOptLenGet(p_conn, DEF_YES, DEF_NO),
+                       data_len,
+                       p_conn,
+                      &data_ix,
+                       p_err);
     pseg_sync = NetBuf_Get(if_nbr, NET_TRANSACTION_TX, data_len, data_ix, &data_ix_offset, NET_BUF_FLAG_NONE, &err);
     if ( err != NET_BUF_ERR_NONE) {                             /* See Note #5b1.                                       */
        *p_err  = NET_TCP_ERR_NONE_AVAIL;
@@ -20738,7 +22374,7 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
 
 
 
-                                                                /* Prepare TCP max seg size opt (see Note #4).          */
+                                                                /* Prepare TCP max seg size opt (see Note #4a).         */
                                                                 /* Get IF's MTU's.                                      */
     if (DEF_BIT_IS_CLR(pseg_sync_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
         protocol = NET_PROTOCOL_TYPE_TCP_V4;
@@ -20754,11 +22390,8 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
 
                                                                 /* Calc TCP conn's local max seg size.                  */
     p_conn->MaxSegSizeLocalActual      =  payload_max;
-
-    p_opt_cfg_max_seg_size             = &opt_cfg_max_seg_size;
-    p_opt_cfg_max_seg_size->Type       =  NET_TCP_OPT_TYPE_MAX_SEG_SIZE;
-    p_opt_cfg_max_seg_size->MaxSegSize =  p_conn->MaxSegSizeLocalActual;
-    p_opt_cfg_max_seg_size->NextOptPtr =  DEF_NULL;
+                                                                /* Prepare TCP sync opts (see Note #4b).                */
+    p_opt_cfg = NetTCP_TxConnOptPrepare(p_conn, &tx_opt, ack_nbr, DEF_YES, DEF_NO);
 
     if (DEF_BIT_IS_CLR(pseg_sync_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
 #ifdef  NET_IPv4_MODULE_EN
@@ -20862,7 +22495,7 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
                                 (NET_IPv4_TTL    )TTL,
                                 (NET_TCP_FLAGS   )flags_tcp,
                                 (NET_IPv4_FLAGS  )flags_ipv4,
-                                (void           *)p_opt_cfg_max_seg_size,
+                                (void           *)p_opt_cfg,
                                 (void           *)0,            /* See Note #7.                                         */
                                 (NET_ERR        *)p_err);
 #endif
@@ -20880,7 +22513,7 @@ static  void  NetTCP_TxConnSync (NET_TCP_CONN        *p_conn,
                                 (NET_IPv6_FLOW_LABEL   ) flow_label,
                                 (NET_IPv6_HOP_LIM      ) hop_lim,
                                 (NET_TCP_FLAGS         ) flags_tcp,
-                                (void                 *) p_opt_cfg_max_seg_size,
+                                (void                 *) p_opt_cfg,
                                 (NET_ERR              *) p_err);
 #endif
     }
@@ -21152,7 +22785,7 @@ static  void  NetTCP_TxConnClose (NET_TCP_CONN        *p_conn,
         data_ix = 0u;
         NetTCP_GetTxDataIx(if_nbr,
                            proto_type,
-                           0u,
+                           NetTCP_TxConnOptLenGet(p_conn, DEF_NO, DEF_NO),
                            data_len,
                            p_conn,
                           &data_ix,
@@ -21668,6 +23301,17 @@ static  void  NetTCP_TxConnClose (NET_TCP_CONN        *p_conn,
 *                   (b) However, if NO network timer is available to delay the acknowledgement, the TCP
 *                       connection acknowledgement SHOULD be immediately transmitted.
 *
+*                   (c) (1) After the receive direction has been idle, the next few data segments are
+*                           acknowledged immediately (see 'net_tcp.h  TCP CONGESTION CONTROL DEFINES
+*                           Note #6c').
+*
+*                       (2) For request/response traffic (see 'net_tcp.h  TCP CONGESTION CONTROL DEFINES
+*                           Note #6d'), acknowledgements for pushed segments are delayed instead so that
+*                           RFC #793's "piggybacked" acknowledgement (see Note #4a2B) rides on the reply.
+*
+*                       (3) A delayed acknowledgement timeout shows that NO reply followed; request/response
+*                           detection restarts so that pushed segments are again immediately acknowledged.
+*
 *               (7) (a) (1) RFC #1122, Section 4.2.2.14 states that "a careless implementation can send
 *                           two or more acknowledgment segments per data segment received".
 *
@@ -21713,7 +23357,8 @@ static  void  NetTCP_TxConnClose (NET_TCP_CONN        *p_conn,
 *                       the TOS used for ACK segments." #### NET-807
 *
 *                   (b) (1) IP  transmit options currently NOT implemented     See 'net_tcp.c  Note #1d'
-*                       (2) TCP transmit options currently NOT implemented     See 'net_tcp.c  Note #1c'
+*                       (2) TCP transmit options, including SACK blocks for any out-of-order segments
+*                           queued to the transport receive queue, are prepared by NetTCP_TxConnOptPrepare().
 *
 *                       See also 'NetTCP_TxPktHandler()  Note #2'.
 *
@@ -21752,6 +23397,8 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
     CPU_BOOLEAN              tx_ack;
     CPU_BOOLEAN              tmr_free;
     CPU_BOOLEAN              push_avail;
+    void                    *p_opt_cfg;
+    NET_TCP_TX_OPT           tx_opt;
     NET_TMR_TICK             timeout_tick;
     NET_BUF_SIZE             data_len;
     NET_BUF_SIZE             data_ix;
@@ -21844,8 +23491,11 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                           push_avail = DEF_BIT_IS_SET(p_buf_hdr->TCP_HdrLen_Flags, NET_TCP_HDR_FLAG_PUSH);
                           if (push_avail == DEF_YES) {          /* If rx'd seg push'd & en'd, ..                        */
                               if (p_conn->TxAckImmedRxdPushEn != DEF_DISABLED) {
-                                  tx_ack  = DEF_YES;            /* .. tx TCP conn ack (see Note #4a4A1).                */
-                                  break;
+                                                                /* .. & NOT req/resp exchange (see Note #6c2), ..       */
+                                  if (p_conn->TxAckPingPongCtr < NET_TCP_ACK_PING_PONG_TH) {
+                                      tx_ack  = DEF_YES;        /* .. tx TCP conn ack (see Note #4a4A1).                */
+                                      break;
+                                  }
                               }
                           }
 
@@ -21871,8 +23521,16 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                           break;
                       }
 
+                      if (p_conn->TxAckQuickCnt > 0) {          /* If quick ack rem'ing ...                             */
+                          if (p_conn->TxAckPingPongCtr < NET_TCP_ACK_PING_PONG_TH) {
+                              p_conn->TxAckQuickCnt--;
+                              tx_ack = DEF_YES;                 /* ... & NOT req/resp exchange, tx TCP conn ack ...     */
+                              break;                            /* ... (see Note #6c1).                                 */
+                          }
+                      }
+
                       p_conn->TxAckDlyCnt++;                    /* If ack dly cnt >= th, ...                            */
-                      if (p_conn->TxAckDlyCnt >= NET_TCP_ACK_DLY_CNT_TH) {
+                      if (p_conn->TxAckDlyCnt >= p_conn->TxAckDlyCntTh) {
                           tx_ack = DEF_YES;                     /* ... tx TCP conn ack (see Note #6a1B).                */
                           break;
                       }
@@ -22004,7 +23662,8 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                  case NET_TCP_CONN_TX_ACK_TIMEOUT:
                       tx_ack   = DEF_YES;
                       tmr_free = DEF_NO;
-                      break;
+                      p_conn->TxAckPingPongCtr = 0u;            /* Ack NOT piggybacked; restart req/resp detection ...  */
+                      break;                                    /* ... (see Note #6c3).                                 */
 
 
                  default:
@@ -22089,7 +23748,7 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
 
     NetTCP_GetTxDataIx(if_nbr,
                        proto_type,
-                       0u,
+                       NetTCP_TxConnOptLenGet(p_conn, DEF_NO, DEF_YES),
                        data_len,
                        p_conn,
                       &data_ix,
@@ -22180,6 +23839,8 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
 
                                                                 /* Prepare TCP win size.                                */
     win_size  = p_conn->RxWinSizeActual;
+                                                                /* Prepare TCP opts     (see Note #9b2).                */
+    p_opt_cfg = NetTCP_TxConnOptPrepare(p_conn, &tx_opt, ack_nbr, DEF_NO, DEF_YES);
 
 
 
@@ -22240,7 +23901,7 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                                 TTL,
                                 flags_tcp,
                                 flags_ipv4,
-                                DEF_NULL,                       /* See Note #9b2.                                       */
+                                p_opt_cfg,                      /* See Note #9b2.                                       */
                                 DEF_NULL,                       /* See Note #9b1.                                       */
                                &err);                           /* Ignore transitory tx err(s).                         */
 #endif
@@ -22264,7 +23925,7 @@ static  void  NetTCP_TxConnAck (NET_TCP_CONN        *p_conn,
                                 flow_label,
                                 hop_lim,
                                 flags_tcp,
-                                DEF_NULL,
+                                p_opt_cfg,
                                 &err);
 
 #endif
@@ -23451,7 +25112,7 @@ static  void  NetTCP_TxConnReset (NET_TCP_CONN        *p_conn,
 *                       MUST be freed by appropriate function(s).
 *
 *               (5) (a) IP  transmit options currently NOT implemented     See 'net_tcp.c  Note #1d'
-*                   (b) TCP transmit options currently NOT implemented     See 'net_tcp.c  Note #1c'
+*                   (b) TCP transmit options prepared by NetTCP_TxConnOptPrepare().
 *********************************************************************************************************
 */
 
@@ -23493,6 +25154,8 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
     NET_TCP_WIN_SIZE         win_size;
     NET_TCP_FLAGS            flags_tcp;
     CPU_INT08U               probe_data[NET_TCP_DATA_LEN_TX_PROBE_DATA];
+    void                    *p_opt_cfg;
+    NET_TCP_TX_OPT           tx_opt;
     NET_PROTOCOL_TYPE        proto_type = NET_PROTOCOL_TYPE_NONE;
     NET_ERR                  err;
 
@@ -23588,7 +25251,7 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
 
     NetTCP_GetTxDataIx(if_nbr,
                        proto_type,
-                       0u,
+                       NetTCP_TxConnOptLenGet(p_conn, DEF_NO, DEF_NO),
                        data_len,
                        p_conn,
                       &data_ix,
@@ -23675,6 +25338,8 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
 
                                                                 /* Prepare TCP win size.                                */
     win_size  = p_conn->RxWinSizeActual;
+                                                                /* Prepare TCP opts.                                    */
+    p_opt_cfg = NetTCP_TxConnOptPrepare(p_conn, &tx_opt, ack_nbr, DEF_NO, DEF_NO);
 
                                                                 /* Prepare IP params.                                   */
     if (DEF_BIT_IS_CLR(pseg_probe_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
@@ -23737,7 +25402,7 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
                                (NET_IPv4_TTL    ) TTL,
                                (NET_TCP_FLAGS   ) flags_tcp,
                                (NET_IPv4_FLAGS  ) flags_ipv4,
-                               (void           *) 0,
+                               (void           *) p_opt_cfg,
                                (void           *) 0,            /* See Note #5.                                         */
                                (NET_ERR        *)&err);         /* Ignore transitory tx err(s).                         */
 #endif
@@ -23758,7 +25423,7 @@ static  void  NetTCP_TxConnProbe (NET_TCP_CONN        *p_conn,
                                 (NET_IPv6_FLOW_LABEL   ) NET_IPv6_FLOW_LABEL_DFLT,
                                 (NET_IPv6_HOP_LIM      ) NET_IPv6_HOP_LIM_DFLT,
                                 (NET_TCP_FLAGS         ) flags_tcp,
-                                (void                 *) 0,
+                                (void                 *) p_opt_cfg,
                                 (NET_ERR              *)&err);  /* Ignore transitory tx err(s).                         */
 #endif
     }
@@ -24526,7 +26191,8 @@ static  void  NetTCP_TxConnKeepAliveReset (NET_TCP_CONN  *p_conn)
 *                   to the TCP connection's re-transmit queue as a new reference to the network buffer.
 *
 *              (11) (a) IP  transmit options currently NOT implemented     See 'net_tcp.c  Note #1d'
-*                   (b) TCP transmit options currently NOT implemented     See 'net_tcp.c  Note #1c'
+*                   (b) TCP transmit options prepared by NetTCP_TxConnOptPrepare(); data segments do NOT
+*                       carry SACK blocks (see 'net_tcp.h  TCP OPTION ENABLE DEFINES  Note #1c3').
 *
 *              (12) To balance network receive versus transmit packet loads for certain network connection
 *                   types (e.g. stream-type connections), network receive & transmit packets SHOULD be
@@ -24582,7 +26248,24 @@ static  void  NetTCP_TxConnKeepAliveReset (NET_TCP_CONN  *p_conn)
 *                       the TCP connection is NOT closed.
 *
 *                   See also 'NetTCP_TxConnAppData()  Note #10'
-*                          & 'NetTCP_TxConnReTxQ()    Note #11'.
+*                          & 'NetTCP_TxConnReTxSeg()  Note #11'.
+*
+*              (15) (a) While a TCP connection's transmit is corked, less-than-MSS-sized data segments are
+*                       held on the transmit queue so that successive application writes coalesce into
+*                       the tail segment; full-sized segments are still transmitted.
+*
+*                   (b) Uncorking requests a single flush of the held data that is NOT constrained by
+*                       the Nagle algorithm.
+*
+*                   See also 'NetTCP_ConnCfgTxCorkEn()  Note #3'.
+*
+*              (16) Data transmitted after an idle transmit queue & within the acknowledgement delay
+*                   timeout of the last received data segment is counted as a reply to that data (see
+*                   'net_tcp.h  TCP CONGESTION CONTROL DEFINES  Note #6d').
+*
+*              (17) Data received after the receive direction has been idle for longer than the RTO re-arms
+*                   the connection's quick acknowledgements (see 'net_tcp.h  TCP CONGESTION CONTROL DEFINES
+*                   Note #6c').
 *********************************************************************************************************
 */
 
@@ -24626,9 +26309,14 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
     NET_TCP_WIN_SIZE         tx_data_qd;
     NET_TCP_WIN_SIZE         tx_data_min;
     NET_TCP_WIN_SIZE         tx_th_q_min;
+    NET_TCP_TX_RTT_TS_MS     rx_data_ts_ms;
+    NET_TCP_TX_RTT_TS_MS     rx_data_age_ms;
     NET_TMR_TICK             timeout_tick;
     NET_TCP_FLAGS            flags_tcp;
+    void                    *p_opt_cfg;
+    NET_TCP_TX_OPT           tx_opt;
     CPU_BOOLEAN              tx_ack;
+    CPU_BOOLEAN              tx_q_idle;
     CPU_BOOLEAN              tx_seg;
     CPU_BOOLEAN              tx_seg_push;
     CPU_BOOLEAN              tx_seg_close;
@@ -24662,6 +26350,17 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
              break;
     }
 
+    if (p_buf_hdr != DEF_NULL) {                                /* If data rx'd ...                                     */
+        if (p_buf_hdr->TCP_SegLenData > 0) {
+            rx_data_ts_ms  = NetUtil_TS_Get_ms();
+            rx_data_age_ms = rx_data_ts_ms - p_conn->RxDataLastTS_ms;
+            if (rx_data_age_ms > p_conn->TxRTT_RTO_ms) {        /* ... after rx idle > RTO, ...                         */
+                p_conn->TxAckQuickCnt = NET_TCP_ACK_QUICK_CNT_TH;   /* ... re-arm quick acks (see Note #17).            */
+            }
+            p_conn->RxDataLastTS_ms = rx_data_ts_ms;
+        }
+    }
+
                                                                 /* Cfg tx tmr free req.                                 */
     tx_tmr_free = (p_conn->TxQ_Head == DEF_NULL) ? DEF_YES : DEF_NO;
 
@@ -24792,6 +26491,7 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
     tx_done     = (tx_segs == DEF_YES) ? DEF_NO : DEF_YES;
     tx_segs_txd =  DEF_NO;
     tx_seg_nbr  =  0u;
+    tx_q_idle   = (p_conn->TxSeqNbrNext == p_conn->TxSeqNbrUnAckd) ? DEF_YES : DEF_NO;
 
     while (tx_done == DEF_NO) {                                 /* Tx ALL TCP conn tx Q seg(s) ...                      */
                                                                 /* ... allowed by cong ctrls (see Note #1b1).           */
@@ -24829,10 +26529,15 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                     }
 
 
-                    if (tx_th_mss != DEF_OK) {
+                    if ((tx_th_mss        != DEF_OK) &&
+                        (p_conn->TxCorkEn == DEF_ENABLED)) {    /* If tx cork'd, ...                                    */
+                        tx_seg = DEF_NO;                        /* ... dly sub-MSS seg (see Note #15a).                 */
+
+                    } else if (tx_th_mss != DEF_OK) {
                                                                 /* ... chk Nagle     th (see Note #7b2Ba2);     ...     */
                         tx_seg_push = DEF_BIT_IS_SET(pseg_hdr->TCP_Flags, NET_TCP_FLAG_TX_PUSH);
                         tx_nagle    = ((p_conn->TxWinSizeNagleEn == DEF_DISABLED         ) ||
+                                       (p_conn->TxCorkFlush      == DEF_YES              ) ||
                                        (p_conn->TxSeqNbrNext     == p_conn->TxSeqNbrUnAckd)) ? DEF_YES : DEF_NO;
                         tx_th_nagle = ((tx_nagle    == DEF_YES) &&
                                        (tx_seg_push == DEF_YES) &&
@@ -24974,6 +26679,8 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
 
                                                                 /* Prepare TCP win size.                                */
             win_size  = p_conn->RxWinSizeActual;
+                                                                /* Prepare TCP opts.                                    */
+            p_opt_cfg = NetTCP_TxConnOptPrepare(p_conn, &tx_opt, ack_nbr, DEF_NO, DEF_NO);
 
                                                                 /* Prepare IP params (see Note #9a).                    */
 
@@ -25034,7 +26741,7 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                                         TTL,
                                         flags_tcp,
                                         flags_ipv4,
-                                        DEF_NULL,
+                                        p_opt_cfg,
                                         DEF_NULL,               /* See Note #9b.                                        */
                                        &err);                   /* Ignore transitory tx err(s).                         */
 #endif
@@ -25052,7 +26759,7 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
                                         flow_label,
                                         hop_lim,
                                         flags_tcp,
-                                        DEF_NULL,               /* See Note #9b.                                        */
+                                        p_opt_cfg,              /* See Note #9b.                                        */
                                        &err);
 #endif
             }
@@ -25182,6 +26889,16 @@ static  void  NetTCP_TxConnTxQ (NET_TCP_CONN        *p_conn,
         NetTCP_TxConnTxQ_TimeoutIdleClr(p_conn);                /* .. clr tx Q idle tmr (see Note #1c2), ..             */
         NetTCP_TxConnAckDlyReset(p_conn, DEF_YES);              /* .. reset ack dly ctrls,               ..             */
         tx_tmr_free  = DEF_YES;                                 /* .. free tx Q tmr.                                    */
+
+        if (tx_q_idle == DEF_YES) {                             /* If tx'd from idle tx Q ...                           */
+            rx_data_age_ms = NetUtil_TS_Get_ms() - p_conn->RxDataLastTS_ms;
+                                                                /* ... within ack dly of last rx'd data, ...            */
+            if (rx_data_age_ms < p_conn->TxAckDlyTimeout_ms) {
+                if (p_conn->TxAckPingPongCtr < NET_TCP_ACK_PING_PONG_TH) {
+                    p_conn->TxAckPingPongCtr++;                 /* ... cnt as reply (see Note #16).                     */
+                }
+            }
+        }
     }
 
 
@@ -25849,24 +27566,8 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
 *                           (A) Update TCP connection's transmit congestion window          See Note #5
 *                           (B) Reset  TCP connection's delayed acknowledgement controls    See Note #6
 *
-*                   (c) Prepare TCP segment re-transmit :
-*                       (1) Prepare unchanged TCP segment for re-transmit                   See Note #7
-*
-*                       (2) Prepare updated   TCP segment for re-transmit :
-*                           (A) TCP segment   sequence numbers
-*                           (B) TCP segment   window size
-*                           (C) TCP segment   addresses
-*                           (D) TCP segment   transmit flags
-*                           (E) IP  datagram  parameters
-*                           (F) Update TCP    segment's last transmit values :
-*                               (1) Sequence        Number
-*                               (2) Acknowledgement Number
-*                               (3) Segment Length
-*                               (4) Window  Size
-*                           (G) Unlink TCP segment packet buffer from any other network layer(s)
-*                           (H) Update TCP segment packet buffer controls
-*
-*                   (d) Re-transmit TCP segment                                             See Note #2a
+*                   (c) Re-transmit TCP segment at head of re-transmit queue                See Note #2a
+*                   (d) Re-transmit TCP segment(s) NOT selectively acknowledged             See Note #12
 *
 *
 * Argument(s) : p_conn               Pointer to a TCP connection.
@@ -26071,22 +27772,178 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
 *                           until ALL re-transmitted data is acknowledged & removed from the TCP connection's
 *                           re-transmit queue.
 *
-*               (5) RFC #2581, Section 3.1 states that "when a TCP sender detects segment loss using the
-*                   retransmission timer, the value of ssthresh [TCP transmit congestion control slow start
-*                   threshold] ... [and] cwnd [TCP transmit congestion control window] MUST be set".
+*               (5) RFC #2581, Section 3.1 states that "when a TCP sender detects segment loss using the
+*                   retransmission timer, the value of ssthresh [TCP transmit congestion control slow start
+*                   threshold] ... [and] cwnd [TCP transmit congestion control window] MUST be set".
+*
+*                   See also 'NetTCP_TxConnWinSizeHandlerCongCtrl()  Notes #2c2A5a & #2c2A5b'.
+*
+*               (6) A TCP connection's delayed acknowledgement controls :
+*
+*                   (a) SHOULD be reset whenever a TCP connection re-transmits data segment(s) since
+*                           any re-transmit always transmits an accompanying acknowledgement;
+*                   (b) MAY    be reset whenever a TCP connection re-transmits a connection request
+*                           segment since NO delayed acknowledgement controls should be active.
+*
+*                   See also 'NetTCP_TxConnAckDlyReset()  Note #1'.
+*
+*               (7) See 'NetTCP_TxConnReTxSeg()  Notes #7 - #11'.
+*
+*              (12) (a) RFC #2018, Section 5 states that on "a retransmit timeout ... the data sender ...
+*                       MUST ignore prior SACK information in determining which data to retransmit".
+*
+*                   (b) On fast re-transmit, segments queued after the re-transmit queue head that are
+*                       NOT selectively acknowledged but precede the last selectively acknowledged segment
+*                       are presumed lost & are also re-transmitted (see 'NetTCP_TxConnReTxQ_SACK()').
+*********************************************************************************************************
+*/
+
+static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
+                                  CPU_BOOLEAN          re_tx_q_timeout,
+                                  NET_TCP_CLOSE_CODE   close_code,
+                                  NET_ERR             *p_err)
+{
+    NET_BUF                 *pseg;
+    NET_BUF_HDR             *pseg_hdr;
+    NET_ERR                  err;
+
+
+                                                                /* ----------------- VALIDATE RE-TX Q ----------------- */
+    if (p_conn->ReTxQ_Head == DEF_NULL) {
+       *p_err = NET_TCP_ERR_NONE;
+        return;
+    }
+
+    pseg     =  p_conn->ReTxQ_Head;                             /* Re-tx seg @ head of re-tx Q (see Note #2a).          */
+    pseg_hdr = &pseg->Hdr;
+
+    pseg_hdr->TCP_SegReTxCtr++;
+    if (pseg_hdr->TCP_SegReTxCtr > p_conn->TxSegReTxTh) {       /* If nbr re-tx's > th, close TCP conn (see Note #3).   */
+        NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                         (NET_BUF_HDR      *)0,
+                         (CPU_BOOLEAN       )p_conn->ConnCloseAppFlag,
+                         (NET_TCP_CLOSE_CODE)close_code);
+       *p_err = NET_TCP_ERR_RE_TX_SEG_TH;
+        return;
+    }
+
+
+                                                                /* ----------------- UPDATE TCP CONN ------------------ */
+    if (re_tx_q_timeout != DEF_NO) {                            /* If           re-tx Q timeout,                  ...   */
+                                                                /* ... back-off re-tx Q timeout (see Note #2b1B5) ...   */
+        NetTCP_TxConnRTT_RTO_Calc(p_conn, NET_TCP_CONN_TX_RTO_BACKOFF, NET_TCP_TX_RTT_NONE, NET_TCP_TX_RTT_NONE);
+#if 0                                                           /* Implemented with backoff     (see Note #2b2A2).      */
+                                                                /* ... & reset RTT ctrls        (see Note #2b2A2).      */
+        NetTCP_TxConnRTT_RTO_Calc(p_conn, NET_TCP_CONN_TX_RTT_RESET,   NET_TCP_TX_RTT_NONE, NET_TCP_TX_RTT_NONE);
+#endif
+    }
+                                                                /* Update re-tx Q tmr (see Note #2b1A1).                */
+    NetTCP_TxConnReTxQ_TimeoutSet(p_conn, re_tx_q_timeout, close_code, p_err);
+    if (*p_err != NET_TCP_ERR_NONE) {
+         return;
+    }
+                                                                /* Adv   un-re-tx'd seq(s) to ...                       */
+    p_conn->TxSeqNbrUnReTxd = p_conn->TxSeqNbrNext;             /* ... not-yet-tx'd seq(s) [see Note #4a2].             */
+
+
+    if (re_tx_q_timeout != DEF_NO) {                            /* If re-tx Q timeout, ...                              */
+                                                                /* ... update tx cong win  (see Note #5).               */
+        NetTCP_TxConnWinSizeHandlerCongCtrl((NET_TCP_CONN   *) p_conn,
+                                            (NET_BUF_HDR    *) 0,
+                                            (NET_TCP_ACK_CODE) NET_TCP_CONN_RX_ACK_NONE,
+                                            (NET_TCP_WIN_SIZE) 0u,
+                                            (NET_TCP_WIN_CODE) NET_TCP_CONN_TX_WIN_TIMEOUT,
+                                            (NET_ERR        *)&err);
+       (void)&err;                                              /* Ignore err(s).                                       */
+    }
+
+    NetTCP_TxConnAckDlyReset(p_conn, DEF_YES);                  /* Reset ack dly ctrls (see Note #6).                   */
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    if (re_tx_q_timeout != DEF_NO) {                            /* If re-tx Q timeout, discard SACK info (see Note #12).*/
+        while (pseg != DEF_NULL) {
+            pseg_hdr = &pseg->Hdr;
+            DEF_BIT_CLR(pseg_hdr->Flags, NET_BUF_FLAG_TX_SACKD);
+            pseg     = (NET_BUF *)pseg_hdr->NextPrimListPtr;
+        }
+        pseg = p_conn->ReTxQ_Head;
+    }
+#endif
+
+    NetTCP_TxConnReTxSeg(p_conn, pseg, close_code, p_err);     /* Re-tx seg @ head of re-tx Q.                         */
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    if ((*p_err          == NET_TCP_ERR_NONE) &&
+        ( re_tx_q_timeout == DEF_NO)) {                         /* On fast re-tx, re-tx SACK holes (see Note #12).      */
+        if (DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_SACK) == DEF_YES) {
+            NetTCP_TxConnReTxQ_SACK(p_conn, close_code, p_err);
+        }
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetTCP_TxConnReTxSeg()
+*
+* Description : (1) Re-transmit a TCP segment from TCP connection re-transmit queue :
+*
+*                   (a) Validate re-transmit segment transmit lock
+*                   (b) Validate re-transmit segment size                                   See Note #8
+*
+*                   (c) Prepare TCP segment re-transmit :
+*                       (1) Prepare unchanged TCP segment for re-transmit                   See Note #7
+*
+*                       (2) Prepare updated   TCP segment for re-transmit :
+*                           (A) TCP segment   sequence numbers
+*                           (B) TCP segment   window size
+*                           (C) TCP segment   addresses
+*                           (D) TCP segment   transmit flags
+*                           (E) IP  datagram  parameters
+*                           (F) Update TCP    segment's last transmit values :
+*                               (1) Sequence        Number
+*                               (2) Acknowledgement Number
+*                               (3) Segment Length
+*                               (4) Window  Size
+*                           (G) Unlink TCP segment packet buffer from any other network layer(s)
+*                           (H) Update TCP segment packet buffer controls
+*
+*                   (d) Re-transmit TCP segment
+*
+*
+* Argument(s) : p_conn          Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_TxConnReTxQ().
+*
+*               pseg        Pointer to TCP segment to re-transmit.
+*               ----        Argument validated in NetTCP_TxConnReTxQ(),
+*                                                 NetTCP_TxConnReTxQ_SACK().
+*
+*               close_code  Select which close action(s) to perform; bit-field flags logically OR'd
+*                               (see 'NetTCP_TxConnReTxQ()  close_code').
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                   See also 'NetTCP_TxConnWinSizeHandlerCongCtrl()  Notes #2c2A5a & #2c2A5b'.
+*                               NET_TCP_ERR_NONE                    TCP segment successfully re-transmitted.
+*                               NET_TCP_ERR_CONN_FAULT              TCP connection fault; connection(s) aborted.
+*                               NET_ERR_TX_BUF_LOCK                 Network buffer transmit lock still locked.
 *
-*               (6) A TCP connection's delayed acknowledgement controls :
+*                                                                   -------- RETURNED BY NetTCP_TxPktHandler() : ---------
+*                                                                   ------------- RETURNED BY NetIP_ReTx() : -------------
+*                               NET_ERR_TX                          Transmit error.
+*                               NET_ERR_IF_LOOPBACK_DIS             Loopback interface disabled.
+*                               NET_ERR_IF_LINK_DOWN                Network  interface link state down (i.e.
+*                                                                       NOT available for receive or transmit).
 *
-*                   (a) SHOULD be reset whenever a TCP connection re-transmits data segment(s) since
-*                           any re-transmit always transmits an accompanying acknowledgement;
-*                   (b) MAY    be reset whenever a TCP connection re-transmits a connection request
-*                           segment since NO delayed acknowledgement controls should be active.
+*                                                                   -------- RETURNED BY NetTCP_TxPktHandler() : ---------
+*                               NET_TCP_ERR_TX_PKT                  TCP transmit packet error (see Note #11a).
 *
-*                   See also 'NetTCP_TxConnAckDlyReset()  Note #1'.
+* Return(s)   : none.
 *
-*               (7) RFC #1122, Section 4.2.2.15 states that "if a retransmitted packet is identical to the
+* Caller(s)   : NetTCP_TxConnReTxQ(),
+*               NetTCP_TxConnReTxQ_SACK().
+*
+* Note(s)     : (7) RFC #1122, Section 4.2.2.15 states that "if a retransmitted packet is identical to the
 *                   original packet (which implies not only that the data boundaries have not changed, but
 *                   also that the window and acknowledgment fields of the header have not changed), then
 *                   the same IP Identification field MAY be used".
@@ -26202,13 +28059,22 @@ static  void  NetTCP_TxConnTxQ_TimeoutSillyWin (void  *p_conn_timeout)
 *
 *                   See also 'NetTCP_TxConnAppData()  Note #10'
 *                          & 'NetTCP_TxConnTxQ()      Note #14'.
+*
+*              (12) RFC #7323, Section 3.2 states that the "TSval field contains the current value of the
+*                   timestamp clock of the TCP sending the option".  Thus, while timestamps are enabled on
+*                   the TCP connection, data segments are always re-prepared for re-transmit so that each
+*                   re-transmit carries a current timestamp & the latest echoed timestamp.
+*
+*              (13) Updated segments carry the same TCP options as when first transmitted, which MUST fit
+*                   within the TCP header space reserved ahead of the segment's data (see
+*                   'NetTCP_TxConnOptLenGet()  Note #2').
 *********************************************************************************************************
 */
 
-static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
-                                  CPU_BOOLEAN          re_tx_q_timeout,
-                                  NET_TCP_CLOSE_CODE   close_code,
-                                  NET_ERR             *p_err)
+static  void  NetTCP_TxConnReTxSeg (NET_TCP_CONN        *p_conn,
+                                    NET_BUF             *pseg,
+                                    NET_TCP_CLOSE_CODE   close_code,
+                                    NET_ERR             *p_err)
 {
 #ifdef  NET_IPv4_MODULE_EN
     NET_IPv4_ADDR            src_addrv4;
@@ -26225,7 +28091,6 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
     NET_IPv6_HOP_LIM         hop_lim;
     NET_IPv6_FLAGS           flags_ipv6;
 #endif
-    NET_BUF                 *pseg;
     NET_BUF_HDR             *pseg_hdr;
     NET_BUF_FNCT             unlink_fnct;
     NET_CONN_ID              conn_id;
@@ -26251,62 +28116,15 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
     CPU_BOOLEAN              seg_updated;
     CPU_BOOLEAN              seg_data_moved;
     CPU_BOOLEAN              tx_lock;
+    void                    *p_opt_cfg;
+    NET_TCP_TX_OPT           tx_opt;
     NET_PROTOCOL_TYPE        proto_type = NET_PROTOCOL_TYPE_NONE;
     NET_ERR                  err;
     NET_ERR                  err_rtn = NET_ERR_FAULT_UNKNOWN_ERR;
 
 
-                                                                /* ----------------- VALIDATE RE-TX Q ----------------- */
-    if (p_conn->ReTxQ_Head == DEF_NULL) {
-       *p_err = NET_TCP_ERR_NONE;
-        return;
-    }
-
-    pseg     =  p_conn->ReTxQ_Head;                             /* Re-tx seg @ head of re-tx Q (see Note #2a).          */
     pseg_hdr = &pseg->Hdr;
 
-    pseg_hdr->TCP_SegReTxCtr++;
-    if (pseg_hdr->TCP_SegReTxCtr > p_conn->TxSegReTxTh) {       /* If nbr re-tx's > th, close TCP conn (see Note #3).   */
-        NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                         (NET_BUF_HDR      *)0,
-                         (CPU_BOOLEAN       )p_conn->ConnCloseAppFlag,
-                         (NET_TCP_CLOSE_CODE)close_code);
-       *p_err = NET_TCP_ERR_RE_TX_SEG_TH;
-        return;
-    }
-
-
-                                                                /* ----------------- UPDATE TCP CONN ------------------ */
-    if (re_tx_q_timeout != DEF_NO) {                            /* If           re-tx Q timeout,                  ...   */
-                                                                /* ... back-off re-tx Q timeout (see Note #2b1B5) ...   */
-        NetTCP_TxConnRTT_RTO_Calc(p_conn, NET_TCP_CONN_TX_RTO_BACKOFF, NET_TCP_TX_RTT_NONE, NET_TCP_TX_RTT_NONE);
-#if 0                                                           /* Implemented with backoff     (see Note #2b2A2).      */
-                                                                /* ... & reset RTT ctrls        (see Note #2b2A2).      */
-        NetTCP_TxConnRTT_RTO_Calc(p_conn, NET_TCP_CONN_TX_RTT_RESET,   NET_TCP_TX_RTT_NONE, NET_TCP_TX_RTT_NONE);
-#endif
-    }
-                                                                /* Update re-tx Q tmr (see Note #2b1A1).                */
-    NetTCP_TxConnReTxQ_TimeoutSet(p_conn, re_tx_q_timeout, close_code, p_err);
-    if (*p_err != NET_TCP_ERR_NONE) {
-         return;
-    }
-                                                                /* Adv   un-re-tx'd seq(s) to ...                       */
-    p_conn->TxSeqNbrUnReTxd = p_conn->TxSeqNbrNext;             /* ... not-yet-tx'd seq(s) [see Note #4a2].             */
-
-
-    if (re_tx_q_timeout != DEF_NO) {                            /* If re-tx Q timeout, ...                              */
-                                                                /* ... update tx cong win  (see Note #5).               */
-        NetTCP_TxConnWinSizeHandlerCongCtrl((NET_TCP_CONN   *) p_conn,
-                                            (NET_BUF_HDR    *) 0,
-                                            (NET_TCP_ACK_CODE) NET_TCP_CONN_RX_ACK_NONE,
-                                            (NET_TCP_WIN_SIZE) 0u,
-                                            (NET_TCP_WIN_CODE) NET_TCP_CONN_TX_WIN_TIMEOUT,
-                                            (NET_ERR        *)&err);
-       (void)&err;                                              /* Ignore err(s).                                       */
-    }
-
-    NetTCP_TxConnAckDlyReset(p_conn, DEF_YES);                  /* Reset ack dly ctrls (see Note #6).                   */
-
                                                                 /* ------------- CHK RE-TX SEG'S TX LOCK -------------- */
     tx_lock = DEF_BIT_IS_SET(pseg_hdr->Flags, NET_BUF_FLAG_TX_LOCK);
     if (tx_lock != DEF_NO) {                                    /* If buf tx locked, CANNOT cur'ly re-tx seg.           */
@@ -26329,6 +28147,11 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
                    (pseg_hdr->TCP_SegLenLast  != seg_len ) ||
                    (pseg_hdr->TCP_WinSizeLast != win_size)) ? DEF_YES : DEF_NO;
 
+    if ((DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_TS) == DEF_YES) &&
+        (pseg_hdr->TCP_SegSync                           == DEF_NO )) {
+        seg_updated = DEF_YES;                                  /* Re-tx'd TS MUST be updated (see Note #12).           */
+    }
+
 
     seg_data_moved =  DEF_NO;
     seg_len_tot    = (NET_BUF_SIZE)pseg_hdr->TotLen        -    /* Seg cur tot len = prev'ly tx'd/ack'd pkt tot  len    */
@@ -26393,7 +28216,7 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
 
     NetTCP_GetTxDataIx(if_nbr,
                        proto_type,
-                       0u,
+                       NetTCP_TxConnOptLenGet(p_conn, pseg_hdr->TCP_SegSync, DEF_NO),
                        pseg_hdr->DataLen,
                        p_conn,
                       &data_ix_re_tx,
@@ -26417,6 +28240,8 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
             }
 
             DEF_BIT_CLR(pseg_hdr->Flags, NET_BUF_FLAG_CLR_MEM); /* MUST clr buf mem clr flag (see Note #8b2B2).         */
+            pseg_hdr->ChkSumDataIx  = NET_BUF_IX_NONE;          /* Data moved; invalidate cached data chk sum.          */
+            pseg_hdr->ChkSumDataLen = 0u;
 
             seg_data_moved = DEF_YES;
         }
@@ -26482,6 +28307,8 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
 
                                                                 /* Reset protocol & tot len for re-tx.                  */
         pseg_hdr->TotLen          = pseg_hdr->DataLen;
+                                                                /* Prepare TCP opts (see Note #13).                     */
+        p_opt_cfg = NetTCP_TxConnOptPrepare(p_conn, &tx_opt, ack_nbr, pseg_hdr->TCP_SegSync, DEF_NO);
     }
 
 
@@ -26521,7 +28348,7 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
                                     (NET_IPv4_TTL    ) TTL,
                                     (NET_TCP_FLAGS   ) flags_tcp,
                                     (NET_IPv4_FLAGS  ) flags_ipv4,
-                                    (void           *) 0,
+                                    (void           *) p_opt_cfg,
                                     (void           *) 0,
                                     (NET_ERR        *)&err_rtn);
         }
@@ -26548,7 +28375,7 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
                                     (NET_IPv6_FLOW_LABEL   ) flow_label,
                                     (NET_IPv6_HOP_LIM      ) hop_lim,
                                     (CPU_INT16U            ) flags_tcp,
-                                    (void                 *) 0,
+                                    (void                 *) p_opt_cfg,
                                     (NET_ERR              *)&err_rtn);
         }
 #endif
@@ -26586,6 +28413,108 @@ static  void  NetTCP_TxConnReTxQ (NET_TCP_CONN        *p_conn,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetTCP_TxConnReTxQ_SACK()
+*
+* Description : Re-transmit TCP segment(s) NOT selectively acknowledged from TCP connection re-transmit queue.
+*
+* Argument(s) : p_conn          Pointer to a TCP connection.
+*               ------      Argument validated in NetTCP_TxConnReTxQ().
+*
+*               close_code  Select which close action(s) to perform; bit-field flags logically OR'd
+*                               (see 'NetTCP_TxConnReTxQ()  close_code').
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                    SACK hole(s) successfully re-transmitted.
+*
+*                                                                   ------ RETURNED BY NetTCP_TxConnReTxSeg() : ------
+*                               NET_TCP_ERR_CONN_FAULT              TCP connection fault; connection(s) aborted.
+*                               NET_ERR_TX                          Transmit error.
+*                               NET_ERR_IF_LOOPBACK_DIS             Loopback interface disabled.
+*                               NET_ERR_IF_LINK_DOWN                Network  interface link state down (i.e.
+*                                                                       NOT available for receive or transmit).
+*                               NET_TCP_ERR_TX_PKT                  TCP transmit packet error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxConnReTxQ().
+*
+* Note(s)     : (1) RFC #6675, Section 4 states that a segment is "lost" if "DupThresh ... SACKed
+*                   sequences above" it have arrived.  Since the remote host has already selectively
+*                   acknowledged data beyond any un-acknowledged segment that precedes the last selectively
+*                   acknowledged segment, such segments are presumed lost & re-transmitted without waiting
+*                   for further duplicate acknowledgements or a re-transmit timeout.
+*
+*               (2) (a) The segment at the head of the re-transmit queue is re-transmitted by the caller.
+*
+*                   (b) At most NET_TCP_OPT_SACK_RE_TX_SEG_MAX segments are re-transmitted per call to
+*                       bound the burst of re-transmitted segments (see 'net_tcp.h  TCP OPTION ENABLE
+*                       DEFINES').
+*
+*                   (c) Segments that are transmit locked or that have already reached the re-transmit
+*                       threshold are skipped; they are handled by the re-transmit queue timeout.
+*********************************************************************************************************
+*/
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+static  void  NetTCP_TxConnReTxQ_SACK (NET_TCP_CONN        *p_conn,
+                                       NET_TCP_CLOSE_CODE   close_code,
+                                       NET_ERR             *p_err)
+{
+    NET_BUF      *pseg;
+    NET_BUF      *pseg_next;
+    NET_BUF      *pseg_sackd_last;
+    NET_BUF_HDR  *pseg_hdr;
+    CPU_INT08U    re_tx_nbr;
+
+
+                                                                /* ---------------- FIND LAST SACK'D SEG -------------- */
+    pseg_sackd_last = DEF_NULL;
+    pseg            = p_conn->ReTxQ_Head;
+    while (pseg != DEF_NULL) {
+        pseg_hdr = &pseg->Hdr;
+        if (DEF_BIT_IS_SET(pseg_hdr->Flags, NET_BUF_FLAG_TX_SACKD) == DEF_YES) {
+            pseg_sackd_last = pseg;
+        }
+        pseg     = (NET_BUF *)pseg_hdr->NextPrimListPtr;
+    }
+
+    if (pseg_sackd_last == DEF_NULL) {                          /* If NO seg SACK'd, NO holes to re-tx.                 */
+       *p_err = NET_TCP_ERR_NONE;
+        return;
+    }
+
+                                                                /* ------------------ RE-TX SACK HOLES ---------------- */
+    re_tx_nbr = 0u;
+    pseg_hdr  = &p_conn->ReTxQ_Head->Hdr;                       /* Skip re-tx Q head (see Note #2a).                    */
+    pseg      = (NET_BUF *)pseg_hdr->NextPrimListPtr;
+    while ((pseg      != DEF_NULL) &&
+           (pseg      != pseg_sackd_last) &&
+           (re_tx_nbr <  NET_TCP_OPT_SACK_RE_TX_SEG_MAX)) {     /* See Note #2b.                                        */
+        pseg_hdr  = &pseg->Hdr;
+        pseg_next = (NET_BUF *)pseg_hdr->NextPrimListPtr;
+
+        if ((DEF_BIT_IS_CLR(pseg_hdr->Flags, NET_BUF_FLAG_TX_SACKD) == DEF_YES) &&
+            (DEF_BIT_IS_CLR(pseg_hdr->Flags, NET_BUF_FLAG_TX_LOCK)  == DEF_YES) &&
+            (pseg_hdr->TCP_SegReTxCtr < p_conn->TxSegReTxTh)) {  /* See Note #2c.                                       */
+            pseg_hdr->TCP_SegReTxCtr++;
+            NetTCP_TxConnReTxSeg(p_conn, pseg, close_code, p_err);
+            if (*p_err != NET_TCP_ERR_NONE) {
+                 return;
+            }
+            re_tx_nbr++;
+        }
+
+        pseg = pseg_next;
+    }
+
+   *p_err = NET_TCP_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    NetTCP_TxConnReTxQ_Timeout()
@@ -27143,60 +29072,335 @@ static  void  NetTCP_TxConnPrepareSegAddrs (NET_TCP_CONN  *p_conn,
     }
 #endif
 
-    addr_len = sizeof(addr_remote);
-    NetConn_AddrRemoteGet((NET_CONN_ID        ) conn_id,        /* Get remote/dest addr.                                */
-                          (CPU_INT08U        *)&addr_remote[0],
-                          (NET_CONN_ADDR_LEN *)&addr_len,
-                          (NET_ERR           *)&err);
-    if ( err != NET_CONN_ERR_NONE) {
-       *p_err  = NET_CONN_ERR_INVALID_ADDR;
-        return;
-    }
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-    if (addr_len > NET_CONN_ADDR_LEN_MAX) {
-        NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                         (NET_BUF_HDR      *)0,
-                         (CPU_BOOLEAN       )DEF_YES,
-                         (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
-       *p_err = NET_CONN_ERR_INVALID_ADDR_LEN;
-        return;
+    addr_len = sizeof(addr_remote);
+    NetConn_AddrRemoteGet((NET_CONN_ID        ) conn_id,        /* Get remote/dest addr.                                */
+                          (CPU_INT08U        *)&addr_remote[0],
+                          (NET_CONN_ADDR_LEN *)&addr_len,
+                          (NET_ERR           *)&err);
+    if ( err != NET_CONN_ERR_NONE) {
+       *p_err  = NET_CONN_ERR_INVALID_ADDR;
+        return;
+    }
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+    if (addr_len > NET_CONN_ADDR_LEN_MAX) {
+        NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                         (NET_BUF_HDR      *)0,
+                         (CPU_BOOLEAN       )DEF_YES,
+                         (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
+       *p_err = NET_CONN_ERR_INVALID_ADDR_LEN;
+        return;
+    }
+#endif
+
+
+                                                                /* Prepare src/dest addrs (see Note #1).                */
+    switch (p_net_conn->Family) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_CONN_FAMILY_IP_V4_SOCK:
+                                                                /* Cfg local  addr as pkt src  addr.                    */
+             NET_UTIL_VAL_COPY_GET_NET_16(p_src_port,  &addr_local [NET_CONN_ADDR_IP_IX_PORT]);
+             NET_UTIL_VAL_COPY_GET_NET_32(p_src_addr,  &addr_local [NET_CONN_ADDR_IP_V4_IX_ADDR]);
+                                                                /* Cfg remote addr as pkt dest addr.                    */
+             NET_UTIL_VAL_COPY_GET_NET_16(p_dest_port, &addr_remote[NET_CONN_ADDR_IP_IX_PORT]);
+             NET_UTIL_VAL_COPY_GET_NET_32(p_dest_addr, &addr_remote[NET_CONN_ADDR_IP_V4_IX_ADDR]);
+             break;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_CONN_FAMILY_IP_V6_SOCK:
+             NET_UTIL_VAL_COPY_GET_NET_16(p_src_port,  &addr_local [NET_CONN_ADDR_IP_IX_PORT]);
+             Mem_Copy(p_src_addr, &addr_local [NET_CONN_ADDR_IP_V6_IX_ADDR], src_addr_len);
+                                                                /* Cfg remote addr as pkt dest addr.                    */
+             NET_UTIL_VAL_COPY_GET_NET_16(p_dest_port, &addr_remote[NET_CONN_ADDR_IP_IX_PORT]);
+             Mem_Copy(p_dest_addr, &addr_remote [NET_CONN_ADDR_IP_V6_IX_ADDR], dest_addr_len);
+             break;
+#endif
+        default:
+                                                                /* See Note #2.                                         */
+             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
+                              (NET_BUF_HDR      *)0,
+                              (CPU_BOOLEAN       )DEF_YES,
+                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
+            *p_err = NET_CONN_ERR_INVALID_FAMILY;
+             return;
+    }
+
+
+   *p_err = NET_TCP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_TxConnOptLenGet()
+*
+* Description : Get the maximum length of the TCP options a TCP connection may transmit in a segment.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection (see Note #1).
+*
+*               sync        Indicate whether the segment is a synchronization segment :
+*
+*                               DEF_YES                         Synchronization     segment.
+*                               DEF_NO                          Non-synchronization segment.
+*
+*               sack        Indicate whether the segment may carry a TCP SACK option :
+*
+*                               DEF_YES                         Segment may     carry SACK blocks.
+*                               DEF_NO                          Segment may NOT carry SACK blocks.
+*
+* Return(s)   : Maximum TCP options length (in octets), including padding.
+*
+* Caller(s)   : NetTCP_TxConnAppData(),
+*               NetTCP_TxConnAppBufGet(),
+*               NetTCP_TxConnSync(),
+*               NetTCP_TxConnClose(),
+*               NetTCP_TxConnAck(),
+*               NetTCP_TxConnProbe(),
+*               NetTCP_TxConnReTxSeg().
+*
+* Note(s)     : (1) A NULL connection pointer returns a zero-length (i.e. segments NOT sent on a TCP
+*                   connection carry NO TCP options).
+*
+*               (2) The returned length MUST be reserved ahead of the segment's data since the TCP header
+*                   is prepended to the data when the segment is (re-)transmitted; reserving the worst case
+*                   allows every later re-transmit to prepend updated options in place.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetTCP_TxConnOptLenGet (NET_TCP_CONN  *p_conn,
+                                            CPU_BOOLEAN    sync,
+                                            CPU_BOOLEAN    sack)
+{
+    CPU_INT16U  opt_len;
+    CPU_INT08U  opt_en;
+
+
+    if (p_conn == DEF_NULL) {                                   /* See Note #1.                                         */
+        return (0u);
+    }
+
+    opt_len = 0u;
+    opt_en  = p_conn->OptEn;
+    if (sync == DEF_YES) {                                      /* Add sync seg opts.                                    */
+        opt_len += NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE;
+        if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_WIN_SCALE) == DEF_YES) {
+            opt_len += NET_TCP_OPT_SIZE_WIN_SCALE;
+        }
+        if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_SACK) == DEF_YES) {
+            opt_len += NET_TCP_OPT_SIZE_SACK_PERMIT;
+        }
+    }
+
+    if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_TS) == DEF_YES) {
+        opt_len += NET_TCP_OPT_SIZE_TS;
+        if ((sack == DEF_YES) &&
+            (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_SACK) == DEF_YES)) {
+            opt_len += NET_TCP_OPT_SIZE_SACK_HDR + (NET_TCP_OPT_SACK_BLK_NBR_MAX_TS * NET_TCP_OPT_SACK_BLK_SIZE);
+        }
+    } else {
+        if ((sack == DEF_YES) &&
+            (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_SACK) == DEF_YES)) {
+            opt_len += NET_TCP_OPT_SIZE_SACK_HDR + (NET_TCP_OPT_SACK_BLK_NBR_MAX    * NET_TCP_OPT_SACK_BLK_SIZE);
+        }
+    }
+
+    return (opt_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_TxConnOptPrepare()
+*
+* Description : Prepare the TCP option configurations to transmit on a TCP connection's segment.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               ------      Argument validated in caller(s).
+*
+*               p_tx_opt    Pointer to caller's TCP transmit option configurations to prepare.
+*               --------    Argument validated in caller(s).
+*
+*               ack_nbr     Segment's acknowledgement number.
+*
+*               sync        Indicate whether the segment is a synchronization segment :
+*
+*                               DEF_YES                         Synchronization     segment.
+*                               DEF_NO                          Non-synchronization segment.
+*
+*               sack        Indicate whether the segment may carry a TCP SACK option :
+*
+*                               DEF_YES                         Segment may     carry SACK blocks.
+*                               DEF_NO                          Segment may NOT carry SACK blocks.
+*
+* Return(s)   : Pointer to the first TCP option configuration to transmit, if any.
+*
+*               Pointer to NULL,                                           otherwise.
+*
+* Caller(s)   : NetTCP_TxConnSync(),
+*               NetTCP_TxConnAck(),
+*               NetTCP_TxConnProbe(),
+*               NetTCP_TxConnTxQ(),
+*               NetTCP_TxConnReTxSeg().
+*
+* Note(s)     : (1) Options are chained in the order MSS, Window Scale, SACK-Permitted, Timestamp & SACK,
+*                   & MUST NOT exceed the length returned by NetTCP_TxConnOptLenGet() for the same
+*                   arguments.
+*
+*               (2) (a) Synchronization segments offer the connection's enabled options, which are the
+*                       configured options for an active open (see 'NetTCP_TxConnSync()  Note #4b') or the
+*                       negotiated options when replying to a remote host's synchronization segment.
+*
+*                   (b) The local window is advertised with a shift of zero since receive windows do NOT
+*                       exceed 16 bits (see 'net_tcp.h  TCP OPTION ENABLE DEFINES  Note #1c1').
+*
+*                   (c) Non-synchronization segments carry options only once the options are negotiated;
+*                       i.e. NOT while an active open still awaits the remote host's synchronization segment.
+*
+*               (3) RFC #2018, Section 4 states that a SACK option "SHOULD ... specify as many distinct
+*                   SACK blocks as possible" & that "the first SACK block ... MUST specify the contiguous
+*                   block of data containing the segment which triggered this ACK".
+*
+*                   (a) Blocks are built from the transport receive queue, whose out-of-order segments are
+*                       sorted by sequence number; contiguous segments are merged into a single block.
+*
+*                   (b) The block containing the most recently queued out-of-order segment is reported
+*                       first; the remaining blocks follow in sequence order.
+*
+*               (4) RFC #7323, Section 4.3 states that "TS.Recent ... is the timestamp to be echoed ... and
+*                   Last.ACK.sent holds the ACK field from the last segment sent".
+*********************************************************************************************************
+*/
+
+static  void  *NetTCP_TxConnOptPrepare (NET_TCP_CONN     *p_conn,
+                                        NET_TCP_TX_OPT   *p_tx_opt,
+                                        NET_TCP_SEQ_NBR   ack_nbr,
+                                        CPU_BOOLEAN       sync,
+                                        CPU_BOOLEAN       sack)
+{
+    void                   *p_opt_head;
+    void                  **p_opt_next;
+    CPU_INT08U              opt_en;
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    NET_BUF                *p_seg;
+    NET_BUF_HDR            *p_seg_hdr;
+    NET_TCP_OPT_SACK_BLK    blk;
+    NET_TCP_SEQ_NBR         seq_nbr_right;
+    CPU_INT08U              blk_nbr;
+    CPU_INT08U              blk_nbr_max;
+    CPU_INT08U              blk_ix;
+#endif
+
+
+    p_opt_head = DEF_NULL;
+    p_opt_next = &p_opt_head;
+    opt_en     =  p_conn->OptEn;
+
+    if ((sync              == DEF_NO) &&                        /* See Note #2c.                                        */
+        (p_conn->ConnState == NET_TCP_CONN_STATE_SYNC_TXD)) {
+        return (DEF_NULL);
+    }
+
+                                                                /* ------------------ PREPARE SYNC OPTS --------------- */
+    if (sync == DEF_YES) {
+        p_tx_opt->MaxSegSize.Type        =  NET_TCP_OPT_TYPE_MAX_SEG_SIZE;
+        p_tx_opt->MaxSegSize.MaxSegSize  =  p_conn->MaxSegSizeLocalActual;
+        p_tx_opt->MaxSegSize.NextOptPtr  =  DEF_NULL;
+       *p_opt_next                       = &p_tx_opt->MaxSegSize;
+        p_opt_next                       = &p_tx_opt->MaxSegSize.NextOptPtr;
+
+        if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_WIN_SCALE) == DEF_YES) {
+            p_tx_opt->WinScale.Type       =  NET_TCP_OPT_TYPE_WIN_SCALE;
+            p_tx_opt->WinScale.Shift      =  0u;                /* See Note #2b.                                        */
+            p_tx_opt->WinScale.NextOptPtr =  DEF_NULL;
+           *p_opt_next                    = &p_tx_opt->WinScale;
+            p_opt_next                    = &p_tx_opt->WinScale.NextOptPtr;
+        }
+
+        if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_SACK) == DEF_YES) {
+            p_tx_opt->SACK_Permit.Type       =  NET_TCP_OPT_TYPE_SACK_PERMIT;
+            p_tx_opt->SACK_Permit.NextOptPtr =  DEF_NULL;
+           *p_opt_next                       = &p_tx_opt->SACK_Permit;
+            p_opt_next                       = &p_tx_opt->SACK_Permit.NextOptPtr;
+        }
     }
-#endif
 
+                                                                /* ------------------- PREPARE TS OPT ----------------- */
+    if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_TS) == DEF_YES) {
+        p_tx_opt->TS.Type          =  NET_TCP_OPT_TYPE_TS;
+        p_tx_opt->TS.TS_Val        =  NetUtil_TS_Get_ms();
+        p_tx_opt->TS.TS_EchoReply  =  p_conn->TS_Recent;        /* See Note #4.                                         */
+        p_tx_opt->TS.NextOptPtr    =  DEF_NULL;
+       *p_opt_next                 = &p_tx_opt->TS;
+        p_opt_next                 = &p_tx_opt->TS.NextOptPtr;
+
+        p_conn->TS_LastAckSent     =  ack_nbr;
+    }
+
+                                                                /* ------------------ PREPARE SACK OPT ---------------- */
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+    if ((sack                       == DEF_YES ) &&
+        (p_conn->RxQ_Transport_Head != DEF_NULL) &&
+        (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_SACK) == DEF_YES)) {
+
+        blk_nbr = 0u;
+        p_seg   = p_conn->RxQ_Transport_Head;
+        while ((p_seg   != DEF_NULL) &&                         /* Build blks from rx Q (see Note #3a).                 */
+               (blk_nbr <  NET_TCP_OPT_SACK_BLK_NBR_MAX)) {
+            p_seg_hdr     = &p_seg->Hdr;
+            blk.LeftEdge  =  p_seg_hdr->TCP_SeqNbr;
+            blk.RightEdge = (NET_TCP_SEQ_NBR)(p_seg_hdr->TCP_SeqNbr + p_seg_hdr->TCP_SegLen);
+            p_seg         = (NET_BUF *)p_seg_hdr->NextPrimListPtr;
+
+            while (p_seg != DEF_NULL) {                         /* Merge contiguous segs.                               */
+                p_seg_hdr = &p_seg->Hdr;
+                if ((NET_TCP_SEQ_NBR)(p_seg_hdr->TCP_SeqNbr - blk.LeftEdge) >
+                    (NET_TCP_SEQ_NBR)(blk.RightEdge         - blk.LeftEdge)) {
+                    break;
+                }
+                seq_nbr_right = (NET_TCP_SEQ_NBR)(p_seg_hdr->TCP_SeqNbr + p_seg_hdr->TCP_SegLen);
+                if ((NET_TCP_SEQ_NBR)(seq_nbr_right - blk.LeftEdge) >
+                    (NET_TCP_SEQ_NBR)(blk.RightEdge - blk.LeftEdge)) {
+                    blk.RightEdge = seq_nbr_right;
+                }
+                p_seg = (NET_BUF *)p_seg_hdr->NextPrimListPtr;
+            }
 
-                                                                /* Prepare src/dest addrs (see Note #1).                */
-    switch (p_net_conn->Family) {
-#ifdef  NET_IPv4_MODULE_EN
-        case NET_CONN_FAMILY_IP_V4_SOCK:
-                                                                /* Cfg local  addr as pkt src  addr.                    */
-             NET_UTIL_VAL_COPY_GET_NET_16(p_src_port,  &addr_local [NET_CONN_ADDR_IP_IX_PORT]);
-             NET_UTIL_VAL_COPY_GET_NET_32(p_src_addr,  &addr_local [NET_CONN_ADDR_IP_V4_IX_ADDR]);
-                                                                /* Cfg remote addr as pkt dest addr.                    */
-             NET_UTIL_VAL_COPY_GET_NET_16(p_dest_port, &addr_remote[NET_CONN_ADDR_IP_IX_PORT]);
-             NET_UTIL_VAL_COPY_GET_NET_32(p_dest_addr, &addr_remote[NET_CONN_ADDR_IP_V4_IX_ADDR]);
-             break;
-#endif
-#ifdef  NET_IPv6_MODULE_EN
-        case NET_CONN_FAMILY_IP_V6_SOCK:
-             NET_UTIL_VAL_COPY_GET_NET_16(p_src_port,  &addr_local [NET_CONN_ADDR_IP_IX_PORT]);
-             Mem_Copy(p_src_addr, &addr_local [NET_CONN_ADDR_IP_V6_IX_ADDR], src_addr_len);
-                                                                /* Cfg remote addr as pkt dest addr.                    */
-             NET_UTIL_VAL_COPY_GET_NET_16(p_dest_port, &addr_remote[NET_CONN_ADDR_IP_IX_PORT]);
-             Mem_Copy(p_dest_addr, &addr_remote [NET_CONN_ADDR_IP_V6_IX_ADDR], dest_addr_len);
-             break;
-#endif
-        default:
-                                                                /* See Note #2.                                         */
-             NetTCP_ConnClose((NET_TCP_CONN     *)p_conn,
-                              (NET_BUF_HDR      *)0,
-                              (CPU_BOOLEAN       )DEF_YES,
-                              (NET_TCP_CLOSE_CODE)NET_TCP_CONN_CLOSE_ALL);
-            *p_err = NET_CONN_ERR_INVALID_FAMILY;
-             return;
-    }
+            if (blk.LeftEdge != ack_nbr) {                      /* Skip in-order data still q'd for sync.               */
+                p_tx_opt->SACK.Blks[blk_nbr] = blk;
+                blk_nbr++;
+            }
+        }
+
+        for (blk_ix = 1u; blk_ix < blk_nbr; blk_ix++) {         /* Report most recent blk first (see Note #3b).         */
+            blk = p_tx_opt->SACK.Blks[blk_ix];
+            if ((NET_TCP_SEQ_NBR)(p_conn->RxSACK_SeqNbrLast - blk.LeftEdge) <
+                (NET_TCP_SEQ_NBR)(blk.RightEdge             - blk.LeftEdge)) {
+                p_tx_opt->SACK.Blks[blk_ix] = p_tx_opt->SACK.Blks[0];
+                p_tx_opt->SACK.Blks[0]      = blk;
+                break;
+            }
+        }
 
+        if (DEF_BIT_IS_SET(opt_en, NET_TCP_OPT_EN_TS) == DEF_YES) {
+            blk_nbr_max = NET_TCP_OPT_SACK_BLK_NBR_MAX_TS;
+        } else {
+            blk_nbr_max = NET_TCP_OPT_SACK_BLK_NBR_MAX;
+        }
+        if (blk_nbr > blk_nbr_max) {
+            blk_nbr = blk_nbr_max;
+        }
 
-   *p_err = NET_TCP_ERR_NONE;
+        if (blk_nbr > 0u) {
+            p_tx_opt->SACK.Type       =  NET_TCP_OPT_TYPE_SACK;
+            p_tx_opt->SACK.BlkNbr     =  blk_nbr;
+            p_tx_opt->SACK.NextOptPtr =  DEF_NULL;
+           *p_opt_next                = &p_tx_opt->SACK;
+        }
+    }
+#else
+   (void)&sack;
+#endif
+
+    return (p_opt_head);
 }
 
 
@@ -27980,6 +30184,10 @@ static  void  NetTCP_TxConnRTT_RTO_Calc (NET_TCP_CONN          *p_conn,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *               p_opts_ip    Pointer to one or more IP  options configuration data structures
 *                               (see Note #2c & 'net_ip.h  IP HEADER OPTION CONFIGURATION DATA TYPES') :
@@ -28238,6 +30446,10 @@ static  void  NetTCP_TxPktHandlerIPv4 (NET_BUF           *p_buf,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *               p_opts_ip    Pointer to one or more IP  options configuration data structures
 *                               (see Note #2c & 'net_ip.h  IP HEADER OPTION CONFIGURATION DATA TYPES') :
@@ -28490,6 +30702,10 @@ static  void  NetTCP_TxPktHandlerIPv6 (NET_BUF                 *p_buf,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
 *
@@ -28670,6 +30886,10 @@ static  void  NetTCP_TxPktValidate (NET_BUF_HDR       *p_buf_hdr,
 *
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd :
 *
@@ -28699,6 +30919,10 @@ static  void  NetTCP_TxPktValidate (NET_BUF_HDR       *p_buf_hdr,
 *                   of each of the following TCP options may be configured for any one TCP segment :
 *
 *                   (a) NET_TCP_OPT_TYPE_MAX_SEG_SIZE
+*                   (b) NET_TCP_OPT_TYPE_WIN_SCALE
+*                   (c) NET_TCP_OPT_TYPE_SACK_PERMIT
+*                   (d) NET_TCP_OPT_TYPE_SACK
+*                   (e) NET_TCP_OPT_TYPE_TS
 *********************************************************************************************************
 */
 
@@ -28710,6 +30934,10 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
     CPU_INT08U         opt_len_size;
     CPU_INT08U         opt_len;
     CPU_INT08U         opt_nbr_max_seg_size;
+    CPU_INT08U         opt_nbr_win_scale;
+    CPU_INT08U         opt_nbr_sack_permit;
+    CPU_INT08U         opt_nbr_sack;
+    CPU_INT08U         opt_nbr_ts;
     NET_TCP_OPT_TYPE  *p_opt_cfg_type;
     void              *p_opt_cfg;
     void              *p_opt_next;
@@ -28717,6 +30945,10 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
 
     opt_len_size         = 0u;
     opt_nbr_max_seg_size = 0u;
+    opt_nbr_win_scale    = 0u;
+    opt_nbr_sack_permit  = 0u;
+    opt_nbr_sack         = 0u;
+    opt_nbr_ts           = 0u;
     p_opt_cfg             = p_opts_tcp;
 
     while (p_opt_cfg  != (void *)0) {
@@ -28732,14 +30964,62 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
 
                  NetTCP_TxPktValidateOptMaxSegSize(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
                  break;
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+            case NET_TCP_OPT_TYPE_WIN_SCALE:                    /* ------------------ WIN SCALE OPT ------------------- */
+                 if (opt_nbr_win_scale > 0) {                   /* If > 1 win scale opt, rtn err.                       */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+                     return;
+                 }
+                 opt_nbr_win_scale++;
+
+                 NetTCP_TxPktValidateOptWinScale(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
+                 break;
+#endif
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+            case NET_TCP_OPT_TYPE_SACK_PERMIT:                  /* ----------------- SACK PERMIT OPT ------------------ */
+                 if (opt_nbr_sack_permit > 0) {                 /* If > 1 SACK permit opt, rtn err.                     */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+                     return;
+                 }
+                 opt_nbr_sack_permit++;
+
+                 NetTCP_TxPktValidateOptSACK_Permit(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
+                 break;
+
+            case NET_TCP_OPT_TYPE_SACK:                         /* --------------------- SACK OPT --------------------- */
+                 if (opt_nbr_sack > 0) {                        /* If > 1 SACK opt, rtn err.                            */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+                     return;
+                 }
+                 opt_nbr_sack++;
+
+                 NetTCP_TxPktValidateOptSACK(p_opt_cfg, &opt_len, &p_opt_next, flags_tcp, p_err);
+                 break;
+#endif
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+            case NET_TCP_OPT_TYPE_TS:                           /* ---------------------- TS OPT ---------------------- */
+                 if (opt_nbr_ts > 0) {                          /* If > 1 TS opt, rtn err.                              */
+                     NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+                    *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+                     return;
+                 }
+                 opt_nbr_ts++;
+                                                                /* TS vals are opaque; any val is valid.                */
+                  opt_len    =  NET_TCP_OPT_SIZE_TS;
+                  p_opt_next = ((NET_TCP_OPT_CFG_TS *)p_opt_cfg)->NextOptPtr;
+                 *p_err      =  NET_TCP_ERR_NONE;
+                 break;
+#endif
                                                                 /* --------------- UNSUPPORTED TCP OPTS --------------- */
                                                                 /* See Note #3b.                                        */
-            case NET_TCP_OPT_TYPE_WIN_SCALE:
-            case NET_TCP_OPT_TYPE_SACK_PERMIT:
-            case NET_TCP_OPT_TYPE_SACK:
             case NET_TCP_OPT_TYPE_ECHO_REQ:
             case NET_TCP_OPT_TYPE_ECHO_REPLY:
-            case NET_TCP_OPT_TYPE_TS:
             case NET_TCP_OPT_TYPE_NONE:                         /* ----------------- INVALID TCP OPTS ----------------- */
             default:
                  NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxOptTypeCtr);
@@ -28810,29 +31090,235 @@ static  void  NetTCP_TxPktValidateOpt (void           *p_opts_tcp,
 *
 * Caller(s)   : NetTCP_TxPktValidateOpt().
 *
-* Note(s)     : (3) RFC #793, Section 3.1 'Header Format : Options : Maximum Segment Size' states that a
-*                   TCP Maximum Segment Size option "must only be sent in the initial connection request
-*                   (i.e., in segments with the SYN control bit set)".
+* Note(s)     : (3) RFC #793, Section 3.1 'Header Format : Options : Maximum Segment Size' states that a
+*                   TCP Maximum Segment Size option "must only be sent in the initial connection request
+*                   (i.e., in segments with the SYN control bit set)".
+*********************************************************************************************************
+*/
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
+                                                 CPU_INT08U      *p_opt_len,
+                                                 void           **p_opt_next,
+                                                 NET_TCP_FLAGS    flags_tcp,
+                                                 NET_ERR         *p_err)
+{
+    NET_TCP_OPT_CFG_MAX_SEG_SIZE  *p_opt_cfg_max_seg_size;
+    CPU_BOOLEAN                    flags_tcp_syn;
+
+
+    p_opt_cfg_max_seg_size = (NET_TCP_OPT_CFG_MAX_SEG_SIZE *)p_opt_tcp;
+
+
+                                                                /* -------------- VALIDATE MAX SEG SIZE --------------- */
+                                                                /* If max seg size > max, rtn err.                      */
+    if (p_opt_cfg_max_seg_size->MaxSegSize > NET_TCP_MAX_SEG_SIZE_MAX) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+                                                                /* -------------- VALIDATE OPT CFG/CTRL --------------- */
+    flags_tcp_syn = DEF_BIT_IS_SET(flags_tcp, NET_TCP_HDR_FLAG_SYNC);
+    if (flags_tcp_syn != DEF_YES) {                             /* If 'SYN' bit NOT set, rtn err (see Note #3).         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE;
+   *p_opt_next = p_opt_cfg_max_seg_size->NextOptPtr;
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxPktValidateOptWinScale()
+*
+* Description : Validate TCP Window Scale option configuration.
+*
+* Argument(s) : p_opt_tcp    Pointer to TCP Window Scale option configuration data structure.
+*               --------    Argument checked   in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP Window Scale option length
+*               --------        (in octets).
+*
+*                           Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               ---------   Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Window Scale option configuration validated.
+*                               NET_TCP_ERR_INVALID_OPT_CFG     Invalid TCP option configuration.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktValidateOpt().
+*
+* Note(s)     : (1) RFC #7323, Section 2.3 states that "the Window Scale option MUST only be sent in a
+*                   <SYN> segment" & that the shift count MUST NOT exceed 14.
+*********************************************************************************************************
+*/
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+#if (NET_TCP_CFG_WIN_SCALE_EN  == DEF_ENABLED)
+static  void  NetTCP_TxPktValidateOptWinScale (void            *p_opt_tcp,
+                                               CPU_INT08U      *p_opt_len,
+                                               void           **p_opt_next,
+                                               NET_TCP_FLAGS    flags_tcp,
+                                               NET_ERR         *p_err)
+{
+    NET_TCP_OPT_CFG_WIN_SCALE  *p_opt_cfg_win_scale;
+    CPU_BOOLEAN                 flags_tcp_syn;
+
+
+    p_opt_cfg_win_scale = (NET_TCP_OPT_CFG_WIN_SCALE *)p_opt_tcp;
+
+                                                                /* --------------- VALIDATE SHIFT CNT ----------------- */
+    if (p_opt_cfg_win_scale->Shift > NET_TCP_OPT_WIN_SCALE_SHIFT_MAX) {
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+                                                                /* -------------- VALIDATE OPT CFG/CTRL --------------- */
+    flags_tcp_syn = DEF_BIT_IS_SET(flags_tcp, NET_TCP_HDR_FLAG_SYNC);
+    if (flags_tcp_syn != DEF_YES) {                             /* If 'SYN' bit NOT set, rtn err (see Note #1).         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_OPT_SIZE_WIN_SCALE;
+   *p_opt_next = p_opt_cfg_win_scale->NextOptPtr;
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                NetTCP_TxPktValidateOptSACK_Permit()
+*
+* Description : Validate TCP SACK Permitted option configuration.
+*
+* Argument(s) : p_opt_tcp    Pointer to TCP SACK Permitted option configuration data structure.
+*               --------    Argument checked   in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP SACK Permitted option length
+*               --------        (in octets).
+*
+*                           Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               ---------   Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP SACK Permitted option configuration
+*                                                                   validated.
+*                               NET_TCP_ERR_INVALID_OPT_CFG     Invalid TCP option configuration.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktValidateOpt().
+*
+* Note(s)     : (1) RFC #2018, Section 2 states that the SACK Permitted option "MUST NOT be sent on
+*                   non-SYN segments".
+*********************************************************************************************************
+*/
+
+#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
+#if (NET_TCP_CFG_SACK_EN        == DEF_ENABLED)
+static  void  NetTCP_TxPktValidateOptSACK_Permit (void            *p_opt_tcp,
+                                                  CPU_INT08U      *p_opt_len,
+                                                  void           **p_opt_next,
+                                                  NET_TCP_FLAGS    flags_tcp,
+                                                  NET_ERR         *p_err)
+{
+    NET_TCP_OPT_CFG_SACK_PERMIT  *p_opt_cfg_sack_permit;
+    CPU_BOOLEAN                   flags_tcp_syn;
+
+
+    p_opt_cfg_sack_permit = (NET_TCP_OPT_CFG_SACK_PERMIT *)p_opt_tcp;
+
+                                                                /* -------------- VALIDATE OPT CFG/CTRL --------------- */
+    flags_tcp_syn = DEF_BIT_IS_SET(flags_tcp, NET_TCP_HDR_FLAG_SYNC);
+    if (flags_tcp_syn != DEF_YES) {                             /* If 'SYN' bit NOT set, rtn err (see Note #1).         */
+        NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
+       *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
+        return;
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_OPT_SIZE_SACK_PERMIT;
+   *p_opt_next = p_opt_cfg_sack_permit->NextOptPtr;
+   *p_err      = NET_TCP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_TxPktValidateOptSACK()
+*
+* Description : Validate TCP SACK option configuration.
+*
+* Argument(s) : p_opt_tcp    Pointer to TCP SACK option configuration data structure.
+*               --------    Argument checked   in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_len    Pointer to variable that will receive the TCP SACK option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               ---------   Argument validated in NetTCP_TxPktValidateOpt().
+*
+*               flags_tcp   Flags to select TCP transmit options; bit-field flags logically OR'd.
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP SACK option configuration validated.
+*                               NET_TCP_ERR_INVALID_OPT_CFG     Invalid TCP option configuration.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktValidateOpt().
+*
+* Note(s)     : (1) A SACK option carries at least one & at most four blocks (see RFC #2018, Section 3).
+*
+*               (2) SACK information reports received out-of-order data & is therefore meaningless on a
+*                   'SYN' segment.
 *********************************************************************************************************
 */
 
-#if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
-static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
-                                                 CPU_INT08U      *p_opt_len,
-                                                 void           **p_opt_next,
-                                                 NET_TCP_FLAGS    flags_tcp,
-                                                 NET_ERR         *p_err)
+static  void  NetTCP_TxPktValidateOptSACK (void            *p_opt_tcp,
+                                           CPU_INT08U      *p_opt_len,
+                                           void           **p_opt_next,
+                                           NET_TCP_FLAGS    flags_tcp,
+                                           NET_ERR         *p_err)
 {
-    NET_TCP_OPT_CFG_MAX_SEG_SIZE  *p_opt_cfg_max_seg_size;
-    CPU_BOOLEAN                    flags_tcp_syn;
+    NET_TCP_OPT_CFG_SACK  *p_opt_cfg_sack;
+    CPU_BOOLEAN            flags_tcp_syn;
 
 
-    p_opt_cfg_max_seg_size = (NET_TCP_OPT_CFG_MAX_SEG_SIZE *)p_opt_tcp;
-
+    p_opt_cfg_sack = (NET_TCP_OPT_CFG_SACK *)p_opt_tcp;
 
-                                                                /* -------------- VALIDATE MAX SEG SIZE --------------- */
-                                                                /* If max seg size > max, rtn err.                      */
-    if (p_opt_cfg_max_seg_size->MaxSegSize > NET_TCP_MAX_SEG_SIZE_MAX) {
+                                                                /* ---------------- VALIDATE BLK NBR ------------------ */
+    if ((p_opt_cfg_sack->BlkNbr < 1u) ||                        /* See Note #1.                                         */
+        (p_opt_cfg_sack->BlkNbr > NET_TCP_OPT_SACK_BLK_NBR_MAX)) {
         NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
        *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
         return;
@@ -28840,7 +31326,7 @@ static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
 
                                                                 /* -------------- VALIDATE OPT CFG/CTRL --------------- */
     flags_tcp_syn = DEF_BIT_IS_SET(flags_tcp, NET_TCP_HDR_FLAG_SYNC);
-    if (flags_tcp_syn != DEF_YES) {                             /* If 'SYN' bit NOT set, rtn err (see Note #3).         */
+    if (flags_tcp_syn != DEF_NO) {                              /* If 'SYN' bit set, rtn err (see Note #2).             */
         NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxHdrOptCfgCtr);
        *p_err = NET_TCP_ERR_INVALID_OPT_CFG;
         return;
@@ -28848,11 +31334,12 @@ static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
 
 
                                                                 /* ------------------- RTN OPT VALS ------------------- */
-   *p_opt_len  = NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE;
-   *p_opt_next = p_opt_cfg_max_seg_size->NextOptPtr;
+   *p_opt_len  = (CPU_INT08U)(NET_TCP_OPT_SIZE_SACK_HDR + (p_opt_cfg_sack->BlkNbr * NET_TCP_OPT_SACK_BLK_SIZE));
+   *p_opt_next = p_opt_cfg_sack->NextOptPtr;
    *p_err      = NET_TCP_ERR_NONE;
 }
 #endif
+#endif
 
 
 /*
@@ -28924,6 +31411,10 @@ static  void  NetTCP_TxPktValidateOptMaxSegSize (void            *p_opt_tcp,
 *               ---------
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *                           Argument checked   in NetTCP_TxPktValidate().
 *
@@ -29116,6 +31607,10 @@ static  void  NetTCP_TxPktIPv4 (NET_BUF           *p_buf,
 *               ---------
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *                           Argument checked   in NetTCP_TxPktValidate().
 *
@@ -29258,6 +31753,10 @@ static  void  NetTCP_TxPktIPv6 (NET_BUF                 *p_buf,
 *               ---------
 *                               NULL                            NO  TCP transmit         options configuration.
 *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+*                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
+*                               NET_TCP_OPT_CFG_SACK_PERMIT     TCP SACK Permitted       options configuration.
+*                               NET_TCP_OPT_CFG_SACK            TCP SACK                 options configuration.
+*                               NET_TCP_OPT_CFG_TS              TCP Timestamp            options configuration.
 *
 *                           Argument checked   in NetTCP_TxPkt().
 *
@@ -29322,14 +31821,32 @@ static  CPU_INT08U  NetTCP_TxPktPrepareOpt (void        *p_opts_tcp,
             case NET_TCP_OPT_TYPE_MAX_SEG_SIZE:
                  NetTCP_TxPktPrepareOptMaxSegSize(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
                  break;
-                                                                /* --------------- UNSUPPORTED TCP OPTS --------------- */
-                                                                /* See Note #3b.                                        */
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
             case NET_TCP_OPT_TYPE_WIN_SCALE:
+                 NetTCP_TxPktPrepareOptWinScale(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
+                 break;
+#endif
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
             case NET_TCP_OPT_TYPE_SACK_PERMIT:
+                 NetTCP_TxPktPrepareOptSACK_Permit(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
+                 break;
+
             case NET_TCP_OPT_TYPE_SACK:
+                 NetTCP_TxPktPrepareOptSACK(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
+                 break;
+#endif
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+            case NET_TCP_OPT_TYPE_TS:
+                 NetTCP_TxPktPrepareOptTS(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next, p_err);
+                 break;
+#endif
+                                                                /* --------------- UNSUPPORTED TCP OPTS --------------- */
+                                                                /* See Note #3b.                                        */
             case NET_TCP_OPT_TYPE_ECHO_REQ:
             case NET_TCP_OPT_TYPE_ECHO_REPLY:
-            case NET_TCP_OPT_TYPE_TS:
             case NET_TCP_OPT_TYPE_NONE:                         /* ----------------- INVALID TCP OPTS ----------------- */
             default:                                            /* See Note #7.                                         */
                  NET_CTR_ERR_INC(Net_ErrCtrs.TCP.TxOptTypeCtr);
@@ -29469,6 +31986,303 @@ static  void  NetTCP_TxPktPrepareOptMaxSegSize (void         *p_opts_tcp,
 
 
 
+/*
+*********************************************************************************************************
+*                                  NetTCP_TxPktPrepareOptWinScale()
+*
+* Description : (1) Prepare TCP header with TCP Window Scale option :
+*
+*                   (a) Prepare TCP Window Scale option
+*                   (b) Return option values
+*
+*
+* Argument(s) : p_opts_tcp   Pointer to TCP Window Scale option configuration data structure.
+*               ---------   Argument checked   in NetTCP_TxPkt().
+*
+*               p_opt_hdr    Pointer to TCP transmit option buffer to prepare TCP Window Scale option.
+*               --------    Argument validated in NetTCP_TxPkt().
+*
+*               p_opt_len    Pointer to variable that will receive the returned TCP option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Window Scale option successfully prepared.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktPrepareOpt().
+*
+* Note(s)     : (2) RFC #7323, Section 2.2 states that the Window Scale option "SHOULD be preceded by a
+*                   No-Operation option" so that the following options stay aligned on a 32-bit word.
+*
+*               (3) See 'NetTCP_TxPktPrepareOptMaxSegSize()  Note #4'.
+*********************************************************************************************************
+*/
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static  void  NetTCP_TxPktPrepareOptWinScale (void         *p_opts_tcp,
+                                              CPU_INT08U   *p_opt_hdr,
+                                              CPU_INT08U   *p_opt_len,
+                                              void        **p_opt_next,
+                                              NET_ERR      *p_err)
+{
+    NET_TCP_OPT_CFG_WIN_SCALE  *p_opt_cfg_win_scale;
+    CPU_INT08U                 *p_opt_cfg_hdr;
+
+
+                                                                /* -------------- PREPARE WIN SCALE OPT --------------- */
+    p_opt_cfg_win_scale = (NET_TCP_OPT_CFG_WIN_SCALE *)p_opts_tcp;
+    p_opt_cfg_hdr       =  p_opt_hdr;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;                        /* Prepare NOP (see Note #2).                           */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_WIN_SCALE;                  /* Prepare opt type.                                    */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_LEN_WIN_SCALE;              /* Prepare opt len.                                     */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = p_opt_cfg_win_scale->Shift;                 /* Prepare shift cnt.                                   */
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_OPT_SIZE_WIN_SCALE;
+   *p_opt_next = p_opt_cfg_win_scale->NextOptPtr;
+
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                NetTCP_TxPktPrepareOptSACK_Permit()
+*
+* Description : Prepare TCP header with TCP SACK Permitted option.
+*
+* Argument(s) : p_opts_tcp   Pointer to TCP SACK Permitted option configuration data structure.
+*               ---------   Argument checked   in NetTCP_TxPkt().
+*
+*               p_opt_hdr    Pointer to TCP transmit option buffer to prepare TCP SACK Permitted option.
+*               --------    Argument validated in NetTCP_TxPkt().
+*
+*               p_opt_len    Pointer to variable that will receive the returned TCP option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP SACK Permitted option successfully prepared.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktPrepareOpt().
+*
+* Note(s)     : (1) The option is preceded by two No-Operation options to keep the following options
+*                   aligned on a 32-bit word (see RFC #2018, Section 2).
+*********************************************************************************************************
+*/
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+static  void  NetTCP_TxPktPrepareOptSACK_Permit (void         *p_opts_tcp,
+                                                 CPU_INT08U   *p_opt_hdr,
+                                                 CPU_INT08U   *p_opt_len,
+                                                 void        **p_opt_next,
+                                                 NET_ERR      *p_err)
+{
+    NET_TCP_OPT_CFG_SACK_PERMIT  *p_opt_cfg_sack_permit;
+    CPU_INT08U                   *p_opt_cfg_hdr;
+
+
+                                                                /* ------------- PREPARE SACK PERMIT OPT -------------- */
+    p_opt_cfg_sack_permit = (NET_TCP_OPT_CFG_SACK_PERMIT *)p_opts_tcp;
+    p_opt_cfg_hdr         =  p_opt_hdr;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;                        /* Prepare NOPs (see Note #1).                          */
+    p_opt_cfg_hdr++;
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_SACK_PERMIT;                /* Prepare opt type.                                    */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_LEN_SACK_PERMIT;            /* Prepare opt len.                                     */
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_OPT_SIZE_SACK_PERMIT;
+   *p_opt_next = p_opt_cfg_sack_permit->NextOptPtr;
+
+   *p_err      = NET_TCP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    NetTCP_TxPktPrepareOptSACK()
+*
+* Description : (1) Prepare TCP header with TCP SACK option :
+*
+*                   (a) Prepare TCP SACK option header
+*                   (b) Prepare TCP SACK option blocks
+*                   (c) Return option values
+*
+*
+* Argument(s) : p_opts_tcp   Pointer to TCP SACK option configuration data structure.
+*               ---------   Argument checked   in NetTCP_TxPkt().
+*
+*               p_opt_hdr    Pointer to TCP transmit option buffer to prepare TCP SACK option.
+*               --------    Argument validated in NetTCP_TxPkt().
+*
+*               p_opt_len    Pointer to variable that will receive the returned TCP option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP SACK option successfully prepared.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktPrepareOpt().
+*
+* Note(s)     : (2) The option is preceded by two No-Operation options so that each SACK block edge
+*                   starts on a 32-bit word (see RFC #2018, Section 3).
+*
+*               (3) Block edges are written with unaligned big-endian stores since the option buffer is
+*                   NOT guaranteed to be word-aligned (see 'NetTCP_TxPktPrepareOptMaxSegSize()  Note #4').
+*********************************************************************************************************
+*/
+
+static  void  NetTCP_TxPktPrepareOptSACK (void         *p_opts_tcp,
+                                          CPU_INT08U   *p_opt_hdr,
+                                          CPU_INT08U   *p_opt_len,
+                                          void        **p_opt_next,
+                                          NET_ERR      *p_err)
+{
+    NET_TCP_OPT_CFG_SACK  *p_opt_cfg_sack;
+    CPU_INT08U            *p_opt_cfg_hdr;
+    CPU_INT08U             opt_len;
+    CPU_INT08U             blk_ix;
+
+
+                                                                /* ---------------- PREPARE SACK OPT ------------------ */
+    p_opt_cfg_sack = (NET_TCP_OPT_CFG_SACK *)p_opts_tcp;
+    p_opt_cfg_hdr  =  p_opt_hdr;
+    opt_len        = (CPU_INT08U)(NET_TCP_HDR_OPT_LEN_MIN_LEN + (p_opt_cfg_sack->BlkNbr * NET_TCP_OPT_SACK_BLK_SIZE));
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;                        /* Prepare NOPs (see Note #2).                          */
+    p_opt_cfg_hdr++;
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_SACK;                       /* Prepare opt type.                                    */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = opt_len;                                    /* Prepare opt len.                                     */
+    p_opt_cfg_hdr++;
+
+                                                                /* Prepare SACK blks (see Notes #1b & #3).              */
+    for (blk_ix = 0u; blk_ix < p_opt_cfg_sack->BlkNbr; blk_ix++) {
+        NET_UTIL_VAL_SET_NET_32(p_opt_cfg_hdr, p_opt_cfg_sack->Blks[blk_ix].LeftEdge);
+        p_opt_cfg_hdr += sizeof(NET_TCP_SEQ_NBR);
+        NET_UTIL_VAL_SET_NET_32(p_opt_cfg_hdr, p_opt_cfg_sack->Blks[blk_ix].RightEdge);
+        p_opt_cfg_hdr += sizeof(NET_TCP_SEQ_NBR);
+    }
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = (CPU_INT08U)(opt_len + (2u * NET_TCP_HDR_OPT_LEN_NOP));
+   *p_opt_next = p_opt_cfg_sack->NextOptPtr;
+
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     NetTCP_TxPktPrepareOptTS()
+*
+* Description : Prepare TCP header with TCP Timestamp option.
+*
+* Argument(s) : p_opts_tcp   Pointer to TCP Timestamp option configuration data structure.
+*               ---------   Argument checked   in NetTCP_TxPkt().
+*
+*               p_opt_hdr    Pointer to TCP transmit option buffer to prepare TCP Timestamp option.
+*               --------    Argument validated in NetTCP_TxPkt().
+*
+*               p_opt_len    Pointer to variable that will receive the returned TCP option length (in octets).
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_opt_next   Pointer to variable that will receive the pointer to the next TCP transmit option.
+*               --------    Argument validated in NetTCP_TxPktPrepareOpt().
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_TCP_ERR_NONE                TCP Timestamp option successfully prepared.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_TxPktPrepareOpt().
+*
+* Note(s)     : (1) RFC #7323, Appendix A recommends the layout <NOP, NOP, TS> so that both timestamp
+*                   values start on a 32-bit word.
+*
+*               (2) See 'NetTCP_TxPktPrepareOptSACK()  Note #3'.
+*********************************************************************************************************
+*/
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+static  void  NetTCP_TxPktPrepareOptTS (void         *p_opts_tcp,
+                                        CPU_INT08U   *p_opt_hdr,
+                                        CPU_INT08U   *p_opt_len,
+                                        void        **p_opt_next,
+                                        NET_ERR      *p_err)
+{
+    NET_TCP_OPT_CFG_TS  *p_opt_cfg_ts;
+    CPU_INT08U          *p_opt_cfg_hdr;
+
+
+                                                                /* ----------------- PREPARE TS OPT ------------------- */
+    p_opt_cfg_ts  = (NET_TCP_OPT_CFG_TS *)p_opts_tcp;
+    p_opt_cfg_hdr =  p_opt_hdr;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;                        /* Prepare NOPs (see Note #1).                          */
+    p_opt_cfg_hdr++;
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_TS;                         /* Prepare opt type.                                    */
+    p_opt_cfg_hdr++;
+
+   *p_opt_cfg_hdr = NET_TCP_HDR_OPT_LEN_TS;                     /* Prepare opt len.                                     */
+    p_opt_cfg_hdr++;
+                                                                /* Prepare TS vals (see Note #2).                       */
+    NET_UTIL_VAL_SET_NET_32(p_opt_cfg_hdr, p_opt_cfg_ts->TS_Val);
+    p_opt_cfg_hdr += sizeof(NET_TS_MS);
+    NET_UTIL_VAL_SET_NET_32(p_opt_cfg_hdr, p_opt_cfg_ts->TS_EchoReply);
+
+
+                                                                /* ------------------- RTN OPT VALS ------------------- */
+   *p_opt_len  = NET_TCP_OPT_SIZE_TS;
+   *p_opt_next = p_opt_cfg_ts->NextOptPtr;
+
+   *p_err      = NET_TCP_ERR_NONE;
+}
+#endif
+
+
+
 /*
 *********************************************************************************************************
 *                                      NetTCP_TxPktPrepareHdr()
@@ -29989,6 +32803,14 @@ static  void  NetTCP_ConnCfg (NET_TCP_CONN      *p_conn,
 *                   (c) TCP connection's maximum transmit remote window size ('TxWinSizeRemoteMax')
 *                           [see 'NetTCP_RxPktConnHandlerTxWinRemote()   Note  #1a2A'
 *                              & 'NetTCP_TxConnWinSizeHandlerCongCtrl()  Notes #3a2A & #3b']
+*
+*                   (d) TCP connection's negotiated options ('OptEn')
+*                           [see 'NetTCP_ConnOptNegotiate()  Note #1']
+*
+*               (4) RFC #1122, Section 4.2.2.6 states that the maximum segment size "does not include
+*                   the TCP header ... or ... options".  Since the timestamp option is transmitted on
+*                   every segment, the connection maximum segment size is reduced by the size of the
+*                   timestamp option so that full-sized segments do NOT exceed the remote host's MSS.
 *********************************************************************************************************
 */
 
@@ -30006,6 +32828,59 @@ static  void  NetTCP_ConnCfgMaxSegSize (NET_TCP_CONN  *p_conn)
                                                                 /* Cfg conn max seg size    (see Note #1).              */
     p_conn->MaxSegSizeConn = (NET_TCP_SEG_SIZE)DEF_MIN(p_conn->MaxSegSizeLocalActual,
                                                        remote_max_seg_size);
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+    if (DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_TS) == DEF_YES) {
+        if (p_conn->MaxSegSizeConn > (NET_TCP_SEG_SIZE)(NET_TCP_OPT_SIZE_TS + 1u)) {
+            p_conn->MaxSegSizeConn -= NET_TCP_OPT_SIZE_TS;      /* Excl TS opt from conn max seg size (see Note #4).    */
+        }
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      NetTCP_ConnOptNegotiate()
+*
+* Description : Negotiate TCP connection's options with remote host.
+*
+* Argument(s) : p_conn      Pointer to a TCP connection.
+*               -----       Argument validated in NetTCP_RxPktConnHandler().
+*
+*               p_buf_hdr   Pointer to received synchronization segment's network buffer header.
+*               ---------   Argument validated in NetTCP_RxPktConnHandler().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetTCP_RxPktConnHandlerListen(),
+*               NetTCP_RxPktConnHandlerSyncTxd().
+*
+* Note(s)     : (1) An option is enabled on a connection only if it is configured on the connection &
+*                   offered by the remote host in its synchronization segment (see 'net_tcp.h  TCP
+*                   OPTION ENABLE DEFINES  Note #1b').
+*
+*                   (a) RFC #7323, Section 2.2 states that "if a Window Scale option is received ...
+*                       [but] not sent ... both ... shift counts [are] zero".
+*
+*                   (b) RFC #7323, Section 3.2 states that "if ... the TSopt [is received in] the
+*                       initial <SYN> segment ... TS.Recent [is set to] the TSval".
+*********************************************************************************************************
+*/
+
+static  void  NetTCP_ConnOptNegotiate (NET_TCP_CONN  *p_conn,
+                                       NET_BUF_HDR   *p_buf_hdr)
+{
+    p_conn->OptEn            = p_conn->OptCfgd & p_buf_hdr->TCP_OptFlags;
+    p_conn->TxWinScaleRemote = 0u;
+
+    if (DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_WIN_SCALE) == DEF_YES) {
+        p_conn->TxWinScaleRemote = p_buf_hdr->TCP_WinScale;     /* See Note #1a.                                        */
+    }
+
+    if (DEF_BIT_IS_SET(p_conn->OptEn, NET_TCP_OPT_EN_TS) == DEF_YES) {
+        p_conn->TS_Recent        = p_buf_hdr->TCP_TS_Val;       /* See Note #1b.                                        */
+    }
 }
 
 
@@ -30878,6 +33753,13 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
     p_conn->MaxSegSizeConn               =  NET_TCP_MAX_SEG_SIZE_NONE;
 #endif
 
+    p_conn->OptCfgd                      =  NET_TCP_OPT_EN_CFG; /* See 'net_tcp.h  TCP OPTION ENABLE DEFINES  Note #1a'.*/
+    p_conn->OptEn                        =  NET_TCP_OPT_EN_NONE;
+    p_conn->TxWinScaleRemote             =  0u;
+    p_conn->TS_Recent                    =  0u;
+    p_conn->TS_LastAckSent               =  0u;
+    p_conn->RxSACK_SeqNbrLast            =  0u;
+
 
 
     p_conn->RxSeqNbrSync                 =  NET_TCP_SEQ_NBR_NONE;
@@ -30945,9 +33827,16 @@ static  void  NetTCP_ConnClr (NET_TCP_CONN  *p_conn)
 
     p_conn->TxAckDlyTmr                  =  DEF_NULL;
     p_conn->TxAckDlyCnt                  =  0u;
+    p_conn->TxAckDlyCntTh                =  NET_TCP_ACK_DLY_CNT_TH;
+    p_conn->TxAckQuickCnt                =  0u;
+    p_conn->TxAckPingPongCtr             =  0u;
+    p_conn->RxDataLastTS_ms              =  0u;
 
     p_conn->TxAckImmedRxdPushEn          =  DEF_ENABLED;        /* See Note #9.                                         */
 
+    p_conn->TxCorkEn                     =  DEF_DISABLED;
+    p_conn->TxCorkFlush                  =  DEF_NO;
+
 
     p_conn->TxKeepAliveEn                =  DEF_DISABLED;       /* See Note #10a.                                       */
     p_conn->TxKeepAliveCtr               =  0u;
@@ -31074,6 +33963,8 @@ static  void  NetTCP_ConnCopy (NET_TCP_CONN  *p_conn_dest,
 
     p_conn_dest->MaxSegSizeLocalCfgd         = p_conn_src->MaxSegSizeLocalCfgd;
 
+    p_conn_dest->OptCfgd                     = p_conn_src->OptCfgd;
+
 
     p_conn_dest->RxWinSizeCfgd               = p_conn_src->RxWinSizeCfgd;
 
@@ -31083,6 +33974,7 @@ static  void  NetTCP_ConnCopy (NET_TCP_CONN  *p_conn_dest,
 
     p_conn_dest->TxAckDlyTimeout_ms          = p_conn_src->TxAckDlyTimeout_ms;
     p_conn_dest->TxAckDlyTimeout_tick        = p_conn_src->TxAckDlyTimeout_tick;
+    p_conn_dest->TxAckDlyCntTh               = p_conn_src->TxAckDlyCntTh;
     p_conn_dest->TxAckImmedRxdPushEn         = p_conn_src->TxAckImmedRxdPushEn;
 
     p_conn_dest->TxKeepAliveEn               = p_conn_src->TxKeepAliveEn;
@@ -41,16 +41,17 @@
 *                                                                                'The Communication of
 *                                                                                  Urgent Information'
 *
-*                     (c) The following TCP options NOT supported :
-*
-*                         (1) Window Scale                                      RFC #1072, Section 2
-*                                                                               RFC #1323, Section 2
-*                         (2) Selective Acknowledgement (SACK)                  RFC #1072, Section 3
-*                                                                               RFC #2018
-*                                                                               RFC #2883
-*                         (3) TCP Echo                                          RFC #1072, Section 4
-*                         (4) Timestamp                                         RFC #1323, Section 3.2
-*                         (5) Protection Against Wrapped Sequences (PAWS)       RFC #1323, Section 4
+*                     (c) The following TCP options are supported with restrictions (see 'TCP OPTION
+*                         ENABLE DEFINES  Note #1') :
+*
+*                         (1) Window Scale                                      RFC #7323, Section 2
+*                               Remote windows scaled; local window NOT scaled
+*                         (2) Selective Acknowledgement (SACK)                  RFC #2018
+*                               D-SACK                 NOT supported            RFC #2883
+*                         (3) TCP Echo                 NOT supported            RFC #1072, Section 4
+*                         (4) Timestamp                                         RFC #7323, Section 3
+*                         (5) Protection Against Wrapped Sequences (PAWS)       RFC #7323, Section 5
+*                               NOT supported
 *
 *                     (d) IP-Options-to-TCP-Connection                          RFC #1122, Section 4.2.3.8
 *                                Handling NOT supported #### NET-804
@@ -190,6 +191,21 @@
 #endif
 
 
+#ifndef  NET_TCP_CFG_WIN_SCALE_EN
+                                                                /* Configure TCP options (see 'TCP OPTION ENABLE ...    */
+                                                                /* ... DEFINES  Note #1') :                             */
+    #define  NET_TCP_CFG_WIN_SCALE_EN                   DEF_ENABLED
+#endif
+
+#ifndef  NET_TCP_CFG_SACK_EN
+    #define  NET_TCP_CFG_SACK_EN                        DEF_ENABLED
+#endif
+
+#ifndef  NET_TCP_CFG_TS_EN
+    #define  NET_TCP_CFG_TS_EN                          DEF_ENABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         TCP HEADER DEFINES
@@ -550,6 +566,84 @@ typedef  enum  net_tcp_opt_type {
 } NET_TCP_OPT_TYPE;
 
 
+/*
+*********************************************************************************************************
+*                                      TCP OPTION ENABLE DEFINES
+*
+* Note(s) : (1) (a) Window Scale, Selective Acknowledgement (SACK) & Timestamp options are each enabled at
+*                   compile-time by NET_TCP_CFG_WIN_SCALE_EN, NET_TCP_CFG_SACK_EN & NET_TCP_CFG_TS_EN.
+*                   A compile-time enabled option is offered on every connection's synchronization
+*                   segment by default, but may be disabled per connection by NetTCP_ConnCfgOpt().
+*
+*               (b) An option is used on a connection ONLY if both hosts offered it in their
+*                   synchronization segments (see RFC #7323, Sections 2.2 & 3.2 & RFC #2018, Section 2).
+*
+*               (c) (1) TCP windows are 16-bit (see 'net_tcp.h  TCP WINDOW SIZE DATA TYPE'); local windows
+*                       are therefore advertised with a window scale shift of 0.  Remote windows are
+*                       scaled by the remote host's shift, but limited to NET_TCP_WIN_SIZE_MAX.
+*
+*                   (2) PAWS (see RFC #7323, Section 5) is NOT enforced; received timestamps are used
+*                       ONLY to measure round-trip times & to echo the most recent timestamp.
+*
+*                   (3) SACK blocks are sent ONLY in acknowledgement-only segments.  Segments reported by
+*                       the remote host's SACK blocks are skipped when re-transmitting after a fast re-
+*                       transmit, but all are re-transmitted after a re-transmit timeout (see RFC #2018,
+*                       Section 8).
+*
+*           (2) RFC #7323, Section 2.3 limits the window scale shift to 14.
+*
+*           (3) A SACK option carries at most 4 blocks; at most 3 if the Timestamp option is also sent.
+*********************************************************************************************************
+*/
+
+#define  NET_TCP_OPT_EN_NONE                      DEF_BIT_NONE
+#define  NET_TCP_OPT_EN_WIN_SCALE                 DEF_BIT_00
+#define  NET_TCP_OPT_EN_SACK                      DEF_BIT_01
+#define  NET_TCP_OPT_EN_TS                        DEF_BIT_02
+
+#define  NET_TCP_OPT_EN_ALL                      (NET_TCP_OPT_EN_WIN_SCALE | \
+                                                  NET_TCP_OPT_EN_SACK      | \
+                                                  NET_TCP_OPT_EN_TS)
+
+                                                                /* Opts en'd at compile-time (see Note #1a).            */
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+#define  NET_TCP_OPT_EN_CFG_WIN_SCALE             NET_TCP_OPT_EN_WIN_SCALE
+#else
+#define  NET_TCP_OPT_EN_CFG_WIN_SCALE             NET_TCP_OPT_EN_NONE
+#endif
+
+#if (NET_TCP_CFG_SACK_EN == DEF_ENABLED)
+#define  NET_TCP_OPT_EN_CFG_SACK                  NET_TCP_OPT_EN_SACK
+#else
+#define  NET_TCP_OPT_EN_CFG_SACK                  NET_TCP_OPT_EN_NONE
+#endif
+
+#if (NET_TCP_CFG_TS_EN == DEF_ENABLED)
+#define  NET_TCP_OPT_EN_CFG_TS                    NET_TCP_OPT_EN_TS
+#else
+#define  NET_TCP_OPT_EN_CFG_TS                    NET_TCP_OPT_EN_NONE
+#endif
+
+#define  NET_TCP_OPT_EN_CFG                      (NET_TCP_OPT_EN_CFG_WIN_SCALE | \
+                                                  NET_TCP_OPT_EN_CFG_SACK      | \
+                                                  NET_TCP_OPT_EN_CFG_TS)
+
+
+#define  NET_TCP_OPT_WIN_SCALE_SHIFT_MAX                  14u   /* See Note #2.                                         */
+
+#define  NET_TCP_OPT_SACK_BLK_NBR_MAX                      4u   /* See Note #3.                                         */
+#define  NET_TCP_OPT_SACK_BLK_NBR_MAX_TS                   3u
+#define  NET_TCP_OPT_SACK_BLK_SIZE                         8u
+
+#define  NET_TCP_OPT_SACK_RE_TX_SEG_MAX                    4u   /* Max nbr of SACK holes re-tx'd per fast re-tx.        */
+
+                                                                /* Sizes of aligned opts, incl. NOP pad (see Note #1c). */
+#define  NET_TCP_OPT_SIZE_WIN_SCALE                        4u
+#define  NET_TCP_OPT_SIZE_SACK_PERMIT                      4u
+#define  NET_TCP_OPT_SIZE_TS                              12u
+#define  NET_TCP_OPT_SIZE_SACK_HDR                         4u
+
+
 /*
 *********************************************************************************************************
 *                                   TCP CONNECTION TIMEOUT DEFINES
@@ -872,6 +966,9 @@ typedef  enum  net_tcp_opt_type {
 *                       with this requirement ... by acknowledging at least every second segment, regardless
 *                       of size".
 *
+*                   (3) Each connection may raise its delayed acknowledgement count threshold to acknowledge
+*                       fewer, larger runs of small segments (see 'net_tcp.c  NetTCP_ConnCfgTxAckDlyCntTh()').
+*
 *               (b) (1) (A) RFC #1122, Section 4.2.3.2 states that "an ACK should not be excessively delayed;
 *                           in particular, the delay MUST be less than 0.5 seconds".
 *
@@ -881,6 +978,16 @@ typedef  enum  net_tcp_opt_type {
 *                   (2) However, Stevens, TCP/IP Illustrated, Volume 1, 8th Printing, Section 19.3, Page 265
 *                       states that "most implementations use a 200-ms delay".
 *
+*               (c) After the receive direction has been idle for longer than the connection's RTO, the
+*                   next NET_TCP_ACK_QUICK_CNT_TH data segments are acknowledged immediately so that the
+*                   remote host's congestion window re-opens without waiting on delayed acknowledgements;
+*                   unless the connection is exchanging interactive (request/response) traffic.
+*
+*               (d) Once NET_TCP_ACK_PING_PONG_TH consecutive data transmits have each followed received
+*                   data within the acknowledgement delay timeout, the connection is deemed interactive &
+*                   acknowledgements for pushed segments are delayed so that they ride on the reply.  Any
+*                   delayed acknowledgement timeout restarts this detection.
+*
 *               See also 'net_tcp.c  NetTCP_TxConnAck()  Note #6'.
 *
 *           (7) RFC #1122, Section 4.2.3.5 states that "excessive retransmission of the same segment by TCP
@@ -1008,6 +1115,11 @@ typedef  enum  net_tcp_opt_type {
 
 
 #define  NET_TCP_ACK_DLY_CNT_TH                            2                    /* See Note #6a.                        */
+#define  NET_TCP_ACK_DLY_CNT_TH_MIN                        1
+#define  NET_TCP_ACK_DLY_CNT_TH_MAX                       16                    /* See Note #6a3.                       */
+
+#define  NET_TCP_ACK_QUICK_CNT_TH                          2                    /* See Note #6c.                        */
+#define  NET_TCP_ACK_PING_PONG_TH                          3                    /* See Note #6d.                        */
 
 #define  NET_TCP_ACK_DLY_TIME_MIN_MS                       0
 #define  NET_TCP_ACK_DLY_TIME_MAX_MS                     500                    /* See Note #6b1.                       */
@@ -1580,6 +1692,65 @@ typedef  struct  net_tcp_opt_cfg_max_seg_size {
 } NET_TCP_OPT_CFG_MAX_SEG_SIZE;
 
 
+/*
+*********************************************************************************************************
+*                           TCP WINDOW SCALE OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_cfg_win_scale {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT08U              Shift;                              /* TCP win scale shift.                                 */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_WIN_SCALE;
+
+
+/*
+*********************************************************************************************************
+*                          TCP SACK PERMITTED OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_cfg_sack_permit {
+    NET_TCP_OPT_TYPE        Type;
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_SACK_PERMIT;
+
+
+/*
+*********************************************************************************************************
+*                                TCP SACK OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_sack_blk {
+    NET_TCP_SEQ_NBR         LeftEdge;                           /* First seq nbr of blk.                                */
+    NET_TCP_SEQ_NBR         RightEdge;                          /* Seq nbr following last seq nbr of blk.               */
+} NET_TCP_OPT_SACK_BLK;
+
+
+typedef  struct  net_tcp_opt_cfg_sack {
+    NET_TCP_OPT_TYPE        Type;
+    CPU_INT08U              BlkNbr;                             /* Nbr of SACK blks.                                    */
+    NET_TCP_OPT_SACK_BLK    Blks[NET_TCP_OPT_SACK_BLK_NBR_MAX]; /* SACK blks.                                           */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_SACK;
+
+
+/*
+*********************************************************************************************************
+*                             TCP TIMESTAMP OPTION CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  net_tcp_opt_cfg_ts {
+    NET_TCP_OPT_TYPE        Type;
+    NET_TS_MS               TS_Val;                             /* TCP TS val.                                          */
+    NET_TS_MS               TS_EchoReply;                       /* TCP TS echo reply.                                   */
+    void                   *NextOptPtr;                         /* Ptr to next TCP opt cfg.                             */
+} NET_TCP_OPT_CFG_TS;
+
+
 /*
 *********************************************************************************************************
 *                                   APP CALLBACK FUNCTION DATA TYPE
@@ -1651,6 +1822,14 @@ struct  net_tcp_conn {
     NET_TCP_SEG_SIZE                     MaxSegSizeRemote;              /*       Max seg size        advertised by remote host. */
     NET_TCP_SEG_SIZE                     MaxSegSizeConn;                /*       Max seg size calc'd for conn.                  */
 
+                                                                        /* Opts (see 'TCP OPTION ENABLE DEFINES  Note #1') :    */
+    CPU_INT08U                           OptCfgd;                       /* Opts cfg'd  to offer to remote host.                 */
+    CPU_INT08U                           OptEn;                         /* Opts en'd   by both hosts.                           */
+    CPU_INT08U                           TxWinScaleRemote;              /* Win scale shift advertised by remote host.           */
+    NET_TS_MS                            TS_Recent;                     /* Most recent TS val to echo to remote host.           */
+    NET_TCP_SEQ_NBR                      TS_LastAckSent;                /* Last ack nbr tx'd (see RFC #7323, Section 4.3).      */
+    NET_TCP_SEQ_NBR                      RxSACK_SeqNbrLast;             /* Seq nbr of last out-of-order seg rx'd.               */
+
 
 
     NET_TCP_SEQ_NBR                      RxSeqNbrSync;                  /* Sync  rx seq nbr.                                    */
@@ -1727,9 +1906,16 @@ struct  net_tcp_conn {
     NET_TMR_TICK                         TxAckDlyTimeout_tick;          /* Tx  ack dly timeout (in ticks).                      */
     NET_TMR                             *TxAckDlyTmr;                   /* Tx  ack dly tmr.                                     */
     CPU_INT16U                           TxAckDlyCnt;                   /* Tx  ack dly cur cnt.                                 */
+    CPU_INT16U                           TxAckDlyCntTh;                 /* Tx  ack dly cnt th.                                  */
+    CPU_INT16U                           TxAckQuickCnt;                 /* Tx  quick ack rem'ing cnt.                           */
+    CPU_INT08U                           TxAckPingPongCtr;              /* Tx  req/resp data exchange ctr.                      */
+    NET_TCP_TX_RTT_TS_MS                 RxDataLastTS_ms;               /* Rx  last data seg TS (in ms).                        */
 
     CPU_BOOLEAN                          TxAckImmedRxdPushEn;           /* Tx  immed ack for rx'd TCP push seg(s) en.           */
 
+    CPU_BOOLEAN                          TxCorkEn;                      /* Tx  cork en.                                         */
+    CPU_BOOLEAN                          TxCorkFlush;                   /* Tx  cork'd data flush req'd.                         */
+
 
     CPU_BOOLEAN                          TxKeepAliveEn;                 /* Tx  keep-alive alg en.                               */
     NET_PKT_CTR                          TxKeepAliveCtr;                /* Nbr of keep-alives tx'd ctr.                         */
@@ -1900,6 +2086,10 @@ CPU_BOOLEAN         NetTCP_ConnCfgTxNagleEn              (NET_TCP_CONN_ID
                                                           CPU_BOOLEAN                          nagle_en,
                                                           NET_ERR                             *p_err);
 
+CPU_BOOLEAN         NetTCP_ConnCfgOpt                    (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          CPU_INT08U                           opt,
+                                                          NET_ERR                             *p_err);
+
 CPU_BOOLEAN         NetTCP_ConnCfgTxAckImmedRxdPushEn    (NET_TCP_CONN_ID                      conn_id_tcp,
                                                           CPU_BOOLEAN                          tx_immed_ack_en,
                                                           NET_ERR                             *p_err);
@@ -1908,6 +2098,14 @@ CPU_BOOLEAN         NetTCP_ConnCfgTxAckDlyTimeout        (NET_TCP_CONN_ID
                                                           NET_TCP_TIMEOUT_MS                   timeout_ms,
                                                           NET_ERR                             *p_err);
 
+CPU_BOOLEAN         NetTCP_ConnCfgTxAckDlyCntTh          (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          CPU_INT16U                           cnt_th,
+                                                          NET_ERR                             *p_err);
+
+CPU_BOOLEAN         NetTCP_ConnCfgTxCorkEn               (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                          CPU_BOOLEAN                          cork_en,
+                                                          NET_ERR                             *p_err);
+
 CPU_BOOLEAN         NetTCP_ConnCfgTxKeepAliveEn          (NET_TCP_CONN_ID                      conn_id_tcp,
                                                           CPU_BOOLEAN                          keep_alive_en,
                                                           NET_ERR                             *p_err);
@@ -1975,6 +2173,20 @@ CPU_INT16U       NetTCP_TxConnAppData                 (NET_TCP_CONN_ID       con
                                                        NET_TCP_FLAGS         flags,
                                                        NET_ERR              *p_err);
 
+NET_BUF         *NetTCP_TxConnAppBufGet               (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       CPU_INT16U            data_len,
+                                                       NET_BUF_SIZE         *p_data_ix,
+                                                       NET_ERR              *p_err);
+
+CPU_INT16U       NetTCP_TxConnAppBufQ                 (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       NET_BUF              *p_buf,
+                                                       NET_BUF_SIZE          data_ix,
+                                                       CPU_INT16U            data_len,
+                                                       NET_ERR              *p_err);
+
+void             NetTCP_TxConnAppBufAbort             (NET_TCP_CONN_ID       conn_id_tcp,
+                                                       NET_BUF              *p_buf);
+
 
 
                                                                                     /* ---- TCP RX/TX STATUS FNCTS ---- */
@@ -2038,10 +2250,22 @@ CPU_BOOLEAN      NetTCP_ConnCfgTxNagleEnHandler       (NET_TCP_CONN_ID
                                                        CPU_BOOLEAN                          nagle_en,
                                                        NET_ERR                             *p_err);
 
+CPU_BOOLEAN      NetTCP_ConnCfgOptHandler             (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       CPU_INT08U                           opt,
+                                                       NET_ERR                             *p_err);
+
 CPU_BOOLEAN      NetTCP_ConnCfgTxAckDlyTimeoutHandler (NET_TCP_CONN_ID                      conn_id_tcp,
                                                        NET_TCP_TIMEOUT_MS                   timeout_ms,
                                                        NET_ERR                             *p_err);
 
+CPU_BOOLEAN      NetTCP_ConnCfgTxAckDlyCntThHandler   (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       CPU_INT16U                           cnt_th,
+                                                       NET_ERR                             *p_err);
+
+CPU_BOOLEAN      NetTCP_ConnCfgTxCorkEnHandler        (NET_TCP_CONN_ID                      conn_id_tcp,
+                                                       CPU_BOOLEAN                          cork_en,
+                                                       NET_ERR                             *p_err);
+
 
 CPU_BOOLEAN      NetTCP_ConnCfgTxKeepAliveEnHandler   (NET_TCP_CONN_ID                      conn_id_tcp,
                                                        CPU_BOOLEAN                          keep_alive_en,
@@ -2266,6 +2490,29 @@ CPU_INT32U       NetTCP_TxQ_TimeoutGet_ms             (NET_TCP_CONN_ID       con
 #endif
 
 
+
+#if    ((NET_TCP_CFG_WIN_SCALE_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_WIN_SCALE_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_WIN_SCALE_EN                  illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  DEF_DISABLED]           "
+#error  "                                         [     ||  DEF_ENABLED ]           "
+#endif
+
+#if    ((NET_TCP_CFG_SACK_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_SACK_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_SACK_EN                       illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  DEF_DISABLED]           "
+#error  "                                         [     ||  DEF_ENABLED ]           "
+#endif
+
+#if    ((NET_TCP_CFG_TS_EN != DEF_DISABLED) && \
+        (NET_TCP_CFG_TS_EN != DEF_ENABLED ))
+#error  "NET_TCP_CFG_TS_EN                         illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  DEF_DISABLED]           "
+#error  "                                         [     ||  DEF_ENABLED ]           "
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
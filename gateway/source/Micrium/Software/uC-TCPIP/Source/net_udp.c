@@ -157,6 +157,12 @@ static  void  NetUDP_TxPktPrepareHdr   (NET_BUF                 *p_buf,
                                         NET_UDP_FLAGS            flags_udp,
                                         NET_ERR                 *p_err);
 
+#ifdef  NET_IPv4_MODULE_EN
+static  void  NetUDP_TxAppDataFree     (void                    *p_data,
+                                        NET_BUF_EXT_DATA_FNCT    free_fnct,
+                                        void                    *p_free_arg);
+#endif
+
 static  void  NetUDP_TxPktFree         (NET_BUF                 *p_buf);
 
 static  void  NetUDP_TxPktDiscard      (NET_BUF                 *p_buf,
@@ -816,6 +822,8 @@ CPU_INT16U  NetUDP_TxAppDataIPv4 (void              *p_data,
                                                                 /* Tx UDP app data.                                     */
     data_len_tot = NetUDP_TxAppDataHandlerIPv4(p_data,
                                                data_len,
+                                               DEF_NULL,
+                                               DEF_NULL,
                                                src_addr,
                                                src_port,
                                                dest_addr,
@@ -837,6 +845,142 @@ exit_lock_fault:
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       NetUDP_TxAppDataRefIPv4()
+*
+* Description : (1) Transmit data from Application layer(s) via UDP layer, without copying the data into
+*                   a network buffer :
+*
+*                   (a) Acquire  network lock
+*                   (b) Transmit application data via UDP Transmit
+*                   (c) Release  network lock
+*
+*
+* Argument(s) : p_data      Pointer to application data (see Note #3).
+*
+*               data_len    Length  of application data (in octets).
+*
+*               free_fnct   Pointer to function to return the application data to the application, once
+*                               the data is NO longer referenced (see Note #3).
+*
+*               p_free_arg  Pointer to argument passed to 'free_fnct'.
+*
+*               src_addr    Source      IP  address.
+*
+*               src_port    Source      UDP port.
+*
+*               dest_addr   Destination IP  address.
+*
+*               dest_port   Destination UDP port.
+*
+*               TOS         Specific TOS to transmit UDP/IP packet (see 'NetUDP_TxAppDataIPv4()  TOS').
+*
+*               TTL         Specific TTL to transmit UDP/IP packet (see 'NetUDP_TxAppDataIPv4()  TTL').
+*
+*               flags_udp   Flags to select UDP transmit options (see 'NetUDP_TxAppDataIPv4()  flags_udp').
+*
+*               flags_ip    Flags to select IP  transmit options (see 'NetUDP_TxAppDataIPv4()  flags_ip').
+*
+*               p_opts_ip    Pointer to one or more IP options configuration data structures (see
+*                               'NetUDP_TxAppDataIPv4()  p_opts_ip').
+*
+*               p_err        Pointer to variable that will receive the return error code from this function :
+*
+*                                                               ---- RETURNED BY NetUDP_TxAppDataHandler() : -----
+*                               NET_UDP_ERR_NONE                Application data successfully prepared &
+*                                                                   transmitted via UDP layer.
+*
+*                               See 'NetUDP_TxAppDataIPv4()  p_err' for additional return error codes.
+*
+*                                                               ----- RETURNED BY Net_GlobalLockAcquire() : -----
+*                               NET_ERR_FAULT_LOCK_ACQUIRE      Network access NOT acquired.
+*
+* Return(s)   : Number of data octets transmitted, if NO error(s).
+*
+*               0,                                 otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a network protocol suite application programming interface (API) function
+*               & MAY be called by application function(s) [see also Note #2].
+*
+* Note(s)     : (2) NetUDP_TxAppDataRefIPv4() is called by application function(s) & ... :
+*
+*                   (a) MUST NOT be called with the global network lock already acquired; ...
+*                   (b) MUST block ALL other network protocol tasks by pending on & acquiring the global
+*                       network lock (see 'net.h  Note #3').
+*
+*                   See also 'NetUDP_TxAppDataIPv4()  Notes #3, #4 & #5'.
+*
+*               (3) (a) The application data is transmitted in place by devices that can gather transmit
+*                       packets (see 'net_buf.h  NETWORK BUFFER EXTERNAL DATA DEFINES  Note #1'); it is
+*                       copied into a network buffer, as by NetUDP_TxAppDataIPv4(), otherwise.
+*
+*                   (b) 'free_fnct' is called exactly once for each call to NetUDP_TxAppDataRefIPv4(),
+*                       whether or not the datagram is transmitted :
+*
+*                       (1) Once the data is copied or the datagram is discarded, from this function;
+*                       (2) Once the datagram is transmitted, from the network interface transmit
+*                               deallocation task.
+*
+*                       The application data MUST remain valid & unmodified until then.
+*
+*                   (c) 'free_fnct' is called with the global network lock acquired & MUST NOT call any
+*                       network protocol suite API function (see 'net_buf.c  NetBuf_ExtDataSet()  Note #2').
+*********************************************************************************************************
+*/
+#ifdef  NET_IPv4_MODULE_EN
+CPU_INT16U  NetUDP_TxAppDataRefIPv4 (void                   *p_data,
+                                     CPU_INT16U              data_len,
+                                     NET_BUF_EXT_DATA_FNCT   free_fnct,
+                                     void                   *p_free_arg,
+                                     NET_IPv4_ADDR           src_addr,
+                                     NET_UDP_PORT_NBR        src_port,
+                                     NET_IPv4_ADDR           dest_addr,
+                                     NET_UDP_PORT_NBR        dest_port,
+                                     NET_IPv4_TOS            TOS,
+                                     NET_IPv4_TTL            TTL,
+                                     NET_UDP_FLAGS           flags_udp,
+                                     NET_IPv4_FLAGS          flags_ip,
+                                     void                   *p_opts_ip,
+                                     NET_ERR                *p_err)
+{
+    CPU_INT16U  data_len_tot;
+
+
+                                                                /* Acquire net lock (see Note #2b).                     */
+    Net_GlobalLockAcquire((void *)&NetUDP_TxAppDataRefIPv4, p_err);
+    if (*p_err != NET_ERR_NONE) {
+         goto exit_lock_fault;
+    }
+                                                                /* Tx UDP app data (see Note #3).                       */
+    data_len_tot = NetUDP_TxAppDataHandlerIPv4(p_data,
+                                               data_len,
+                                               free_fnct,
+                                               p_free_arg,
+                                               src_addr,
+                                               src_port,
+                                               dest_addr,
+                                               dest_port,
+                                               TOS,
+                                               TTL,
+                                               flags_udp,
+                                               flags_ip,
+                                               p_opts_ip,
+                                               p_err);
+
+    Net_GlobalLockRelease();                                    /* Release net lock.                                    */
+
+    return (data_len_tot);
+
+exit_lock_fault:                                                /* Rtn app data to app (see Note #3b1).                 */
+    NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
+    return (0u);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        NetUDP_TxAppDataIPv6()
@@ -1043,6 +1187,13 @@ exit_lock_fault:
 *
 *               data_len    Length  of application data (in octets) [see Note #5].
 *
+*               free_fnct   Pointer to function to return the application data to its owner (see Note #7) :
+*
+*                               NULL                            Application data ALWAYS copied.
+*                               Pointer to function,            otherwise.
+*
+*               p_free_arg  Pointer to argument passed to 'free_fnct'.
+*
 *               src_addr    Source      IP  address.
 *
 *               src_port    Source      UDP port.
@@ -1127,7 +1278,8 @@ exit_lock_fault:
 *
 *               0,                                 otherwise.
 *
-* Caller(s)   : NetUDP_TxAppData(),
+* Caller(s)   : NetUDP_TxAppDataIPv4(),
+*               NetUDP_TxAppDataRefIPv4(),
 *               NetSock_TxDataHandlerDatagram().
 *
 *               This function is an INTERNAL network protocol suite function & MUST NOT be called by
@@ -1162,24 +1314,52 @@ exit_lock_fault:
 *                   (b) 'data_len' of 0 octets NOT allowed.
 *
 *               (6) On ANY transmit error, any remaining application data transmit is immediately aborted.
+*
+*               (7) (a) If 'free_fnct' is available, the application data is NOT copied but referenced by the
+*                       transmit buffer (see 'net_buf.h  NETWORK BUFFER EXTERNAL DATA DEFINES  Note #1'),
+*                       if ALL of the following conditions are met :
+*
+*                       (1) External data is enabled by NET_BUF_CFG_EXT_DATA_EN;
+*                       (2) The data is NOT shorter than NET_BUF_EXT_DATA_LEN_MIN octets;
+*                       (3) The source interface's device can gather transmit packets;
+*                       (4) The destination is NOT this host, which is reached through the loopback
+*                               interface (see 'net_if.c  NetIF_TxHandler()  Note #3').
+*
+*                       The transmit buffer then ONLY holds the datagram's protocol headers & is allocated
+*                       from the small transmit buffer pool, if available.
+*
+*                   (b) Otherwise, the application data is copied & immediately returned to its owner.
+*
+*                   (c) If the application data can NOT be linked to the header-only transmit buffer, that
+*                       buffer has NO room for the data; it is freed & an application data transmit buffer
+*                       is allocated to copy the data into.
+*
+*                   See also 'NetUDP_TxAppDataRefIPv4()  Note #3'.
 *********************************************************************************************************
 */
 #ifdef  NET_IPv4_MODULE_EN
-CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
-                                         CPU_INT16U          data_len,
-                                         NET_IPv4_ADDR       src_addr,
-                                         NET_UDP_PORT_NBR    src_port,
-                                         NET_IPv4_ADDR       dest_addr,
-                                         NET_UDP_PORT_NBR    dest_port,
-                                         NET_IPv4_TOS        TOS,
-                                         NET_IPv4_TTL        TTL,
-                                         NET_UDP_FLAGS       flags_udp,
-                                         NET_IPv4_FLAGS      flags_ip,
-                                         void               *p_opts_ip,
-                                         NET_ERR            *p_err)
+CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void                   *p_data,
+                                         CPU_INT16U              data_len,
+                                         NET_BUF_EXT_DATA_FNCT   free_fnct,
+                                         void                   *p_free_arg,
+                                         NET_IPv4_ADDR           src_addr,
+                                         NET_UDP_PORT_NBR        src_port,
+                                         NET_IPv4_ADDR           dest_addr,
+                                         NET_UDP_PORT_NBR        dest_port,
+                                         NET_IPv4_TOS            TOS,
+                                         NET_IPv4_TTL            TTL,
+                                         NET_UDP_FLAGS           flags_udp,
+                                         NET_IPv4_FLAGS          flags_ip,
+                                         void                   *p_opts_ip,
+                                         NET_ERR                *p_err)
 {
     NET_BUF        *p_buf;
     NET_BUF_HDR    *p_buf_hdr;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    NET_IF         *p_if;
+    NET_IF_NBR      if_nbr_dest;
+    CPU_BOOLEAN     chk_sum;
+#endif
     NET_IF_NBR      if_nbr;
     NET_MTU         udp_mtu;
     NET_BUF_SIZE    buf_size_max;
@@ -1187,8 +1367,10 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     NET_BUF_SIZE    data_ix_pkt;
     NET_BUF_SIZE    data_ix_pkt_offset;
     NET_BUF_SIZE    data_len_pkt;
+    NET_BUF_SIZE    data_len_buf;
     CPU_INT16U      data_len_tot;
     CPU_INT08U     *p_data_pkt;
+    CPU_BOOLEAN     data_ext;
     NET_ERR         err;
 
 
@@ -1199,6 +1381,7 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     }
 
     if (Net_InitDone != DEF_YES) {                              /* If init NOT complete, exit tx (see Note #3).         */
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
        *p_err =  NET_INIT_ERR_NOT_COMPLETED;
         return (0u);
     }
@@ -1209,11 +1392,13 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
      (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED))
                                                                 /* ---------------- VALIDATE APP DATA ----------------- */
     if (p_data == (void *)0) {
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
        *p_err =  NET_ERR_FAULT_NULL_PTR;
         return (0u);
     }
     if (data_len <= NET_UDP_DATA_LEN_MIN) {                     /* Validate data len (see Note #5b).                    */
         NET_CTR_ERR_INC(Net_ErrCtrs.UDP.TxInvalidSizeCtr);
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
        *p_err =  NET_UDP_ERR_INVALID_DATA_SIZE;
         return (0u);
     }
@@ -1225,6 +1410,7 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     if (if_nbr == NET_IF_NBR_NONE) {
         NetUDP_TxPktDiscard(DEF_NULL,
                            &err);
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
     *p_err =  NET_UDP_ERR_INVALID_ADDR_SRC;
         return (0u);
     }
@@ -1236,6 +1422,7 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     if (*p_err != NET_IF_ERR_NONE) {
         NetUDP_TxPktDiscard((NET_BUF *) 0,
                             (NET_ERR *)&err);
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
         return (0u);
     }
 
@@ -1262,6 +1449,7 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
     buf_size_max_data = (NET_BUF_SIZE)DEF_MIN(buf_size_max, udp_mtu);
 
     if (data_len > buf_size_max_data) {                         /* If data len > max data size, abort tx ...            */
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
        *p_err = NET_UDP_ERR_INVALID_DATA_SIZE;                  /* ... & rtn size err (see Note #5a2B).                 */
         return (0u);
 
@@ -1271,25 +1459,97 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv4 (void               *p_data,
 
     data_len_tot =  0u;
     p_data_pkt   = (CPU_INT08U *)p_data;
-                                                                /* Get app data tx buf.                                 */
+                                                                /* Chk if app data may be ref'd (see Note #7a).         */
+    data_ext     =  DEF_NO;
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    if ((free_fnct    != (NET_BUF_EXT_DATA_FNCT)0) &&
+        (data_len_pkt >= NET_BUF_EXT_DATA_LEN_MIN)) {
+        p_if        = NetIF_Get(if_nbr, &err);
+        if_nbr_dest = NetIPv4_GetAddrHostIF_Nbr(dest_addr);
+        if ((err                  == NET_IF_ERR_NONE) &&
+            (p_if->DevTxExtDataEn == DEF_YES)         &&
+            (if_nbr_dest          == NET_IF_NBR_NONE)) {
+            data_ext = DEF_YES;
+        }
+    }
+#endif
+
+    if (data_ext == DEF_YES) {                                  /* Get hdr-only tx buf for ref'd app data ...           */
+        data_len_buf = 0u;
+    } else {                                                    /* ... or app data tx buf.                              */
+        data_len_buf = data_len_pkt;
+    }
     p_buf = NetBuf_Get(if_nbr,
                        NET_TRANSACTION_TX,
-                       data_len_pkt,
+                       data_len_buf,
                        data_ix_pkt,
                        &data_ix_pkt_offset,
                        NET_BUF_FLAG_NONE,
                        p_err);
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
+         NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
          return (data_len_tot);
     }
 
     data_ix_pkt += data_ix_pkt_offset;
-    NetBuf_DataWr(p_buf,                           /* Wr app data into app data tx buf.                    */
-                  data_ix_pkt,
-                  data_len_pkt,
-                  p_data_pkt,
-                  p_err);
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+    if (data_ext == DEF_YES) {                                  /* Link app data to tx buf & cache its sum.             */
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+        chk_sum = DEF_YES;
+#else
+        chk_sum = DEF_NO;
+#endif
+        NetBuf_ExtDataSet(p_buf,
+                          data_ix_pkt,
+                          data_len_pkt,
+                          p_data_pkt,
+                          free_fnct,
+                          p_free_arg,
+                          chk_sum,
+                          p_err);
+        if (*p_err != NET_BUF_ERR_NONE) {                       /* If app data NOT linked, copy it instead ...          */
+            data_ext     = DEF_NO;
+            data_ix_pkt -= data_ix_pkt_offset;
+            NetBuf_Free(p_buf);                                 /* ... into an app data tx buf (see Note #7c).          */
+            p_buf = NetBuf_Get(if_nbr,
+                               NET_TRANSACTION_TX,
+                               data_len_pkt,
+                               data_ix_pkt,
+                               &data_ix_pkt_offset,
+                               NET_BUF_FLAG_NONE,
+                               p_err);
+            if (*p_err != NET_BUF_ERR_NONE) {
+                 NetUDP_TxPktDiscard(p_buf, &err);
+                 NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
+                 return (data_len_tot);
+            }
+
+            data_ix_pkt += data_ix_pkt_offset;
+        }
+    }
+#endif
+
+    if (data_ext != DEF_YES) {
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+        NetBuf_DataWrChkSum(p_buf,                              /* Wr app data into app data tx buf & cache its sum.    */
+                            data_ix_pkt,
+                            data_len_pkt,
+                            p_data_pkt,
+                            p_err);
+#else
+        NetBuf_DataWr(p_buf,                                    /* Wr app data into app data tx buf.                    */
+                      data_ix_pkt,
+                      data_len_pkt,
+                      p_data_pkt,
+                      p_err);
+#endif
+                                                                /* Rtn copied app data to its owner (see Note #7b).     */
+        NetUDP_TxAppDataFree(p_data, free_fnct, p_free_arg);
+    }
+
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
          return (data_len_tot);
@@ -1580,11 +1840,20 @@ CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
     }
 
     data_ix_pkt += data_ix_pkt_offset;
+#if ((NET_UDP_CFG_TX_CHK_SUM_EN == DEF_ENABLED) && \
+     (!defined(NET_UDP_CHK_SUM_OFFLOAD_TX)))
+    NetBuf_DataWrChkSum((NET_BUF    *)p_buf,                     /* Wr app data into app data tx buf & cache its sum.    */
+                        (NET_BUF_SIZE)data_ix_pkt,
+                        (NET_BUF_SIZE)data_len_pkt,
+                        (CPU_INT08U *)p_data_pkt,
+                        (NET_ERR    *)p_err);
+#else
     NetBuf_DataWr((NET_BUF    *)p_buf,                           /* Wr app data into app data tx buf.                    */
                   (NET_BUF_SIZE)data_ix_pkt,
                   (NET_BUF_SIZE)data_len_pkt,
                   (CPU_INT08U *)p_data_pkt,
                   (NET_ERR    *)p_err);
+#endif
     if (*p_err != NET_BUF_ERR_NONE) {
          NetUDP_TxPktDiscard(p_buf, &err);
          return (data_len_tot);
@@ -2954,6 +3223,42 @@ static  void  NetUDP_TxPktPrepareHdr (NET_BUF           *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetUDP_TxAppDataFree()
+*
+* Description : Return application data to its owner.
+*
+* Argument(s) : p_data      Pointer to application data.
+*
+*               free_fnct   Pointer to function to return the application data to its owner :
+*
+*                               NULL                            Application data NOT returned.
+*                               Pointer to function,            otherwise.
+*
+*               p_free_arg  Pointer to argument passed to 'free_fnct'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : NetUDP_TxAppDataRefIPv4(),
+*               NetUDP_TxAppDataHandlerIPv4().
+*
+* Note(s)     : (1) See 'NetUDP_TxAppDataRefIPv4()  Note #3b'.
+*********************************************************************************************************
+*/
+
+#ifdef  NET_IPv4_MODULE_EN
+static  void  NetUDP_TxAppDataFree (void                   *p_data,
+                                    NET_BUF_EXT_DATA_FNCT   free_fnct,
+                                    void                   *p_free_arg)
+{
+    if (free_fnct != (NET_BUF_EXT_DATA_FNCT)0) {
+        free_fnct(p_data, p_free_arg);
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         NetUDP_TxPktFree()
@@ -49,6 +49,7 @@
 #include  "net_cfg_net.h"
 #include  "net_def.h"
 #include  "net_type.h"
+#include  "net_buf.h"
 #include  "net_err.h"
 #include  <cpu.h>
 
@@ -274,6 +275,21 @@ CPU_INT16U  NetUDP_TxAppDataIPv4 (void              *p_data,
                                   void              *popts_ip,
                                   NET_ERR           *p_err);
 
+CPU_INT16U  NetUDP_TxAppDataRefIPv4 (void                   *p_data,
+                                     CPU_INT16U              data_len,
+                                     NET_BUF_EXT_DATA_FNCT   free_fnct,
+                                     void                   *p_free_arg,
+                                     NET_IPv4_ADDR           src_addr,
+                                     NET_UDP_PORT_NBR        src_port,
+                                     NET_IPv4_ADDR           dest_addr,
+                                     NET_UDP_PORT_NBR        dest_port,
+                                     NET_IPv4_TOS            TOS,
+                                     NET_IPv4_TTL            TTL,
+                                     NET_UDP_FLAGS           flags_udp,
+                                     NET_IPv4_FLAGS          flags_ip,
+                                     void                   *popts_ip,
+                                     NET_ERR                *p_err);
+
 CPU_INT16U  NetUDP_TxAppDataIPv6 (void                    *p_data,
                                   CPU_INT16U               data_len,
                                   NET_IPv6_ADDR           *p_src_addr,
@@ -286,18 +302,20 @@ CPU_INT16U  NetUDP_TxAppDataIPv6 (void                    *p_data,
                                   NET_UDP_FLAGS            flags_udp,
                                   NET_ERR                 *p_err);
 
-CPU_INT16U  NetUDP_TxAppDataHandlerIPv4(void               *p_data,
-                                        CPU_INT16U          data_len,
-                                        NET_IPv4_ADDR       src_addr,
-                                        NET_UDP_PORT_NBR    src_port,
-                                        NET_IPv4_ADDR       dest_addr,
-                                        NET_UDP_PORT_NBR    dest_port,
-                                        NET_IPv4_TOS        TOS,
-                                        NET_IPv4_TTL        TTL,
-                                        NET_UDP_FLAGS       flags_udp,
-                                        NET_IPv4_FLAGS      flags_ip,
-                                        void               *popts_ip,
-                                        NET_ERR            *p_err);
+CPU_INT16U  NetUDP_TxAppDataHandlerIPv4(void                   *p_data,
+                                        CPU_INT16U              data_len,
+                                        NET_BUF_EXT_DATA_FNCT   free_fnct,
+                                        void                   *p_free_arg,
+                                        NET_IPv4_ADDR           src_addr,
+                                        NET_UDP_PORT_NBR        src_port,
+                                        NET_IPv4_ADDR           dest_addr,
+                                        NET_UDP_PORT_NBR        dest_port,
+                                        NET_IPv4_TOS            TOS,
+                                        NET_IPv4_TTL            TTL,
+                                        NET_UDP_FLAGS           flags_udp,
+                                        NET_IPv4_FLAGS          flags_ip,
+                                        void                   *popts_ip,
+                                        NET_ERR                *p_err);
 
 CPU_INT16U  NetUDP_TxAppDataHandlerIPv6(void                    *p_data,
                                         CPU_INT16U               data_len,
@@ -72,6 +72,14 @@
 #define  NET_UTIL_16_BIT_SUM_ERR_NULL_SIZE        DEF_BIT_01
 #define  NET_UTIL_16_BIT_SUM_ERR_LAST_OCTET       DEF_BIT_02
 
+                                                                /* Add 32-bit val to sum & cnt ovf carries.             */
+#define  NET_UTIL_16_BIT_SUM_ADD(sum, carry, val)       do {                         \
+                                                            (sum) += (val);          \
+                                                            if ((sum) < (val)) {     \
+                                                                (carry)++;           \
+                                                            }                        \
+                                                        } while (0)
+
 
 /*
 *********************************************************************************************************
@@ -87,6 +95,21 @@
 #define  NET_UTIL_32_BIT_CRC_POLY                 0x04C11DB7u   /*  = 0000 0100 1100 0001 0001 1101 1011 0111           */
 #define  NET_UTIL_32_BIT_CRC_POLY_REFLECT         0xEDB88320u   /*  = 1110 1101 1011 1000 1000 0011 0010 0000           */
 
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*
+* Note(s): (1) A 16-bit word is accessed as two octets to place a lone octet in the word's low- or high-
+*              addressed octet regardless of the CPU's endianness.
+*********************************************************************************************************
+*/
+
+typedef  union  net_util_16_bit_word {
+    CPU_INT16U  Val;
+    CPU_INT08U  Octets[2];
+} NET_UTIL_16_BIT_WORD;
+
+
 /*
 *********************************************************************************************************
 *                                            LOCAL TABLES
@@ -120,6 +143,10 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc       (void         *p_data,
                                                     CPU_BOOLEAN   last_pkt_buf,
                                                     CPU_INT08U   *psum_err);
 
+static  CPU_INT16U  NetUtil_16BitSumCopy           (CPU_INT08U   *p_dest,
+                                                    CPU_INT08U   *p_src,
+                                                    CPU_INT16U    size);
+
 static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc(void         *pdata_buf,
                                                     void         *ppseudo_hdr,
                                                     CPU_INT16U    pseudo_hdr_size,
@@ -460,6 +487,77 @@ CPU_BOOLEAN  NetUtil_16BitOnesCplChkSumDataVerify (void        *pdata_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      NetUtil_16BitSumDataCopy()
+*
+* Description : Copy data & calculate the 16-bit sum of the copied data.
+*
+* Argument(s) : p_dest      Pointer to destination memory buffer; NULL to ONLY sum the data (see Note #3).
+*
+*               p_src       Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy.
+*
+* Return(s)   : 16-bit sum of the copied data, folded to 16 bits & in network-order (see Note #2).
+*
+* Caller(s)   : NetBuf_DataWrChkSum(),
+*               NetBuf_ExtDataSet().
+*
+*               This function is an INTERNAL network protocol suite function & SHOULD NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) The data is check-summed in the same pass that copies it, so that a transmit check-sum
+*                   need NOT read the data a second time.  If source & destination buffers are NOT equally
+*                   aligned on 32-bit boundaries, words can NOT be copied as they are summed; the data is
+*                   then copied by Mem_Copy() & check-summed from the destination buffer, while still in
+*                   cache.
+*
+*               (2) The sum is calculated as if the data started on a 16-bit word boundary of the packet :
+*                   if the data is odd-length, its last octet is padded on the right with one octet of zero.
+*                   The sum may be added to other 16-bit sums returned by NetUtil_16BitSumDataCalc().
+*
+*                   See also 'NetUtil_16BitSumDataCalc()  Notes #5 & #8'.
+*
+*               (3) Data that is transmitted in place, without being copied into a network buffer (see
+*                   'net_buf.h  NETWORK BUFFER EXTERNAL DATA DEFINES  Note #1'), is ONLY summed.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  NetUtil_16BitSumDataCopy (void        *p_dest,
+                                      void        *p_src,
+                                      CPU_INT16U   size)
+{
+    CPU_INT16U  sum;
+    CPU_DATA    mod_dest;
+    CPU_DATA    mod_src;
+
+
+    if (p_dest == (void *)0) {                                  /* If NO dest buf, sum src buf only (see Note #3).      */
+        sum = NetUtil_16BitSumCopy((CPU_INT08U *)0,
+                                   (CPU_INT08U *)p_src,
+                                                 size);
+        return (sum);
+    }
+
+    mod_dest = (CPU_DATA)((CPU_ADDR)p_dest % sizeof(CPU_INT32U));
+    mod_src  = (CPU_DATA)((CPU_ADDR)p_src  % sizeof(CPU_INT32U));
+
+    if (mod_dest == mod_src) {                                  /* If bufs equally aligned, copy & sum in one pass.     */
+        sum = NetUtil_16BitSumCopy((CPU_INT08U *)p_dest,
+                                   (CPU_INT08U *)p_src,
+                                                 size);
+    } else {                                                    /* Else copy, then sum dest buf (see Note #1).          */
+        Mem_Copy(p_dest, p_src, (CPU_SIZE_T)size);
+        sum = NetUtil_16BitSumCopy((CPU_INT08U *)0,
+                                   (CPU_INT08U *)p_dest,
+                                                 size);
+    }
+
+    return (sum);
+}
+
+
 /*
 *********************************************************************************************************
 *                                       NetUtil_32BitCRC_Calc()
@@ -1312,6 +1410,10 @@ static  CPU_INT32U  NetUtil_16BitSumHdrCalc (void        *phdr,
 *                   (c) RFC #793, Section 3.1 'Header Format              : Checksum'
 *
 *                   See also 'NetUtil_16BitSumHdrCalc()  Note #6'.
+*
+*               (9) If NO optimized 32-bit sum calculation is configured (see Note #6), the packet data's
+*                   16-bit words are summed 32 bits at a time in host-order & only the folded sum is
+*                   converted to network-order (see 'NetUtil_16BitSumCopy()  Note #2').
 *********************************************************************************************************
 */
 
@@ -1323,22 +1425,21 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
                                               CPU_BOOLEAN   last_pkt_buf,
                                               CPU_INT08U   *psum_err)
 {
-    CPU_INT08U    mod_32;
 #if (NET_CFG_OPTIMIZE_ASM_EN == DEF_ENABLED)
+    CPU_INT08U    mod_32;
     CPU_INT16U    size_rem_32_offset;
     CPU_INT16U    size_rem_32;
+    CPU_INT16U    data_val_16;
+    CPU_INT16U   *pdata_16;
+    CPU_DATA      mod_16;
+    CPU_BOOLEAN   pkt_aligned_16;
 #else
-    CPU_INT32U   *pdata_32;
-    CPU_INT32U    data_val_32;
+    CPU_INT16U    size_rem_16;
 #endif
     CPU_INT32U    sum_32;
     CPU_INT32U    sum_val_32;
-    CPU_INT16U    data_val_16;
     CPU_INT16U    size_rem;
-    CPU_INT16U   *pdata_16;
     CPU_INT08U   *pdata_08;
-    CPU_DATA      mod_16;
-    CPU_BOOLEAN   pkt_aligned_16;
 
 
     sum_32 = 0u;
@@ -1372,10 +1473,12 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
     size_rem       =  data_size;
    *psum_err       =  NET_UTIL_16_BIT_SUM_ERR_NONE;
 
+#if (NET_CFG_OPTIMIZE_ASM_EN == DEF_ENABLED)
                                                                     /* See Notes #3 & #4.                               */
     mod_16         = (CPU_INT08U)((CPU_ADDR)p_data % sizeof(CPU_INT16U));
     pkt_aligned_16 = (((mod_16 == 0u) && (prev_octet_valid == DEF_NO )) ||
                       ((mod_16 != 0u) && (prev_octet_valid == DEF_YES))) ? DEF_YES : DEF_NO;
+#endif
 
 
     pdata_08 = (CPU_INT08U *)p_data;
@@ -1389,6 +1492,7 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
         size_rem    -= (CPU_INT16U) sizeof(CPU_INT08U);
     }
 
+#if (NET_CFG_OPTIMIZE_ASM_EN == DEF_ENABLED)
     if (pkt_aligned_16 == DEF_YES) {                                /* If pkt data aligned on 16-bit boundary, ..       */
                                                                     /* .. calc sum with 16- & 32-bit data words.        */
         pdata_16 = (CPU_INT16U *)pdata_08;
@@ -1401,7 +1505,6 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
              size_rem     -= (CPU_INT16U) sizeof(CPU_INT16U);
         }
 
-#if (NET_CFG_OPTIMIZE_ASM_EN == DEF_ENABLED)
                                                                     /* Calc optimized 32-bit size rem.                  */
         size_rem_32_offset = (CPU_INT16U)(size_rem % sizeof(CPU_INT32U));
         size_rem_32        = (CPU_INT16U)(size_rem - size_rem_32_offset);
@@ -1415,24 +1518,6 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
         pdata_08 +=               size_rem_32;                      /* MUST NOT cast ptr operand (see Note #7b).        */
         pdata_16  = (CPU_INT16U *)pdata_08;
 
-#else
-        pdata_32 = (CPU_INT32U *)pdata_16;
-        while (size_rem >=  sizeof(CPU_INT32U)) {                   /* While pkt data aligned on 32-bit boundary; ...   */
-            data_val_32  = (CPU_INT32U) *pdata_32++;                /* ... get sum data with 32-bit data words,   ...   */
-
-            data_val_16  = (CPU_INT16U)((data_val_32 >> 16u) & 0x0000FFFFu);
-            sum_val_32   = (CPU_INT32U)  NET_UTIL_HOST_TO_NET_16(data_val_16);  /* Conv to net-order (see Note #5b).    */
-            sum_32      += (CPU_INT32U)  sum_val_32;                /* ... & calc sum with upper 16-bit data word ...   */
-
-            data_val_16  = (CPU_INT16U) (data_val_32         & 0x0000FFFFu);
-            sum_val_32   = (CPU_INT32U)  NET_UTIL_HOST_TO_NET_16(data_val_16);  /* Conv to net-order (see Note #5b).    */
-            sum_32      += (CPU_INT32U)  sum_val_32;                /* ...               & lower 16-bit data word.      */
-
-            size_rem    -= (CPU_INT16U)  sizeof(CPU_INT32U);
-        }
-        pdata_16 = (CPU_INT16U *)pdata_32;
-#endif
-
         while (size_rem >=  sizeof(CPU_INT16U)) {                   /* While pkt data aligned on 16-bit boundary; ..    */
             data_val_16  = (CPU_INT16U)*pdata_16++;
             sum_val_32   = (CPU_INT32U) NET_UTIL_HOST_TO_NET_16(data_val_16);   /* Conv to net-order (see Note #5b).    */
@@ -1456,6 +1541,19 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
         }
     }
 
+#else
+    size_rem_16  = (CPU_INT16U)(size_rem - (size_rem % sizeof(CPU_INT16U)));
+    sum_val_32   = (CPU_INT32U) NetUtil_16BitSumCopy((CPU_INT08U *)0,  /* Calc sum with 32-bit data words (see Note #9). */
+                                                                  pdata_08,
+                                                                  size_rem_16);
+    sum_32      += (CPU_INT32U) sum_val_32;
+    pdata_08    +=              size_rem_16;                        /* MUST NOT cast ptr operand (see Note #7b).        */
+    size_rem    -= (CPU_INT16U) size_rem_16;
+    if (size_rem > 0) {
+        sum_val_32   = (CPU_INT32U)*pdata_08;
+    }
+#endif
+
 
     if (size_rem > 0) {
         if (last_pkt_buf !=  DEF_NO) {                              /* If last pkt buf, ...                             */
@@ -1472,6 +1570,188 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       NetUtil_16BitSumCopy()
+*
+* Description : Calculate 16-bit sum on a memory buffer, 32 bits at a time, optionally copying it.
+*
+* Argument(s) : p_dest      Pointer to destination memory buffer to copy data to, if any (see Note #3) :
+*
+*                               Null (0) pointer        Data NOT copied.
+*                               Non-null pointer        Data copied to destination.
+*
+*               p_src       Pointer to data.
+*
+*               size        Size of data (in octets).
+*
+* Return(s)   : 16-bit sum, folded to 16 bits & in network-order (see Note #2).
+*
+* Caller(s)   : NetUtil_16BitSumDataCalc(),
+*               NetUtil_16BitSumDataCopy().
+*
+* Note(s)     : (1) See RFC #1071, Sections 2.(B), 2.(C) & 4.1.
+*
+*               (2) (a) Since "the sum of 16-bit integers can be computed in either byte order" [RFC #1071,
+*                       Section 2.(B)], 32-bit words are summed in host-order & the sum is converted to
+*                       network-order only once it is folded back to 16 bits.
+*
+*                   (b) Carries out of the 32-bit sum are counted separately & added back in when the sum
+*                       is folded, since 2^32 modulo (2^16 - 1) is 1.
+*
+*                   (c) If the data does NOT start on a 16-bit word boundary, its first octet is summed as
+*                       the high-addressed octet of a word & every later word is summed from its natural
+*                       16-bit boundary.  The sum is then the byte-swapped sum of the data [RFC #1071,
+*                       Section 2.(B)] & is swapped back once folded.
+*
+*                   (d) If the data is odd-length, its last octet is padded on the right with one octet of
+*                       zero (see 'NetUtil_16BitSumDataCalc()  Note #8').
+*
+*               (3) If the data is copied, destination & source buffers MUST be equally aligned on 32-bit
+*                   boundaries (see 'NetUtil_16BitSumDataCopy()  Note #1').
+*
+*               (4) Data accessed 16 or 32 bits at a time ONLY on 16- or 32-bit word-aligned addresses
+*                   (see 'NetUtil_16BitSumDataCalc()  Note #3').
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  NetUtil_16BitSumCopy (CPU_INT08U  *p_dest,
+                                          CPU_INT08U  *p_src,
+                                          CPU_INT16U   size)
+{
+    NET_UTIL_16_BIT_WORD   word;
+    CPU_INT32U            *p_src_32;
+    CPU_INT32U            *p_dest_32;
+    CPU_INT32U             sum;
+    CPU_INT32U             carry;
+    CPU_INT32U             val;
+    CPU_INT16U             sum_16;
+    CPU_INT16U             size_rem;
+    CPU_BOOLEAN            copy;
+    CPU_BOOLEAN            addr_odd;
+
+
+    if (size < 1) {
+        return (0u);
+    }
+
+    sum      = 0u;
+    carry    = 0u;
+    size_rem = size;
+    copy     = DEF_NO;
+    addr_odd = DEF_NO;
+    if (p_dest != (CPU_INT08U *)0) {
+        copy = DEF_YES;
+    }
+
+                                                                /* ------------ SUM LEADING OCTET & WORD -------------- */
+    if (((CPU_ADDR)p_src % sizeof(CPU_INT16U)) != 0u) {         /* If data NOT 16-bit aligned, ...                      */
+        word.Octets[0] =  0u;                                   /* ... sum first octet as high-addr'd octet ...         */
+        word.Octets[1] = *p_src;
+        if (copy == DEF_YES) {
+           *p_dest++   = *p_src;
+        }
+        p_src++;
+        sum           += (CPU_INT32U)word.Val;
+        size_rem      -=  sizeof(CPU_INT08U);
+        addr_odd       =  DEF_YES;                              /* ... & swap sum back when folded (see Note #2c).      */
+    }
+
+    if ((((CPU_ADDR)p_src % sizeof(CPU_INT32U)) != 0u) &&       /* If data NOT 32-bit aligned, sum leading word.        */
+         (size_rem >= sizeof(CPU_INT16U))) {
+        word.Val   = *((CPU_INT16U *)p_src);
+        if (copy == DEF_YES) {
+           *((CPU_INT16U *)p_dest) = word.Val;
+            p_dest += sizeof(CPU_INT16U);
+        }
+        p_src     += sizeof(CPU_INT16U);
+        sum       += (CPU_INT32U)word.Val;
+        size_rem  -=  sizeof(CPU_INT16U);
+    }
+
+                                                                /* ----------------- SUM 32-BIT WORDS ----------------- */
+    p_src_32  = (CPU_INT32U *)p_src;
+    p_dest_32 = (CPU_INT32U *)p_dest;
+    if (copy == DEF_YES) {
+        while (size_rem >= (4u * sizeof(CPU_INT32U))) {         /* Copy & sum 4 words per iteration.                    */
+            val          = p_src_32[0];
+            p_dest_32[0] = val;
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, val);
+            val          = p_src_32[1];
+            p_dest_32[1] = val;
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, val);
+            val          = p_src_32[2];
+            p_dest_32[2] = val;
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, val);
+            val          = p_src_32[3];
+            p_dest_32[3] = val;
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, val);
+            p_src_32  += 4u;
+            p_dest_32 += 4u;
+            size_rem  -= 4u * sizeof(CPU_INT32U);
+        }
+        while (size_rem >= sizeof(CPU_INT32U)) {
+            val = *p_src_32++;
+           *p_dest_32++ = val;
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, val);
+            size_rem -= sizeof(CPU_INT32U);
+        }
+        p_dest = (CPU_INT08U *)p_dest_32;
+
+    } else {
+        while (size_rem >= (4u * sizeof(CPU_INT32U))) {         /* Sum 4 words per iteration.                           */
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, p_src_32[0]);
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, p_src_32[1]);
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, p_src_32[2]);
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, p_src_32[3]);
+            p_src_32 += 4u;
+            size_rem -= 4u * sizeof(CPU_INT32U);
+        }
+        while (size_rem >= sizeof(CPU_INT32U)) {
+            NET_UTIL_16_BIT_SUM_ADD(sum, carry, *p_src_32);
+            p_src_32++;
+            size_rem -= sizeof(CPU_INT32U);
+        }
+    }
+    p_src = (CPU_INT08U *)p_src_32;
+
+                                                                /* ----------- SUM TRAILING WORD & OCTET -------------- */
+    if (size_rem >= sizeof(CPU_INT16U)) {
+        word.Val   = *((CPU_INT16U *)p_src);
+        if (copy == DEF_YES) {
+           *((CPU_INT16U *)p_dest) = word.Val;
+            p_dest += sizeof(CPU_INT16U);
+        }
+        p_src     += sizeof(CPU_INT16U);
+        NET_UTIL_16_BIT_SUM_ADD(sum, carry, (CPU_INT32U)word.Val);
+        size_rem  -=  sizeof(CPU_INT16U);
+    }
+
+    if (size_rem > 0u) {                                        /* Pad odd-len data (see Note #2d).                     */
+        word.Octets[0] = *p_src;
+        word.Octets[1] =  0u;
+        if (copy == DEF_YES) {
+           *p_dest     = *p_src;
+        }
+        NET_UTIL_16_BIT_SUM_ADD(sum, carry, (CPU_INT32U)word.Val);
+    }
+
+                                                                /* ------------------ FOLD 16-BIT SUM ----------------- */
+    sum = (sum & 0x0000FFFFu) + (sum >> 16u) + carry;           /* See Note #2b.                                        */
+    while (sum >> 16u) {
+        sum = (sum & 0x0000FFFFu) + (sum >> 16u);
+    }
+
+    sum_16 = (CPU_INT16U)sum;
+    if (addr_odd == DEF_YES) {                                  /* Swap sum back (see Note #2c).                        */
+        sum_16 = (CPU_INT16U)((sum_16 >> DEF_OCTET_NBR_BITS) | (sum_16 << DEF_OCTET_NBR_BITS));
+    }
+    sum_16 = NET_UTIL_HOST_TO_NET_16(sum_16);                   /* Conv to net-order (see Note #2a).                    */
+
+    return (sum_16);
+}
+
+
 /*
 *********************************************************************************************************
 *                                  NetUtil_16BitOnesCplSumDataCalc()
@@ -1536,6 +1816,21 @@ static  CPU_INT32U  NetUtil_16BitSumDataCalc (void         *p_data,
 *
 *                   (b) ... the one's-complement sum MUST be converted to host-order but MUST NOT be re-
 *                       converted back to network-order (see 'NetUtil_16BitSumDataCalc()  Note #5c3').
+*
+*               (6) If a transport layer packet's data was written with NetBuf_DataWrChkSum(), the data's
+*                   16-bit sum is already cached in the packet buffer (see 'net_buf.h  NETWORK BUFFER
+*                   HEADER DATA TYPE  Note #4'); ONLY the transport header is summed & the cached sum is
+*                   added in, if :
+*
+*                   (a) The cached sum covers exactly the packet's data, ...
+*                   (b) ... the data directly follows an even-length transport header, ...
+*                   (c) ... NO octet is pending from the pseudo-header  ...
+*                   (d) ... & the packet is in a single buffer.
+*
+*               (7) If a transmit packet's data is NOT held in its buffer's DATA area but referenced in
+*                   external memory (see 'net_buf.h  NETWORK BUFFER HEADER DATA TYPE  Note #5') & its sum
+*                   is NOT cached, the transport header is summed from the buffer's DATA area & the data
+*                   from the external memory.
 *********************************************************************************************************
 */
 
@@ -1554,6 +1849,8 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
     CPU_INT16U    sum_ones_cpl_host;
     CPU_INT16U    data_ix;
     CPU_INT16U    data_len;
+    CPU_INT16U    hdr_len;
+    CPU_BOOLEAN   chk_sum_cached;
     CPU_INT08U    sum_err;
     CPU_INT08U    octet_prev;
     CPU_INT08U    octet_last;
@@ -1613,6 +1910,7 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
             case NET_PROTOCOL_TYPE_ICMP_V6:
                  data_ix  = pbuf_hdr->ICMP_MsgIx;
                  data_len = pbuf_hdr->ICMP_HdrLen    + (CPU_INT16U)pbuf_hdr->DataLen;
+                 hdr_len  = 0u;
                  break;
 
 
@@ -1624,11 +1922,13 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
 #endif
                  data_ix  = pbuf_hdr->TransportHdrIx;
                  data_len = pbuf_hdr->TransportHdrLen + (CPU_INT16U)pbuf_hdr->DataLen;
+                 hdr_len  = pbuf_hdr->TransportHdrLen;
                  break;
 
             case NET_PROTOCOL_TYPE_IP_V6_EXT_NONE:
                 data_ix  = pbuf_hdr->TotLen - pbuf_hdr->DataLen;
                 data_len = pbuf_hdr->DataLen;
+                hdr_len  = 0u;
                 break;
 
 
@@ -1647,14 +1947,65 @@ static  CPU_INT16U  NetUtil_16BitOnesCplSumDataCalc (void        *pdata_buf,
         p_data       = (void    *)&pbuf->DataPtr[data_ix];
         pbuf_next    = (NET_BUF *) pbuf_hdr->NextBufPtr;
         mem_buf_last = (pbuf_next == (NET_BUF *)0) ? DEF_YES : DEF_NO;
-                                                                    /* Calc pkt buf's 16-bit sum.                       */
-        sum_val      =  NetUtil_16BitSumDataCalc((void       *) p_data,
-                                                 (CPU_INT16U  ) data_len,
-                                                 (CPU_INT08U *)&octet_prev,
-                                                 (CPU_INT08U *)&octet_last,
-                                                 (CPU_BOOLEAN ) octet_prev_valid,
-                                                 (CPU_BOOLEAN ) mem_buf_last,
-                                                 (CPU_INT08U *)&sum_err);
+
+        chk_sum_cached = DEF_NO;                                    /* Chk for cached data sum (see Note #6).           */
+        if ((hdr_len                  >  0u)                           &&
+            ((hdr_len % 2u)           == 0u)                           &&
+            (pbuf_hdr->ChkSumDataLen  >  0u)                           &&
+            (pbuf_hdr->ChkSumDataLen  == pbuf_hdr->DataLen)            &&
+            (pbuf_hdr->ChkSumDataIx   == (CPU_INT16U)(data_ix + hdr_len)) &&
+            (octet_prev_valid         == DEF_NO)                       &&
+            (mem_buf_last             == DEF_YES)) {
+            chk_sum_cached = DEF_YES;
+        }
+
+        if (chk_sum_cached == DEF_YES) {                            /* If data sum cached, ...                          */
+            sum_val  = NetUtil_16BitSumDataCalc((void       *) p_data,  /* ... calc transport hdr's 16-bit sum ...      */
+                                                (CPU_INT16U  ) hdr_len,
+                                                (CPU_INT08U *)&octet_prev,
+                                                (CPU_INT08U *)&octet_last,
+                                                (CPU_BOOLEAN ) octet_prev_valid,
+                                                (CPU_BOOLEAN ) mem_buf_last,
+                                                (CPU_INT08U *)&sum_err);
+            sum_val += (CPU_INT32U)pbuf_hdr->ChkSumData;            /* ... & add cached data sum.                       */
+
+#if (NET_BUF_CFG_EXT_DATA_EN == DEF_ENABLED)
+        } else if (pbuf_hdr->ExtDataPtr != (CPU_INT08U *)0) {       /* Else if data ext (see Note #7), ...              */
+            sum_val  = NetUtil_16BitSumDataCalc((void       *) p_data,  /* ... calc transport hdr's 16-bit sum ...      */
+                                                (CPU_INT16U  ) hdr_len,
+                                                (CPU_INT08U *)&octet_prev,
+                                                (CPU_INT08U *)&octet_last,
+                                                (CPU_BOOLEAN ) octet_prev_valid,
+                                                (CPU_BOOLEAN ) DEF_NO,
+                                                (CPU_INT08U *)&sum_err);
+
+            octet_last_valid = DEF_BIT_IS_SET(sum_err, NET_UTIL_16_BIT_SUM_ERR_LAST_OCTET);
+            if (octet_last_valid == DEF_YES) {                      /* ... prepend any last hdr octet to data, ...      */
+                octet_prev        = octet_last;
+                octet_prev_valid  = DEF_YES;
+            } else {
+                octet_prev        = 0u;
+                octet_prev_valid  = DEF_NO;
+            }
+                                                                    /* ... & add ext data's 16-bit sum.                 */
+            sum_val += NetUtil_16BitSumDataCalc((void       *) pbuf_hdr->ExtDataPtr,
+                                                (CPU_INT16U  ) pbuf_hdr->DataLen,
+                                                (CPU_INT08U *)&octet_prev,
+                                                (CPU_INT08U *)&octet_last,
+                                                (CPU_BOOLEAN ) octet_prev_valid,
+                                                (CPU_BOOLEAN ) mem_buf_last,
+                                                (CPU_INT08U *)&sum_err);
+#endif
+
+        } else {                                                    /* Else calc pkt buf's 16-bit sum.                  */
+            sum_val  = NetUtil_16BitSumDataCalc((void       *) p_data,
+                                                (CPU_INT16U  ) data_len,
+                                                (CPU_INT08U *)&octet_prev,
+                                                (CPU_INT08U *)&octet_last,
+                                                (CPU_BOOLEAN ) octet_prev_valid,
+                                                (CPU_BOOLEAN ) mem_buf_last,
+                                                (CPU_INT08U *)&sum_err);
+        }
 
 #if (NET_ERR_CFG_ARG_CHK_DBG_EN == DEF_ENABLED)
         if (mem_buf_first == DEF_YES) {
@@ -407,6 +407,10 @@ CPU_BOOLEAN  NetUtil_16BitOnesCplChkSumDataVerify(void        *pdata_buf,
                                                   CPU_INT16U   pseudo_hdr_size,
                                                   NET_ERR     *p_err);
 
+CPU_INT16U   NetUtil_16BitSumDataCopy            (void        *p_dest,
+                                                  void        *p_src,
+                                                  CPU_INT16U   size);
+
 
                                                                 /* -------------------- CRC FNCTS --------------------- */
 CPU_INT32U   NetUtil_32BitCRC_Calc               (CPU_INT08U  *p_data,
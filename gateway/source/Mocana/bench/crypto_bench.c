@@ -0,0 +1,745 @@
+/*
+ * crypto_bench.c
+ *
+ * Host micro-benchmark for the Mocana crypto primitives used by nanoSSL.
+ *
+ * Builds against the same moptions_custom.h as the target, with the POSIX
+ * platform layer (platform/linux_rtos.c) in place of ucos_rtos.c, so results
+ * track the code paths the gateway actually runs. Output is a single JSON
+ * document on stdout, intended to be diffed before/after a crypto change:
+ *
+ *   bulk ciphers/hashes : cycles/byte and MB/s for several buffer sizes
+ *   public key          : ops/s for RSA sign/verify and raw modexp per key size
+ *   random              : cycles/byte for the CTR DRBG
+ *   every entry         : MALLOC calls per operation
+ *
+ * Before timing anything, the multi-message / prefix-midstate SHA-256 and
+ * HMAC-SHA256 paths are checked against the single-message ones and the
+ * RFC 4231 vectors ("kat" entries); a mismatch makes the run exit 1.
+ *
+ * Cycles are read from the TSC on x86; elsewhere they are derived from
+ * CLOCK_MONOTONIC and the nominal clock passed with -f <MHz>.
+ *
+ * Usage: crypto_bench [-t <ms per case>] [-f <MHz>] [-q]
+ *
+ */
+
+#include "../common/moptions.h"
+#include "../common/mdefs.h"
+#include "../common/mtypes.h"
+#include "../common/merrors.h"
+#include "../common/mrtos.h"
+#include "../common/mstdlib.h"
+#include "../common/random.h"
+#include "../common/vlong.h"
+#include "../crypto/hw_accel.h"
+#include "../crypto/crypto.h"
+#include "../crypto/aes.h"
+#include "../crypto/md5.h"
+#include "../crypto/sha1.h"
+#include "../crypto/sha256.h"
+#include "../crypto/sha512.h"
+#include "../crypto/hmac.h"
+#include "../crypto/rsa.h"
+#include "../crypto/nist_rng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC
+#endif
+
+
+/*------------------------------------------------------------------*/
+
+#define BENCH_DEFAULT_MS            (300)
+#define BENCH_MAX_BUF_SIZE          (16384)
+
+static const ubyte4 m_bulkSizes[] = { 64, 1024, 16384 };
+#ifdef __ENABLE_MOCANA_RSA_ALL_KEYSIZE__
+static const ubyte4 m_rsaKeySizes[] = { 1024, 2048, 3072 };
+#else
+static const ubyte4 m_rsaKeySizes[] = { 2048, 3072 };     /* the only sizes rsa.c accepts */
+#endif
+
+static ubyte4   m_minMS   = BENCH_DEFAULT_MS;
+static double   m_cpuMHz  = 0.0;
+static int      m_quiet   = 0;
+static int      m_first   = 1;
+static int      m_katFail = 0;
+
+static ubyte    m_buf[BENCH_MAX_BUF_SIZE + 64];
+static ubyte    m_out[BENCH_MAX_BUF_SIZE + 64];
+
+
+/*------------------------------------------------------------------*/
+/* allocation accounting: the Makefile maps RTOS_malloc/RTOS_free here */
+
+static ubyte4 m_allocCount = 0;
+
+extern void *
+BENCH_malloc(ubyte4 size)
+{
+    m_allocCount++;
+    return malloc(size);
+}
+
+extern void
+BENCH_free(void *p)
+{
+    free(p);
+}
+
+
+/*------------------------------------------------------------------*/
+
+typedef struct benchClock
+{
+    struct timespec ts;
+    ubyte8          tsc;
+
+} benchClock;
+
+static void
+BENCH_clock(benchClock* pClock)
+{
+    clock_gettime(CLOCK_MONOTONIC, &pClock->ts);
+#ifdef BENCH_HAVE_TSC
+    pClock->tsc = __rdtsc();
+#else
+    pClock->tsc = 0;
+#endif
+}
+
+static double
+BENCH_elapsedNS(const benchClock* pStart, const benchClock* pEnd)
+{
+    return ((double)(pEnd->ts.tv_sec - pStart->ts.tv_sec) * 1e9) +
+            (double)(pEnd->ts.tv_nsec - pStart->ts.tv_nsec);
+}
+
+static double
+BENCH_elapsedCycles(const benchClock* pStart, const benchClock* pEnd)
+{
+    if (0.0 < m_cpuMHz)
+        return BENCH_elapsedNS(pStart, pEnd) * m_cpuMHz / 1e3;
+
+    return (double)(pEnd->tsc - pStart->tsc);
+}
+
+
+/*------------------------------------------------------------------*/
+
+typedef MSTATUS (*benchFunc)(void *pArg, ubyte4 len);
+
+typedef struct benchResult
+{
+    ubyte8  iterations;
+    double  ns;
+    double  cycles;
+    ubyte4  allocs;
+
+} benchResult;
+
+static MSTATUS
+BENCH_run(benchFunc func, void *pArg, ubyte4 len, benchResult *pResult)
+{
+    benchClock  start, end;
+    ubyte8      iterations = 0;
+    ubyte4      batch = 1;
+    double      limitNS = (double)m_minMS * 1e6;
+    ubyte4      i;
+    MSTATUS     status;
+
+    /* warm caches and any lazily built tables */
+    if (OK > (status = func(pArg, len)))
+        goto exit;
+
+    m_allocCount = 0;
+    BENCH_clock(&start);
+
+    do
+    {
+        for (i = 0; i < batch; i++)
+        {
+            if (OK > (status = func(pArg, len)))
+                goto exit;
+        }
+
+        iterations += batch;
+        if (batch < 4096)
+            batch <<= 1;
+
+        BENCH_clock(&end);
+    }
+    while (BENCH_elapsedNS(&start, &end) < limitNS);
+
+    pResult->iterations = iterations;
+    pResult->ns         = BENCH_elapsedNS(&start, &end);
+    pResult->cycles     = BENCH_elapsedCycles(&start, &end);
+    pResult->allocs     = m_allocCount;
+
+exit:
+    return status;
+}
+
+
+/*------------------------------------------------------------------*/
+
+static void
+BENCH_emit(const char *pGroup, const char *pName, ubyte4 len, const benchResult *pResult)
+{
+    double  perOpNS     = pResult->ns / (double)pResult->iterations;
+    double  perOpCycles = pResult->cycles / (double)pResult->iterations;
+    double  allocsPerOp = (double)pResult->allocs / (double)pResult->iterations;
+
+    printf("%s\n    { \"group\": \"%s\", \"name\": \"%s\", \"iterations\": %llu",
+           m_first ? "" : ",", pGroup, pName, (unsigned long long)pResult->iterations);
+    m_first = 0;
+
+    if (len)
+    {
+        printf(", \"bytes\": %u, \"cycles_per_byte\": %.2f, \"mb_per_s\": %.2f",
+               len, perOpCycles / (double)len, ((double)len * 1e3) / perOpNS);
+    }
+
+    printf(", \"ops_per_s\": %.1f, \"ns_per_op\": %.0f, \"allocs_per_op\": %.2f }",
+           1e9 / perOpNS, perOpNS, allocsPerOp);
+
+    if (!m_quiet)
+    {
+        fprintf(stderr, "%-8s %-22s %6u B  %10.1f ops/s", pGroup, pName, len, 1e9 / perOpNS);
+        if (len)
+            fprintf(stderr, "  %8.2f cyc/B", perOpCycles / (double)len);
+        fprintf(stderr, "  %6.2f allocs/op\n", allocsPerOp);
+    }
+}
+
+static void
+BENCH_emitError(const char *pGroup, const char *pName, MSTATUS status)
+{
+    printf("%s\n    { \"group\": \"%s\", \"name\": \"%s\", \"error\": %d }",
+           m_first ? "" : ",", pGroup, pName, (int)status);
+    m_first = 0;
+
+    fprintf(stderr, "%-8s %-22s FAILED (%d)\n", pGroup, pName, (int)status);
+}
+
+static void
+BENCH_case(const char *pGroup, const char *pName, benchFunc func, void *pArg, ubyte4 len)
+{
+    benchResult result;
+    MSTATUS     status;
+
+    if (OK > (status = BENCH_run(func, pArg, len, &result)))
+        BENCH_emitError(pGroup, pName, status);
+    else
+        BENCH_emit(pGroup, pName, len, &result);
+}
+
+
+/*------------------------------------------------------------------*/
+/* bulk ciphers */
+
+typedef struct aesArg
+{
+    BulkCtx ctx;
+    sbyte4  encrypt;
+    ubyte   iv[AES_BLOCK_SIZE];
+
+} aesArg;
+
+static MSTATUS
+BENCH_aesCBC(void *pArg, ubyte4 len)
+{
+    aesArg *pAes = (aesArg *)pArg;
+
+    return DoAES(MOC_SYM(hwAccelCtx) pAes->ctx, m_buf, (sbyte4)len, pAes->encrypt, pAes->iv);
+}
+
+static MSTATUS
+BENCH_aesKeySetup(void *pArg, ubyte4 len)
+{
+    BulkCtx ctx;
+    MOC_UNUSED(len);
+
+    if (NULL == (ctx = CreateAESCtx(MOC_SYM(hwAccelCtx) m_out, (sbyte4)(usize)pArg, 1)))
+        return ERR_MEM_ALLOC_FAIL;
+
+    return DeleteAESCtx(MOC_SYM(hwAccelCtx) &ctx);
+}
+
+static void
+BENCH_ciphers(void)
+{
+    static const sbyte4 keyLens[] = { 16, 32 };
+    char    name[32];
+    aesArg  arg;
+    ubyte4  i, j;
+    sbyte4  encrypt;
+
+    for (i = 0; i < COUNTOF(keyLens); i++)
+    {
+        sprintf(name, "aes%d-key-setup", (int)keyLens[i] * 8);
+        BENCH_case("cipher", name, BENCH_aesKeySetup, (void *)(usize)keyLens[i], 0);
+
+        for (encrypt = 1; encrypt >= 0; encrypt--)
+        {
+            if (NULL == (arg.ctx = CreateAESCtx(MOC_SYM(hwAccelCtx) m_out, keyLens[i], encrypt)))
+            {
+                BENCH_emitError("cipher", "aes-cbc", ERR_MEM_ALLOC_FAIL);
+                continue;
+            }
+
+            arg.encrypt = encrypt;
+            MOC_MEMSET(arg.iv, 0x5a, AES_BLOCK_SIZE);
+
+            sprintf(name, "aes%d-cbc-%s", (int)keyLens[i] * 8, encrypt ? "encrypt" : "decrypt");
+            for (j = 0; j < COUNTOF(m_bulkSizes); j++)
+                BENCH_case("cipher", name, BENCH_aesCBC, &arg, m_bulkSizes[j]);
+
+            DeleteAESCtx(MOC_SYM(hwAccelCtx) &arg.ctx);
+        }
+    }
+}
+
+
+/*------------------------------------------------------------------*/
+/* hashes and MACs */
+
+static MSTATUS BENCH_sha1(void *pArg, ubyte4 len)   { MOC_UNUSED(pArg); return SHA1_completeDigest(MOC_HASH(hwAccelCtx) m_buf, len, m_out); }
+static MSTATUS BENCH_sha256(void *pArg, ubyte4 len) { MOC_UNUSED(pArg); return SHA256_completeDigest(MOC_HASH(hwAccelCtx) m_buf, len, m_out); }
+#ifndef __DISABLE_MOCANA_SHA384__
+static MSTATUS BENCH_sha384(void *pArg, ubyte4 len) { MOC_UNUSED(pArg); return SHA384_completeDigest(MOC_HASH(hwAccelCtx) m_buf, len, m_out); }
+#endif
+#ifndef __DISABLE_MOCANA_SHA512__
+static MSTATUS BENCH_sha512(void *pArg, ubyte4 len) { MOC_UNUSED(pArg); return SHA512_completeDigest(MOC_HASH(hwAccelCtx) m_buf, len, m_out); }
+#endif
+
+static MSTATUS
+BENCH_hmacSHA1(void *pArg, ubyte4 len)
+{
+    MOC_UNUSED(pArg);
+    return HMAC_SHA1_quick(MOC_HASH(hwAccelCtx) m_out, 20, m_buf, (sbyte4)len, m_out + 64);
+}
+
+static MSTATUS
+BENCH_hmac(void *pArg, ubyte4 len)
+{
+    const BulkHashAlgo *pAlgo = (const BulkHashAlgo *)pArg;
+
+    return HmacQuick(MOC_HASH(hwAccelCtx) m_out, (sbyte4)pAlgo->digestSize, m_buf, (sbyte4)len, m_out + 64, pAlgo);
+}
+
+static void
+BENCH_hashes(void)
+{
+    const BulkHashAlgo *pSHA256 = NULL;
+    ubyte4 j;
+
+    for (j = 0; j < COUNTOF(m_bulkSizes); j++)
+    {
+        BENCH_case("hash", "sha1",   BENCH_sha1,   NULL, m_bulkSizes[j]);
+        BENCH_case("hash", "sha256", BENCH_sha256, NULL, m_bulkSizes[j]);
+#ifndef __DISABLE_MOCANA_SHA384__
+        BENCH_case("hash", "sha384", BENCH_sha384, NULL, m_bulkSizes[j]);
+#endif
+#ifndef __DISABLE_MOCANA_SHA512__
+        BENCH_case("hash", "sha512", BENCH_sha512, NULL, m_bulkSizes[j]);
+#endif
+    }
+
+    CRYPTO_getRSAHashAlgo(sha256withRSAEncryption, &pSHA256);
+
+    for (j = 0; j < COUNTOF(m_bulkSizes); j++)
+    {
+        BENCH_case("mac", "hmac-sha1", BENCH_hmacSHA1, NULL, m_bulkSizes[j]);
+        if (NULL != pSHA256)
+            BENCH_case("mac", "hmac-sha256", BENCH_hmac, (void *)pSHA256, m_bulkSizes[j]);
+    }
+}
+
+
+/*------------------------------------------------------------------*/
+/* known answers: multi-message and prefixed paths vs single-message ones */
+
+static void
+BENCH_emitKat(const char *pName, ubyte4 checks, ubyte4 failures, MSTATUS status)
+{
+    int pass = ((OK <= status) && (0 == failures));
+
+    printf("%s\n    { \"group\": \"kat\", \"name\": \"%s\", \"checks\": %u, \"pass\": %s",
+           m_first ? "" : ",", pName, checks, pass ? "true" : "false");
+    if (OK > status)
+        printf(", \"error\": %d", (int)status);
+    printf(" }");
+    m_first = 0;
+
+    if (!pass)
+        m_katFail = 1;
+
+    if (!m_quiet || !pass)
+        fprintf(stderr, "%-8s %-22s %6u checks  %s\n", "kat", pName, checks, pass ? "ok" : "FAILED");
+}
+
+static void
+BENCH_katSHA256(void)
+{
+    /* around the padding boundaries (55/56/64) and across several blocks */
+    static const ubyte4 lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 128, 1000 };
+    static const ubyte4 prefixLens[] = { 0, 13, 64, 100 };
+    SHA256_CTX      prefix;
+    const ubyte*    pMsgs[COUNTOF(lens)];
+    ubyte4          msgLens[COUNTOF(lens)];
+    ubyte*          pOutputs[COUNTOF(lens)];
+    ubyte           outputs[COUNTOF(lens)][SHA256_RESULT_SIZE];
+    ubyte           expect[SHA256_RESULT_SIZE];
+    ubyte4          checks = 0, failures = 0;
+    ubyte4          i, p;
+    MSTATUS         status;
+
+    for (i = 0; i < COUNTOF(lens); i++)
+    {
+        pOutputs[i] = outputs[i];
+        msgLens[i]  = lens[i];
+    }
+
+    /* NULL prefix: every message hashed from scratch */
+    for (i = 0; i < COUNTOF(lens); i++)
+        pMsgs[i] = m_buf + i;
+
+    if (OK > (status = SHA256_completeDigestMulti(MOC_HASH(hwAccelCtx) NULL, COUNTOF(lens), pMsgs, msgLens, pOutputs)))
+        goto exit;
+
+    for (i = 0; i < COUNTOF(lens); i++, checks++)
+    {
+        if (OK > (status = SHA256_completeDigest(MOC_HASH(hwAccelCtx) pMsgs[i], lens[i], expect)))
+            goto exit;
+        if (0 != memcmp(expect, outputs[i], SHA256_RESULT_SIZE))
+            failures++;
+    }
+
+    /* shared prefix: SHA256(P + M[i]) resumed from the midstate of P */
+    for (p = 0; p < COUNTOF(prefixLens); p++)
+    {
+        for (i = 0; i < COUNTOF(lens); i++)
+            pMsgs[i] = m_buf + prefixLens[p];
+
+        if ((OK > (status = SHA256_initDigest(MOC_HASH(hwAccelCtx) &prefix))) ||
+            (OK > (status = SHA256_updateDigest(MOC_HASH(hwAccelCtx) &prefix, m_buf, prefixLens[p]))) ||
+            (OK > (status = SHA256_completeDigestMulti(MOC_HASH(hwAccelCtx) &prefix, COUNTOF(lens), pMsgs, msgLens, pOutputs))))
+        {
+            goto exit;
+        }
+
+        for (i = 0; i < COUNTOF(lens); i++, checks++)
+        {
+            if (OK > (status = SHA256_completeDigest(MOC_HASH(hwAccelCtx) m_buf, prefixLens[p] + lens[i], expect)))
+                goto exit;
+            if (0 != memcmp(expect, outputs[i], SHA256_RESULT_SIZE))
+                failures++;
+        }
+    }
+
+exit:
+    BENCH_emitKat("sha256-multi", checks, failures, status);
+}
+
+static void
+BENCH_katHMAC_SHA256(const BulkHashAlgo *pSHA256)
+{
+    /* RFC 4231 test cases 1 and 6 (key longer than a block) */
+    static const ubyte rfcKey1[20] =
+    {
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b
+    };
+    static const ubyte rfcMac1[SHA256_RESULT_SIZE] =
+    {
+        0xb0, 0x34, 0x4c, 0x61, 0xd8, 0xdb, 0x38, 0x53, 0x5c, 0xa8, 0xaf, 0xce, 0xaf, 0x0b, 0xf1, 0x2b,
+        0x88, 0x1d, 0xc2, 0x00, 0xc9, 0x83, 0x3d, 0xa7, 0x26, 0xe9, 0x37, 0x6c, 0x2e, 0x32, 0xcf, 0xf7
+    };
+    static const ubyte rfcMac6[SHA256_RESULT_SIZE] =
+    {
+        0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f, 0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7, 0x7f,
+        0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14, 0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54
+    };
+    static const char rfcText6[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+    static const ubyte4 keyLens[] = { 20, 32, 64, 65, 131 };
+    static const ubyte4 lens[] = { 0, 1, 55, 64, 100, 1000 };
+    ubyte           rfcKey6[131];
+    SHA256_CTX      inner, outer;
+    const ubyte*    pTexts[COUNTOF(lens)];
+    ubyte4          textLens[COUNTOF(lens)];
+    ubyte*          pResults[COUNTOF(lens)];
+    ubyte           results[COUNTOF(lens)][SHA256_RESULT_SIZE];
+    ubyte           expect[SHA256_RESULT_SIZE];
+    ubyte4          checks = 0, failures = 0;
+    ubyte4          i, k;
+    MSTATUS         status;
+
+    /* RFC 4231: fixed vectors through the prefixed path */
+    pTexts[0] = (const ubyte *)"Hi There"; textLens[0] = 8; pResults[0] = results[0];
+    if ((OK > (status = HMAC_SHA256_prefixes(MOC_HASH(hwAccelCtx) rfcKey1, sizeof(rfcKey1), &inner, &outer))) ||
+        (OK > (status = HMAC_SHA256_multi(MOC_HASH(hwAccelCtx) &inner, &outer, 1, pTexts, textLens, pResults))))
+    {
+        goto exit;
+    }
+    checks++;
+    if (0 != memcmp(rfcMac1, results[0], SHA256_RESULT_SIZE))
+        failures++;
+
+    MOC_MEMSET(rfcKey6, 0xaa, sizeof(rfcKey6));
+    pTexts[0] = (const ubyte *)rfcText6; textLens[0] = sizeof(rfcText6) - 1;
+    if ((OK > (status = HMAC_SHA256_prefixes(MOC_HASH(hwAccelCtx) rfcKey6, sizeof(rfcKey6), &inner, &outer))) ||
+        (OK > (status = HMAC_SHA256_multi(MOC_HASH(hwAccelCtx) &inner, &outer, 1, pTexts, textLens, pResults))))
+    {
+        goto exit;
+    }
+    checks++;
+    if (0 != memcmp(rfcMac6, results[0], SHA256_RESULT_SIZE))
+        failures++;
+
+    /* several texts from one keying vs one HmacQuick per text */
+    for (i = 0; i < COUNTOF(lens); i++)
+    {
+        pTexts[i]   = m_buf + 256 + i;
+        textLens[i] = lens[i];
+        pResults[i] = results[i];
+    }
+
+    for (k = 0; k < COUNTOF(keyLens); k++)
+    {
+        if ((OK > (status = HMAC_SHA256_prefixes(MOC_HASH(hwAccelCtx) m_buf + k, (sbyte4)keyLens[k], &inner, &outer))) ||
+            (OK > (status = HMAC_SHA256_multi(MOC_HASH(hwAccelCtx) &inner, &outer, COUNTOF(lens), pTexts, textLens, pResults))))
+        {
+            goto exit;
+        }
+
+        for (i = 0; i < COUNTOF(lens); i++, checks++)
+        {
+            if (OK > (status = HmacQuick(MOC_HASH(hwAccelCtx) m_buf + k, (sbyte4)keyLens[k],
+                                         pTexts[i], (sbyte4)lens[i], expect, pSHA256)))
+            {
+                goto exit;
+            }
+            if (0 != memcmp(expect, results[i], SHA256_RESULT_SIZE))
+                failures++;
+        }
+    }
+
+exit:
+    BENCH_emitKat("hmac-sha256-multi", checks, failures, status);
+}
+
+static void
+BENCH_kat(void)
+{
+    const BulkHashAlgo *pSHA256 = NULL;
+
+    BENCH_katSHA256();
+
+    CRYPTO_getRSAHashAlgo(sha256withRSAEncryption, &pSHA256);
+    if (NULL != pSHA256)
+        BENCH_katHMAC_SHA256(pSHA256);
+    else
+        BENCH_emitKat("hmac-sha256-multi", 0, 0, ERR_NULL_POINTER);
+}
+
+
+/*------------------------------------------------------------------*/
+/* random */
+
+static MSTATUS
+BENCH_drbg(void *pArg, ubyte4 len)
+{
+    return RANDOM_numberGenerator((randomContext *)pArg, m_out, (sbyte4)len);
+}
+
+static MSTATUS
+BENCH_newDRBG(randomContext **ppRandomContext)
+{
+    ubyte seed[AES_BLOCK_SIZE + 16];
+
+    /* fixed seed: runs must be reproducible, this is not a key */
+    MOC_MEMSET(seed, 0xa5, sizeof(seed));
+
+    return NIST_CTRDRBG_newContext(MOC_SYM(hwAccelCtx) ppRandomContext, seed, 16, AES_BLOCK_SIZE, NULL, 0);
+}
+
+static void
+BENCH_random(randomContext *pRandomContext)
+{
+    ubyte4 j;
+
+    for (j = 0; j < COUNTOF(m_bulkSizes); j++)
+        BENCH_case("random", "ctr-drbg-aes128", BENCH_drbg, pRandomContext, m_bulkSizes[j]);
+}
+
+
+/*------------------------------------------------------------------*/
+/* public key */
+
+typedef struct rsaArg
+{
+    RSAKey* pKey;
+    vlong*  pVlongQueue;
+    vlong*  pBase;
+    vlong*  pExponent;
+    ubyte4  sigLen;
+
+} rsaArg;
+
+static MSTATUS
+BENCH_rsaSign(void *pArg, ubyte4 len)
+{
+    rsaArg *pRsa = (rsaArg *)pArg;
+    MOC_UNUSED(len);
+
+    /* 35 bytes: a SHA-1 DigestInfo, as signed by the TLS handshake */
+    return RSA_signMessage(MOC_RSA(hwAccelCtx) pRsa->pKey, m_buf, 35, m_out, &pRsa->pVlongQueue);
+}
+
+static MSTATUS
+BENCH_rsaVerify(void *pArg, ubyte4 len)
+{
+    rsaArg *pRsa = (rsaArg *)pArg;
+    ubyte4  plainLen;
+    MOC_UNUSED(len);
+
+    return RSA_verifySignature(MOC_RSA(hwAccelCtx) pRsa->pKey, m_out, m_buf + 64, &plainLen, &pRsa->pVlongQueue);
+}
+
+static MSTATUS
+BENCH_modexp(void *pArg, ubyte4 len)
+{
+    rsaArg *pRsa = (rsaArg *)pArg;
+    vlong  *pResult = NULL;
+    MSTATUS status;
+    MOC_UNUSED(len);
+
+    if (OK <= (status = VLONG_modexp(MOC_MOD(hwAccelCtx) pRsa->pBase, pRsa->pExponent,
+                                     RSA_N(pRsa->pKey), &pResult, &pRsa->pVlongQueue)))
+    {
+        status = VLONG_freeVlong(&pResult, &pRsa->pVlongQueue);
+    }
+
+    return status;
+}
+
+static void
+BENCH_rsa(randomContext *pRandomContext)
+{
+    char    name[32];
+    rsaArg  arg;
+    ubyte4  i;
+    MSTATUS status;
+
+    for (i = 0; i < COUNTOF(m_rsaKeySizes); i++)
+    {
+        MOC_MEMSET((ubyte *)&arg, 0, sizeof(arg));
+
+        sprintf(name, "rsa%u-keygen", m_rsaKeySizes[i]);
+        if ((OK > (status = RSA_createKey(&arg.pKey))) ||
+            (OK > (status = RSA_generateKey(MOC_RSA(hwAccelCtx) pRandomContext, arg.pKey,
+                                            m_rsaKeySizes[i], &arg.pVlongQueue))))
+        {
+            BENCH_emitError("pubkey", name, status);
+            goto next;
+        }
+
+        sprintf(name, "rsa%u-sign", m_rsaKeySizes[i]);
+        BENCH_case("pubkey", name, BENCH_rsaSign, &arg, 0);
+
+        sprintf(name, "rsa%u-verify", m_rsaKeySizes[i]);
+        BENCH_case("pubkey", name, BENCH_rsaVerify, &arg, 0);
+
+        /* full-width exponent without CRT: the cost of one private op done naively */
+        if ((OK > (status = VLONG_makeRandomVlong(pRandomContext, &arg.pBase, m_rsaKeySizes[i] - 1, &arg.pVlongQueue))) ||
+            (OK > (status = VLONG_makeRandomVlong(pRandomContext, &arg.pExponent, m_rsaKeySizes[i], &arg.pVlongQueue))))
+        {
+            BENCH_emitError("pubkey", "modexp", status);
+            goto next;
+        }
+
+        sprintf(name, "modexp%u", m_rsaKeySizes[i]);
+        BENCH_case("pubkey", name, BENCH_modexp, &arg, 0);
+
+next:
+        VLONG_freeVlong(&arg.pBase, &arg.pVlongQueue);
+        VLONG_freeVlong(&arg.pExponent, &arg.pVlongQueue);
+        if (NULL != arg.pKey)
+            RSA_freeKey(&arg.pKey, &arg.pVlongQueue);
+        VLONG_freeVlongQueue(&arg.pVlongQueue);
+    }
+}
+
+
+/*------------------------------------------------------------------*/
+
+int
+main(int argc, char *argv[])
+{
+    randomContext*  pRandomContext = NULL;
+    int             i;
+    MSTATUS         status;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-t")) && (i + 1 < argc))
+            m_minMS = (ubyte4)atoi(argv[++i]);
+        else if ((0 == strcmp(argv[i], "-f")) && (i + 1 < argc))
+            m_cpuMHz = atof(argv[++i]);
+        else if (0 == strcmp(argv[i], "-q"))
+            m_quiet = 1;
+        else
+        {
+            fprintf(stderr, "usage: %s [-t <ms per case>] [-f <cpu MHz>] [-q]\n", argv[0]);
+            return 2;
+        }
+    }
+
+#ifndef BENCH_HAVE_TSC
+    if (0.0 >= m_cpuMHz)
+    {
+        fprintf(stderr, "no cycle counter on this host: pass the nominal clock with -f <MHz>\n");
+        return 2;
+    }
+#endif
+
+    for (i = 0; i < (int)sizeof(m_buf); i++)
+        m_buf[i] = (ubyte)(i * 7 + 1);
+    MOC_MEMSET(m_out, 0x3c, sizeof(m_out));
+
+    if (OK > (status = RTOS_rtosInit()))
+        goto exit;
+
+    if (OK > (status = BENCH_newDRBG(&pRandomContext)))
+        goto exit;
+
+    printf("{\n  \"bench\": \"mocana-crypto\",\n  \"ms_per_case\": %u,\n"
+           "  \"cycle_source\": \"%s\",\n  \"results\": [",
+           m_minMS, (0.0 < m_cpuMHz) ? "clock_gettime*MHz" : "tsc");
+
+    BENCH_kat();
+    BENCH_ciphers();
+    BENCH_hashes();
+    BENCH_random(pRandomContext);
+    BENCH_rsa(pRandomContext);
+
+    printf("\n  ]\n}\n");
+
+exit:
+    if (NULL != pRandomContext)
+        NIST_CTRDRBG_deleteContext(MOC_SYM(hwAccelCtx) &pRandomContext);
+
+    RTOS_rtosShutdown();
+
+    if (OK > status)
+        fprintf(stderr, "crypto_bench: setup failed (%d)\n", (int)status);
+
+    return ((OK > status) || m_katFail) ? 1 : 0;
+}
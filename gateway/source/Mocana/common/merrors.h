@@ -344,6 +344,8 @@ enum enum_errDescrValues {
     ERROR_DEF       (ERR_SSL_OLD_CERT_CHAINS_NOT_SUPPORTED,             -7595)
     ERROR_DEF       (ERR_SSL_CONNECTION_BUSY,                           -7596)
     ERROR_DEF       (ERR_SSL_SERVER_INAPPROPRIATE_FALLBACK_SCSV,        -7597)
+    ERROR_DEF       (ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE,               -7598)
+    ERROR_DEF       (ERR_SSL_EXTENSION_MAX_FRAGMENT_LENGTH,             -7599)
 
     ERROR_DEF       (ERR_CERT,                                          -7600)
     ERROR_DEF       (ERR_CERT_BUFFER_OVERFLOW,                          -7601)
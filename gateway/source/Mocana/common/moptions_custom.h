@@ -26,7 +26,8 @@ extern "C" {
 #define __ENABLE_MOCANA_SSL_MUTUAL_AUTH_SUPPORT__
 #define __ENABLE_MOCANA_SSL_SERVER__
 #define __ENABLE_SSL_DYNAMIC_CERTIFICATE__
-//#define __ENABLE_RFC3546__
+// hello extensions; RFC 6066 adds max_fragment_length for small records
+#define __ENABLE_RFC3546__
 //#define __ENABLE_MOCANA_SSL_PSK_SUPPORT__
 //#define __ENABLE_MOCANA_RSA_ALL_KEYSIZE__
 
@@ -43,12 +44,15 @@ extern "C" {
 //#define  __ENABLE_MOCANA_SSL_NEW_HANDSHAKE__
 //#define  __ENABLE_MOCANA_SSL_PSK_SUPPORT__
 //#define  __ENABLE_RFC3576__
-//#define  __ENABLE_TLSEXT_RFC6066__
+#define  __ENABLE_TLSEXT_RFC6066__
 
 
 //#define __ENABLE_MOCANA_SSL_CLIENT_EXAMPLE__
 //#define __ENABLE_MOCANA_EXAMPLES__
+// host builds (e.g. bench/) select __RTOS_LINUX__ on the command line
+#ifndef __RTOS_LINUX__
 #define __UCOS__
+#endif
 
 
 // prevents a problem calling createThread
@@ -64,8 +68,16 @@ extern "C" {
 #define SSL_RECORDSIZE 1024
 #endif
 
+// encrypt/decrypt records in place in the TCP/IP stack's buffers
+#define __ENABLE_MOCANA_SSL_ZERO_COPY__
+
+// parse CA certificates once and remember verified server chains
+#define __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+
+#ifndef __RTOS_LINUX__
 #define RTOS_malloc   UCOS_malloc
 #define RTOS_free     UCOS_free
+#endif
 
 //#define __ENABLE_UCOS_FS__
 
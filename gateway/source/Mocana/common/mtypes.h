@@ -53,6 +53,10 @@ not seem to work (__LONG_LONG_MAX__ is still undefined) */
 
 #define __MOCANA_MAX_INT__ (64)
 
+#if !defined( __RTOS_WIN32__)
+typedef unsigned long long      ubyte8;     /* 64-bit hosts, e.g. bench/ */
+#endif
+
 typedef struct ubyte16
 {
     ubyte8 upper64;
@@ -23,6 +23,7 @@
 #include "../common/mrtos.h"
 #include "../crypto/md5.h"
 #include "../crypto/sha1.h"
+#include "../crypto/sha256.h"
 #include "../crypto/crypto.h"
 #include "../crypto/hmac.h"
 #ifdef __ENABLE_MOCANA_FIPS_MODULE__
@@ -332,6 +333,117 @@ exit:
 #endif /* __HMAC_SHA1_HARDWARE_HASH__ */
 
 
+/*------------------------------------------------------------------*/
+
+#ifndef __DISABLE_MOCANA_SHA256__
+
+extern MSTATUS
+HMAC_SHA256_prefixes(MOC_HASH(hwAccelDescr hwAccelCtx) const ubyte* key, sbyte4 keyLen,
+                     SHA256_CTX *pInner, SHA256_CTX *pOuter)
+{
+    ubyte       kpad[SHA256_BLOCK_SIZE];
+    ubyte       tk[SHA256_RESULT_SIZE];
+    sbyte4      i;
+    MSTATUS     status;
+
+#ifdef __ENABLE_MOCANA_FIPS_MODULE__
+    if (OK != getFIPS_powerupStatus(FIPS_ALGO_HMAC))
+        return getFIPS_powerupStatus(FIPS_ALGO_HMAC);
+#endif /* __ENABLE_MOCANA_FIPS_MODULE__ */
+
+    if ((NULL == key) || (NULL == pInner) || (NULL == pOuter))
+    {
+        status = ERR_NULL_POINTER;
+        goto exit;
+    }
+
+    /* if key is longer than SHA256_BLOCK_SIZE bytes reset it to key = SHA256(key) */
+    if (keyLen > SHA256_BLOCK_SIZE)
+    {
+        if (OK > (status = SHA256_completeDigest(MOC_HASH(hwAccelCtx) key, keyLen, tk)))
+            goto exit;
+
+        key = tk;
+        keyLen = SHA256_RESULT_SIZE;
+    }
+
+    /* XOR key padded with 0 to SHA256_BLOCK_SIZE with 0x36 */
+    for (i = 0; i < keyLen; i++)
+        kpad[i] = (ubyte)(key[i] ^ IPAD);
+    for (; i < SHA256_BLOCK_SIZE; i++)
+        kpad[i] = 0 ^ IPAD;
+
+    if (OK > (status = SHA256_initDigest(MOC_HASH(hwAccelCtx) pInner)))
+        goto exit;
+    if (OK > (status = SHA256_updateDigest(MOC_HASH(hwAccelCtx) pInner, kpad, SHA256_BLOCK_SIZE)))
+        goto exit;
+
+    /* XOR key padded with 0 to SHA256_BLOCK_SIZE with 0x5C */
+    for (i = 0; i < keyLen; i++)
+        kpad[i] = (ubyte)(key[i] ^ OPAD);
+    for (; i < SHA256_BLOCK_SIZE; i++)
+        kpad[i] = 0 ^ OPAD;
+
+    if (OK > (status = SHA256_initDigest(MOC_HASH(hwAccelCtx) pOuter)))
+        goto exit;
+    status = SHA256_updateDigest(MOC_HASH(hwAccelCtx) pOuter, kpad, SHA256_BLOCK_SIZE);
+
+exit:
+    MOC_MEMSET(kpad, 0x00, SHA256_BLOCK_SIZE);
+    MOC_MEMSET(tk, 0x00, SHA256_RESULT_SIZE);
+    return status;
+
+} /* HMAC_SHA256_prefixes */
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+HMAC_SHA256_multi(MOC_HASH(hwAccelDescr hwAccelCtx) const SHA256_CTX *pInner,
+                  const SHA256_CTX *pOuter, sbyte4 numTexts,
+                  const ubyte *pTexts[], const ubyte4 textLens[], ubyte *pResults[])
+{
+    ubyte4      digestLen = SHA256_RESULT_SIZE;
+    sbyte4      i;
+    MSTATUS     status;
+
+#ifdef __ENABLE_MOCANA_FIPS_MODULE__
+    if (OK != getFIPS_powerupStatus(FIPS_ALGO_HMAC))
+        return getFIPS_powerupStatus(FIPS_ALGO_HMAC);
+#endif /* __ENABLE_MOCANA_FIPS_MODULE__ */
+
+    if ((NULL == pInner) || (NULL == pOuter) || (NULL == pResults))
+    {
+        status = ERR_NULL_POINTER;
+        goto exit;
+    }
+
+    /* inner hashes, all resumed from the (K ^ ipad) midstate */
+    if (OK > (status = SHA256_completeDigestMulti(MOC_HASH(hwAccelCtx) pInner, numTexts,
+                                                  pTexts, textLens, pResults)))
+    {
+        goto exit;
+    }
+
+    /* outer hashes, each over its own inner digest, in place */
+    for (i = 0; i < numTexts; i++)
+    {
+        if (OK > (status = SHA256_completeDigestMulti(MOC_HASH(hwAccelCtx) pOuter, 1,
+                                                      (const ubyte **)&pResults[i], &digestLen,
+                                                      &pResults[i])))
+        {
+            goto exit;
+        }
+    }
+
+exit:
+    return status;
+
+} /* HMAC_SHA256_multi */
+
+#endif /* __DISABLE_MOCANA_SHA256__ */
+
+
 /*------------------------------------------------------------------*/
 
 extern MSTATUS
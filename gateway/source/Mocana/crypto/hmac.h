@@ -25,6 +25,8 @@ This file contains the following public ($extern$) functions:
 - HMAC_MD5_quick
 - HMAC_SHA1
 - HMAC_SHA1_quick
+- HMAC_SHA256_multi
+- HMAC_SHA256_prefixes
 - HmacCreate
 - HmacDelete
 - HmacFinal
@@ -79,6 +81,21 @@ MOC_EXTERN MSTATUS HMAC_MD5_quick(MOC_HASH(hwAccelDescr hwAccelCtx)  const ubyte
 MOC_EXTERN MSTATUS HMAC_SHA1_quick(MOC_HASH(hwAccelDescr hwAccelCtx) const ubyte* pKey, sbyte4 keyLen,
                                    const ubyte* pText, sbyte4 textLen, ubyte* pResult /* SHA_HASH_RESULT_SIZE */);
 
+#ifndef __DISABLE_MOCANA_SHA256__
+struct SW_SHA256_CTX;
+
+/* HMAC-SHA256 from precomputed midstates: HMAC_SHA256_prefixes() absorbs
+   (K ^ ipad) and (K ^ opad) once, HMAC_SHA256_multi() then MACs any number
+   of texts from them; pResults[i] receives SHA256_RESULT_SIZE bytes */
+
+MOC_EXTERN MSTATUS HMAC_SHA256_prefixes(MOC_HASH(hwAccelDescr hwAccelCtx) const ubyte* key, sbyte4 keyLen,
+                                        struct SW_SHA256_CTX *pInner, struct SW_SHA256_CTX *pOuter);
+
+MOC_EXTERN MSTATUS HMAC_SHA256_multi(MOC_HASH(hwAccelDescr hwAccelCtx) const struct SW_SHA256_CTX *pInner,
+                                     const struct SW_SHA256_CTX *pOuter, sbyte4 numTexts,
+                                     const ubyte *pTexts[], const ubyte4 textLens[], ubyte *pResults[]);
+#endif /* __DISABLE_MOCANA_SHA256__ */
+
 
 /*------------------------------------------------------------------*/
 
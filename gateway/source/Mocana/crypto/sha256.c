@@ -38,7 +38,7 @@
 /*------------------------------------------------------------------*/
 
 /* SHA256 constants */
-static ubyte4 K[64] = {
+static const ubyte4 K[64] = {
 0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
@@ -63,11 +63,6 @@ static ubyte4 K[64] = {
 #define BSIG0(X)                 ROTR((ROTR((ROTR(X,9))^X,11)^X),2)
 #define BSIG1(X)                 ROTR((ROTR((ROTR(X,14))^X,5)^X),6)
 
-#ifdef __ASM_386_GCC__
-#define HOST_c2l(c,l)	({ ubyte4 r=*((ubyte4 *)(c));	\
-				   asm ("bswapl %0":"=r"(r):"0"(r));	\
-				   (l)=r;			})
-#endif
 //#define BSIG0(X)                 ((ROTR(X,2)) ^ (ROTR(X,13)) ^ (ROTR(X,22)) )
 //#define BSIG1(X)                 ((ROTR(X,6)) ^ (ROTR(X,11)) ^ (ROTR(X,25)) )
 #define LSIG0(X)                 ((ROTR(X,7)) ^ (ROTR(X,18)) ^ (SHR(X,3))   )
@@ -202,62 +197,84 @@ SHA224_initDigest(MOC_HASH(hwAccelDescr hwAccelCtx) SHA224_CTX *pContext)
 #endif
 
 
+/*------------------------------------------------------------------*/
+
+/* big-endian message word: one load (plus a byte swap on little-endian
+   cores) when the block is word aligned, byte assembly otherwise */
+#if defined(MOC_BIG_ENDIAN)
+#define SHA256_WORD_SWAP(X)     (X)
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SHA256_WORD_SWAP(X)     __builtin_bswap32(X)
+#elif defined(__ICCRX__) && defined(__LITTLE_ENDIAN__) && (__LITTLE_ENDIAN__)
+#include <intrinsics.h>
+#define SHA256_WORD_SWAP(X)     __REVL(X)
+#elif defined(__ICCARM__) && defined(__LITTLE_ENDIAN__) && (__LITTLE_ENDIAN__)
+#include <intrinsics.h>
+#define SHA256_WORD_SWAP(X)     __REV(X)
+#endif
+
+#define SHA256_BYTES_WORD(M)    (((ubyte4)((M)[0]) << 24) | ((ubyte4)((M)[1]) << 16) | \
+                                 ((ubyte4)((M)[2]) <<  8) |  (ubyte4)((M)[3]))
+
+#ifdef SHA256_WORD_SWAP
+#define SHA256_GET_WORD(M,i)    ((isAligned) ? SHA256_WORD_SWAP(((const ubyte4 *)(M))[i]) : \
+                                               SHA256_BYTES_WORD((M) + 4 * (i)))
+#else
+#define SHA256_GET_WORD(M,i)    SHA256_BYTES_WORD((M) + 4 * (i))
+#endif
+
+/* the schedule only ever looks 16 words back: keep it in a ring */
+#define SHA256_SCHEDULE(W,t)    (W[(t) & 15] += LSIG1(W[((t) - 2) & 15]) + W[((t) - 7) & 15] + \
+                                                LSIG0(W[((t) - 15) & 15]))
+
+/* one round, with the working variables renamed by the caller instead of
+   shifted: only d and h are written */
+#define SHA256_ROUND(a,b,c,d,e,f,g,h,Wt,t)                  \
+    T1 = h + BSIG1(e) + CH(e,f,g) + K[t] + (Wt);            \
+    d += T1;                                                \
+    h  = T1 + BSIG0(a) + MAJ(a,b,c)
+
+#ifndef __DISABLE_MOCANA_SHA256_UNROLL__
+
+#define SHA256_ROUND_LOAD(a,b,c,d,e,f,g,h,t)                \
+    W[t] = SHA256_GET_WORD(M, t);                           \
+    SHA256_ROUND(a,b,c,d,e,f,g,h,W[t],t)
+
+#define SHA256_ROUND_SCHED(a,b,c,d,e,f,g,h,t)               \
+    SHA256_ROUND(a,b,c,d,e,f,g,h,SHA256_SCHEDULE(W,t),t)
+
+#define SHA256_ROUNDS8(R,t)                                 \
+    R(a,b,c,d,e,f,g,h,(t) + 0);                             \
+    R(h,a,b,c,d,e,f,g,(t) + 1);                             \
+    R(g,h,a,b,c,d,e,f,(t) + 2);                             \
+    R(f,g,h,a,b,c,d,e,(t) + 3);                             \
+    R(e,f,g,h,a,b,c,d,(t) + 4);                             \
+    R(d,e,f,g,h,a,b,c,(t) + 5);                             \
+    R(c,d,e,f,g,h,a,b,(t) + 6);                             \
+    R(b,c,d,e,f,g,h,a,(t) + 7)
+
+#endif /* __DISABLE_MOCANA_SHA256_UNROLL__ */
+
+
 /*------------------------------------------------------------------*/
 
 static void
-sha256_transform(SHA256_CTX *pContext, const ubyte M[SHA256_BLOCK_SIZE])
+sha256_transform(SHA256_CTX *pContext, const ubyte *M, ubyte4 numBlocks)
 {
 #ifdef __ENABLE_MOCANA_MINIMUM_STACK__
     ubyte4 *W = pContext->W;
 #else
-    ubyte4 W[64];
+    ubyte4 W[16];
 #endif
-    sbyte4 t;
-    ubyte4 a,b,c,d,e,f,g,h;
-    ubyte4 T1,T2;
-
-    /* message schedule */
-    for (t = 0; t < 16; t+=4)
-    {
-#ifdef __ASM_386_GCC__
-		HOST_c2l((M),W[t]);
-		M+=4;
-		HOST_c2l((M),W[t+1]);
-		M+=4;
-		HOST_c2l((M),W[t+2]);
-		M+=4;
-		HOST_c2l((M),W[t+3]);
-		M+=4;
-#else
-        W[t]  = ((ubyte4)(*M++) << 24);
-        W[t] |= ((ubyte4)(*M++) << 16);
-        W[t] |= ((ubyte4)(*M++) << 8);
-        W[t] |=  (ubyte4)(*M++);
-
-		W[t+1]  = ((ubyte4)(*M++) << 24);
-        W[t+1] |= ((ubyte4)(*M++) << 16);
-        W[t+1] |= ((ubyte4)(*M++) << 8);
-        W[t+1] |=  (ubyte4)(*M++);
-
-		W[t+2]  = ((ubyte4)(*M++) << 24);
-        W[t+2] |= ((ubyte4)(*M++) << 16);
-        W[t+2] |= ((ubyte4)(*M++) << 8);
-        W[t+2] |=  (ubyte4)(*M++);
-
-		W[t+3]  = ((ubyte4)(*M++) << 24);
-        W[t+3] |= ((ubyte4)(*M++) << 16);
-        W[t+3] |= ((ubyte4)(*M++) << 8);
-        W[t+3] |=  (ubyte4)(*M++);
+#ifdef SHA256_WORD_SWAP
+    intBoolean isAligned = (0 == (((usize)M) & 3)) ? TRUE : FALSE;
 #endif
-#ifdef VERBOSE
-        printf("%08x ", W[t]);
+    ubyte4 a,b,c,d,e,f,g,h;
+    ubyte4 T1;
+#ifdef __DISABLE_MOCANA_SHA256_UNROLL__
+    ubyte4 T2;
+    sbyte4 t;
 #endif
-    }
-
-    for (; t < 64; ++t)
-    {
-        W[t] = LSIG1( W[t-2]) + W[t-7] + LSIG0( W[t-15]) + W[t-16];
-    }
 
     a = pContext->hashBlocks[0];
     b = pContext->hashBlocks[1];
@@ -268,32 +285,47 @@ sha256_transform(SHA256_CTX *pContext, const ubyte M[SHA256_BLOCK_SIZE])
     g = pContext->hashBlocks[6];
     h = pContext->hashBlocks[7];
 
-    for (t = 0; t < 64; ++t)
+    for (; numBlocks > 0; numBlocks--, M += SHA256_BLOCK_SIZE)
     {
-        T1 = h + BSIG1(e) + CH(e,f,g) + K[t] + W[t];
-        T2 = BSIG0(a) + MAJ(a,b,c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + T1;
-        d = c;
-        c = b;
-        b = a;
-        a = T1 + T2;
-#ifdef VERBOSE
-        printf("\n%d %08x %08x %08x %08x %08x %08x %08x %08x",
-            t, a,b,c,d,e,f,g,h);
+#ifndef __DISABLE_MOCANA_SHA256_UNROLL__
+        SHA256_ROUNDS8(SHA256_ROUND_LOAD,   0);
+        SHA256_ROUNDS8(SHA256_ROUND_LOAD,   8);
+        SHA256_ROUNDS8(SHA256_ROUND_SCHED, 16);
+        SHA256_ROUNDS8(SHA256_ROUND_SCHED, 24);
+        SHA256_ROUNDS8(SHA256_ROUND_SCHED, 32);
+        SHA256_ROUNDS8(SHA256_ROUND_SCHED, 40);
+        SHA256_ROUNDS8(SHA256_ROUND_SCHED, 48);
+        SHA256_ROUNDS8(SHA256_ROUND_SCHED, 56);
+#else
+        for (t = 0; t < 64; ++t)
+        {
+            if (16 > t)
+                W[t] = SHA256_GET_WORD(M, t);
+            else
+                SHA256_SCHEDULE(W, t);
+
+            T1 = h + BSIG1(e) + CH(e,f,g) + K[t] + W[t & 15];
+            T2 = BSIG0(a) + MAJ(a,b,c);
+            h = g;
+            g = f;
+            f = e;
+            e = d + T1;
+            d = c;
+            c = b;
+            b = a;
+            a = T1 + T2;
+        }
 #endif
-    }
 
-    pContext->hashBlocks[0] += a;
-    pContext->hashBlocks[1] += b;
-    pContext->hashBlocks[2] += c;
-    pContext->hashBlocks[3] += d;
-    pContext->hashBlocks[4] += e;
-    pContext->hashBlocks[5] += f;
-    pContext->hashBlocks[6] += g;
-    pContext->hashBlocks[7] += h;
+        a = (pContext->hashBlocks[0] += a);
+        b = (pContext->hashBlocks[1] += b);
+        c = (pContext->hashBlocks[2] += c);
+        d = (pContext->hashBlocks[3] += d);
+        e = (pContext->hashBlocks[4] += e);
+        f = (pContext->hashBlocks[5] += f);
+        g = (pContext->hashBlocks[6] += g);
+        h = (pContext->hashBlocks[7] += h);
+    }
 
 #ifdef VERBOSE
     printf("\n%08x %08x %08x %08x %08x %08x %08x %08x\n",
@@ -347,18 +379,20 @@ SHA256_updateDigest(MOC_HASH(hwAccelDescr hwAccelCtx) SHA256_CTX *pContext,
         pContext->hashBufferIndex += numToCopy;
         if (SHA256_BLOCK_SIZE == pContext->hashBufferIndex)
         {
-            sha256_transform( pContext, pContext->hashBuffer);
+            sha256_transform( pContext, pContext->hashBuffer, 1);
             pContext->hashBufferIndex = 0;
         }
     }
 
-    /* process as much as possible right now */
-    while ( SHA256_BLOCK_SIZE <= dataLen)
+    /* process all whole blocks straight from the caller's buffer */
+    if ( SHA256_BLOCK_SIZE <= dataLen)
     {
-        sha256_transform( pContext, pData);
+        ubyte4 numBlocks = dataLen / SHA256_BLOCK_SIZE;
+
+        sha256_transform( pContext, pData, numBlocks);
 
-        dataLen -= SHA256_BLOCK_SIZE;
-        pData += SHA256_BLOCK_SIZE;
+        dataLen -= numBlocks * SHA256_BLOCK_SIZE;
+        pData += numBlocks * SHA256_BLOCK_SIZE;
     }
 
     /* store the rest in the buffer */
@@ -398,7 +432,7 @@ SHA256_finalDigestAux(MOC_HASH(hwAccelDescr hwAccelCtx) SHA256_CTX *pContext,
         {
             pContext->hashBuffer[pContext->hashBufferIndex++] = 0x00;
         }
-        sha256_transform( pContext, pContext->hashBuffer);
+        sha256_transform( pContext, pContext->hashBuffer, 1);
         pContext->hashBufferIndex = 0;
     }
 
@@ -414,7 +448,7 @@ SHA256_finalDigestAux(MOC_HASH(hwAccelDescr hwAccelCtx) SHA256_CTX *pContext,
     BIGEND32(pContext->hashBuffer+SHA256_BLOCK_SIZE-8, HI_U8(pContext->mesgLength));
     BIGEND32(pContext->hashBuffer+SHA256_BLOCK_SIZE-4, LOW_U8(pContext->mesgLength));
 
-    sha256_transform( pContext, pContext->hashBuffer);
+    sha256_transform( pContext, pContext->hashBuffer, 1);
 
     /* return the output */
     for (i = 0; i < outputSize/4; ++i)
@@ -518,6 +552,53 @@ exit:
 
 #endif /* __SHA256_ONE_STEP_HARDWARE_HASH__ */
 
+
+/*------------------------------------------------------------------*/
+
+#ifndef __DISABLE_MOCANA_SHA256__
+
+extern MSTATUS
+SHA256_completeDigestMulti(MOC_HASH(hwAccelDescr hwAccelCtx) const SHA256_CTX *pPrefix,
+                           sbyte4 numMsgs, const ubyte *pMsgs[], const ubyte4 msgLens[],
+                           ubyte *pOutputs[])
+{
+    SHA256_CTX context;
+    sbyte4   i;
+    MSTATUS  status = OK;
+
+#if( defined(__ENABLE_MOCANA_FIPS_MODULE__) )
+   if (OK != getFIPS_powerupStatus(FIPS_ALGO_SHA256))
+        return getFIPS_powerupStatus(FIPS_ALGO_SHA256);
+#endif /* ( defined(__ENABLE_MOCANA_FIPS_MODULE__) ) */
+
+    if ((NULL == pMsgs) || (NULL == msgLens) || (NULL == pOutputs))
+    {
+        status = ERR_NULL_POINTER;
+        goto exit;
+    }
+
+    for (i = 0; i < numMsgs; i++)
+    {
+        /* every message resumes from the same midstate, e.g. an HMAC
+           (K ^ ipad) block or a PRF secret that was hashed only once */
+        if (NULL != pPrefix)
+            MOC_MEMCPY((ubyte *)&context, (const ubyte *)pPrefix, sizeof(SHA256_CTX));
+        else if (OK > (status = SHA256_initDigest(MOC_HASH(hwAccelCtx) &context)))
+            goto exit;
+
+        if (OK > (status = SHA256_updateDigest(MOC_HASH(hwAccelCtx) &context, pMsgs[i], msgLens[i])))
+            goto exit;
+
+        if (OK > (status = SHA256_finalDigest(MOC_HASH(hwAccelCtx) &context, pOutputs[i])))
+            goto exit;
+    }
+
+exit:
+    return status;
+}
+
+#endif /* __DISABLE_MOCANA_SHA256__ */
+
 /*------------------------------------------------------------------*/
 
 #if !defined (__SHA224_ONE_STEP_HARDWARE_HASH__) && !defined(__DISABLE_MOCANA_SHA224__)
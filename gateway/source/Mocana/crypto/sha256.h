@@ -29,6 +29,7 @@ This file contains the following public ($extern$) functions:
 - SHA224_updateDigest
 - SHA256_allocDigest
 - SHA256_completeDigest
+- SHA256_completeDigestMulti
 - SHA256_finalDigest
 - SHA256_freeDigest
 - SHA256_initDigest
@@ -92,6 +93,14 @@ MOC_EXTERN MSTATUS SHA256_finalDigest   (MOC_HASH(hwAccelDescr hwAccelCtx) sha25
 /* all at once hash */
 
 MOC_EXTERN MSTATUS SHA256_completeDigest(MOC_HASH(hwAccelDescr hwAccelCtx) const ubyte *pData, ubyte4 dataLen, ubyte *pShaOutput);
+
+/* several independent messages in one call, each hashed from pPrefix
+   (a context that already absorbed a shared prefix) or from scratch
+   when pPrefix is NULL; pOutputs[i] receives SHA256_RESULT_SIZE bytes */
+
+MOC_EXTERN MSTATUS SHA256_completeDigestMulti(MOC_HASH(hwAccelDescr hwAccelCtx) const SHA256_CTX *pPrefix,
+                                              sbyte4 numMsgs, const ubyte *pMsgs[], const ubyte4 msgLens[],
+                                              ubyte *pOutputs[]);
 #endif /* __DISABLE_MOCANA_SHA256__ */
 
 #ifdef __SHA256_HARDWARE_HASH__
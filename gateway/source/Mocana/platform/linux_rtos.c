@@ -0,0 +1,383 @@
+/*
+ * linux_rtos.c
+ *
+ * Linux (POSIX user space) RTOS Abstraction Layer
+ *
+ * Only used for host builds of the crypto and protocol modules (see bench/);
+ * the target uses ucos_rtos.c.
+ *
+ * Copyright Mocana Corp 2009. All Rights Reserved.
+ * Proprietary and Confidential Material.
+ *
+ */
+
+#include "../common/moptions.h"
+
+#if (defined(__LINUX_RTOS__) && !defined(__KERNEL__))
+
+#include "../common/mdefs.h"
+#include "../common/mtypes.h"
+#include "../common/merrors.h"
+#include "../common/mrtos.h"
+#include "../common/mstdlib.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/*------------------------------------------------------------------*/
+
+static void
+LINUX_now(moctime_t* pTime)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    pTime->u.time[0] = (ubyte4)ts.tv_sec;
+    pTime->u.time[1] = (ubyte4)(ts.tv_nsec / 1000);         /* usec */
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_rtosInit(void)
+{
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_rtosShutdown(void)
+{
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+static MSTATUS
+LINUX_mutexCreateAttr(RTOS_MUTEX* pMutex, int mutexKind)
+{
+    pthread_mutex_t*    pPosixMutex;
+    pthread_mutexattr_t attr;
+    MSTATUS             status = ERR_RTOS_MUTEX_CREATE;
+
+    if (NULL == (pPosixMutex = malloc(sizeof(pthread_mutex_t))))
+        goto exit;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, mutexKind);
+
+    if (0 != pthread_mutex_init(pPosixMutex, &attr))
+    {
+        free(pPosixMutex);
+        goto exit;
+    }
+
+    *pMutex = (RTOS_MUTEX)pPosixMutex;
+    status = OK;
+
+exit:
+    pthread_mutexattr_destroy(&attr);
+    return (status);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_mutexCreate(RTOS_MUTEX* pMutex, enum mutexTypes mutexType, int mutexCount)
+{
+    MOC_UNUSED(mutexType);
+    MOC_UNUSED(mutexCount);
+
+    return LINUX_mutexCreateAttr(pMutex, PTHREAD_MUTEX_NORMAL);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_mutexWait(RTOS_MUTEX mutex)
+{
+    if ((NULL == mutex) || (0 != pthread_mutex_lock((pthread_mutex_t *)mutex)))
+        return (ERR_RTOS_MUTEX_WAIT);
+
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_mutexRelease(RTOS_MUTEX mutex)
+{
+    if ((NULL == mutex) || (0 != pthread_mutex_unlock((pthread_mutex_t *)mutex)))
+        return (ERR_RTOS_MUTEX_RELEASE);
+
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_mutexFree(RTOS_MUTEX* pMutex)
+{
+    if ((NULL == pMutex) || (NULL == *pMutex))
+        return (ERR_RTOS_MUTEX_FREE);
+
+    pthread_mutex_destroy((pthread_mutex_t *)(*pMutex));
+    free(*pMutex);
+    *pMutex = NULL;
+
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_recursiveMutexCreate(RTOS_MUTEX* pMutex, enum mutexTypes mutexType, int mutexCount)
+{
+    MOC_UNUSED(mutexType);
+    MOC_UNUSED(mutexCount);
+
+    return LINUX_mutexCreateAttr(pMutex, PTHREAD_MUTEX_RECURSIVE);
+}
+
+extern MSTATUS LINUX_recursiveMutexWait(RTOS_MUTEX mutex)     { return LINUX_mutexWait(mutex); }
+extern MSTATUS LINUX_recursiveMutexRelease(RTOS_MUTEX mutex)  { return LINUX_mutexRelease(mutex); }
+extern MSTATUS LINUX_recursiveMutexFree(RTOS_MUTEX* pMutex)   { return LINUX_mutexFree(pMutex); }
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_condCreate(RTOS_COND* pCond, enum mutexTypes mutexType, int mutexCount)
+{
+    pthread_cond_t* pPosixCond;
+    MOC_UNUSED(mutexType);
+    MOC_UNUSED(mutexCount);
+
+    if (NULL == (pPosixCond = malloc(sizeof(pthread_cond_t))))
+        return (ERR_RTOS_MUTEX_CREATE);
+
+    if (0 != pthread_cond_init(pPosixCond, NULL))
+    {
+        free(pPosixCond);
+        return (ERR_RTOS_MUTEX_CREATE);
+    }
+
+    *pCond = (RTOS_COND)pPosixCond;
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_condWait(RTOS_COND cond, RTOS_MUTEX mutex)
+{
+    if (0 != pthread_cond_wait((pthread_cond_t *)cond, (pthread_mutex_t *)mutex))
+        return (ERR_RTOS_MUTEX_WAIT);
+
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_condSignal(RTOS_COND cond)
+{
+    if (0 != pthread_cond_signal((pthread_cond_t *)cond))
+        return (ERR_RTOS_MUTEX_RELEASE);
+
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_condFree(RTOS_MUTEX* pCond)
+{
+    if ((NULL == pCond) || (NULL == *pCond))
+        return (ERR_RTOS_MUTEX_FREE);
+
+    pthread_cond_destroy((pthread_cond_t *)(*pCond));
+    free(*pCond);
+    *pCond = NULL;
+
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern ubyte4
+LINUX_getUpTimeInMS(void)
+{
+    moctime_t now;
+
+    LINUX_now(&now);
+
+    return (now.u.time[0] * 1000) + (now.u.time[1] / 1000);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern ubyte4
+LINUX_deltaConstMS(const moctime_t* origin, const moctime_t* current)
+{
+    ubyte4 retVal;
+
+    retVal  = (current->u.time[0] - origin->u.time[0]) * 1000;
+    retVal += (ubyte4)(((sbyte4)current->u.time[1] - (sbyte4)origin->u.time[1]) / 1000);
+
+    return (retVal);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern ubyte4
+LINUX_deltaMS(const moctime_t* origin, moctime_t* current)
+{
+    moctime_t   now;
+    ubyte4      retVal = 0;
+
+    LINUX_now(&now);
+
+    if (origin)
+        retVal = LINUX_deltaConstMS(origin, &now);
+
+    if (current)
+        *current = now;
+
+    return (retVal);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern moctime_t*
+LINUX_timerAddMS(moctime_t* pTimer, ubyte4 addNumMS)
+{
+    ubyte4 usec = pTimer->u.time[1] + ((addNumMS % 1000) * 1000);
+
+    pTimer->u.time[0] += (addNumMS / 1000) + (usec / 1000000);
+    pTimer->u.time[1]  = usec % 1000000;
+
+    return (pTimer);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern sbyte4
+LINUX_timeCompare(const moctime_t* pTime1, const moctime_t* pTime2)
+{
+    if (pTime1->u.time[0] != pTime2->u.time[0])
+        return (pTime1->u.time[0] < pTime2->u.time[0]) ? -1 : 1;
+
+    if (pTime1->u.time[1] != pTime2->u.time[1])
+        return (pTime1->u.time[1] < pTime2->u.time[1]) ? -1 : 1;
+
+    return (0);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern void
+LINUX_sleepMS(ubyte4 sleepTimeInMS)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = sleepTimeInMS / 1000;
+    ts.tv_nsec = (long)(sleepTimeInMS % 1000) * 1000000L;
+
+    while (0 != nanosleep(&ts, &ts))
+        ;
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_createThread(void (*threadEntry)(void*), void* context, ubyte4 threadType, RTOS_THREAD *pRetTid)
+{
+    pthread_t*  pTid;
+    MOC_UNUSED(threadType);
+
+    if (NULL == (pTid = malloc(sizeof(pthread_t))))
+        return (ERR_RTOS_THREAD_CREATE);
+
+    if (0 != pthread_create(pTid, NULL, (void *(*)(void *))threadEntry, context))
+    {
+        free(pTid);
+        return (ERR_RTOS_THREAD_CREATE);
+    }
+
+    *pRetTid = (RTOS_THREAD)pTid;
+    return (OK);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern void
+LINUX_destroyThread(RTOS_THREAD tid)
+{
+    if (NULL != tid)
+    {
+        pthread_detach(*(pthread_t *)tid);
+        free(tid);
+    }
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern RTOS_THREAD
+LINUX_currentThreadId(void)
+{
+    return (RTOS_THREAD)(usize)pthread_self();
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+LINUX_timeGMT(TimeDate* td)
+{
+    time_t      now;
+    struct tm   utc;
+
+    if (NULL == td)
+        return (ERR_NULL_POINTER);
+
+    now = time(NULL);
+    if (NULL == gmtime_r(&now, &utc))
+        return (ERR_RTOS_GMT_TIME_NOT_AVAILABLE);
+
+    td->m_year   = (ubyte2)(utc.tm_year + 1900 - 1970);
+    td->m_month  = (ubyte)(utc.tm_mon + 1);
+    td->m_day    = (ubyte)utc.tm_mday;
+    td->m_hour   = (ubyte)utc.tm_hour;
+    td->m_minute = (ubyte)utc.tm_min;
+    td->m_second = (ubyte)utc.tm_sec;
+
+    return (OK);
+}
+
+#endif /* __LINUX_RTOS__ && !__KERNEL__ */
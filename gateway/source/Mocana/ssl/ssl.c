@@ -29,6 +29,7 @@ Whether the following flags are defined determines which functions are enabled:
 - $__ENABLE_MOCANA_SSL_ALERTS__$
 - $__ENABLE_MOCANA_SSL_ASYNC_CLIENT_API__$
 - $__ENABLE_MOCANA_SSL_ASYNC_SERVER_API__$
+- $__ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__$
 - $__ENABLE_MOCANA_SSL_CIPHER_SUITES_SELECT__$
 - $__ENABLE_MOCANA_SSL_CLIENT__$
 - $__ENABLE_MOCANA_SSL_INTERNAL_STRUCT_ACCESS__$
@@ -39,6 +40,7 @@ Whether the following flags are defined determines which functions are enabled:
 ! External Functions
 This file contains the following public ($extern$) functions:
 - SSL_acceptConnection
+- SSL_addTrustAnchor
 - SSL_assignCertificateStore
 - SSL_ASYNC_acceptConnection
 - SSL_ASYNC_closeConnection
@@ -52,6 +54,7 @@ This file contains the following public ($extern$) functions:
 - SSL_ASYNC_sendMessage
 - SSL_ASYNC_sendMessagePending
 - SSL_ASYNC_start
+- SSL_clearCertVerifyCache
 - SSL_closeConnection
 - SSL_connect
 - SSL_enableCiphers
@@ -134,6 +137,12 @@ This file contains the following public ($extern$) functions:
 #if (defined(__ENABLE_TLSEXT_RFC6066__) && defined(__ENABLE_MOCANA_OCSP_CLIENT__))
 #include "../ssl/ssl_ocsp.h"
 #endif
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+#include "../common/absstream.h"
+#include "../common/tree.h"
+#include "../asn1/parseasn1.h"
+#include "../ssl/ssl_certcache.h"
+#endif
 
 #if (defined(__DEBUG_SSL_TIMER__) || defined(__ENABLE_ALL_DEBUGGING__))
 #include <stdio.h>
@@ -909,6 +918,36 @@ doProtocol(SSLSocket *pSSLSock, sbyte4 index, intBoolean useTimeout,
         }
         else
         {
+#if defined(__ENABLE_MOCANA_SSL_ZERO_COPY__)
+            ubyte*  pRecordBody = NULL;
+            ubyte4  recordBodyLen = 0;
+
+            /* read the rest of a partially received record straight into the
+             * record buffer, rather than staging it through pReadBuffer */
+            if ((0 == m_sslConnectTable[index].numBytesRead) &&
+                (OK <= SSL_SOCK_getPendingRecordBody(pSSLSock, &pRecordBody, &recordBodyLen)) &&
+                (0 < recordBodyLen))
+            {
+#ifndef __MOCANA_IPSTACK__
+                if (OK > (status = TCP_READ_AVL(pSSLSock->tcpSock,
+                                                (sbyte *)pRecordBody,
+                                                recordBodyLen,
+                                                &m_sslConnectTable[index].numBytesRead,
+                                                adjustedTimeout)))
+#else
+                if (OK > (status = MOC_TCP_READ_AVL(pSSLSock->tcpSock,
+                                                (sbyte *)pRecordBody,
+                                                recordBodyLen,
+                                                &m_sslConnectTable[index].numBytesRead,
+                                                adjustedTimeout)))
+#endif
+                {
+                    goto exit;
+                }
+
+                m_sslConnectTable[index].pReadBufferPosition = pRecordBody;
+            }
+#endif
             if (0 == m_sslConnectTable[index].numBytesRead)
             {
 #ifndef __MOCANA_IPSTACK__
@@ -1152,6 +1191,10 @@ SSL_shutdown(void)
 
     RTOS_mutexFree( &m_sslConnectTableMutex);
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    SSL_CERTCACHE_uninit();
+#endif
+
 #if defined(__ENABLE_MOCANA_SSL_SERVER__)
     CRYPTO_uninitAsymmetricKey(m_pPrivateKey, NULL);
     while (m_numCerts > 0)
@@ -1706,6 +1749,11 @@ SSL_initAux(sbyte4 numServerConnections, sbyte4 numClientConnections, Asymmetric
     if (OK > (status = RTOS_mutexCreate(&m_sslConnectTableMutex, SSL_CACHE_MUTEX, 1)))
         goto exit;
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    if (OK > (status = SSL_CERTCACHE_init()))
+        goto exit;
+#endif
+
     if (NULL == m_sslConnectTable)
     {
         ubyte4 remain;
@@ -1966,6 +2014,163 @@ exit:
 #endif
 
 
+/*------------------------------------------------------------------*/
+
+#if (defined(__ENABLE_MOCANA_SSL_ZERO_COPY__) && \
+    (defined(__ENABLE_MOCANA_SSL_DUAL_MODE_API__) || \
+    ((defined(__ENABLE_MOCANA_SSL_SERVER__)) && (!defined(__ENABLE_MOCANA_SSL_ASYNC_SERVER_API__))) || \
+    ((defined(__ENABLE_MOCANA_SSL_CLIENT__)) && (!defined(__ENABLE_MOCANA_SSL_ASYNC_CLIENT_API__)))))
+/* Get the space an in place record needs around its payload.
+This function returns the number of bytes an application data record adds
+before ($pRetHeaderLen$) and, at most, after ($pRetTrailerLen$) its payload for
+the connection's active cipher suite, and the largest payload a single record
+may carry ($pRetMaxDataLen$). A buffer laid out this way can be passed to
+SSL_sendInPlace.
+
+\since 5.5
+\version 5.5 and later
+
+! Flags
+To enable this function, the following flag must be defined in moptions.h:
+- $__ENABLE_MOCANA_SSL_ZERO_COPY__$
+
+#Include %file:#&nbsp;&nbsp;ssl.h
+
+\param connectionInstance   Connection instance returned from SSL_connect.
+\param pRetHeaderLen        On return, number of bytes preceding the payload.
+\param pRetTrailerLen       On return, maximum number of bytes following the payload.
+\param pRetMaxDataLen       On return, maximum payload of one record; bounded by
+                            a negotiated max_fragment_length, if any.
+
+\return $OK$ (0) if successful; $ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE$ if the
+connection's records cannot be formed in place (use SSL_send); otherwise a
+negative number error code definition from merrors.h.
+
+\remark This function is applicable to synchronous clients and servers.
+*/
+extern sbyte4
+SSL_getRecordOverhead(sbyte4 connectionInstance, ubyte4 *pRetHeaderLen, ubyte4 *pRetTrailerLen, ubyte4 *pRetMaxDataLen)
+{
+    sbyte4  index;
+    MSTATUS status = ERR_SSL_BAD_ID;
+
+    if ((NULL == pRetHeaderLen) || (NULL == pRetTrailerLen) || (NULL == pRetMaxDataLen))
+    {
+        status = ERR_NULL_POINTER;
+        goto exit;
+    }
+
+    if (OK > (index = getIndexFromConnectionInstance(connectionInstance)))
+        goto exit;
+
+    if ((CONNECT_OPEN != m_sslConnectTable[index].connectionState) ||
+        (IS_SSL_ASYNC(m_sslConnectTable[index].pSSLSock)))
+    {
+        status = ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE;
+        goto exit;
+    }
+
+    status = SSL_SOCK_getRecordOverhead(m_sslConnectTable[index].pSSLSock, pRetHeaderLen, pRetTrailerLen, pRetMaxDataLen);
+
+exit:
+    return (sbyte4)status;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* Encrypt an application data record in place.
+This function forms a single application data record around a payload that
+the caller has already written into its own (typically network stack) buffer,
+so that the data is neither copied into an SSL send buffer nor written to the
+socket by the SSL stack. The caller transmits the $pRetRecordLen$ bytes at
+$pRecord$ itself, in order with any other records of the connection.
+
+\since 5.5
+\version 5.5 and later
+
+! Flags
+To enable this function, the following flag must be defined in moptions.h:
+- $__ENABLE_MOCANA_SSL_ZERO_COPY__$
+
+#Include %file:#&nbsp;&nbsp;ssl.h
+
+\param connectionInstance   Connection instance returned from SSL_connect.
+\param pRecord              Pointer to the start of the record; the payload
+                            must be at $pRecord$ + header length (see
+                            SSL_getRecordOverhead), $SSL_RECORD_SCRATCH_SIZE$
+                            bytes before $pRecord$ must be writable, and the
+                            trailer length bytes after the payload must be free.
+\param dataSize             Number of payload bytes; at most the maximum
+                            payload returned by SSL_getRecordOverhead.
+\param pRetRecordLen        On return, number of bytes of the encrypted record.
+
+\return $OK$ (0) if successful; $ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE$ if the
+record cannot be formed in place right now (nothing was consumed; use
+SSL_send); otherwise a negative number error code definition from merrors.h.
+
+\remark This function is applicable to synchronous clients and servers.
+*/
+extern sbyte4
+SSL_sendInPlace(sbyte4 connectionInstance, ubyte *pRecord, ubyte4 dataSize, ubyte4 *pRetRecordLen)
+{
+    sbyte4  index;
+    MSTATUS status = ERR_SSL_BAD_ID;
+    intBoolean isThrCountUpdate = FALSE;
+
+    if ((NULL == pRecord) || (NULL == pRetRecordLen))
+    {
+        status = ERR_NULL_POINTER;
+        goto exit;
+    }
+
+    if (OK > (index = getIndexFromConnectionInstance(connectionInstance)))
+        goto exit;
+
+    if (OK > (status = updateThreadCount(TRUE, m_sslConnectTable[index].pSSLSock)))
+        goto exit;
+    isThrCountUpdate = TRUE;
+
+    if ((CONNECT_OPEN != m_sslConnectTable[index].connectionState) ||
+        (IS_SSL_ASYNC(m_sslConnectTable[index].pSSLSock)))
+    {
+        status = ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE;
+        goto exit;
+    }
+
+    status = SSL_SOCK_sendInPlace(m_sslConnectTable[index].pSSLSock, pRecord, dataSize, pRetRecordLen);
+
+#if (defined(__ENABLE_MOCANA_SSL_REHANDSHAKE__))
+    /* Rehandshake checks against bytes send */
+    if ((OK <= status) && (m_sslSettings.maxByteCountForRehandShake > 0))
+    {
+        m_sslConnectTable[index].pSSLSock->sslRehandshakeByteSendCount += dataSize;
+        if ((m_sslConnectTable[index].pSSLSock->sslRehandshakeByteSendCount > m_sslSettings.maxByteCountForRehandShake) && (m_sslSettings.funcPtrClientRehandshakeRequest != NULL))
+        {
+            status = m_sslSettings.funcPtrClientRehandshakeRequest(connectionInstance);
+            m_sslConnectTable[index].pSSLSock->sslRehandshakeByteSendCount = 0;
+            RTOS_deltaMS(NULL, &m_sslConnectTable[index].pSSLSock->sslRehandshakeTimerCount);
+        }
+    }
+#endif
+
+exit:
+    if (TRUE == isThrCountUpdate)
+    {
+        if (OK > updateThreadCount(FALSE, m_sslConnectTable[index].pSSLSock))
+            status = ERR_SSL_CONNECTION_BUSY;
+    }
+
+#ifdef __ENABLE_MOCANA_DEBUG_CONSOLE__
+    if ((OK > status) && (ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE != status))
+        DEBUG_ERROR(DEBUG_SSL_MESSAGES, (sbyte *)"SSL_sendInPlace() returns status = ", (sbyte4)status);
+#endif
+
+    return (sbyte4)status;
+}
+#endif
+
+
 /*------------------------------------------------------------------*/
 
 #if (defined(__ENABLE_MOCANA_SSL_DUAL_MODE_API__) || \
@@ -3500,6 +3705,92 @@ exit:
 }
 #endif
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+
+/*------------------------------------------------------------------*/
+
+/* Parse a trusted CA certificate ahead of the first handshake.
+This function copies and parses $pCertificate$ into the trust anchor cache, so
+that the first handshake that reaches this CA through
+sslSettings::funcPtrCertificateStoreLookup does not have to parse it. Anchors
+are otherwise added on first use.
+
+\since 5.5
+\version 5.5 and later
+
+! Flags
+To enable this function, the following flag must be defined in moptions.h:
+- $__ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__$
+
+#Include %file:#&nbsp;&nbsp;ssl.h
+
+\param pCertificate     Pointer to the DER encoded CA certificate.
+\param certLength       Number of bytes in $pCertificate$.
+
+
+\return $OK$ (0) if successful; otherwise a negative number error code
+definition from merrors.h. To retrieve a string containing an English text
+error identifier corresponding to the function's returned error status, use the
+$DISPLAY_ERROR$ macro.
+
+
+\remark This function must be called after SSL_init. At most
+$SSL_TRUST_ANCHOR_CACHE_SIZE$ anchors are kept; the least recently used one is
+replaced.
+*/
+extern sbyte4
+SSL_addTrustAnchor(const ubyte *pCertificate, ubyte4 certLength)
+{
+    sslTrustAnchor* pAnchor = NULL;
+    MSTATUS         status;
+
+    if (OK > (status = SSL_CERTCACHE_acquireTrustAnchor(pCertificate, certLength, &pAnchor)))
+        goto exit;
+
+    status = SSL_CERTCACHE_releaseTrustAnchor(&pAnchor);
+
+exit:
+    return (sbyte4)status;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* Forget every cached trust anchor and verified certificate chain.
+Server certificate chains that were verified up to a cached trust anchor are
+remembered by fingerprint; a later handshake presenting the identical chain
+skips the signature checks and the certificate store callbacks, and only
+repeats the checks on the leaf certificate. This function must be called
+whenever the application's trust store changes, so that a removed or replaced
+CA is not trusted through the cache.
+
+\since 5.5
+\version 5.5 and later
+
+! Flags
+To enable this function, the following flag must be defined in moptions.h:
+- $__ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__$
+
+#Include %file:#&nbsp;&nbsp;ssl.h
+
+
+\return $OK$ (0) if successful; otherwise a negative number error code
+definition from merrors.h. To retrieve a string containing an English text
+error identifier corresponding to the function's returned error status, use the
+$DISPLAY_ERROR$ macro.
+
+
+\remark Handshakes in progress keep the anchor they are using until they
+complete.
+*/
+extern sbyte4
+SSL_clearCertVerifyCache(void)
+{
+    return (sbyte4)SSL_CERTCACHE_clear();
+}
+
+#endif /* __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__ */
+
 /*------------------------------------------------------------------*/
 
 #if ((defined(__ENABLE_MOCANA_SSL_DUAL_MODE_API__) && defined(__ENABLE_MOCANA_SSL_CLIENT__)) || \
@@ -5621,6 +5912,78 @@ exit:
 
 /*------------------------------------------------------------------*/
 
+/* Request a smaller maximum record plaintext from the server.
+This function makes the %client offer the RFC 6066 max_fragment_length
+extension. If the server echoes it, both peers limit the plaintext of every
+record to $maxFragmentLength$ bytes, so that the receive and send buffers of a
+constrained device need not hold 16 kB records.
+
+\since 5.5
+\version 5.5 and later
+
+! Flags
+To enable this function, the following flags must be defined in moptions.h:
+- $__ENABLE_MOCANA_SSL_CLIENT__$
+- $__ENABLE_RFC3546__$
+- $__ENABLE_TLSEXT_RFC6066__$
+
+#Include %file:#&nbsp;&nbsp;ssl.h
+
+\param connectionInstance   Connection instance returned from SSL_connect.
+\param maxFragmentLength    512, 1024, 2048 or 4096; 0 to not offer the
+                            extension.
+
+\return $OK$ (0) if successful; otherwise a negative number error code
+definition from merrors.h. To retrieve a string containing an English text
+error identifier corresponding to the function's returned error status, use the
+$DISPLAY_ERROR$ macro.
+
+\remark This function must be called before SSL_negotiateConnection. A server
+that ignores the extension keeps the default record size.
+*/
+extern sbyte4
+SSL_setMaxFragmentLength(sbyte4 connectionInstance, ubyte4 maxFragmentLength)
+{
+    sbyte4  index;
+    ubyte   code;
+    MSTATUS status = ERR_SSL_BAD_ID;
+
+    if (OK > (index = getIndexFromConnectionInstance(connectionInstance)))
+        goto exit;
+
+    /* this API must be called prior to SSL_negotiateConnection() */
+    if (CONNECT_NEGOTIATE  == m_sslConnectTable[index].connectionState)
+    {
+        SSLSocket*  pSSLSock = m_sslConnectTable[index].pSSLSock;
+
+        status = ERR_SSL_CONFIG;
+
+        code = 0;
+        if (0 < maxFragmentLength)
+        {
+            for (code = SSL_MAX_FRAGMENT_LENGTH_CODE_MIN; code <= SSL_MAX_FRAGMENT_LENGTH_CODE_MAX; code++)
+            {
+                if (SSL_MAX_FRAGMENT_LENGTH(code) == maxFragmentLength)
+                    break;
+            }
+
+            if (SSL_MAX_FRAGMENT_LENGTH_CODE_MAX < code)
+                goto exit;
+        }
+
+        pSSLSock->maxFragmentLengthCode = code;
+        pSSLSock->maxFragmentLength     = 0;    /* until the server echoes it */
+
+        status = OK;
+    }
+
+exit:
+    return (sbyte4)status;
+
+} /* SSL_setMaxFragmentLength */
+
+/*------------------------------------------------------------------*/
+
 #ifdef __ENABLE_MOCANA_OCSP_CLIENT__
 
 extern sbyte4
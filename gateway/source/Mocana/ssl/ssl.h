@@ -172,6 +172,7 @@ extern "C" {
 #endif /* __UCOS_RTOS__ */
 #define SSL_MAXSESSIONIDSIZE                (32)
 #define SSL_MASTERSECRETSIZE                (48)
+#define SSL_RECORD_SCRATCH_SIZE             (8)     /* writable bytes ahead of an in place record */
 
 #define SSL_PSK_SERVER_IDENTITY_LENGTH      (128)
 #define SSL_PSK_MAX_LENGTH                  (64)
@@ -1412,6 +1413,7 @@ MOC_EXTERN sbyte4  SSL_setDNSNames( sbyte4 connectionInstance, const CNMatchInfo
 #endif
 #if defined(__ENABLE_TLSEXT_RFC6066__)
 MOC_EXTERN sbyte4 SSL_setSNI(sbyte4 connectionInstance, ServerName *pServerName, ubyte4 numOfServers);
+MOC_EXTERN sbyte4 SSL_setMaxFragmentLength(sbyte4 connectionInstance, ubyte4 maxFragmentLength);
 MOC_EXTERN sbyte4 SSL_setCertifcateStatusRequestExtensions(sbyte4 connectionInstance, sbyte** ppTrustedResponderCertPath,
                         ubyte4 trustedResponderCertCount, intBoolean shouldAddNonceExtension, extensions* pExts, ubyte4 extCount);
 
@@ -1458,6 +1460,10 @@ MOC_EXTERN sbyte4  SSL_recv(sbyte4 connectionInstance, sbyte *pRetBuffer, sbyte4
 MOC_EXTERN sbyte4  SSL_sendPending(sbyte4 connectionInstance, sbyte4 *pNumBytesPending);
 MOC_EXTERN sbyte4  SSL_recvPending(sbyte4 connectionInstance, sbyte4 *pRetBooleanIsPending);
 MOC_EXTERN sbyte4  SSL_closeConnection(sbyte4 connectionInstance);
+#if defined(__ENABLE_MOCANA_SSL_ZERO_COPY__)
+MOC_EXTERN sbyte4  SSL_getRecordOverhead(sbyte4 connectionInstance, ubyte4 *pRetHeaderLen, ubyte4 *pRetTrailerLen, ubyte4 *pRetMaxDataLen);
+MOC_EXTERN sbyte4  SSL_sendInPlace(sbyte4 connectionInstance, ubyte *pRecord, ubyte4 dataSize, ubyte4 *pRetRecordLen);
+#endif
 #endif
 #ifndef __DISABLE_MOCANA_CERTIFICATE_PARSING__
 MOC_EXTERN sbyte4
@@ -1466,6 +1472,10 @@ SSL_validateCertParam(sbyte4 connectionInstance,
                       certParamCheckConf *pCertParamCheckConf,
                       certDescriptor* pCACert, errorArray *pStatusArray);
 #endif
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+MOC_EXTERN sbyte4  SSL_addTrustAnchor(const ubyte *pCertificate, ubyte4 certLength);
+MOC_EXTERN sbyte4  SSL_clearCertVerifyCache(void);
+#endif
 
 /* common asynchronous client/server */
 #if defined(__ENABLE_MOCANA_SSL_ASYNC_SERVER_API__) || defined(__ENABLE_MOCANA_SSL_ASYNC_CLIENT_API__)
@@ -0,0 +1,570 @@
+/*
+ * ssl_certcache.c
+ *
+ * Trust anchor cache and verified certificate chain memo
+ *
+ * Copyright Mocana Corp 2003-2007. All Rights Reserved.
+ * Proprietary and Confidential Material.
+ *
+ */
+
+#include "../common/moptions.h"
+
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+
+#include "../common/mtypes.h"
+#include "../common/mocana.h"
+#include "../crypto/hw_accel.h"
+#include "../common/mdefs.h"
+#include "../common/merrors.h"
+#include "../common/mstdlib.h"
+#include "../common/mrtos.h"
+#include "../common/absstream.h"
+#include "../common/memfile.h"
+#include "../common/tree.h"
+#include "../common/random.h"
+#include "../common/vlong.h"
+#include "../crypto/sha256.h"
+#include "../crypto/rsa.h"
+#include "../crypto/primefld.h"
+#include "../crypto/primeec.h"
+#include "../crypto/pubcrypto.h"
+#include "../crypto/ca_mgmt.h"
+#include "../asn1/parseasn1.h"
+#include "../asn1/parsecert.h"
+#include "../ssl/ssl_certcache.h"
+
+
+/*------------------------------------------------------------------*/
+
+static RTOS_MUTEX       m_sslCertCacheMutex;
+static sslTrustAnchor*  m_trustAnchors[SSL_TRUST_ANCHOR_CACHE_SIZE];
+static sslVerifiedChain m_verifiedChains[SSL_VERIFIED_CHAIN_CACHE_SIZE];
+static ubyte4           m_nextAnchorId;
+static ubyte4           m_useClock;
+
+
+/*------------------------------------------------------------------*/
+
+static ubyte4
+nextUse(void)
+{
+    if (0 == ++m_useClock)
+        m_useClock = 1;
+
+    return m_useClock;
+}
+
+
+/*------------------------------------------------------------------*/
+
+static void
+freeTrustAnchor(sslTrustAnchor *pAnchor)
+{
+    if (NULL != pAnchor->pRoot)
+        TREE_DeleteTreeItem((TreeItem *)pAnchor->pRoot);
+
+    if (NULL != pAnchor->pCertificate)
+        FREE(pAnchor->pCertificate);
+
+    FREE(pAnchor);
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* detach a table entry; anchors still in use by a handshake are freed by
+ * the last SSL_CERTCACHE_releaseTrustAnchor() */
+static sslTrustAnchor *
+removeTrustAnchor(sbyte4 index)
+{
+    sslTrustAnchor* pAnchor = m_trustAnchors[index];
+
+    m_trustAnchors[index] = NULL;
+    pAnchor->anchorId = 0;
+
+    return (0 == pAnchor->refCount) ? pAnchor : NULL;
+}
+
+
+/*------------------------------------------------------------------*/
+
+static sslTrustAnchor *
+findTrustAnchor(const ubyte *pCertificate, ubyte4 certLength)
+{
+    sbyte4  i;
+    sbyte4  res;
+
+    for (i = 0; i < SSL_TRUST_ANCHOR_CACHE_SIZE; i++)
+    {
+        if ((NULL == m_trustAnchors[i]) || (certLength != m_trustAnchors[i]->certLength))
+            continue;
+
+        MOC_MEMCMP(m_trustAnchors[i]->pCertificate, pCertificate, certLength, &res);
+
+        if (0 == res)
+            return m_trustAnchors[i];
+    }
+
+    return NULL;
+}
+
+
+/*------------------------------------------------------------------*/
+
+static sbyte4
+compareTimeDate(const TimeDate *pTime1, const TimeDate *pTime2)
+{
+    sbyte4 res;
+
+    /* same ordering as CERT_VerifyValidityTime() */
+    if (pTime1->m_year == pTime2->m_year)
+        MOC_MEMCMP((ubyte *)pTime1 + 2, (ubyte *)pTime2 + 2, sizeof(TimeDate) - 2, &res);
+    else
+        res = (sbyte4)pTime1->m_year - (sbyte4)pTime2->m_year;
+
+    return res;
+}
+
+
+/*------------------------------------------------------------------*/
+
+static intBoolean
+isWithinValidity(const sslVerifiedChain *pChain, intBoolean chkBefore, intBoolean chkAfter)
+{
+#if (((!defined __MOCANA_DISABLE_CERT_TIME_VERIFY__) && (!defined(__MOCANA_DISABLE_CERT_STOP_TIME_VERIFY__))) || \
+     ((!defined __MOCANA_DISABLE_CERT_TIME_VERIFY__) && (!defined(__MOCANA_DISABLE_CERT_START_TIME_VERIFY__))))
+    TimeDate currTime;
+
+    if ((FALSE == chkBefore) && (FALSE == chkAfter))
+        return TRUE;
+
+    if (OK > RTOS_timeGMT(&currTime))
+        return FALSE;
+
+#if ((!defined __MOCANA_DISABLE_CERT_TIME_VERIFY__) && (!defined(__MOCANA_DISABLE_CERT_STOP_TIME_VERIFY__)))
+    if ((chkAfter) && (0 >= compareTimeDate(&pChain->notAfter, &currTime)))
+        return FALSE;
+#endif
+
+#if ((!defined __MOCANA_DISABLE_CERT_TIME_VERIFY__) && (!defined(__MOCANA_DISABLE_CERT_START_TIME_VERIFY__)))
+    if ((chkBefore) && (0 <= compareTimeDate(&pChain->notBefore, &currTime)))
+        return FALSE;
+#endif
+
+#else
+    MOC_UNUSED(pChain);
+    MOC_UNUSED(chkBefore);
+    MOC_UNUSED(chkAfter);
+#endif
+
+    return TRUE;
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+SSL_CERTCACHE_init(void)
+{
+    MOC_MEMSET((ubyte *)m_trustAnchors, 0x00, sizeof(m_trustAnchors));
+    MOC_MEMSET((ubyte *)m_verifiedChains, 0x00, sizeof(m_verifiedChains));
+
+    return RTOS_mutexCreate(&m_sslCertCacheMutex, SSL_CACHE_MUTEX, 2);
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+SSL_CERTCACHE_uninit(void)
+{
+    MSTATUS status;
+
+    if (OK > (status = SSL_CERTCACHE_clear()))
+        return status;
+
+    return RTOS_mutexFree(&m_sslCertCacheMutex);
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* drop every cached anchor and every remembered chain; called whenever the
+ * application's trust store changes */
+extern MSTATUS
+SSL_CERTCACHE_clear(void)
+{
+    sslTrustAnchor* pFree[SSL_TRUST_ANCHOR_CACHE_SIZE];
+    sbyte4          i;
+    MSTATUS         status;
+
+    if (OK > (status = RTOS_mutexWait(m_sslCertCacheMutex)))
+        return status;
+
+    for (i = 0; i < SSL_TRUST_ANCHOR_CACHE_SIZE; i++)
+        pFree[i] = (NULL != m_trustAnchors[i]) ? removeTrustAnchor(i) : NULL;
+
+    MOC_MEMSET((ubyte *)m_verifiedChains, 0x00, sizeof(m_verifiedChains));
+
+    RTOS_mutexRelease(m_sslCertCacheMutex);
+
+    for (i = 0; i < SSL_TRUST_ANCHOR_CACHE_SIZE; i++)
+        if (NULL != pFree[i])
+            freeTrustAnchor(pFree[i]);
+
+    return OK;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* returns a parsed copy of the certificate; the tree is shared and must be
+ * treated as read-only. When the cache is full of anchors in use the copy is
+ * private and freed on release. */
+extern MSTATUS
+SSL_CERTCACHE_acquireTrustAnchor(const ubyte *pCertificate, ubyte4 certLength,
+                                 sslTrustAnchor **ppRetAnchor)
+{
+    sslTrustAnchor* pAnchor  = NULL;
+    sslTrustAnchor* pFound;
+    sslTrustAnchor* pEvicted = NULL;
+    MemFile         certMemFile;
+    CStream         cs;
+    sbyte4          victim   = -1;
+    sbyte4          i;
+    MSTATUS         status;
+
+    if ((NULL == pCertificate) || (NULL == ppRetAnchor))
+        return ERR_NULL_POINTER;
+
+    *ppRetAnchor = NULL;
+
+    if (OK > (status = RTOS_mutexWait(m_sslCertCacheMutex)))
+        return status;
+
+    if (NULL != (pFound = findTrustAnchor(pCertificate, certLength)))
+    {
+        pFound->refCount++;
+        pFound->lastUsed = nextUse();
+    }
+
+    RTOS_mutexRelease(m_sslCertCacheMutex);
+
+    if (NULL != pFound)
+    {
+        *ppRetAnchor = pFound;
+        goto exit;
+    }
+
+    /* parse outside the lock */
+    if (NULL == (pAnchor = MALLOC(sizeof(sslTrustAnchor))))
+    {
+        status = ERR_MEM_ALLOC_FAIL;
+        goto exit;
+    }
+
+    MOC_MEMSET((ubyte *)pAnchor, 0x00, sizeof(sslTrustAnchor));
+
+    if (NULL == (pAnchor->pCertificate = MALLOC(certLength)))
+    {
+        status = ERR_MEM_ALLOC_FAIL;
+        goto exit;
+    }
+
+    MOC_MEMCPY(pAnchor->pCertificate, pCertificate, certLength);
+    pAnchor->certLength = certLength;
+
+    MF_attach(&certMemFile, (sbyte4)certLength, pAnchor->pCertificate);
+    CS_AttachMemFile(&cs, &certMemFile);
+
+    if (OK > (status = ASN1_Parse(cs, &pAnchor->pRoot)))
+        goto exit;
+
+    if (OK <= (status = CERT_isRootCertificate(pAnchor->pRoot, cs)))
+        pAnchor->isSelfSigned = TRUE;
+    else if (ERR_FALSE != status)
+        goto exit;
+
+    if (OK > (status = SSL_CERTCACHE_getValidity(pAnchor->pRoot, cs, &pAnchor->notBefore, &pAnchor->notAfter)))
+        goto exit;
+
+    pAnchor->refCount = 1;
+
+    if (OK > (status = RTOS_mutexWait(m_sslCertCacheMutex)))
+        goto exit;
+
+    /* another handshake may have inserted the same anchor meanwhile */
+    if (NULL != (pFound = findTrustAnchor(pCertificate, certLength)))
+    {
+        pFound->refCount++;
+        pFound->lastUsed = nextUse();
+    }
+    else
+    {
+        for (i = 0; i < SSL_TRUST_ANCHOR_CACHE_SIZE; i++)
+        {
+            if (NULL == m_trustAnchors[i])
+            {
+                victim = i;
+                break;
+            }
+
+            if ((0 == m_trustAnchors[i]->refCount) &&
+                ((0 > victim) || (m_trustAnchors[i]->lastUsed < m_trustAnchors[victim]->lastUsed)))
+            {
+                victim = i;
+            }
+        }
+
+        if (0 <= victim)
+        {
+            if (NULL != m_trustAnchors[victim])
+                pEvicted = removeTrustAnchor(victim);
+
+            if (0 == ++m_nextAnchorId)
+                m_nextAnchorId = 1;
+
+            pAnchor->anchorId = m_nextAnchorId;
+            pAnchor->lastUsed = nextUse();
+            m_trustAnchors[victim] = pAnchor;
+        }
+    }
+
+    RTOS_mutexRelease(m_sslCertCacheMutex);
+
+    if (NULL != pEvicted)
+        freeTrustAnchor(pEvicted);
+
+    if (NULL != pFound)
+    {
+        *ppRetAnchor = pFound;
+        goto exit;
+    }
+
+    *ppRetAnchor = pAnchor;
+    pAnchor = NULL;
+
+exit:
+    if (NULL != pAnchor)
+        freeTrustAnchor(pAnchor);
+
+    return status;
+
+} /* SSL_CERTCACHE_acquireTrustAnchor */
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+SSL_CERTCACHE_releaseTrustAnchor(sslTrustAnchor **ppAnchor)
+{
+    sslTrustAnchor* pAnchor;
+    intBoolean      isOrphan;
+    MSTATUS         status;
+
+    if ((NULL == ppAnchor) || (NULL == (pAnchor = *ppAnchor)))
+        return OK;
+
+    if (OK > (status = RTOS_mutexWait(m_sslCertCacheMutex)))
+        return status;
+
+    isOrphan = ((0 == --pAnchor->refCount) && (0 == pAnchor->anchorId)) ? TRUE : FALSE;
+
+    RTOS_mutexRelease(m_sslCertCacheMutex);
+
+    if (isOrphan)
+        freeTrustAnchor(pAnchor);
+
+    *ppAnchor = NULL;
+
+    return OK;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* fingerprint of the chain as sent by the peer: length-prefixed DER of
+ * every certificate, in order */
+extern MSTATUS
+SSL_CERTCACHE_hashChain(MOC_HASH(hwAccelDescr hwAccelCtx)
+                        const certDescriptor *pCertChain, sbyte4 numCertsInChain,
+                        ubyte *pRetHash)
+{
+    sha256Descr ctx;
+    ubyte       lenBuf[4];
+    sbyte4      i;
+    MSTATUS     status;
+
+    if (OK > (status = SHA256_initDigest(MOC_HASH(hwAccelCtx) &ctx)))
+        goto exit;
+
+    for (i = 0; i < numCertsInChain; i++)
+    {
+        if (NULL == pCertChain[i].pCertificate)
+        {
+            status = ERR_NULL_POINTER;
+            goto exit;
+        }
+
+        lenBuf[0] = (ubyte)(pCertChain[i].certLength >> 24);
+        lenBuf[1] = (ubyte)(pCertChain[i].certLength >> 16);
+        lenBuf[2] = (ubyte)(pCertChain[i].certLength >>  8);
+        lenBuf[3] = (ubyte)(pCertChain[i].certLength);
+
+        if (OK > (status = SHA256_updateDigest(MOC_HASH(hwAccelCtx) &ctx, lenBuf, sizeof(lenBuf))))
+            goto exit;
+
+        if (OK > (status = SHA256_updateDigest(MOC_HASH(hwAccelCtx) &ctx, pCertChain[i].pCertificate, pCertChain[i].certLength)))
+            goto exit;
+    }
+
+    status = SHA256_finalDigest(MOC_HASH(hwAccelCtx) &ctx, pRetHash);
+
+exit:
+    return status;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* on a hit *ppRetAnchor holds a reference to the anchor the chain was
+ * verified to; a chain outside its validity window is reported as a miss so
+ * the full verification produces the proper errors */
+extern MSTATUS
+SSL_CERTCACHE_lookupChain(const ubyte *pChainHash,
+                          intBoolean chkValidityBefore, intBoolean chkValidityAfter,
+                          sslTrustAnchor **ppRetAnchor)
+{
+    sslVerifiedChain*   pChain = NULL;
+    sbyte4              i, j;
+    sbyte4              res;
+    MSTATUS             status;
+
+    *ppRetAnchor = NULL;
+
+    if (OK > (status = RTOS_mutexWait(m_sslCertCacheMutex)))
+        return status;
+
+    for (i = 0; i < SSL_VERIFIED_CHAIN_CACHE_SIZE; i++)
+    {
+        if (0 == m_verifiedChains[i].lastUsed)
+            continue;
+
+        MOC_MEMCMP(m_verifiedChains[i].chainHash, pChainHash, SHA256_RESULT_SIZE, &res);
+
+        if (0 == res)
+        {
+            pChain = &m_verifiedChains[i];
+            break;
+        }
+    }
+
+    if ((NULL != pChain) && (isWithinValidity(pChain, chkValidityBefore, chkValidityAfter)))
+    {
+        for (j = 0; j < SSL_TRUST_ANCHOR_CACHE_SIZE; j++)
+        {
+            if ((NULL != m_trustAnchors[j]) && (pChain->anchorId == m_trustAnchors[j]->anchorId))
+            {
+                m_trustAnchors[j]->refCount++;
+                m_trustAnchors[j]->lastUsed = nextUse();
+                pChain->lastUsed = nextUse();
+
+                *ppRetAnchor = m_trustAnchors[j];
+                break;
+            }
+        }
+
+        /* anchor was evicted: the memo is of no further use */
+        if (NULL == *ppRetAnchor)
+            MOC_MEMSET((ubyte *)pChain, 0x00, sizeof(sslVerifiedChain));
+    }
+
+    RTOS_mutexRelease(m_sslCertCacheMutex);
+
+    return OK;
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+SSL_CERTCACHE_addChain(const ubyte *pChainHash, const sslTrustAnchor *pAnchor,
+                       const TimeDate *pNotBefore, const TimeDate *pNotAfter)
+{
+    sslVerifiedChain*   pChain = &m_verifiedChains[0];
+    sbyte4              i;
+    sbyte4              res;
+    MSTATUS             status;
+
+    /* private (uncached) anchors cannot be found again */
+    if ((NULL == pAnchor) || (0 == pAnchor->anchorId))
+        return OK;
+
+    if (OK > (status = RTOS_mutexWait(m_sslCertCacheMutex)))
+        return status;
+
+    for (i = 0; i < SSL_VERIFIED_CHAIN_CACHE_SIZE; i++)
+    {
+        MOC_MEMCMP(m_verifiedChains[i].chainHash, pChainHash, SHA256_RESULT_SIZE, &res);
+
+        if ((0 != m_verifiedChains[i].lastUsed) && (0 == res))
+        {
+            pChain = &m_verifiedChains[i];
+            break;
+        }
+
+        if (m_verifiedChains[i].lastUsed < pChain->lastUsed)
+            pChain = &m_verifiedChains[i];
+    }
+
+    MOC_MEMCPY(pChain->chainHash, pChainHash, SHA256_RESULT_SIZE);
+    pChain->anchorId  = pAnchor->anchorId;
+    pChain->notBefore = *pNotBefore;
+    pChain->notAfter  = *pNotAfter;
+    pChain->lastUsed  = nextUse();
+
+    RTOS_mutexRelease(m_sslCertCacheMutex);
+
+    return OK;
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+SSL_CERTCACHE_getValidity(ASN1_ITEM *pCertificate, CStream cs,
+                          TimeDate *pNotBefore, TimeDate *pNotAfter)
+{
+    ASN1_ITEMPTR    pStart;
+    ASN1_ITEMPTR    pEnd;
+    MSTATUS         status;
+
+    if (OK > (status = CERT_getValidityTime(pCertificate, TRUE, &pStart, &pEnd)))
+        goto exit;
+
+    if (OK > (status = CERT_GetCertTime(pStart, cs, pNotBefore)))
+        goto exit;
+
+    status = CERT_GetCertTime(pEnd, cs, pNotAfter);
+
+exit:
+    return status;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* intersect the window [*pNotBefore, *pNotAfter] with a certificate's */
+extern void
+SSL_CERTCACHE_narrowValidity(TimeDate *pNotBefore, TimeDate *pNotAfter,
+                             const TimeDate *pCertNotBefore, const TimeDate *pCertNotAfter)
+{
+    if (0 < compareTimeDate(pCertNotBefore, pNotBefore))
+        *pNotBefore = *pCertNotBefore;
+
+    if (0 > compareTimeDate(pCertNotAfter, pNotAfter))
+        *pNotAfter = *pCertNotAfter;
+}
+
+#endif /* __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__ */
@@ -0,0 +1,75 @@
+/*
+ * ssl_certcache.h
+ *
+ * Trust anchor cache and verified certificate chain memo
+ *
+ * Trust anchors (CA certificates returned by the certificate store) are
+ * copied and parsed once, then shared read-only by every handshake. A chain
+ * whose signatures were verified up to a cached anchor is remembered by its
+ * SHA-256 fingerprint, so an identical chain presented on reconnect only
+ * needs its leaf checks (common name, key usage, validity) repeated.
+ *
+ * Copyright Mocana Corp 2003-2007. All Rights Reserved.
+ * Proprietary and Confidential Material.
+ *
+ */
+
+#ifndef __SSL_CERTCACHE_HEADER__
+#define __SSL_CERTCACHE_HEADER__
+
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+
+#ifndef SSL_TRUST_ANCHOR_CACHE_SIZE
+#define SSL_TRUST_ANCHOR_CACHE_SIZE     (4)
+#endif
+
+#ifndef SSL_VERIFIED_CHAIN_CACHE_SIZE
+#define SSL_VERIFIED_CHAIN_CACHE_SIZE   (2)
+#endif
+
+/*------------------------------------------------------------------*/
+
+typedef struct sslTrustAnchor
+{
+    ubyte*          pCertificate;           /* private copy of the DER */
+    ubyte4          certLength;
+    ASN1_ITEM*      pRoot;                  /* parsed once, read-only afterwards */
+    intBoolean      isSelfSigned;           /* CERT_isRootCertificate() result */
+    TimeDate        notBefore;
+    TimeDate        notAfter;
+    ubyte4          anchorId;               /* never reused, 0 == free slot */
+    ubyte4          refCount;
+    ubyte4          lastUsed;
+
+} sslTrustAnchor;
+
+typedef struct sslVerifiedChain
+{
+    ubyte           chainHash[SHA256_RESULT_SIZE];
+    ubyte4          anchorId;               /* anchor the chain was verified to */
+    TimeDate        notBefore;              /* latest notBefore in the chain */
+    TimeDate        notAfter;               /* earliest notAfter in the chain */
+    ubyte4          lastUsed;               /* 0 == free slot */
+
+} sslVerifiedChain;
+
+
+/*------------------------------------------------------------------*/
+
+MOC_EXTERN MSTATUS SSL_CERTCACHE_init(void);
+MOC_EXTERN MSTATUS SSL_CERTCACHE_uninit(void);
+MOC_EXTERN MSTATUS SSL_CERTCACHE_clear(void);
+
+MOC_EXTERN MSTATUS SSL_CERTCACHE_acquireTrustAnchor(const ubyte *pCertificate, ubyte4 certLength, sslTrustAnchor **ppRetAnchor);
+MOC_EXTERN MSTATUS SSL_CERTCACHE_releaseTrustAnchor(sslTrustAnchor **ppAnchor);
+
+MOC_EXTERN MSTATUS SSL_CERTCACHE_hashChain(MOC_HASH(hwAccelDescr hwAccelCtx) const certDescriptor *pCertChain, sbyte4 numCertsInChain, ubyte *pRetHash);
+MOC_EXTERN MSTATUS SSL_CERTCACHE_lookupChain(const ubyte *pChainHash, intBoolean chkValidityBefore, intBoolean chkValidityAfter, sslTrustAnchor **ppRetAnchor);
+MOC_EXTERN MSTATUS SSL_CERTCACHE_addChain(const ubyte *pChainHash, const sslTrustAnchor *pAnchor, const TimeDate *pNotBefore, const TimeDate *pNotAfter);
+
+MOC_EXTERN MSTATUS SSL_CERTCACHE_getValidity(ASN1_ITEM *pCertificate, CStream cs, TimeDate *pNotBefore, TimeDate *pNotAfter);
+MOC_EXTERN void    SSL_CERTCACHE_narrowValidity(TimeDate *pNotBefore, TimeDate *pNotAfter, const TimeDate *pCertNotBefore, const TimeDate *pCertNotAfter);
+
+#endif /* __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__ */
+
+#endif /* __SSL_CERTCACHE_HEADER__ */
@@ -73,6 +73,7 @@
 #endif
 #include "../ssl/sslsock.h"
 #include "../ssl/sslsock_priv.h"
+#include "../ssl/ssl_certcache.h"
 /* the ECDHE ECDSA signature is a DER encoded ASN1. sequence ... */
 #if defined(__ENABLE_MOCANA_SSL_ECDHE_SUPPORT__) || defined(__ENABLE_MOCANA_SSL_MUTUAL_AUTH_SUPPORT__)
 #include "../asn1/derencoder.h"
@@ -1397,6 +1398,7 @@ static sslAlertsInfo mAlertsSSL[] = {
     { SSL_ALERT_INAPPROPRIATE_FALLBACK,  SSLALERTLEVEL_FATAL,   ALERT_TLS,     ERR_SSL_SERVER_INAPPROPRIATE_FALLBACK_SCSV },
     { SSL_ALERT_UNSUPPORTED_EXTENSION,   SSLALERTLEVEL_FATAL,   ALERT_TLS,     ERR_SSL_EXTENSION_UNSOLICITED_OFFER },
     { SSL_ALERT_UNRECOGNIZED_NAME,       SSLALERTLEVEL_FATAL,   ALERT_TLS,     ERR_SSL_EXTENSION_UNRECOGNIZED_NAME },
+    { SSL_ALERT_ILLEGAL_PARAMETER,       SSLALERTLEVEL_FATAL,   ALERT_TLS,     ERR_SSL_EXTENSION_MAX_FRAGMENT_LENGTH },
     { SSL_ALERT_BAD_CERTIFICATE_STATUS_RESPONSE,
                                          SSLALERTLEVEL_FATAL, ALERT_TLS,       ERR_SSL_EXTENSION_CERTIFICATE_STATUS_RESPONSE },
     { SSL_ALERT_NO_RENEGOTIATION,        SSLALERTLEVEL_WARNING, ALERT_TLS,     ERR_SSL_SERVER_RENEGOTIATE_NOT_ALLOWED },
@@ -2090,6 +2092,9 @@ static MSTATUS handleInnerAppMessage(SSLSocket* pSSLSock);
 /* static MSTATUS SSL_SOCK_receiveRecord(SSLSocket* pSSLSock, SSLRecordHeader* pSRH, ubyte **ppPacketPayload, ubyte4 *pPacketLength); */
 static MSTATUS SSL_SOCK_receiveV23Record(SSLSocket* pSSLSock, ubyte* pSRH, ubyte **ppPacketPayload, ubyte4 *pPacketLength);
 static MSTATUS checkBuffer(SSLSocket* pSSLSock, sbyte4 requestedSize);
+#ifdef __ENABLE_TLSEXT_RFC6066__
+static MSTATUS fragmentHandshakeRecords(SSLSocket* pSSLSock, ubyte4 *pTotalLen);
+#endif
 
 #if defined(__ENABLE_RFC3546__)
 static MSTATUS processHelloExtensions(SSLSocket* pSSLSock, ubyte *pExtensions,
@@ -2110,6 +2115,82 @@ static MSTATUS validateFirstCertificate(ASN1_ITEM* rootItem,
 #endif
 
 
+/*------------------------------------------------------------------*/
+
+#ifdef __ENABLE_TLSEXT_RFC6066__
+/* Split the plaintext handshake records of a flight (pSSLSock->buffers[0].pHeader,
+ * *pTotalLen bytes) so that no record carries more than the negotiated
+ * max_fragment_length (RFC 6066, section 4); a handshake message may span
+ * several records.  The records are re-framed into a new buffer, which
+ * replaces buffers[0].pHeader; the other buffers[] pointers are stale on
+ * return.  Encrypted flights (rehandshake) are already split by sendDataSSL(),
+ * and DTLS flights by fragmentHandshakeMessages(). */
+static MSTATUS
+fragmentHandshakeRecords(SSLSocket* pSSLSock, ubyte4 *pTotalLen)
+{
+    ubyte*  pSrc     = pSSLSock->buffers[0].pHeader;
+    ubyte*  pNew     = NULL;
+    ubyte*  pDest;
+    ubyte4  maxFrag  = pSSLSock->maxFragmentLength;
+    ubyte4  offset;
+    ubyte4  recLen;
+    ubyte4  fragLen;
+    ubyte4  newLen;
+    MSTATUS status   = OK;
+
+    if ((0 == maxFrag) || (NULL == pSrc))
+        goto exit;
+
+#if (defined(__ENABLE_MOCANA_DTLS_CLIENT__) || defined(__ENABLE_MOCANA_DTLS_SERVER__))
+    if (pSSLSock->isDTLS)
+        goto exit;
+#endif
+
+    /* size of the flight once re-framed */
+    newLen = 0;
+    for (offset = 0; offset < *pTotalLen; offset += sizeof(SSLRecordHeader) + recLen)
+    {
+        recLen  = getShortValue(((SSLRecordHeader *)(pSrc + offset))->recordLength);
+        newLen += recLen + (((recLen + maxFrag - 1) / maxFrag) * sizeof(SSLRecordHeader));
+    }
+
+    if (newLen == *pTotalLen)
+        goto exit;                          /* every record already fits */
+
+    if (OK > (status = CRYPTO_ALLOC(pSSLSock->hwAccelCookie, newLen + TLS_EAP_PAD, TRUE, (void **)&pNew)))
+        goto exit;
+
+    pDest = pNew;
+    for (offset = 0; offset < *pTotalLen; offset += recLen)
+    {
+        ubyte   protocol = ((SSLRecordHeader *)(pSrc + offset))->protocol;
+
+        recLen  = getShortValue(((SSLRecordHeader *)(pSrc + offset))->recordLength);
+        offset += sizeof(SSLRecordHeader);
+
+        for (fragLen = 0; fragLen < recLen; fragLen += maxFrag)
+        {
+            ubyte4 len = ((recLen - fragLen) > maxFrag) ? maxFrag : (recLen - fragLen);
+
+            SSL_SET_RECORD_HEADER(pDest, protocol, pSSLSock->sslMinorVersion, len);
+            pDest += sizeof(SSLRecordHeader);
+
+            MOC_MEMCPY(pDest, pSrc + offset + fragLen, len);
+            pDest += len;
+        }
+    }
+
+    CRYPTO_FREE(pSSLSock->hwAccelCookie, TRUE, (void **)&(pSSLSock->buffers[0].pHeader));
+    pSSLSock->buffers[0].pHeader = pNew;
+    *pTotalLen = newLen;
+
+exit:
+    return status;
+
+} /* fragmentHandshakeRecords */
+#endif
+
+
 /*------------------------------------------------------------------*/
 
 #ifdef    __ENABLE_MOCANA_SSL_CLIENT__
@@ -2658,6 +2739,10 @@ recvAll(SSLSocket* pSSLSock, sbyte* pBuffer, sbyte4 toReceive,
 
     if (0 != numBytesRead)
     {
+#if defined(__ENABLE_MOCANA_SSL_ZERO_COPY__)
+        /* bytes read straight into the record buffer are already in place */
+        if ((SSL_RX_RECORD_BYTES_READ(pSSLSock) + SSL_RX_RECORD_BUFFER(pSSLSock)) != *ppPacketPayload)
+#endif
         MOC_MEMCPY(SSL_RX_RECORD_BYTES_READ(pSSLSock) + SSL_RX_RECORD_BUFFER(pSSLSock), *ppPacketPayload, numBytesRead);
 
         SSL_RX_RECORD_BYTES_READ(pSSLSock) += numBytesRead;
@@ -3089,6 +3174,75 @@ exit1:
 
 /*--------------------------------------------------------------------------------*/
 
+#ifndef __DISABLE_MOCANA_SHA256__
+
+/* P_SHA256: the secret's (K ^ ipad) and (K ^ opad) midstates are computed
+    once for the whole output instead of twice per HMAC, and each step's
+    two MACs, HMAC(A(i) + seed) and A(i+1) = HMAC(A(i)), share one call
+*/
+
+static void
+P_hash_SHA256(SSLSocket *pSSLSock, const ubyte* secret, sbyte4 secretLen,
+              const ubyte* seed, sbyte4 seedLen,
+              ubyte* result, sbyte4 resultLen)
+{
+    SHA256_CTX      inner;
+    SHA256_CTX      outer;
+    ubyte*          pASeed = NULL;              /* A(i) + seed */
+    ubyte           out[SHA256_RESULT_SIZE];
+    ubyte           nextA[SHA256_RESULT_SIZE];
+    const ubyte*    texts[2];
+    ubyte4          textLens[2];
+    ubyte*          results[2];
+    sbyte4          produced;
+
+    if (NULL == (pASeed = (ubyte*) MALLOC(SHA256_RESULT_SIZE + seedLen)))
+        goto exit;
+
+    if (OK > HMAC_SHA256_prefixes(MOC_HASH(pSSLSock->hwAccelCookie) secret, secretLen, &inner, &outer))
+        goto exit;
+
+    /* A(1) */
+    texts[0] = seed; textLens[0] = seedLen; results[0] = pASeed;
+    if (OK > HMAC_SHA256_multi(MOC_HASH(pSSLSock->hwAccelCookie) &inner, &outer, 1, texts, textLens, results))
+        goto exit;
+
+    MOC_MEMCPY(pASeed + SHA256_RESULT_SIZE, seed, seedLen);
+
+    texts[0] = pASeed; textLens[0] = SHA256_RESULT_SIZE + seedLen; results[0] = out;
+    texts[1] = pASeed; textLens[1] = SHA256_RESULT_SIZE;           results[1] = nextA;
+
+    for (produced = 0; produced < resultLen; produced += SHA256_RESULT_SIZE)
+    {
+        sbyte4 numToCopy;
+
+        if (OK > HMAC_SHA256_multi(MOC_HASH(pSSLSock->hwAccelCookie) &inner, &outer, 2, texts, textLens, results))
+            goto exit;
+
+        /* put in result buffer */
+        numToCopy = resultLen - produced;
+        if (numToCopy > SHA256_RESULT_SIZE)
+        {
+            numToCopy = SHA256_RESULT_SIZE;
+        }
+        MOC_MEMCPY(result + produced, out, numToCopy);
+
+        /* A(i+1) */
+        MOC_MEMCPY(pASeed, nextA, SHA256_RESULT_SIZE);
+    }
+
+exit:
+    MOC_MEMSET((ubyte *)&inner, 0x00, sizeof(inner));
+    MOC_MEMSET((ubyte *)&outer, 0x00, sizeof(outer));
+
+    if (NULL != pASeed)
+        FREE(pASeed);
+}
+
+#endif /* __DISABLE_MOCANA_SHA256__ */
+
+/*--------------------------------------------------------------------------------*/
+
 /* this is the pseudo random output function for TLS
     output is of length resultLen and is stored in result
     (which should be at least resultLen bytes long!)
@@ -3104,6 +3258,14 @@ P_hash(SSLSocket *pSSLSock, const ubyte* secret, sbyte4 secretLen,
     sbyte4  produced;
     BulkCtx context = NULL;
 
+#ifndef __DISABLE_MOCANA_SHA256__
+    if (&SHA256Suite == pBHAlgo)
+    {
+        P_hash_SHA256(pSSLSock, secret, secretLen, seed, seedLen, result, resultLen);
+        return;
+    }
+#endif
+
     if (OK > MEM_POOL_getPoolObject(&pSSLSock->smallPool, (void **)&(pA)))
         goto exit;
 
@@ -4519,10 +4681,10 @@ SSL_SOCK_receiveRecord(SSLSocket* pSSLSock, SSLRecordHeader* pSRH,
 
     /* get the size */
     pSSLSock->recordSize = getShortValue(pSRH->recordLength);
-    if ((SSL_MAX_RECORDSIZE < pSSLSock->recordSize) || (0 > pSSLSock->recordSize))
+    if (((sbyte4)SSL_SOCK_MAX_RECORDSIZE(pSSLSock) < pSSLSock->recordSize) || (0 > pSSLSock->recordSize))
     {
 #ifdef SSL_MESG_TOO_LONG_COUNTER
-        if (SSL_MAX_RECORDSIZE < pSSLSock->recordSize)
+        if ((sbyte4)SSL_SOCK_MAX_RECORDSIZE(pSSLSock) < pSSLSock->recordSize)
         {
             SSL_MESG_TOO_LONG_COUNTER(1);        /* increment counter by 1 */
         }
@@ -4611,10 +4773,10 @@ SSL_SOCK_receiveV23Record(SSLSocket* pSSLSock, ubyte* pSRH,
             pSSLSock->recordSize = getShortValue(((SSLRecordHeader*)pSRH)->recordLength);
         }
 
-        if ((SSL_MAX_RECORDSIZE < pSSLSock->recordSize) || (0 > pSSLSock->recordSize))
+        if (((sbyte4)SSL_SOCK_MAX_RECORDSIZE(pSSLSock) < pSSLSock->recordSize) || (0 > pSSLSock->recordSize))
         {
 #ifdef SSL_MESG_TOO_LONG_COUNTER
-            if (SSL_MAX_RECORDSIZE < pSSLSock->recordSize)
+            if ((sbyte4)SSL_SOCK_MAX_RECORDSIZE(pSSLSock) < pSSLSock->recordSize)
                {
                    SSL_MESG_TOO_LONG_COUNTER(1);        /* increment counter by 1 */
                }
@@ -5575,6 +5737,10 @@ sendDataSSL(SSLSocket* pSSLSock, ubyte protocol, const sbyte* data, sbyte4 dataS
     /* compute the maximum data that can be sent in one record */
     chunkLen = SSL_RECORDSIZE - (hashOrTagLen + pCS->pCipherAlgo->getFieldFunc(Block_Size) + explicitIVLen);
 
+    /* a negotiated max_fragment_length caps the plaintext of each record */
+    if (chunkLen > (sbyte4)SSL_SOCK_MAX_PLAINTEXT(pSSLSock))
+        chunkLen = (sbyte4)SSL_SOCK_MAX_PLAINTEXT(pSSLSock);
+
     if (chunkLen > dataSize)
     {
         /* no reason to allocate more than required */
@@ -6541,20 +6707,24 @@ exit:
 #if (defined(__ENABLE_MOCANA_SSL_MUTUAL_AUTH_SUPPORT__) || defined(__ENABLE_MOCANA_SSL_CLIENT__))
 static MSTATUS
 verifyKnownCa(SSLSocket *pSSLSock,
-              ubyte *pTempCertificate, ubyte2 certLen,
+              ASN1_ITEM* pCertificate, CStream cs,
               certDescriptor  *pCaCert, sbyte4 chainLen,
               certParamCheckConf *pCertParamCheckConf,
-              errorArray* pStatusArray)
+              errorArray* pStatusArray
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+              , sslTrustAnchor **ppRetAnchor
+#endif
+              )
 {
     certDescriptor  caCertificate;
-    ASN1_ITEM*      pCertificate     = NULL;
-    MemFile         certMemFile;
-    CStream         cs;
     ASN1_ITEM*      pLastCertificate = NULL;
     MemFile         lastCertMemFile;
     CStream         lastCs;
     intBoolean      isSelfSigned     = FALSE;
     MSTATUS         status           = ERR_SSL_UNKNOWN_CERTIFICATE_AUTHORITY;
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    sslTrustAnchor* pAnchor          = NULL;
+#endif
 
 
 
@@ -6566,14 +6736,6 @@ verifyKnownCa(SSLSocket *pSSLSock,
     	goto exit;
     }
 
-
-    MF_attach(&certMemFile, certLen, pTempCertificate);
-    CS_AttachMemFile(&cs, &certMemFile );
-
-    if (OK > (status = ASN1_Parse(cs, &pCertificate)))
-        goto exit;
-
-
     if (NULL != SSL_sslSettings()->funcPtrCertificateStoreLookup)
     {
 #ifdef __ENABLE_MOCANA_EXTRACT_CERT_BLOB__
@@ -6619,6 +6781,19 @@ verifyKnownCa(SSLSocket *pSSLSock,
             goto exit;
         }
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+        /* the CA is parsed once and then shared by every handshake */
+        if (OK > (status = SSL_CERTCACHE_acquireTrustAnchor(caCertificate.pCertificate, caCertificate.certLength, &pAnchor)))
+        {
+            DEBUG_ERROR(DEBUG_SSL_MESSAGES, (sbyte*)"SSL_CERTCACHE_acquireTrustAnchor() returns status = ", (sbyte4)status);
+            goto exit;
+        }
+
+        pLastCertificate = pAnchor->pRoot;
+
+        MF_attach(&lastCertMemFile, pAnchor->certLength, pAnchor->pCertificate);
+        CS_AttachMemFile( &lastCs, &lastCertMemFile);
+#else
         MF_attach(&lastCertMemFile, caCertificate.certLength, caCertificate.pCertificate);
         CS_AttachMemFile( &lastCs, &lastCertMemFile);
 
@@ -6630,6 +6805,7 @@ verifyKnownCa(SSLSocket *pSSLSock,
 
             goto exit;
         }
+#endif
 
         status = CERT_validateCertificateWithConf(MOC_RSA_HASH(pSSLSock->hwAccelCookie)
                                                   pCertificate,
@@ -6661,7 +6837,11 @@ verifyKnownCa(SSLSocket *pSSLSock,
     /* last certificate -> is this root certificate in our store? */
     if ((NULL != pLastCertificate) && (NULL != SSL_sslSettings()->funcPtrCertificateStoreVerify))
     {
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+        status = (pAnchor->isSelfSigned) ? OK : ERR_FALSE;
+#else
         status = CERT_isRootCertificate(pLastCertificate, lastCs);
+#endif
 
         if (OK <= status)
         {
@@ -6679,10 +6859,18 @@ verifyKnownCa(SSLSocket *pSSLSock,
 
 exit:
 
-    if(pCertificate)
-        TREE_DeleteTreeItem((TreeItem *)pCertificate);
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    if ((OK == status) && (NULL != ppRetAnchor))
+    {
+        *ppRetAnchor = pAnchor;
+        pAnchor = NULL;
+    }
+
+    SSL_CERTCACHE_releaseTrustAnchor(&pAnchor);
+#else
     if(pLastCertificate)
         TREE_DeleteTreeItem((TreeItem *)pLastCertificate);
+#endif
 
     if ((NULL != SSL_sslSettings()->funcPtrCertificateStoreRelease) && (NULL != caCertificate.pCertificate))
         SSL_sslSettings()->funcPtrCertificateStoreRelease(SSL_findConnectionInstance(pSSLSock), &caCertificate);
@@ -6694,6 +6882,74 @@ exit:
 
 /*------------------------------------------------------------------*/
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+/* A chain identical to one already verified up to a cached trust anchor
+   only needs the leaf checks that depend on this session (common name, key
+   usage, peer key); signatures and the trust decision are not repeated. */
+static MSTATUS
+validateCachedChain(SSLSocket *pSSLSock, certDescriptor* pLeafCert,
+                    const ubyte *pChainHash,
+                    certParamCheckConf *pCertParamCheckConf,
+                    certDescriptor *caCertificate, errorArray* pStatusArray,
+                    intBoolean *pRetIsHit)
+{
+    sslTrustAnchor* pAnchor      = NULL;
+    ASN1_ITEM*      pCertificate = NULL;
+    MemFile         certMemFile;
+    CStream         cs;
+    MSTATUS         status;
+
+    *pRetIsHit = FALSE;
+
+    if (OK > (status = SSL_CERTCACHE_lookupChain(pChainHash,
+                                                 pCertParamCheckConf->chkValidityBefore,
+                                                 pCertParamCheckConf->chkValidityAfter,
+                                                 &pAnchor)))
+    {
+        goto exit;
+    }
+
+    if (NULL == pAnchor)
+        goto exit;
+
+    *pRetIsHit = TRUE;
+
+    MF_attach(&certMemFile, pLeafCert->certLength, pLeafCert->pCertificate);
+    CS_AttachMemFile(&cs, &certMemFile );
+
+    if (OK > (status = ASN1_Parse( cs, &pCertificate)))
+    {
+        addErrorStatus(pStatusArray, status, status);
+        goto exit;
+    }
+
+    if (OK > (status = validateFirstCertificate(pCertificate, cs, pSSLSock, pCertParamCheckConf->chkCommonName, pStatusArray)))
+        goto exit;
+
+    /* the socket keeps the anchor reference, so caCertificate stays valid after we return */
+    SSL_CERTCACHE_releaseTrustAnchor(&pSSLSock->pPeerCaAnchor);
+
+    if (NULL != caCertificate)
+    {
+        caCertificate->pCertificate = pAnchor->pCertificate;
+        caCertificate->certLength   = pAnchor->certLength;
+
+        pSSLSock->pPeerCaAnchor = pAnchor;
+        pAnchor = NULL;
+    }
+
+exit:
+    if (pCertificate)
+        TREE_DeleteTreeItem((TreeItem *)pCertificate);
+
+    SSL_CERTCACHE_releaseTrustAnchor(&pAnchor);
+
+    return status;
+}
+#endif /* __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__ */
+
+/*------------------------------------------------------------------*/
+
 extern MSTATUS
 SSL_SOCK_validateCert(SSLSocket *pSSLSock,
                       certDescriptor* pCertChain, sbyte4 numCertsInChain,
@@ -6711,6 +6967,16 @@ SSL_SOCK_validateCert(SSLSocket *pSSLSock,
     ubyte           *pTempCertificate = NULL;
     ubyte2          certLen = 0;
     intBoolean      isRoot = FALSE;
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    sslTrustAnchor* pAnchor          = NULL;
+    ubyte           chainHash[SHA256_RESULT_SIZE];
+    TimeDate        notBefore;
+    TimeDate        notAfter;
+    TimeDate        certNotBefore;
+    TimeDate        certNotAfter;
+    intBoolean      isMemoUsable     = FALSE;
+    intBoolean      isMemoHit        = FALSE;
+#endif
 
     if (pSSLSock == NULL || numCertsInChain <= 0 || pCertChain == NULL)
     {
@@ -6732,6 +6998,26 @@ SSL_SOCK_validateCert(SSLSocket *pSSLSock,
     if (NULL == pCertParamCheckConf)
         pCertParamCheckConf = &pSSLSock->certParamCheck;
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    /* only chains ending at a known CA are remembered */
+    if ((FALSE != pCertParamCheckConf->chkKnownCA) &&
+        (OK <= SSL_CERTCACHE_hashChain(MOC_HASH(pSSLSock->hwAccelCookie) pCertChain, numCertsInChain, chainHash)))
+    {
+        if (OK > (status = validateCachedChain(pSSLSock, &pCertChain[0], chainHash, pCertParamCheckConf,
+                                               caCertificate, pStatusArray, &isMemoHit)))
+        {
+            goto exit;
+        }
+
+        if (isMemoHit)
+            goto exit;
+
+        isMemoUsable = TRUE;
+        MOC_MEMSET((ubyte *)&notBefore, 0x00, sizeof(TimeDate));
+        MOC_MEMSET((ubyte *)&notAfter, 0xff, sizeof(TimeDate));
+    }
+#endif
+
     for (i = 0; i < numCertsInChain; i++)
     {
         if (NULL == pCertChain[i].pCertificate)
@@ -6755,6 +7041,18 @@ SSL_SOCK_validateCert(SSLSocket *pSSLSock,
             goto exit;
         }
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+        if ((isMemoUsable) &&
+            (OK <= SSL_CERTCACHE_getValidity(pCertificate, cs, &certNotBefore, &certNotAfter)))
+        {
+            SSL_CERTCACHE_narrowValidity(&notBefore, &notAfter, &certNotBefore, &certNotAfter);
+        }
+        else
+        {
+            isMemoUsable = FALSE;
+        }
+#endif
+
         /* last certificate --  check if it's the root certificate
         This returns OK, ERR_FALSE or some error*/
         if (OK <= (status = CERT_isRootCertificate(pCertificate, cs)))
@@ -6851,7 +7149,11 @@ SSL_SOCK_validateCert(SSLSocket *pSSLSock,
 
         if (FALSE != pCertParamCheckConf->chkKnownCA)
         {
-            status = verifyKnownCa(pSSLSock, pCertChain[i].pCertificate, pCertChain[i].certLength, caCertificate, i /*numCertsInChain*/, pCertParamCheckConf, pStatusArray);
+            status = verifyKnownCa(pSSLSock, pCertificate, cs, caCertificate, i /*numCertsInChain*/, pCertParamCheckConf, pStatusArray
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+                                   , &pAnchor
+#endif
+                                   );
             if (OK == status)
             {
                 break;
@@ -6874,6 +7176,16 @@ SSL_SOCK_validateCert(SSLSocket *pSSLSock,
         CS_AttachMemFile(&prevCS, &prevCertMemFile);
     }
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    /* remember chains that verified cleanly up to a cached anchor */
+    if ((isMemoUsable) && (OK == status) && (NULL != pAnchor) &&
+        ((NULL == pStatusArray) || (0 == pStatusArray->numErrors)))
+    {
+        SSL_CERTCACHE_narrowValidity(&notBefore, &notAfter, &pAnchor->notBefore, &pAnchor->notAfter);
+        SSL_CERTCACHE_addChain(chainHash, pAnchor, &notBefore, &notAfter);
+    }
+#endif
+
 exit:
     if (pCertificate)
         TREE_DeleteTreeItem((TreeItem *)pCertificate);
@@ -6881,6 +7193,10 @@ exit:
     if (pPrevCertificate)
         TREE_DeleteTreeItem((TreeItem *)pPrevCertificate);
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    SSL_CERTCACHE_releaseTrustAnchor(&pAnchor);
+#endif
+
     return status;
 
 }/* validateCert */
@@ -7657,6 +7973,10 @@ SSL_SOCK_uninit(SSLSocket* pSSLSock)
         resetTicket(pSSLSock);
 #endif /* (defined(__ENABLE_MOCANA_SSL_CLIENT__) && defined(__ENABLE_MOCANA_EAP_FAST__) && defined(__ENABLE_RFC3546__)) */
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    SSL_CERTCACHE_releaseTrustAnchor(&pSSLSock->pPeerCaAnchor);
+#endif
+
     CRYPTO_FREE(pSSLSock->hwAccelCookie, TRUE, (void **)&pSSLSock->pReceiveBufferBase);
     CRYPTO_FREE(pSSLSock->hwAccelCookie, TRUE, (void **)&pSSLSock->pSecretAndRand);
 
@@ -7749,6 +8069,196 @@ SSL_SOCK_send(SSLSocket* pSSLSock, const sbyte* data, sbyte4 dataSize)
 }
 
 
+/*------------------------------------------------------------------*/
+
+#if defined(__ENABLE_MOCANA_SSL_ZERO_COPY__)
+/* In place records are only formed for TLS 1.0(+) streams, where the record
+ * header immediately follows the hash sequence number and no CBC empty record
+ * precedes the message; everything else goes through sendDataSSL(). */
+static intBoolean
+isInPlaceRecordCapable(SSLSocket* pSSLSock)
+{
+    CipherSuiteInfo* pCS = pSSLSock->pActiveOwnCipherSuite;
+
+    if (NULL == pCS)
+        return FALSE;
+
+#if (defined(__ENABLE_MOCANA_DTLS_CLIENT__) || defined(__ENABLE_MOCANA_DTLS_SERVER__))
+    if (pSSLSock->isDTLS)
+        return FALSE;
+#endif
+
+#if MIN_SSL_MINORVERSION <= SSL3_MINORVERSION
+    if (SSL3_MINORVERSION == pSSLSock->sslMinorVersion)
+        return FALSE;
+#endif
+
+    if ((pSSLSock->sslMinorVersion < TLS11_MINORVERSION) && pCS->pCipherAlgo->getFieldFunc(Block_Size) &&
+        (0 != (pSSLSock->runtimeFlags & SSL_FLAG_ENABLE_SEND_EMPTY_FRAME)))
+    {
+        return FALSE;
+    }
+
+    if ((NULL != pSSLSock->pOutputBuffer) || (SSL_FLAG_ENABLE_SEND_BUFFER & pSSLSock->runtimeFlags))
+        return FALSE;
+
+    return TRUE;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* Largest payload of one in place record: same bound as sendDataSSL() */
+static ubyte4
+maxInPlaceDataSize(SSLSocket* pSSLSock)
+{
+    CipherSuiteInfo* pCS = pSSLSock->pActiveOwnCipherSuite;
+    ubyte4           hashOrTagLen;
+    ubyte4           maxDataSize;
+
+    hashOrTagLen = pCS->pCipherAlgo->getFieldFunc(TagLen) == 0? pCS->pCipherAlgo->getFieldFunc(Hash_Size) : pCS->pCipherAlgo->getFieldFunc(TagLen);
+    maxDataSize  = SSL_RECORDSIZE - (hashOrTagLen + pCS->pCipherAlgo->getFieldFunc(Block_Size) + EXPLICIT_IV_SIZE(pSSLSock->sslMinorVersion, pCS));
+
+    if (maxDataSize > SSL_SOCK_MAX_PLAINTEXT(pSSLSock))
+        maxDataSize = SSL_SOCK_MAX_PLAINTEXT(pSSLSock);
+
+    return maxDataSize;
+}
+
+
+/*------------------------------------------------------------------*/
+
+extern MSTATUS
+SSL_SOCK_getRecordOverhead(SSLSocket* pSSLSock, ubyte4 *pRetHeaderLen, ubyte4 *pRetTrailerLen, ubyte4 *pRetMaxDataLen)
+{
+    CipherSuiteInfo* pCS = pSSLSock->pActiveOwnCipherSuite;
+    ubyte4           hashOrTagLen;
+
+    if (FALSE == isInPlaceRecordCapable(pSSLSock))
+        return ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE;
+
+    hashOrTagLen = pCS->pCipherAlgo->getFieldFunc(TagLen) == 0? pCS->pCipherAlgo->getFieldFunc(Hash_Size) : pCS->pCipherAlgo->getFieldFunc(TagLen);
+
+    *pRetHeaderLen  = sizeof(SSLRecordHeader) + EXPLICIT_IV_SIZE(pSSLSock->sslMinorVersion, pCS);
+    *pRetTrailerLen = hashOrTagLen + pCS->pCipherAlgo->getFieldFunc(Block_Size);
+    *pRetMaxDataLen = maxInPlaceDataSize(pSSLSock);
+
+    return OK;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* Encrypt one application data record in the caller's buffer.  On entry the
+ * plaintext is at pRecord + headerLen, SSL_HASH_SEQUENCE_SIZE bytes ahead of
+ * pRecord are scratch, and trailerLen bytes behind the plaintext are free
+ * (see SSL_SOCK_getRecordOverhead()).  The record is not transmitted. */
+extern MSTATUS
+SSL_SOCK_sendInPlace(SSLSocket* pSSLSock, ubyte* pRecord, ubyte4 dataSize, ubyte4 *pRetRecordLen)
+{
+    CipherSuiteInfo* pCS = pSSLSock->pActiveOwnCipherSuite;
+    SSLRecordHeader* pRecordHeader = (SSLRecordHeader *)pRecord;
+    ubyte*           pSeqNum = pRecord - SSL_HASH_SEQUENCE_SIZE;
+    ubyte4           explicitIVLen;
+    ubyte4           hashOrTagLen;
+    sbyte4           padLen;
+    ubyte4           seqNumHigh;
+    ubyte4           seqNum;
+    MSTATUS          status;
+
+    /* block sends between ChangeCipherSpec and Finished */
+    if ((( pSSLSock->server) && ((kSslReceiveHelloState1 == SSL_HANDSHAKE_STATE(pSSLSock)) || (kSslReceiveUntil1       == SSL_HANDSHAKE_STATE(pSSLSock)))) ||
+        ((!pSSLSock->server) && ((kSslReceiveHelloState1 == SSL_HANDSHAKE_STATE(pSSLSock)) || (kSslReceiveUntilResume1 == SSL_HANDSHAKE_STATE(pSSLSock)))))
+    {
+        status = ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE;
+        goto exit;
+    }
+
+    if (FALSE == isInPlaceRecordCapable(pSSLSock))
+    {
+        status = ERR_SSL_RECORD_IN_PLACE_UNAVAILABLE;
+        goto exit;
+    }
+
+    explicitIVLen = EXPLICIT_IV_SIZE(pSSLSock->sslMinorVersion, pCS);
+    hashOrTagLen  = pCS->pCipherAlgo->getFieldFunc(TagLen) == 0? pCS->pCipherAlgo->getFieldFunc(Hash_Size) : pCS->pCipherAlgo->getFieldFunc(TagLen);
+
+    if ((0 == dataSize) || (dataSize > maxInPlaceDataSize(pSSLSock)))
+    {
+        status = ERR_BAD_LENGTH;
+        goto exit;
+    }
+
+    pRecordHeader->protocol     = SSL_APPLICATION_DATA;
+    pRecordHeader->majorVersion = SSL3_MAJORVERSION;
+    pRecordHeader->minorVersion = pSSLSock->sslMinorVersion;
+
+    seqNumHigh = pSSLSock->ownSeqnumHigh;
+    seqNum     = pSSLSock->ownSeqnum;
+
+    pSeqNum[0]  = (ubyte)(seqNumHigh >> 24);
+    pSeqNum[1]  = (ubyte)(seqNumHigh >> 16);
+    pSeqNum[2]  = (ubyte)(seqNumHigh >> 8);
+    pSeqNum[3]  = (ubyte)(seqNumHigh);
+    pSeqNum[4]  = (ubyte)(seqNum >> 24);
+    pSeqNum[5]  = (ubyte)(seqNum >> 16);
+    pSeqNum[6]  = (ubyte)(seqNum >> 8);
+    pSeqNum[7]  = (ubyte)(seqNum);
+
+    if (0 == (++pSSLSock->ownSeqnum))
+        pSSLSock->ownSeqnumHigh++;
+
+    padLen = computePadLength(dataSize + pCS->pCipherAlgo->getFieldFunc(Hash_Size), pCS->pCipherAlgo->getFieldFunc(Block_Size));
+
+    /* set the length to dataSize prior to mac calc */
+    setShortValue(pRecordHeader->recordLength, (ubyte2)dataSize);
+
+    if (OK > (status = pCS->pCipherAlgo->encryptRecordFunc(pSSLSock, ((ubyte *)(pRecordHeader + 1)) + explicitIVLen, (ubyte2)dataSize, (sbyte)padLen)))
+        goto exit;
+
+    setShortValue(pRecordHeader->recordLength, (ubyte2)(explicitIVLen + dataSize + hashOrTagLen + padLen));
+
+    *pRetRecordLen = sizeof(SSLRecordHeader) + explicitIVLen + dataSize + hashOrTagLen + padLen;
+
+exit:
+#ifdef __ENABLE_MOCANA_DEBUG_CONSOLE__
+    if (OK > status)
+        DEBUG_ERROR(DEBUG_SSL_TRANSPORT, (sbyte*)"SSL_SOCK_sendInPlace() returns status = ", status);
+#endif
+
+    return status;
+}
+
+
+/*------------------------------------------------------------------*/
+
+/* If a record body is partially received, return the unfilled tail of the
+ * record buffer, so that the transport can read straight into it; the bytes
+ * are then consumed in place by SSL_SOCK_receive(). */
+extern MSTATUS
+SSL_SOCK_getPendingRecordBody(SSLSocket* pSSLSock, ubyte **ppRetBody, ubyte4 *pRetLength)
+{
+    *ppRetBody  = NULL;
+    *pRetLength = 0;
+
+#if (defined(__ENABLE_MOCANA_DTLS_CLIENT__) || defined(__ENABLE_MOCANA_DTLS_SERVER__))
+    if (pSSLSock->isDTLS)
+        return OK;
+#endif
+
+    if ((SSL_ASYNC_RECEIVE_RECORD_2 == SSL_RX_RECORD_STATE(pSSLSock)) &&
+        (TRUE == SSL_RX_RECORD_STATE_INIT(pSSLSock)) &&
+        (SSL_RX_RECORD_BYTES_READ(pSSLSock) < SSL_RX_RECORD_BYTES_REQUIRED(pSSLSock)))
+    {
+        *ppRetBody  = SSL_RX_RECORD_BUFFER(pSSLSock) + SSL_RX_RECORD_BYTES_READ(pSSLSock);
+        *pRetLength = SSL_RX_RECORD_BYTES_REQUIRED(pSSLSock) - SSL_RX_RECORD_BYTES_READ(pSSLSock);
+    }
+
+    return OK;
+}
+#endif /* __ENABLE_MOCANA_SSL_ZERO_COPY__ */
+
+
 /*------------------------------------------------------------------*/
 
 static MSTATUS
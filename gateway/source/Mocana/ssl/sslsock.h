@@ -115,6 +115,11 @@ enum sslSyncRecordStates
 #define SSL_FINISHEDSIZE                (SHA_HASH_RESULT_SIZE + MD5_DIGESTSIZE)
 #define SSL_MAXDIGESTSIZE               (SHA384_RESULT_SIZE)
 
+/* RFC 6066 max_fragment_length: 2^(8 + code) for codes 1..4 */
+#define SSL_MAX_FRAGMENT_LENGTH_CODE_MIN    (1)
+#define SSL_MAX_FRAGMENT_LENGTH_CODE_MAX    (4)
+#define SSL_MAX_FRAGMENT_LENGTH(CODE)       (((ubyte4)1) << (8 + (CODE)))
+
 /*
  *  o  "client_verify_data":  the verify_data from the Finished message
  *     sent by the client on the immediately previous handshake.  For
@@ -189,6 +194,7 @@ typedef enum
 /* forward declare */
 struct CipherSuiteInfo;
 struct diffieHellmanContext;
+struct sslTrustAnchor;
 
 #if (defined(__ENABLE_MOCANA_DTLS_CLIENT__) || defined(__ENABLE_MOCANA_DTLS_SERVER__))
 enum dtlsTimerStates
@@ -333,6 +339,13 @@ typedef struct SSLSocket
     /* Client: send certificate status request */
     /* Server: certificate status request received */
     intBoolean                      certStatusReqExt;
+#ifdef __ENABLE_TLSEXT_RFC6066__
+    /* max_fragment_length: 0 if not negotiated, else 1..4 (2^9..2^12) */
+    /* Client: code requested; Server: code received and echoed */
+    ubyte                           maxFragmentLengthCode;
+    /* plaintext fragment limit in effect (0: SSL_RECORDSIZE) */
+    ubyte4                          maxFragmentLength;
+#endif
 #ifdef __ENABLE_MOCANA_OCSP_CLIENT__
     /* Client: Input parameter to be used while create certificate status request */
     /* Server: Extensions to be attached while generating OCSP Request */
@@ -481,6 +494,11 @@ typedef struct SSLSocket
     /* engineer defined cookie */
     sbyte8                          cookie;
 
+#ifdef __ENABLE_MOCANA_SSL_CERT_VERIFY_CACHE__
+    /* anchor returned as caCertificate by a cached chain hit; held until the next validation or uninit */
+    struct sslTrustAnchor*          pPeerCaAnchor;
+#endif
+
     sbyte4                          server;                 /* are we a server or a client */
     union
     {
@@ -620,6 +638,11 @@ MOC_EXTERN MSTATUS    SSL_SOCK_send(SSLSocket* pSSLSock, const sbyte* data, sbyt
 MOC_EXTERN MSTATUS    SSL_SOCK_sendPendingBytes(SSLSocket* pSSLSock);
 MOC_EXTERN MSTATUS    SSL_SOCK_receive(SSLSocket* pSSLSock, sbyte* buffer, sbyte4 bufferSize, ubyte **ppPacketPayload, ubyte4 *pPacketLength, sbyte4 *pRetNumBytesReceived);
 MOC_EXTERN MSTATUS    SSLSOCK_sendEncryptedHandshakeBuffer(SSLSocket* pSSLSock);
+#if defined(__ENABLE_MOCANA_SSL_ZERO_COPY__)
+MOC_EXTERN MSTATUS    SSL_SOCK_getRecordOverhead(SSLSocket* pSSLSock, ubyte4 *pRetHeaderLen, ubyte4 *pRetTrailerLen, ubyte4 *pRetMaxDataLen);
+MOC_EXTERN MSTATUS    SSL_SOCK_sendInPlace(SSLSocket* pSSLSock, ubyte* pRecord, ubyte4 dataSize, ubyte4 *pRetRecordLen);
+MOC_EXTERN MSTATUS    SSL_SOCK_getPendingRecordBody(SSLSocket* pSSLSock, ubyte **ppRetBody, ubyte4 *pRetLength);
+#endif
 
 /* SSL Alerts */
 MOC_EXTERN intBoolean SSLSOCK_lookupAlert(SSLSocket* pSSLSock, sbyte4 lookupError, sbyte4 *pRetAlertId, sbyte4 *pAlertClass);
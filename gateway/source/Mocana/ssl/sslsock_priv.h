@@ -68,6 +68,15 @@ MOC_EXTERN sbyte4 SSL_findConnectionInstance(SSLSocket *pSSLSock);
 
 #define SSL_MAX_RECORDSIZE                  (SSL_RECORDSIZE + 2048)
 
+/* per connection record limits, after max_fragment_length negotiation */
+#ifdef __ENABLE_TLSEXT_RFC6066__
+#define SSL_SOCK_MAX_PLAINTEXT(X)           ((0 < (X)->maxFragmentLength) ? (X)->maxFragmentLength : SSL_RECORDSIZE)
+#define SSL_SOCK_MAX_RECORDSIZE(X)          ((0 < (X)->maxFragmentLength) ? ((X)->maxFragmentLength + 2048) : SSL_MAX_RECORDSIZE)
+#else
+#define SSL_SOCK_MAX_PLAINTEXT(X)           (SSL_RECORDSIZE)
+#define SSL_SOCK_MAX_RECORDSIZE(X)          (SSL_MAX_RECORDSIZE)
+#endif
+
 #ifndef SSL_DEFAULT_SMALL_BUFFER
 #define SSL_DEFAULT_SMALL_BUFFER            (4096)
 #endif
@@ -0,0 +1,1822 @@
+/*
+*********************************************************************************************************
+*                                             uC/FS V4
+*                                     The Embedded File System
+*
+*                         (c) Copyright 2008-2014; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/FS is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       FILE SYSTEM BENCHMARK
+*
+* Filename      : fs_bench.c
+* Version       : v4.07.00
+*
+* Note(s)       : (1) Host (Linux) benchmark of uC/FS over the RAM disk driver & over the NOR & NAND
+*                     drivers on top of a simulated flash (see 'fs_bench_flash.h').  It is the baseline
+*                     used to tune cache sizes & FTL parameters before they go to the target.
+*
+*                 (2) Workloads, run on every device :
+*
+*                         seq_append      Append fixed-size chunks to one file.
+*                         rand_read       Read fixed-size chunks at random offsets of that file.
+*                         seek            Seek to a random offset & read a few octets.
+*                         small_create    Create, write & close many small files in one directory.
+*                         small_open      Re-open & read each small file.
+*                         small_del       Delete each small file.
+*                         pwr_loss        (Flash only.)  Cut power at a random program/erase while a
+*                                         log is appended & temp files churned, then re-mount & replay
+*                                         the FAT journal.  Latencies are those of the re-mount.
+*
+*                 (3) For every workload the benchmark reports, as one JSON document on stdout :
+*
+*                     (a) Host ops/s & host latency percentiles.  These measure uC/FS itself.
+*
+*                     (b) Simulated device time, ops/s & latency percentiles (flash only), i.e. what the
+*                         workload would cost on the modelled part.
+*
+*                     (c) Sectors read/written by the file system (device driver counters) & flash
+*                         read/program/erase counts.
+*
+*                     (d) Write amplification : sectors written per octet written by the application &,
+*                         for flash, octets programmed per octet written by the application.
+*
+*                 (4) Usage : fs_bench [-q] [-s <seed>] [-d ram,nor,nand] [-f <ppm>] [-c <cache octets>]
+*                                      [-m rd|wt|wb] [-b <file buf octets>]
+*
+*                         -q    quick run (a quarter of the default sizes).
+*                         -f    probability (ppm) for a NAND program/erase to grow a bad block (default 0;
+*                               factory bad blocks are always present).
+*                         -c    assign a volume cache of that size to every volume (default none).
+*                         -m    cache mode : read, write-through or write-back (default wb).
+*                         -b    assign a file buffer of that size to every file opened (default none).
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+
+#include  <cpu_core.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <clk.h>
+#include  <fs.h>
+#include  <fs_cache.h>
+#include  <fs_dev.h>
+#include  <fs_dir.h>
+#include  <fs_entry.h>
+#include  <fs_file.h>
+#include  <fs_vol.h>
+#include  <fs_fat_journal.h>
+#include  <fs_dev_ramdisk.h>
+#include  <fs_dev_nor.h>
+#ifdef   FS_BENCH_NAND_EN
+#include  <fs_dev_nand.h>
+#include  <fs_dev_nand_ctrlr_gen.h>
+#include  <fs_dev_nand_ctrlr_gen_soft_ecc.h>
+#include  <fs_dev_nand_part_static.h>
+#include  <ecc_hamming.h>
+#endif
+#include  "fs_bench_flash.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+                                                                /* ---------------------- RAM DISK -------------------- */
+#define  FS_BENCH_RAM_SEC_SIZE                           512u
+#define  FS_BENCH_RAM_SEC_CNT                          16384u   /* 8 MiB.                                               */
+
+                                                                /* ------------------------ NOR ----------------------- */
+#define  FS_BENCH_NOR_BLK_CNT                             64u   /* 64 x 64 KiB sectors = 4 MiB.                         */
+#define  FS_BENCH_NOR_PG_PER_BLK                         256u
+#define  FS_BENCH_NOR_PG_SIZE                            256u
+#define  FS_BENCH_NOR_SEC_SIZE                           512u
+
+                                                                /* ------------------------ NAND ---------------------- */
+#define  FS_BENCH_NAND_BLK_CNT                           256u   /* 256 x 128 KiB blks = 32 MiB.                         */
+#define  FS_BENCH_NAND_PG_PER_BLK                         64u
+#define  FS_BENCH_NAND_PG_SIZE                          2048u
+#define  FS_BENCH_NAND_SPARE_SIZE                         64u
+#define  FS_BENCH_NAND_ECC_CODEWORD_SIZE                  528u   /* 512 data octets + 16 spare octets per codeword.      */
+#define  FS_BENCH_NAND_SPARE_FREE_START                     1u   /* Spare octet 0 holds the factory defect mark.         */
+#define  FS_BENCH_NAND_BAD_BLK_CNT                         4u   /* Factory bad blks.                                    */
+#define  FS_BENCH_NAND_FAIL_RATE_PPM                       0u   /* Dflt grown bad blk probability per pgm/erase.        */
+
+                                                                /* --------------------- WORKLOADS -------------------- */
+#define  FS_BENCH_CHUNK_SIZE                             512u   /* Size of each append/rd.                              */
+#define  FS_BENCH_SEQ_SIZE                      (1024u * 1024u)
+#define  FS_BENCH_RD_CNT                                2000u
+#define  FS_BENCH_SEEK_CNT                              2000u
+#define  FS_BENCH_SEEK_RD_SIZE                            16u
+#define  FS_BENCH_SMALL_FILE_CNT                         200u
+#define  FS_BENCH_SMALL_FILE_SIZE                        128u
+#define  FS_BENCH_PWR_LOSS_TRIAL_CNT                      20u
+#define  FS_BENCH_PWR_LOSS_OP_MAX                        400u   /* Pwr is lost within this many pgm/erase ops.          */
+#define  FS_BENCH_PWR_LOSS_ITER_MAX                     2000u
+#define  FS_BENCH_PWR_LOSS_LOG_MAX               (64u * 1024u)  /* Log is restarted when it grows past this.            */
+#define  FS_BENCH_PWR_LOSS_LOG_FILL                     0x5Au   /* Octet the log is filled with.                        */
+#define  FS_BENCH_PWR_LOSS_TMP_FILL                     0xA5u   /* Octet the temp file is filled with.                  */
+
+#define  FS_BENCH_QUICK_DIV                                4u
+
+#define  FS_BENCH_NAME_LEN_MAX                            64u
+#define  FS_BENCH_CACHE_PCT_MGMT                          10u
+#define  FS_BENCH_CACHE_PCT_DIR                           10u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       BENCHMARK DEVICE DATA TYPE
+*
+* Note(s) : (1) The driver's sector counters restart at every device open; counts from previous opens
+*               are kept here so that a workload which re-opens the device (power loss) is measured
+*               in full.
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_bench_dev {
+    const  CPU_CHAR     *Name;                                  /* Short name, as reported.                             */
+           CPU_CHAR     *DevName;                               /* Dev & vol name.                                      */
+           FS_BENCH_FLASH  *FlashPtr;                           /* Simulated flash (DEF_NULL for RAM disk).             */
+           void         *CfgPtr;                                /* Dev cfg passed to FSDev_Open().                      */
+           CPU_BOOLEAN   En;
+           CPU_BOOLEAN   Open;
+           FS_CTR        RdSecBase;                             /* Secs rd  in previous opens (see Note #1).            */
+           FS_CTR        WrSecBase;                             /* Secs wr  in previous opens (see Note #1).            */
+} FS_BENCH_DEV;
+
+
+typedef  struct  fs_bench_run {
+    FS_BENCH_DEV        *DevPtr;
+    const  CPU_CHAR     *Workload;
+
+    double              *HostLatTbl;                            /* Host latency per op (us).                            */
+    double              *SimLatTbl;                             /* Simulated dev latency per op (us).                   */
+    CPU_INT32U           OpCnt;
+    CPU_INT32U           OpCntMax;
+    CPU_INT64U           OctetsRd;                              /* App octets rd.                                       */
+    CPU_INT64U           OctetsWr;                              /* App octets wr.                                       */
+    FS_ERR               Err;                                   /* Err that stopped the workload, if any.               */
+
+    struct  timespec     Start;
+    struct  timespec     OpStart;
+    CPU_INT64U           OpSimStart_ns;
+    FS_CTR               DevRdSecStart;
+    FS_CTR               DevWrSecStart;
+    FS_BENCH_FLASH_STAT  FlashStart;
+} FS_BENCH_RUN;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  const  FS_CFG  FSBench_Cfg = {
+    3u,                             /* DevCnt           */
+    3u,                             /* VolCnt           */
+    4u,                             /* FileCnt          */
+    2u,                             /* DirCnt           */
+    24u,                            /* BufCnt           */
+    3u,                             /* DevDrvCnt        */
+    2048u                           /* MaxSecSize       */
+};
+
+static  const  FS_BENCH_FLASH_LAT  FSBench_NOR_Lat = {         /* Serial NOR, 256-B pg, 64-KiB sector.                 */
+           0u,                      /* RdSetup_ns       */
+          20u,                      /* RdOctet_ns       */
+      700000u,                      /* PgmSetup_ns      */
+          20u,                      /* PgmOctet_ns      */
+   400000000u                       /* Erase_ns         */
+};
+
+#ifdef   FS_BENCH_NAND_EN
+static  const  FS_BENCH_FLASH_LAT  FSBench_NAND_Lat = {        /* SLC NAND, 2-KiB pg, 128-KiB blk.                     */
+       25000u,                      /* RdSetup_ns       */
+          25u,                      /* RdOctet_ns       */
+      250000u,                      /* PgmSetup_ns      */
+          25u,                      /* PgmOctet_ns      */
+     2000000u                       /* Erase_ns         */
+};
+#endif
+
+static  FS_DEV_RAM_CFG       FSBench_RAM_Cfg;
+static  FS_DEV_NOR_CFG       FSBench_NOR_Cfg;
+#ifdef   FS_BENCH_NAND_EN
+static  FS_NAND_CFG                     FSBench_NAND_Cfg;
+static  FS_NAND_CTRLR_GEN_CFG           FSBench_NAND_CtrlrCfg;
+static  FS_NAND_CTRLR_GEN_SOFT_ECC_CFG  FSBench_NAND_SoftECC_Cfg;
+static  FS_NAND_PART_STATIC_CFG         FSBench_NAND_PartCfg;
+
+static  const  FS_NAND_FREE_SPARE_DATA  FSBench_NAND_FreeSpareMap[] = {{ FS_BENCH_NAND_SPARE_FREE_START, FS_BENCH_NAND_SPARE_SIZE - FS_BENCH_NAND_SPARE_FREE_START},
+                                                                       {            (FS_NAND_PG_SIZE)-1,                                     (FS_NAND_PG_SIZE)-1}};
+#endif
+
+static  FS_BENCH_DEV  FSBench_DevTbl[] = {
+    { "ram",  "ram:0:",  DEF_NULL,            &FSBench_RAM_Cfg,  DEF_YES, DEF_NO, 0u, 0u },
+    { "nor",  "nor:0:",  &FSBench_NOR_Flash,  &FSBench_NOR_Cfg,  DEF_YES, DEF_NO, 0u, 0u },
+#ifdef   FS_BENCH_NAND_EN
+    { "nand", "nand:0:", &FSBench_NAND_Flash, &FSBench_NAND_Cfg, DEF_YES, DEF_NO, 0u, 0u },
+#endif
+};
+
+static  CPU_BOOLEAN   FSBench_Quick      = DEF_NO;
+static  CPU_INT32U    FSBench_Seed       = 1u;
+static  CPU_INT32U    FSBench_FailRate   = FS_BENCH_NAND_FAIL_RATE_PPM;
+static  CPU_INT32U    FSBench_CacheSize  = 0u;
+static  CPU_INT08U    FSBench_CacheMode  = FS_VOL_CACHE_MODE_WR_BACK;
+static  CPU_INT32U    FSBench_FileBufSize = 0u;
+static  void         *FSBench_FileBufPtr = DEF_NULL;
+static  CPU_BOOLEAN   FSBench_First      = DEF_YES;
+
+static  CPU_INT08U    FSBench_Buf[FS_BENCH_CHUNK_SIZE];
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U   FSBench_Rand        (void);
+
+static  CPU_INT32U   FSBench_Scale       (CPU_INT32U       val);
+
+static  void         FSBench_PathFmt     (CPU_CHAR        *p_path,
+                                          FS_BENCH_DEV    *p_dev,
+                                          const  CPU_CHAR *p_name);
+
+static  void         FSBench_DevStatGet  (FS_BENCH_DEV    *p_dev,
+                                          FS_CTR          *p_rd_secs,
+                                          FS_CTR          *p_wr_secs);
+
+static  CPU_BOOLEAN  FSBench_DevOpen     (FS_BENCH_DEV    *p_dev,
+                                          CPU_BOOLEAN      fmt);
+
+static  void         FSBench_DevClose    (FS_BENCH_DEV    *p_dev);
+
+static  FS_FILE     *FSBench_FileOpen    (CPU_CHAR        *p_path,
+                                          FS_FLAGS         mode,
+                                          FS_ERR          *p_err);
+
+static  void         FSBench_RunStart    (FS_BENCH_RUN    *p_run,
+                                          FS_BENCH_DEV    *p_dev,
+                                          const  CPU_CHAR *p_workload,
+                                          CPU_INT32U       op_cnt_max);
+
+static  void         FSBench_OpStart     (FS_BENCH_RUN    *p_run);
+
+static  void         FSBench_OpEnd       (FS_BENCH_RUN    *p_run);
+
+static  void         FSBench_RunEnd      (FS_BENCH_RUN    *p_run,
+                                          const  CPU_CHAR *p_extra);
+
+static  void         FSBench_LatPrint    (const  CPU_CHAR *p_name,
+                                          double          *p_tbl,
+                                          CPU_INT32U       cnt);
+
+static  void         FSBench_SeqAppend   (FS_BENCH_DEV    *p_dev);
+
+static  void         FSBench_RandRd      (FS_BENCH_DEV    *p_dev);
+
+static  void         FSBench_Seek        (FS_BENCH_DEV    *p_dev);
+
+static  void         FSBench_Small       (FS_BENCH_DEV    *p_dev);
+
+static  void         FSBench_PwrLoss     (FS_BENCH_DEV    *p_dev);
+
+static  CPU_BOOLEAN  FSBench_FileChk     (CPU_CHAR        *p_path,
+                                          CPU_INT08U       fill,
+                                          FS_FILE_SIZE    *p_size);
+
+static  CPU_BOOLEAN  FSBench_TreeSecCnt  (CPU_CHAR        *p_path,
+                                          FS_SEC_SIZE      sec_size,
+                                          FS_SEC_QTY      *p_sec_cnt);
+
+static  CPU_BOOLEAN  FSBench_ClusChk     (FS_BENCH_DEV    *p_dev,
+                                          CPU_BOOLEAN      base,
+                                          FS_SEC_QTY      *p_dir_sec_cnt);
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Parse arguments, initialize uC/FS & run every workload on every enabled device.
+*
+* Argument(s) : argc        Number of arguments.
+*
+*               argv        Arguments (see 'fs_bench.c  Note #4').
+*
+* Return(s)   : 0, if every device could be opened.
+*               1, if a device could not be opened.
+*               2, on usage error.
+*
+* Caller(s)   : Host C runtime.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    FS_BENCH_DEV  *p_dev;
+    CPU_INT32U     dev_ix;
+    int            arg_ix;
+    int            rtn;
+    FS_ERR         err;
+
+
+    for (arg_ix = 1; arg_ix < argc; arg_ix++) {
+        if (strcmp(argv[arg_ix], "-q") == 0) {
+            FSBench_Quick = DEF_YES;
+        } else if ((strcmp(argv[arg_ix], "-s") == 0) && (arg_ix + 1 < argc)) {
+            FSBench_Seed = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-f") == 0) && (arg_ix + 1 < argc)) {
+            FSBench_FailRate = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-c") == 0) && (arg_ix + 1 < argc)) {
+            FSBench_CacheSize = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-b") == 0) && (arg_ix + 1 < argc)) {
+            FSBench_FileBufSize = (CPU_INT32U)strtoul(argv[++arg_ix], DEF_NULL, 0);
+        } else if ((strcmp(argv[arg_ix], "-m") == 0) && (arg_ix + 1 < argc)) {
+            arg_ix++;
+            if (strcmp(argv[arg_ix], "rd") == 0) {
+                FSBench_CacheMode = FS_VOL_CACHE_MODE_RD;
+            } else if (strcmp(argv[arg_ix], "wt") == 0) {
+                FSBench_CacheMode = FS_VOL_CACHE_MODE_WR_THROUGH;
+            } else {
+                FSBench_CacheMode = FS_VOL_CACHE_MODE_WR_BACK;
+            }
+        } else if ((strcmp(argv[arg_ix], "-d") == 0) && (arg_ix + 1 < argc)) {
+            arg_ix++;
+            for (dev_ix = 0u; dev_ix < sizeof(FSBench_DevTbl) / sizeof(FSBench_DevTbl[0]); dev_ix++) {
+                p_dev     = &FSBench_DevTbl[dev_ix];
+                p_dev->En = (strstr(argv[arg_ix], p_dev->Name) != DEF_NULL) ? DEF_YES : DEF_NO;
+            }
+        } else {
+            fprintf(stderr, "usage: %s [-q] [-s <seed>] [-d ram,nor,nand] [-f <ppm>] [-c <cache octets>] [-m rd|wt|wb] [-b <file buf octets>]\n", argv[0]);
+            return (2);
+        }
+    }
+    if (FSBench_Seed == 0u) {
+        FSBench_Seed = 1u;
+    }
+
+                                                                /* ----------------------- INIT ----------------------- */
+    CPU_Init();
+    Mem_Init();
+
+    err = FS_Init((FS_CFG *)&FSBench_Cfg);
+    if (err != FS_ERR_NONE) {
+        fprintf(stderr, "fs_bench: FS_Init() failed w/err = %d\n", (int)err);
+        return (1);
+    }
+
+    if (FSBench_FileBufSize > 0u) {
+        FSBench_FileBufPtr = malloc(FSBench_FileBufSize);
+    }
+
+    FSBench_RAM_Cfg.SecSize = FS_BENCH_RAM_SEC_SIZE;
+    FSBench_RAM_Cfg.Size    = FS_BENCH_RAM_SEC_CNT;
+    FSBench_RAM_Cfg.DiskPtr = calloc(FS_BENCH_RAM_SEC_CNT, FS_BENCH_RAM_SEC_SIZE);
+
+    FSBench_FlashInit(&FSBench_NOR_Flash,
+                       FS_BENCH_NOR_BLK_CNT,
+                       FS_BENCH_NOR_PG_PER_BLK,
+                       FS_BENCH_NOR_PG_SIZE,
+                       0u,
+                      &FSBench_NOR_Lat,
+                      &err);
+    if ((err != FS_ERR_NONE) || (FSBench_RAM_Cfg.DiskPtr == DEF_NULL)) {
+        fprintf(stderr, "fs_bench: could not allocate disk images\n");
+        return (1);
+    }
+
+    FSBench_NOR_Cfg.AddrBase       = 0u;
+    FSBench_NOR_Cfg.RegionNbr      = 0u;
+    FSBench_NOR_Cfg.AddrStart      = 0u;
+    FSBench_NOR_Cfg.DevSize        = FS_BENCH_NOR_BLK_CNT * FS_BENCH_NOR_PG_PER_BLK * FS_BENCH_NOR_PG_SIZE;
+    FSBench_NOR_Cfg.SecSize        = FS_BENCH_NOR_SEC_SIZE;
+    FSBench_NOR_Cfg.PctRsvd        = FS_DEV_NOR_PCT_RSVD_DFLT;
+    FSBench_NOR_Cfg.EraseCntDiffTh = FS_DEV_NOR_ERASE_CNT_DIFF_TH_DFLT;
+    FSBench_NOR_Cfg.PhyPtr         = (FS_DEV_NOR_PHY_API *)&FSDev_NOR_Sim;
+    FSBench_NOR_Cfg.BusWidth       = 8u;
+    FSBench_NOR_Cfg.BusWidthMax    = 8u;
+    FSBench_NOR_Cfg.PhyDevCnt      = 1u;
+    FSBench_NOR_Cfg.MaxClkFreq     = 50000000u;
+
+    FS_DevDrvAdd((FS_DEV_API *)&FSDev_RAM, &err);
+    FS_DevDrvAdd((FS_DEV_API *)&FSDev_NOR, &err);
+
+#ifdef   FS_BENCH_NAND_EN
+    FSBench_FlashInit(&FSBench_NAND_Flash,
+                       FS_BENCH_NAND_BLK_CNT,
+                       FS_BENCH_NAND_PG_PER_BLK,
+                       FS_BENCH_NAND_PG_SIZE,
+                       FS_BENCH_NAND_SPARE_SIZE,
+                      &FSBench_NAND_Lat,
+                      &err);
+    if (err != FS_ERR_NONE) {
+        fprintf(stderr, "fs_bench: could not allocate NAND image\n");
+        return (1);
+    }
+    FSBench_FlashBadBlkSet(&FSBench_NAND_Flash,
+                            FS_BENCH_NAND_BAD_BLK_CNT,
+                            FSBench_FailRate,
+                            FSBench_Seed);
+
+    FSBench_NAND_Cfg                       = FS_NAND_DfltCfg;
+    FSBench_NAND_CtrlrCfg                  = FS_NAND_CtrlrGen_DfltCfg;
+    FSBench_NAND_SoftECC_Cfg               = FS_NAND_CtrlrGen_SoftECC_DfltCfg;
+    FSBench_NAND_PartCfg                   = FS_NAND_PartStatic_DfltCfg;
+
+    FSBench_NAND_Cfg.BSPPtr                = (void *)&FS_NAND_BSP_Sim;
+    FSBench_NAND_Cfg.CtrlrPtr              = (FS_NAND_CTRLR_API *)&FS_NAND_CtrlrGen;
+    FSBench_NAND_Cfg.CtrlrCfgPtr           = &FSBench_NAND_CtrlrCfg;
+    FSBench_NAND_Cfg.PartPtr               = (FS_NAND_PART_API *)&FS_NAND_PartStatic;
+    FSBench_NAND_Cfg.PartCfgPtr            = &FSBench_NAND_PartCfg;
+
+    FSBench_NAND_CtrlrCfg.CtrlrExt         = &FS_NAND_CtrlrGen_SoftECC;
+    FSBench_NAND_CtrlrCfg.CtrlrExtCfg      = &FSBench_NAND_SoftECC_Cfg;
+    FSBench_NAND_SoftECC_Cfg.ECC_ModulePtr = &Hamming_ECC;
+
+    FSBench_NAND_PartCfg.BlkCnt            = FS_BENCH_NAND_BLK_CNT;
+    FSBench_NAND_PartCfg.PgPerBlk          = FS_BENCH_NAND_PG_PER_BLK;
+    FSBench_NAND_PartCfg.PgSize            = FS_BENCH_NAND_PG_SIZE;
+    FSBench_NAND_PartCfg.SpareSize         = FS_BENCH_NAND_SPARE_SIZE;
+    FSBench_NAND_PartCfg.NbrPgmPerPg       = 1u;
+    FSBench_NAND_PartCfg.BusWidth          = 8u;
+    FSBench_NAND_PartCfg.ECC_CodewordSize  = FS_BENCH_NAND_ECC_CODEWORD_SIZE;
+    FSBench_NAND_PartCfg.ECC_NbrCorrBits   = 1u;
+    FSBench_NAND_PartCfg.MaxBadBlkCnt      = FS_BENCH_NAND_BLK_CNT / 50u;
+    FSBench_NAND_PartCfg.MaxBlkErase       = 100000u;
+    FSBench_NAND_PartCfg.FreeSpareMap      = (FS_NAND_FREE_SPARE_DATA *)FSBench_NAND_FreeSpareMap;
+
+    FS_DevDrvAdd((FS_DEV_API *)&FS_NAND, &err);
+#endif
+
+                                                                /* ----------------------- RUN ------------------------ */
+    printf("{\n  \"bench\": \"uc-fs\",\n  \"quick\": %s,\n  \"seed\": %u,\n  \"nand_fail_ppm\": %u,\n"
+           "  \"cache_octets\": %u,\n  \"cache_mode\": \"%s\",\n  \"file_buf_octets\": %u,\n"
+           "  \"results\": [",
+           (FSBench_Quick == DEF_YES) ? "true" : "false",
+           (unsigned)FSBench_Seed,
+           (unsigned)FSBench_FailRate,
+           (unsigned)FSBench_CacheSize,
+           (FSBench_CacheMode == FS_VOL_CACHE_MODE_RD)         ? "rd" :
+           (FSBench_CacheMode == FS_VOL_CACHE_MODE_WR_THROUGH) ? "wt" : "wb",
+           (unsigned)FSBench_FileBufSize);
+
+    rtn = 0;
+    for (dev_ix = 0u; dev_ix < sizeof(FSBench_DevTbl) / sizeof(FSBench_DevTbl[0]); dev_ix++) {
+        p_dev = &FSBench_DevTbl[dev_ix];
+        if (p_dev->En == DEF_NO) {
+            continue;
+        }
+
+        if (FSBench_DevOpen(p_dev, DEF_YES) == DEF_FAIL) {
+            fprintf(stderr, "fs_bench: could not open %s\n", p_dev->DevName);
+            rtn = 1;
+            continue;
+        }
+
+        FSBench_SeqAppend(p_dev);
+        FSBench_RandRd(p_dev);
+        FSBench_Seek(p_dev);
+        FSBench_Small(p_dev);
+        if (p_dev->FlashPtr != DEF_NULL) {
+            FSBench_PwrLoss(p_dev);
+        }
+
+        FSBench_DevClose(p_dev);
+    }
+
+    printf("\n  ]\n}\n");
+
+    return (rtn);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Clk_ExtTS_Init()
+*                                           Clk_ExtTS_Get()
+*                                           Clk_ExtTS_Set()
+*
+* Description : External timestamp for the Clock module (see 'clk_cfg.h  CLK CONFIGURATION  Note #1').
+*
+* Argument(s) : ts_sec      Timestamp to set (ignored).
+*
+* Return(s)   : Clk_ExtTS_Get() returns the host time as a Clock timestamp.
+*               Clk_ExtTS_Set() returns DEF_FAIL (host time is not set).
+*
+* Caller(s)   : Clock module.
+*
+* Note(s)     : (1) The Clock epoch starts in 2000, the Unix epoch in 1970.
+*********************************************************************************************************
+*/
+
+void  Clk_ExtTS_Init (void)
+{
+
+}
+
+
+CLK_TS_SEC  Clk_ExtTS_Get (void)
+{
+    time_t  now;
+
+
+    now = time(DEF_NULL);
+    return ((CLK_TS_SEC)(now - CLK_UNIX_EPOCH_OFFSET_SEC));     /* See Note #1.                                         */
+}
+
+
+CPU_BOOLEAN  Clk_ExtTS_Set (CLK_TS_SEC  ts_sec)
+{
+    (void)ts_sec;
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FS_BSP_Dly_ms()
+*
+* Description : Delay for specified time, in milliseconds (see 'fs.h  FS_BSP_Dly_ms()').
+*
+* Argument(s) : ms          Time delay value, in milliseconds (ignored).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_OS_Dly_ms().
+*
+* Note(s)     : (1) Returns at once : the simulated devices are never busy on the host, & their busy time
+*                   is accounted separately (see 'fs_bench_flash.h  Note #2b').
+*********************************************************************************************************
+*/
+
+void  FS_BSP_Dly_ms (CPU_INT16U  ms)
+{
+    (void)ms;                                                   /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           FSBench_Rand()
+*
+* Description : Get next pseudo-random number (xorshift32) for the workloads.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Pseudo-random number.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  FSBench_Rand (void)
+{
+    CPU_INT32U  x;
+
+
+    x  = FSBench_Seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x <<  5;
+    FSBench_Seed = x;
+
+    return (x);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           FSBench_Scale()
+*
+* Description : Scale a workload size down for a quick run.
+*
+* Argument(s) : val         Default size.
+*
+* Return(s)   : Size to use.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  FSBench_Scale (CPU_INT32U  val)
+{
+    if (FSBench_Quick == DEF_YES) {
+        val /= FS_BENCH_QUICK_DIV;
+    }
+
+    return (val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_PathFmt()
+*
+* Description : Form the full path of a file on a device.
+*
+* Argument(s) : p_path      Buffer that will receive the path (FS_BENCH_NAME_LEN_MAX octets).
+*
+*               p_dev       Pointer to device.
+*
+*               p_name      Path on the volume (e.g. "\\seq.bin").
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_PathFmt (CPU_CHAR         *p_path,
+                               FS_BENCH_DEV     *p_dev,
+                               const  CPU_CHAR  *p_name)
+{
+    snprintf(p_path, FS_BENCH_NAME_LEN_MAX, "%s%s", p_dev->DevName, p_name);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSBench_DevStatGet()
+*
+* Description : Get the number of sectors read & written through a device driver since start-up.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+*               p_rd_secs   Pointer to variable that will receive the number of sectors read.
+*
+*               p_wr_secs   Pointer to variable that will receive the number of sectors written.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSBench_DevClose(),
+*               FSBench_RunStart(),
+*               FSBench_RunEnd().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_DevStatGet (FS_BENCH_DEV  *p_dev,
+                                  FS_CTR        *p_rd_secs,
+                                  FS_CTR        *p_wr_secs)
+{
+    FS_DEV  *p_fs_dev;
+
+
+   *p_rd_secs = p_dev->RdSecBase;
+   *p_wr_secs = p_dev->WrSecBase;
+
+    if (p_dev->Open == DEF_NO) {
+        return;
+    }
+
+    p_fs_dev = FSDev_Acquire(p_dev->DevName);
+    if (p_fs_dev == DEF_NULL) {
+        return;
+    }
+
+   *p_rd_secs += p_fs_dev->StatRdSecCtr;
+   *p_wr_secs += p_fs_dev->StatWrSecCtr;
+
+    FSDev_Release(p_fs_dev);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_DevOpen()
+*
+* Description : Open a device & its volume, formatting them if needed.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+*               fmt         DEF_YES, to (low-level) format the device if needed.
+*                           DEF_NO,  to only mount it (after a power loss).
+*
+* Return(s)   : DEF_OK,   if the volume is mounted.
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : main(),
+*               FSBench_PwrLoss().
+*
+* Note(s)     : (1) Same sequence as the application template ('fs_app.c').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  FSBench_DevOpen (FS_BENCH_DEV  *p_dev,
+                                      CPU_BOOLEAN    fmt)
+{
+    void    *p_cache;
+    FS_ERR   err;
+
+
+    FSDev_Open(p_dev->DevName, p_dev->CfgPtr, &err);            /* See Note #1.                                         */
+    if ((err == FS_ERR_DEV_INVALID_LOW_FMT) &&
+        (fmt == DEF_YES)) {
+        if (p_dev->FlashPtr == &FSBench_NOR_Flash) {
+            FSDev_NOR_LowFmt(p_dev->DevName, &err);
+#ifdef   FS_BENCH_NAND_EN
+        } else {
+            FS_NAND_LowFmt(p_dev->DevName, &err);
+#endif
+        }
+    }
+    if (err != FS_ERR_NONE) {
+        FSDev_Close(p_dev->DevName, &err);
+        return (DEF_FAIL);
+    }
+
+    FSVol_Open(p_dev->DevName, p_dev->DevName, 0u, &err);
+    if ((err == FS_ERR_PARTITION_NOT_FOUND) &&
+        (fmt == DEF_YES)) {
+        FSVol_Fmt(p_dev->DevName, DEF_NULL, &err);
+    }
+    if (err != FS_ERR_NONE) {
+        FSVol_Close(p_dev->DevName, &err);
+        FSDev_Close(p_dev->DevName, &err);
+        return (DEF_FAIL);
+    }
+
+    if (FSBench_CacheSize > 0u) {
+        p_cache = malloc(FSBench_CacheSize);
+        FSVol_CacheAssign(p_dev->DevName,
+                          (FS_VOL_CACHE_API *)&FSCache_Dflt,
+                          p_cache,
+                          FSBench_CacheSize,
+                          FS_BENCH_CACHE_PCT_MGMT,
+                          FS_BENCH_CACHE_PCT_DIR,
+                          FSBench_CacheMode,
+                         &err);
+        if (err != FS_ERR_NONE) {
+            fprintf(stderr, "fs_bench: could not assign cache to %s w/err = %d\n", p_dev->DevName, (int)err);
+        }
+    }
+
+    p_dev->Open = DEF_YES;
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_DevClose()
+*
+* Description : Close a volume & its device.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main(),
+*               FSBench_PwrLoss().
+*
+* Note(s)     : (1) Errors are ignored : after a power loss, nothing is written back.  The cache
+*                   memory is leaked, which does not matter for a benchmark.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_DevClose (FS_BENCH_DEV  *p_dev)
+{
+    FS_ERR  err;
+
+
+    FSBench_DevStatGet(p_dev, &p_dev->RdSecBase, &p_dev->WrSecBase);
+
+    FSVol_Close(p_dev->DevName, &err);                          /* See Note #1.                                         */
+    FSDev_Close(p_dev->DevName, &err);
+    p_dev->Open = DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_FileOpen()
+*
+* Description : Open a file & assign the benchmark file buffer to it, if any.
+*
+* Argument(s) : p_path      Full path of file.
+*
+*               mode        Access mode.
+*
+*               p_err       Pointer to variable that will receive the return error code from FSFile_Open().
+*
+* Return(s)   : Pointer to file, if opened.
+*               Pointer to NULL, otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  FS_FILE  *FSBench_FileOpen (CPU_CHAR  *p_path,
+                                    FS_FLAGS   mode,
+                                    FS_ERR    *p_err)
+{
+    FS_FILE  *p_file;
+    FS_ERR    err;
+
+
+    p_file = FSFile_Open(p_path, mode, p_err);
+    if ((p_file             != DEF_NULL) &&
+        (FSBench_FileBufPtr != DEF_NULL)) {
+        FSFile_BufAssign(p_file, FSBench_FileBufPtr, FS_FILE_BUF_MODE_RD_WR, FSBench_FileBufSize, &err);
+    }
+
+    return (p_file);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_RunStart()
+*
+* Description : Start measuring a workload.
+*
+* Argument(s) : p_run           Pointer to run to start.
+*
+*               p_dev           Pointer to device.
+*
+*               p_workload      Name of workload.
+*
+*               op_cnt_max      Maximum number of operations that will be timed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_RunStart (FS_BENCH_RUN     *p_run,
+                                FS_BENCH_DEV     *p_dev,
+                                const  CPU_CHAR  *p_workload,
+                                CPU_INT32U        op_cnt_max)
+{
+    Mem_Clr((void *)p_run, sizeof(FS_BENCH_RUN));
+
+    p_run->DevPtr     = p_dev;
+    p_run->Workload   = p_workload;
+    p_run->OpCntMax   = op_cnt_max;
+    p_run->HostLatTbl = (double *)calloc(op_cnt_max + 1u, sizeof(double));
+    p_run->SimLatTbl  = (double *)calloc(op_cnt_max + 1u, sizeof(double));
+
+    FSBench_DevStatGet(p_dev, &p_run->DevRdSecStart, &p_run->DevWrSecStart);
+    if (p_dev->FlashPtr != DEF_NULL) {
+        p_run->FlashStart = p_dev->FlashPtr->Stat;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &p_run->Start);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_OpStart()
+*                                          FSBench_OpEnd()
+*
+* Description : Time one operation of a workload.
+*
+* Argument(s) : p_run       Pointer to run.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_OpStart (FS_BENCH_RUN  *p_run)
+{
+    if (p_run->DevPtr->FlashPtr != DEF_NULL) {
+        p_run->OpSimStart_ns = p_run->DevPtr->FlashPtr->Stat.Time_ns;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &p_run->OpStart);
+}
+
+
+static  void  FSBench_OpEnd (FS_BENCH_RUN  *p_run)
+{
+    struct  timespec  now;
+    double            host_us;
+    double            sim_us;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    host_us = ((double)(now.tv_sec  - p_run->OpStart.tv_sec) * 1e6)
+            + ((double)(now.tv_nsec - p_run->OpStart.tv_nsec) / 1e3);
+
+    sim_us = 0.0;
+    if (p_run->DevPtr->FlashPtr != DEF_NULL) {
+        sim_us = (double)(p_run->DevPtr->FlashPtr->Stat.Time_ns - p_run->OpSimStart_ns) / 1e3;
+    }
+
+    if (p_run->OpCnt < p_run->OpCntMax) {
+        p_run->HostLatTbl[p_run->OpCnt] = host_us;
+        p_run->SimLatTbl[p_run->OpCnt]  = sim_us;
+        p_run->OpCnt++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           FSBench_RunEnd()
+*
+* Description : Stop measuring a workload & print its JSON result.
+*
+* Argument(s) : p_run       Pointer to run.
+*
+*               p_extra     Extra JSON members to append (without leading comma), or DEF_NULL.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Workloads.
+*
+* Note(s)     : (1) 'wr_amp' is the number of octets written to the device (in sectors, through the
+*                   device driver) per octet written by the application; 'flash_wr_amp' the number of
+*                   octets programmed into the flash per octet written by the application.  Both are
+*                   only reported for workloads that write file data.
+*
+*               (2) A workload stops at its first error; 'err' then holds the error code ('fs_err.h').
+*********************************************************************************************************
+*/
+
+static  void  FSBench_RunEnd (FS_BENCH_RUN     *p_run,
+                              const  CPU_CHAR  *p_extra)
+{
+    struct  timespec      now;
+    FS_BENCH_DEV         *p_dev;
+    FS_BENCH_FLASH_STAT  *p_stat;
+    FS_BENCH_FLASH_STAT   stat;
+    FS_CTR                rd_secs;
+    FS_CTR                wr_secs;
+    FS_SEC_SIZE           sec_size;
+    CPU_INT32U            erase_cnt_min;
+    CPU_INT32U            erase_cnt_max;
+    double                host_s;
+    double                sim_s;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    host_s = (double)(now.tv_sec  - p_run->Start.tv_sec)
+           + ((double)(now.tv_nsec - p_run->Start.tv_nsec) / 1e9);
+
+    p_dev = p_run->DevPtr;
+    FSBench_DevStatGet(p_dev, &rd_secs, &wr_secs);
+    rd_secs -= p_run->DevRdSecStart;
+    wr_secs -= p_run->DevWrSecStart;
+
+    sec_size = FS_BENCH_RAM_SEC_SIZE;
+    if (p_dev->FlashPtr == &FSBench_NOR_Flash) {
+        sec_size = FS_BENCH_NOR_SEC_SIZE;
+#ifdef   FS_BENCH_NAND_EN
+    } else if (p_dev->FlashPtr == &FSBench_NAND_Flash) {
+        sec_size = FS_BENCH_NAND_PG_SIZE;
+#endif
+    }
+
+    printf("%s\n    {\"dev\": \"%s\", \"workload\": \"%s\", \"ops\": %u, \"octets_rd\": %llu, \"octets_wr\": %llu,\n"
+           "     \"host_s\": %.6f, \"ops_per_s\": %.1f, \"dev_rd_secs\": %u, \"dev_wr_secs\": %u",
+           (FSBench_First == DEF_YES) ? "" : ",",
+           p_dev->Name,
+           p_run->Workload,
+           (unsigned)p_run->OpCnt,
+           (unsigned long long)p_run->OctetsRd,
+           (unsigned long long)p_run->OctetsWr,
+           host_s,
+           (host_s > 0.0) ? ((double)p_run->OpCnt / host_s) : 0.0,
+           (unsigned)rd_secs,
+           (unsigned)wr_secs);
+    FSBench_First = DEF_NO;
+
+    if (p_run->Err != FS_ERR_NONE) {                            /* See Note #2.                                         */
+        printf(", \"err\": %d", (int)p_run->Err);
+    }
+
+    if (p_run->OctetsWr > 0u) {                                 /* See Note #1.                                         */
+        printf(", \"wr_amp\": %.3f", ((double)wr_secs * sec_size) / (double)p_run->OctetsWr);
+    }
+
+    if (p_dev->FlashPtr != DEF_NULL) {
+        p_stat = &p_dev->FlashPtr->Stat;
+        stat.RdOpCtr        = p_stat->RdOpCtr        - p_run->FlashStart.RdOpCtr;
+        stat.PgmOpCtr       = p_stat->PgmOpCtr       - p_run->FlashStart.PgmOpCtr;
+        stat.PgmOctetCtr    = p_stat->PgmOctetCtr    - p_run->FlashStart.PgmOctetCtr;
+        stat.EraseCtr       = p_stat->EraseCtr       - p_run->FlashStart.EraseCtr;
+        stat.BadBlkGrownCtr = p_stat->BadBlkGrownCtr - p_run->FlashStart.BadBlkGrownCtr;
+        stat.Time_ns        = p_stat->Time_ns        - p_run->FlashStart.Time_ns;
+        sim_s               = (double)stat.Time_ns / 1e9;
+        FSBench_FlashEraseCntGet(p_dev->FlashPtr, &erase_cnt_min, &erase_cnt_max);
+
+        printf(",\n     \"sim_s\": %.6f, \"sim_ops_per_s\": %.1f,"
+               " \"flash\": {\"rd_ops\": %llu, \"pgm_ops\": %llu, \"pgm_octets\": %llu, \"erases\": %llu,"
+               " \"bad_blks_grown\": %u, \"erase_cnt_min\": %u, \"erase_cnt_max\": %u}",
+               sim_s,
+               (sim_s > 0.0) ? ((double)p_run->OpCnt / sim_s) : 0.0,
+               (unsigned long long)stat.RdOpCtr,
+               (unsigned long long)stat.PgmOpCtr,
+               (unsigned long long)stat.PgmOctetCtr,
+               (unsigned long long)stat.EraseCtr,
+               (unsigned)stat.BadBlkGrownCtr,
+               (unsigned)erase_cnt_min,
+               (unsigned)erase_cnt_max);
+        if (p_run->OctetsWr > 0u) {
+            printf(", \"flash_wr_amp\": %.3f", (double)stat.PgmOctetCtr / (double)p_run->OctetsWr);
+        }
+    }
+
+    printf(",\n     ");
+    FSBench_LatPrint("lat_us", p_run->HostLatTbl, p_run->OpCnt);
+    if (p_dev->FlashPtr != DEF_NULL) {
+        printf(", ");
+        FSBench_LatPrint("sim_lat_us", p_run->SimLatTbl, p_run->OpCnt);
+    }
+    if (p_extra != DEF_NULL) {
+        printf(",\n     %s", p_extra);
+    }
+    printf("}");
+    fflush(stdout);
+
+    free(p_run->HostLatTbl);
+    free(p_run->SimLatTbl);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_LatPrint()
+*
+* Description : Print latency percentiles as a JSON member.
+*
+* Argument(s) : p_name      Name of member.
+*
+*               p_tbl       Table of latencies (sorted in place).
+*
+*               cnt         Number of latencies.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSBench_RunEnd().
+*
+* Note(s)     : (1) Nearest-rank percentiles.
+*********************************************************************************************************
+*/
+
+static  int  FSBench_LatCmp (const  void  *p_a,
+                             const  void  *p_b)
+{
+    double  a;
+    double  b;
+
+
+    a = *(const double *)p_a;
+    b = *(const double *)p_b;
+    if (a < b) {
+        return (-1);
+    }
+    if (a > b) {
+        return (1);
+    }
+    return (0);
+}
+
+
+static  void  FSBench_LatPrint (const  CPU_CHAR  *p_name,
+                                double           *p_tbl,
+                                CPU_INT32U        cnt)
+{
+    if (cnt == 0u) {
+        printf("\"%s\": null", p_name);
+        return;
+    }
+
+    qsort(p_tbl, cnt, sizeof(double), FSBench_LatCmp);
+    printf("\"%s\": {\"p50\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"max\": %.2f}",   /* See Note #1.          */
+           p_name,
+           p_tbl[((cnt - 1u) * 50u) / 100u],
+           p_tbl[((cnt - 1u) * 90u) / 100u],
+           p_tbl[((cnt - 1u) * 99u) / 100u],
+           p_tbl[cnt - 1u]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FSBench_SeqAppend()
+*
+* Description : Sequential append workload.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) The file is left on the volume for the read & seek workloads.
+*
+*               (2) The volume cache, if any, is flushed inside the measurement so that write-back
+*                   caching is not credited with writes it merely deferred.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_SeqAppend (FS_BENCH_DEV  *p_dev)
+{
+    FS_BENCH_RUN   run;
+    CPU_CHAR       path[FS_BENCH_NAME_LEN_MAX];
+    FS_FILE       *p_file;
+    CPU_INT32U     op_cnt;
+    CPU_INT32U     op_ix;
+    CPU_SIZE_T     len;
+    FS_ERR         err;
+
+
+    op_cnt = FSBench_Scale(FS_BENCH_SEQ_SIZE) / FS_BENCH_CHUNK_SIZE;
+    FSBench_PathFmt(path, p_dev, "\\seq.bin");
+
+    FSBench_RunStart(&run, p_dev, "seq_append", op_cnt);
+    p_file = FSBench_FileOpen(path,
+                              FS_FILE_ACCESS_MODE_WR | FS_FILE_ACCESS_MODE_CREATE | FS_FILE_ACCESS_MODE_TRUNCATE | FS_FILE_ACCESS_MODE_APPEND,
+                             &err);
+    if (p_file == DEF_NULL) {
+        run.Err = err;
+        FSBench_RunEnd(&run, DEF_NULL);
+        return;
+    }
+
+    for (op_ix = 0u; op_ix < op_cnt; op_ix++) {
+        Mem_Set((void *)&FSBench_Buf[0], (CPU_INT08U)op_ix, FS_BENCH_CHUNK_SIZE);
+        FSBench_OpStart(&run);
+        len = FSFile_Wr(p_file, &FSBench_Buf[0], FS_BENCH_CHUNK_SIZE, &err);
+        FSBench_OpEnd(&run);
+        run.OctetsWr += len;
+        if (err != FS_ERR_NONE) {
+            run.Err = err;
+            break;
+        }
+    }
+
+    FSFile_Close(p_file, &err);
+    if (FSBench_CacheSize > 0u) {                               /* See Note #2.                                         */
+        FSVol_CacheFlush(p_dev->DevName, &err);
+    }
+    FSBench_RunEnd(&run, DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           FSBench_RandRd()
+*
+* Description : Random read workload.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) Reads are chunk-aligned within the file written by FSBench_SeqAppend().
+*********************************************************************************************************
+*/
+
+static  void  FSBench_RandRd (FS_BENCH_DEV  *p_dev)
+{
+    FS_BENCH_RUN   run;
+    CPU_CHAR       path[FS_BENCH_NAME_LEN_MAX];
+    FS_FILE       *p_file;
+    CPU_INT32U     chunk_cnt;
+    CPU_INT32U     op_cnt;
+    CPU_INT32U     op_ix;
+    CPU_SIZE_T     len;
+    FS_ERR         err;
+
+
+    chunk_cnt = FSBench_Scale(FS_BENCH_SEQ_SIZE) / FS_BENCH_CHUNK_SIZE;
+    op_cnt    = FSBench_Scale(FS_BENCH_RD_CNT);
+    FSBench_PathFmt(path, p_dev, "\\seq.bin");
+
+    FSBench_RunStart(&run, p_dev, "rand_read", op_cnt);
+    p_file = FSBench_FileOpen(path, FS_FILE_ACCESS_MODE_RD, &err);
+    if (p_file == DEF_NULL) {
+        run.Err = err;
+        FSBench_RunEnd(&run, DEF_NULL);
+        return;
+    }
+
+    for (op_ix = 0u; op_ix < op_cnt; op_ix++) {
+        FSBench_OpStart(&run);
+        FSFile_PosSet(p_file,
+                      (FS_FILE_OFFSET)(FSBench_Rand() % chunk_cnt) * FS_BENCH_CHUNK_SIZE,   /* See Note #1.         */
+                      FS_FILE_ORIGIN_START,
+                     &err);
+        len = FSFile_Rd(p_file, &FSBench_Buf[0], FS_BENCH_CHUNK_SIZE, &err);
+        FSBench_OpEnd(&run);
+        run.OctetsRd += len;
+        if (err != FS_ERR_NONE) {
+            run.Err = err;
+            break;
+        }
+    }
+
+    FSFile_Close(p_file, &err);
+    FSBench_RunEnd(&run, DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            FSBench_Seek()
+*
+* Description : Seek workload.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) A few octets are read after each seek, since a seek alone is lazy (the cluster chain
+*                   is only followed on the next access).
+*********************************************************************************************************
+*/
+
+static  void  FSBench_Seek (FS_BENCH_DEV  *p_dev)
+{
+    FS_BENCH_RUN   run;
+    CPU_CHAR       path[FS_BENCH_NAME_LEN_MAX];
+    FS_FILE       *p_file;
+    CPU_INT32U     size;
+    CPU_INT32U     op_cnt;
+    CPU_INT32U     op_ix;
+    CPU_SIZE_T     len;
+    FS_ERR         err;
+
+
+    size   = FSBench_Scale(FS_BENCH_SEQ_SIZE);
+    op_cnt = FSBench_Scale(FS_BENCH_SEEK_CNT);
+    FSBench_PathFmt(path, p_dev, "\\seq.bin");
+
+    FSBench_RunStart(&run, p_dev, "seek", op_cnt);
+    p_file = FSBench_FileOpen(path, FS_FILE_ACCESS_MODE_RD, &err);
+    if (p_file == DEF_NULL) {
+        run.Err = err;
+        FSBench_RunEnd(&run, DEF_NULL);
+        return;
+    }
+
+    for (op_ix = 0u; op_ix < op_cnt; op_ix++) {
+        FSBench_OpStart(&run);
+        FSFile_PosSet(p_file,
+                      (FS_FILE_OFFSET)(FSBench_Rand() % (size - FS_BENCH_SEEK_RD_SIZE)),
+                      FS_FILE_ORIGIN_START,
+                     &err);
+        len = FSFile_Rd(p_file, &FSBench_Buf[0], FS_BENCH_SEEK_RD_SIZE, &err);   /* See Note #1.                */
+        FSBench_OpEnd(&run);
+        run.OctetsRd += len;
+        if (err != FS_ERR_NONE) {
+            run.Err = err;
+            break;
+        }
+    }
+
+    FSFile_Close(p_file, &err);
+    FSBench_RunEnd(&run, DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           FSBench_Small()
+*
+* Description : Small-file create, open & delete workloads.
+*
+* Argument(s) : p_dev       Pointer to device.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) All files live in one directory, so that directory search cost grows with the
+*                   number of files (as on a data logger).
+*********************************************************************************************************
+*/
+
+static  void  FSBench_Small (FS_BENCH_DEV  *p_dev)
+{
+    FS_BENCH_RUN   run;
+    CPU_CHAR       path[FS_BENCH_NAME_LEN_MAX];
+    CPU_CHAR       name[FS_BENCH_NAME_LEN_MAX];
+    FS_FILE       *p_file;
+    CPU_INT32U     file_cnt;
+    CPU_INT32U     file_ix;
+    CPU_SIZE_T     len;
+    FS_ERR         err;
+
+
+    file_cnt = FSBench_Scale(FS_BENCH_SMALL_FILE_CNT);
+    FSBench_PathFmt(path, p_dev, "\\small");
+    FSEntry_Create(path, FS_ENTRY_TYPE_DIR, DEF_NO, &err);     /* See Note #1.                                         */
+
+                                                                /* ---------------------- CREATE ---------------------- */
+    FSBench_RunStart(&run, p_dev, "small_create", file_cnt);
+    for (file_ix = 0u; file_ix < file_cnt; file_ix++) {
+        snprintf(name, sizeof(name), "\\small\\f%05u.dat", (unsigned)file_ix);
+        FSBench_PathFmt(path, p_dev, name);
+        Mem_Set((void *)&FSBench_Buf[0], (CPU_INT08U)file_ix, FS_BENCH_SMALL_FILE_SIZE);
+
+        FSBench_OpStart(&run);
+        p_file = FSBench_FileOpen(path, FS_FILE_ACCESS_MODE_WR | FS_FILE_ACCESS_MODE_CREATE | FS_FILE_ACCESS_MODE_TRUNCATE, &err);
+        if (p_file == DEF_NULL) {
+            run.Err = err;
+            break;
+        }
+        len = FSFile_Wr(p_file, &FSBench_Buf[0], FS_BENCH_SMALL_FILE_SIZE, &err);
+        FSFile_Close(p_file, &err);
+        FSBench_OpEnd(&run);
+        run.OctetsWr += len;
+    }
+    if (FSBench_CacheSize > 0u) {
+        FSVol_CacheFlush(p_dev->DevName, &err);
+    }
+    FSBench_RunEnd(&run, DEF_NULL);
+
+                                                                /* ----------------------- OPEN ----------------------- */
+    FSBench_RunStart(&run, p_dev, "small_open", file_cnt);
+    for (file_ix = 0u; file_ix < file_cnt; file_ix++) {
+        snprintf(name, sizeof(name), "\\small\\f%05u.dat", (unsigned)file_ix);
+        FSBench_PathFmt(path, p_dev, name);
+
+        FSBench_OpStart(&run);
+        p_file = FSBench_FileOpen(path, FS_FILE_ACCESS_MODE_RD, &err);
+        if (p_file == DEF_NULL) {
+            run.Err = err;
+            break;
+        }
+        len = FSFile_Rd(p_file, &FSBench_Buf[0], FS_BENCH_SMALL_FILE_SIZE, &err);
+        FSFile_Close(p_file, &err);
+        FSBench_OpEnd(&run);
+        run.OctetsRd += len;
+    }
+    FSBench_RunEnd(&run, DEF_NULL);
+
+                                                                /* ---------------------- DELETE ---------------------- */
+    FSBench_RunStart(&run, p_dev, "small_del", file_cnt);
+    for (file_ix = 0u; file_ix < file_cnt; file_ix++) {
+        snprintf(name, sizeof(name), "\\small\\f%05u.dat", (unsigned)file_ix);
+        FSBench_PathFmt(path, p_dev, name);
+
+        FSBench_OpStart(&run);
+        FSEntry_Del(path, FS_ENTRY_TYPE_FILE, &err);
+        FSBench_OpEnd(&run);
+        if (err != FS_ERR_NONE) {
+            run.Err = err;
+            break;
+        }
+    }
+    if (FSBench_CacheSize > 0u) {
+        FSVol_CacheFlush(p_dev->DevName, &err);
+    }
+    FSBench_RunEnd(&run, DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_PwrLoss()
+*
+* Description : Power-loss & journal replay workload.
+*
+* Argument(s) : p_dev       Pointer to (flash) device.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : (1) Each trial :
+*
+*                   (a) arms a power loss at a random program/erase;
+*                   (b) appends to a log & creates/deletes a temp file until power is lost;
+*                   (c) drops every bit of file system state held in RAM by closing the volume & the
+*                       device (the writes they attempt are dropped, as the flash is unpowered);
+*                   (d) restores power, re-mounts & replays the journal -- the timed operation;
+*                   (e) checks the volume (see Note #2) & that a file can be created.
+*
+*               (2) After replay :
+*
+*                   (a) the log & the temp file, if present, must read to their end without error & hold
+*                       only the octet they are written with.  Since the two are written with different
+*                       octets, a cluster shared by both is caught.
+*
+*                   (b) the clusters used in the FAT must be those of the files found by walking the
+*                       directory tree (the journal file included) & of the directories.  A lost
+*                       cluster, or one freed while still in a file, is caught.  Directory clusters are
+*                       not reported by the directory API; since the workload creates no directory,
+*                       those used before the first trial are used after every trial.
+*
+*               (3) 'mount_fail' counts trials after which the volume could not be mounted, 'verify_fail'
+*                   those after which (e) failed.  Both should be 0.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_PwrLoss (FS_BENCH_DEV  *p_dev)
+{
+    FS_BENCH_RUN   run;
+    CPU_CHAR       path_log[FS_BENCH_NAME_LEN_MAX];
+    CPU_CHAR       path_tmp[FS_BENCH_NAME_LEN_MAX];
+    CPU_CHAR       path_chk[FS_BENCH_NAME_LEN_MAX];
+    CPU_CHAR       extra[128];
+    CPU_INT08U     tmp_buf[FS_BENCH_SMALL_FILE_SIZE];
+    FS_FILE       *p_file;
+    FS_FILE_SIZE   log_size;
+    FS_FILE_SIZE   tmp_size;
+    FS_SEC_QTY     dir_sec_cnt;
+    CPU_INT32U     trial_cnt;
+    CPU_INT32U     trial_ix;
+    CPU_INT32U     iter_ix;
+    CPU_INT32U     fired_cnt;
+    CPU_INT32U     mount_fail_cnt;
+    CPU_INT32U     verify_fail_cnt;
+    CPU_BOOLEAN    ok;
+    FS_ERR         err;
+
+
+    trial_cnt = FSBench_Scale(FS_BENCH_PWR_LOSS_TRIAL_CNT);
+    FSBench_PathFmt(path_log, p_dev, "\\pwr.log");
+    FSBench_PathFmt(path_tmp, p_dev, "\\pwr.tmp");
+    FSBench_PathFmt(path_chk, p_dev, "\\pwr.chk");
+
+    FS_FAT_JournalOpen(p_dev->DevName, &err);
+    if (err == FS_ERR_NONE) {
+        FS_FAT_JournalStart(p_dev->DevName, &err);
+    }
+    if (err == FS_ERR_NONE) {                                   /* Get dir clus (see Note #2b).                         */
+        ok = FSBench_ClusChk(p_dev, DEF_YES, &dir_sec_cnt);
+        if (ok != DEF_OK) {
+            err = FS_ERR_VOL_INVALID_SYS;
+        }
+    }
+    if (err != FS_ERR_NONE) {
+        FSBench_RunStart(&run, p_dev, "pwr_loss", 0u);
+        run.Err = err;
+        FSBench_RunEnd(&run, DEF_NULL);
+        return;
+    }
+
+    fired_cnt       = 0u;
+    mount_fail_cnt  = 0u;
+    verify_fail_cnt = 0u;
+    Mem_Set((void *)&FSBench_Buf[0], FS_BENCH_PWR_LOSS_LOG_FILL, FS_BENCH_CHUNK_SIZE);
+    Mem_Set((void *)&tmp_buf[0],     FS_BENCH_PWR_LOSS_TMP_FILL, FS_BENCH_SMALL_FILE_SIZE);
+
+    FSBench_RunStart(&run, p_dev, "pwr_loss", trial_cnt);
+    for (trial_ix = 0u; trial_ix < trial_cnt; trial_ix++) {
+                                                                /* ------------------ RUN TO PWR LOSS ----------------- */
+        FSBench_FlashPwrLossSet(p_dev->FlashPtr, 1u + (FSBench_Rand() % FS_BENCH_PWR_LOSS_OP_MAX));
+        for (iter_ix = 0u; iter_ix < FS_BENCH_PWR_LOSS_ITER_MAX; iter_ix++) {
+            if (p_dev->FlashPtr->PwrLost == DEF_YES) {
+                break;
+            }
+            p_file = FSFile_Open(path_log,
+                                 FS_FILE_ACCESS_MODE_WR | FS_FILE_ACCESS_MODE_CREATE | FS_FILE_ACCESS_MODE_APPEND,
+                                &err);
+            if (p_file != DEF_NULL) {
+                (void)FSFile_Wr(p_file, &FSBench_Buf[0], FS_BENCH_CHUNK_SIZE, &err);
+                FSFile_Close(p_file, &err);
+            }
+            if ((iter_ix % 2u) == 0u) {
+                p_file = FSFile_Open(path_tmp, FS_FILE_ACCESS_MODE_WR | FS_FILE_ACCESS_MODE_CREATE, &err);
+                if (p_file != DEF_NULL) {
+                    (void)FSFile_Wr(p_file, &tmp_buf[0], FS_BENCH_SMALL_FILE_SIZE, &err);
+                    FSFile_Close(p_file, &err);
+                }
+            } else {
+                FSEntry_Del(path_tmp, FS_ENTRY_TYPE_FILE, &err);
+            }
+        }
+        if (p_dev->FlashPtr->PwrLost == DEF_YES) {
+            fired_cnt++;
+        }
+
+                                                                /* ---------------- RESET & RE-MOUNT ------------------ */
+        FSBench_DevClose(p_dev);
+        FSBench_FlashPwrRestore(p_dev->FlashPtr);
+
+        FSBench_OpStart(&run);
+        ok = FSBench_DevOpen(p_dev, DEF_NO);
+        if (ok == DEF_OK) {
+            FS_FAT_JournalOpen(p_dev->DevName, &err);           /* Replays the journal.                                 */
+            if (err == FS_ERR_NONE) {
+                FS_FAT_JournalStart(p_dev->DevName, &err);
+            }
+            if (err != FS_ERR_NONE) {
+                ok = DEF_FAIL;
+            }
+        }
+        FSBench_OpEnd(&run);
+        if (ok != DEF_OK) {
+            mount_fail_cnt++;
+            break;
+        }
+
+                                                                /* ------------------ VERIFY (Note #2) ---------------- */
+        ok = FSBench_FileChk(path_log, FS_BENCH_PWR_LOSS_LOG_FILL, &log_size);
+        if (ok == DEF_OK) {
+            ok = FSBench_FileChk(path_tmp, FS_BENCH_PWR_LOSS_TMP_FILL, &tmp_size);
+        }
+        if (ok == DEF_OK) {
+            ok = FSBench_ClusChk(p_dev, DEF_NO, &dir_sec_cnt);
+        }
+        Mem_Set((void *)&FSBench_Buf[0], FS_BENCH_PWR_LOSS_LOG_FILL, FS_BENCH_CHUNK_SIZE);
+
+        if ((ok       == DEF_OK) &&
+            (log_size >  FS_BENCH_PWR_LOSS_LOG_MAX)) {
+            FSEntry_Del(path_log, FS_ENTRY_TYPE_FILE, &err);
+            if (err != FS_ERR_NONE) {
+                ok = DEF_FAIL;
+            }
+        }
+
+        if (ok == DEF_OK) {
+            p_file = FSFile_Open(path_chk, FS_FILE_ACCESS_MODE_WR | FS_FILE_ACCESS_MODE_CREATE | FS_FILE_ACCESS_MODE_TRUNCATE, &err);
+            if (p_file != DEF_NULL) {
+                FSFile_Close(p_file, &err);
+            }
+            if ((p_file == DEF_NULL) ||
+                (err    != FS_ERR_NONE)) {
+                ok = DEF_FAIL;
+            }
+        }
+
+        if (ok != DEF_OK) {
+            verify_fail_cnt++;
+        }
+    }
+
+    snprintf(extra, sizeof(extra), "\"trials\": %u, \"fired\": %u, \"mount_fail\": %u, \"verify_fail\": %u",   /* See Note #3. */
+             (unsigned)trial_cnt,
+             (unsigned)fired_cnt,
+             (unsigned)mount_fail_cnt,
+             (unsigned)verify_fail_cnt);
+    FSBench_RunEnd(&run, extra);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_FileChk()
+*
+* Description : Check that a file, if present, reads to its end & holds a single octet value.
+*
+* Argument(s) : p_path      Path of the file.
+*
+*               fill        Octet value the file must hold.
+*
+*               p_size      Pointer to variable that will receive the file size (0 if the file is absent).
+*
+* Return(s)   : DEF_OK,   if the file is absent or valid.
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : FSBench_PwrLoss().
+*
+* Note(s)     : (1) Every error is kept; the first one fails the check.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  FSBench_FileChk (CPU_CHAR      *p_path,
+                                      CPU_INT08U     fill,
+                                      FS_FILE_SIZE  *p_size)
+{
+    FS_FILE       *p_file;
+    FS_ENTRY_INFO  info;
+    FS_FILE_SIZE   size_rd;
+    CPU_SIZE_T     len;
+    CPU_SIZE_T     ix;
+    CPU_BOOLEAN    ok;
+    FS_ERR         err;
+
+
+   *p_size = 0u;
+    p_file = FSFile_Open(p_path, FS_FILE_ACCESS_MODE_RD, &err);
+    if (p_file == DEF_NULL) {
+        return ((err == FS_ERR_ENTRY_NOT_FOUND) ? DEF_OK : DEF_FAIL);
+    }
+
+    ok      = DEF_OK;
+    size_rd = 0u;
+    do {                                                        /* Rd to EOF & chk every octet.                         */
+        len = FSFile_Rd(p_file, &FSBench_Buf[0], FS_BENCH_CHUNK_SIZE, &err);
+        for (ix = 0u; ix < len; ix++) {
+            if (FSBench_Buf[ix] != fill) {
+                ok = DEF_FAIL;
+            }
+        }
+        size_rd += len;
+    } while ((len > 0u) && (err == FS_ERR_NONE));
+    if ((err != FS_ERR_NONE) &&
+        (err != FS_ERR_EOF)) {
+        ok = DEF_FAIL;
+    }
+
+    FSFile_Query(p_file, &info, &err);                          /* Size must match octets rd.                           */
+    if ((err       != FS_ERR_NONE) ||
+        (info.Size != size_rd)) {
+        ok = DEF_FAIL;
+    }
+
+    FSFile_Close(p_file, &err);
+    if (err != FS_ERR_NONE) {
+        ok = DEF_FAIL;
+    }
+
+   *p_size = size_rd;
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSBench_TreeSecCnt()
+*
+* Description : Walk a directory tree & count the sectors held by its files.
+*
+* Argument(s) : p_path      Path of the directory, ending with a path separator.
+*
+*               sec_size    Sector size, in octets.
+*
+*               p_sec_cnt   Pointer to variable that will be incremented by the file sector count.
+*
+* Return(s)   : DEF_OK,   if the tree was walked.
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : FSBench_ClusChk(),
+*               FSBench_TreeSecCnt().
+*
+* Note(s)     : (1) A file holds whole clusters.  The directory API reports the clusters a file's size
+*                   needs ('BlkCnt' of 'BlkSize' octets), not those of its cluster chain; a chain longer
+*                   than the size shows as a lost cluster (see 'FSBench_PwrLoss()  Note #2b').
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  FSBench_TreeSecCnt (CPU_CHAR     *p_path,
+                                         FS_SEC_SIZE   sec_size,
+                                         FS_SEC_QTY   *p_sec_cnt)
+{
+    FS_DIR        *p_dir;
+    FS_DIR_ENTRY   dir_entry;
+    CPU_CHAR       path[FS_CFG_MAX_PATH_NAME_LEN + 1u];
+    CPU_BOOLEAN    ok;
+    FS_ERR         err;
+
+
+    p_dir = FSDir_Open(p_path, &err);
+    if (p_dir == DEF_NULL) {
+        return (DEF_FAIL);
+    }
+
+    ok = DEF_OK;
+    FSDir_Rd(p_dir, &dir_entry, &err);
+    while ((ok  == DEF_OK) &&
+           (err == FS_ERR_NONE)) {
+        if (DEF_BIT_IS_SET(dir_entry.Info.Attrib, FS_ENTRY_ATTRIB_DIR) == DEF_YES) {
+            if ((Str_Cmp(dir_entry.Name, ".")  != 0) &&         /* Skip self & parent entries.                          */
+                (Str_Cmp(dir_entry.Name, "..") != 0)) {
+                snprintf(path, sizeof(path), "%s%s\\", p_path, dir_entry.Name);
+                ok = FSBench_TreeSecCnt(path, sec_size, p_sec_cnt);
+            }
+        } else {                                                /* See Note #1.                                         */
+           *p_sec_cnt += dir_entry.Info.BlkCnt * (dir_entry.Info.BlkSize / sec_size);
+        }
+        FSDir_Rd(p_dir, &dir_entry, &err);
+    }
+    if (err != FS_ERR_EOF) {
+        ok = DEF_FAIL;
+    }
+
+    FSDir_Close(p_dir, &err);
+    if (err != FS_ERR_NONE) {
+        ok = DEF_FAIL;
+    }
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_ClusChk()
+*
+* Description : Check that the clusters used in the FAT are those of the files & directories.
+*
+* Argument(s) : p_dev           Pointer to device.
+*
+*               base            Indicates whether to record the directory sectors :
+*
+*                                   DEF_YES    Set '*p_dir_sec_cnt' to the used sectors no file holds.
+*                                   DEF_NO     Check that the used sectors no file holds are '*p_dir_sec_cnt'.
+*
+*               p_dir_sec_cnt   Pointer to the number of sectors held by directories.
+*
+* Return(s)   : DEF_OK,   if the volume was walked &, if 'base' is DEF_NO, the counts match.
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : FSBench_PwrLoss().
+*
+* Note(s)     : (1) See 'FSBench_PwrLoss()  Note #2b'.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  FSBench_ClusChk (FS_BENCH_DEV  *p_dev,
+                                      CPU_BOOLEAN    base,
+                                      FS_SEC_QTY    *p_dir_sec_cnt)
+{
+    FS_VOL_INFO   info;
+    CPU_CHAR      path[FS_CFG_MAX_PATH_NAME_LEN + 1u];
+    FS_SEC_QTY    file_sec_cnt;
+    CPU_BOOLEAN   ok;
+    FS_ERR        err;
+
+
+    FSVol_Query(p_dev->DevName, &info, &err);                   /* Used secs, from the FAT.                             */
+    if (err != FS_ERR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    file_sec_cnt = 0u;                                          /* File secs, from the dir tree.                        */
+    snprintf(path, sizeof(path), "%s\\", p_dev->DevName);     /* Root dir.                                            */
+    ok = FSBench_TreeSecCnt(path, info.DevSecSize, &file_sec_cnt);
+    if ((ok           != DEF_OK) ||
+        (file_sec_cnt >  info.VolUsedSecCnt)) {
+        return (DEF_FAIL);
+    }
+
+    if (base == DEF_YES) {
+       *p_dir_sec_cnt = info.VolUsedSecCnt - file_sec_cnt;
+        return (DEF_OK);
+    }
+
+    return ((info.VolUsedSecCnt - file_sec_cnt == *p_dir_sec_cnt) ? DEF_OK : DEF_FAIL);
+}
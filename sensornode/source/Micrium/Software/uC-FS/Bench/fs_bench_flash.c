@@ -0,0 +1,1683 @@
+/*
+*********************************************************************************************************
+*                                             uC/FS V4
+*                                     The Embedded File System
+*
+*                         (c) Copyright 2008-2014; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/FS is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       FILE SYSTEM BENCHMARK
+*
+*                                      SIMULATED NOR/NAND FLASH
+*
+* Filename      : fs_bench_flash.c
+* Version       : v4.07.00
+*
+* Note(s)       : (1) See 'fs_bench_flash.h  Note #2' for the flash model.
+*
+*                 (2) The NAND simulation decodes the ONFI-style command set issued by the generic
+*                     controller ('fs_dev_nand_ctrlr_gen.c') :
+*
+*                         00h-30h    Read page             05h-E0h    Change read column
+*                         80h-10h    Program page          85h        Change write column
+*                         60h-D0h    Erase block           70h        Read status
+*                         90h        Read ID               FFh        Reset
+*
+*                     A single 00h with no address returns the device to data output after a status
+*                     read, as on a real part.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    FS_BENCH_FLASH_MODULE
+#include  <stdlib.h>
+#include  <lib_mem.h>
+#include  "fs_bench_flash.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  FS_BENCH_FLASH_PPM                          1000000u
+
+#define  FS_BENCH_NAND_CMD_RD_SETUP                     0x00u
+#define  FS_BENCH_NAND_CMD_RD_CONFIRM                   0x30u
+#define  FS_BENCH_NAND_CMD_CHNGRDCOL_SETUP              0x05u
+#define  FS_BENCH_NAND_CMD_CHNGRDCOL_CONFIRM            0xE0u
+#define  FS_BENCH_NAND_CMD_PAGEPGM_SETUP                0x80u
+#define  FS_BENCH_NAND_CMD_PAGEPGM_CONFIRM              0x10u
+#define  FS_BENCH_NAND_CMD_CHNGWRCOL                    0x85u
+#define  FS_BENCH_NAND_CMD_BLKERASE_SETUP               0x60u
+#define  FS_BENCH_NAND_CMD_BLKERASE_CONFIRM             0xD0u
+#define  FS_BENCH_NAND_CMD_RDSTATUS                     0x70u
+#define  FS_BENCH_NAND_CMD_RDID                         0x90u
+#define  FS_BENCH_NAND_CMD_RESET                        0xFFu
+
+#define  FS_BENCH_NAND_SR_WRPROTECT_N             DEF_BIT_07    /* Not write protected.                                 */
+#define  FS_BENCH_NAND_SR_RDY                     DEF_BIT_06
+#define  FS_BENCH_NAND_SR_FAIL                    DEF_BIT_00
+
+#define  FS_BENCH_NAND_OUT_DATA                            0u
+#define  FS_BENCH_NAND_OUT_STATUS                          1u
+#define  FS_BENCH_NAND_OUT_ID                              2u
+
+#define  FS_BENCH_NAND_ADDR_MAX_LEN                        8u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+#ifdef   FS_BENCH_NAND_EN
+typedef  struct  fs_bench_nand_chip {
+    CPU_INT08U   Cmd;                                           /* Last setup cmd.                                      */
+    CPU_INT08U   Addr[FS_BENCH_NAND_ADDR_MAX_LEN];              /* Addr cycles rx'd since setup cmd.                    */
+    CPU_INT08U   AddrCnt;
+    CPU_INT08U   ColAddrSize;                                   /* Nbr of col addr cycles.                              */
+    CPU_INT08U   RowAddrSize;                                   /* Nbr of row addr cycles.                              */
+
+    CPU_INT32U   Col;                                           /* Cur col in pg reg.                                   */
+    CPU_INT32U   Row;                                           /* Cur pg ix.                                           */
+    CPU_INT08U   OutMode;                                       /* What DataRd() returns.                               */
+    CPU_INT08U   OutIx;
+    CPU_INT08U   Status;                                        /* Status reg.                                          */
+
+    CPU_INT08U  *RegPtr;                                        /* Pg reg (data + spare).                               */
+} FS_BENCH_NAND_CHIP;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+#ifdef   FS_BENCH_NAND_EN
+static  const  CPU_INT08U  FS_BENCH_NAND_Id[] = { 0x2Cu, 0xDAu, 0x90u, 0x95u, 0x06u };
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+#ifdef   FS_BENCH_NAND_EN
+static  FS_BENCH_NAND_CHIP  FSBench_NAND_Chip;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U   FSBench_FlashRand       (FS_BENCH_FLASH       *p_flash);
+
+static  CPU_BOOLEAN  FSBench_FlashPwrLossChk (FS_BENCH_FLASH       *p_flash);
+
+static  CPU_BOOLEAN  FSBench_FlashWearOut    (FS_BENCH_FLASH       *p_flash,
+                                              CPU_INT32U            blk_ix);
+
+static  void         FSBench_FlashPgm        (FS_BENCH_FLASH       *p_flash,
+                                              CPU_INT32U            pg_ix,
+                                              CPU_INT32U            pg_offset,
+                                              CPU_INT08U           *p_src,
+                                              CPU_INT32U            len,
+                                              FS_ERR               *p_err);
+
+static  void         FSBench_FlashErase      (FS_BENCH_FLASH       *p_flash,
+                                              CPU_INT32U            blk_ix,
+                                              FS_ERR               *p_err);
+
+                                                                            /* -------- NOR PHY INTERFACE FNCTS ------- */
+static  void         FSDev_NOR_Sim_Open      (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                              FS_ERR               *p_err);
+
+static  void         FSDev_NOR_Sim_Close     (FS_DEV_NOR_PHY_DATA  *p_phy_data);
+
+static  void         FSDev_NOR_Sim_Rd        (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                              void                 *p_dest,
+                                              CPU_INT32U            start,
+                                              CPU_INT32U            cnt,
+                                              FS_ERR               *p_err);
+
+static  void         FSDev_NOR_Sim_Wr        (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                              void                 *p_src,
+                                              CPU_INT32U            start,
+                                              CPU_INT32U            cnt,
+                                              FS_ERR               *p_err);
+
+static  void         FSDev_NOR_Sim_EraseBlk  (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                              CPU_INT32U            start,
+                                              CPU_INT32U            size,
+                                              FS_ERR               *p_err);
+
+static  void         FSDev_NOR_Sim_IO_Ctrl   (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                              CPU_INT08U            opt,
+                                              void                 *p_data,
+                                              FS_ERR               *p_err);
+
+#ifdef   FS_BENCH_NAND_EN
+                                                                            /* ------------ NAND BSP FNCTS ------------ */
+static  void         FS_NAND_BSP_Sim_Open    (FS_ERR               *p_err);
+
+static  void         FS_NAND_BSP_Sim_Close   (void);
+
+static  void         FS_NAND_BSP_Sim_ChipSelEn (void);
+
+static  void         FS_NAND_BSP_Sim_ChipSelDis(void);
+
+static  void         FS_NAND_BSP_Sim_CmdWr   (CPU_INT08U           *p_cmd,
+                                              CPU_SIZE_T            cnt,
+                                              FS_ERR               *p_err);
+
+static  void         FS_NAND_BSP_Sim_AddrWr  (CPU_INT08U           *p_addr,
+                                              CPU_SIZE_T            cnt,
+                                              FS_ERR               *p_err);
+
+static  void         FS_NAND_BSP_Sim_DataWr  (void                 *p_src,
+                                              CPU_SIZE_T            cnt,
+                                              CPU_INT08U            width,
+                                              FS_ERR               *p_err);
+
+static  void         FS_NAND_BSP_Sim_DataRd  (void                 *p_dest,
+                                              CPU_SIZE_T            cnt,
+                                              CPU_INT08U            width,
+                                              FS_ERR               *p_err);
+
+static  void         FS_NAND_BSP_Sim_WaitWhileBusy(void            *poll_fcnt_arg,
+                                              CPU_BOOLEAN         (*poll_fcnt)(void  *p_arg),
+                                              CPU_INT32U            to_us,
+                                              FS_ERR               *p_err);
+
+static  void         FS_NAND_BSP_Sim_CmdExec (CPU_INT08U            cmd);
+
+static  CPU_INT08U   FS_NAND_BSP_Sim_AddrBits(CPU_INT32U            val);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         INTERFACE STRUCTURES
+*********************************************************************************************************
+*/
+
+const  FS_DEV_NOR_PHY_API  FSDev_NOR_Sim = {
+    FSDev_NOR_Sim_Open,
+    FSDev_NOR_Sim_Close,
+    FSDev_NOR_Sim_Rd,
+    FSDev_NOR_Sim_Wr,
+    FSDev_NOR_Sim_EraseBlk,
+    FSDev_NOR_Sim_IO_Ctrl
+};
+
+#ifdef   FS_BENCH_NAND_EN
+const  FS_NAND_CTRLR_GEN_BSP_API  FS_NAND_BSP_Sim = {
+    FS_NAND_BSP_Sim_Open,
+    FS_NAND_BSP_Sim_Close,
+    FS_NAND_BSP_Sim_ChipSelEn,
+    FS_NAND_BSP_Sim_ChipSelDis,
+    FS_NAND_BSP_Sim_CmdWr,
+    FS_NAND_BSP_Sim_AddrWr,
+    FS_NAND_BSP_Sim_DataWr,
+    FS_NAND_BSP_Sim_DataRd,
+    FS_NAND_BSP_Sim_WaitWhileBusy
+};
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         FSBench_FlashInit()
+*
+* Description : Allocate & erase a simulated flash.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+*               blk_cnt     Number of blocks.
+*
+*               pg_per_blk  Number of pages per block.
+*
+*               pg_size     Size of page data area, in octets.
+*
+*               spare_size  Size of page spare area, in octets (0 for NOR).
+*
+*               p_lat       Pointer to latency model.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE         Flash allocated.
+*                               FS_ERR_MEM_ALLOC    Image could not be allocated.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The image is allocated from the host heap; it may be much larger than the uC/LIB
+*                   heap.  It is never freed.
+*
+*               (2) Erase counts start at 1 so that the factory erase is counted like on a real part.
+*********************************************************************************************************
+*/
+
+void  FSBench_FlashInit (FS_BENCH_FLASH            *p_flash,
+                         CPU_INT32U                 blk_cnt,
+                         CPU_INT32U                 pg_per_blk,
+                         CPU_INT32U                 pg_size,
+                         CPU_INT32U                 spare_size,
+                         const  FS_BENCH_FLASH_LAT *p_lat,
+                         FS_ERR                    *p_err)
+{
+    CPU_SIZE_T  size;
+    CPU_INT32U  blk_ix;
+
+
+    size = (CPU_SIZE_T)blk_cnt * pg_per_blk * (pg_size + spare_size);
+
+    Mem_Clr((void *)p_flash, sizeof(FS_BENCH_FLASH));
+    p_flash->MemPtr      = (CPU_INT08U  *)malloc(size);         /* See Note #1.                                         */
+    p_flash->EraseCntTbl = (CPU_INT32U  *)malloc(blk_cnt * sizeof(CPU_INT32U));
+    p_flash->BadBlkTbl   = (CPU_BOOLEAN *)malloc(blk_cnt * sizeof(CPU_BOOLEAN));
+    if ((p_flash->MemPtr      == DEF_NULL) ||
+        (p_flash->EraseCntTbl == DEF_NULL) ||
+        (p_flash->BadBlkTbl   == DEF_NULL)) {
+       *p_err = FS_ERR_MEM_ALLOC;
+        return;
+    }
+
+    p_flash->BlkCnt    = blk_cnt;
+    p_flash->PgPerBlk  = pg_per_blk;
+    p_flash->PgSize    = pg_size;
+    p_flash->SpareSize = spare_size;
+    p_flash->Lat       = *p_lat;
+    p_flash->Seed      = 1u;
+
+    Mem_Set((void *)p_flash->MemPtr, 0xFFu, size);
+    for (blk_ix = 0u; blk_ix < blk_cnt; blk_ix++) {
+        p_flash->EraseCntTbl[blk_ix] = 1u;                      /* See Note #2.                                         */
+        p_flash->BadBlkTbl[blk_ix]   = DEF_NO;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FSBench_FlashBadBlkSet()
+*
+* Description : Mark factory bad blocks & set the rate at which blocks go bad.
+*
+* Argument(s) : p_flash         Pointer to simulated flash.
+*
+*               bad_blk_cnt     Number of factory bad blocks, picked at random.
+*
+*               fail_rate_ppm   Probability, in parts per million, that a program or erase grows a bad
+*                               block.
+*
+*               seed            PRNG seed (so that runs are reproducible).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) A factory bad block has its first & last page cleared (data & spare), which satisfies
+*                   every defect mark type supported by the NAND driver.
+*
+*               (2) Block 0 is never made bad, like on most parts ("guaranteed good block").
+*********************************************************************************************************
+*/
+
+void  FSBench_FlashBadBlkSet (FS_BENCH_FLASH  *p_flash,
+                              CPU_INT32U       bad_blk_cnt,
+                              CPU_INT32U       fail_rate_ppm,
+                              CPU_INT32U       seed)
+{
+    CPU_INT32U   pg_len;
+    CPU_INT32U   blk_len;
+    CPU_INT32U   blk_ix;
+    CPU_INT08U  *p_blk;
+
+
+    p_flash->FailRate_ppm = fail_rate_ppm;
+    p_flash->Seed         = seed;
+    if (p_flash->Seed == 0u) {
+        p_flash->Seed = 1u;
+    }
+
+    pg_len  = p_flash->PgSize + p_flash->SpareSize;
+    blk_len = pg_len * p_flash->PgPerBlk;
+    while (bad_blk_cnt > 0u) {
+        blk_ix = 1u + (FSBench_FlashRand(p_flash) % (p_flash->BlkCnt - 1u));   /* See Note #2.                         */
+        if (p_flash->BadBlkTbl[blk_ix] == DEF_NO) {
+            p_flash->BadBlkTbl[blk_ix] = DEF_YES;
+            p_blk = p_flash->MemPtr + ((CPU_SIZE_T)blk_ix * blk_len);
+            Mem_Clr((void *)p_blk, pg_len);                                     /* See Note #1.                         */
+            Mem_Clr((void *)(p_blk + blk_len - pg_len), pg_len);
+            bad_blk_cnt--;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSBench_FlashStatClr()
+*
+* Description : Clear statistics (but not erase counts).
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  FSBench_FlashStatClr (FS_BENCH_FLASH  *p_flash)
+{
+    Mem_Clr((void *)&p_flash->Stat, sizeof(FS_BENCH_FLASH_STAT));
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FSBench_FlashEraseCntGet()
+*
+* Description : Get minimum & maximum erase counts over good blocks.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+*               p_min       Pointer to variable that will receive the minimum erase count.
+*
+*               p_max       Pointer to variable that will receive the maximum erase count.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  FSBench_FlashEraseCntGet (FS_BENCH_FLASH  *p_flash,
+                                CPU_INT32U      *p_min,
+                                CPU_INT32U      *p_max)
+{
+    CPU_INT32U  blk_ix;
+    CPU_INT32U  cnt;
+
+
+   *p_min = DEF_INT_32U_MAX_VAL;
+   *p_max = 0u;
+    for (blk_ix = 0u; blk_ix < p_flash->BlkCnt; blk_ix++) {
+        if (p_flash->BadBlkTbl[blk_ix] == DEF_NO) {
+            cnt = p_flash->EraseCntTbl[blk_ix];
+            if (cnt < *p_min) {
+               *p_min = cnt;
+            }
+            if (cnt > *p_max) {
+               *p_max = cnt;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FSBench_FlashPwrLossSet()
+*
+* Description : Arm a power loss.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+*               op_cnt      Number of program/erase operations after which power is lost; the last one is
+*                           torn.  0 disarms.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  FSBench_FlashPwrLossSet (FS_BENCH_FLASH  *p_flash,
+                               CPU_INT32U       op_cnt)
+{
+    p_flash->PwrLossCnt = op_cnt;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FSBench_FlashPwrRestore()
+*
+* Description : Restore power after a power loss.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The application must re-open the device afterwards, just like after a reset, so that
+*                   no state held in RAM by the file system survives the power loss.
+*********************************************************************************************************
+*/
+
+void  FSBench_FlashPwrRestore (FS_BENCH_FLASH  *p_flash)
+{
+    p_flash->PwrLossCnt = 0u;
+    p_flash->PwrLost    = DEF_NO;
+#ifdef   FS_BENCH_NAND_EN
+    if (p_flash == &FSBench_NAND_Flash) {
+        FSBench_NAND_Chip.Status  = FS_BENCH_NAND_SR_WRPROTECT_N | FS_BENCH_NAND_SR_RDY;
+        FSBench_NAND_Chip.OutMode = FS_BENCH_NAND_OUT_DATA;
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         FSBench_FlashRand()
+*
+* Description : Get next pseudo-random number (xorshift32).
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+* Return(s)   : Pseudo-random number.
+*
+* Caller(s)   : FSBench_FlashBadBlkSet(),
+*               FSBench_FlashWearOut().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  FSBench_FlashRand (FS_BENCH_FLASH  *p_flash)
+{
+    CPU_INT32U  x;
+
+
+    x  = p_flash->Seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x <<  5;
+    p_flash->Seed = x;
+
+    return (x);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FSBench_FlashPwrLossChk()
+*
+* Description : Count a program/erase operation against an armed power loss.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+* Return(s)   : DEF_YES, if power is lost during this operation (operation torn).
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : FSBench_FlashPgm(),
+*               FSBench_FlashErase().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  FSBench_FlashPwrLossChk (FS_BENCH_FLASH  *p_flash)
+{
+    if (p_flash->PwrLossCnt == 0u) {
+        return (DEF_NO);
+    }
+
+    p_flash->PwrLossCnt--;
+    if (p_flash->PwrLossCnt != 0u) {
+        return (DEF_NO);
+    }
+
+    p_flash->PwrLost = DEF_YES;
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSBench_FlashWearOut()
+*
+* Description : Decide whether a program/erase grows a bad block.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+*               blk_ix      Index of block operated on.
+*
+* Return(s)   : DEF_YES, if block went bad.
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : FSBench_FlashPgm(),
+*               FSBench_FlashErase().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  FSBench_FlashWearOut (FS_BENCH_FLASH  *p_flash,
+                                           CPU_INT32U       blk_ix)
+{
+    if (p_flash->FailRate_ppm == 0u) {
+        return (DEF_NO);
+    }
+
+    if ((FSBench_FlashRand(p_flash) % FS_BENCH_FLASH_PPM) >= p_flash->FailRate_ppm) {
+        return (DEF_NO);
+    }
+
+    p_flash->BadBlkTbl[blk_ix] = DEF_YES;
+    p_flash->Stat.BadBlkGrownCtr++;
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSBench_FlashPgm()
+*
+* Description : Program (part of) a page.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+*               pg_ix       Index of page.
+*
+*               pg_offset   Offset in page (data area followed by spare area).
+*
+*               p_src       Pointer to source buffer.
+*
+*               len         Number of octets to program.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Page programmed (or power lost, see Note #4).
+*                               FS_ERR_DEV_IO    Program failed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_Sim_Wr(),
+*               FS_NAND_BSP_Sim_CmdExec().
+*
+* Note(s)     : (1) Programming can only clear bits.
+*
+*               (2) A bad block is still programmed (so that a defect mark written by the FTL sticks) but
+*                   the operation reports a failure.
+*
+*               (3) Only the program time is charged here; callers charge bus transfer time.
+*
+*               (4) See 'fs_bench_flash.h  Note #2d'.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_FlashPgm (FS_BENCH_FLASH  *p_flash,
+                                CPU_INT32U       pg_ix,
+                                CPU_INT32U       pg_offset,
+                                CPU_INT08U      *p_src,
+                                CPU_INT32U       len,
+                                FS_ERR          *p_err)
+{
+    CPU_INT08U   *p_dest;
+    CPU_INT32U    blk_ix;
+    CPU_INT32U    ix;
+    CPU_BOOLEAN   torn;
+
+
+    if (p_flash->PwrLost == DEF_YES) {                          /* See Note #4.                                         */
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    torn = FSBench_FlashPwrLossChk(p_flash);
+    if (torn == DEF_YES) {
+        len /= 2u;
+    }
+
+    blk_ix = pg_ix / p_flash->PgPerBlk;
+    p_dest = p_flash->MemPtr
+           + ((CPU_SIZE_T)pg_ix * (p_flash->PgSize + p_flash->SpareSize))
+           + pg_offset;
+    for (ix = 0u; ix < len; ix++) {                             /* See Note #1.                                         */
+        p_dest[ix] &= p_src[ix];
+    }
+
+    p_flash->Stat.PgmOpCtr++;
+    p_flash->Stat.PgmOctetCtr += len;
+    p_flash->Stat.Time_ns     += p_flash->Lat.PgmSetup_ns;      /* See Note #3.                                         */
+
+    if (torn == DEF_YES) {
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    if (p_flash->BadBlkTbl[blk_ix] == DEF_YES) {                /* See Note #2.                                         */
+        p_flash->Stat.PgmFailCtr++;
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    if (FSBench_FlashWearOut(p_flash, blk_ix) == DEF_YES) {
+        p_flash->Stat.PgmFailCtr++;
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FSBench_FlashErase()
+*
+* Description : Erase a block.
+*
+* Argument(s) : p_flash     Pointer to simulated flash.
+*
+*               blk_ix      Index of block.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Block erased (or power lost, see Note #2).
+*                               FS_ERR_DEV_IO    Erase failed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_Sim_EraseBlk(),
+*               FSDev_NOR_Sim_IO_Ctrl(),
+*               FS_NAND_BSP_Sim_CmdExec().
+*
+* Note(s)     : (1) A torn erase leaves the second half of the block untouched.
+*
+*               (2) See 'fs_bench_flash.h  Note #2d'.
+*********************************************************************************************************
+*/
+
+static  void  FSBench_FlashErase (FS_BENCH_FLASH  *p_flash,
+                                  CPU_INT32U       blk_ix,
+                                  FS_ERR          *p_err)
+{
+    CPU_INT08U   *p_blk;
+    CPU_SIZE_T    blk_len;
+    CPU_BOOLEAN   torn;
+
+
+    if (p_flash->PwrLost == DEF_YES) {                          /* See Note #2.                                         */
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    blk_len = (CPU_SIZE_T)p_flash->PgPerBlk * (p_flash->PgSize + p_flash->SpareSize);
+    p_blk   =  p_flash->MemPtr + ((CPU_SIZE_T)blk_ix * blk_len);
+
+    p_flash->Stat.Time_ns += p_flash->Lat.Erase_ns;
+
+    torn = FSBench_FlashPwrLossChk(p_flash);
+    if (torn == DEF_YES) {                                      /* See Note #1.                                         */
+        Mem_Set((void *)p_blk, 0xFFu, blk_len / 2u);
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    if (p_flash->BadBlkTbl[blk_ix] == DEF_YES) {
+        p_flash->Stat.EraseFailCtr++;
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    Mem_Set((void *)p_blk, 0xFFu, blk_len);
+    p_flash->EraseCntTbl[blk_ix]++;
+    p_flash->Stat.EraseCtr++;
+
+    if (FSBench_FlashWearOut(p_flash, blk_ix) == DEF_YES) {
+        p_flash->Stat.EraseFailCtr++;
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSDev_NOR_Sim_Open()
+*
+* Description : Open (initialize) the simulated NOR.
+*
+* Argument(s) : p_phy_data  Pointer to NOR phy data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE                   Device opened.
+*                               FS_ERR_DEV_INVALID_UNIT_NBR   Device unit number is invalid.
+*                               FS_ERR_DEV_NOT_PRESENT        Flash image not allocated.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_Open().
+*
+* Note(s)     : (1) Only unit 0 is simulated; it is a monolithic device with a single block region.
+*********************************************************************************************************
+*/
+
+static  void  FSDev_NOR_Sim_Open (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                  FS_ERR               *p_err)
+{
+    FS_BENCH_FLASH  *p_flash;
+
+
+    if ((p_phy_data->UnitNbr   != 0u) ||                        /* See Note #1.                                         */
+        (p_phy_data->RegionNbr != 0u)) {
+       *p_err = FS_ERR_DEV_INVALID_UNIT_NBR;
+        return;
+    }
+
+    p_flash = &FSBench_NOR_Flash;
+    if (p_flash->MemPtr == DEF_NULL) {
+       *p_err = FS_ERR_DEV_NOT_PRESENT;
+        return;
+    }
+
+    p_phy_data->BlkCnt          =  p_flash->BlkCnt;
+    p_phy_data->BlkSize         =  p_flash->PgPerBlk * p_flash->PgSize;
+    p_phy_data->AddrRegionStart =  p_phy_data->AddrBase;
+    p_phy_data->DataPtr         = (void *)p_flash;
+    p_phy_data->WrMultSize      =  1u;
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSDev_NOR_Sim_Close()
+*
+* Description : Close the simulated NOR.
+*
+* Argument(s) : p_phy_data  Pointer to NOR phy data.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_Close().
+*
+* Note(s)     : (1) The flash image is kept, so that the device can be re-opened after a (simulated)
+*                   reset.
+*********************************************************************************************************
+*/
+
+static  void  FSDev_NOR_Sim_Close (FS_DEV_NOR_PHY_DATA  *p_phy_data)
+{
+    p_phy_data->DataPtr = (void *)0;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FSDev_NOR_Sim_Rd()
+*
+* Description : Read from the simulated NOR.
+*
+* Argument(s) : p_phy_data  Pointer to NOR phy data.
+*
+*               p_dest      Pointer to destination buffer.
+*
+*               start       Start address of read (relative to start of device).
+*
+*               cnt         Number of octets to read.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Octets read successfully.
+*                               FS_ERR_DEV_IO    Power lost or read out of range.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_PhyRdHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSDev_NOR_Sim_Rd (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                void                 *p_dest,
+                                CPU_INT32U            start,
+                                CPU_INT32U            cnt,
+                                FS_ERR               *p_err)
+{
+    FS_BENCH_FLASH  *p_flash;
+
+
+    p_flash = (FS_BENCH_FLASH *)p_phy_data->DataPtr;
+    if (((CPU_INT64U)start + cnt > (CPU_INT64U)p_flash->BlkCnt * p_flash->PgPerBlk * p_flash->PgSize)) {
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    Mem_Copy(p_dest, (void *)(p_flash->MemPtr + start), cnt);
+
+    p_flash->Stat.RdOpCtr++;
+    p_flash->Stat.RdOctetCtr += cnt;
+    p_flash->Stat.Time_ns    += p_flash->Lat.RdSetup_ns + ((CPU_INT64U)cnt * p_flash->Lat.RdOctet_ns);
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FSDev_NOR_Sim_Wr()
+*
+* Description : Write to the simulated NOR.
+*
+* Argument(s) : p_phy_data  Pointer to NOR phy data.
+*
+*               p_src       Pointer to source buffer.
+*
+*               start       Start address of write (relative to start of device).
+*
+*               cnt         Number of octets to write.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Octets written successfully.
+*                               FS_ERR_DEV_IO    Power lost or write out of range.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_PhyWrHandler().
+*
+* Note(s)     : (1) The write is split on program page boundaries, like a write-buffer/page program on
+*                   a real part; each page costs one program time.
+*********************************************************************************************************
+*/
+
+static  void  FSDev_NOR_Sim_Wr (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                void                 *p_src,
+                                CPU_INT32U            start,
+                                CPU_INT32U            cnt,
+                                FS_ERR               *p_err)
+{
+    FS_BENCH_FLASH  *p_flash;
+    CPU_INT08U      *p_src_08;
+    CPU_INT32U       pg_ix;
+    CPU_INT32U       pg_offset;
+    CPU_INT32U       len;
+
+
+    p_flash = (FS_BENCH_FLASH *)p_phy_data->DataPtr;
+    if ((CPU_INT64U)start + cnt > (CPU_INT64U)p_flash->BlkCnt * p_flash->PgPerBlk * p_flash->PgSize) {
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    p_flash->Stat.Time_ns += (CPU_INT64U)cnt * p_flash->Lat.PgmOctet_ns;
+
+    p_src_08 = (CPU_INT08U *)p_src;
+    while (cnt > 0u) {                                          /* See Note #1.                                         */
+        pg_ix     = start / p_flash->PgSize;
+        pg_offset = start % p_flash->PgSize;
+        len       = DEF_MIN(cnt, p_flash->PgSize - pg_offset);
+
+        FSBench_FlashPgm(p_flash, pg_ix, pg_offset, p_src_08, len, p_err);
+        if (*p_err != FS_ERR_NONE) {
+            return;
+        }
+
+        p_src_08 += len;
+        start    += len;
+        cnt      -= len;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FSDev_NOR_Sim_EraseBlk()
+*
+* Description : Erase block of the simulated NOR.
+*
+* Argument(s) : p_phy_data  Pointer to NOR phy data.
+*
+*               start       Start address of block (relative to start of device).
+*
+*               size        Size of block, in octets.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Block erased successfully.
+*                               FS_ERR_DEV_IO    Power lost or block address invalid.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_PhyEraseBlkHandler().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSDev_NOR_Sim_EraseBlk (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                      CPU_INT32U            start,
+                                      CPU_INT32U            size,
+                                      FS_ERR               *p_err)
+{
+    FS_BENCH_FLASH  *p_flash;
+    CPU_INT32U       blk_size;
+
+
+    p_flash  = (FS_BENCH_FLASH *)p_phy_data->DataPtr;
+    blk_size =  p_flash->PgPerBlk * p_flash->PgSize;
+    if (((start % blk_size) != 0u) ||
+         (size              != blk_size) ||
+         (start / blk_size  >= p_flash->BlkCnt)) {
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    FSBench_FlashErase(p_flash, start / blk_size, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FSDev_NOR_Sim_IO_Ctrl()
+*
+* Description : Perform simulated NOR I/O control operation.
+*
+* Argument(s) : p_phy_data  Pointer to NOR phy data.
+*
+*               opt         Control command.
+*
+*               p_data      Buffer which holds data to be used for operation.
+*                              OR
+*                           Buffer in which data will be stored as a result of operation.
+*
+*               p_err       Pointer to variable that will receive the return the error code from this function :
+*
+*                               FS_ERR_NONE                   Control operation performed successfully.
+*                               FS_ERR_DEV_INVALID_IO_CTRL    I/O control operation unknown to driver.
+*                               FS_ERR_DEV_IO                 Device I/O error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSDev_NOR_IO_Ctrl().
+*
+* Note(s)     : (1) Defined I/O control operations are :
+*
+*                   (a) FS_DEV_IO_CTRL_PHY_ERASE_CHIP    Erase entire chip.
+*********************************************************************************************************
+*/
+
+static  void  FSDev_NOR_Sim_IO_Ctrl (FS_DEV_NOR_PHY_DATA  *p_phy_data,
+                                     CPU_INT08U            opt,
+                                     void                 *p_data,
+                                     FS_ERR               *p_err)
+{
+    FS_BENCH_FLASH  *p_flash;
+    CPU_INT32U       blk_ix;
+
+
+    (void)p_data;
+
+    p_flash = (FS_BENCH_FLASH *)p_phy_data->DataPtr;
+    switch (opt) {
+        case FS_DEV_IO_CTRL_PHY_ERASE_CHIP:                     /* -------------------- ERASE CHIP -------------------- */
+             for (blk_ix = 0u; blk_ix < p_flash->BlkCnt; blk_ix++) {
+                 FSBench_FlashErase(p_flash, blk_ix, p_err);
+                 if (*p_err != FS_ERR_NONE) {
+                     return;
+                 }
+             }
+             break;
+
+
+        default:                                                /* -------------- UNSUPPORTED I/O CTL OP -------------- */
+            *p_err = FS_ERR_DEV_INVALID_IO_CTRL;
+             break;
+    }
+}
+
+
+#ifdef   FS_BENCH_NAND_EN
+/*
+*********************************************************************************************************
+*                                       FS_NAND_BSP_Sim_Open()
+*
+* Description : Open (initialize) the simulated NAND chip.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE                Chip opened.
+*                               FS_ERR_DEV_NOT_PRESENT     Flash image not allocated.
+*                               FS_ERR_MEM_ALLOC           Page register could not be allocated.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_NAND_CtrlrGen_Open().
+*
+* Note(s)     : (1) Address cycle counts are derived from the geometry exactly like the generic controller
+*                   does for a large-page device.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_Open (FS_ERR  *p_err)
+{
+    FS_BENCH_FLASH      *p_flash;
+    FS_BENCH_NAND_CHIP  *p_chip;
+    CPU_INT08U           bits;
+
+
+    p_flash = &FSBench_NAND_Flash;
+    p_chip  = &FSBench_NAND_Chip;
+    if (p_flash->MemPtr == DEF_NULL) {
+       *p_err = FS_ERR_DEV_NOT_PRESENT;
+        return;
+    }
+
+    if (p_chip->RegPtr == DEF_NULL) {
+        p_chip->RegPtr = (CPU_INT08U *)malloc(p_flash->PgSize + p_flash->SpareSize);
+        if (p_chip->RegPtr == DEF_NULL) {
+           *p_err = FS_ERR_MEM_ALLOC;
+            return;
+        }
+    }
+                                                                /* See Note #1.                                         */
+    bits                = FS_NAND_BSP_Sim_AddrBits(p_flash->PgSize);
+    p_chip->ColAddrSize = (bits + DEF_OCTET_NBR_BITS - 1u) / DEF_OCTET_NBR_BITS;
+    bits                = FS_NAND_BSP_Sim_AddrBits(p_flash->BlkCnt * p_flash->PgPerBlk);
+    p_chip->RowAddrSize = (bits + DEF_OCTET_NBR_BITS - 1u) / DEF_OCTET_NBR_BITS;
+
+    p_chip->Cmd         = FS_BENCH_NAND_CMD_RESET;
+    p_chip->AddrCnt     = 0u;
+    p_chip->Col         = 0u;
+    p_chip->Row         = 0u;
+    p_chip->OutMode     = FS_BENCH_NAND_OUT_DATA;
+    p_chip->Status      = FS_BENCH_NAND_SR_WRPROTECT_N | FS_BENCH_NAND_SR_RDY;
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FS_NAND_BSP_Sim_Close()
+*
+* Description : Close the simulated NAND chip.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_NAND_CtrlrGen_Close().
+*
+* Note(s)     : (1) The flash image & page register are kept across close/open (see
+*                   'FSBench_FlashPwrRestore()  Note #1').
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_Close (void)
+{
+
+}
+
+
+/*
+*********************************************************************************************************
+*                                   FS_NAND_BSP_Sim_ChipSelEn()
+*                                   FS_NAND_BSP_Sim_ChipSelDis()
+*
+* Description : Enable/disable chip select.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Single chip, always selected.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_ChipSelEn (void)
+{
+
+}
+
+static  void  FS_NAND_BSP_Sim_ChipSelDis (void)
+{
+
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FS_NAND_BSP_Sim_CmdWr()
+*
+* Description : Write command cycle(s).
+*
+* Argument(s) : p_cmd       Pointer to buffer that holds command.
+*
+*               cnt         Number of octets to write.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Command written.
+*                               FS_ERR_DEV_IO    Power lost.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_CmdWr (CPU_INT08U  *p_cmd,
+                                     CPU_SIZE_T   cnt,
+                                     FS_ERR      *p_err)
+{
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < cnt; ix++) {
+        FS_NAND_BSP_Sim_CmdExec(p_cmd[ix]);
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FS_NAND_BSP_Sim_AddrWr()
+*
+* Description : Write address cycle(s).
+*
+* Argument(s) : p_addr      Pointer to buffer that holds address.
+*
+*               cnt         Number of octets to write.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Address written.
+*                               FS_ERR_DEV_IO    Power lost or too many address cycles.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Addresses are decoded as soon as all the cycles expected by the pending command have
+*                   been received : column then row (little-endian) for 00h/80h, column only for 05h/85h
+*                   & row only for 60h.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_AddrWr (CPU_INT08U  *p_addr,
+                                      CPU_SIZE_T   cnt,
+                                      FS_ERR      *p_err)
+{
+    FS_BENCH_NAND_CHIP  *p_chip;
+    CPU_INT08U           col_cnt;
+    CPU_INT08U           row_cnt;
+    CPU_INT08U           ix;
+
+
+    p_chip = &FSBench_NAND_Chip;
+    if (p_chip->AddrCnt + cnt > FS_BENCH_NAND_ADDR_MAX_LEN) {
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    Mem_Copy((void *)&p_chip->Addr[p_chip->AddrCnt], (void *)p_addr, cnt);
+    p_chip->AddrCnt += (CPU_INT08U)cnt;
+
+    switch (p_chip->Cmd) {                                      /* See Note #1.                                         */
+        case FS_BENCH_NAND_CMD_RD_SETUP:
+        case FS_BENCH_NAND_CMD_PAGEPGM_SETUP:
+             col_cnt = p_chip->ColAddrSize;
+             row_cnt = p_chip->RowAddrSize;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_CHNGRDCOL_SETUP:
+        case FS_BENCH_NAND_CMD_CHNGWRCOL:
+             col_cnt = p_chip->ColAddrSize;
+             row_cnt = 0u;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_BLKERASE_SETUP:
+             col_cnt = 0u;
+             row_cnt = p_chip->RowAddrSize;
+             break;
+
+
+        default:
+            *p_err = FS_ERR_NONE;
+             return;
+    }
+
+    if (p_chip->AddrCnt < col_cnt + row_cnt) {
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    if (col_cnt > 0u) {
+        p_chip->Col = 0u;
+        for (ix = 0u; ix < col_cnt; ix++) {
+            p_chip->Col |= (CPU_INT32U)p_chip->Addr[ix] << (DEF_OCTET_NBR_BITS * ix);
+        }
+    }
+    if (row_cnt > 0u) {
+        p_chip->Row = 0u;
+        for (ix = 0u; ix < row_cnt; ix++) {
+            p_chip->Row |= (CPU_INT32U)p_chip->Addr[col_cnt + ix] << (DEF_OCTET_NBR_BITS * ix);
+        }
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FS_NAND_BSP_Sim_DataWr()
+*
+* Description : Write data cycle(s) into the page register.
+*
+* Argument(s) : p_src       Pointer to source buffer.
+*
+*               cnt         Number of octets to write.
+*
+*               width       Write access width, in bits.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Data written.
+*                               FS_ERR_DEV_IO    Power lost or column out of range.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_DataWr (void        *p_src,
+                                      CPU_SIZE_T   cnt,
+                                      CPU_INT08U   width,
+                                      FS_ERR      *p_err)
+{
+    FS_BENCH_FLASH      *p_flash;
+    FS_BENCH_NAND_CHIP  *p_chip;
+
+
+    (void)width;
+
+    p_flash = &FSBench_NAND_Flash;
+    p_chip  = &FSBench_NAND_Chip;
+    if (p_chip->Col + cnt > p_flash->PgSize + p_flash->SpareSize) {
+       *p_err = FS_ERR_DEV_IO;
+        return;
+    }
+
+    Mem_Copy((void *)&p_chip->RegPtr[p_chip->Col], p_src, cnt);
+    p_chip->Col           += cnt;
+    p_flash->Stat.Time_ns += (CPU_INT64U)cnt * p_flash->Lat.PgmOctet_ns;
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FS_NAND_BSP_Sim_DataRd()
+*
+* Description : Read data cycle(s) from the page register, status register or ID.
+*
+* Argument(s) : p_dest      Pointer to destination buffer.
+*
+*               cnt         Number of octets to read.
+*
+*               width       Read access width, in bits.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE      Data read.
+*                               FS_ERR_DEV_IO    Power lost or column out of range.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_DataRd (void        *p_dest,
+                                      CPU_SIZE_T   cnt,
+                                      CPU_INT08U   width,
+                                      FS_ERR      *p_err)
+{
+    FS_BENCH_FLASH      *p_flash;
+    FS_BENCH_NAND_CHIP  *p_chip;
+    CPU_INT08U          *p_dest_08;
+    CPU_SIZE_T           ix;
+
+
+    (void)width;
+
+    p_flash   = &FSBench_NAND_Flash;
+    p_chip    = &FSBench_NAND_Chip;
+    p_dest_08 = (CPU_INT08U *)p_dest;
+
+    switch (p_chip->OutMode) {
+        case FS_BENCH_NAND_OUT_STATUS:
+             Mem_Set(p_dest, p_chip->Status, cnt);
+             break;
+
+
+        case FS_BENCH_NAND_OUT_ID:
+             for (ix = 0u; ix < cnt; ix++) {
+                 if (p_chip->OutIx < sizeof(FS_BENCH_NAND_Id)) {
+                     p_dest_08[ix] = FS_BENCH_NAND_Id[p_chip->OutIx];
+                     p_chip->OutIx++;
+                 } else {
+                     p_dest_08[ix] = 0u;
+                 }
+             }
+             break;
+
+
+        case FS_BENCH_NAND_OUT_DATA:
+        default:
+             if (p_chip->Col + cnt > p_flash->PgSize + p_flash->SpareSize) {
+                *p_err = FS_ERR_DEV_IO;
+                 return;
+             }
+             Mem_Copy(p_dest, (void *)&p_chip->RegPtr[p_chip->Col], cnt);
+             p_chip->Col              += cnt;
+             p_flash->Stat.RdOctetCtr += cnt;
+             p_flash->Stat.Time_ns    += (CPU_INT64U)cnt * p_flash->Lat.RdOctet_ns;
+             break;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   FS_NAND_BSP_Sim_WaitWhileBusy()
+*
+* Description : Wait while the chip is busy.
+*
+* Argument(s) : poll_fcnt_arg   Argument to pass to poll function.
+*
+*               poll_fcnt       Function to call to check whether the chip is ready.
+*
+*               to_us           Timeout, in microseconds.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   FS_ERR_NONE           Chip ready.
+*                                   FS_ERR_DEV_TIMEOUT    Poll function did not report ready.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Operations complete instantly on the host (their cost is added to the simulated
+*                   clock), so the poll function is called once, as a BSP with a R/B# interrupt would.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_WaitWhileBusy (void          *poll_fcnt_arg,
+                                             CPU_BOOLEAN  (*poll_fcnt)(void  *p_arg),
+                                             CPU_INT32U     to_us,
+                                             FS_ERR        *p_err)
+{
+    CPU_BOOLEAN  rdy;
+
+
+    (void)to_us;
+
+    rdy = DEF_YES;
+    if (poll_fcnt != DEF_NULL) {                                /* See Note #1.                                         */
+        rdy = poll_fcnt(poll_fcnt_arg);
+    }
+
+    if (rdy != DEF_YES) {
+       *p_err = FS_ERR_DEV_TIMEOUT;
+        return;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      FS_NAND_BSP_Sim_CmdExec()
+*
+* Description : Execute one command cycle.
+*
+* Argument(s) : cmd         Command.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_NAND_BSP_Sim_CmdWr().
+*
+* Note(s)     : (1) See 'fs_bench_flash.c  Note #2'.
+*
+*               (2) A page program always programs the whole register; octets the controller did not
+*                   transfer are 0xFF & leave the array unchanged.
+*********************************************************************************************************
+*/
+
+static  void  FS_NAND_BSP_Sim_CmdExec (CPU_INT08U  cmd)
+{
+    FS_BENCH_FLASH      *p_flash;
+    FS_BENCH_NAND_CHIP  *p_chip;
+    CPU_INT32U           pg_len;
+    CPU_INT32U           pg_cnt;
+    FS_ERR               err;
+
+
+    p_flash = &FSBench_NAND_Flash;
+    p_chip  = &FSBench_NAND_Chip;
+    pg_len  =  p_flash->PgSize + p_flash->SpareSize;
+    pg_cnt  =  p_flash->BlkCnt * p_flash->PgPerBlk;
+
+    switch (cmd) {
+        case FS_BENCH_NAND_CMD_RESET:
+             p_chip->Cmd     = cmd;
+             p_chip->OutMode = FS_BENCH_NAND_OUT_DATA;
+             p_chip->Status  = FS_BENCH_NAND_SR_WRPROTECT_N | FS_BENCH_NAND_SR_RDY;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_RDID:
+             p_chip->Cmd     = cmd;
+             p_chip->AddrCnt = 0u;
+             p_chip->OutMode = FS_BENCH_NAND_OUT_ID;
+             p_chip->OutIx   = 0u;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_RD_SETUP:                        /* Also returns to data output after status rd.         */
+        case FS_BENCH_NAND_CMD_CHNGRDCOL_SETUP:
+        case FS_BENCH_NAND_CMD_CHNGWRCOL:
+        case FS_BENCH_NAND_CMD_BLKERASE_SETUP:
+             p_chip->Cmd     = cmd;
+             p_chip->AddrCnt = 0u;
+             p_chip->OutMode = FS_BENCH_NAND_OUT_DATA;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_PAGEPGM_SETUP:
+             p_chip->Cmd     = cmd;
+             p_chip->AddrCnt = 0u;
+             p_chip->Col     = 0u;
+             Mem_Set((void *)p_chip->RegPtr, 0xFFu, pg_len);
+             break;
+
+
+        case FS_BENCH_NAND_CMD_RD_CONFIRM:                      /* ------------------ LOAD PG TO REG ------------------ */
+             p_chip->OutMode = FS_BENCH_NAND_OUT_DATA;
+             if (p_chip->Row >= pg_cnt) {
+                 DEF_BIT_SET(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+                 break;
+             }
+             Mem_Copy((void *)p_chip->RegPtr,
+                      (void *)(p_flash->MemPtr + ((CPU_SIZE_T)p_chip->Row * pg_len)),
+                      pg_len);
+             DEF_BIT_CLR(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+             p_flash->Stat.RdOpCtr++;
+             p_flash->Stat.Time_ns += p_flash->Lat.RdSetup_ns;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_CHNGRDCOL_CONFIRM:
+             p_chip->OutMode = FS_BENCH_NAND_OUT_DATA;
+             break;
+
+
+        case FS_BENCH_NAND_CMD_PAGEPGM_CONFIRM:                 /* ---------------- PGM REG TO ARRAY ------------------ */
+             if (p_chip->Row >= pg_cnt) {
+                 DEF_BIT_SET(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+                 break;
+             }
+             FSBench_FlashPgm(p_flash, p_chip->Row, 0u, p_chip->RegPtr, pg_len, &err);   /* See Note #2.        */
+             if (err != FS_ERR_NONE) {
+                 DEF_BIT_SET(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+             } else {
+                 DEF_BIT_CLR(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+             }
+             break;
+
+
+        case FS_BENCH_NAND_CMD_BLKERASE_CONFIRM:                /* -------------------- ERASE BLK --------------------- */
+             if (p_chip->Row >= pg_cnt) {
+                 DEF_BIT_SET(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+                 break;
+             }
+             FSBench_FlashErase(p_flash, p_chip->Row / p_flash->PgPerBlk, &err);
+             if (err != FS_ERR_NONE) {
+                 DEF_BIT_SET(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+             } else {
+                 DEF_BIT_CLR(p_chip->Status, FS_BENCH_NAND_SR_FAIL);
+             }
+             break;
+
+
+        case FS_BENCH_NAND_CMD_RDSTATUS:
+             p_chip->OutMode = FS_BENCH_NAND_OUT_STATUS;
+             break;
+
+
+        default:                                                /* Unsupported cmd (e.g. rd param pg) rd's as zeros.    */
+             p_chip->Cmd     = cmd;
+             p_chip->AddrCnt = 0u;
+             p_chip->OutMode = FS_BENCH_NAND_OUT_ID;
+             p_chip->OutIx   = sizeof(FS_BENCH_NAND_Id);
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                     FS_NAND_BSP_Sim_AddrBits()
+*
+* Description : Get number of bits needed to address 'val' items (ceil(log2(val))).
+*
+* Argument(s) : val         Number of items.
+*
+* Return(s)   : Number of bits.
+*
+* Caller(s)   : FS_NAND_BSP_Sim_Open().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  FS_NAND_BSP_Sim_AddrBits (CPU_INT32U  val)
+{
+    CPU_INT08U  bits;
+
+
+    bits = 0u;
+    while (((CPU_INT32U)1u << bits) < val) {
+        bits++;
+    }
+
+    return (bits);
+}
+#endif
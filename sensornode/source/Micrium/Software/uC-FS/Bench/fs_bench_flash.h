@@ -0,0 +1,220 @@
+/*
+*********************************************************************************************************
+*                                             uC/FS V4
+*                                     The Embedded File System
+*
+*                         (c) Copyright 2008-2014; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/FS is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                       FILE SYSTEM BENCHMARK
+*
+*                                      SIMULATED NOR/NAND FLASH
+*
+* Filename      : fs_bench_flash.h
+* Version       : v4.07.00
+*
+* Note(s)       : (1) Host-only.  The simulated flash backs the NOR driver (through a physical-layer
+*                     driver) & the NAND generic controller (through a BSP) so that both FTLs run
+*                     unmodified on top of a memory image.
+*
+*                 (2) The model is deliberately simple :
+*
+*                     (a) A program operation can only clear bits; an erase sets a whole block to 0xFF.
+*
+*                     (b) Every operation adds a fixed setup latency plus a per-octet latency to a
+*                         simulated device clock.  No time actually elapses on the host.
+*
+*                     (c) NAND blocks may be factory bad (marked in the spare area of their first &
+*                         last page) or go bad at run-time with a configurable probability per
+*                         program/erase.  A grown bad block fails every later program/erase.
+*
+*                     (d) A power loss may be armed to fire on the n-th program/erase.  That operation
+*                         is torn (only half of it reaches the array) & no later program/erase reaches
+*                         the array until power is restored.  Those operations still report success :
+*                         the CPU would have stopped with the flash, so the file system must not be
+*                         sent down its error paths (some of which retry until they succeed).
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*/
+
+#ifndef  FS_BENCH_FLASH_PRESENT
+#define  FS_BENCH_FLASH_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                               EXTERNS
+*********************************************************************************************************
+*/
+
+#ifdef   FS_BENCH_FLASH_MODULE
+#define  FS_BENCH_FLASH_EXT
+#else
+#define  FS_BENCH_FLASH_EXT  extern
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <fs_err.h>
+#include  <fs_dev_nor.h>
+#ifdef   FS_BENCH_NAND_EN
+#include  <fs_dev_nand_ctrlr_gen.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      FLASH LATENCY MODEL DATA TYPE
+*
+* Note(s) : (1) All latencies are in nanoseconds.  A program is charged 'PgmSetup_ns' once per page
+*               touched, an erase 'Erase_ns' once per block.
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_bench_flash_lat {
+    CPU_INT32U           RdSetup_ns;                            /* Array-to-register time per rd op (NAND tR).          */
+    CPU_INT32U           RdOctet_ns;                            /* Bus time per rd octet.                               */
+    CPU_INT32U           PgmSetup_ns;                           /* Pg pgm time (NAND tPROG, NOR pg/buf pgm).            */
+    CPU_INT32U           PgmOctet_ns;                           /* Bus time per pgm octet.                              */
+    CPU_INT32U           Erase_ns;                              /* Blk erase time (NAND tBERS, NOR sector erase).       */
+} FS_BENCH_FLASH_LAT;
+
+
+/*
+*********************************************************************************************************
+*                                     FLASH STATISTICS DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_bench_flash_stat {
+    CPU_INT64U           RdOpCtr;                               /* Nbr of rd ops.                                       */
+    CPU_INT64U           RdOctetCtr;                            /* Nbr of octets rd.                                    */
+    CPU_INT64U           PgmOpCtr;                              /* Nbr of pg pgm ops.                                   */
+    CPU_INT64U           PgmOctetCtr;                           /* Nbr of octets pgm'd.                                 */
+    CPU_INT64U           EraseCtr;                              /* Nbr of blk erases.                                   */
+    CPU_INT32U           EraseFailCtr;                          /* Nbr of failed erases.                                */
+    CPU_INT32U           PgmFailCtr;                            /* Nbr of failed pgms.                                  */
+    CPU_INT32U           BadBlkGrownCtr;                        /* Nbr of blks gone bad at run-time.                    */
+    CPU_INT64U           Time_ns;                               /* Simulated dev busy time.                             */
+} FS_BENCH_FLASH_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                      SIMULATED FLASH DATA TYPE
+*
+* Note(s) : (1) The image holds, for each page, 'PgSize' data octets followed by 'SpareSize' spare
+*               octets.  For NOR, 'SpareSize' is 0 & 'PgSize' is the program (write-buffer) page.
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_bench_flash {
+    CPU_INT08U          *MemPtr;                                /* Flash image.                                         */
+    CPU_INT32U           BlkCnt;                                /* Nbr of blks.                                         */
+    CPU_INT32U           PgPerBlk;                              /* Nbr of pgs per blk.                                  */
+    CPU_INT32U           PgSize;                                /* Size of pg data area, in octets.                     */
+    CPU_INT32U           SpareSize;                             /* Size of pg spare area, in octets.                    */
+
+    CPU_INT32U          *EraseCntTbl;                           /* Erase cnt per blk.                                   */
+    CPU_BOOLEAN         *BadBlkTbl;                             /* Blk is (grown or factory) bad.                       */
+    CPU_INT32U           FailRate_ppm;                          /* Probability for a pgm/erase to grow a bad blk.       */
+    CPU_INT32U           Seed;                                  /* PRNG state.                                          */
+
+    CPU_INT32U           PwrLossCnt;                            /* Pgm/erase ops until pwr loss (0 if disarmed).        */
+    CPU_BOOLEAN          PwrLost;                               /* Pwr lost: pgm/erase dropped until restored.          */
+
+    FS_BENCH_FLASH_LAT   Lat;
+    FS_BENCH_FLASH_STAT  Stat;
+} FS_BENCH_FLASH;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+FS_BENCH_FLASH_EXT  FS_BENCH_FLASH              FSBench_NOR_Flash;
+extern              const  FS_DEV_NOR_PHY_API   FSDev_NOR_Sim;
+
+#ifdef   FS_BENCH_NAND_EN
+FS_BENCH_FLASH_EXT  FS_BENCH_FLASH              FSBench_NAND_Flash;
+extern              const  FS_NAND_CTRLR_GEN_BSP_API  FS_NAND_BSP_Sim;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void        FSBench_FlashInit       (FS_BENCH_FLASH            *p_flash,        /* Alloc & erase flash image.               */
+                                     CPU_INT32U                 blk_cnt,
+                                     CPU_INT32U                 pg_per_blk,
+                                     CPU_INT32U                 pg_size,
+                                     CPU_INT32U                 spare_size,
+                                     const  FS_BENCH_FLASH_LAT *p_lat,
+                                     FS_ERR                    *p_err);
+
+void        FSBench_FlashBadBlkSet  (FS_BENCH_FLASH            *p_flash,        /* Set factory bad blks & wear-out rate.    */
+                                     CPU_INT32U                 bad_blk_cnt,
+                                     CPU_INT32U                 fail_rate_ppm,
+                                     CPU_INT32U                 seed);
+
+void        FSBench_FlashStatClr    (FS_BENCH_FLASH            *p_flash);       /* Clr stats.                               */
+
+void        FSBench_FlashEraseCntGet(FS_BENCH_FLASH            *p_flash,        /* Get min/max blk erase cnt.               */
+                                     CPU_INT32U                *p_min,
+                                     CPU_INT32U                *p_max);
+
+void        FSBench_FlashPwrLossSet (FS_BENCH_FLASH            *p_flash,        /* Arm pwr loss on n-th pgm/erase.          */
+                                     CPU_INT32U                 op_cnt);
+
+void        FSBench_FlashPwrRestore (FS_BENCH_FLASH            *p_flash);       /* Restore pwr & disarm pwr loss.           */
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif                                                          /* End of fs_bench_flash module include.                */
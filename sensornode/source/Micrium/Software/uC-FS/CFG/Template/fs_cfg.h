@@ -112,6 +112,13 @@
 *          (13) Configure FS_CFG_BUF_ALIGN_OCTETS to set the minimum buffer alignement required in 
 *               octets. This configuration will be applied to filesystem buffers only. Application
 *               buffers allocated in the application are not verified for alignment.
+*
+*          (14) Configure FS_CFG_CACHE_MULTI_SEC_MAX with the maximum number of sectors the cache
+*               transfers in one device access.  When greater than 1, a transfer buffer of this many
+*               sectors is reserved in the cache memory :
+*               (a) Contiguous dirty sectors are written with a single multi-sector write when flushed.
+*               (b) Sequential file reads that miss the cache read ahead, the read-ahead window
+*                   doubling on each sequential miss up to this number of sectors.
 *********************************************************************************************************
 */
 
@@ -190,6 +197,10 @@
 #define  FS_CFG_BUF_ALIGN_OCTETS                 sizeof(CPU_DATA)
 
 
+                                                                /* Config max secs per cache dev access (see Note #14). */
+#define  FS_CFG_CACHE_MULTI_SEC_MAX                        8u
+
+
 /*
 *********************************************************************************************************
 *                             FILE SYSTEM NAME RESTRICTION CONFIGURATION
@@ -365,6 +376,37 @@
 *               (a) When ENABLED,  volume integrity can     be checked.  If enabled, FS_FAT_CFG_VOL_CHK_MAX_LEVELS
 *                   is the maximum number of directory levels that will be checked.
 *               (b) When DISABLED, volume integrity can NOT be checked.
+*
+*           (7) Configure FS_FAT_CFG_CLUS_MAP_EN to enable/disable the free cluster map :
+*               (a) When ENABLED,  a bitmap of the clusters that may be free is built when a volume is
+*                   opened & kept up to date as clusters are allocated & freed.  Free cluster searches
+*                   skip allocated regions without reading the FAT, & multi-cluster allocations are
+*                   placed in a single contiguous run whenever one exists.  FS_FAT_CFG_CLUS_MAP_SIZE
+*                   is the size of each volume's map, in octets; on volumes with more clusters than
+*                   map bits, each bit covers a group of clusters.
+*               (b) When DISABLED, the FAT is searched entry by entry.
+*
+*           (8) Configure FS_FAT_CFG_FILE_EXTENT_EN to enable/disable the file extent map :
+*               (a) When ENABLED,  each open file remembers up to FS_FAT_CFG_FILE_EXTENT_NBR runs of
+*                   contiguous clusters found while following its cluster chain, so that setting the
+*                   file position does not follow the chain from the file's first cluster.
+*               (b) When DISABLED, the cluster chain is followed from the file's first cluster.
+*
+*           (9) Configure FS_FAT_CFG_JOURNAL_GROUP_EN to enable/disable journal group commit :
+*               (a) When ENABLED,  the journal is not cleared after every top-level operation.  Logs of
+*                   successive operations accumulate & the journal is cleared (committed) once it holds
+*                   FS_FAT_CFG_JOURNAL_GROUP_SIZE octets or FS_FAT_CFG_JOURNAL_GROUP_OP_CNT operations,
+*                   or when FS_FAT_JournalCommit() or FS_FAT_JournalStop() is called.  Should power be
+*                   lost, operations performed since the last commit are reverted.
+*               (b) When DISABLED, the journal is cleared after every top-level operation.
+*
+*          (10) Configure FS_FAT_CFG_DIR_CACHE_EN to enable/disable the directory lookup cache :
+*               (a) When ENABLED,  the position of recently looked up directory entries, as well as the
+*                   absence of recently looked up names, is remembered per volume in a table of
+*                   FS_FAT_CFG_DIR_CACHE_NBR entries indexed by a hash of the parent directory & name,
+*                   so that opening a file does not scan its directory.  Path components longer than
+*                   FS_FAT_CFG_DIR_CACHE_NAME_LEN characters are not cached.
+*               (b) When DISABLED, each path component is found by scanning its directory.
 *********************************************************************************************************
 */
                                                                 /* Configure Long File Name support   (see Note #1) :   */
@@ -406,6 +448,54 @@
                                                                 /* Configure max levels chk'd (see Note #6).            */
 #define  FS_FAT_CFG_VOL_CHK_MAX_LEVELS                    20u
 
+
+                                                                /* Configure free cluster map (see Note #7) :           */
+#define  FS_FAT_CFG_CLUS_MAP_EN                  DEF_ENABLED
+                                                                /*   DEF_DISABLED   Free cluster map NOT used.          */
+                                                                /*   DEF_ENABLED    Free cluster map     used.          */
+
+
+                                                                /* Configure free cluster map size (see Note #7).       */
+#define  FS_FAT_CFG_CLUS_MAP_SIZE                       256u
+
+
+                                                                /* Configure file extent map (see Note #8) :            */
+#define  FS_FAT_CFG_FILE_EXTENT_EN               DEF_ENABLED
+                                                                /*   DEF_DISABLED   File extent map NOT used.           */
+                                                                /*   DEF_ENABLED    File extent map     used.           */
+
+
+                                                                /* Configure nbr of extents per file (see Note #8).     */
+#define  FS_FAT_CFG_FILE_EXTENT_NBR                       4u
+
+
+                                                                /* Configure journal group commit (see Note #9) :       */
+#define  FS_FAT_CFG_JOURNAL_GROUP_EN             DEF_DISABLED
+                                                                /*   DEF_DISABLED   Journal cleared after each op.      */
+                                                                /*   DEF_ENABLED    Journal cleared per group of ops.   */
+
+
+                                                                /* Configure group commit size, in octets (see Note #9).*/
+#define  FS_FAT_CFG_JOURNAL_GROUP_SIZE                 2048u
+
+
+                                                                /* Configure group commit op cnt (see Note #9).         */
+#define  FS_FAT_CFG_JOURNAL_GROUP_OP_CNT                 16u
+
+
+                                                                /* Configure dir lookup cache (see Note #10) :          */
+#define  FS_FAT_CFG_DIR_CACHE_EN                 DEF_ENABLED
+                                                                /*   DEF_DISABLED   Dir lookup cache NOT used.          */
+                                                                /*   DEF_ENABLED    Dir lookup cache     used.          */
+
+
+                                                                /* Configure nbr of dir cache entries (see Note #10).   */
+#define  FS_FAT_CFG_DIR_CACHE_NBR                        16u
+
+
+                                                                /* Configure max cached name len (see Note #10).        */
+#define  FS_FAT_CFG_DIR_CACHE_NAME_LEN                   24u
+
 /*
 *********************************************************************************************************
 *                           FILE SYSTEM SD/MMC DEVICE DRIVER CONFIGURATION
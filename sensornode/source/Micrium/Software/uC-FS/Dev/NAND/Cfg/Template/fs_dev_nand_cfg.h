@@ -127,6 +127,33 @@
 *               sequential update blocks (SUB). This value is set as a percentage of the total number
 *               of update blocks.
 *
+*           (9) FS_NAND_CFG_BG_MAINT_EN determines if FS_NAND_Maint() is available. When enabled, a low
+*               priority application task may call FS_NAND_Maint() during idle time to merge update
+*               blocks, fold the metadata block, refill the available blocks table and erase available
+*               blocks ahead of time. Each call performs at most one such operation with the device lock
+*               held, so foreground accesses are delayed by at most one block merge or erase. Writes
+*               then seldom have to perform this work themselves, which bounds their worst-case latency.
+*
+*          (10) FS_NAND_CFG_BG_TH_FREE_UB_CNT and FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT are the watermarks
+*               FS_NAND_Maint() maintains. An update block is merged in the background only while fewer
+*               than FS_NAND_CFG_BG_TH_FREE_UB_CNT update block slots are free, and only if it is full
+*               or idle (see FS_NAND_CFG_TH_SUB_MIN_IDLE_TO_FOLD); 'hot' update blocks are left alone.
+*               The available blocks table is refilled up to FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT entries
+*               (limited to the size of the table), which must exceed FS_NAND_CFG_RSVD_AVAIL_BLK_CNT.
+*
+*          (11) FS_NAND_CFG_HOT_COLD_EN determines if the write frequency of each logical block is tracked
+*               to separate frequently rewritten ('hot') data, such as file allocation tables and
+*               directories, from data written once ('cold'), such as logs. Hot and cold logical blocks
+*               are then associated with different random update blocks, which reduces merge copying,
+*               and cold data is placed on the most worn available blocks.
+*
+*               RAM usage = <Nbr of logical data blks> octets.
+*
+*          (12) FS_NAND_CFG_STATIC_WL_EN determines if FS_NAND_Maint() also performs static wear leveling.
+*               Cold data residing on a block whose erase count is at least FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF
+*               lower than the most worn available block is moved to that block, so that the little
+*               worn block is returned to circulation. Requires FS_NAND_CFG_BG_MAINT_EN.
+*
 *********************************************************************************************************
 */
 
@@ -160,6 +187,25 @@
                                                                 /* Config max pct of UB that can be SUB(see Note #8)  : */
 #define  FS_NAND_CFG_MAX_SUB_PCT                         30
 
+                                                                /* Config bg maint                     (see Note #9)  : */
+#define  FS_NAND_CFG_BG_MAINT_EN                 DEF_ENABLED
+                                                                /*   DEF_DISABLED   bg maint NOT present.               */
+                                                                /*   DEF_ENABLED    bg maint     present.               */
+
+                                                                /* Config bg maint watermarks          (see Note #10) : */
+#define  FS_NAND_CFG_BG_TH_FREE_UB_CNT                    1u
+#define  FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT                  6u
+
+                                                                /* Config hot/cold data separation     (see Note #11) : */
+#define  FS_NAND_CFG_HOT_COLD_EN                 DEF_ENABLED
+                                                                /*   DEF_DISABLED   hot/cold separation disabled.       */
+                                                                /*   DEF_ENABLED    hot/cold separation enabled.        */
+
+                                                                /* Config static wear leveling         (see Note #12) : */
+#define  FS_NAND_CFG_STATIC_WL_EN                DEF_ENABLED
+                                                                /*   DEF_DISABLED   static wear leveling disabled.      */
+                                                                /*   DEF_ENABLED    static wear leveling enabled.       */
+
 
 /*
 *********************************************************************************************************
@@ -181,6 +227,12 @@
 #define  FS_NAND_CFG_TH_PCT_MERGE_SUB                    10
 #define  FS_NAND_CFG_TH_SUB_MIN_IDLE_TO_FOLD              5
 
+                                                                /* Config th (see FS_NAND_BlkHeatInc() note #1).        */
+#define  FS_NAND_CFG_TH_HOT_WR_CNT                        4u
+
+                                                                /* Config th (see FS_NAND_StaticWL() note #1).          */
+#define  FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF               100u
+
 
 /*
 *********************************************************************************************************
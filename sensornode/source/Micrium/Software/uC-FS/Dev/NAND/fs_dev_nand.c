@@ -202,6 +202,9 @@ typedef  struct  fs_nand_ub_extra_data {
     FS_NAND_ASSOC_BLK_QTY     AssocLvl;                         /* Assoc lvl, nbr of associated logical blks.           */
     FS_NAND_SEC_PER_BLK_QTY   NextSecIx;                        /* Ix of next empty sec of UB.                          */
     CPU_INT16U                ActivityCtr;                      /* Ctr updated on wr. Allows idleness calc.             */
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+    CPU_BOOLEAN               Hot;                              /* RUB stream (see FS_NAND_UB_Alloc() Note #4).         */
+#endif
 #if (FS_NAND_CFG_UB_META_CACHE_EN == DEF_ENABLED)
     CPU_INT08U               *MetaCachePtr;                     /* Optional cache of meta.                              */
 #endif
@@ -274,10 +277,21 @@ struct  fs_nand_data {
     CPU_BOOLEAN               AvailBlkTblInvalidated;           /* Flag actived when avail blk tbl changes.             */
     CPU_INT08U               *AvailBlkTblCommitMap;             /* Bitmap indicating commit state of avail blks.        */
     FS_NAND_BLK_QTY           AvailBlkTblEntryCntMax;           /* Nbr of entries in avail blk tbl.                     */
+#if (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED)
+    FS_NAND_BLK_QTY           AvailBlkTblEraseSrchPos;          /* Cur srch pos in avail blk tbl for bg erase.          */
+#endif
 
                                                                 /* ---------------- UNPACKED METADATA ----------------- */
     FS_NAND_BLK_QTY          *LogicalToPhyBlkMap;               /* Logical to phy blk ix map.                           */
 
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)                    /* ------------------ HOT/COLD INFO ------------------- */
+    CPU_INT08U               *LogicalBlkHeatTbl;                /* Aged rewrite cnt of logical blks.                    */
+    FS_NAND_BLK_QTY           LogicalBlkHeatAgeCtr;             /* Nbr of heat incs since last aging.                   */
+#endif
+#if (FS_NAND_CFG_STATIC_WL_EN == DEF_ENABLED)
+    FS_NAND_BLK_QTY           WL_SrchPos;                       /* Cur srch pos in logical blks for static WL.          */
+#endif
+
                                                                 /* --------------------- UB info ---------------------- */
     FS_NAND_UB_QTY            UB_CntMax;                        /* Max nbr of UBs.                                      */
     CPU_INT08U                UB_SecMapNbrBits;                 /* Resolution in bits of UB sec mapping.                */
@@ -505,6 +519,12 @@ const  FS_NAND_CFG  FS_NAND_DfltCfg = { FS_NAND_CFG_FIELDS };
 
 #define  FS_NAND_UB_IX_TO_LOG_BLK_IX(p_nand_data, ub_ix)     (FS_NAND_BLK_QTY)((ub_ix)   + (p_nand_data)->LogicalDataBlkCnt)
 
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)                    /* See FS_NAND_BlkHeatInc() Note #1.                    */
+#define  FS_NAND_BLK_IS_HOT(         p_nand_data, blk_ix)    (((p_nand_data)->LogicalBlkHeatTbl[blk_ix] >= FS_NAND_CFG_TH_HOT_WR_CNT) ? DEF_YES : DEF_NO)
+#else
+#define  FS_NAND_BLK_IS_HOT(         p_nand_data, blk_ix)     DEF_NO
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -576,6 +596,19 @@ FS_NAND_INTERN  void                     FS_NAND_LowMountHandler       (FS_NAND_
 FS_NAND_INTERN  void                     FS_NAND_LowUnmountHandler     (FS_NAND_DATA             *p_nand_data,
                                                                         FS_ERR                   *p_err);
 
+#if ((FS_CFG_RD_ONLY_EN       == DEF_DISABLED) && \
+     (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED))
+                                                                /* Perform one bg maint step.                           */
+FS_NAND_INTERN  CPU_BOOLEAN              FS_NAND_MaintHandler          (FS_NAND_DATA             *p_nand_data,
+                                                                        FS_ERR                   *p_err);
+
+#if (FS_NAND_CFG_STATIC_WL_EN == DEF_ENABLED)
+                                                                /* Move one cold blk to a worn blk.                     */
+FS_NAND_INTERN  CPU_BOOLEAN              FS_NAND_StaticWL              (FS_NAND_DATA             *p_nand_data,
+                                                                        FS_ERR                   *p_err);
+#endif
+#endif
+
 #if (FS_NAND_CFG_DUMP_SUPPORT_EN == DEF_ENABLED)                /* Dump raw NAND device.                                */
 FS_NAND_INTERN  void                     FS_NAND_DumpHandler           (FS_NAND_DATA             *p_nand_data,
                                                                         void                    (*dump_fnct)(void        *buf,
@@ -691,8 +724,15 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY          FS_NAND_BlkIxPhyGet           (FS_NAND_
                                                                 /* Refresh blk.                                         */
 FS_NAND_INTERN  void                     FS_NAND_BlkRefresh            (FS_NAND_DATA             *p_nand_data,
                                                                         FS_NAND_BLK_QTY           blk_ix_phy,
+                                                                        CPU_BOOLEAN               worn,
                                                                         FS_ERR                   *p_err);
 
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+                                                                /* Inc heat of logical blk.                             */
+FS_NAND_INTERN  void                     FS_NAND_BlkHeatInc            (FS_NAND_DATA             *p_nand_data,
+                                                                        FS_NAND_BLK_QTY           blk_ix_logical);
+#endif
+
                                                                 /* Mark blk as bad.                                     */
 FS_NAND_INTERN  void                     FS_NAND_BlkMarkBad            (FS_NAND_DATA             *p_nand_data,
                                                                         FS_NAND_BLK_QTY           blk_ix_phy,
@@ -718,6 +758,7 @@ FS_NAND_INTERN  FS_NAND_ERASE_QTY        FS_NAND_BlkRemFromAvail       (FS_NAND_
                                                                 /* Get blk from avail blk tbl.                          */
 FS_NAND_INTERN  FS_NAND_BLK_QTY          FS_NAND_BlkGetAvailFromTbl    (FS_NAND_DATA             *p_nand_data,
                                                                         CPU_BOOLEAN               access_rsvd,
+                                                                        CPU_BOOLEAN               worn,
                                                                         FS_ERR                   *p_err);
 
                                                                 /* Get blk with committed dirty state.                  */
@@ -727,6 +768,7 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY          FS_NAND_BlkGetDirty           (FS_NAND_
 
                                                                 /* Get an avail, erased blk.                            */
 FS_NAND_INTERN  FS_NAND_BLK_QTY          FS_NAND_BlkGetErased          (FS_NAND_DATA             *p_nand_data,
+                                                                        CPU_BOOLEAN               worn,
                                                                         FS_ERR                   *p_err);
 
                                                                 /* Make sure blk is erased.                             */
@@ -894,6 +936,7 @@ FS_NAND_INTERN  void                     FS_NAND_UB_IncAssoc           (FS_NAND_
                                                                 /* Alloc a new UB.                                      */
 FS_NAND_INTERN  FS_NAND_UB_QTY           FS_NAND_UB_Alloc              (FS_NAND_DATA             *p_nand_data,
                                                                         CPU_BOOLEAN               sequential,
+                                                                        CPU_BOOLEAN               hot,
                                                                         FS_ERR                   *p_err);
 
                                                                 /* Alloc a new RUB.                                    */
@@ -1071,6 +1114,75 @@ const  FS_DEV_API  FS_NAND = {
 #error "FS_NAND_CFG_MAX_SUB_PCT must not be larger than 100"
 #endif
 
+#ifndef  FS_NAND_CFG_BG_MAINT_EN
+#error  "FS_NAND_CFG_BG_MAINT_EN                  not #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED]"
+#error  "                                       [     ||  DEF_ENABLED ]"
+
+#elif  ((FS_NAND_CFG_BG_MAINT_EN != DEF_DISABLED) && \
+        (FS_NAND_CFG_BG_MAINT_EN != DEF_ENABLED ))
+#error  "FS_NAND_CFG_BG_MAINT_EN            illegally #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED]"
+#error  "                                       [     ||  DEF_ENABLED ]"
+
+#elif   (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED)
+#ifndef FS_NAND_CFG_BG_TH_FREE_UB_CNT
+#error "FS_NAND_CFG_BG_TH_FREE_UB_CNT must be #define'd in fs_dev_nand_cfg.h"
+#elif  (FS_NAND_CFG_BG_TH_FREE_UB_CNT < 1u)
+#error "FS_NAND_CFG_BG_TH_FREE_UB_CNT must be at least 1"
+#endif
+
+#ifndef FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT
+#error "FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT must be #define'd in fs_dev_nand_cfg.h"
+#elif  (FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT <= FS_NAND_CFG_RSVD_AVAIL_BLK_CNT)
+#error "FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT must be greater than FS_NAND_CFG_RSVD_AVAIL_BLK_CNT"
+#endif
+#endif
+
+#ifndef  FS_NAND_CFG_HOT_COLD_EN
+#error  "FS_NAND_CFG_HOT_COLD_EN                  not #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED]"
+#error  "                                       [     ||  DEF_ENABLED ]"
+
+#elif  ((FS_NAND_CFG_HOT_COLD_EN != DEF_DISABLED) && \
+        (FS_NAND_CFG_HOT_COLD_EN != DEF_ENABLED ))
+#error  "FS_NAND_CFG_HOT_COLD_EN            illegally #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED]"
+#error  "                                       [     ||  DEF_ENABLED ]"
+
+#elif   (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+#ifndef FS_NAND_CFG_TH_HOT_WR_CNT
+#error "FS_NAND_CFG_TH_HOT_WR_CNT must be #define'd in fs_dev_nand_cfg.h"
+#elif  ((FS_NAND_CFG_TH_HOT_WR_CNT < 1u) || \
+        (FS_NAND_CFG_TH_HOT_WR_CNT > 255u))
+#error "FS_NAND_CFG_TH_HOT_WR_CNT must be between 1 and 255"
+#endif
+#endif
+
+#ifndef  FS_NAND_CFG_STATIC_WL_EN
+#error  "FS_NAND_CFG_STATIC_WL_EN                 not #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED]"
+#error  "                                       [     ||  DEF_ENABLED ]"
+
+#elif  ((FS_NAND_CFG_STATIC_WL_EN != DEF_DISABLED) && \
+        (FS_NAND_CFG_STATIC_WL_EN != DEF_ENABLED ))
+#error  "FS_NAND_CFG_STATIC_WL_EN           illegally #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED]"
+#error  "                                       [     ||  DEF_ENABLED ]"
+
+#elif   (FS_NAND_CFG_STATIC_WL_EN == DEF_ENABLED)
+#if     (FS_NAND_CFG_BG_MAINT_EN  != DEF_ENABLED)
+#error  "FS_NAND_CFG_STATIC_WL_EN           illegally #define'd in 'fs_dev_nand_cfg.h'"
+#error  "                                       [MUST be  DEF_DISABLED if FS_NAND_CFG_BG_MAINT_EN is DEF_DISABLED]"
+#endif
+
+#ifndef FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF
+#error "FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF must be #define'd in fs_dev_nand_cfg.h"
+#elif  (FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF < 1u)
+#error "FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF must be at least 1"
+#endif
+#endif
+
 #ifndef FS_NAND_CFG_TH_PCT_MERGE_RUB_START_SUB
 #error "FS_NAND_CFG_TH_PCT_MERGE_RUB_START_SUB must be #define'd in fs_dev_nand_cfg.h"
 #elif  (FS_NAND_CFG_TH_PCT_MERGE_RUB_START_SUB < 0)
@@ -1361,6 +1473,96 @@ void  FS_NAND_LowUnmount (CPU_CHAR  *p_name_dev,
 }
 
 
+/*
+*********************************************************************************************************
+*                                           FS_NAND_Maint()
+*
+* Description : Perform one background maintenance step on a NAND device.
+*
+* Argument(s) : p_name_dev  Device name (see Note #1).
+*
+*               p_err       Pointer to variable that will receive return the error code from this function :
+*
+*                               FS_ERR_DEV_INVALID      Argument 'name_dev' specifies an invalid device.
+*                               FS_ERR_NAME_NULL        Argument 'name_dev' passed a NULL pointer.
+*                               FS_ERR_NONE             Maintenance step performed successfully.
+*
+*                               ----------------------RETURNED BY FSDev_IO_Ctrl()-----------------------
+*                               See FSDev_IO_Ctrl() for additional return error codes.
+*
+* Return(s)   : DEF_YES, if maintenance work was performed (more might be pending),
+*               DEF_NO , otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a file system suite application (API) function & MAY be called
+*               by application function(s).
+*
+* Note(s)     : (1) The device MUST be a NAND device (e.g., "nand:0:").
+*
+*               (2) This function is intended to be called from a low-priority application task. Each
+*                   call holds the device lock for at most one update block merge, metadata block fold,
+*                   available block table refill or block erase (see FS_NAND_MaintHandler()). A typical
+*                   task calls FS_NAND_Maint() repeatedly while it returns DEF_YES, then sleeps for a
+*                   period before calling it again :
+*
+*                       while (DEF_ON) {
+*                           while (FS_NAND_Maint("nand:0:", &err) == DEF_YES) {
+*                               ;
+*                           }
+*                           <delay>;
+*                       }
+*********************************************************************************************************
+*/
+
+#if ((FS_CFG_RD_ONLY_EN       == DEF_DISABLED) && \
+     (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED))
+CPU_BOOLEAN  FS_NAND_Maint (CPU_CHAR  *p_name_dev,
+                            FS_ERR    *p_err)
+{
+    CPU_BOOLEAN  work_done;
+    CPU_INT16S   cmp_val;
+
+
+#if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)                  /* ------------------- VALIDATE ARGS ------------------ */
+    if (p_err == DEF_NULL) {                                    /* Validate err  ptr.                                   */
+        CPU_SW_EXCEPTION(DEF_NO);
+    }
+
+    if (p_name_dev == DEF_NULL) {                               /* Validate name ptr.                                   */
+       *p_err = FS_ERR_NAME_NULL;
+        return (DEF_NO);
+    }
+#endif
+
+                                                                /* Validate name str (see Note #1).                     */
+    cmp_val = Str_Cmp_N(p_name_dev, (CPU_CHAR *)FS_NAND_DrvName, FS_NAND_DRV_NAME_LEN);
+    if (cmp_val != 0) {
+       *p_err = FS_ERR_DEV_INVALID;
+        return (DEF_NO);
+    }
+
+    if (p_name_dev[FS_NAND_DRV_NAME_LEN] != FS_CHAR_DEV_SEP) {
+       *p_err = FS_ERR_DEV_INVALID;
+        return (DEF_NO);
+    }
+
+
+                                                                /* ----------------- PERFORM MAINT STEP --------------- */
+    work_done = DEF_NO;
+    FSDev_IO_Ctrl(p_name_dev,
+                  FS_DEV_IO_CTRL_NAND_MAINT,
+                  (void *)&work_done,
+                  p_err);
+    if (*p_err != FS_ERR_NONE) {
+        return (DEF_NO);
+    }
+
+    return (work_done);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -2252,6 +2454,8 @@ FS_NAND_INTERN  void  FS_NAND_Query (FS_DEV       *p_dev,
 *                   (j) FS_DEV_IO_CTRL_PHY_RD_PAGE       Read  physical device page.
 *                   (k) FS_DEV_IO_CTRL_PHY_WR_PAGE       Write physical device page.
 *                   (l) FS_DEV_IO_CTRL_PHY_ERASE_BLK     Erase physical device block.
+*                   (m) FS_DEV_IO_CTRL_NAND_MAINT        Perform one background maintenance step.
+*                   (n) FS_DEV_IO_CTRL_NAND_WR_AMP_GET   Get write amplification counters.
 *
 *                   Not all of these operations are valid for all devices.
 *********************************************************************************************************
@@ -2265,6 +2469,9 @@ FS_NAND_INTERN  void  FS_NAND_IO_Ctrl (FS_DEV      *p_dev,
     FS_NAND_DATA          *p_nand_data;
     FS_NAND_CTRLR_API     *p_ctrlr_api;
     FS_NAND_IO_CTRL_DATA  *p_io_ctrl_data;
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+    FS_NAND_WR_AMP_INFO   *p_wr_amp_info;
+#endif
     void                  *p_ctrlr_data;
 
 #if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)                  /* ------------------- VALIDATE ARGS ------------------ */
@@ -2281,6 +2488,8 @@ FS_NAND_INTERN  void  FS_NAND_IO_Ctrl (FS_DEV      *p_dev,
         case FS_DEV_IO_CTRL_WR_SEC         :
         case FS_DEV_IO_CTRL_PHY_ERASE_BLK  :
         case FS_DEV_IO_CTRL_NAND_DUMP      :
+        case FS_DEV_IO_CTRL_NAND_MAINT     :
+        case FS_DEV_IO_CTRL_NAND_WR_AMP_GET:
              if (p_data == DEF_NULL) {
                 *p_err = FS_ERR_NULL_PTR;
                  return;
@@ -2398,6 +2607,35 @@ FS_NAND_INTERN  void  FS_NAND_IO_Ctrl (FS_DEV      *p_dev,
 #endif
              break;
 
+        case FS_DEV_IO_CTRL_NAND_MAINT:                         /* Perform one bg maint step.                           */
+#if ((FS_CFG_RD_ONLY_EN       == DEF_DISABLED) && \
+     (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED))
+             if (p_nand_data->Fmtd == DEF_YES) {
+                *(CPU_BOOLEAN *)p_data = FS_NAND_MaintHandler(p_nand_data, p_err);
+             } else {
+                *p_err = FS_ERR_DEV_INVALID_LOW_FMT;
+             }
+#else
+            *p_err = FS_ERR_DEV_INVALID_IO_CTRL;
+#endif
+             break;
+
+        case FS_DEV_IO_CTRL_NAND_WR_AMP_GET:                    /* Get wr amplification ctrs.                           */
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+             p_wr_amp_info                = (FS_NAND_WR_AMP_INFO *)p_data;
+             p_wr_amp_info->HostSecWrCnt  =  p_nand_data->Ctrs.StatWrCtr;
+             p_wr_amp_info->DataSecWrCnt  =  p_nand_data->Ctrs.StatPhySecWrCtr;
+             p_wr_amp_info->MetaSecWrCnt  =  p_nand_data->Ctrs.StatMetaSecWrCtr;
+             p_wr_amp_info->BlkEraseCnt   =  p_nand_data->Ctrs.StatBlkEraseCtr;
+             p_wr_amp_info->MergeCnt      =  p_nand_data->Ctrs.StatSUB_MergeCtr
+                                          +  p_nand_data->Ctrs.StatRUB_MergeCtr
+                                          +  p_nand_data->Ctrs.StatRUB_PartialMergeCtr;
+             p_wr_amp_info->WL_BlkMoveCnt =  p_nand_data->Ctrs.StatWL_BlkMoveCtr;
+#else
+            *p_err = FS_ERR_DEV_INVALID_IO_CTRL;
+#endif
+             break;
+
         case FS_DEV_IO_CTRL_PHY_RD:
         case FS_DEV_IO_CTRL_PHY_WR:
         case FS_DEV_IO_CTRL_LOW_COMPACT:
@@ -2923,6 +3161,56 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkIxPhyGet (FS_NAND_DATA     *p_nand_d
 }
 
 
+/*
+*********************************************************************************************************
+*                                         FS_NAND_BlkHeatInc()
+*
+* Description : Account for a random write to the specified logical block.
+*
+* Argument(s) : p_nand_data     Pointer to NAND data.
+*               -----------     Argument validated by caller.
+*
+*               blk_ix_logical  Index of logical block.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_NAND_SecWr().
+*
+* Note(s)     : (1) The heat of a logical block is incremented for every sector written to it while it
+*                   is associated with a random update block. Sectors written in sequence go through
+*                   sequential update blocks and leave the heat unchanged. A block is considered 'hot'
+*                   while its heat is greater than or equal to FS_NAND_CFG_TH_HOT_WR_CNT.
+*
+*               (2) Heat is aged by halving every entry once the number of increments reaches the number
+*                   of logical data blocks, so that a block must keep being rewritten more often than
+*                   average to remain hot.
+*********************************************************************************************************
+*/
+
+#if ((FS_CFG_RD_ONLY_EN       == DEF_DISABLED) && \
+     (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED))
+FS_NAND_INTERN  void  FS_NAND_BlkHeatInc (FS_NAND_DATA     *p_nand_data,
+                                          FS_NAND_BLK_QTY   blk_ix_logical)
+{
+    FS_NAND_BLK_QTY  ix;
+
+
+    if (p_nand_data->LogicalBlkHeatTbl[blk_ix_logical] < DEF_INT_08U_MAX_VAL) {
+        p_nand_data->LogicalBlkHeatTbl[blk_ix_logical]++;
+    }
+
+                                                                /* -------------- AGE HEAT (see Note #2) -------------- */
+    p_nand_data->LogicalBlkHeatAgeCtr++;
+    if (p_nand_data->LogicalBlkHeatAgeCtr >= p_nand_data->LogicalDataBlkCnt) {
+        p_nand_data->LogicalBlkHeatAgeCtr = 0u;
+        for (ix = 0u; ix < p_nand_data->LogicalDataBlkCnt; ix++) {
+            p_nand_data->LogicalBlkHeatTbl[ix] >>= 1u;
+        }
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          FS_NAND_BlkRefresh()
@@ -2935,6 +3223,10 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkIxPhyGet (FS_NAND_DATA     *p_nand_d
 *
 *               blk_ix_phy      Block's physical index.
 *
+*               worn            DEF_YES, if the most worn available block should be used (see
+*                                        FS_NAND_BlkGetAvailFromTbl() Note #3),
+*                               DEF_NO , otherwise.
+*
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *               -----           Argument validated by caller.
 *
@@ -2969,6 +3261,7 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkIxPhyGet (FS_NAND_DATA     *p_nand_d
 #if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
 FS_NAND_INTERN  void  FS_NAND_BlkRefresh (FS_NAND_DATA     *p_nand_data,
                                           FS_NAND_BLK_QTY   blk_ix_phy,
+                                          CPU_BOOLEAN       worn,
                                           FS_ERR           *p_err)
 {
     FS_NAND_CTRLR_API        *p_ctrlr_api;
@@ -3002,7 +3295,7 @@ FS_NAND_INTERN  void  FS_NAND_BlkRefresh (FS_NAND_DATA     *p_nand_data,
         uncorrectable_err_occured = DEF_NO;
 
                                                                 /* ------------------ GET ERASED BLK ------------------ */
-        new_blk_ix_phy = FS_NAND_BlkGetErased(p_nand_data, p_err);
+        new_blk_ix_phy = FS_NAND_BlkGetErased(p_nand_data, worn, p_err);
         if (*p_err != FS_ERR_NONE) {
             FS_NAND_TRACE_DBG(("FSDev_NAND_BlkRefresh(): Unable to get an erased block.\r\n"));
             return;
@@ -3082,6 +3375,7 @@ FS_NAND_INTERN  void  FS_NAND_BlkRefresh (FS_NAND_DATA     *p_nand_data,
                                    p_oos_buf,
                                    new_sec_ix_phy,
                                    p_err);
+                FS_CTR_STAT_INC(p_nand_data->Ctrs.StatPhySecWrCtr);
                 switch (*p_err) {
                     case FS_ERR_DEV_IO:                         /* If pgrm op failed ...                                */
                          FS_NAND_TRACE_DBG(("FS_NAND_BlkRefresh(): Sector programming error at sec %u, marking block as bad.\r\n",
@@ -3595,6 +3889,9 @@ FS_NAND_INTERN  FS_NAND_ERASE_QTY  FS_NAND_BlkRemFromAvail (FS_NAND_DATA     *p_
 *               access_rsvd     DEF_YES, if access to reserved blocks is allowed,
 *                               DEF_NO , otherwise.
 *
+*               worn            DEF_YES, if the most worn committed block should be returned (see Note #3),
+*                               DEF_NO , otherwise.
+*
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *               -----           Argument validated by caller.
 *
@@ -3614,35 +3911,46 @@ FS_NAND_INTERN  FS_NAND_ERASE_QTY  FS_NAND_BlkRemFromAvail (FS_NAND_DATA     *p_
 *               (2) Some available blocks are reserved for metadata blocks folding. Those entries will only
 *                   be returned if access_rsvd has value DEF_YES. Only FS_NAND_MetaBlkFold() should
 *                   call this function with access_rsvd set to DEF_YES.
+*
+*               (3) Blocks are normally taken in increasing erase count order. Static wear leveling
+*                   instead requests the most worn committed block, on which it places data that is not
+*                   expected to be rewritten soon (see FS_NAND_StaticWL()).
 *********************************************************************************************************
 */
 
 #if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
 FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetAvailFromTbl (FS_NAND_DATA  *p_nand_data,
                                                              CPU_BOOLEAN    access_rsvd,
+                                                             CPU_BOOLEAN    worn,
                                                              FS_ERR        *p_err)
 {
     FS_NAND_BLK_QTY          tbl_ix;
     FS_NAND_BLK_QTY          tbl_ix_committed;
+    FS_NAND_BLK_QTY          tbl_ix_worn;
     FS_NAND_BLK_QTY          blk_ix_phy;
     FS_NAND_BLK_QTY          blk_ix_phy_not_committed;
     FS_NAND_BLK_QTY          blk_ix_phy_committed;
+    FS_NAND_BLK_QTY          blk_ix_phy_worn;
     FS_NAND_BLK_QTY          nbr_entries;
     FS_NAND_BLK_QTY          nbr_entries_committed;
     FS_NAND_AVAIL_BLK_ENTRY  tbl_entry;
     FS_NAND_ERASE_QTY        min_erase_cnt;
     FS_NAND_ERASE_QTY        min_erase_cnt_committed;
+    FS_NAND_ERASE_QTY        max_erase_cnt_committed;
     CPU_BOOLEAN              is_entry_committed;
 
 
     min_erase_cnt            = DEF_GET_U_MAX_VAL(min_erase_cnt);
     min_erase_cnt_committed  = DEF_GET_U_MAX_VAL(min_erase_cnt_committed);
+    max_erase_cnt_committed  = 0u;
     nbr_entries              = 0u;
     nbr_entries_committed    = 0u;
     blk_ix_phy               = FS_NAND_BLK_IX_INVALID;
     blk_ix_phy_not_committed = FS_NAND_BLK_IX_INVALID;
     blk_ix_phy_committed     = FS_NAND_BLK_IX_INVALID;
+    blk_ix_phy_worn          = FS_NAND_BLK_IX_INVALID;
     tbl_ix_committed         = FS_NAND_BLK_IX_INVALID;
+    tbl_ix_worn              = FS_NAND_BLK_IX_INVALID;
 
 
                                                                 /* -------------------- FIND BLKS --------------------- */
@@ -3661,6 +3969,12 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetAvailFromTbl (FS_NAND_DATA  *p_na
                     min_erase_cnt_committed  = tbl_entry.EraseCnt;
                     blk_ix_phy_committed     = tbl_entry.BlkIxPhy;
                     tbl_ix_committed         = tbl_ix;
+                }
+                                                                /* Find committed avail blk with highest erase cnt.     */
+                if (tbl_entry.EraseCnt      >= max_erase_cnt_committed) {
+                    max_erase_cnt_committed  = tbl_entry.EraseCnt;
+                    blk_ix_phy_worn          = tbl_entry.BlkIxPhy;
+                    tbl_ix_worn              = tbl_ix;
                 }
 
             } else {
@@ -3683,7 +3997,11 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetAvailFromTbl (FS_NAND_DATA  *p_na
         FSUtil_MapBitClr(p_nand_data->AvailBlkTblCommitMap, tbl_ix_committed);
 
     } else if (nbr_entries_committed > FS_NAND_CFG_RSVD_AVAIL_BLK_CNT) {
-        if ( min_erase_cnt_committed < min_erase_cnt) {
+        if (worn == DEF_YES) {                                  /* Most worn blk requested (see Note #3).               */
+            blk_ix_phy = blk_ix_phy_worn;
+                                                                /* Prevent entry from being used again.                 */
+            FSUtil_MapBitClr(p_nand_data->AvailBlkTblCommitMap, tbl_ix_worn);
+        } else if ( min_erase_cnt_committed < min_erase_cnt) {
             blk_ix_phy = blk_ix_phy_committed;
                                                                 /* Prevent entry from being used again.                 */
             FSUtil_MapBitClr(p_nand_data->AvailBlkTblCommitMap, tbl_ix_committed);
@@ -3807,7 +4125,7 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetDirty (FS_NAND_DATA  *p_nand_data
         }
 
                                                                 /* Calc and apply mask.                                 */
-        mask  = DEF_BIT_FIELD((CPU_INT08U)(mask_end_pos - word_offset), word_offset);
+        mask  = DEF_BIT_FIELD_32((CPU_INT08U)(mask_end_pos - word_offset), word_offset);
         word &= mask;
 
         while ((word != 0u) &&                                  /* If not null, there is a dirty blk in range.          */
@@ -3930,6 +4248,10 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetDirty (FS_NAND_DATA  *p_nand_data
 * Argument(s) : p_nand_data     Pointer to NAND data.
 *               -----------     Argument validated by caller.
 *
+*               worn            DEF_YES, if the most worn available block should be returned (see
+*                                        FS_NAND_BlkGetAvailFromTbl() Note #3),
+*                               DEF_NO , otherwise.
+*
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *               -----           Argument validated by caller.
 *
@@ -3962,6 +4284,7 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetDirty (FS_NAND_DATA  *p_nand_data
 
 #if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
 FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetErased (FS_NAND_DATA  *p_nand_data,
+                                                       CPU_BOOLEAN    worn,
                                                        FS_ERR        *p_err)
 {
     FS_NAND_BLK_QTY  blk_ix_phy;
@@ -4018,7 +4341,7 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetErased (FS_NAND_DATA  *p_nand_dat
         avail_blk_cnt = FS_NAND_AvailBlkTblEntryCnt(p_nand_data);
         if (avail_blk_cnt >= FS_NAND_CFG_RSVD_AVAIL_BLK_CNT + 1u) {
                                                                 /* Get a new avail blk.                                 */
-            blk_ix_phy = FS_NAND_BlkGetAvailFromTbl(p_nand_data, DEF_NO, p_err);
+            blk_ix_phy = FS_NAND_BlkGetAvailFromTbl(p_nand_data, DEF_NO, worn, p_err);
             if (*p_err != FS_ERR_NONE) {
                 FS_NAND_TRACE_DBG(("FS_NAND_BlkGetErased(): Fatal error getting an available block."));
                 return (FS_NAND_BLK_IX_INVALID);
@@ -4076,6 +4399,7 @@ FS_NAND_INTERN  FS_NAND_BLK_QTY  FS_NAND_BlkGetErased (FS_NAND_DATA  *p_nand_dat
 *
 * Caller(s)   : FS_NAND_BlkGetErased(),
 *               FS_NAND_BlkRefresh(),
+*               FS_NAND_MaintHandler(),
 *               FS_NAND_MetaBlkFold().
 *
 * Note(s)     : none.
@@ -5297,7 +5621,8 @@ FS_NAND_INTERN  void  FS_NAND_MetaBlkAvailParse(FS_NAND_DATA  *p_nand_data,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FS_NAND_MetaSecCommit(),
+* Caller(s)   : FS_NAND_MaintHandler(),
+*               FS_NAND_MetaSecCommit(),
 *               FS_NAND_MetaSecWrHandler().
 *
 * Note(s)     : (1) When folding a metadata block it is impossible to add a new block to the available
@@ -5333,6 +5658,7 @@ FS_NAND_INTERN  void  FS_NAND_MetaBlkFold (FS_NAND_DATA  *p_nand_data,
                                                                 /* Find avail blk.                                      */
         blk_ix_phy_new = FS_NAND_BlkGetAvailFromTbl(p_nand_data,
                                                     DEF_YES,
+                                                    DEF_NO,
                                                     p_err);
         if (*p_err != FS_ERR_NONE) {
             FS_NAND_TRACE_DBG(("FS_NAND_MetaBlkFold(): Fatal exception. Unable to get a new metadata block.\r\n"));
@@ -6089,6 +6415,7 @@ FS_NAND_INTERN  void  FS_NAND_AvailBlkTblEntryWr (FS_NAND_DATA             *p_na
 *
 * Caller(s)   : FS_NAND_BlkGetErased(),
 *               FS_NAND_LowFmtHandler(),
+*               FS_NAND_MaintHandler(),
 *               FS_NAND_MetaBlkFold().
 *
 * Note(s)     : none.
@@ -6158,7 +6485,8 @@ FS_NAND_INTERN  void  FS_NAND_AvailBlkTblFill (FS_NAND_DATA     *p_nand_data,
 * Return(s)   : number of available blocks in the available blocks table.
 *
 * Caller(s)   : FS_NAND_BlkGetErased(),
-*               FS_NAND_AvailBlkTblFill().
+*               FS_NAND_AvailBlkTblFill(),
+*               FS_NAND_MaintHandler().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -6329,6 +6657,7 @@ FS_NAND_INTERN  void  FS_NAND_UB_Create (FS_NAND_DATA    *p_nand_data,
 
                                                                 /* ------------------ GET ERASED BLK ------------------ */
     blk_ix_phy = FS_NAND_BlkGetErased(p_nand_data,
+                                      DEF_NO,
                                       p_err);
     if (*p_err != FS_ERR_NONE) {
         FS_NAND_TRACE_DBG(("FS_NAND_UB_Create(): Unable to get an erased block.\r\n"));
@@ -6581,6 +6910,9 @@ FS_NAND_INTERN  void  FS_NAND_UB_Load (FS_NAND_DATA     *p_nand_data,
     }
 
     p_entry_extra->ActivityCtr = 0u;
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+    p_entry_extra->Hot         = DEF_NO;
+#endif
 
                                                                 /* ---------------- CHK IF UB IS A SUB ---------------- */
     if ((blk_is_sequential == DEF_YES) &&
@@ -6644,6 +6976,9 @@ FS_NAND_INTERN  void  FS_NAND_UB_Clr (FS_NAND_DATA    *p_nand_data,
     p_ub_extra_data->AssocLvl    =  0u;                         /* Not all fields must be cleared (see #note #1).       */
     p_ub_extra_data->NextSecIx   =  0u;
     p_ub_extra_data->ActivityCtr =  0u;
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+    p_ub_extra_data->Hot         =  DEF_NO;
+#endif
 
     for (ix = 0; ix < p_nand_data->RUB_MaxAssoc; ix++) {
         p_ub_extra_data->AssocLogicalBlksTbl[ix] = FS_NAND_BLK_IX_INVALID;
@@ -6949,6 +7284,13 @@ FS_NAND_INTERN  void  FS_NAND_UB_IncAssoc (FS_NAND_DATA     *p_nand_data,
         FS_NAND_TRACE_DBG(("FS_NAND_UB_IncAssoc(): Fatal error. Can't increase associativity for update block %u.\r\n",
                             ub_ix));
     } else {                                                    /* Assoc can be increased.                              */
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+        if (p_ub_extra_data->AssocLvl == 0u) {                  /* First assoc selects RUB stream ...                   */
+                                                                /* ... (see FS_NAND_UB_Alloc() Note #4).                */
+            p_ub_extra_data->Hot = FS_NAND_BLK_IS_HOT(p_nand_data, blk_ix_logical);
+        }
+#endif
+
         added        = DEF_NO;
         assoc_blk_ix = 0u;
         while ((assoc_blk_ix < p_nand_data->RUB_MaxAssoc) &&
@@ -6992,6 +7334,9 @@ FS_NAND_INTERN  void  FS_NAND_UB_IncAssoc (FS_NAND_DATA     *p_nand_data,
 *               sequential      DEF_YES, if update block will be a sequential update block,
 *                               DEF_NO , otherwise.
 *
+*               hot             DEF_YES, if update block will receive hot data (see Note #4),
+*                               DEF_NO , otherwise.
+*
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *               -----           Argument validated by caller.
 *
@@ -7114,12 +7459,20 @@ FS_NAND_INTERN  void  FS_NAND_UB_IncAssoc (FS_NAND_DATA     *p_nand_data,
 *
 *                           prio = next sector index + idle factor
 *
+*               (4) When FS_NAND_CFG_HOT_COLD_EN is enabled, random update blocks form two streams : a RUB
+*                   belongs to the hot stream if the first logical block associated with it was hot (see
+*                   FS_NAND_BlkHeatInc() Note #1). In (B), a RUB from the requested stream is chosen. A RUB
+*                   from the other stream is only used as a last resort before merging, after (C). Keeping
+*                   frequently rewritten sectors apart from cold ones lets hot RUBs be mostly obsolete when
+*                   they are merged, which reduces the number of sectors copied.
+*
 *********************************************************************************************************
 */
 
 #if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
 FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_UB_Alloc (FS_NAND_DATA  *p_nand_data,
                                                   CPU_BOOLEAN    sequential,
+                                                  CPU_BOOLEAN    hot,
                                                   FS_ERR        *p_err)
 {
     FS_NAND_UB_QTY           ix_sub_full;
@@ -7127,6 +7480,9 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_UB_Alloc (FS_NAND_DATA  *p_nand_data,
     FS_NAND_UB_QTY           ix_sub_fullest;
     FS_NAND_UB_QTY           ix_rub_priority;
     FS_NAND_UB_QTY           ix_blk_lowest_assoc;
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+    FS_NAND_UB_QTY           ix_blk_other_stream;
+#endif
     FS_NAND_UB_QTY           ix_blk_erased;
     FS_NAND_UB_QTY           ub_ix;
     FS_NAND_UB_EXTRA_DATA    ub_extra_data;
@@ -7147,6 +7503,11 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_UB_Alloc (FS_NAND_DATA  *p_nand_data,
     min_free_sec_cnt       = FS_NAND_SEC_OFFSET_IX_INVALID;
     ix_sub_full            = FS_NAND_UB_IX_INVALID;
     ix_blk_lowest_assoc    = FS_NAND_UB_IX_INVALID;
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+    ix_blk_other_stream    = FS_NAND_UB_IX_INVALID;
+#else
+    (void)&hot;
+#endif
     ix_sub_idlest          = FS_NAND_UB_IX_INVALID;
     ix_sub_fullest         = FS_NAND_UB_IX_INVALID;
     ub_ix                  = FS_NAND_UB_IX_INVALID;
@@ -7207,6 +7568,13 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_UB_Alloc (FS_NAND_DATA  *p_nand_data,
 
                                                                 /* -------------------- RUB: ASSOC -------------------- */
                 if (free_sec_cnt != 0u) {
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+                    if (ub_extra_data.Hot != hot) {             /* Other stream only used as fallback (see Note #4).    */
+                        if (ub_extra_data.AssocLvl < p_nand_data->RUB_MaxAssoc) {
+                            ix_blk_other_stream = ub_ix;
+                        }
+                    } else
+#endif
                     if ((ub_extra_data.AssocLvl < min_assoc)) {
                         min_assoc_free_sec_cnt = p_nand_data->NbrSecPerBlk - ub_extra_data.NextSecIx;
                         ix_blk_lowest_assoc    = ub_ix;
@@ -7313,6 +7681,13 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_UB_Alloc (FS_NAND_DATA  *p_nand_data,
 
             return (ix_sub_idlest);
         }
+
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+                                                                /* ---------- RUB FROM OTHER STREAM AVAIL (B) --------- */
+        if (ix_blk_other_stream != FS_NAND_UB_IX_INVALID) {
+            return (ix_blk_other_stream);
+        }
+#endif
     }
 
                                                                 /* ---- SUB WITH FEW FREE SECS AVAIL OR NO RUB (D) ---- */
@@ -7410,6 +7785,7 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_RUB_Alloc (FS_NAND_DATA     *p_nand_data
                                                                 /* Alloc new UB.                                        */
     ub_ix = FS_NAND_UB_Alloc(p_nand_data,
                              DEF_NO,
+                             FS_NAND_BLK_IS_HOT(p_nand_data, blk_ix_logical),
                              p_err);
 
     if (*p_err != FS_ERR_NONE) {
@@ -7447,7 +7823,8 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_RUB_Alloc (FS_NAND_DATA     *p_nand_data
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FS_NAND_SecWrInUB(),
+* Caller(s)   : FS_NAND_MaintHandler(),
+*               FS_NAND_SecWrInUB(),
 *               FS_NAND_RUB_Alloc().
 *
 * Note(s)     : none.
@@ -7607,6 +7984,7 @@ FS_NAND_INTERN  void  FS_NAND_RUB_PartialMerge (FS_NAND_DATA           *p_nand_d
 
                                                                 /* ------------- GET BLK FOR NEW DATA BLK ------------- */
     data_blk_ix_phy_new = FS_NAND_BlkGetErased(p_nand_data,
+                                               DEF_NO,
                                                p_err);
 
     FS_NAND_TRACE_LOG(("FS_NAND_RUB_PartialMerge(): Logical blk %u will be merged to data blk %u.\r\n",
@@ -7861,6 +8239,7 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_SUB_Alloc (FS_NAND_DATA     *p_nand_data
                                                                 /* Alloc new UB.                                        */
     ub_ix = FS_NAND_UB_Alloc(p_nand_data,
                              DEF_YES,
+                             DEF_NO,
                              p_err);
 
     if (*p_err != FS_ERR_NONE) {
@@ -7911,7 +8290,8 @@ FS_NAND_INTERN  FS_NAND_UB_QTY  FS_NAND_SUB_Alloc (FS_NAND_DATA     *p_nand_data
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FS_NAND_SecWrInUB(),
+* Caller(s)   : FS_NAND_MaintHandler(),
+*               FS_NAND_SecWrInUB(),
 *               FS_NAND_UB_Alloc().
 *
 * Note(s)     : none.
@@ -8605,7 +8985,7 @@ FS_NAND_INTERN  void  FS_NAND_LowFmtHandler (FS_NAND_DATA  *p_nand_data,
 
 
                                                                 /* -------- FIND BLK FOR META IN AVAIL BLK TBL -------- */
-    p_nand_data->MetaBlkIxPhy = FS_NAND_BlkGetAvailFromTbl(p_nand_data, DEF_NO, p_err);
+    p_nand_data->MetaBlkIxPhy = FS_NAND_BlkGetAvailFromTbl(p_nand_data, DEF_NO, DEF_NO, p_err);
     if (*p_err != FS_ERR_NONE) {
         FS_NAND_TRACE_DBG(("FS_NAND_LowFmtHandler(): Fatal error; unable to get available block for metadata block.\r\n"));
         return;
@@ -8919,6 +9299,427 @@ FS_NAND_INTERN  void  FS_NAND_LowUnmountHandler (FS_NAND_DATA  *p_nand_data,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        FS_NAND_MaintHandler()
+*
+* Description : Perform one background maintenance step.
+*
+* Argument(s) : p_nand_data     Pointer to NAND data.
+*               -----------     Argument validated by caller.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*               -----           Argument validated by caller.
+*
+*                                   FS_ERR_NONE     Operation was successful.
+*
+*                                   -----RETURNED BY FS_NAND_RUB_Merge()-----
+*                                   See FS_NAND_RUB_Merge() for additional return error codes.
+*
+*                                   -----RETURNED BY FS_NAND_SUB_Merge()-----
+*                                   See FS_NAND_SUB_Merge() for additional return error codes.
+*
+*                                   ----RETURNED BY FS_NAND_MetaBlkFold()----
+*                                   See FS_NAND_MetaBlkFold() for additional return error codes.
+*
+*                                   ----RETURNED BY FS_NAND_MetaCommit()-----
+*                                   See FS_NAND_MetaCommit() for additional return error codes.
+*
+*                                   --RETURNED BY FS_NAND_AvailBlkTblFill()--
+*                                   See FS_NAND_AvailBlkTblFill() for additional return error codes.
+*
+*                                   ------RETURNED BY FS_NAND_SecIsUsed()----
+*                                   See FS_NAND_SecIsUsed() for additional return error codes.
+*
+*                                   --RETURNED BY FS_NAND_BlkEnsureErased()--
+*                                   See FS_NAND_BlkEnsureErased() for additional return error codes.
+*
+*                                   -----RETURNED BY FS_NAND_StaticWL()------
+*                                   See FS_NAND_StaticWL() for additional return error codes.
+*
+* Return(s)   : DEF_YES, if an operation was performed,
+*               DEF_NO , otherwise.
+*
+* Caller(s)   : FS_NAND_IO_Ctrl() (FS_DEV_IO_CTRL_NAND_MAINT).
+*
+* Note(s)     : (1) The work a write would otherwise perform synchronously is done ahead of time, one
+*                   operation per call so that the device lock is never held for long. The first
+*                   applicable operation, in this order, is performed :
+*
+*                   (a) Merge an update block, if fewer than FS_NAND_CFG_BG_TH_FREE_UB_CNT update block
+*                       slots are free. A full update block is chosen first; otherwise, the idlest update
+*                       block, provided it has been idle for more than FS_NAND_CFG_TH_SUB_MIN_IDLE_TO_FOLD
+*                       driver accesses. Update blocks still being written are never merged.
+*
+*                   (b) Fold the metadata block if the next full metadata commit would not fit in it.
+*
+*                   (c) Add one dirty block to the available blocks table, if it contains fewer than
+*                       FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT entries.
+*
+*                   (d) Erase one available block whose entry is committed but which has not been erased
+*                       yet. Uncommitted entries are skipped: their data might still be needed after a
+*                       power loss. The search resumes where the previous call left off.
+*
+*                   (e) If FS_NAND_CFG_STATIC_WL_EN is enabled, check one logical data block for static
+*                       wear leveling (see FS_NAND_StaticWL()).
+*
+*               (2) An available block failing to erase is marked bad, which also removes it from the
+*                   available blocks table; this is not reported as an error.
+*********************************************************************************************************
+*/
+
+#if ((FS_CFG_RD_ONLY_EN       == DEF_DISABLED) && \
+     (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED))
+FS_NAND_INTERN  CPU_BOOLEAN  FS_NAND_MaintHandler (FS_NAND_DATA  *p_nand_data,
+                                                   FS_ERR        *p_err)
+{
+    FS_NAND_UB_EXTRA_DATA    ub_extra_data;
+    FS_NAND_AVAIL_BLK_ENTRY  tbl_entry;
+    FS_NAND_UB_QTY           ub_ix;
+    FS_NAND_UB_QTY           ub_ix_victim;
+    FS_NAND_UB_QTY           ub_free_cnt;
+    FS_NAND_BLK_QTY          tbl_ix;
+    FS_NAND_BLK_QTY          tbl_srch_cnt;
+    FS_NAND_BLK_QTY          avail_blk_cnt;
+    FS_NAND_BLK_QTY          avail_blk_cnt_th;
+    FS_NAND_SEC_PER_BLK_QTY  meta_sec_rem;
+    FS_SEC_QTY               sec_ix_phy;
+    CPU_INT16U               idle_val;
+    CPU_INT16U               max_idle_val;
+    CPU_BOOLEAN              victim_full;
+    CPU_BOOLEAN              is_committed;
+    CPU_BOOLEAN              is_used;
+    CPU_BOOLEAN              work_done;
+
+
+   *p_err     = FS_ERR_NONE;
+    work_done = DEF_NO;
+
+                                                                /* ------------ MERGE UB (see Note #1a) --------------- */
+    ub_free_cnt  = 0u;
+    ub_ix_victim = FS_NAND_UB_IX_INVALID;
+    victim_full  = DEF_NO;
+    max_idle_val = FS_NAND_CFG_TH_SUB_MIN_IDLE_TO_FOLD;
+    for (ub_ix = 0u; ub_ix < p_nand_data->UB_CntMax; ub_ix++) {
+        ub_extra_data = p_nand_data->UB_ExtraDataTbl[ub_ix];
+
+        if (ub_extra_data.NextSecIx == 0u) {                    /* Unused blk.                                          */
+            ub_free_cnt++;
+        } else if (victim_full == DEF_NO) {
+            if (ub_extra_data.NextSecIx >= p_nand_data->NbrSecPerBlk) {
+                ub_ix_victim = ub_ix;                           /* Full UB must be merged anyway.                       */
+                victim_full  = DEF_YES;
+            } else {
+                                                                /* Determine idle cnt.                                  */
+                if (ub_extra_data.ActivityCtr > p_nand_data->ActivityCtr) {
+                                                                /* Wrapped around.                                      */
+                    idle_val  = DEF_GET_U_MAX_VAL(idle_val) - ub_extra_data.ActivityCtr;
+                    idle_val += p_nand_data->ActivityCtr;
+                } else {
+                                                                /* No wrap around.                                      */
+                    idle_val = p_nand_data->ActivityCtr - ub_extra_data.ActivityCtr;
+                }
+
+                if (idle_val > max_idle_val) {                  /* New idlest UB.                                       */
+                    max_idle_val = idle_val;
+                    ub_ix_victim = ub_ix;
+                }
+            }
+        }
+    }
+
+    if ((ub_free_cnt  <  FS_NAND_CFG_BG_TH_FREE_UB_CNT) &&
+        (ub_ix_victim != FS_NAND_UB_IX_INVALID)) {
+        if (p_nand_data->UB_ExtraDataTbl[ub_ix_victim].AssocLvl == 0u) {
+            FS_NAND_SUB_Merge(p_nand_data, ub_ix_victim, p_err);
+        } else {
+            FS_NAND_RUB_Merge(p_nand_data, ub_ix_victim, p_err);
+        }
+        if (*p_err != FS_ERR_NONE) {
+            FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error merging update blk %u.\r\n",
+                                ub_ix_victim));
+            return (DEF_NO);
+        }
+
+        FS_CTR_STAT_INC(p_nand_data->Ctrs.StatBgMergeCtr);
+        work_done = DEF_YES;
+    }
+
+                                                                /* --------- FOLD META BLK (see Note #1b) ------------- */
+    if (work_done == DEF_NO) {
+        meta_sec_rem = p_nand_data->NbrSecPerBlk - p_nand_data->MetaBlkNextSecIx;
+        if ((p_nand_data->MetaBlkFoldNeeded == DEF_YES) ||
+            (meta_sec_rem < p_nand_data->MetaSecCnt)) {
+            p_nand_data->MetaBlkFoldNeeded = DEF_YES;
+            FS_NAND_MetaBlkFold(p_nand_data, p_err);
+            if (*p_err != FS_ERR_NONE) {
+                FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error folding metadata blk.\r\n"));
+                return (DEF_NO);
+            }
+                                                                /* Wr whole meta to new blk now, not on next commit.    */
+            FS_NAND_MetaCommit(p_nand_data, DEF_NO, p_err);
+            if (*p_err != FS_ERR_NONE) {
+                FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error committing metadata.\r\n"));
+                return (DEF_NO);
+            }
+
+            FS_CTR_STAT_INC(p_nand_data->Ctrs.StatBgMetaFoldCtr);
+            work_done = DEF_YES;
+        }
+    }
+
+                                                                /* -------- FILL AVAIL BLK TBL (see Note #1c) --------- */
+    if (work_done == DEF_NO) {
+        avail_blk_cnt_th = FS_NAND_CFG_BG_TH_AVAIL_BLK_CNT;
+        if (avail_blk_cnt_th > p_nand_data->AvailBlkTblEntryCntMax) {
+            avail_blk_cnt_th = p_nand_data->AvailBlkTblEntryCntMax;
+        }
+
+        avail_blk_cnt = FS_NAND_AvailBlkTblEntryCnt(p_nand_data);
+        if (avail_blk_cnt < avail_blk_cnt_th) {
+            FS_NAND_AvailBlkTblFill(p_nand_data, avail_blk_cnt + 1u, DEF_ENABLED, p_err);
+            switch (*p_err) {
+                case FS_ERR_NONE:
+                     FS_CTR_STAT_INC(p_nand_data->Ctrs.StatBgFillCtr);
+                     work_done = DEF_YES;
+                     break;
+
+
+                case FS_ERR_DEV_NAND_NO_AVAIL_BLK:              /* No dirty blk to add yet.                             */
+                    *p_err = FS_ERR_NONE;
+                     break;
+
+
+                default:
+                     FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error filling available block table.\r\n"));
+                     return (DEF_NO);                           /* Prevent 'break NOT reachable' compiler warning.      */
+            }
+
+                                                                /* Commit avail blk tbl on dev if invalid.              */
+            if (p_nand_data->AvailBlkTblInvalidated == DEF_YES) {
+                FS_NAND_AvailBlkTblTmpCommit(p_nand_data, p_err);
+                if (*p_err != FS_ERR_NONE) {
+                    FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error committing available block table to device.\r\n"));
+                    return (DEF_NO);
+                }
+            }
+        }
+    }
+
+                                                                /* -------- PRE-ERASE AVAIL BLK (see Note #1d) -------- */
+    tbl_srch_cnt = 0u;
+    while ((work_done    == DEF_NO) &&
+           (tbl_srch_cnt <  p_nand_data->AvailBlkTblEntryCntMax)) {
+        tbl_ix = p_nand_data->AvailBlkTblEraseSrchPos;
+        p_nand_data->AvailBlkTblEraseSrchPos++;
+        if (p_nand_data->AvailBlkTblEraseSrchPos >= p_nand_data->AvailBlkTblEntryCntMax) {
+            p_nand_data->AvailBlkTblEraseSrchPos = 0u;
+        }
+        tbl_srch_cnt++;
+
+        tbl_entry    = FS_NAND_AvailBlkTblEntryRd(p_nand_data, tbl_ix);
+        is_committed = FSUtil_MapBitIsSet(p_nand_data->AvailBlkTblCommitMap, tbl_ix);
+        if ((tbl_entry.BlkIxPhy != FS_NAND_BLK_IX_INVALID) &&
+            (is_committed       == DEF_YES)) {
+            sec_ix_phy = FS_NAND_BLK_IX_TO_SEC_IX(p_nand_data, tbl_entry.BlkIxPhy);
+            is_used    = FS_NAND_SecIsUsed(p_nand_data, sec_ix_phy, p_err);
+            if (*p_err != FS_ERR_NONE) {
+                return (DEF_NO);
+            }
+
+            if (is_used == DEF_YES) {
+                FS_NAND_BlkEnsureErased(p_nand_data, tbl_entry.BlkIxPhy, p_err);
+                if (*p_err == FS_ERR_DEV_IO) {                  /* Blk marked bad (see Note #2).                        */
+                   *p_err = FS_ERR_NONE;
+                }
+                if (*p_err != FS_ERR_NONE) {
+                    FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error erasing blk %u.\r\n",
+                                        tbl_entry.BlkIxPhy));
+                    return (DEF_NO);
+                }
+
+                FS_CTR_STAT_INC(p_nand_data->Ctrs.StatBgEraseCtr);
+                work_done = DEF_YES;
+            }
+        }
+    }
+
+#if (FS_NAND_CFG_STATIC_WL_EN == DEF_ENABLED)
+                                                                /* -------- STATIC WEAR LEVELING (see Note #1e) ------- */
+    if (work_done == DEF_NO) {
+        work_done = FS_NAND_StaticWL(p_nand_data, p_err);
+        if (*p_err != FS_ERR_NONE) {
+            FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error moving cold data blk.\r\n"));
+            return (DEF_NO);
+        }
+    }
+#endif
+
+#if (FS_NAND_CFG_AUTO_SYNC_EN == DEF_ENABLED)
+                                                                /* ----------------- COMMIT METADATA ------------------ */
+    if (work_done == DEF_YES) {
+        do {
+           *p_err = FS_ERR_NONE;
+
+            FS_NAND_MetaCommit(p_nand_data,
+                               DEF_NO,
+                               p_err);
+
+        } while ((*p_err != FS_ERR_NONE) &&
+                 (*p_err != FS_ERR_DEV_NAND_NO_AVAIL_BLK));
+
+        if (*p_err != FS_ERR_NONE) {
+            FS_NAND_TRACE_DBG(("FS_NAND_MaintHandler(): Error committing metadata.\r\n"));
+            return (DEF_NO);
+        }
+    }
+#endif
+
+    return (work_done);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          FS_NAND_StaticWL()
+*
+* Description : Move the data of one cold logical block off a block with low wear.
+*
+* Argument(s) : p_nand_data     Pointer to NAND data.
+*               -----------     Argument validated by caller.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*               -----           Argument validated by caller.
+*
+*                                   FS_ERR_NONE     Operation was successful.
+*
+*                                   ----RETURNED BY FS_NAND_BlkRefresh()-----
+*                                   See FS_NAND_BlkRefresh() for additional return error codes.
+*
+* Return(s)   : DEF_YES, if a block was moved,
+*               DEF_NO , otherwise.
+*
+* Caller(s)   : FS_NAND_MaintHandler().
+*
+* Note(s)     : (1) Data that is never rewritten keeps its block out of circulation, so the erase counts
+*                   of the other blocks drift away from it. One logical data block is examined per call,
+*                   in round-robin order. It is moved if :
+*
+*                   (a) it is not hot (see FS_NAND_BlkHeatInc() Note #1) and has no update block; and
+*                   (b) its erase count is lower than the one of the most worn committed available block
+*                       by at least FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF.
+*
+*                   The data is copied to that worn block, which should now rest, and the old block is
+*                   marked dirty so that it returns to circulation.
+*
+*               (2) A block whose first sector cannot be read is left alone; the read path will refresh
+*                   it if needed.
+*********************************************************************************************************
+*/
+
+#if ((FS_CFG_RD_ONLY_EN        == DEF_DISABLED) && \
+     (FS_NAND_CFG_BG_MAINT_EN  == DEF_ENABLED)  && \
+     (FS_NAND_CFG_STATIC_WL_EN == DEF_ENABLED))
+FS_NAND_INTERN  CPU_BOOLEAN  FS_NAND_StaticWL (FS_NAND_DATA  *p_nand_data,
+                                               FS_ERR        *p_err)
+{
+    FS_NAND_AVAIL_BLK_ENTRY   tbl_entry;
+    FS_NAND_UB_SEC_DATA       ub_sec_data;
+    FS_NAND_BLK_QTY           blk_ix_logical;
+    FS_NAND_BLK_QTY           blk_ix_phy;
+    FS_NAND_BLK_QTY           tbl_ix;
+    FS_NAND_ERASE_QTY         erase_cnt;
+    FS_NAND_ERASE_QTY         max_erase_cnt;
+    CPU_INT08U               *p_oos_buf;
+    CPU_BOOLEAN               is_committed;
+
+
+   *p_err = FS_ERR_NONE;
+
+    blk_ix_logical = p_nand_data->WL_SrchPos;
+    p_nand_data->WL_SrchPos++;
+    if (p_nand_data->WL_SrchPos >= p_nand_data->LogicalDataBlkCnt) {
+        p_nand_data->WL_SrchPos = 0u;
+    }
+
+                                                                /* ---------- CHK BLK IS COLD (see Note #1a) ---------- */
+    blk_ix_phy = p_nand_data->LogicalToPhyBlkMap[blk_ix_logical];
+    if (blk_ix_phy == FS_NAND_BLK_IX_INVALID) {                 /* Blk never wr'en.                                     */
+        return (DEF_NO);
+    }
+
+    if (FS_NAND_BLK_IS_HOT(p_nand_data, blk_ix_logical) == DEF_YES) {
+        return (DEF_NO);
+    }
+
+    ub_sec_data = FS_NAND_UB_Find(p_nand_data, blk_ix_logical);
+    if (ub_sec_data.UB_Ix != FS_NAND_UB_IX_INVALID) {           /* Blk is being updated.                                */
+        return (DEF_NO);
+    }
+
+                                                                /* -------------- FIND MOST WORN AVAIL BLK ------------ */
+    max_erase_cnt = 0u;
+    for (tbl_ix = 0u; tbl_ix < p_nand_data->AvailBlkTblEntryCntMax; tbl_ix++) {
+        tbl_entry    = FS_NAND_AvailBlkTblEntryRd(p_nand_data, tbl_ix);
+        is_committed = FSUtil_MapBitIsSet(p_nand_data->AvailBlkTblCommitMap, tbl_ix);
+        if ((tbl_entry.BlkIxPhy != FS_NAND_BLK_IX_INVALID) &&
+            (is_committed       == DEF_YES)                &&
+            (tbl_entry.EraseCnt  > max_erase_cnt)) {
+            max_erase_cnt = tbl_entry.EraseCnt;
+        }
+    }
+
+    if (max_erase_cnt < FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------- RD BLK ERASE CNT (see Notes #1b & #2) ------ */
+    p_oos_buf = (CPU_INT08U *)p_nand_data->OOS_BufPtr;
+    FS_NAND_SecRdPhyNoRefresh(p_nand_data,
+                              p_nand_data->BufPtr,
+                              p_oos_buf,
+                              blk_ix_phy,
+                              0u,
+                              p_err);
+    if (*p_err != FS_ERR_NONE) {
+       *p_err = FS_ERR_NONE;
+        return (DEF_NO);
+    }
+
+    MEM_VAL_COPY_GET_INTU_LITTLE(&erase_cnt,
+                                 &p_oos_buf[FS_NAND_OOS_ERASE_CNT_OFFSET],
+                                  sizeof(FS_NAND_ERASE_QTY));
+    if ((erase_cnt == FS_NAND_ERASE_QTY_INVALID) ||
+        (erase_cnt  > max_erase_cnt - FS_NAND_CFG_TH_WL_ERASE_CNT_DIFF)) {
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------- MOVE COLD DATA ----------------- */
+    FS_NAND_TRACE_LOG(("FS_NAND_StaticWL(): Moving logical blk %u off phy blk %u (erase cnt %u).\r\n",
+                        blk_ix_logical,
+                        blk_ix_phy,
+                        erase_cnt));
+
+    FS_NAND_BlkRefresh(p_nand_data,                             /* Copy data to most worn avail blk.                    */
+                       blk_ix_phy,
+                       DEF_YES,
+                       p_err);
+    if (*p_err != FS_ERR_NONE) {
+        FS_NAND_TRACE_DBG(("FS_NAND_StaticWL(): Error moving blk %u.\r\n",
+                            blk_ix_phy));
+        return (DEF_NO);
+    }
+
+    FS_NAND_BlkMarkDirty(p_nand_data, blk_ix_phy);              /* Return old blk to circulation.                       */
+
+    FS_CTR_STAT_INC(p_nand_data->Ctrs.StatWL_BlkMoveCtr);
+
+    return (DEF_YES);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         FS_NAND_DumpHandler()
@@ -9122,6 +9923,7 @@ FS_NAND_INTERN  void  FS_NAND_SecRdHandler (FS_NAND_DATA             *p_nand_dat
            *p_err =  FS_ERR_NONE;
             FS_NAND_BlkRefresh(p_nand_data,                     /* Refresh blk.                                         */
                                blk_ix_phy,
+                               DEF_NO,
                                p_err);
             if (*p_err != FS_ERR_NONE) {                        /* If refresh failed ...                                */
                 FS_NAND_TRACE_DBG(("FS_NAND_SecRdHandler(): Uncorrectable read err in blk %u, marking it as bad.\r\n",
@@ -9535,10 +10337,14 @@ FS_NAND_INTERN  void  FS_NAND_SecWrHandler (FS_NAND_DATA             *p_nand_dat
                        p_src_oos,
                        sec_ix_phy,
                        p_err);
+    FS_CTR_STAT_INC(p_nand_data->Ctrs.StatPhySecWrCtr);
     if (*p_err == FS_ERR_DEV_IO) {                              /* ------------------- HANDLE ERRS -------------------- */
        *p_err = FS_ERR_NONE;
 
-        FS_NAND_BlkRefresh(p_nand_data, blk_ix_phy, p_err);     /* Refresh blk.                                         */
+        FS_NAND_BlkRefresh(p_nand_data,                         /* Refresh blk.                                         */
+                           blk_ix_phy,
+                           DEF_NO,
+                           p_err);
 
         switch (*p_err) {
             case FS_ERR_ECC_UNCORR:                             /* Ignore uncorrectable ECC err.                        */
@@ -9643,6 +10449,7 @@ FS_NAND_INTERN  void  FS_NAND_MetaSecWrHandler (FS_NAND_DATA             *p_nand
                        p_src_oos,
                        sec_ix_phy,
                        p_err);
+    FS_CTR_STAT_INC(p_nand_data->Ctrs.StatMetaSecWrCtr);
     if (*p_err == FS_ERR_DEV_IO) {                              /* If meta blk cannot be wr'en ...                      */
 
         p_nand_data->MetaBlkFoldNeeded = DEF_YES;               /* ... trigger a folding op.                            */
@@ -9726,6 +10533,15 @@ FS_NAND_INTERN  FS_SEC_QTY  FS_NAND_SecWr (FS_NAND_DATA  *p_nand_data,
         return (sec_wr_cnt);
     }
 
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+                                                                /* ------------------ UPDATE BLK HEAT ----------------- */
+    ub_sec_data = FS_NAND_UB_Find(p_nand_data, blk_ix_logical);
+    if ((ub_sec_data.UB_Ix != FS_NAND_UB_IX_INVALID) &&         /* If sec landed in a RUB ...                           */
+        (p_nand_data->UB_ExtraDataTbl[ub_sec_data.UB_Ix].AssocLvl != 0u)) {
+        FS_NAND_BlkHeatInc(p_nand_data, blk_ix_logical);        /* ... blk is being randomly wr'en.                     */
+    }
+#endif
+
 
     return (sec_wr_cnt);
 }
@@ -10951,6 +11767,7 @@ FS_NAND_INTERN  void  FS_NAND_BlkEraseHandler (FS_NAND_DATA     *p_nand_data,
     p_ctrlr_api->BlkErase(p_ctrlr_data,
                           blk_ix_phy,
                           p_err);
+    FS_CTR_STAT_INC(p_nand_data->Ctrs.StatBlkEraseCtr);
     if (*p_err != FS_ERR_NONE) {
         FS_NAND_TRACE_DBG(("FS_NAND_BlkEraseHandler(): Error erasing block %u.\r\n",
                             blk_ix_phy));
@@ -11221,6 +12038,23 @@ FS_NAND_INTERN  void  FS_NAND_AllocDevData (FS_NAND_DATA  *p_nand_data,
         return;
     }
 
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+                                                                /* ------------------ ALLOC HEAT TBL ------------------ */
+    p_nand_data->LogicalBlkHeatTbl = (CPU_INT08U *)Mem_HeapAlloc(sizeof(CPU_INT08U) * p_nand_data->LogicalDataBlkCnt,
+                                                                 sizeof(CPU_INT08U),
+                                                                &octets_reqd,
+                                                                &alloc_err);
+
+    if (p_nand_data->LogicalBlkHeatTbl == DEF_NULL) {
+        FS_NAND_TRACE_DBG(("FS_NAND_AllocDevData(): Could not alloc mem for heat tbl: %d octets req'd.\r\n", octets_reqd));
+       *p_err = FS_ERR_MEM_ALLOC;
+        return;
+    }
+
+    Mem_Clr(p_nand_data->LogicalBlkHeatTbl, sizeof(CPU_INT08U) * p_nand_data->LogicalDataBlkCnt);
+    p_nand_data->LogicalBlkHeatAgeCtr = 0u;
+#endif
+
                                                                 /* ------------- DETERMINE METADATA INFO -------------- */
                                                                 /* Avail blk tbl at beginning of meta (see Note #1b).   */
     avail_blk_tbl_entry_size           = sizeof(FS_NAND_BLK_QTY) + sizeof(FS_NAND_ERASE_QTY);
@@ -11515,6 +12349,9 @@ FS_NAND_INTERN  void  FS_NAND_InitDevData (FS_NAND_DATA  *p_nand_data)
         p_tbl_entry->AssocLvl    = 0u;
         p_tbl_entry->NextSecIx   = 0u;
         p_tbl_entry->ActivityCtr = 0u;
+#if (FS_NAND_CFG_HOT_COLD_EN == DEF_ENABLED)
+        p_tbl_entry->Hot         = DEF_NO;
+#endif
 
                                                                 /* Init associated blk tbl.                             */
         Mem_Set(&p_tbl_entry->AssocLogicalBlksTbl[0], 0xFFu, sizeof(FS_NAND_BLK_QTY) * p_nand_data->RUB_MaxAssoc);
@@ -11615,6 +12452,12 @@ FS_NAND_INTERN  FS_NAND_DATA  *FS_NAND_DataGet (void)
 
                                                                 /* --------------------- CLR DATA --------------------- */
     p_nand_data->CtrlrDataPtr = DEF_NULL;
+#if (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED)
+    p_nand_data->AvailBlkTblEraseSrchPos = 0u;
+#endif
+#if (FS_NAND_CFG_STATIC_WL_EN == DEF_ENABLED)
+    p_nand_data->WL_SrchPos              = 0u;
+#endif
 
 #if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)                         /* Clr stat ctrs.                                       */
     p_nand_data->Ctrs.StatRdCtr               = 0u;
@@ -11626,6 +12469,16 @@ FS_NAND_INTERN  FS_NAND_DATA  *FS_NAND_DataGet (void)
     p_nand_data->Ctrs.StatRUB_PartialMergeCtr = 0u;
 
     p_nand_data->Ctrs.StatBlkRefreshCtr       = 0u;
+
+    p_nand_data->Ctrs.StatBgMergeCtr          = 0u;
+    p_nand_data->Ctrs.StatBgMetaFoldCtr       = 0u;
+    p_nand_data->Ctrs.StatBgFillCtr           = 0u;
+    p_nand_data->Ctrs.StatBgEraseCtr          = 0u;
+
+    p_nand_data->Ctrs.StatPhySecWrCtr         = 0u;
+    p_nand_data->Ctrs.StatMetaSecWrCtr        = 0u;
+    p_nand_data->Ctrs.StatBlkEraseCtr         = 0u;
+    p_nand_data->Ctrs.StatWL_BlkMoveCtr       = 0u;
 #endif
 
 #if (FS_CFG_CTR_ERR_EN == DEF_ENABLED)                          /* Clr err ctrs.                                        */
@@ -336,6 +336,16 @@ typedef  struct  fs_nand_ctrs {
     FS_CTR                    StatRUB_PartialMergeCtr;          /* Nbr of RUB partial merges done.                      */
 
     FS_CTR                    StatBlkRefreshCtr;                /* Nbr of blk refreshes done.                           */
+
+    FS_CTR                    StatBgMergeCtr;                   /* Nbr of UB merges done by bg maint.                   */
+    FS_CTR                    StatBgMetaFoldCtr;                /* Nbr of meta blk folds done by bg maint.              */
+    FS_CTR                    StatBgFillCtr;                    /* Nbr of avail blks added by bg maint.                 */
+    FS_CTR                    StatBgEraseCtr;                   /* Nbr of avail blks pre-erased by bg maint.            */
+
+    FS_CTR                    StatPhySecWrCtr;                  /* Nbr of data sec programmed (incl. merge copies).     */
+    FS_CTR                    StatMetaSecWrCtr;                 /* Nbr of meta sec programmed.                          */
+    FS_CTR                    StatBlkEraseCtr;                  /* Nbr of blk erases.                                   */
+    FS_CTR                    StatWL_BlkMoveCtr;                /* Nbr of cold blks moved by static wear leveling.      */
 #endif
 
 #if (FS_CFG_CTR_ERR_EN == DEF_ENABLED)                          /* --------------------- ERR CTRS --------------------- */
@@ -423,6 +433,26 @@ extern           const  FS_NAND_PART_API  FS_NAND_PartStatic;
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   NAND WRITE AMPLIFICATION INFO
+*
+* Note(s) : (1) Returned by FS_DEV_IO_CTRL_NAND_WR_AMP_GET. The write amplification factor is :
+*
+*                       (DataSecWrCnt + MetaSecWrCnt) / HostSecWrCnt
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_nand_wr_amp_info {
+    FS_CTR                    HostSecWrCnt;                     /* Nbr of sec wr'en by the file system.                 */
+    FS_CTR                    DataSecWrCnt;                     /* Nbr of data sec programmed on dev.                   */
+    FS_CTR                    MetaSecWrCnt;                     /* Nbr of meta sec programmed on dev.                   */
+    FS_CTR                    BlkEraseCnt;                      /* Nbr of blk erases.                                   */
+    FS_CTR                    MergeCnt;                         /* Nbr of SUB, RUB full and RUB partial merges.         */
+    FS_CTR                    WL_BlkMoveCnt;                    /* Nbr of blks moved by static wear leveling.           */
+} FS_NAND_WR_AMP_INFO;
+
+
 /*
 *********************************************************************************************************
 *                                        FUNCTION PROTOTYPES
@@ -439,6 +469,12 @@ void         FS_NAND_LowMount  (CPU_CHAR  *p_name_dev,          /* Low-level mou
 void         FS_NAND_LowUnmount(CPU_CHAR  *p_name_dev,          /* Low-level unmount device.                            */
                                 FS_ERR    *p_err);
 
+#if ((FS_CFG_RD_ONLY_EN       == DEF_DISABLED) && \
+     (FS_NAND_CFG_BG_MAINT_EN == DEF_ENABLED))
+CPU_BOOLEAN  FS_NAND_Maint     (CPU_CHAR  *p_name_dev,          /* Perform one background maintenance step.             */
+                                FS_ERR    *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -170,6 +170,10 @@ struct  fs_dev_nor_data {
     CPU_INT32U            EraseCntMin;                          /* Min erase cnt.                                       */
     CPU_INT32U            EraseCntMax;                          /* Max erase cnt.                                       */
     CPU_BOOLEAN           Mounted;                              /* Low-level mounted.                                   */
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    FS_SEC_NBR            CompactBlkIx;                         /* Blk being compacted by bg steps.                     */
+    FS_SEC_NBR            CompactSecIx;                         /* Next sec to probe in blk being compacted.            */
+#endif
 
 
                                                                 /* --------------------- CFG INFO --------------------- */
@@ -194,6 +198,10 @@ struct  fs_dev_nor_data {
     FS_CTR                StatWrOctetCtr;                       /* Octets wr.                                           */
     FS_CTR                StatEraseBlkCtr;                      /* Blks erased.                                         */
     FS_CTR                StatInvalidBlkCtr;                    /* Blks invalidated.                                    */
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    FS_CTR                StatBgCopyCtr;                        /* Secs copied by bg compaction.                        */
+    FS_CTR                StatBgEraseBlkCtr;                    /* Blks erased by bg compaction.                        */
+#endif
 #endif
 
 
@@ -314,6 +322,11 @@ static  void              FSDev_NOR_LowCompactHandler  (FS_DEV_NOR_DATA  *p_nor_
 
 static  void              FSDev_NOR_LowDefragHandler   (FS_DEV_NOR_DATA  *p_nor_data,   /* Low-level defrag NOR.        */
                                                         FS_ERR           *p_err);
+
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+static  CPU_BOOLEAN       FSDev_NOR_CompactStepHandler (FS_DEV_NOR_DATA  *p_nor_data,   /* Perform compaction step.     */
+                                                        FS_ERR           *p_err);
+#endif
 #endif
 
 static  void              FSDev_NOR_PhyRdHandler       (FS_DEV_NOR_DATA  *p_nor_data,   /* Rd octets.                   */
@@ -384,6 +397,10 @@ static  FS_SEC_NBR        FSDev_NOR_FindEraseBlk       (FS_DEV_NOR_DATA  *p_nor_
 static  FS_SEC_NBR        FSDev_NOR_FindEraseBlkWear   (FS_DEV_NOR_DATA  *p_nor_data);  /* Find blk to erase.           */
 
 static  FS_SEC_NBR        FSDev_NOR_FindErasedBlk      (FS_DEV_NOR_DATA  *p_nor_data);  /* Find blk that is erased.     */
+
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+static  FS_SEC_NBR        FSDev_NOR_FindCompactBlk     (FS_DEV_NOR_DATA  *p_nor_data);  /* Find blk to compact.         */
+#endif
 #endif
 
 
@@ -858,6 +875,92 @@ void  FSDev_NOR_LowDefrag (CPU_CHAR  *name_dev,
 }
 
 
+/*
+*********************************************************************************************************
+*                                       FSDev_NOR_CompactStep()
+*
+* Description : Perform one bounded step of background compaction on a NOR device.
+*
+* Argument(s) : name_dev    Device name (see Note #1).
+*
+*               p_err       Pointer to variable that will receive return the error code from this function :
+*
+*                               FS_ERR_NONE                   Step performed (or no work needed).
+*                               FS_ERR_NAME_NULL              Argument 'name_dev' passed a NULL pointer.
+*                               FS_ERR_DEV_INVALID            Argument 'name_dev' specifies an invalid device.
+*
+*                                                             --------- RETURNED BY FSDev_IO_Ctrl() ---------
+*                               FS_ERR_DEV_INVALID_LOW_FMT    Device needs to be low-level formatted.
+*                               FS_ERR_DEV_NOT_OPEN           Device is not open.
+*                               FS_ERR_DEV_NOT_PRESENT        Device is not present.
+*                               FS_ERR_DEV_IO                 Device I/O error.
+*                               FS_ERR_DEV_TIMEOUT            Device timeout.
+*
+* Return(s)   : DEF_YES, if work was performed & more may remain.
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The device MUST be a NOR device (e.g., "nor:0:").
+*
+*               (2) Writes reclaim space inline, moving every valid sector of the chosen block before
+*                   the write proceeds.  This function lets an idle task (or a time-budgeted hook) do that
+*                   work ahead of time, so that 'FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT' erased blocks are kept
+*                   ready & foreground writes seldom stall.  It should be called repeatedly until it
+*                   returns DEF_NO.
+*
+*               (3) Each call performs at most one block erase or moves at most
+*                   'FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT' valid sectors, so the device lock is held for a
+*                   bounded time.  See also 'FSDev_NOR_CompactStepHandler()  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+CPU_BOOLEAN  FSDev_NOR_CompactStep (CPU_CHAR  *name_dev,
+                                    FS_ERR    *p_err)
+{
+    CPU_INT16S   cmp_val;
+    CPU_BOOLEAN  work_done;
+
+
+#if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)                  /* ------------------- VALIDATE ARGS ------------------ */
+    if (p_err == (FS_ERR *)0) {                                 /* Validate error ptr.                                  */
+        CPU_SW_EXCEPTION(DEF_NO);
+    }
+    if (name_dev == (CPU_CHAR *)0) {                            /* Validate name ptr.                                   */
+       *p_err = FS_ERR_NAME_NULL;
+        return (DEF_NO);
+    }
+#endif
+
+                                                                /* Validate name str (see Note #1).                     */
+    cmp_val = Str_Cmp_N(name_dev, (CPU_CHAR *)FSDev_NOR_Name, FS_DEV_NOR_NAME_LEN);
+    if (cmp_val != 0) {
+       *p_err = FS_ERR_DEV_INVALID;
+        return (DEF_NO);
+    }
+
+    if (name_dev[FS_DEV_NOR_NAME_LEN] != FS_CHAR_DEV_SEP) {
+       *p_err = FS_ERR_DEV_INVALID;
+        return (DEF_NO);
+    }
+
+
+                                                                /* ------------------ COMPACT DEV STEP ---------------- */
+    work_done = DEF_NO;
+    FSDev_IO_Ctrl(         name_dev,
+                           FS_DEV_IO_CTRL_NOR_COMPACT_STEP,
+                  (void *)&work_done,
+                           p_err);
+    if (*p_err != FS_ERR_NONE) {
+        return (DEF_NO);
+    }
+
+    return (work_done);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          FSDev_NOR_PhyRd()
@@ -1745,6 +1848,7 @@ static  void  FSDev_NOR_Query (FS_DEV       *p_dev,
 *                   (k) FS_DEV_IO_CTRL_PHY_WR_PAGE       Write physical device page.   [*]
 *                   (l) FS_DEV_IO_CTRL_PHY_ERASE_BLK     Erase physical device block.  [**]
 *                   (;) FS_DEV_IO_CTRL_PHY_ERASE_CHIP    Erase physical device.        [**]
+*                   (m) FS_DEV_IO_CTRL_NOR_COMPACT_STEP  Perform bg compaction step.   [**]
 *
 *                           [*] NOT SUPPORTED
 *                          [**] OCCUR VIA APPLICATION CALLS TO NOR DRIVER INTERFACE FUNCTIONS :
@@ -1754,6 +1858,7 @@ static  void  FSDev_NOR_Query (FS_DEV       *p_dev,
 *                                   FSDev_NOR_LowUnmount()
 *                                   FSDev_NOR_LowCompact()
 *                                   FSDev_NOR_LowDefrag()
+*                                   FSDev_NOR_CompactStep()
 *
 *                                   FSDev_NOR_PhyRd()
 *                                   FSDev_NOR_PhyWr()
@@ -1830,6 +1935,21 @@ static  void  FSDev_NOR_IO_Ctrl (FS_DEV      *p_dev,
 #endif
 
 
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+        case FS_DEV_IO_CTRL_NOR_COMPACT_STEP:                   /* ----------------- COMPACT DEV STEP ----------------- */
+#if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)
+             if (p_data == (void *)0) {                         /* Validate data ptr.                                   */
+                *p_err = FS_ERR_NULL_PTR;
+                 return;
+             }
+#endif
+            *(CPU_BOOLEAN *)p_data = FSDev_NOR_CompactStepHandler(p_nor_data, p_err);
+             break;
+#endif
+#endif
+
+
 #if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
         case FS_DEV_IO_CTRL_SEC_RELEASE:                        /* ------------------ RELEASE DEV SEC ----------------- */
 #if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2421,6 +2541,11 @@ static  void  FSDev_NOR_LowMountHandler (FS_DEV_NOR_DATA  *p_nor_data,
     p_nor_data->EraseCntMin = erase_cnt_min;                    /* See Note #5a.                                        */
     p_nor_data->EraseCntMax = erase_cnt_max;
 
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    p_nor_data->CompactBlkIx = FS_DEV_NOR_SEC_NBR_INVALID;
+    p_nor_data->CompactSecIx = 0u;
+#endif
+
     p_nor_data->Mounted     = DEF_YES;                          /* See Note #1.                                         */
 
     FS_TRACE_INFO(("NOR FLASH MOUNT: Name         : \"nor:%d:\"\r\n", p_nor_data->PhyDataPtr->UnitNbr));
@@ -2514,6 +2639,11 @@ static  void  FSDev_NOR_LowUnmountHandler (FS_DEV_NOR_DATA  *p_nor_data,
     p_nor_data->EraseCntMin       = 0u;
     p_nor_data->EraseCntMax       = 0u;
 
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    p_nor_data->CompactBlkIx      = FS_DEV_NOR_SEC_NBR_INVALID;
+    p_nor_data->CompactSecIx      = 0u;
+#endif
+
     p_nor_data->Mounted           = DEF_NO;
 
    *p_err = FS_ERR_NONE;
@@ -2675,6 +2805,228 @@ static  void  FSDev_NOR_LowDefragHandler (FS_DEV_NOR_DATA  *p_nor_data,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   FSDev_NOR_CompactStepHandler()
+*
+* Description : Perform one bounded step of background compaction.
+*
+* Argument(s) : p_nor_data  Pointer to NOR data.
+*               ----------  Argument validated by caller.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*               ----------  Argument validated by caller.
+*
+*                               FS_ERR_NONE                   Step performed (or no work needed).
+*                               FS_ERR_DEV_INVALID_LOW_FMT    Device needs to be low-level formatted.
+*                               FS_ERR_DEV_IO                 Device I/O error.
+*                               FS_ERR_DEV_TIMEOUT            Device timeout.
+*
+* Return(s)   : DEF_YES, if work was performed.
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : FSDev_NOR_IO_Ctrl() (FS_DEV_IO_CTRL_NOR_COMPACT_STEP).
+*
+* Note(s)     : (1) A step performs the first of the following that applies :
+*
+*                   (a) If 'FSDev_NOR_FindEraseBlk()' reports that a block MUST be erased (the erased
+*                       block reserve is breached or active wear leveling is due), that block is erased,
+*                       exactly as the next write would have done.
+*
+*                   (b) If at least 'FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT' blocks are erased, nothing is done.
+*
+*                   (c) If the block being compacted holds no valid sectors, it is erased.
+*
+*                   (d) Otherwise, up to 'FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT' valid sectors are moved out of
+*                       the block being compacted, resuming after the last sector probed.
+*
+*               (2) Sectors are only moved while two or more blocks are erased, so that a move never
+*                   consumes the erased block reserved for the driver (see 'FSDev_NOR_FindEraseBlk()
+*                   Note #1a2').
+*
+*               (3) The block being compacted may be erased by a foreground write between steps; in that
+*                   case 'FSDev_NOR_EraseBlkEmptyFmt()' forgets it & a new block is chosen.
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  FSDev_NOR_CompactStepHandler (FS_DEV_NOR_DATA  *p_nor_data,
+                                                   FS_ERR           *p_err)
+{
+    CPU_BOOLEAN  active;
+    FS_SEC_NBR   blk_ix;
+    CPU_BOOLEAN  erased;
+    CPU_INT32U   sec_addr;
+    FS_SEC_QTY   sec_cnt_moved;
+    FS_SEC_QTY   sec_cnt_probed;
+    FS_SEC_QTY   sec_cnt_valid;
+    CPU_INT08U   sec_hdr[FS_DEV_NOR_SEC_HDR_LEN];
+    FS_SEC_NBR   sec_ix;
+    FS_SEC_NBR   sec_nbr_logical;
+    FS_SEC_NBR   sec_nbr_phy;
+    CPU_INT32U   status;
+
+
+    if (p_nor_data->Mounted == DEF_NO) {
+       *p_err = FS_ERR_DEV_INVALID_LOW_FMT;
+        return (DEF_NO);
+    }
+
+
+                                                                /* -------------- REQ'D ERASE (see Note #1a) ---------- */
+    blk_ix = FSDev_NOR_FindEraseBlk(p_nor_data);
+    if (blk_ix != FS_DEV_NOR_SEC_NBR_INVALID) {
+        FSDev_NOR_EraseBlkPrepare(p_nor_data, blk_ix, p_err);
+        if (*p_err != FS_ERR_NONE) {
+            return (DEF_NO);
+        }
+        FS_CTR_STAT_INC(p_nor_data->StatBgEraseBlkCtr);
+        return (DEF_YES);
+    }
+
+    if (p_nor_data->BlkCntErased >= FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT) {
+       *p_err = FS_ERR_NONE;                                    /* Pool full (see Note #1b).                            */
+        return (DEF_NO);
+    }
+
+
+
+                                                                /* ------------------- SEL VICTIM BLK ----------------- */
+    blk_ix = p_nor_data->CompactBlkIx;
+    if (blk_ix != FS_DEV_NOR_SEC_NBR_INVALID) {
+        FSDev_NOR_GetBlkInfo( p_nor_data,
+                              blk_ix,
+                             &erased,
+                             &sec_cnt_valid);
+        active = FSDev_NOR_IsAB(p_nor_data, blk_ix);
+        if ((erased == DEF_YES) ||                              /* If blk erased or now active (see Note #3) ...        */
+            (active == DEF_YES)) {
+            blk_ix = FS_DEV_NOR_SEC_NBR_INVALID;                /* ... sel new blk.                                     */
+        }
+    }
+
+    if (blk_ix == FS_DEV_NOR_SEC_NBR_INVALID) {
+        blk_ix = FSDev_NOR_FindCompactBlk(p_nor_data);
+        if (blk_ix == FS_DEV_NOR_SEC_NBR_INVALID) {             /* If no blk holds invalid secs ...                     */
+            p_nor_data->CompactBlkIx = FS_DEV_NOR_SEC_NBR_INVALID;
+           *p_err = FS_ERR_NONE;                                /* ... nothing to reclaim.                              */
+            return (DEF_NO);
+        }
+        p_nor_data->CompactBlkIx = blk_ix;
+        p_nor_data->CompactSecIx = 0u;
+
+        FSDev_NOR_GetBlkInfo( p_nor_data,
+                              blk_ix,
+                             &erased,
+                             &sec_cnt_valid);
+    }
+
+
+
+                                                                /* ------------- ERASE EMPTY BLK (see Note #1c) ------- */
+    if (sec_cnt_valid == 0u) {
+        FSDev_NOR_EraseBlkPrepare(p_nor_data, blk_ix, p_err);
+        if (*p_err != FS_ERR_NONE) {
+            return (DEF_NO);
+        }
+        FS_CTR_STAT_INC(p_nor_data->StatBgEraseBlkCtr);
+        return (DEF_YES);
+    }
+
+
+
+                                                                /* ------------- MOVE VALID SECS (see Note #1d) ------- */
+    sec_ix         = p_nor_data->CompactSecIx;
+    sec_cnt_moved  = 0u;
+    sec_cnt_probed = 0u;
+    while ((sec_cnt_valid            >  0u)                             &&
+           (sec_cnt_moved            <  FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT) &&
+           (sec_cnt_probed           <  p_nor_data->BlkSecCnts)         &&
+           (p_nor_data->BlkCntErased >= 2u)) {                  /* See Note #2.                                         */
+        sec_nbr_phy = FSDev_NOR_BlkIx_to_SecNbrPhy(p_nor_data, blk_ix) + sec_ix;
+        sec_addr    = FSDev_NOR_SecNbrPhy_to_Addr(p_nor_data, sec_nbr_phy);
+
+        FSDev_NOR_PhyRdHandler( p_nor_data,                     /* Rd sec hdr.                                          */
+                               &sec_hdr[0],
+                                sec_addr,
+                                FS_DEV_NOR_SEC_HDR_LEN,
+                                p_err);
+        if (*p_err != FS_ERR_NONE) {
+            FS_TRACE_DBG(("FSDev_NOR_CompactStepHandler(): Failed to rd sec hdr %d (0x%08X).\r\n", sec_nbr_phy, sec_addr));
+            return (DEF_NO);
+        }
+
+        sec_nbr_logical = MEM_VAL_GET_INT32U((void *)&sec_hdr[FS_DEV_NOR_SEC_HDR_OFFSET_SEC_NBR]);
+        status          = MEM_VAL_GET_INT32U((void *)&sec_hdr[FS_DEV_NOR_SEC_HDR_OFFSET_STATUS]);
+
+        if ((status          == FS_DEV_NOR_STATUS_SEC_VALID) && /* If sec valid                ...                      */
+            (sec_nbr_logical <  p_nor_data->Size)) {            /* ... & logical sec nbr valid ...                      */
+                                                                /* ... rd sec                  ...                      */
+            FSDev_NOR_PhyRdHandler( p_nor_data,
+                                    p_nor_data->BufPtr,
+                                   (sec_addr + FS_DEV_NOR_SEC_HDR_LEN),
+                                    p_nor_data->SecSize,
+                                    p_err);
+            if (*p_err != FS_ERR_NONE) {
+                FS_TRACE_DBG(("FSDev_NOR_CompactStepHandler(): Failed to rd sec %d (0x%08X).\r\n", sec_nbr_phy, sec_addr));
+                return (DEF_NO);
+            }
+                                                                /* ... & wr to free sec.                                */
+            FSDev_NOR_WrSecLogicalHandler(p_nor_data,
+                                          p_nor_data->BufPtr,
+                                          sec_nbr_logical,
+                                          p_err);
+            if (*p_err != FS_ERR_NONE) {
+                return (DEF_NO);
+            }
+
+            MEM_VAL_SET_INT32U((void *)&sec_hdr[FS_DEV_NOR_SEC_HDR_OFFSET_STATUS], FS_DEV_NOR_STATUS_SEC_INVALID);
+
+            FSDev_NOR_PhyWrHandler( p_nor_data,                 /* Mark sec as 'invalid'.                               */
+                                   &sec_hdr[FS_DEV_NOR_SEC_HDR_OFFSET_STATUS],
+                                    sec_addr + FS_DEV_NOR_SEC_HDR_OFFSET_STATUS,
+                                    4u,
+                                    p_err);
+            if (*p_err != FS_ERR_NONE) {
+                FS_TRACE_DBG(("FSDev_NOR_CompactStepHandler(): Failed to wr hdr of sec %d (0x%08X).\r\n", sec_nbr_phy, sec_addr));
+                return (DEF_NO);
+            }
+
+            FSDev_NOR_DecBlkSecCntValid(p_nor_data, blk_ix);
+            sec_cnt_valid--;
+            p_nor_data->SecCntValid--;
+            p_nor_data->SecCntInvalid++;
+            sec_cnt_moved++;
+            FS_CTR_STAT_INC(p_nor_data->StatCopyCtr);
+            FS_CTR_STAT_INC(p_nor_data->StatBgCopyCtr);
+        }
+
+        sec_ix++;
+        if (sec_ix >= p_nor_data->BlkSecCnts) {                 /* Wrap to start of blk.                                */
+            sec_ix = 0u;
+        }
+        sec_cnt_probed++;
+    }
+
+    p_nor_data->CompactSecIx = sec_ix;
+
+    if ((sec_cnt_moved > 0u) &&
+        (sec_cnt_valid == 0u)) {                                /* If last valid sec moved ...                          */
+        p_nor_data->BlkCntValid--;                              /* ... blk holds only invalid data.                     */
+        p_nor_data->BlkCntInvalid++;
+    }
+
+   *p_err = FS_ERR_NONE;
+    if (sec_cnt_moved == 0u) {                                  /* If no sec could be moved (see Note #2) ...           */
+        return (DEF_NO);                                        /* ... no progress made.                                */
+    }
+    return (DEF_YES);
+}
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      FSDev_NOR_PhyRdHandler()
@@ -4025,6 +4377,13 @@ static  void  FSDev_NOR_EraseBlkEmptyFmt (FS_DEV_NOR_DATA  *p_nor_data,
                            blk_ix,
                            DEF_YES);
 
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    if (p_nor_data->CompactBlkIx == blk_ix) {                   /* If blk was being compacted, drop it.                 */
+        p_nor_data->CompactBlkIx =  FS_DEV_NOR_SEC_NBR_INVALID;
+        p_nor_data->CompactSecIx =  0u;
+    }
+#endif
+
    *p_err = FS_ERR_NONE;
 }
 #endif
@@ -4352,6 +4711,65 @@ static  FS_SEC_NBR  FSDev_NOR_FindErasedBlk (FS_DEV_NOR_DATA  *p_nor_data)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                      FSDev_NOR_FindCompactBlk()
+*
+* Description : Find block to reclaim by background compaction.
+*
+* Argument(s) : p_nor_data  Pointer to NOR data.
+*               ----------  Argument validated by caller.
+*
+* Return(s)   : Block index,                if    block found that holds invalid sectors.
+*               FS_DEV_NOR_SEC_NBR_INVALID, if NO such block exists.
+*
+* Caller(s)   : FSDev_NOR_CompactStepHandler().
+*
+* Note(s)     : (1) The block with the fewest valid sectors is chosen, since it yields an erased block for
+*                   the fewest sector moves.  Erased blocks & active blocks are never chosen.
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+static  FS_SEC_NBR  FSDev_NOR_FindCompactBlk (FS_DEV_NOR_DATA  *p_nor_data)
+{
+    CPU_BOOLEAN  active;
+    FS_SEC_NBR   blk_ix;
+    FS_SEC_NBR   blk_ix_min;
+    CPU_BOOLEAN  erased;
+    FS_SEC_QTY   sec_cnt_valid;
+    FS_SEC_QTY   sec_cnt_valid_min;
+
+
+    blk_ix            = 0u;
+    blk_ix_min        = FS_DEV_NOR_SEC_NBR_INVALID;
+    sec_cnt_valid_min = p_nor_data->BlkSecCnts;
+    while ((blk_ix            <  p_nor_data->BlkCntUsed) &&     /* Probe each blk ...                                   */
+           (sec_cnt_valid_min != 0u)) {                         /* ... while NO empty blk is found.                     */
+        FSDev_NOR_GetBlkInfo( p_nor_data,
+                              blk_ix,
+                             &erased,
+                             &sec_cnt_valid);
+
+        if ((erased            == DEF_NO) &&
+            (sec_cnt_valid_min >  sec_cnt_valid)) {
+            active = FSDev_NOR_IsAB(p_nor_data, blk_ix);
+            if (active == DEF_NO) {                             /* See Note #1.                                         */
+                sec_cnt_valid_min = sec_cnt_valid;
+                blk_ix_min        = blk_ix;
+            }
+        }
+
+        blk_ix++;
+    }
+
+    return (blk_ix_min);
+}
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        FSDev_NOR_AB_ClrAll()
@@ -5471,6 +5889,10 @@ static  FS_DEV_NOR_DATA  *FSDev_NOR_DataGet (void)
     p_nor_data->SecCntInvalid     =  0u;
     p_nor_data->EraseCntMin       =  0u;
     p_nor_data->EraseCntMax       =  0u;
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    p_nor_data->CompactBlkIx      =  FS_DEV_NOR_SEC_NBR_INVALID;
+    p_nor_data->CompactSecIx      =  0u;
+#endif
     p_nor_data->Mounted           =  DEF_NO;
 
                                                                 /* Clr cfg info.                                        */
@@ -5493,6 +5915,10 @@ static  FS_DEV_NOR_DATA  *FSDev_NOR_DataGet (void)
     p_nor_data->StatWrOctetCtr    =  0u;
     p_nor_data->StatEraseBlkCtr   =  0u;
     p_nor_data->StatInvalidBlkCtr =  0u;
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+    p_nor_data->StatBgCopyCtr     =  0u;
+    p_nor_data->StatBgEraseBlkCtr =  0u;
+#endif
 #endif
 
 #if (FS_CFG_CTR_ERR_EN            == DEF_ENABLED)               /* Clr err ctrs.                                        */
@@ -107,6 +107,18 @@
 #define  FS_DEV_NOR_CFG_DBG_CHK_EN                  DEF_DISABLED
 #endif
 
+#ifndef  FS_DEV_NOR_CFG_BG_COMPACT_EN                           /* Incremental compaction (see FSDev_NOR_CompactStep()).*/
+#define  FS_DEV_NOR_CFG_BG_COMPACT_EN               DEF_ENABLED
+#endif
+
+#ifndef  FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT                       /* Target nbr of erased blks kept by compaction.        */
+#define  FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT                    3u
+#endif
+
+#ifndef  FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT                         /* Max nbr of secs moved per compaction step.           */
+#define  FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT                      8u
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -366,6 +378,11 @@ void         FSDev_NOR_LowCompact           (CPU_CHAR              *name_dev,
 void         FSDev_NOR_LowDefrag            (CPU_CHAR              *name_dev,   /* Low-level defrag  device.            */
                                              FS_ERR                *p_err);
 
+#if (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+CPU_BOOLEAN  FSDev_NOR_CompactStep          (CPU_CHAR              *name_dev,   /* Perform one compaction step.         */
+                                             FS_ERR                *p_err);
+#endif
+
                                                                                 /* ---------- PHYSICAL FNCTS ---------- */
 void         FSDev_NOR_PhyRd                (CPU_CHAR              *name_dev,   /* Read data from physical device.      */
                                              void                  *p_dest,
@@ -473,6 +490,30 @@ extern  const  FS_DEV_SPI_API  FSDev_NOR_BSP_SPI;
 #endif
 
 
+#ifndef  FS_DEV_NOR_CFG_BG_COMPACT_EN
+#error  "FS_DEV_NOR_CFG_BG_COMPACT_EN      not #define'd in 'app_cfg.h'"
+#error  "                            [MUST be  DEF_DISABLED]           "
+#error  "                            [     ||  DEF_ENABLED ]           "
+
+#elif  ((FS_DEV_NOR_CFG_BG_COMPACT_EN != DEF_DISABLED) && \
+        (FS_DEV_NOR_CFG_BG_COMPACT_EN != DEF_ENABLED ))
+#error  "FS_DEV_NOR_CFG_BG_COMPACT_EN illegally #define'd in 'app_cfg.h'"
+#error  "                            [MUST be  DEF_DISABLED]           "
+#error  "                            [     ||  DEF_ENABLED ]           "
+
+#elif   (FS_DEV_NOR_CFG_BG_COMPACT_EN == DEF_ENABLED)
+#if     (FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT < 2u)
+#error  "FS_DEV_NOR_CFG_BG_ERASED_BLK_CNT  illegally #define'd in 'app_cfg.h'"
+#error  "                            [MUST be  >= 2]                   "
+#endif
+
+#if     (FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT < 1u)
+#error  "FS_DEV_NOR_CFG_BG_MOVE_SEC_CNT    illegally #define'd in 'app_cfg.h'"
+#error  "                            [MUST be  >= 1]                   "
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -256,9 +256,35 @@ static  MEM_POOL  FS_FAT_DataPool;
 /*
 *********************************************************************************************************
 *                                            LOCAL MACRO'S
+*
+* Note(s) : (1) Bit 'n' of the free cluster map is set if clusters [n << ClusMapGrpLog2, (n + 1) << ClusMapGrpLog2)
+*               MAY contain a free cluster & clear if they are known NOT to.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)                     /* See Note #1.                                         */
+#define  FS_FAT_CLUS_MAP_GRP(p_fat_data, clus)          ((FS_FAT_CLUS_NBR)(clus) >> (p_fat_data)->ClusMapGrpLog2)
+
+#define  FS_FAT_CLUS_MAP_IS_SET(p_fat_data, grp)        ((((p_fat_data)->ClusMap[(grp) >> 3u] >> ((grp) & 0x07u)) & 0x01u) != 0u)
+
+#define  FS_FAT_CLUS_MAP_SET(p_fat_data, grp)           {(p_fat_data)->ClusMap[(grp) >> 3u] |=  (CPU_INT08U)DEF_BIT((grp) & 0x07u); }
+
+#define  FS_FAT_CLUS_MAP_CLR(p_fat_data, grp)           {(p_fat_data)->ClusMap[(grp) >> 3u] &= ~(CPU_INT08U)DEF_BIT((grp) & 0x07u); }
+#endif
+
+/*
+*********************************************************************************************************
+*                                       DIRECTORY CACHE MACRO'S
+*
+* Note(s) : (1) A name is cached in the single entry selected by its hash & the first sector of its parent
+*               directory.  A newer lookup mapping to the same entry replaces the older one.
 *********************************************************************************************************
 */
 
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)                    /* See Note #1.                                         */
+#define  FS_FAT_DIR_CACHE_IX(dir_first_sec, hash)       ((CPU_SIZE_T)(((CPU_INT32U)(dir_first_sec) ^ (hash)) % FS_FAT_CFG_DIR_CACHE_NBR))
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -292,6 +318,21 @@ static  void  FS_FAT_LowDirFirstClusAdd (FS_VOL            *p_vol,          /* A
                                          FS_FAT_SEC_NBR     dir_parent_sec,
                                          FS_ERR            *p_err);
 
+static  CPU_BOOLEAN  FS_FAT_ClusFreeIgnore (FS_FAT_DATA    *p_fat_data,     /* Chk if free clus must be skipped.            */
+                                            FS_FAT_CLUS_NBR clus);
+#endif
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+static  void  FS_FAT_ClusMapBuild       (FS_VOL            *p_vol,          /* Build free clus map.                         */
+                                         FS_ERR            *p_err);
+
+static  FS_FAT_CLUS_NBR  FS_FAT_ClusMapRunFind (FS_VOL          *p_vol,     /* Find run of free clus's.                     */
+                                                FS_BUF          *p_buf,
+                                                FS_FAT_CLUS_NBR  nbr_clus,
+                                                FS_ERR          *p_err);
+
+static  FS_FAT_CLUS_NBR  FS_FAT_ClusMapSkipGet (FS_FAT_DATA     *p_fat_data,/* Get nbr of clus's without free clus.         */
+                                                FS_FAT_CLUS_NBR  clus);
 #endif
 
 static  void  FS_FAT_DataSrch           (FS_VOL            *p_vol,          /* Find file in data.                           */
@@ -302,6 +343,33 @@ static  void  FS_FAT_DataSrch           (FS_VOL            *p_vol,          /* F
                                          FS_FAT_DIR_POS    *p_dir_end_pos,
                                          FS_ERR            *p_err);
 
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  FS_FAT_DirCacheFind (FS_VOL            *p_vol,          /* Find name in dir cache.                      */
+                                          FS_BUF            *p_buf,
+                                          FS_FAT_SEC_NBR     dir_first_sec,
+                                          CPU_CHAR          *name_entry,
+                                          CPU_CHAR         **p_name_entry_next,
+                                          FS_FAT_DIR_POS    *p_dir_start_pos,
+                                          FS_FAT_DIR_POS    *p_dir_end_pos,
+                                          FS_ERR            *p_err);
+
+static  void  FS_FAT_DirCacheAdd        (FS_FAT_DATA       *p_fat_data,     /* Add result of dir srch to dir cache.         */
+                                         FS_FAT_SEC_NBR     dir_first_sec,
+                                         CPU_CHAR          *name_entry,
+                                         CPU_CHAR          *name_entry_next,
+                                         FS_FAT_DIR_POS    *p_dir_start_pos,
+                                         FS_FAT_DIR_POS    *p_dir_end_pos,
+                                         FS_ERR             err_srch);
+
+static  CPU_SIZE_T  FS_FAT_DirCacheNameLen (CPU_CHAR          *name_entry,  /* Get len & hash of path component.            */
+                                            CPU_INT32U        *p_hash);
+
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+static  void  FS_FAT_DirCacheInvalidate (FS_FAT_DATA       *p_fat_data,     /* Invalidate dir cache entries of dir.         */
+                                         FS_FAT_SEC_NBR     dir_first_sec);
+#endif
+#endif
+
 static  void  FS_FAT_FileDataClr        (FS_FAT_FILE_DATA  *p_entry_data);  /* Clr FAT file data struct.                    */
 
 static  void  FS_FAT_FileDataInit       (FS_FAT_FILE_DATA  *p_entry_data,   /* Init FAT file data struct.                   */
@@ -707,6 +775,14 @@ void  FS_FAT_VolChk (CPU_CHAR  *name_vol,
 *
 * Note(s)     : (1) Uncompleted allocations are rewinded using reverse deletion. By doing so, we make sure
 *                   deletion can always be completed after a potential failure (even without journaling).
+*
+*               (2) If the free cluster map is enabled :
+*
+*                   (a) A new chain of several clusters is placed in the first run of 'nbr_clus' contiguous
+*                       free clusters, if any, so that it can be accessed with multi-sector transfers.
+*
+*                   (b) An existing chain is extended from its last cluster rather than from the volume's
+*                       next free cluster, so that files appended in turn are not interleaved.
 *********************************************************************************************************
 */
 
@@ -722,6 +798,9 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusChainAlloc (FS_VOL           *p_vol,
     FS_FAT_CLUS_NBR   cur_clus;
     FS_FAT_CLUS_NBR   next_clus;
     CPU_BOOLEAN       is_new_chain;
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    FS_FAT_CLUS_NBR   run_start_clus;
+#endif
 
 
     p_fat_data   = (FS_FAT_DATA  *)p_vol->DataPtr;
@@ -737,6 +816,21 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusChainAlloc (FS_VOL           *p_vol,
     }
 
                                                                 /* ----------------- FIND START CLUS ------------------ */
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    if ((start_clus == 0u) && (nbr_clus > 1u)) {                /* If new multi-clus chain ...                          */
+        run_start_clus = FS_FAT_ClusMapRunFind(p_vol,           /* ... look for contiguous free run (see Note #2a).     */
+                                               p_buf,
+                                               nbr_clus,
+                                               p_err);
+        if (*p_err != FS_ERR_NONE) {
+            return (0u);
+        }
+        if (run_start_clus != 0u) {
+            p_fat_data->NextClusNbr = run_start_clus;
+        }
+    }
+#endif
+
     if (start_clus == 0u) {                                     /* If new chain, find start clus.                       */
         start_clus = FS_FAT_ClusFreeFind(p_vol,
                                          p_buf,
@@ -803,6 +897,13 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusChainAlloc (FS_VOL           *p_vol,
 
 
                                                                 /* ----------------- ALLOC CLUS CHAIN ----------------- */
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    if ((is_new_chain              == DEF_NO) &&                /* If existing chain extended ...                       */
+        (p_fat_data->ClusMapValid == DEF_YES)) {
+        p_fat_data->NextClusNbr = start_clus + 1u;              /* ... continue after its last clus (see Note #2b).     */
+    }
+#endif
+
     cur_clus = start_clus;
     while (rem_clus > 0u) {
 
@@ -1083,7 +1184,8 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusChainDel (FS_VOL           *p_vol,
 * Caller(s)   : FS_FAT_ClusChainAlloc(),
 *               FS_FAT_JournalReplayClusChainAlloc().
 *
-* Note(s)     : none.
+* Note(s)     : (1) An invalid start cluster may already be free, e.g., when its allocation was logged but
+*                   never written to the FAT.  It is then not counted as freed.
 *********************************************************************************************************
 */
 
@@ -1098,6 +1200,8 @@ void  FS_FAT_ClusChainReverseDel (FS_VOL           *p_vol,
     FS_FAT_CLUS_NBR   cur_clus;
     FS_FAT_SEC_NBR    cur_sec;
     FS_FAT_CLUS_NBR   new_fat_entry;
+    FS_FAT_CLUS_NBR   fat_entry;
+    CPU_BOOLEAN       clus_free;
 #if (FS_TRACE_LEVEL >= TRACE_LEVEL_LOG)
     FS_FAT_CLUS_NBR   clus_cnt;
 #endif
@@ -1130,9 +1234,20 @@ void  FS_FAT_ClusChainReverseDel (FS_VOL           *p_vol,
             (*p_err != FS_ERR_SYS_CLUS_INVALID)) {
             return;
         }
+        clus_free = DEF_NO;
         if ((*p_err == FS_ERR_SYS_CLUS_INVALID) &&              /* If start clus is invalid ...                         */
             ( cur_clus == 0u)) {
-            cur_clus = start_clus;                              /* ... go on to make sure it is either free or EOC.     */
+            cur_clus  = start_clus;                             /* ... go on to make sure it is either free or EOC.     */
+            fat_entry = p_fat_data->FAT_TypeAPI_Ptr->ClusValRd(p_vol,
+                                                               p_buf,
+                                                               start_clus,
+                                                               p_err);
+            if (*p_err != FS_ERR_NONE) {
+                return;
+            }
+            if (fat_entry == p_fat_data->FAT_TypeAPI_Ptr->ClusFree) {
+                clus_free = DEF_YES;                            /* See Note #1.                                         */
+            }
         }
 
         if ((cur_clus == start_clus) && (del_first == DEF_NO)) {    /* If start clus must be preserved ...              */
@@ -1150,7 +1265,8 @@ void  FS_FAT_ClusChainReverseDel (FS_VOL           *p_vol,
                 return;
             }
 
-            if (p_fat_data->QueryInfoValid == DEF_YES) {
+            if ((p_fat_data->QueryInfoValid == DEF_YES) &&
+                (clus_free                  == DEF_NO)) {
                 p_fat_data->QueryFreeClusCnt++;
             }
 
@@ -1475,6 +1591,10 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusChainReverseFollow (FS_VOL           *p_vol,
 * Note(s)     : (1) In order for journaling to behave as expected, FAT entry updates must be atomic.
 *                   To ensure this is the case when using FAT12, cross-boundary FAT entries must be
 *                   avoided.
+*
+*               (2) If the free cluster map is valid, groups of clusters known to contain no free cluster
+*                   are skipped without reading the FAT.  A group read entirely without finding a free
+*                   cluster is marked as such in the map.
 *********************************************************************************************************
 */
 
@@ -1489,9 +1609,11 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusFreeFind (FS_VOL  *p_vol,
     FS_FAT_CLUS_NBR   clus_cnt_chkd;
     FS_FAT_CLUS_NBR   max_nbr_clus;
     CPU_BOOLEAN       clus_ignore;
-#if ((FS_FAT_CFG_FAT12_EN == DEF_ENABLED) && (FS_FAT_CFG_JOURNAL_EN == DEF_ENABLED))
-    FS_SEC_SIZE       fat_offset;
-    FS_SEC_SIZE       fat_sec_offset;
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    FS_FAT_CLUS_NBR   skip_cnt;
+    FS_FAT_CLUS_NBR   grp_mask;
+    CPU_BOOLEAN       grp_rd_all;
+    CPU_BOOLEAN       grp_free_found;
 #endif
 
 
@@ -1499,14 +1621,37 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusFreeFind (FS_VOL  *p_vol,
     next_clus      =  p_fat_data->NextClusNbr;
     max_nbr_clus   =  p_fat_data->MaxClusNbr - FS_FAT_MIN_CLUS_NBR;
     clus_cnt_chkd  =  0u;
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    grp_mask       = ((FS_FAT_CLUS_NBR)1u << p_fat_data->ClusMapGrpLog2) - 1u;
+    grp_rd_all     =  DEF_NO;
+    grp_free_found =  DEF_NO;
+#endif
 
 
                                                                 /* ----------------- FREE CLUS LOOKUP ----------------- */
     while (clus_cnt_chkd < max_nbr_clus) {
         if (next_clus >= p_fat_data->MaxClusNbr) {              /* Wrap clus nbr.                                       */
             next_clus  = FS_FAT_MIN_CLUS_NBR;
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+            grp_rd_all = DEF_NO;
+#endif
         }
 
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+        if (p_fat_data->ClusMapValid == DEF_YES) {              /* Skip grps without free clus (see Note #2).           */
+            skip_cnt = FS_FAT_ClusMapSkipGet(p_fat_data, next_clus);
+            if (skip_cnt != 0u) {
+                next_clus     += skip_cnt;
+                clus_cnt_chkd += skip_cnt;
+                continue;
+            }
+
+            if ((next_clus & grp_mask) == 0u) {                 /* Whole grp will be rd.                                */
+                grp_rd_all     = DEF_YES;
+                grp_free_found = DEF_NO;
+            }
+        }
+#endif
 
                                                                 /* Rd next FAT entry.                                   */
         fat_entry = p_fat_data->FAT_TypeAPI_Ptr->ClusValRd(p_vol,
@@ -1520,18 +1665,10 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusFreeFind (FS_VOL  *p_vol,
 
                                                                 /* ----------------- FREE CLUS FOUND ------------------ */
         if (fat_entry == p_fat_data->FAT_TypeAPI_Ptr->ClusFree) {   /* Chk if free clus found.                          */
-            clus_ignore = DEF_NO;                                   /* Clus not ignore'd by dflt.                       */
-#if ((FS_FAT_CFG_FAT12_EN == DEF_ENABLED) && (FS_FAT_CFG_JOURNAL_EN == DEF_ENABLED))
-            if ((p_fat_data->FAT_Type     == 12u) &&                /* If FAT12 and journal started ...                 */
-                (DEF_BIT_IS_SET(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_START) == DEF_YES)) {
-                fat_offset     = (FS_SEC_SIZE)next_clus + ((FS_SEC_SIZE)next_clus / 2u);
-                fat_sec_offset =  fat_offset & (p_fat_data->SecSize - 1u);
-                if (fat_sec_offset == p_fat_data->SecSize - 1u) {  /* ... avoid sec boundary (see Note #1) ...          */
-                    FS_TRACE_LOG(("FS_FAT_ClusFreeFind(): Sec boundary clus avoided: %d.\r\n", next_clus));
-                    clus_ignore = DEF_YES;
-                }
-            }
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+            grp_free_found = DEF_YES;
 #endif
+            clus_ignore    = FS_FAT_ClusFreeIgnore(p_fat_data, next_clus);
             if (clus_ignore == DEF_NO) {
                 p_fat_data->NextClusNbr = next_clus + 1u;       /* ... else store next clus ...                         */
                 FS_TRACE_LOG(("FS_FAT_ClusFreeFind(): New FAT clus alloc'd: %d.\r\n", next_clus));
@@ -1542,6 +1679,16 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusFreeFind (FS_VOL  *p_vol,
 
         next_clus++;
         clus_cnt_chkd++;
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+        if ((grp_rd_all == DEF_YES) &&                          /* If whole grp rd without free clus ...                */
+           (((next_clus & grp_mask) == 0u) || (next_clus >= p_fat_data->MaxClusNbr))) {
+            if (grp_free_found == DEF_NO) {
+                FS_FAT_CLUS_MAP_CLR(p_fat_data, FS_FAT_CLUS_MAP_GRP(p_fat_data, next_clus - 1u));   /* ... clr map bit. */
+            }
+            grp_rd_all = DEF_NO;
+        }
+#endif
     }
 
 
@@ -1553,6 +1700,104 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusFreeFind (FS_VOL  *p_vol,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       FS_FAT_ClusMapUpdate()
+*
+* Description : Update free cluster map after a FAT entry was written.
+*
+* Argument(s) : p_fat_data  Pointer to FAT info structure.
+*               ----------  Argument validated by caller.
+*
+*               clus        Cluster whose FAT entry was written.
+*
+*               is_free     Indicates whether the cluster was marked free :
+*
+*                               DEF_NO,  if cluster was allocated (or marked bad).
+*                               DEF_YES, if cluster was freed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_FAT12_ClusValWr(),
+*               FS_FAT_FAT16_ClusValWr(),
+*               FS_FAT_FAT32_ClusValWr().
+*
+* Note(s)     : (1) A group bit can only be cleared on allocation if the group holds a single cluster.
+*                   Otherwise, the bit is left set & is cleared by FS_FAT_ClusFreeFind() once the whole
+*                   group has been read without finding a free cluster.
+*
+*               (2) Any freed cluster may lengthen a free run, so previous failed run searches are
+*                   forgotten.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+void  FS_FAT_ClusMapUpdate (FS_FAT_DATA      *p_fat_data,
+                            FS_FAT_CLUS_NBR   clus,
+                            CPU_BOOLEAN       is_free)
+{
+    FS_FAT_CLUS_NBR  grp;
+
+
+    if (p_fat_data->ClusMapValid == DEF_NO) {                   /* Map not built (yet).                                 */
+        return;
+    }
+    if (clus >= p_fat_data->MaxClusNbr) {
+        return;
+    }
+
+    grp = FS_FAT_CLUS_MAP_GRP(p_fat_data, clus);
+    if (is_free == DEF_YES) {
+        FS_FAT_CLUS_MAP_SET(p_fat_data, grp);
+        p_fat_data->ClusMapRunMissLen = 0u;                     /* See Note #2.                                         */
+
+    } else if (p_fat_data->ClusMapGrpLog2 == 0u) {              /* See Note #1.                                         */
+        FS_FAT_CLUS_MAP_CLR(p_fat_data, grp);
+
+    } else {
+        ;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        FS_FAT_DirCacheClr()
+*
+* Description : Clear directory lookup cache.
+*
+* Argument(s) : p_fat_data  Pointer to FAT info structure.
+*               ----------  Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_DataClr(),
+*               FS_FAT_LowEntryRename(),
+*               FS_FAT_JournalReplay().
+*
+*               This function is an INTERNAL file system suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) Callers that modify directory entries other than through FS_FAT_LowEntryCreate() or
+*                   FS_FAT_LowEntryDel() MUST clear the cache.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+void  FS_FAT_DirCacheClr (FS_FAT_DATA  *p_fat_data)
+{
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < FS_FAT_CFG_DIR_CACHE_NBR; ix++) {
+        p_fat_data->DirCache[ix].DirFirstSec = 0u;              /* Sec 0 is never a dir sec.                            */
+    }
+}
+#endif
+
+
+
 /*
 *********************************************************************************************************
 *                                       FS_FAT_ClusNextGet()
@@ -3128,6 +3373,9 @@ void  FS_FAT_VolLabelSet (FS_VOL    *p_vol,
 *               application function(s).
 *
 * Note(s)     : (1) The file system lock MUST be held to get the FAT data from the FAT data pool.
+*
+*               (2) The free cluster map is only an accelerator.  If it cannot be built, the volume is
+*                   still opened & free clusters are found by reading the FAT.
 *********************************************************************************************************
 */
 
@@ -3229,6 +3477,13 @@ void  FS_FAT_VolOpen (FS_VOL  *p_vol,
     }
 #endif
 
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    FS_FAT_ClusMapBuild(p_vol, &err_tmp);                       /* Build free clus map (see Note #2).                   */
+    if (err_tmp != FS_ERR_NONE) {
+        FS_TRACE_DBG(("FS_FAT_VolOpen(): Free clus map could not be built; FAT will be searched entry by entry.\r\n"));
+    }
+#endif
+
                                                                 /* ----------------- OUTPUT TRACE INFO ---------------- */
     FS_TRACE_INFO(("FS_FAT_VolOpen(): File system found: Type     : FAT%d \r\n",  p_fat_data->FAT_Type));
     FS_TRACE_INFO(("                                     Sec  size: %d B  \r\n",  p_fat_data->SecSize));
@@ -4381,6 +4636,9 @@ void  FS_FAT_LowEntryCreate (FS_VOL            *p_vol,
 
 
                                                                 /* ----------------- CREATE DIR ENTRY ----------------- */
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+    FS_FAT_DirCacheInvalidate((FS_FAT_DATA *)p_vol->DataPtr, dir_first_sec);
+#endif
     dir_start_pos.SecNbr = dir_first_sec;
     dir_start_pos.SecPos = 0u;
     FS_FAT_FN_API_Active.DirEntryCreate( p_vol,
@@ -4476,6 +4734,15 @@ void  FS_FAT_LowEntryDel (FS_VOL            *p_vol,
 
     p_fat_data = (FS_FAT_DATA *)p_vol->DataPtr;
 
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)                    /* Invalidate cached names of parent dir ...            */
+    FS_FAT_DirCacheInvalidate(p_fat_data, p_entry_data->DirFirstSec);
+    if (DEF_BIT_IS_SET(p_entry_data->Attrib, FS_FAT_DIRENT_ATTR_DIRECTORY) == DEF_YES) {
+        valid = FS_FAT_IS_VALID_CLUS(p_fat_data, p_entry_data->FileFirstClus);
+        if (valid == DEF_YES) {                                 /* ... & of dir itself.                                 */
+            FS_FAT_DirCacheInvalidate(p_fat_data, FS_FAT_CLUS_TO_SEC(p_fat_data, p_entry_data->FileFirstClus));
+        }
+    }
+#endif
 
                                                                 /* ------------------- DEL DIR ENTRY ------------------ */
     dir_start_pos.SecNbr = p_entry_data->DirStartSec;
@@ -4557,6 +4824,10 @@ void  FS_FAT_LowEntryDel (FS_VOL            *p_vol,
 *
 * Note(s)     : (1) If entry is a directory, a file with the directory name is created & then updated
 *                   with the attributes of a directory.
+*
+*               (2) Since entries are removed from & created in possibly different directories, & a
+*                   renamed directory entry is rewritten with the directory attribute, the whole
+*                   directory lookup cache is cleared.
 *********************************************************************************************************
 */
 
@@ -4580,6 +4851,10 @@ void  FS_FAT_LowEntryRename (FS_VOL            *p_vol,
 
     p_fat_data = (FS_FAT_DATA  *)p_vol->DataPtr;
 
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+    FS_FAT_DirCacheClr(p_fat_data);                             /* See Note #2.                                         */
+#endif
+
                                                                 /* ------------ REM TARGET ENTRY IF NEEDED ------------ */
     if (exists == DEF_YES) {
         target_entry_first_clus = p_entry_data_new->FileFirstClus;
@@ -5901,6 +6176,332 @@ static  void  FS_FAT_ChkFile (FS_VOL            *p_vol,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       FS_FAT_ClusFreeIgnore()
+*
+* Description : Determine whether a free cluster must NOT be allocated.
+*
+* Argument(s) : p_fat_data  Pointer to FAT info structure.
+*               ----------  Argument validated by caller.
+*
+*               clus        Free cluster.
+*
+* Return(s)   : DEF_YES, if cluster must be skipped (see Note #1).
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : FS_FAT_ClusFreeFind(),
+*               FS_FAT_ClusMapRunFind().
+*
+* Note(s)     : (1) See 'FS_FAT_ClusFreeFind()  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+static  CPU_BOOLEAN  FS_FAT_ClusFreeIgnore (FS_FAT_DATA      *p_fat_data,
+                                            FS_FAT_CLUS_NBR   clus)
+{
+#if ((FS_FAT_CFG_FAT12_EN == DEF_ENABLED) && (FS_FAT_CFG_JOURNAL_EN == DEF_ENABLED))
+    FS_SEC_SIZE  fat_offset;
+    FS_SEC_SIZE  fat_sec_offset;
+
+
+    if ((p_fat_data->FAT_Type     == 12u) &&                    /* If FAT12 and journal started ...                     */
+        (DEF_BIT_IS_SET(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_START) == DEF_YES)) {
+        fat_offset     = (FS_SEC_SIZE)clus + ((FS_SEC_SIZE)clus / 2u);
+        fat_sec_offset =  fat_offset & (p_fat_data->SecSize - 1u);
+        if (fat_sec_offset == p_fat_data->SecSize - 1u) {       /* ... avoid sec boundary (see Note #1).                */
+            FS_TRACE_LOG(("FS_FAT_ClusFreeFind(): Sec boundary clus avoided: %d.\r\n", clus));
+            return (DEF_YES);
+        }
+    }
+#else
+    (void)&p_fat_data;                                          /* Prevent 'variable unused' compiler warnings.         */
+    (void)&clus;
+#endif
+
+    return (DEF_NO);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        FS_FAT_ClusMapBuild()
+*
+* Description : Build free cluster map & free/bad cluster counts of volume.
+*
+* Argument(s) : p_vol       Pointer to volume.
+*               ----------  Argument validated by caller.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE              Free cluster map built.
+*                               FS_ERR_BUF_NONE_AVAIL    No buffer available.
+*
+*                               ---------------RETURNED BY p_fat_data->FAT_TypeAPI_Ptr->ClusValRd()---------------
+*                               See p_fat_data->FAT_TypeAPI_Ptr->ClusValRd() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_VolOpen().
+*
+* Note(s)     : (1) Each map bit covers the smallest power-of-2 group of clusters that lets the map hold
+*                   every cluster of the volume in FS_FAT_CFG_CLUS_MAP_SIZE octets.
+*
+*               (2) The FAT is read once, in order; consecutive entries share the FAT sector held in the
+*                   buffer.  The free & bad cluster counts gathered along the way make 'FS_FAT_Query()'
+*                   immediate.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+static  void  FS_FAT_ClusMapBuild (FS_VOL  *p_vol,
+                                   FS_ERR  *p_err)
+{
+    FS_BUF           *p_buf;
+    FS_FAT_DATA      *p_fat_data;
+    FS_FAT_CLUS_NBR   bad_clus_cnt;
+    FS_FAT_CLUS_NBR   free_clus_cnt;
+    FS_FAT_CLUS_NBR   clus;
+    FS_FAT_CLUS_NBR   fat_entry;
+    CPU_INT08U        grp_log2;
+
+
+    p_fat_data               = (FS_FAT_DATA *)p_vol->DataPtr;
+    p_fat_data->ClusMapValid =  DEF_NO;
+
+                                                                /* ------------------ CALC GRP SIZE ------------------- */
+    grp_log2 = 0u;                                              /* See Note #1.                                         */
+    while (((p_fat_data->MaxClusNbr - 1u) >> grp_log2) >= ((FS_FAT_CLUS_NBR)FS_FAT_CFG_CLUS_MAP_SIZE * DEF_OCTET_NBR_BITS)) {
+        grp_log2++;
+    }
+    p_fat_data->ClusMapGrpLog2    = grp_log2;
+    p_fat_data->ClusMapRunMissLen = 0u;
+    Mem_Clr((void     *)&p_fat_data->ClusMap[0],
+            (CPU_SIZE_T) sizeof(p_fat_data->ClusMap));
+
+
+    p_buf = FSBuf_Get(p_vol);
+    if (p_buf == (FS_BUF *)0) {
+       *p_err = FS_ERR_BUF_NONE_AVAIL;
+        return;
+    }
+
+                                                                /* ---------------------- RD FAT ---------------------- */
+    bad_clus_cnt  = 0u;                                         /* See Note #2.                                         */
+    free_clus_cnt = 0u;
+    clus          = FS_FAT_MIN_CLUS_NBR;
+    while (clus < p_fat_data->MaxClusNbr) {
+        fat_entry = p_fat_data->FAT_TypeAPI_Ptr->ClusValRd(p_vol,
+                                                           p_buf,
+                                                           clus,
+                                                           p_err);
+        if (*p_err != FS_ERR_NONE) {
+            FSBuf_Free(p_buf);
+            return;
+        }
+
+        if (fat_entry == p_fat_data->FAT_TypeAPI_Ptr->ClusFree) {
+            FS_FAT_CLUS_MAP_SET(p_fat_data, FS_FAT_CLUS_MAP_GRP(p_fat_data, clus));
+            free_clus_cnt++;
+
+        } else if (fat_entry == p_fat_data->FAT_TypeAPI_Ptr->ClusBad) {
+            bad_clus_cnt++;
+
+        } else {
+            ;
+        }
+
+        clus++;
+    }
+
+    FSBuf_Free(p_buf);
+
+                                                                /* ------------------- UPDATE INFO -------------------- */
+    p_fat_data->QueryInfoValid   = DEF_YES;
+    p_fat_data->QueryBadClusCnt  = bad_clus_cnt;
+    p_fat_data->QueryFreeClusCnt = free_clus_cnt;
+    p_fat_data->ClusMapValid     = DEF_YES;
+
+    FS_TRACE_INFO(("FS_FAT_ClusMapBuild(): Free clus map built: %d free clus's, %d clus's per map bit.\r\n", free_clus_cnt, 1u << grp_log2));
+
+   *p_err = FS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       FS_FAT_ClusMapRunFind()
+*
+* Description : Find run of contiguous free clusters.
+*
+* Argument(s) : p_vol       Pointer to volume.
+*               ----------  Argument validated by caller.
+*
+*               p_buf       Pointer to temporary buffer.
+*               ----------  Argument validated by caller.
+*
+*               nbr_clus    Number of clusters in run.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE    Search completed (run found or not).
+*
+*                               ---------------RETURNED BY p_fat_data->FAT_TypeAPI_Ptr->ClusValRd()---------------
+*                               See p_fat_data->FAT_TypeAPI_Ptr->ClusValRd() for additional return error codes.
+*
+* Return(s)   : First cluster of run, if run found.
+*               0,                    otherwise.
+*
+* Caller(s)   : FS_FAT_ClusChainAlloc().
+*
+* Note(s)     : (1) The search starts at the volume's next cluster & stops after the whole volume has been
+*                   searched once.  Runs do NOT wrap around the end of the volume.
+*
+*               (2) Allocations only shorten free runs.  Once a run of some length has not been found, the
+*                   search is skipped for runs at least as long until a cluster is freed (see also
+*                   'FS_FAT_ClusMapUpdate()  Note #2').
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+static  FS_FAT_CLUS_NBR  FS_FAT_ClusMapRunFind (FS_VOL           *p_vol,
+                                                FS_BUF           *p_buf,
+                                                FS_FAT_CLUS_NBR   nbr_clus,
+                                                FS_ERR           *p_err)
+{
+    FS_FAT_DATA      *p_fat_data;
+    FS_FAT_CLUS_NBR   fat_entry;
+    FS_FAT_CLUS_NBR   next_clus;
+    FS_FAT_CLUS_NBR   clus_cnt_chkd;
+    FS_FAT_CLUS_NBR   max_nbr_clus;
+    FS_FAT_CLUS_NBR   skip_cnt;
+    FS_FAT_CLUS_NBR   run_start_clus;
+    FS_FAT_CLUS_NBR   run_len;
+
+
+    p_fat_data = (FS_FAT_DATA *)p_vol->DataPtr;
+   *p_err      =  FS_ERR_NONE;
+
+    if (p_fat_data->ClusMapValid == DEF_NO) {
+        return (0u);
+    }
+    if ((p_fat_data->ClusMapRunMissLen != 0u) &&                /* Run known to be unavailable (see Note #2).           */
+        (nbr_clus >= p_fat_data->ClusMapRunMissLen)) {
+        return (0u);
+    }
+    if (nbr_clus > p_fat_data->QueryFreeClusCnt) {              /* Not enough free clus's.                              */
+        return (0u);
+    }
+
+
+                                                                /* ------------------ FREE RUN LOOKUP ----------------- */
+    next_clus      = p_fat_data->NextClusNbr;
+    max_nbr_clus   = p_fat_data->MaxClusNbr - FS_FAT_MIN_CLUS_NBR;
+    clus_cnt_chkd  = 0u;
+    run_start_clus = 0u;
+    run_len        = 0u;
+    while (clus_cnt_chkd < max_nbr_clus) {
+        if (next_clus >= p_fat_data->MaxClusNbr) {              /* Wrap clus nbr (see Note #1).                         */
+            next_clus = FS_FAT_MIN_CLUS_NBR;
+            run_len   = 0u;
+        }
+
+        skip_cnt = FS_FAT_ClusMapSkipGet(p_fat_data, next_clus);
+        if (skip_cnt != 0u) {                                   /* Grp without free clus ends run.                      */
+            next_clus     += skip_cnt;
+            clus_cnt_chkd += skip_cnt;
+            run_len        = 0u;
+            continue;
+        }
+
+        fat_entry = p_fat_data->FAT_TypeAPI_Ptr->ClusValRd(p_vol,
+                                                           p_buf,
+                                                           next_clus,
+                                                           p_err);
+        if (*p_err != FS_ERR_NONE) {
+            return (0u);
+        }
+
+        if ((fat_entry == p_fat_data->FAT_TypeAPI_Ptr->ClusFree) &&
+            (FS_FAT_ClusFreeIgnore(p_fat_data, next_clus) == DEF_NO)) {
+            if (run_len == 0u) {
+                run_start_clus = next_clus;
+            }
+            run_len++;
+            if (run_len == nbr_clus) {                          /* Run found.                                           */
+                FS_TRACE_LOG(("FS_FAT_ClusMapRunFind(): Run of %d free clus's found at clus %d.\r\n", nbr_clus, run_start_clus));
+                return (run_start_clus);
+            }
+        } else {
+            run_len = 0u;
+        }
+
+        next_clus++;
+        clus_cnt_chkd++;
+    }
+
+                                                                /* ------------------- NO RUN FOUND ------------------- */
+    p_fat_data->ClusMapRunMissLen = nbr_clus;                   /* See Note #2.                                         */
+    FS_TRACE_LOG(("FS_FAT_ClusMapRunFind(): No run of %d free clus's found.\r\n", nbr_clus));
+    return (0u);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       FS_FAT_ClusMapSkipGet()
+*
+* Description : Get number of clusters that can be skipped by a free cluster search.
+*
+* Argument(s) : p_fat_data  Pointer to FAT info structure.
+*               ----------  Argument validated by caller.
+*
+*               clus        Cluster from which search continues.
+*
+* Return(s)   : Number of clusters from 'clus' known to contain no free cluster (see Note #1).
+*
+* Caller(s)   : FS_FAT_ClusFreeFind(),
+*               FS_FAT_ClusMapRunFind().
+*
+* Note(s)     : (1) If the whole map octet holding the cluster's group is clear, the following groups
+*                   sharing that octet are skipped as well.  The count never extends past the last
+*                   cluster of the volume.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+static  FS_FAT_CLUS_NBR  FS_FAT_ClusMapSkipGet (FS_FAT_DATA      *p_fat_data,
+                                                FS_FAT_CLUS_NBR   clus)
+{
+    FS_FAT_CLUS_NBR  grp;
+    FS_FAT_CLUS_NBR  skip_cnt;
+
+
+    grp = FS_FAT_CLUS_MAP_GRP(p_fat_data, clus);
+
+    if (p_fat_data->ClusMap[grp >> 3u] == 0u) {                 /* Skip to next map octet (see Note #1).                */
+        skip_cnt = (((grp >> 3u) + 1u) << (p_fat_data->ClusMapGrpLog2 + 3u)) - clus;
+
+    } else if (FS_FAT_CLUS_MAP_IS_SET(p_fat_data, grp) == DEF_NO) {
+        skip_cnt = ((grp + 1u) << p_fat_data->ClusMapGrpLog2) - clus;
+
+    } else {
+        return (0u);
+    }
+
+    if (skip_cnt > p_fat_data->MaxClusNbr - clus) {             /* Don't skip past end of vol.                          */
+        skip_cnt = p_fat_data->MaxClusNbr - clus;
+    }
+
+    return (skip_cnt);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         FS_FAT_GetSysCfg()
@@ -6111,6 +6712,11 @@ static  void  FS_FAT_GetSysCfg  (FS_SEC_SIZE      sec_size,
 *               (2) (a) Consecutive file separator characters are ignored.
 *
 *                   (b) #### Handle "dot" & "dot dot" file path components.
+*
+*               (3) Each path component is first looked up in the directory cache.  On a hit, the sector
+*                   holding the final directory entry of the name is read into 'p_buf' exactly as if the
+*                   directory had been scanned, so that callers examine the entry the same way in either
+*                   case.  A name cached as absent is reported absent without reading the directory.
 *********************************************************************************************************
 */
 
@@ -6131,6 +6737,7 @@ static  void  FS_FAT_DataSrch (FS_VOL          *p_vol,
     FS_FAT_DATA      *p_fat_data;
     CPU_CHAR          name_char;
     CPU_CHAR         *name_entry_next;
+    CPU_BOOLEAN       cache_hit;
 
 
     p_dir_start_pos->SecNbr = 0u;                               /* Assign dflts.                                        */
@@ -6154,13 +6761,39 @@ static  void  FS_FAT_DataSrch (FS_VOL          *p_vol,
         dir_start_pos.SecNbr = dir_first_sec;
         dir_start_pos.SecPos = 0u;
 
-        FS_FAT_FN_API_Active.DirEntryFind( p_vol,
-                                           p_buf,
-                                           name_entry,
-                                          &name_entry_next,
-                                          &dir_start_pos,
-                                          &dir_end_pos,
-                                           p_err);
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+        cache_hit = FS_FAT_DirCacheFind( p_vol,                 /* Chk dir cache (see Note #3).                         */
+                                         p_buf,
+                                         dir_first_sec,
+                                         name_entry,
+                                        &name_entry_next,
+                                        &dir_start_pos,
+                                        &dir_end_pos,
+                                         p_err);
+#else
+        cache_hit = DEF_NO;
+#endif
+
+        if (cache_hit == DEF_NO) {
+            FS_FAT_FN_API_Active.DirEntryFind( p_vol,
+                                               p_buf,
+                                               name_entry,
+                                              &name_entry_next,
+                                              &dir_start_pos,
+                                              &dir_end_pos,
+                                               p_err);
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+            FS_FAT_DirCacheAdd((FS_FAT_DATA *)p_vol->DataPtr,  /* Cache srch result.                                   */
+                                dir_first_sec,
+                                name_entry,
+                                name_entry_next,
+                               &dir_start_pos,
+                               &dir_end_pos,
+                               *p_err);
+#endif
+        }
+
         if (*p_err != FS_ERR_NAME_INVALID) {
             name_entry = name_entry_next;
         }
@@ -6247,6 +6880,313 @@ static  void  FS_FAT_DataSrch (FS_VOL          *p_vol,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        FS_FAT_DirCacheFind()
+*
+* Description : Find path component in directory lookup cache.
+*
+* Argument(s) : p_vol               Pointer to volume.
+*               ----------          Argument validated by caller.
+*
+*               p_buf               Pointer to temporary buffer.
+*               ----------          Argument validated by caller.
+*
+*               dir_first_sec       First sector of the directory in which the component is searched.
+*
+*               name_entry          Path component, terminated by a path separator or NULL character.
+*               ----------          Argument validated by caller.
+*
+*               p_name_entry_next   Pointer to variable that will receive a pointer to the character
+*                                   following the component, on a hit.
+*               ----------          Argument validated by caller.
+*
+*               p_dir_start_pos     Pointer to variable that will receive the directory position at which
+*                                   the first entry is located, on a positive hit.
+*               ----------          Argument validated by caller.
+*
+*               p_dir_end_pos       Pointer to variable that will receive the directory position at which
+*                                   the final entry is located, on a positive hit.
+*               ----------          Argument validated by caller.
+*
+*               p_err               Pointer to variable that will receive the return error code from this function,
+*                                   on a hit :
+*               ----------          Argument validated by caller.
+*
+*                                       FS_ERR_NONE                       Entry found.
+*                                       FS_ERR_SYS_DIR_ENTRY_NOT_FOUND    Entry known NOT to exist.
+*
+*                                                                         --- RETURNED BY FSBuf_Set() ---
+*                                       FS_ERR_DEV                        Device access error.
+*
+* Return(s)   : DEF_YES, if the component was found in the cache.
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : FS_FAT_DataSrch().
+*
+* Note(s)     : (1) On a positive hit, the sector holding the final directory entry is read into 'p_buf'
+*                   (see 'FS_FAT_DataSrch() Note #3').  Should that entry no longer be in use, the cache
+*                   entry is stale; it is discarded & the directory is scanned.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  FS_FAT_DirCacheFind (FS_VOL            *p_vol,
+                                          FS_BUF            *p_buf,
+                                          FS_FAT_SEC_NBR     dir_first_sec,
+                                          CPU_CHAR          *name_entry,
+                                          CPU_CHAR         **p_name_entry_next,
+                                          FS_FAT_DIR_POS    *p_dir_start_pos,
+                                          FS_FAT_DIR_POS    *p_dir_end_pos,
+                                          FS_ERR            *p_err)
+{
+    FS_FAT_DATA             *p_fat_data;
+    FS_FAT_DIR_CACHE_ENTRY  *p_cache_entry;
+    CPU_INT08U              *p_dir_entry;
+    CPU_INT08U               name_0;
+    CPU_INT32U               hash;
+    CPU_SIZE_T               name_len;
+    CPU_SIZE_T               ix;
+
+
+    p_fat_data = (FS_FAT_DATA *)p_vol->DataPtr;
+    name_len   =  FS_FAT_DirCacheNameLen(name_entry, &hash);
+    if (name_len == 0u) {                                       /* Component NOT cacheable.                             */
+        return (DEF_NO);
+    }
+
+                                                                /* ------------------ CHK CACHE ENTRY ----------------- */
+    p_cache_entry = &p_fat_data->DirCache[FS_FAT_DIR_CACHE_IX(dir_first_sec, hash)];
+    if ((p_cache_entry->DirFirstSec != dir_first_sec) ||
+        (p_cache_entry->NameHash    != hash)          ||
+        (p_cache_entry->NameLen     != name_len)) {
+        FS_CTR_STAT_INC(p_fat_data->StatDirCacheMissCtr);
+        return (DEF_NO);
+    }
+    for (ix = 0u; ix < name_len; ix++) {
+        if (ASCII_TO_UPPER(name_entry[ix]) != ASCII_TO_UPPER(p_cache_entry->Name[ix])) {
+            FS_CTR_STAT_INC(p_fat_data->StatDirCacheMissCtr);
+            return (DEF_NO);
+        }
+    }
+
+   *p_name_entry_next = name_entry + name_len;
+
+    if (p_cache_entry->Found == DEF_NO) {                       /* Name known NOT to exist.                             */
+        FS_CTR_STAT_INC(p_fat_data->StatDirCacheHitCtr);
+       *p_err = FS_ERR_SYS_DIR_ENTRY_NOT_FOUND;
+        return (DEF_YES);
+    }
+
+                                                                /* ------------------ RD DIR ENTRY SEC ---------------- */
+    FSBuf_Set(p_buf,                                            /* See Note #1.                                         */
+              p_cache_entry->DirEndPos.SecNbr,
+              FS_VOL_SEC_TYPE_DIR,
+              DEF_YES,
+              p_err);
+    if (*p_err != FS_ERR_NONE) {
+        return (DEF_YES);
+    }
+
+    p_dir_entry = (CPU_INT08U *)p_buf->DataPtr + p_cache_entry->DirEndPos.SecPos;
+    name_0      =  MEM_VAL_GET_INT08U((void *)p_dir_entry);
+    if ((name_0 == FS_FAT_DIRENT_NAME_FREE) ||                  /* Entry no longer in use.                              */
+        (name_0 == FS_FAT_DIRENT_NAME_ERASED_AND_FREE)) {
+        p_cache_entry->DirFirstSec = 0u;
+        FS_CTR_STAT_INC(p_fat_data->StatDirCacheMissCtr);
+        return (DEF_NO);
+    }
+
+    FS_CTR_STAT_INC(p_fat_data->StatDirCacheHitCtr);
+    p_dir_start_pos->SecNbr = p_cache_entry->DirStartPos.SecNbr;
+    p_dir_start_pos->SecPos = p_cache_entry->DirStartPos.SecPos;
+    p_dir_end_pos->SecNbr   = p_cache_entry->DirEndPos.SecNbr;
+    p_dir_end_pos->SecPos   = p_cache_entry->DirEndPos.SecPos;
+   *p_err = FS_ERR_NONE;
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        FS_FAT_DirCacheAdd()
+*
+* Description : Add result of directory search to directory lookup cache.
+*
+* Argument(s) : p_fat_data          Pointer to FAT info structure.
+*               ----------          Argument validated by caller.
+*
+*               dir_first_sec       First sector of the directory in which the component was searched.
+*
+*               name_entry          Path component, terminated by a path separator or NULL character.
+*               ----------          Argument validated by caller.
+*
+*               name_entry_next     Pointer to the character following the component, as returned by the
+*                                   directory search.
+*
+*               p_dir_start_pos     Pointer to the directory position at which the first entry is located.
+*               ----------          Argument validated by caller.
+*
+*               p_dir_end_pos       Pointer to the directory position at which the final entry is located.
+*               ----------          Argument validated by caller.
+*
+*               err_srch            Error code returned by the directory search.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_DataSrch().
+*
+* Note(s)     : (1) Only definite results are cached : the entry was found, or the whole directory was
+*                   scanned without finding it.  The component is NOT cached if the search consumed a
+*                   different number of characters than the component holds (e.g., trailing spaces or
+*                   periods trimmed from a LFN).
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+static  void  FS_FAT_DirCacheAdd (FS_FAT_DATA       *p_fat_data,
+                                  FS_FAT_SEC_NBR     dir_first_sec,
+                                  CPU_CHAR          *name_entry,
+                                  CPU_CHAR          *name_entry_next,
+                                  FS_FAT_DIR_POS    *p_dir_start_pos,
+                                  FS_FAT_DIR_POS    *p_dir_end_pos,
+                                  FS_ERR             err_srch)
+{
+    FS_FAT_DIR_CACHE_ENTRY  *p_cache_entry;
+    CPU_INT32U               hash;
+    CPU_SIZE_T               name_len;
+
+
+    if ((err_srch != FS_ERR_NONE) &&                            /* See Note #1.                                         */
+        (err_srch != FS_ERR_SYS_DIR_ENTRY_NOT_FOUND)) {
+        return;
+    }
+
+    name_len = FS_FAT_DirCacheNameLen(name_entry, &hash);
+    if (name_len == 0u) {                                       /* Component NOT cacheable.                             */
+        return;
+    }
+    if (name_entry_next != name_entry + name_len) {             /* See Note #1.                                         */
+        return;
+    }
+
+    p_cache_entry = &p_fat_data->DirCache[FS_FAT_DIR_CACHE_IX(dir_first_sec, hash)];
+    p_cache_entry->DirFirstSec = dir_first_sec;
+    p_cache_entry->NameHash    = hash;
+    p_cache_entry->NameLen     = (CPU_INT08U)name_len;
+    Mem_Copy((void     *)&p_cache_entry->Name[0],
+             (void     *) name_entry,
+             (CPU_SIZE_T) name_len);
+
+    if (err_srch == FS_ERR_NONE) {
+        p_cache_entry->Found              = DEF_YES;
+        p_cache_entry->DirStartPos.SecNbr = p_dir_start_pos->SecNbr;
+        p_cache_entry->DirStartPos.SecPos = p_dir_start_pos->SecPos;
+        p_cache_entry->DirEndPos.SecNbr   = p_dir_end_pos->SecNbr;
+        p_cache_entry->DirEndPos.SecPos   = p_dir_end_pos->SecPos;
+    } else {
+        p_cache_entry->Found              = DEF_NO;
+        p_cache_entry->DirStartPos.SecNbr = 0u;
+        p_cache_entry->DirStartPos.SecPos = 0u;
+        p_cache_entry->DirEndPos.SecNbr   = 0u;
+        p_cache_entry->DirEndPos.SecPos   = 0u;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      FS_FAT_DirCacheNameLen()
+*
+* Description : Get length & hash of path component.
+*
+* Argument(s) : name_entry  Path component, terminated by a path separator or NULL character.
+*               ----------  Argument validated by caller.
+*
+*               p_hash      Pointer to variable that will receive the case-insensitive hash of the component.
+*               ----------  Argument validated by caller.
+*
+* Return(s)   : Length of the component, in octets, if it may be cached.
+*               0,                                  otherwise.
+*
+* Caller(s)   : FS_FAT_DirCacheAdd(),
+*               FS_FAT_DirCacheFind().
+*
+* Note(s)     : (1) Names are compared ignoring the case of ASCII letters only.  Names differing in the
+*                   case of other characters are cached separately, which is never incorrect.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+static  CPU_SIZE_T  FS_FAT_DirCacheNameLen (CPU_CHAR    *name_entry,
+                                            CPU_INT32U  *p_hash)
+{
+    CPU_CHAR    name_char;
+    CPU_INT32U  hash;
+    CPU_SIZE_T  name_len;
+
+
+    hash      = 2166136261u;                                    /* FNV-1a hash (see Note #1).                           */
+    name_len  = 0u;
+    name_char = name_entry[0];
+    while ((name_char != (CPU_CHAR)ASCII_CHAR_NULL) &&
+           (name_char != FS_FAT_PATH_SEP_CHAR)) {
+        if (name_len >= FS_FAT_CFG_DIR_CACHE_NAME_LEN) {        /* Component too long to be cached.                     */
+            return (0u);
+        }
+        hash ^= (CPU_INT32U)(CPU_INT08U)ASCII_TO_UPPER(name_char);
+        hash *= 16777619u;
+        name_len++;
+        name_char = name_entry[name_len];
+    }
+
+   *p_hash = hash;
+    return (name_len);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     FS_FAT_DirCacheInvalidate()
+*
+* Description : Invalidate directory lookup cache entries of a directory.
+*
+* Argument(s) : p_fat_data      Pointer to FAT info structure.
+*               ----------      Argument validated by caller.
+*
+*               dir_first_sec   First sector of the directory.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_LowEntryCreate(),
+*               FS_FAT_LowEntryDel().
+*
+* Note(s)     : (1) Creating an entry may make a name cached as absent exist, possibly under a generated
+*                   SFN; deleting an entry frees its position.  Entries of other directories stay valid.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+#if (FS_CFG_RD_ONLY_EN       == DEF_DISABLED)
+static  void  FS_FAT_DirCacheInvalidate (FS_FAT_DATA     *p_fat_data,
+                                         FS_FAT_SEC_NBR   dir_first_sec)
+{
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < FS_FAT_CFG_DIR_CACHE_NBR; ix++) {
+        if (p_fat_data->DirCache[ix].DirFirstSec == dir_first_sec) {
+            p_fat_data->DirCache[ix].DirFirstSec = 0u;
+        }
+    }
+}
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        FS_FAT_FileDataClr()
@@ -6374,9 +7314,23 @@ static  void  FS_FAT_DataClr (FS_FAT_DATA  *p_fat_data)
     p_fat_data->QueryBadClusCnt    =  0u;
     p_fat_data->QueryFreeClusCnt   =  0u;
 
+#if (FS_FAT_CFG_CLUS_MAP_EN        == DEF_ENABLED)
+    p_fat_data->ClusMapValid       =  DEF_NO;
+    p_fat_data->ClusMapGrpLog2     =  0u;
+    p_fat_data->ClusMapRunMissLen  =  0u;
+#endif
+
+#if (FS_FAT_CFG_DIR_CACHE_EN       == DEF_ENABLED)
+    FS_FAT_DirCacheClr(p_fat_data);
+#endif
+
 #if (FS_CFG_CTR_STAT_EN            == DEF_ENABLED)
     p_fat_data->StatAllocClusCtr   =  0u;
     p_fat_data->StatFreeClusCtr    =  0u;
+#if (FS_FAT_CFG_DIR_CACHE_EN       == DEF_ENABLED)
+    p_fat_data->StatDirCacheHitCtr  =  0u;
+    p_fat_data->StatDirCacheMissCtr =  0u;
+#endif
 #endif
 }
 
@@ -356,6 +356,10 @@ struct  fs_fat_file_data {
     FS_FAT_DATE               DateAccess;                       /* File last access date.                               */
     FS_FAT_DATE               DateWr;                           /* File last wr  date.                                  */
     FS_FAT_TIME               TimeWr;                           /* File last wr  time.                                  */
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+    FS_FAT_FILE_EXTENT        ExtentTbl[FS_FAT_CFG_FILE_EXTENT_NBR];    /* Known clus runs, most recently used first.   */
+#endif
 };
 
 
@@ -397,14 +401,32 @@ struct  fs_fat_data {
     FS_FAT_CLUS_NBR           QueryBadClusCnt;                  /* Count of bad  clusters.                              */
     FS_FAT_CLUS_NBR           QueryFreeClusCnt;                 /* Count of free clusters.                              */
 
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    CPU_BOOLEAN               ClusMapValid;                     /* Whether 'ClusMap' valid.                             */
+    CPU_INT08U                ClusMapGrpLog2;                   /* Clus per map bit base-2 log.                         */
+    FS_FAT_CLUS_NBR           ClusMapRunMissLen;                /* Len of last free run NOT found (0 if none).          */
+    CPU_INT08U                ClusMap[FS_FAT_CFG_CLUS_MAP_SIZE];/* Map of clus grps that may contain a free clus.       */
+#endif
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+    FS_FAT_DIR_CACHE_ENTRY    DirCache[FS_FAT_CFG_DIR_CACHE_NBR];/* Dir lookup cache, indexed by name hash.            */
+#endif
+
 #ifdef  FS_FAT_JOURNAL_MODULE_PRESENT
     CPU_INT08U                JournalState;
     FS_FAT_FILE_DATA         *JournalDataPtr;
+#if (FS_FAT_CFG_JOURNAL_GROUP_EN == DEF_ENABLED)
+    CPU_INT16U                JournalGrpOpCnt;                  /* Nbr of ops logged since last commit.                 */
+#endif
 #endif
 
 #if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
     FS_CTR                    StatAllocClusCtr;                 /* Number of cluster allocations.                       */
     FS_CTR                    StatFreeClusCtr;                  /* Number of cluster frees.                             */
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+    FS_CTR                    StatDirCacheHitCtr;               /* Number of dir lookups served by dir cache.           */
+    FS_CTR                    StatDirCacheMissCtr;              /* Number of dir lookups requiring dir scan.            */
+#endif
 #endif
 };
 
@@ -869,6 +891,16 @@ FS_FAT_CLUS_NBR  FS_FAT_ClusFreeFind           (FS_VOL            *p_vol,
                                                 FS_ERR            *p_err);
 #endif
 
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+void             FS_FAT_ClusMapUpdate          (FS_FAT_DATA       *p_fat_data,  /* Update free cluster map.            */
+                                                FS_FAT_CLUS_NBR    clus,
+                                                CPU_BOOLEAN        is_free);
+#endif
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+void             FS_FAT_DirCacheClr            (FS_FAT_DATA       *p_fat_data); /* Clear dir lookup cache.             */
+#endif
+
 FS_FAT_CLUS_NBR  FS_FAT_ClusNextGet            (FS_VOL            *p_vol,       /* Get next cluster in chain.           */
                                                 FS_BUF            *p_buf,
                                                 FS_FAT_CLUS_NBR    start_clus,
@@ -293,7 +293,16 @@ static  void  FS_FAT_FAT12_ClusValWr (FS_VOL           *p_vol,
         MEM_VAL_SET_INT16U_LITTLE((void *)((CPU_INT08U *)p_buf->DataPtr + fat_sec_offset), val_temp);
 
         FSBuf_MarkDirty(p_buf, p_err);                          /* Wr FAT sec.                                          */
+        if (*p_err != FS_ERR_NONE) {
+            return;
+        }
     }
+
+#if (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+    FS_FAT_ClusMapUpdate(p_fat_data,                            /* Update free clus map.                                */
+                         clus,
+                        (val == FS_FAT_FAT12_CLUS_FREE) ? DEF_YES : DEF_NO);
+#endif
 }
 #endif
 
@@ -121,6 +121,26 @@ static  MEM_POOL  FS_FAT_FileDataPool;
 *********************************************************************************************************
 */
 
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+static  FS_FAT_CLUS_NBR  FS_FAT_FileClusGet (FS_FILE             *p_file,           /* Get clus at ix in file.      */
+                                             FS_BUF              *p_buf,
+                                             FS_FAT_CLUS_NBR      clus_ix,
+                                             FS_ERR              *p_err);
+
+static  void  FS_FAT_FileExtentAdd          (FS_FAT_FILE_DATA    *p_fat_file_data,  /* Add extent.                  */
+                                             FS_FAT_CLUS_NBR      file_clus_ix,
+                                             FS_FAT_CLUS_NBR      start_clus,
+                                             FS_FAT_CLUS_NBR      len);
+
+static  void  FS_FAT_FileExtentClr          (FS_FAT_FILE_DATA    *p_fat_file_data); /* Clr all extents.             */
+
+static  void  FS_FAT_FileExtentRemove       (FS_FAT_FILE_DATA    *p_fat_file_data,  /* Remove extent.               */
+                                             CPU_SIZE_T           extent_ix);
+
+static  void  FS_FAT_FileExtentTouch        (FS_FAT_FILE_DATA    *p_fat_file_data,  /* Mark extent most recent.     */
+                                             CPU_SIZE_T           extent_ix);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -373,6 +393,9 @@ void  FS_FAT_FileOpen (FS_FILE   *p_file,
 
 
                                                                 /* --------------------- OPEN FILE -------------------- */
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+    FS_FAT_FileExtentClr(p_file_data);
+#endif
     p_file->DataPtr = (void *)p_file_data;
     FS_FAT_LowEntryFind( p_file->VolPtr,
                          p_file_data,
@@ -455,6 +478,10 @@ void  FS_FAT_FileOpen (FS_FILE   *p_file,
 *               (4) Position can only be set in the existing portion of a file. If the position is set
 *                   after the file size, the code must call FS_FAT_FileWr() instead to correctly
 *                   allocate clusters and fill data region with '0'.
+*
+*               (5) If the file extent map is enabled, the cluster is found from the runs of contiguous
+*                   clusters already known for the file.  Setting the position near the end of a large
+*                   file thus does not follow the whole cluster chain again.
 *********************************************************************************************************
 */
 
@@ -535,6 +562,12 @@ void  FS_FAT_FilePosSet (FS_FILE       *p_file,
 
 
     } else {                                                    /* ----- POS BEFORE LAST CLUS, NOT FIRST, NOT CUR ----- */
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+        clus = FS_FAT_FileClusGet(p_file,                       /* Get clus from extents (see Note #5).                 */
+                                  p_buf,
+                                 (clus_cnt_new - 1u),
+                                  p_err);
+#else
                                                                 /* Move to last known clus.                             */
         clus = FS_FAT_ClusChainFollow(p_file->VolPtr,
                                       p_buf,
@@ -542,6 +575,7 @@ void  FS_FAT_FilePosSet (FS_FILE       *p_file,
                                      (clus_cnt_new - 1u),
                                       DEF_NULL,
                                       p_err);
+#endif
 
         if (*p_err != FS_ERR_NONE) {
              FSBuf_Free(p_buf);
@@ -1029,6 +1063,9 @@ void  FS_FAT_FileTruncate (FS_FILE       *p_file,
                             p_fat_file_data,
                             size,
                             p_err);
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+    FS_FAT_FileExtentClr(p_fat_file_data);                      /* Freed clus's may be in extents.                      */
+#endif
 
 
     if (*p_err != FS_ERR_NONE) {
@@ -1481,6 +1518,297 @@ CPU_SIZE_T  FS_FAT_FileWr (FS_FILE     *p_file,
 #endif
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        FS_FAT_FileClusGet()
+*
+* Description : Get cluster at index in file's cluster chain.
+*
+* Argument(s) : p_file      Pointer to a file.
+*               ------      Argument validated by caller.
+*
+*               p_buf       Pointer to temporary buffer.
+*               -----       Argument validated by caller.
+*
+*               clus_ix     Index of cluster within file (0 for the file's first cluster).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE                        Cluster found.
+*                               FS_ERR_SYS_CLUS_CHAIN_END_EARLY    Cluster chain ended before cluster.
+*                               FS_ERR_SYS_CLUS_INVALID            Invalid cluster found in cluster chain.
+*
+*                               ---------------RETURNED BY p_fat_data->FAT_TypeAPI_Ptr->ClusValRd()---------------
+*                               See p_fat_data->FAT_TypeAPI_Ptr->ClusValRd() for additional return error codes.
+*
+* Return(s)   : Cluster number, if cluster found.
+*               0,              otherwise.
+*
+* Caller(s)   : FS_FAT_FilePosSet().
+*
+* Note(s)     : (1) If an extent holds the cluster, no FAT entry is read.  Otherwise, the chain is followed
+*                   from the end of the extent preceding the cluster (or from the file's first cluster),
+*                   & the runs of contiguous clusters met on the way are remembered as extents.
+*
+*               (2) No extent begins between the end of the extent the chain is followed from & the
+*                   cluster, so runs found while following the chain never duplicate an extent.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+static  FS_FAT_CLUS_NBR  FS_FAT_FileClusGet (FS_FILE          *p_file,
+                                             FS_BUF           *p_buf,
+                                             FS_FAT_CLUS_NBR   clus_ix,
+                                             FS_ERR           *p_err)
+{
+    FS_FAT_DATA         *p_fat_data;
+    FS_FAT_FILE_DATA    *p_fat_file_data;
+    FS_FAT_FILE_EXTENT  *p_extent;
+    FS_FAT_CLUS_NBR      clus;
+    FS_FAT_CLUS_NBR      clus_next;
+    FS_FAT_CLUS_NBR      clus_ix_cur;
+    FS_FAT_CLUS_NBR      run_ix;
+    FS_FAT_CLUS_NBR      run_clus;
+    FS_FAT_CLUS_NBR      run_len;
+    FS_FAT_CLUS_NBR      extent_end_ix;
+    CPU_SIZE_T           extent_ix;
+    CPU_SIZE_T           extent_ix_best;
+
+
+    p_fat_file_data = (FS_FAT_FILE_DATA *)(p_file->DataPtr);
+    p_fat_data      = (FS_FAT_DATA      *)(p_file->VolPtr->DataPtr);
+
+    run_ix          =  0u;                                      /* Dflt start from first file clus.                     */
+    run_clus        =  p_fat_file_data->FileFirstClus;
+    run_len         =  1u;
+    extent_ix_best  =  FS_FAT_CFG_FILE_EXTENT_NBR;
+
+
+                                                                /* ------------------- SRCH EXTENTS ------------------- */
+    for (extent_ix = 0u; extent_ix < FS_FAT_CFG_FILE_EXTENT_NBR; extent_ix++) {
+        p_extent = &p_fat_file_data->ExtentTbl[extent_ix];
+        if (p_extent->Len == 0u) {                              /* Used extents precede unused ones.                    */
+            break;
+        }
+
+        if (clus_ix >= p_extent->FileClusIx) {
+            if ((clus_ix - p_extent->FileClusIx) < p_extent->Len) {     /* If clus in extent ...                        */
+                clus = p_extent->StartClus + (clus_ix - p_extent->FileClusIx);
+                FS_FAT_FileExtentTouch(p_fat_file_data, extent_ix);     /* ... mark extent most recently used.          */
+               *p_err = FS_ERR_NONE;
+                return (clus);
+            }
+                                                                /* Keep extent ending closest before clus.              */
+            extent_end_ix = p_extent->FileClusIx + p_extent->Len - 1u;
+            if ((extent_ix_best == FS_FAT_CFG_FILE_EXTENT_NBR) ||
+                (extent_end_ix  >  run_ix + run_len - 1u)) {
+                extent_ix_best = extent_ix;
+                run_ix         = p_extent->FileClusIx;
+                run_clus       = p_extent->StartClus;
+                run_len        = p_extent->Len;
+            }
+        }
+    }
+
+    if (extent_ix_best != FS_FAT_CFG_FILE_EXTENT_NBR) {         /* Extent will be re-added once extended.               */
+        FS_FAT_FileExtentRemove(p_fat_file_data, extent_ix_best);
+    }
+
+
+                                                                /* ------------------- FOLLOW CHAIN ------------------- */
+    clus_ix_cur = run_ix   + run_len - 1u;                      /* See Note #1.                                         */
+    clus        = run_clus + run_len - 1u;
+    while (clus_ix_cur < clus_ix) {
+        clus_next = p_fat_data->FAT_TypeAPI_Ptr->ClusValRd(p_file->VolPtr,
+                                                           p_buf,
+                                                           clus,
+                                                           p_err);
+        if (*p_err != FS_ERR_NONE) {
+            FS_FAT_FileExtentAdd(p_fat_file_data, run_ix, run_clus, run_len);
+            return (0u);
+        }
+
+        if (FS_FAT_IS_VALID_CLUS(p_fat_data, clus_next) == DEF_NO) {
+            FS_FAT_FileExtentAdd(p_fat_file_data, run_ix, run_clus, run_len);
+            if (clus_next >= p_fat_data->FAT_TypeAPI_Ptr->ClusEOF) {
+               *p_err = FS_ERR_SYS_CLUS_CHAIN_END_EARLY;
+            } else {
+               *p_err = FS_ERR_SYS_CLUS_INVALID;
+            }
+            return (0u);
+        }
+
+        clus_ix_cur++;
+        if (clus_next == clus + 1u) {                           /* If clus contiguous, extend run ...                   */
+            run_len++;
+        } else {                                                /* ... else save run & start new one (see Note #2).     */
+            FS_FAT_FileExtentAdd(p_fat_file_data, run_ix, run_clus, run_len);
+            run_ix   = clus_ix_cur;
+            run_clus = clus_next;
+            run_len  = 1u;
+        }
+        clus = clus_next;
+    }
+
+    FS_FAT_FileExtentAdd(p_fat_file_data, run_ix, run_clus, run_len);
+
+   *p_err = FS_ERR_NONE;
+    return (clus);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       FS_FAT_FileExtentAdd()
+*
+* Description : Add extent to file's extent table as most recently used extent.
+*
+* Argument(s) : p_fat_file_data     Pointer to FAT file data.
+*               ---------------     Argument validated by caller.
+*
+*               file_clus_ix        Index of extent's first cluster within file.
+*
+*               start_clus          Cluster number of extent's first cluster.
+*
+*               len                 Number of contiguous clusters in extent.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_FileClusGet().
+*
+* Note(s)     : (1) If the table is full, the least recently used extent is dropped.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+static  void  FS_FAT_FileExtentAdd (FS_FAT_FILE_DATA  *p_fat_file_data,
+                                    FS_FAT_CLUS_NBR    file_clus_ix,
+                                    FS_FAT_CLUS_NBR    start_clus,
+                                    FS_FAT_CLUS_NBR    len)
+{
+    CPU_SIZE_T  extent_ix;
+
+
+    for (extent_ix = FS_FAT_CFG_FILE_EXTENT_NBR - 1u; extent_ix > 0u; extent_ix--) {  /* See Note #1.               */
+        p_fat_file_data->ExtentTbl[extent_ix] = p_fat_file_data->ExtentTbl[extent_ix - 1u];
+    }
+
+    p_fat_file_data->ExtentTbl[0].FileClusIx = file_clus_ix;
+    p_fat_file_data->ExtentTbl[0].StartClus  = start_clus;
+    p_fat_file_data->ExtentTbl[0].Len        = len;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       FS_FAT_FileExtentClr()
+*
+* Description : Forget all extents of file.
+*
+* Argument(s) : p_fat_file_data     Pointer to FAT file data.
+*               ---------------     Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_FileOpen(),
+*               FS_FAT_FileTruncate().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+static  void  FS_FAT_FileExtentClr (FS_FAT_FILE_DATA  *p_fat_file_data)
+{
+    CPU_SIZE_T  extent_ix;
+
+
+    for (extent_ix = 0u; extent_ix < FS_FAT_CFG_FILE_EXTENT_NBR; extent_ix++) {
+        p_fat_file_data->ExtentTbl[extent_ix].FileClusIx = 0u;
+        p_fat_file_data->ExtentTbl[extent_ix].StartClus  = 0u;
+        p_fat_file_data->ExtentTbl[extent_ix].Len        = 0u;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      FS_FAT_FileExtentRemove()
+*
+* Description : Remove extent from file's extent table.
+*
+* Argument(s) : p_fat_file_data     Pointer to FAT file data.
+*               ---------------     Argument validated by caller.
+*
+*               extent_ix           Index of extent in table.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_FileClusGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+static  void  FS_FAT_FileExtentRemove (FS_FAT_FILE_DATA  *p_fat_file_data,
+                                       CPU_SIZE_T         extent_ix)
+{
+    for (; extent_ix < FS_FAT_CFG_FILE_EXTENT_NBR - 1u; extent_ix++) {
+        p_fat_file_data->ExtentTbl[extent_ix] = p_fat_file_data->ExtentTbl[extent_ix + 1u];
+    }
+
+    p_fat_file_data->ExtentTbl[FS_FAT_CFG_FILE_EXTENT_NBR - 1u].Len = 0u;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       FS_FAT_FileExtentTouch()
+*
+* Description : Make extent the most recently used extent of file.
+*
+* Argument(s) : p_fat_file_data     Pointer to FAT file data.
+*               ---------------     Argument validated by caller.
+*
+*               extent_ix           Index of extent in table.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_FileClusGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+static  void  FS_FAT_FileExtentTouch (FS_FAT_FILE_DATA  *p_fat_file_data,
+                                      CPU_SIZE_T         extent_ix)
+{
+    FS_FAT_FILE_EXTENT  extent;
+
+
+    extent = p_fat_file_data->ExtentTbl[extent_ix];
+    for (; extent_ix > 0u; extent_ix--) {
+        p_fat_file_data->ExtentTbl[extent_ix] = p_fat_file_data->ExtentTbl[extent_ix - 1u];
+    }
+    p_fat_file_data->ExtentTbl[0] = extent;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -231,6 +231,9 @@ static  MEM_POOL  FS_FAT_JournalFileDataPool;
 */
 
                                                                                 /* -------- JOURNAL FILE FNCTS -------- */
+static  void         FS_FAT_JournalCommitHandler       (FS_VOL      *p_vol,     /* Commit logged ops.                   */
+                                                        FS_ERR      *p_err);
+
 static  void         FS_FAT_JournalFileCreate          (FS_VOL      *p_vol,     /* Create journal file.                 */
                                                         FS_ERR      *p_err);
 
@@ -267,11 +270,10 @@ static  void         FS_FAT_JournalWr                  (FS_VOL      *p_vol,
                                                         CPU_SIZE_T   len,
                                                         FS_ERR      *p_err);
 
-static  CPU_SIZE_T   FS_FAT_JournalReverseScan         (FS_VOL      *p_vol,     /* Reverse scan journal.                */
+static  CPU_SIZE_T   FS_FAT_JournalLogParse            (FS_VOL      *p_vol,     /* Parse log & find its end.            */
                                                         FS_BUF      *p_buf,
-                                                        CPU_SIZE_T   start_pos,
-                                                        CPU_INT08U  *p_pattern,
-                                                        CPU_SIZE_T   pattern_size,
+                                                        CPU_SIZE_T   pos,
+                                                        CPU_INT16U  *p_sig,
                                                         FS_ERR      *p_err);
 
                                                                                 /* ------- JOURNAL REPLAY FNCTS ------- */
@@ -292,6 +294,7 @@ static  void         FS_FAT_JournalRevertEntryCreate   (FS_VOL      *p_vol,
 
 static  void         FS_FAT_JournalRevertEntryUpdate   (FS_VOL      *p_vol,     /* Revert dir entry update/del.         */
                                                         FS_BUF      *p_buf,
+                                                        CPU_SIZE_T   end_mark_pos,
                                                         FS_ERR      *p_err);
 
 
@@ -467,6 +470,9 @@ void  FS_FAT_JournalOpen (CPU_CHAR  *name_vol,
     }
     DEF_BIT_CLR(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_START |
                                           FS_FAT_JOURNAL_STATE_REPLAY);
+#if (FS_FAT_CFG_JOURNAL_GROUP_EN == DEF_ENABLED)
+    p_fat_data->JournalGrpOpCnt = 0u;
+#endif
     FSVol_ReleaseUnlock(p_vol);
 }
 
@@ -641,6 +647,9 @@ void  FS_FAT_JournalStart (CPU_CHAR  *name_vol,
 * Note(s)     : (1) Journaling should never be stopped unless volume is going to be closed. If FAT
 *                   operations are performed after journal is stopped and failure occurs, file system could
 *                   be left in an inconsistent state after volume remounting.
+*
+*               (2) Operations logged since the last commit are committed before journaling stops (see
+*                   'FS_FAT_JournalCommit()  Note #1').
 *********************************************************************************************************
 */
 
@@ -680,8 +689,87 @@ void  FS_FAT_JournalStop (CPU_CHAR  *name_vol,
        *p_err = FS_ERR_VOL_JOURNAL_NOT_STARTED;
 
     } else {
-        DEF_BIT_CLR(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_START);
-       *p_err = FS_ERR_NONE;
+        FS_FAT_JournalCommitHandler(p_vol, p_err);              /* See Note #2.                                         */
+        if (*p_err == FS_ERR_NONE) {
+            DEF_BIT_CLR(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_START);
+        }
+    }
+
+
+                                                                /* ----------------- RELEASE VOL LOCK ----------------- */
+    FSVol_ReleaseUnlock(p_vol);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FS_FAT_JournalCommit()
+*
+* Description : Commit FAT operations logged in the journal for the specified volume.
+*
+* Argument(s) : name_vol    Volume name.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               FS_ERR_NONE                    Journal committed.
+*                               FS_ERR_NAME_NULL               Argument 'name_vol' passed a NULL pointer.
+*                               FS_ERR_VOL_NOT_OPEN            Volume not open.
+*                               FS_ERR_VOL_JOURNAL_NOT_OPEN    Journal not open.
+*                               FS_ERR_BUF_NONE_AVAIL          No buffer available.
+*                               FS_ERR_DEV                     Device access error.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a file system suite application interface (API) function & MAY be called
+*               by application function(s).
+*
+* Note(s)     : (1) With group commit enabled (see 'fs_cfg.h  FAT LAYER CONFIGURATION  Note #9'), the journal
+*                   is cleared only once enough operations have been logged.  Operations performed since
+*                   the last commit are reverted when the journal is replayed.  An application that must
+*                   bound that window (e.g., in time) should call this function periodically, & should
+*                   call it before closing the volume.
+*
+*               (2) Without group commit, the journal is already clear between operations; this function
+*                   then does nothing but validate the volume.
+*********************************************************************************************************
+*/
+
+void  FS_FAT_JournalCommit (CPU_CHAR  *name_vol,
+                            FS_ERR    *p_err)
+{
+    FS_FAT_DATA  *p_fat_data;
+    FS_VOL       *p_vol;
+
+
+#if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)                  /* ------------------- VALIDATE PTR ------------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+    if (name_vol == DEF_NULL) {                                 /* Validate vol name ptr.                               */
+       *p_err = FS_ERR_NAME_NULL;
+        return;
+    }
+#endif
+
+
+                                                                /* ----------------- ACQUIRE VOL LOCK ----------------- */
+    p_vol = FSVol_AcquireLockChk(name_vol, DEF_YES, p_err);     /* Vol may NOT be unmounted.                            */
+    (void)&p_err;                                               /* Err ignored. Ret val chk'd instead.                  */
+    if (p_vol == DEF_NULL) {
+        return;
+    }
+
+
+                                                                /* ------------------- COMMIT JOURNAL ----------------- */
+    p_fat_data = (FS_FAT_DATA *)p_vol->DataPtr;
+
+    if (DEF_BIT_IS_SET(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_OPEN) == DEF_NO) {
+       *p_err = FS_ERR_VOL_JOURNAL_NOT_OPEN;
+
+    } else {
+        FS_FAT_JournalCommitHandler(p_vol, p_err);
     }
 
 
@@ -789,6 +877,9 @@ void  FS_FAT_JournalInit (FS_VOL  *p_vol,
                                           FS_FAT_JOURNAL_STATE_START |
                                           FS_FAT_JOURNAL_STATE_REPLAY);
     p_fat_data->JournalDataPtr = DEF_NULL;
+#if (FS_FAT_CFG_JOURNAL_GROUP_EN == DEF_ENABLED)
+    p_fat_data->JournalGrpOpCnt = 0u;
+#endif
 
 
                                                                 /* -------------- ALLOC JOURNAL FILE DATA ------------- */
@@ -1078,6 +1169,12 @@ void  FS_FAT_JournalClrAllReset (FS_VOL  *p_vol,
 *                   mark. If this mark is not present, journal will not be replayed (see
 *                   FS_FAT_JournalReplay() notes).
 *
+*               (2) With group commit enabled, the clear is deferred until the logs of the completed
+*                   operations fill FS_FAT_CFG_JOURNAL_GROUP_SIZE octets or FS_FAT_CFG_JOURNAL_GROUP_OP_CNT
+*                   operations have been logged.  Each operation then costs the journal sector write(s)
+*                   holding its logs, but no clear.  The size limit leaves at least half the journal free
+*                   for the logs of the next operation.
+*
 *********************************************************************************************************
 */
 
@@ -1092,6 +1189,19 @@ void  FS_FAT_JournalClrReset(FS_VOL  *p_vol,
     p_fat_data     = (FS_FAT_DATA *)p_vol->DataPtr;
     p_journal_data =  p_fat_data->JournalDataPtr;
 
+#if (FS_FAT_CFG_JOURNAL_GROUP_EN == DEF_ENABLED)
+    if ((DEF_BIT_IS_SET(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_START) == DEF_YES) &&
+        (p_journal_data->FilePos != 0u)) {                      /* If op was logged ...                                 */
+        p_fat_data->JournalGrpOpCnt++;
+        if ((p_journal_data->FilePos    < FS_FAT_CFG_JOURNAL_GROUP_SIZE) &&
+            (p_fat_data->JournalGrpOpCnt < FS_FAT_CFG_JOURNAL_GROUP_OP_CNT)) {
+           *p_err = FS_ERR_NONE;                                /* ... & grp not full, defer clr (see Note #2).         */
+            return;
+        }
+    }
+    p_fat_data->JournalGrpOpCnt = 0u;
+#endif
+
                                                                 /* Clr journal up to current position (See Note #1).    */
     FS_FAT_JournalClr(p_vol,
                       p_buf,
@@ -1684,6 +1794,83 @@ void  FS_FAT_JournalEnterEntryUpdate (FS_VOL          *p_vol,
 */
 
 
+/*
+*********************************************************************************************************
+*                                    FS_FAT_JournalCommitHandler()
+*
+* Description : Clear journal up to current position, committing all logged operations.
+*
+* Argument(s) : p_vol   Pointer to volume.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           FS_ERR_NONE              Journal committed.
+*                           FS_ERR_BUF_NONE_AVAIL    No buffer available.
+*
+*                           ----------------RETURNED BY FS_FAT_JournalClr()--------------
+*                           See FS_FAT_JournalClr() for additional return error codes.
+*
+*                           --------------RETURNED BY FS_FAT_JournalPosSet()-------------
+*                           See FS_FAT_JournalPosSet() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FS_FAT_JournalCommit(),
+*               FS_FAT_JournalStop().
+*
+* Note(s)     : (1) Unlike FS_FAT_JournalClrReset(), the clear is never deferred.
+*********************************************************************************************************
+*/
+
+static  void  FS_FAT_JournalCommitHandler (FS_VOL  *p_vol,
+                                           FS_ERR  *p_err)
+{
+    FS_FAT_DATA       *p_fat_data;
+    FS_FAT_FILE_DATA  *p_journal_data;
+    FS_BUF            *p_buf;
+
+
+    p_fat_data     = (FS_FAT_DATA *)p_vol->DataPtr;
+    p_journal_data =  p_fat_data->JournalDataPtr;
+
+#if (FS_FAT_CFG_JOURNAL_GROUP_EN == DEF_ENABLED)
+    p_fat_data->JournalGrpOpCnt = 0u;
+#endif
+    if (p_journal_data->FilePos == 0u) {                        /* If journal is clr ...                                */
+       *p_err = FS_ERR_NONE;                                    /* ... nothing to commit.                               */
+        return;
+    }
+
+    p_buf = FSBuf_Get(p_vol);                                   /* Get buf.                                             */
+    if (p_buf == DEF_NULL) {
+       *p_err = FS_ERR_BUF_NONE_AVAIL;
+        return;
+    }
+
+    FS_FAT_JournalClr(p_vol,                                    /* Clr journal up to cur pos.                           */
+                      p_buf,
+                      0u,
+                      p_journal_data->FilePos,
+                      p_err);
+    if (*p_err != FS_ERR_NONE) {
+        FSBuf_Free(p_buf);
+        return;
+    }
+
+    FS_FAT_JournalPosSet(p_vol,                                 /* Reset cur pos.                                       */
+                         p_buf,
+                         0u,
+                         p_err);
+    if (*p_err != FS_ERR_NONE) {
+        FSBuf_Free(p_buf);
+        return;
+    }
+
+    FSBuf_Flush(p_buf, p_err);
+    FSBuf_Free(p_buf);
+}
+
+
 /*
 *********************************************************************************************************
 *                                     FS_FAT_JournalFileCreate()
@@ -1881,9 +2068,9 @@ static  void  FS_FAT_JournalFileCreate (FS_VOL  *p_vol,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FS_FAT_JournalReplay(),
-*               FS_FAT_JournalReplayClusChainDel(),
-*               FS_FAT_JournalReverseScan().
+* Caller(s)   : FS_FAT_JournalLogParse(),
+*               FS_FAT_JournalReplay(),
+*               FS_FAT_JournalReplayClusChainDel().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -2049,7 +2236,9 @@ static  void  FS_FAT_JournalPosSet (FS_VOL      *p_vol,
 *               FS_FAT_JournalRevertEntryCreate(),
 *               FS_FAT_JournalRevertEntryUpdate().
 *
-* Note(s)     : none.
+* Note(s)     : (1) A read that ends on a sector boundary moves the current sector to the next one, so
+*                   that the current sector always holds the current position (see FS_FAT_JournalPosSet()).
+*                   The journal file end is not followed by a sector.
 *********************************************************************************************************
 */
 
@@ -2062,6 +2251,7 @@ static  void  FS_FAT_JournalRd (FS_VOL      *p_vol,
     FS_FAT_DATA       *p_fat_data;
     FS_FAT_FILE_DATA  *p_journal_data;
     FS_FAT_FILE_SIZE   file_pos_end;
+    CPU_INT08U        *p_log_08;
     CPU_SIZE_T         rd_size;
     CPU_SIZE_T         rem_size;
     FS_SEC_SIZE        cur_sec_pos;
@@ -2080,6 +2270,7 @@ static  void  FS_FAT_JournalRd (FS_VOL      *p_vol,
     }
 
 
+    p_log_08    = (CPU_INT08U *)p_log;
     rem_size    = len;
     cur_sec     = p_journal_data->FileCurSec;
     cur_sec_pos = p_journal_data->FileCurSecPos;
@@ -2097,17 +2288,20 @@ static  void  FS_FAT_JournalRd (FS_VOL      *p_vol,
         }
 
                                                                 /* ----------------- COPY TO DEST BUF ----------------- */
-        Mem_Copy((void *)  p_log,
+        Mem_Copy((void *)  p_log_08,
                  (void *)((CPU_INT08U *)p_buf->DataPtr + cur_sec_pos),
                            rd_size);
 
                                                                 /* ----------- UPDATE SEC POS AND REM SIZE ------------ */
         cur_sec_pos = (cur_sec_pos + rd_size) & (p_fat_data->SecSize - 1u);
         rem_size -= rd_size;
+        p_log_08 += rd_size;
 
 
                                                                 /* ------------------- GET NEXT SEC ------------------- */
-        if ((cur_sec_pos == 0u) && (rem_size != 0u)) {          /* If we crossed sec boundary amd data rem ...          */
+        if ((cur_sec_pos == 0u) &&                              /* If we crossed sec boundary ...                       */
+           ((rem_size     != 0u) ||                             /* ... & data rem or file end not reached ...           */
+            (file_pos_end != FS_FAT_JOURNAL_FILE_LEN))) {       /* ... (see Note #1)                      ...           */
             cur_sec = FS_FAT_SecNextGet(p_vol,                  /* ... find next sec.                                   */
                                         p_buf,
                                         cur_sec,
@@ -2225,7 +2419,8 @@ static  CPU_INT32U  FS_FAT_JournalRd_INT32U (FS_VOL  *p_vol,
 *               FS_FAT_JournalEnterEntryCreate(),
 *               FS_FAT_JournalEnterEntryUpdate().
 *
-* Note(s)     : none.
+* Note(s)     : (1) See FS_FAT_JournalRd() Note #1.  Otherwise, the log following one that ends on a sector
+*                   boundary would be written over the start of that sector.
 *********************************************************************************************************
 */
 
@@ -2238,6 +2433,7 @@ static  void  FS_FAT_JournalWr (FS_VOL      *p_vol,
     FS_FAT_DATA       *p_fat_data;
     FS_FAT_FILE_DATA  *p_journal_data;
     FS_FAT_FILE_SIZE   file_pos_end;
+    CPU_INT08U        *p_log_08;
     CPU_SIZE_T         wr_size;
     CPU_SIZE_T         rem_size;
     FS_SEC_SIZE        cur_sec_pos;
@@ -2255,6 +2451,7 @@ static  void  FS_FAT_JournalWr (FS_VOL      *p_vol,
     }
 
 
+    p_log_08    = (CPU_INT08U *)p_log;
     rem_size    = len;
     cur_sec     = p_journal_data->FileCurSec;
     cur_sec_pos = p_journal_data->FileCurSecPos;
@@ -2274,11 +2471,12 @@ static  void  FS_FAT_JournalWr (FS_VOL      *p_vol,
                                                                 /* ----------------- WR LOG TO JOURNAL ---------------- */
                                                                 /* Copy log into buf.                                   */
         Mem_Copy((CPU_INT08U *)p_buf->DataPtr + cur_sec_pos,
-                 (void *)p_log,
+                 (void *)p_log_08,
                   wr_size);
                                                                 /* Udpate cur sec pos & rem size.                       */
         cur_sec_pos = (cur_sec_pos + wr_size) & (p_fat_data->SecSize - 1u);
         rem_size -= wr_size;
+        p_log_08 += wr_size;
 
         FSBuf_MarkDirty(p_buf, p_err);                          /* Mark buf as dirty.                                   */
         if (*p_err != FS_ERR_NONE) {
@@ -2286,7 +2484,9 @@ static  void  FS_FAT_JournalWr (FS_VOL      *p_vol,
         }
 
                                                                 /* ------------------- GET NEXT SEC ------------------- */
-        if ((cur_sec_pos == 0u) && (rem_size > 0)) {            /* If we crossed sec boundary and data rem ...          */
+        if ((cur_sec_pos == 0u) &&                              /* If we crossed sec boundary ...                       */
+           ((rem_size     >  0u) ||                             /* ... & data rem or file end not reached ...           */
+            (file_pos_end != FS_FAT_JOURNAL_FILE_LEN))) {       /* ... (see Note #1)                      ...           */
             cur_sec = FS_FAT_SecNextGet(p_vol,                  /* ... get next sec.                                    */
                                         p_buf,
                                         cur_sec,
@@ -2308,98 +2508,190 @@ static  void  FS_FAT_JournalWr (FS_VOL      *p_vol,
 
 /*
 *********************************************************************************************************
-*                                       FS_FAT_JournalReverseScan()
+*                                      FS_FAT_JournalLogParse()
 *
-* Description : Scan journal backward, looking for given pattern.
+* Description : Parse journal log header & find log end.
 *
-* Argument(s) : p_vol           Pointer to volume.
-*
-*               p_buf           Pointer to temporary buffer.
+* Argument(s) : p_vol   Pointer to volume.
 *
-*               start_pos       Position to start scan at.
+*               p_buf   Pointer to temporary buffer.
 *
-*               pattern         Pattern to look for.
+*               pos     Position of log enter mark.
 *
-*               pattern_size    Pattern size in octets.
+*               p_sig   Pointer to variable that will receive the log signature.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*                                   FS_ERR_NONE                          Pattern found.
-*                                   FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE    Pattern not found.
+*                           FS_ERR_NONE                          Complete log found.
+*                           FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE    No complete log at position.
 *
-*                                   -------------RETURNED BY FS_FAT_JournalPeek()--------------
-*                                   See FS_FAT_JournalPeek() for additional return error codes.
+*                           -------------RETURNED BY FS_FAT_JournalPeek()--------------
+*                           See FS_FAT_JournalPeek() for additional return error codes.
 *
-* Return(s)   : Start position of first pattern occurence if match occurs. Zero if no match.
+* Return(s)   : Position following log enter end mark, if complete log found. Zero otherwise.
 *
 * Caller(s)   : FS_FAT_JournalReplay().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The log length is computed from the log's own arguments only, so that a log never
+*                   extends past the low level operation that wrote it, whatever the data that follows.
+*                   The enter end mark must be found where that length places it.  The journal contents
+*                   only are read; no FAT or directory sector is.
+*
+*               (2) A directory entry update log holds every entry from the start to the end position,
+*                   following the directory sectors (see FS_FAT_JournalEnterEntryUpdate()).  If both
+*                   positions lie in the same sector, the entry count is known.  Otherwise, the number of
+*                   whole sectors between them is not, and each count is tried in turn, the smallest first.
+*                   The entry that would hold a larger count's first octets follows an enter end mark only
+*                   if its first octet is 0xDD, which is neither a valid LFN ordinal nor produced for a
+*                   short name by this file system.
+*
+*               (3) A log that is only partially written (power lost while it was entered) is reported as
+*                   incomplete.  Its operation was never started, since logs are entered before the
+*                   operation is performed.
+*
+*               (4) The directory entry update header, the longest header parsed here, is read whatever
+*                   the log; the octets following a shorter log are ignored.  Near the journal end, only
+*                   the octets left are read.
 *********************************************************************************************************
 */
 
-static  CPU_SIZE_T  FS_FAT_JournalReverseScan (FS_VOL      *p_vol,
-                                               FS_BUF      *p_buf,
-                                               CPU_SIZE_T   start_pos,
-                                               CPU_INT08U  *p_pattern,
-                                               CPU_SIZE_T   pattern_size,
-                                               FS_ERR      *p_err)
+static  CPU_SIZE_T  FS_FAT_JournalLogParse (FS_VOL      *p_vol,
+                                            FS_BUF      *p_buf,
+                                            CPU_SIZE_T   pos,
+                                            CPU_INT16U  *p_sig,
+                                            FS_ERR      *p_err)
 {
-    CPU_INT08U   octet_val;
-    CPU_INT08U  *p_pattern_pos;
-    CPU_INT08U  *p_pattern_start;
-    CPU_INT08U  *p_pattern_end;
-    CPU_SIZE_T   cur_pos;
+    FS_FAT_DATA     *p_fat_data;
+    FS_FAT_DIR_POS   dir_start_pos;
+    FS_FAT_DIR_POS   dir_end_pos;
+    CPU_INT32U       nbr_marker;
+    CPU_INT08U       marker_size;
+    CPU_SIZE_T       entry_cnt;
+    CPU_SIZE_T       entry_step;
+    CPU_SIZE_T       end_mark_pos;
+    CPU_SIZE_T       hdr_len;
+    CPU_INT16U       mark;
+    CPU_INT16U       sig;
+    CPU_BOOLEAN      end_mark_found;
+    CPU_INT08U       log[FS_FAT_JOURNAL_LOG_ENTRY_DEL_HEADER_SIZE];
 
 
-                                                                /* ----------------- SET PARTTERN POS ----------------- */
-    p_pattern_start = (CPU_INT08U *)p_pattern;
-    p_pattern_end   = p_pattern_start + pattern_size - 1u;
-    p_pattern_pos   = p_pattern_end;
+    p_fat_data = (FS_FAT_DATA *)p_vol->DataPtr;
 
+                                                                /* ------------------- RD MARK & SIG ------------------ */
+    if (pos > FS_FAT_JOURNAL_FILE_LEN - (FS_FAT_JOURNAL_LOG_MARK_SIZE + FS_FAT_JOURNAL_LOG_SIG_SIZE)) {
+       *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;              /* No room left for a log.                              */
+        return (0u);
+    }
+                                                                /* Rd longest log header (see Note #4).                 */
+    hdr_len = DEF_MIN(FS_FAT_JOURNAL_LOG_ENTRY_DEL_HEADER_SIZE, FS_FAT_JOURNAL_FILE_LEN - pos);
+    FS_FAT_JournalPeek(p_vol,
+                       p_buf,
+                      &log[0],
+                       pos,
+                       hdr_len,
+                       p_err);
+    if (*p_err != FS_ERR_NONE) {
+        return (0u);
+    }
 
-#if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)
-    if (start_pos > FS_FAT_JOURNAL_FILE_LEN - 1u) {
-        *p_err = FS_ERR_INVALID_ARG;
-         return (0u);
+    mark = MEM_VAL_GET_INT16U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_ENTER_MARK_OFFSET]);
+    sig  = MEM_VAL_GET_INT16U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_SIG_OFFSET]);
+    if (mark != FS_FAT_JOURNAL_MARK_ENTER) {
+       *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+        return (0u);
     }
-#endif
 
-    cur_pos = start_pos + 1u;
-    while (cur_pos != 0u) {
-                                                                /* ---------------- PEEK AT NEXT OCTET ---------------- */
-        cur_pos--;
-        FS_FAT_JournalPosSet(p_vol,                             /* Set pos.                                             */
-                             p_buf,
-                             cur_pos,
-                             p_err);
-        if (*p_err != FS_ERR_NONE) {
-            return (0u);
-        }
+                                                                /* --------- COMPUTE LOG LEN (see Note #1) ------------ */
+    entry_step = 0u;
+    switch (sig) {
+        case FS_FAT_JOURNAL_SIG_CLUS_CHAIN_ALLOC:
+             end_mark_pos = pos + FS_FAT_JOURNAL_LOG_CLUS_CHAIN_ALLOC_SIZE - FS_FAT_JOURNAL_LOG_MARK_SIZE;
+             break;
 
-        FS_FAT_JournalRd(p_vol,                                 /* Rd journal.                                          */
-                         p_buf,
-                         &octet_val,
-                         1u,
-                         p_err);
+        case FS_FAT_JOURNAL_SIG_ENTRY_CREATE:
+             end_mark_pos = pos + FS_FAT_JOURNAL_LOG_ENTRY_CREATE_SIZE - FS_FAT_JOURNAL_LOG_MARK_SIZE;
+             break;
+
+        case FS_FAT_JOURNAL_SIG_CLUS_CHAIN_DEL:
+             if (hdr_len < FS_FAT_JOURNAL_LOG_CLUS_CHAIN_DEL_HEADER_SIZE) {
+                *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+                 return (0u);
+             }
+             nbr_marker  = MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_CLUS_CHAIN_DEL_LOG_NBR_MARKER_OFFSET]);
+             marker_size = (p_fat_data->FAT_Type == FS_FAT_FAT_TYPE_FAT32) ? 4u : 2u;
+             if (nbr_marker > FS_FAT_JOURNAL_FILE_LEN / marker_size) {
+                *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+                 return (0u);
+             }
+             end_mark_pos = pos + FS_FAT_JOURNAL_LOG_CLUS_CHAIN_DEL_HEADER_SIZE + ((CPU_SIZE_T)nbr_marker * marker_size);
+             break;
+
+        case FS_FAT_JOURNAL_SIG_ENTRY_UPDATE:                   /* See Note #2.                                         */
+             if (hdr_len < FS_FAT_JOURNAL_LOG_ENTRY_DEL_HEADER_SIZE) {
+                *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+                 return (0u);
+             }
+             dir_start_pos.SecNbr = (FS_FAT_SEC_NBR)MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_START_SEC_NBR_OFFSET]);
+             dir_start_pos.SecPos = (FS_SEC_SIZE   )MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_START_SEC_POS_OFFSET]);
+             dir_end_pos.SecNbr   = (FS_FAT_SEC_NBR)MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_END_SEC_NBR_OFFSET]);
+             dir_end_pos.SecPos   = (FS_SEC_SIZE   )MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_END_SEC_POS_OFFSET]);
+             if ((dir_start_pos.SecPos >= p_fat_data->SecSize)                 ||
+                 (dir_end_pos.SecPos   >= p_fat_data->SecSize)                 ||
+                 ((dir_start_pos.SecPos % FS_FAT_SIZE_DIR_ENTRY) != 0u)         ||
+                 ((dir_end_pos.SecPos   % FS_FAT_SIZE_DIR_ENTRY) != 0u)) {
+                *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+                 return (0u);
+             }
+
+             if ((dir_start_pos.SecNbr == dir_end_pos.SecNbr) &&
+                 (dir_start_pos.SecPos <= dir_end_pos.SecPos)) {
+                 entry_cnt  = ((dir_end_pos.SecPos - dir_start_pos.SecPos) / FS_FAT_SIZE_DIR_ENTRY) + 1u;
+             } else {
+                 entry_cnt  = ((p_fat_data->SecSize - dir_start_pos.SecPos + dir_end_pos.SecPos) / FS_FAT_SIZE_DIR_ENTRY) + 1u;
+                 entry_step =   p_fat_data->SecSize / FS_FAT_SIZE_DIR_ENTRY;
+             }
+             end_mark_pos = pos + FS_FAT_JOURNAL_LOG_ENTRY_DEL_HEADER_SIZE + (entry_cnt * FS_FAT_SIZE_DIR_ENTRY);
+             break;
+
+        default:
+             FS_TRACE_LOG(("FS_FAT_JournalLogParse(): Unknown journal sig: 0x%04X\r\n", sig));
+            *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+             return (0u);
+    }
+
+                                                                /* ------------------ FIND END MARK ------------------- */
+    end_mark_found = DEF_NO;
+    while ((end_mark_found == DEF_NO) &&
+           (end_mark_pos   <= FS_FAT_JOURNAL_FILE_LEN - FS_FAT_JOURNAL_LOG_MARK_SIZE)) {
+        FS_FAT_JournalPeek(p_vol,
+                           p_buf,
+                          &log[0],
+                           end_mark_pos,
+                           FS_FAT_JOURNAL_LOG_MARK_SIZE,
+                           p_err);
         if (*p_err != FS_ERR_NONE) {
             return (0u);
         }
 
-                                                                /* ------------------- CHK IF MATCH ------------------- */
-        if (octet_val == *p_pattern_pos) {                      /* If octet match occurs ...                            */
-            if (p_pattern_pos == p_pattern_start) {             /* ... if pattern match occurs ...                      */
-                return cur_pos;                                 /* ... rtn cur pos OR ...                               */
-            }                                                   /* ... if no pattern match occurs ...                   */
-            p_pattern_pos--;                                    /* ... look for next octet.                             */
-        } else {                                                /* If no octet match occurs ...                         */
-            p_pattern_pos = p_pattern_end;                      /* ... reset cur pattern pos.                           */
+        mark = MEM_VAL_GET_INT16U_LITTLE((void *)&log[0]);
+        if (mark == FS_FAT_JOURNAL_MARK_ENTER_END) {
+            end_mark_found = DEF_YES;
+        } else if (entry_step == 0u) {                          /* If log len is known ...                              */
+            break;                                              /* ... log is incomplete (see Note #3).                 */
+        } else {                                                /* Else try next entry cnt (see Note #2).               */
+            end_mark_pos += entry_step * FS_FAT_SIZE_DIR_ENTRY;
         }
     }
 
-                                                                /* --------------------- NO MATCH --------------------- */
-   *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
-    return (0u);
+    if (end_mark_found == DEF_NO) {
+       *p_err = FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE;
+        return (0u);
+    }
+
+   *p_sig = sig;
+   *p_err = FS_ERR_NONE;
+    return (end_mark_pos + FS_FAT_JOURNAL_LOG_MARK_SIZE);
 }
 
 
@@ -2443,8 +2735,8 @@ static  CPU_SIZE_T  FS_FAT_JournalReverseScan (FS_VOL      *p_vol,
 *                           --------------RETURNED BY FS_FAT_JournalReplayClusChainDel()--------------
 *                           See FS_FAT_JournalReplayClusChainDel() for additional return error codes.
 *
-*                           -----------------RETURNED BY FS_FAT_JournalReverseScan()------------------
-*                           See FS_FAT_JournalReverseScan() for additional return error codes.
+*                           -------------------RETURNED BY FS_FAT_JournalLogParse()-------------------
+*                           See FS_FAT_JournalLogParse() for additional return error codes.
 *
 * Return(s)   : none.
 *
@@ -2463,28 +2755,43 @@ static  CPU_SIZE_T  FS_FAT_JournalReverseScan (FS_VOL      *p_vol,
 *                       is always the last low level operation performed inside the containing top level
 *                       operation.
 *
-*                   (b) Since the journal is replayed backward, the clus chain deletion log is the
-*                       first log to be parsed. Once cluster chain deletion is completed, the containing
-*                       top level operation is also completed (see Note 2a). The journal is then cleared
-*                       and the replay is aborted.
+*                   (b) If the clus chain deletion log is the last complete log, the deletion is completed.
+*                       The containing top level operation is then also completed (see Note 2a) & no log is
+*                       reverted.
+*
+*               (3) Logs are entered back to back from the journal start.  They are parsed forward, each
+*                   bounded by its own low level operation (see FS_FAT_JournalLogParse()); the first log
+*                   that is not complete ends the journal.  With group commit, the journal may hold the
+*                   logs of several top level operations :
+*
+*                   (a) The top level operation holding the last clus chain deletion log, & every operation
+*                       before it, had completed (see Note #2a).  Their logs are kept.
+*
+*                   (b) The logs that follow are reverted newest first, each restoring the state its low
+*                       level operation found.  Since a log is only located by parsing forward, the log
+*                       preceding the one just reverted is found by parsing again from the first log to
+*                       revert; the journal holds at most a group of logs (see FS_FAT_JournalClrReset()).
 *********************************************************************************************************
 */
 
 static  void  FS_FAT_JournalReplay (FS_VOL  *p_vol,
                                     FS_ERR  *p_err)
 {
-    FS_FAT_DATA       *p_fat_data;
-    FS_FAT_FILE_DATA  *p_journal_data;
-    FS_BUF            *p_buf;
-    CPU_INT16U         mark;
-    CPU_INT16U         sig;
-    CPU_INT08U         buf[4u];
-    CPU_SIZE_T         journal_pos;
-    CPU_BOOLEAN        clus_chain_deleted;
+    FS_FAT_DATA  *p_fat_data;
+    FS_BUF       *p_buf;
+    CPU_INT16U    mark;
+    CPU_INT16U    sig;
+    CPU_INT08U    buf[4u];
+    CPU_SIZE_T    log_pos;
+    CPU_SIZE_T    log_next_pos;
+    CPU_SIZE_T    log_end_pos;
+    CPU_SIZE_T    del_pos;
+    CPU_SIZE_T    del_end_pos;
+    CPU_SIZE_T    revert_start_pos;
+    CPU_BOOLEAN   del_found;
 
 
-    p_fat_data     = (FS_FAT_DATA  *)p_vol->DataPtr;
-    p_journal_data =  p_fat_data->JournalDataPtr;
+    p_fat_data = (FS_FAT_DATA  *)p_vol->DataPtr;
 
                                                                 /* ------------------- REPLAY START ------------------- */
     DEF_BIT_SET(p_fat_data->JournalState, FS_FAT_JOURNAL_STATE_REPLAY);
@@ -2514,6 +2821,7 @@ static  void  FS_FAT_JournalReplay (FS_VOL  *p_vol,
                                   p_buf,
                                   p_err);
         if (*p_err != FS_ERR_NONE) {
+            FSBuf_Free(p_buf);
             return;
         }
         FSBuf_Flush(p_buf, p_err);
@@ -2523,26 +2831,40 @@ static  void  FS_FAT_JournalReplay (FS_VOL  *p_vol,
     }
 
 
-                                                                /* ----- FIND LAST COMPLETE ENTRY ENTER END MARK ------ */
-    MEM_VAL_SET_INT16U_LITTLE(&buf[0], FS_FAT_JOURNAL_MARK_ENTER_END);
-    journal_pos = FS_FAT_JournalReverseScan(p_vol,
-                                            p_buf,
-                                            FS_FAT_JOURNAL_FILE_LEN - 1u,
-                                           &buf[0],
-                                            FS_FAT_JOURNAL_LOG_MARK_SIZE,
-                                            p_err);
-    if ((*p_err != FS_ERR_NONE) &&
-        (*p_err != FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE)) {
+                                                                /* ------------ PARSE LOGS (see Note #3) -------------- */
+    log_end_pos = 0u;
+    del_pos     = 0u;
+    del_end_pos = 0u;
+    del_found   = DEF_NO;
+   *p_err       = FS_ERR_NONE;
+    while (*p_err == FS_ERR_NONE) {
+        log_next_pos = FS_FAT_JournalLogParse(p_vol,
+                                              p_buf,
+                                              log_end_pos,
+                                             &sig,
+                                              p_err);
+        if (*p_err == FS_ERR_NONE) {
+            if (sig == FS_FAT_JOURNAL_SIG_CLUS_CHAIN_DEL) {     /* Remember last clus chain del log.                    */
+                del_pos     = log_end_pos;
+                del_end_pos = log_next_pos;
+                del_found   = DEF_YES;
+            }
+            log_end_pos = log_next_pos;
+        }
+    }
+    if (*p_err != FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE) {
         FSBuf_Free(p_buf);
         return;
     }
+   *p_err = FS_ERR_NONE;
 
-    if (*p_err == FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE) {          /* If no enter end mark is found ...                    */
+    if (log_end_pos == 0u) {                                    /* If no complete log is found ...                      */
                                                                 /* ... then journal does not contain a complete entry.  */
         FS_FAT_JournalClrAllReset(p_vol,                        /* Make sure journal is completely clr'd ...            */
                                   p_buf,
                                   p_err);
         if (*p_err != FS_ERR_NONE) {
+            FSBuf_Free(p_buf);
             return;
         }
         FSBuf_Flush(p_buf, p_err);
@@ -2551,50 +2873,56 @@ static  void  FS_FAT_JournalReplay (FS_VOL  *p_vol,
         return;                                                 /* ... and abort replay.                                */
     }
 
-    clus_chain_deleted = DEF_NO;
-    while ((journal_pos > 0u) &&
-           (clus_chain_deleted == DEF_NO)) {
 
-                                                                /* --------------- FIND NEXT LOG ENTRY ---------------- */
-        MEM_VAL_SET_INT16U_LITTLE(&buf[0], FS_FAT_JOURNAL_MARK_ENTER);
-        journal_pos = FS_FAT_JournalReverseScan(p_vol,
-                                                p_buf,
-                                                journal_pos,
-                                               &buf[0],
-                                                FS_FAT_JOURNAL_LOG_MARK_SIZE,
-                                                p_err);
-        if ((*p_err != FS_ERR_NONE) &&
-            (*p_err != FS_ERR_VOL_JOURNAL_LOG_INCOMPLETE)) {
-            FSBuf_Free(p_buf);
-            return;
+                                                                /* ---------- COMPLETE CLUS CHAIN DEL (see Note #2) --- */
+    revert_start_pos = 0u;
+    if (del_found == DEF_YES) {
+        if (del_end_pos == log_end_pos) {                       /* If del log is last log ...                           */
+            FS_FAT_JournalPosSet(p_vol,
+                                 p_buf,
+                                 del_pos,
+                                 p_err);
+            if (*p_err == FS_ERR_NONE) {
+                FS_FAT_JournalReplayClusChainDel(p_vol,         /* ... complete clus chain del (see Note #2b).          */
+                                                 p_buf,
+                                                 p_err);
+            }
         }
+        revert_start_pos = del_end_pos;                         /* Logs up to del log are kept (see Note #3a).          */
+    }
 
-                                                                /* --------- SET POS AT LOG ENTRY ENTER MARK ---------- */
-        FS_FAT_JournalPosSet(p_vol,
-                             p_buf,
-                             journal_pos,
-                             p_err);
+
+                                                                /* -------- REVERT LOGS NEWEST FIRST (see Note #3b) --- */
+    while ((*p_err      == FS_ERR_NONE) &&
+           (log_end_pos >  revert_start_pos)) {
+                                                                /* Find log ending at cur end pos.                      */
+        log_pos      = revert_start_pos;
+        log_next_pos = FS_FAT_JournalLogParse(p_vol,
+                                              p_buf,
+                                              log_pos,
+                                             &sig,
+                                              p_err);
+        while ((*p_err       == FS_ERR_NONE) &&
+               (log_next_pos != log_end_pos)) {
+            log_pos      = log_next_pos;
+            log_next_pos = FS_FAT_JournalLogParse(p_vol,
+                                                  p_buf,
+                                                  log_pos,
+                                                 &sig,
+                                                  p_err);
+        }
         if (*p_err != FS_ERR_NONE) {
-            FSBuf_Free(p_buf);
-            return;
+            break;
         }
 
-                                                                /* --------------------- GET SIG ---------------------- */
-        FS_FAT_JournalPeek(p_vol,                               /* Enter mark presence already asserted by prev scan ...*/
-                           p_buf,
-                          &buf[0],
-                           p_journal_data->FilePos + FS_FAT_JOURNAL_LOG_MARK_SIZE,      /* ... so skip enter mark.      */
-                           FS_FAT_JOURNAL_LOG_SIG_SIZE,
-                           p_err);
+        FS_FAT_JournalPosSet(p_vol,                             /* Set pos at log enter mark.                           */
+                             p_buf,
+                             log_pos,
+                             p_err);
         if (*p_err != FS_ERR_NONE) {
-            FSBuf_Free(p_buf);
-            return;
+            break;
         }
 
-        sig = MEM_VAL_GET_INT16U_LITTLE(&buf[0]);
-
-
-                                                                /* ---------------------- REPLAY ---------------------- */
         switch (sig) {
             case FS_FAT_JOURNAL_SIG_CLUS_CHAIN_ALLOC:
                  FS_FAT_JournalRevertClusChainAlloc(p_vol,      /* Revert clus chain alloc.                             */
@@ -2602,13 +2930,6 @@ static  void  FS_FAT_JournalReplay (FS_VOL  *p_vol,
                                                     p_err);
                  break;
 
-            case FS_FAT_JOURNAL_SIG_CLUS_CHAIN_DEL:
-                 FS_FAT_JournalReplayClusChainDel(p_vol,        /* Complete clus chain del (See Note #2a).              */
-                                                  p_buf,
-                                                  p_err);
-                 clus_chain_deleted = DEF_YES;                  /* Clus chain has been del'd (See Note #2b).            */
-                 break;
-
             case FS_FAT_JOURNAL_SIG_ENTRY_CREATE:
                  FS_FAT_JournalRevertEntryCreate(p_vol,         /* Revert dir entry creation.                           */
                                                  p_buf,
@@ -2618,16 +2939,22 @@ static  void  FS_FAT_JournalReplay (FS_VOL  *p_vol,
             case FS_FAT_JOURNAL_SIG_ENTRY_UPDATE:
                  FS_FAT_JournalRevertEntryUpdate(p_vol,         /* Revert dir entry update/del.                         */
                                                  p_buf,
+                                                 log_end_pos - FS_FAT_JOURNAL_LOG_MARK_SIZE,
                                                  p_err);
                  break;
 
+            case FS_FAT_JOURNAL_SIG_CLUS_CHAIN_DEL:             /* Never reverted (see Note #3a).                       */
             default:
-                 FS_TRACE_LOG(("FS_FAT_JournalReplay(): Unknown journal sig: 0x%04X\r\n", sig));
-                *p_err = FS_ERR_NONE;
                  break;
         }
+
+        log_end_pos = log_pos;
     }
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+    FS_FAT_DirCacheClr(p_fat_data);                             /* Dir entries may have been reverted.                  */
+#endif
     if (*p_err != FS_ERR_NONE) {
+        FSBuf_Free(p_buf);
         return;
     }
 
@@ -2959,6 +3286,9 @@ static  void  FS_FAT_JournalReplayClusChainDel (FS_VOL  *p_vol,
        if (*p_err != FS_ERR_NONE) {
            return;
        }
+       if (p_fat_data->QueryInfoValid == DEF_YES) {             /* Update query info.                                   */
+           p_fat_data->QueryFreeClusCnt++;
+       }
    }
 
    if (nbr_marker == 0u) {                                      /* If no markers were log'd ...                         */
@@ -3068,11 +3398,13 @@ static  void  FS_FAT_JournalRevertEntryCreate (FS_VOL  *p_vol,
 *
 * Description : Revert directory entry update/deletion based on journal log information.
 *
-* Argument(s) : p_vol   Pointer to volume.
+* Argument(s) : p_vol           Pointer to volume.
 *
-*               p_buf   Pointer to temporary buffer.
+*               p_buf           Pointer to temporary buffer.
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+*               end_mark_pos    Position of log enter end mark.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
 *                           FS_ERR_NONE                         Directory entry deletion reverted.
 *
@@ -3095,35 +3427,42 @@ static  void  FS_FAT_JournalRevertEntryCreate (FS_VOL  *p_vol,
 *
 * Caller(s)   : FS_FAT_JournalReplay().
 *
-* Note(s)       (1) Enter mark, enter end mark and signature are validated by FS_FAT_JournalReplay().
+* Note(s)       (1) Enter mark, enter end mark and signature are validated by FS_FAT_JournalLogParse().
 *                   This function is called only if the corresponding journal log is complete.
 *
 *               (2) A second buffer is used to prevent a single buffer from continuously switching between
 *                   journal sector(s) and directory entry sector(s). If no second buffer is available, the
 *                   journal log operation will still be performed at the expense of a significant performance
-*                   penalty.
+*                   penalty.  The second buffer is flushed & freed before returning, on error as well, so
+*                   that no sector is left cached in a buffer the next log does not know of.
 *
 *               (3) The sector number gotten or allocated from the FAT should be valid. These checks are
 *                   effectively redundant.
+*
+*               (4) Entries are read up to the log enter end mark only, so that the revert never reads past
+*                   its own log, even if the directory positions logged do not match the entries logged.
 *********************************************************************************************************
 */
 
-static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL  *p_vol,
-                                               FS_BUF  *p_buf,
-                                               FS_ERR  *p_err)
+static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL      *p_vol,
+                                               FS_BUF      *p_buf,
+                                               CPU_SIZE_T   end_mark_pos,
+                                               FS_ERR      *p_err)
 {
-    FS_FAT_DATA     *p_fat_data;
-    FS_BUF          *p_buf2;
-    CPU_INT08U      *p_dir_entry;
-    FS_FAT_DIR_POS   dir_start_pos;
-    FS_FAT_DIR_POS   dir_end_pos;
-    FS_FAT_DIR_POS   dir_cur_pos;
-    CPU_BOOLEAN      dir_sec_valid;
-    FS_FAT_SEC_NBR   dir_next_sec;
-    CPU_INT08U       log[FS_FAT_SIZE_DIR_ENTRY];
+    FS_FAT_DATA       *p_fat_data;
+    FS_FAT_FILE_DATA  *p_journal_data;
+    FS_BUF            *p_buf2;
+    CPU_INT08U        *p_dir_entry;
+    FS_FAT_DIR_POS     dir_start_pos;
+    FS_FAT_DIR_POS     dir_cur_pos;
+    CPU_BOOLEAN        dir_sec_valid;
+    FS_FAT_SEC_NBR     dir_next_sec;
+    FS_ERR             err;
+    CPU_INT08U         log[FS_FAT_SIZE_DIR_ENTRY];
 
 
-    p_fat_data = (FS_FAT_DATA *)p_vol->DataPtr;
+    p_fat_data     = (FS_FAT_DATA *)p_vol->DataPtr;
+    p_journal_data =  p_fat_data->JournalDataPtr;
 
                                                                 /* ------------------ PARSE LOG ARGS ------------------ */
     FS_FAT_JournalRd(p_vol,
@@ -3138,8 +3477,6 @@ static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL  *p_vol,
                                                                 /* Ignore marks & sig (see Note #1).                    */
     dir_start_pos.SecNbr = (FS_FAT_SEC_NBR)MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_START_SEC_NBR_OFFSET]);
     dir_start_pos.SecPos = (FS_SEC_SIZE   )MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_START_SEC_POS_OFFSET]);
-    dir_end_pos.SecNbr   = (FS_FAT_SEC_NBR)MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_END_SEC_NBR_OFFSET]);
-    dir_end_pos.SecPos   = (FS_SEC_SIZE   )MEM_VAL_GET_INT32U_LITTLE((void *)&log[FS_FAT_JOURNAL_ENTRY_DEL_LOG_END_SEC_POS_OFFSET]);
 
 
                                                                 /* Get 2nd buf if possible (see Note #2).               */
@@ -3151,11 +3488,11 @@ static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL  *p_vol,
 
     dir_cur_pos   = dir_start_pos;
     dir_sec_valid = FS_FAT_IS_VALID_SEC(p_fat_data, dir_cur_pos.SecNbr);
+   *p_err         = FS_ERR_NONE;
 
-    while ( (dir_sec_valid      == DEF_YES) &&                  /* While sec is valid (see Note #3)  ...                */
-           ((dir_cur_pos.SecNbr != dir_end_pos.SecNbr) ||       /* ... &     end sec     not reached ...                */
-            (dir_cur_pos.SecPos <= dir_end_pos.SecPos))) {      /* ...    OR end sec pos not reached.                   */
-
+    while ((*p_err                  == FS_ERR_NONE) &&
+           ( dir_sec_valid          == DEF_YES)     &&          /* While sec is valid (see Note #3) ...                 */
+           ( p_journal_data->FilePos < end_mark_pos)) {         /* ... & entries rem in log (see Note #4).              */
 
                                                                 /* --------------------- RD ENTRY ----------------------*/
         FS_FAT_JournalRd(p_vol,
@@ -3164,9 +3501,7 @@ static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL  *p_vol,
                          FS_FAT_SIZE_DIR_ENTRY,
                          p_err);
         if (*p_err != FS_ERR_NONE) {
-            if (p_buf2 != p_buf) {
-                FSBuf_Free(p_buf2);
-            }
+            break;
         }
 
                                                                 /* ------------------ RD NEXT DIR SEC ----------------- */
@@ -3176,25 +3511,13 @@ static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL  *p_vol,
                                              p_buf2,
                                              dir_cur_pos.SecNbr,
                                              p_err);
-            switch (*p_err) {
-                case FS_ERR_NONE:
-                     break;
-
-                case FS_ERR_SYS_CLUS_CHAIN_END:
-                case FS_ERR_SYS_CLUS_INVALID:
-                     FS_TRACE_INFO(("FS_FAT_JournalRevertEntryUpdate(): Unexpected end to dir after sec %d.\r\n", dir_cur_pos.SecNbr));
-                    *p_err = FS_ERR_ENTRY_CORRUPT;
-                     if (p_buf2 != p_buf) {
-                         FSBuf_Free(p_buf2);
-                     }
-                     return;
-
-                case FS_ERR_DEV:
-                default:
-                     if (p_buf2 != p_buf) {
-                         FSBuf_Free(p_buf2);
-                     }
-                     return;
+            if ((*p_err == FS_ERR_SYS_CLUS_CHAIN_END) ||
+                (*p_err == FS_ERR_SYS_CLUS_INVALID)) {
+                FS_TRACE_INFO(("FS_FAT_JournalRevertEntryUpdate(): Unexpected end to dir after sec %d.\r\n", dir_cur_pos.SecNbr));
+               *p_err = FS_ERR_ENTRY_CORRUPT;
+            }
+            if (*p_err != FS_ERR_NONE) {
+                break;
             }
                                                                 /* Chk sec validity (see Note #3).                      */
             dir_sec_valid      = FS_FAT_IS_VALID_SEC(p_fat_data, dir_next_sec);
@@ -3204,40 +3527,33 @@ static  void  FS_FAT_JournalRevertEntryUpdate (FS_VOL  *p_vol,
         }
 
         if (dir_sec_valid == DEF_YES) {
-            p_dir_entry = (CPU_INT08U *)p_buf2->DataPtr;
-
             FSBuf_Set(p_buf2,                                   /* Set buf.                                             */
                       dir_cur_pos.SecNbr,
                       FS_VOL_SEC_TYPE_DIR,
                       DEF_YES,
                       p_err);
             if (*p_err != FS_ERR_NONE) {
-                if (p_buf2 != p_buf) {
-                    FSBuf_Free(p_buf2);
-                }
-                return;
+                break;
             }
-        }
                                                                 /* Wr dir entry in buf.                                 */
-        Mem_Copy(p_dir_entry + dir_cur_pos.SecPos, &log[0], FS_FAT_SIZE_DIR_ENTRY);
+            p_dir_entry = (CPU_INT08U *)p_buf2->DataPtr + dir_cur_pos.SecPos;
+            Mem_Copy(p_dir_entry, &log[0], FS_FAT_SIZE_DIR_ENTRY);
+
+            FSBuf_MarkDirty(p_buf2, p_err);                     /* Mark buf as dirty.                                   */
 
-        FSBuf_MarkDirty(p_buf2, p_err);                         /* Mark buf as dirty.                                   */
-        if (*p_err != FS_ERR_NONE) {
-            if (p_buf2 != p_buf) {
-                FSBuf_Free(p_buf2);
-            }
-            return;
-        }
                                                                 /* ---------------- MOVE TO NEXT ENTRY ---------------- */
-        dir_cur_pos.SecPos += FS_FAT_SIZE_DIR_ENTRY;
-        p_dir_entry        += FS_FAT_SIZE_DIR_ENTRY;
+            dir_cur_pos.SecPos += FS_FAT_SIZE_DIR_ENTRY;
+        }
     }
 
 
                                                                 /* ---------------- ENTRY DEL REVERT'D ---------------- */
-    if (p_buf2 != p_buf) {                                      /* Free 2nd buf.                                        */
-        FSBuf_Flush(p_buf2, p_err);
+    if (p_buf2 != p_buf) {                                      /* Flush & free 2nd buf (see Note #2).                  */
+        FSBuf_Flush(p_buf2, &err);
         FSBuf_Free(p_buf2);
+        if (*p_err == FS_ERR_NONE) {
+           *p_err = err;
+        }
     }
 }
 
@@ -130,6 +130,9 @@ void             FS_FAT_JournalStart              (CPU_CHAR              *name_v
 void             FS_FAT_JournalStop               (CPU_CHAR              *name_vol,     /* Stop  journaling.            */
                                                    FS_ERR                *p_err);
 
+void             FS_FAT_JournalCommit             (CPU_CHAR              *name_vol,     /* Commit logged ops.           */
+                                                   FS_ERR                *p_err);
+
 /*
 *********************************************************************************************************
 *                                    INTERNAL FUNCTION PROTOTYPES
@@ -130,6 +130,38 @@ typedef  struct  fs_fat_dir_pos {
     FS_SEC_SIZE       SecPos;
 } FS_FAT_DIR_POS;
 
+/*
+*********************************************************************************************************
+*                                       FAT FILE EXTENT DATA TYPE
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+typedef  struct  fs_fat_file_extent {
+    FS_FAT_CLUS_NBR   FileClusIx;                               /* Ix of extent's first clus within file.               */
+    FS_FAT_CLUS_NBR   StartClus;                                /* Clus nbr of extent's first clus.                     */
+    FS_FAT_CLUS_NBR   Len;                                      /* Nbr of contiguous clus's (0 if extent unused).       */
+} FS_FAT_FILE_EXTENT;
+#endif
+
+/*
+*********************************************************************************************************
+*                                    FAT DIRECTORY CACHE ENTRY DATA TYPE
+*********************************************************************************************************
+*/
+
+#if (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+typedef  struct  fs_fat_dir_cache_entry {
+    FS_FAT_SEC_NBR    DirFirstSec;                              /* First sec of parent dir (0 if entry unused).         */
+    CPU_INT32U        NameHash;                                 /* Hash of name (case-insensitive).                     */
+    FS_FAT_DIR_POS    DirStartPos;                              /* Pos of first dir entry of name.                      */
+    FS_FAT_DIR_POS    DirEndPos;                                /* Pos of SFN   dir entry of name.                      */
+    CPU_BOOLEAN       Found;                                    /* DEF_NO if name known NOT to exist in dir.            */
+    CPU_INT08U        NameLen;                                  /* Len of name (in octets).                             */
+    CPU_CHAR          Name[FS_FAT_CFG_DIR_CACHE_NAME_LEN];      /* Name, as looked up.                                  */
+} FS_FAT_DIR_CACHE_ENTRY;
+#endif
+
 /*
 *********************************************************************************************************
 *                                         FAT TYPE API DATA TYPE
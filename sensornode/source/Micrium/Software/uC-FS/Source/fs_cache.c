@@ -67,9 +67,59 @@
 /*
 *********************************************************************************************************
 *                                            LOCAL DEFINES
+*
+* Note(s) : (1) Each cache data partition is managed with the 2Q replacement policy :
+*
+*               (a) A sector read or written for the first time enters the A1in FIFO.  A sector referenced
+*                   again while in A1in stays where it is, so a single sequential pass (e.g., a file being
+*                   appended) only ever cycles through A1in.
+*
+*               (b) When A1in holds more than its share of the buffers, its oldest sector is evicted & its
+*                   sector number is remembered in the A1out ghost FIFO (no data is kept).
+*
+*               (c) A sector that misses but is found in A1out has been re-referenced after a short
+*                   absence; it is loaded directly into the Am LRU list, which holds the hot sectors &
+*                   is only evicted from when A1in is at or below its share.
+*
+*           (2) Buffers & ghosts are indexed by sector number in a chained hash table whose size is the
+*               smallest power of 2 not less than the number of buffers in the partition.
+*
+*           (3) The metadata reserved per cache buffer in the cache memory covers the buffer pointer,
+*               the buffer entry & at most one ghost entry, and at most two hash table slots.
+*
+*           (4) When FS_CFG_CACHE_MULTI_SEC_MAX is greater than 1, a transfer buffer of that many sectors
+*               is also reserved in the cache memory, so that several sectors can be moved in a single
+*               device access :
+*
+*               (a) A dirty buffer is flushed together with the dirty buffers holding the sectors that
+*                   surround it, as one multi-sector write per transfer buffer of contiguous sectors.
+*
+*               (b) A file sector miss at the sector following the last file sector read from the
+*                   device reads ahead.  The read-ahead window starts at FS_CACHE_RD_AHEAD_WIN_MIN
+*                   sectors & doubles on each sequential miss; a non-sequential miss closes it.
 *********************************************************************************************************
 */
 
+#define  FS_CACHE_IX_NONE                     ((FS_SEC_QTY)-1)
+
+#define  FS_CACHE_Q_FREE                                  0u    /* Unused bufs.                                         */
+#define  FS_CACHE_Q_A1IN                                  1u    /* Bufs referenced once (FIFO).                         */
+#define  FS_CACHE_Q_AM                                    2u    /* Bufs referenced more than once (LRU).                */
+#define  FS_CACHE_Q_A1OUT                                 3u    /* Ghosts of secs evicted from A1in (FIFO).             */
+#define  FS_CACHE_Q_GHOST_FREE                            4u    /* Unused ghosts.                                       */
+#define  FS_CACHE_Q_NBR                                   5u
+
+#define  FS_CACHE_A1IN_PCT                               25u    /* Share of bufs kept in A1in (see Note #1b).           */
+#define  FS_CACHE_A1OUT_PCT                              50u    /* Nbr of ghosts, in pct of the nbr of bufs.            */
+
+#define  FS_CACHE_RD_AHEAD_WIN_MIN                        2u    /* Initial rd-ahead window, in secs (see Note #4b).     */
+
+                                                                /* Round size up to a multiple of CPU_ALIGN.            */
+#define  FS_CACHE_ALIGN_SIZE(size)             ((((size) + sizeof(CPU_ALIGN) - 1u) / sizeof(CPU_ALIGN)) * sizeof(CPU_ALIGN))
+
+                                                                /* Nbr of hash tbl slots used by cache data.            */
+#define  FS_CACHE_HASH_TBL_SIZE(p_cache_data)  (((p_cache_data)->Size == 0u) ? 0u : ((p_cache_data)->HashMask + 1u))
+
 
 /*
 *********************************************************************************************************
@@ -84,6 +134,35 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                       CACHE ENTRY DATA TYPE
+*
+* Note(s) : (1) Entries [0, Size) describe the buffers 'BufUsedPtrs[0, Size)'; entries
+*               [Size, Size + GhostSize) are the A1out ghosts (see 'LOCAL DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_cache_entry {
+    FS_SEC_NBR    Start;                                        /* Sec nbr, -1 if unused.                               */
+    FS_SEC_QTY    HashNext;                                     /* Next entry in hash chain.                            */
+    FS_SEC_QTY    Prev;                                         /* Prev entry in queue (towards head).                  */
+    FS_SEC_QTY    Next;                                         /* Next entry in queue (towards tail).                  */
+    CPU_INT08U    Q;                                            /* Queue holding this entry.                            */
+} FS_CACHE_ENTRY;
+
+/*
+*********************************************************************************************************
+*                                       CACHE QUEUE DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  fs_cache_q {
+    FS_SEC_QTY    Head;                                         /* Most recently inserted/used entry.                   */
+    FS_SEC_QTY    Tail;                                         /* Least recently inserted/used entry.                  */
+    FS_SEC_QTY    Cnt;                                          /* Nbr of entries in queue.                             */
+} FS_CACHE_Q;
+
 /*
 *********************************************************************************************************
 *                                        CACHE DATA DATA TYPE
@@ -91,9 +170,21 @@
 */
 
 typedef  struct  fs_cache_data {
-    FS_SEC_QTY    Size;
-    FS_SEC_QTY    NextBufToUseIx;
-    FS_BUF      **BufUsedPtrs;
+    FS_SEC_QTY        Size;                                     /* Nbr of bufs.                                         */
+    FS_SEC_QTY        GhostSize;                                /* Nbr of ghosts.                                       */
+    FS_SEC_QTY        A1inSizeMax;                              /* Max nbr of bufs in A1in when evicting.               */
+    FS_SEC_QTY        HashMask;                                 /* Hash tbl size - 1.                                   */
+    FS_BUF          **BufUsedPtrs;                              /* Bufs.                                                */
+    FS_CACHE_ENTRY   *EntryTbl;                                 /* Buf & ghost entries (see Note #1).                   */
+    FS_SEC_QTY       *HashTbl;                                  /* Hash chain heads.                                    */
+    FS_CACHE_Q        Q[FS_CACHE_Q_NBR];                        /* Queues.                                              */
+
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+    FS_CTR            StatHitCtr;                               /* Nbr hits.                                            */
+    FS_CTR            StatMissCtr;                              /* Nbr misses.                                          */
+    FS_CTR            StatGhostHitCtr;                          /* Nbr misses found in A1out.                           */
+    FS_CTR            StatEvictCtr;                             /* Nbr bufs evicted.                                    */
+#endif
 } FS_CACHE_DATA;
 
 /*
@@ -111,6 +202,11 @@ typedef  struct  fs_cache {
     FS_CACHE_DATA    DataDir;                                   /* Dir  cache data.                                     */
     FS_CACHE_DATA    DataData;                                  /* Data cache data.                                     */
 
+    CPU_INT08U      *XferBufPtr;                                /* Multi-sec xfer buf (see 'LOCAL DEFINES  Note #4').   */
+    FS_SEC_QTY       XferSize;                                  /* Size of xfer buf (in secs), 0 if none.               */
+    FS_SEC_NBR       RdAheadNext;                               /* Sec following last file sec rd from dev.             */
+    FS_SEC_QTY       RdAheadWin;                                /* Cur rd-ahead window (in secs).                       */
+
 #if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
     FS_CTR           StatHitCtr;                                /* Nbr hits.                                            */
     FS_CTR           StatMissCtr;                               /* Nbr misses.                                          */
@@ -119,9 +215,11 @@ typedef  struct  fs_cache {
     FS_CTR           StatUpdateCtr;                             /* Nbr bufs updated.                                    */
     FS_CTR           StatRdCtr;                                 /* Nbr rds.                                             */
     FS_CTR           StatRdAvoidCtr;                            /* Nbr rds avoided.                                     */
+    FS_CTR           StatRdAheadCtr;                            /* Nbr secs rd ahead.                                   */
 #if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
     FS_CTR           StatWrCtr;                                 /* Nbr wrs.                                             */
     FS_CTR           StatWrAvoidCtr;                            /* Nbr wrs avoided.                                     */
+    FS_CTR           StatWrMultiCtr;                            /* Nbr multi-sec flush wrs.                             */
 #endif
 #endif
 } FS_CACHE;
@@ -187,16 +285,65 @@ static  void            FSCache_Invalidate      (FS_VOL          *p_vol,
 static  void            FSCache_Flush           (FS_VOL          *p_vol,        /* Flush cache.                         */
                                                  FS_ERR          *p_err);
 
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+static  void            FSCache_StatGet         (FS_VOL          *p_vol,        /* Get cache stats.                     */
+                                                 FS_VOL_CACHE_STAT *p_stat,
+                                                 FS_ERR          *p_err);
+#endif
+
 
                                                                                 /* ------------ LOCAL FNCTS ----------- */
                                                                                 /* Init Data cache structure            */
 static  void           FSCache_DataInit         (FS_VOL          *p_vol,
                                                  FS_CACHE_DATA   *p_data_cache,
                                                  FS_BUF         **p_buf_ptrs,
+                                                 FS_CACHE_ENTRY  *p_entry_tbl,
+                                                 FS_SEC_QTY      *p_hash_tbl,
                                                  FS_SEC_QTY       size);
 
+static  void           FSCache_DataReset        (FS_CACHE_DATA   *p_cache_data);/* Empty all queues & hash tbl.         */
+
 static  void           FSCache_BufFree          (FS_BUF          *p_buf);       /* Free buf.                            */
 
+                                                                                /* Ins entry at head of queue.          */
+static  void           FSCache_QIns             (FS_CACHE_DATA   *p_cache_data,
+                                                 CPU_INT08U       q,
+                                                 FS_SEC_QTY       entry_ix);
+
+static  void           FSCache_QRemove          (FS_CACHE_DATA   *p_cache_data, /* Remove entry from its queue.         */
+                                                 FS_SEC_QTY       entry_ix);
+
+static  void           FSCache_HashIns          (FS_CACHE_DATA   *p_cache_data, /* Ins entry into hash tbl.             */
+                                                 FS_SEC_QTY       entry_ix);
+
+static  void           FSCache_HashRemove       (FS_CACHE_DATA   *p_cache_data, /* Remove entry from hash tbl.          */
+                                                 FS_SEC_QTY       entry_ix);
+
+static  void           FSCache_EntryRemove      (FS_CACHE_DATA   *p_cache_data, /* Drop buf or ghost from cache.        */
+                                                 FS_SEC_QTY       entry_ix);
+
+static  void           FSCache_EntryTouch       (FS_CACHE_DATA   *p_cache_data, /* Record a hit on a buf.               */
+                                                 FS_SEC_QTY       entry_ix);
+
+static  FS_SEC_QTY     FSCache_EntryAlloc       (FS_CACHE        *p_cache,      /* Alloc buf for a sec.                 */
+                                                 FS_CACHE_DATA   *p_cache_data,
+                                                 FS_SEC_NBR       start);
+
+static  void           FSCache_GhostAdd         (FS_CACHE_DATA   *p_cache_data, /* Remember sec evicted from A1in.      */
+                                                 FS_SEC_NBR       start);
+
+static  void           FSCache_RdMiss           (FS_VOL          *p_vol,        /* Rd missed secs & put in cache.       */
+                                                 FS_CACHE        *p_cache,
+                                                 CPU_INT08U      *p_dest,
+                                                 FS_SEC_NBR       start,
+                                                 FS_SEC_QTY       cnt,
+                                                 FS_FLAGS         sec_type,
+                                                 FS_ERR          *p_err);
+
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+static  void           FSCache_DataStatGet      (FS_CACHE_DATA   *p_cache_data, /* Get cache data stats.                */
+                                                 FS_VOL_CACHE_DATA_STAT *p_stat);
+#endif
 
 
 static  void           FSCache_EntriesInvalidate(FS_CACHE_DATA   *p_cache_data, /* Invalidate entries from cache.       */
@@ -217,10 +364,12 @@ static  void           FSCache_EntriesRelease   (FS_CACHE_DATA   *p_cache_data,
 static  void           FSCache_EntryFlush       (FS_BUF          *p_buf,        /* Flush cache entry.                   */
                                                  FS_ERR          *p_err);
 
-static  void           FSCache_UpdateIndex      (FS_CACHE_DATA   *p_cache_data);/* Get next entry in the cache.         */
-
+static  void           FSCache_EntryRunFlush    (FS_CACHE        *p_cache,      /* Flush run of dirty entries.          */
+                                                 FS_CACHE_DATA   *p_cache_data,
+                                                 FS_SEC_QTY       entry_ix,
+                                                 FS_ERR          *p_err);
 
-static  FS_BUF       **FSCache_EntryFind        (FS_CACHE_DATA   *p_cache_data, /* Find entry in cache.                 */
+static  FS_SEC_QTY     FSCache_EntryFind        (FS_CACHE_DATA   *p_cache_data, /* Find entry in cache.                 */
                                                  FS_SEC_NBR       start);
 
 static  void           FSCache_ObjClr           (FS_CACHE        *p_cache);     /* Clr cache obj.                       */
@@ -254,7 +403,10 @@ const  FS_VOL_CACHE_API  FSCache_Dflt = {
     FSCache_Wr,
 #endif
     FSCache_Invalidate,
-    FSCache_Flush
+    FSCache_Flush,
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+    FSCache_StatGet
+#endif
 };
 
 
@@ -320,6 +472,13 @@ const  FS_VOL_CACHE_API  FSCache_Dflt = {
 *               application function(s).
 *
 * Note(s)     : (1) Write back cache NOT supported.
+*
+*               (2) The cache memory holds, in order, the cache object, the per-buffer metadata (see
+*                   'LOCAL DEFINES  Note #3'), the transfer buffer (see 'LOCAL DEFINES  Note #4') & the
+*                   buffers themselves.
+*
+*               (3) The transfer buffer is NOT reserved if it would leave fewer cache buffers than the
+*                   sectors it holds.
 *********************************************************************************************************
 */
 
@@ -332,17 +491,24 @@ static  void  FSCache_Create (FS_VOL       *p_vol,
                               FS_FLAGS      mode,
                               FS_ERR       *p_err)
 {
-    CPU_INT32U    align;
-    CPU_INT32U    buf_size;
-    FS_CACHE     *p_cache;
-    FS_SEC_QTY    cache_size;
-    FS_SEC_QTY    cache_size_max;
-    FS_SEC_QTY    cache_size_mgmt;
-    FS_SEC_QTY    cache_size_dir;
-    FS_SEC_QTY    cache_size_data;
-    CPU_INT32U    offset;
-    FS_BUF      **p_buf_used_ptrs;
-    CPU_INT08U   *p_cache_data_08;
+    CPU_INT32U        align;
+    CPU_INT32U        buf_size;
+    CPU_INT32U        meta_size;
+    CPU_INT32U        tbl_size;
+    CPU_INT32U        xfer_octets;
+    FS_SEC_QTY        xfer_size;
+    FS_CACHE         *p_cache;
+    FS_SEC_QTY        cache_size;
+    FS_SEC_QTY        cache_size_max;
+    FS_SEC_QTY        cache_size_mgmt;
+    FS_SEC_QTY        cache_size_dir;
+    FS_SEC_QTY        cache_size_data;
+    CPU_INT32U        offset;
+    FS_BUF          **p_buf_used_ptrs;
+    FS_CACHE_ENTRY   *p_entry_tbl;
+    FS_SEC_QTY       *p_hash_tbl;
+    CPU_INT08U       *p_xfer_buf;
+    CPU_INT08U       *p_cache_data_08;
 
 
 #if (FS_CFG_ERR_ARG_CHK_DBG_EN == DEF_ENABLED)                  /* ------------------- VALIDATE ARGS ------------------ */
@@ -391,11 +557,43 @@ static  void  FSCache_Create (FS_VOL       *p_vol,
     }
     buf_size   = sizeof(FS_BUF) + align;
 
-    cache_size_max   =  size / (buf_size + sec_size);
+    meta_size  = sizeof(CPU_ADDR)                               /* Per-buf metadata (see 'LOCAL DEFINES  Note #3').     */
+               + sizeof(FS_CACHE_ENTRY) * 2u
+               + sizeof(FS_SEC_QTY)     * 2u;
+
+    xfer_size        =  FS_CFG_CACHE_MULTI_SEC_MAX;             /* Size xfer buf (see Note #3).                         */
+    if (xfer_size < 2u) {
+        xfer_size    =  0u;
+    }
+    xfer_octets      = (CPU_INT32U)xfer_size * sec_size;
+    cache_size_max   =  0u;
+    if (xfer_octets < size) {
+        cache_size_max = (size - xfer_octets) / (buf_size + sec_size + meta_size);
+    }
+    if (cache_size_max < xfer_size) {
+        xfer_size      =  0u;
+        xfer_octets    =  0u;
+        cache_size_max =  size / (buf_size + sec_size + meta_size);
+    }
 
     p_buf_used_ptrs  = (FS_BUF **)p_cache_data_08;             /* Alloc used buf ptr array.                            */
-    offset          +=  sizeof(CPU_ADDR) * cache_size_max;
-    p_cache_data_08 +=  sizeof(CPU_ADDR) * cache_size_max;
+    tbl_size         =  FS_CACHE_ALIGN_SIZE(sizeof(CPU_ADDR) * cache_size_max);
+    offset          +=  tbl_size;
+    p_cache_data_08 +=  tbl_size;
+
+    p_entry_tbl      = (FS_CACHE_ENTRY *)p_cache_data_08;       /* Alloc entry tbl.                                     */
+    tbl_size         =  FS_CACHE_ALIGN_SIZE(sizeof(FS_CACHE_ENTRY) * cache_size_max * 2u);
+    offset          +=  tbl_size;
+    p_cache_data_08 +=  tbl_size;
+
+    p_hash_tbl       = (FS_SEC_QTY *)p_cache_data_08;           /* Alloc hash tbl.                                      */
+    tbl_size         =  FS_CACHE_ALIGN_SIZE(sizeof(FS_SEC_QTY) * cache_size_max * 2u);
+    offset          +=  tbl_size;
+    p_cache_data_08 +=  tbl_size;
+
+    p_xfer_buf       =  p_cache_data_08;                        /* Alloc xfer buf.                                      */
+    offset          +=  xfer_octets;
+    p_cache_data_08 +=  xfer_octets;
 
 
     offset += buf_size + sec_size;
@@ -411,7 +609,8 @@ static  void  FSCache_Create (FS_VOL       *p_vol,
 
                                                                 /* -------------------- ALLOC BUFS -------------------- */
     cache_size = 0u;
-    while (offset < size) {
+    while ((offset     <  size) &&
+           (cache_size <  cache_size_max)) {
         p_buf_used_ptrs[cache_size]           = (FS_BUF *)p_cache_data_08;
         p_cache_data_08                      +=  buf_size;
         p_buf_used_ptrs[cache_size]->DataPtr  =  p_cache_data_08;
@@ -432,27 +631,39 @@ static  void  FSCache_Create (FS_VOL       *p_vol,
     }
 
                                                                 /* ------------------ INIT CACHE INFO ----------------- */
-    p_cache->Mode    =  mode;
-    p_cache->Size    =  cache_size;
-    p_cache->SecSize =  sec_size;
+    p_cache->Mode       =  mode;
+    p_cache->Size       =  cache_size;
+    p_cache->SecSize    =  sec_size;
+    p_cache->XferSize   =  xfer_size;
+    p_cache->XferBufPtr = (xfer_size > 0u) ? p_xfer_buf : (CPU_INT08U *)0;
 
                                                                 /* Init Mgmt cache data.                                */
     FSCache_DataInit( p_vol,
                      &p_cache->DataMgmt,
                       p_buf_used_ptrs,
+                      p_entry_tbl,
+                      p_hash_tbl,
                       cache_size_mgmt);
                                                                 /* Init Dir cache data.                                 */
     p_buf_used_ptrs += cache_size_mgmt;
+    p_entry_tbl     += cache_size_mgmt + p_cache->DataMgmt.GhostSize;
+    p_hash_tbl      += FS_CACHE_HASH_TBL_SIZE(&p_cache->DataMgmt);
     FSCache_DataInit( p_vol,
                      &p_cache->DataDir,
                       p_buf_used_ptrs,
+                      p_entry_tbl,
+                      p_hash_tbl,
                       cache_size_dir);
                                                                 /* Init Data cache data.                                */
     cache_size_data  = (cache_size - cache_size_mgmt) - cache_size_dir;
     p_buf_used_ptrs +=  cache_size_dir;
+    p_entry_tbl     +=  cache_size_dir + p_cache->DataDir.GhostSize;
+    p_hash_tbl      +=  FS_CACHE_HASH_TBL_SIZE(&p_cache->DataDir);
     FSCache_DataInit( p_vol,
                      &p_cache->DataData,
                       p_buf_used_ptrs,
+                      p_entry_tbl,
+                      p_hash_tbl,
                       cache_size_data);
 
     p_vol->CacheDataPtr = (void *)p_cache;
@@ -549,6 +760,9 @@ static  void  FSCache_Del (FS_VOL  *p_vol,
 *               application function(s).
 *
 * Note(s)     : (1) The function caller MUST have acquired a reference to the volume & hold the device lock.
+*
+*               (2) Each run of missed sectors is read with a single device access, which may also read
+*                   ahead (see 'LOCAL DEFINES  Note #4b').
 *********************************************************************************************************
 */
 
@@ -562,7 +776,6 @@ static  void  FSCache_Rd (FS_VOL      *p_vol,
     FS_CACHE     *p_cache;
     CPU_INT08U   *p_dest_08;
     CPU_BOOLEAN   found;
-    FS_SEC_NBR    start_rd;
     FS_SEC_NBR    start_acc;
     FS_SEC_QTY    cnt_acc;
     CPU_INT08U   *p_dest_acc;
@@ -604,26 +817,17 @@ static  void  FSCache_Rd (FS_VOL      *p_vol,
 
         } else {                                                /* If sec in cache ...                                  */
             if (cnt_acc > 0u) {
-                start_rd = start_acc + p_vol->PartitionStart;
-                FSDev_RdLocked(p_vol->DevPtr,                   /*                 ... rd acc'd secs ...                */
+                FSCache_RdMiss(p_vol,                           /*                 ... rd acc'd secs.                   */
+                               p_cache,
                                p_dest_acc,
-                               start_rd,
+                               start_acc,
                                cnt_acc,
+                               sec_type,
                                p_err);
                 if (*p_err != FS_ERR_NONE) {
                     return;
                 }
-
-                while (cnt_acc > 0u) {                          /*                                   ... put in cache.  */
-                   (void)FSCache_SecPut(p_cache,
-                                        p_dest_acc,
-                                        start_acc,
-                                        sec_type,
-                                        DEF_YES);
-                    start_acc++;
-                    cnt_acc--;
-                    p_dest_acc += p_cache->SecSize;
-                }
+                cnt_acc = 0u;
             }
             FS_CTR_STAT_INC(p_cache->StatRdAvoidCtr);
         }
@@ -637,26 +841,16 @@ static  void  FSCache_Rd (FS_VOL      *p_vol,
 
                                                                 /* ---------------- RD FINAL ACC'D SECS --------------- */
     if (cnt_acc > 0u) {
-        start_rd = start_acc + p_vol->PartitionStart;
-        FSDev_RdLocked(p_vol->DevPtr,                           /* Rd acc'd secs ...                                    */
+        FSCache_RdMiss(p_vol,                                   /* Rd acc'd secs (see Note #2).                         */
+                       p_cache,
                        p_dest_acc,
-                       start_rd,
+                       start_acc,
                        cnt_acc,
+                       sec_type,
                        p_err);
         if (*p_err != FS_ERR_NONE) {
             return;
         }
-
-        while (cnt_acc > 0u) {                                  /*               ... put in cache.                      */
-           (void)FSCache_SecPut(p_cache,
-                                p_dest_acc,
-                                start_acc,
-                                sec_type,
-                                DEF_YES);
-            start_acc++;
-            cnt_acc--;
-            p_dest_acc += p_cache->SecSize;
-        }
     }
 
    *p_err = FS_ERR_NONE;
@@ -1017,6 +1211,69 @@ static  void  FSCache_Flush (FS_VOL  *p_vol,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          FSCache_StatGet()
+*
+* Description : Get cache statistics.
+*
+* Argument(s) : p_vol       Pointer to volume.
+*               ----------  Argument validated by caller.
+*
+*               p_stat      Pointer to structure that will receive the statistics.
+*               ----------  Argument validated by caller.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*               ----------  Argument validated by caller.
+*
+*                               FS_ERR_NONE     Statistics returned.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSVol_CacheStatGet().
+*
+*               This function is an INTERNAL file system suite function & MUST NOT be called by
+*               application function(s).
+*
+* Note(s)     : (1) If no cache memory is attached to the volume, all statistics are returned as zero.
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+static  void  FSCache_StatGet (FS_VOL             *p_vol,
+                               FS_VOL_CACHE_STAT  *p_stat,
+                               FS_ERR             *p_err)
+{
+    FS_CACHE  *p_cache;
+
+
+    Mem_Clr((void *)p_stat, sizeof(FS_VOL_CACHE_STAT));
+
+    p_cache = (FS_CACHE *)p_vol->CacheDataPtr;
+    if (p_cache == (FS_CACHE *)0) {                             /* See Note #1.                                         */
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    p_stat->Size       = p_cache->Size;
+    p_stat->HitCtr     = p_cache->StatHitCtr;
+    p_stat->MissCtr    = p_cache->StatMissCtr;
+    p_stat->RdCtr      = p_cache->StatRdCtr;
+    p_stat->RdAheadCtr = p_cache->StatRdAheadCtr;
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+    p_stat->WrCtr      = p_cache->StatWrCtr;
+    p_stat->WrMultiCtr = p_cache->StatWrMultiCtr;
+#endif
+
+    FSCache_DataStatGet(&p_cache->DataMgmt, &p_stat->Mgmt);
+    FSCache_DataStatGet(&p_cache->DataDir,  &p_stat->Dir);
+    FSCache_DataStatGet(&p_cache->DataData, &p_stat->Data);
+
+   *p_err = FS_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1027,7 +1284,7 @@ static  void  FSCache_Flush (FS_VOL  *p_vol,
 
 /*
 *********************************************************************************************************
-*                                               FSCache_DataInit()
+*                                         FSCache_DataInit()
 *
 * Description : Initialize the data cache structure.
 *
@@ -1040,36 +1297,112 @@ static  void  FSCache_Flush (FS_VOL  *p_vol,
 *               p_buf_ptrs      Pointer to the start address of cache data buffers
 *               ----------      Argument validated by caller.
 *
+*               p_entry_tbl     Pointer to the entry table for this cache data.
+*               ----------      Argument validated by caller.
+*
+*               p_hash_tbl      Pointer to the hash table for this cache data.
+*               ----------      Argument validated by caller.
+*
 *               size            Number of data cache buffer
 *
 * Return(s)   : none.
 *
 * Caller(s)   : FSCache_Create(),
 *
-* Note(s)     : none.
+* Note(s)     : (1) The entry table MUST have room for 'size' buffer entries plus the ghost entries, i.e.,
+*                   'size' + ceil('size' * FS_CACHE_A1OUT_PCT / 100) entries; the hash table MUST have
+*                   room for the smallest power of 2 not less than 'size' slots.
 *********************************************************************************************************
 */
 
-static  void  FSCache_DataInit (FS_VOL          *p_vol,
-                                FS_CACHE_DATA   *p_data_cache,
-                                FS_BUF         **p_buf_ptrs,
-                                FS_SEC_QTY       size)
+static  void  FSCache_DataInit (FS_VOL           *p_vol,
+                                FS_CACHE_DATA    *p_data_cache,
+                                FS_BUF          **p_buf_ptrs,
+                                FS_CACHE_ENTRY   *p_entry_tbl,
+                                FS_SEC_QTY       *p_hash_tbl,
+                                FS_SEC_QTY        size)
 {
     CPU_INT32U   i;
+    FS_SEC_QTY   hash_size;
     FS_BUF      *p_buf;
 
 
     p_data_cache->Size           =  size;
-    p_data_cache->NextBufToUseIx =  0u;
+    p_data_cache->GhostSize      = (size * FS_CACHE_A1OUT_PCT + (100u - 1u)) / 100u;
+    p_data_cache->A1inSizeMax    = (size * FS_CACHE_A1IN_PCT  + (100u - 1u)) / 100u;
     p_data_cache->BufUsedPtrs    =  p_buf_ptrs;
+    p_data_cache->EntryTbl       =  p_entry_tbl;
+    p_data_cache->HashTbl        =  p_hash_tbl;
+
+    hash_size = 1u;                                             /* Hash tbl size is pwr of 2 >= size (see Note #1).     */
+    while (hash_size < size) {
+        hash_size <<= 1;
+    }
+    p_data_cache->HashMask       =  hash_size - 1u;
+
     for (i = 0u; i < size; i++) {
          p_buf         = p_data_cache->BufUsedPtrs[i];
-         p_buf->State  = FS_BUF_STATE_NONE;
-         p_buf->Start  = (FS_SEC_NBR)(-1);
          p_buf->VolPtr = p_vol;
     }
+
+    FSCache_DataReset(p_data_cache);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FSCache_DataReset()
+*
+* Description : Free all buffers & ghosts of a cache data & empty its hash table.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_DataInit(),
+*               FSCache_EntriesInvalidate().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_DataReset (FS_CACHE_DATA  *p_cache_data)
+{
+    FS_SEC_QTY       entry_ix;
+    FS_SEC_QTY       hash_ix;
+    CPU_INT08U       q;
+    FS_CACHE_ENTRY  *p_entry;
+
+
+    for (q = 0u; q < FS_CACHE_Q_NBR; q++) {
+        p_cache_data->Q[q].Head = FS_CACHE_IX_NONE;
+        p_cache_data->Q[q].Tail = FS_CACHE_IX_NONE;
+        p_cache_data->Q[q].Cnt  = 0u;
+    }
+
+    if (p_cache_data->Size == 0u) {
+        return;
+    }
+
+    for (hash_ix = 0u; hash_ix <= p_cache_data->HashMask; hash_ix++) {
+        p_cache_data->HashTbl[hash_ix] = FS_CACHE_IX_NONE;
+    }
+
+    for (entry_ix = 0u; entry_ix < p_cache_data->Size + p_cache_data->GhostSize; entry_ix++) {
+        p_entry           = &p_cache_data->EntryTbl[entry_ix];
+        p_entry->Start    = (FS_SEC_NBR)(-1);
+        p_entry->HashNext =  FS_CACHE_IX_NONE;
+        if (entry_ix < p_cache_data->Size) {
+            FSCache_BufFree(p_cache_data->BufUsedPtrs[entry_ix]);
+            FSCache_QIns(p_cache_data, FS_CACHE_Q_FREE,       entry_ix);
+        } else {
+            FSCache_QIns(p_cache_data, FS_CACHE_Q_GHOST_FREE, entry_ix);
+        }
+    }
 }
 
+
 /*
 *********************************************************************************************************
 *                                          FSCache_BufFree()
@@ -1081,9 +1414,8 @@ static  void  FSCache_DataInit (FS_VOL          *p_vol,
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FSCache_EntriesInvalidate(),
-*               FSCache_EntriesRelease(),
-*               FSCache_SecPut().
+* Caller(s)   : FSCache_DataReset(),
+*               FSCache_EntryRemove().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -1098,213 +1430,704 @@ static  void  FSCache_BufFree (FS_BUF  *p_buf)
 
 /*
 *********************************************************************************************************
-*                                     FSCache_EntriesInvalidate()
+*                                           FSCache_QIns()
 *
-* Description : Invalidate cache.
+* Description : Insert entry at the head of a queue.
 *
 * Argument(s) : p_cache_data    Pointer to cache data.
 *               ----------      Argument validated by caller.
 *
-*               p_cache         Pointer to cache.
-*               ----------      Argument validated by caller.
+*               q               Queue to insert into (FS_CACHE_Q_xxx).
+*
+*               entry_ix        Index of the entry, which MUST NOT be in any queue.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FSCache_Invalidate().
+* Caller(s)   : various.
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  FSCache_EntriesInvalidate (FS_CACHE_DATA  *p_cache_data,
-                                         FS_CACHE       *p_cache)
+static  void  FSCache_QIns (FS_CACHE_DATA  *p_cache_data,
+                            CPU_INT08U      q,
+                            FS_SEC_QTY      entry_ix)
 {
-    FS_BUF       *p_buf;
-    FS_BUF      **p_buf_ptr;
-    FS_SEC_QTY    buf_ix;
-
-
-    (void)&p_cache;
-
-    if (p_cache_data->Size == 0u) {
-        return;
-    }
+    FS_CACHE_Q      *p_q;
+    FS_CACHE_ENTRY  *p_entry;
 
-    p_buf_ptr = p_cache_data->BufUsedPtrs;
-    buf_ix    = 0u;
 
-    while (buf_ix < p_cache_data->Size) {
-        p_buf = *p_buf_ptr;
-        FSCache_BufFree(p_buf);
+    p_q           = &p_cache_data->Q[q];
+    p_entry       = &p_cache_data->EntryTbl[entry_ix];
 
-        buf_ix++;
-        p_buf_ptr++;
+    p_entry->Q    =  q;
+    p_entry->Prev =  FS_CACHE_IX_NONE;
+    p_entry->Next =  p_q->Head;
+    if (p_q->Head != FS_CACHE_IX_NONE) {
+        p_cache_data->EntryTbl[p_q->Head].Prev = entry_ix;
+    } else {
+        p_q->Tail = entry_ix;
     }
-
-    p_cache_data->NextBufToUseIx = 0u;
+    p_q->Head     =  entry_ix;
+    p_q->Cnt++;
 }
 
 
 /*
 *********************************************************************************************************
-*                                       FSCache_EntriesFlush()
+*                                          FSCache_QRemove()
 *
-* Description : Flush cache entries.
+* Description : Remove entry from the queue holding it.
 *
 * Argument(s) : p_cache_data    Pointer to cache data.
 *               ----------      Argument validated by caller.
 *
-*               p_dev           Pointer to device.
-*               ----------      Argument validated by caller.
-*
-*               p_err           Pointer to variable that will receive the return error code from this function :
-*               ----------      Argument validated by caller.
-*
-*                                   FS_ERR_NONE                   Cache flushed.
-*
-*                                                                 ----- RETURNED BY FSDev_WrLocked() ----
-*                                   FS_ERR_INVALID_SEC_NBR        Sector start or count invalid.
-*                                   FS_ERR_DEV_INVALID_LOW_FMT    Device needs to be low-level formatted.
-*                                   FS_ERR_DEV_IO                 Device I/O error.
-*                                   FS_ERR_DEV_TIMEOUT            Device timeout error.
-*                                   FS_ERR_DEV_NOT_PRESENT        Device is not present.
+*               entry_ix        Index of the entry.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FSCache_Flush().
+* Caller(s)   : various.
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
-static  void  FSCache_EntriesFlush (FS_VOL         *p_vol,
-                                    FS_CACHE_DATA  *p_cache_data,
-                                    FS_DEV         *p_dev,
-                                    FS_ERR         *p_err)
+static  void  FSCache_QRemove (FS_CACHE_DATA  *p_cache_data,
+                               FS_SEC_QTY      entry_ix)
 {
-    FS_SEC_QTY    buf_ix;
-    FS_BUF       *p_buf;
-    FS_BUF      **p_buf_ptr;
+    FS_CACHE_Q      *p_q;
+    FS_CACHE_ENTRY  *p_entry;
 
 
-    (void)&p_vol;
-    (void)&p_dev;
+    p_entry = &p_cache_data->EntryTbl[entry_ix];
+    p_q     = &p_cache_data->Q[p_entry->Q];
 
-    if (p_cache_data->Size == 0u) {
-        return;
+    if (p_entry->Prev != FS_CACHE_IX_NONE) {
+        p_cache_data->EntryTbl[p_entry->Prev].Next = p_entry->Next;
+    } else {
+        p_q->Head = p_entry->Next;
     }
-
-    p_buf_ptr = p_cache_data->BufUsedPtrs;
-    p_cache_data->NextBufToUseIx = 0u;
-    buf_ix    = 0u;
-    while (buf_ix < p_cache_data->Size) {
-        p_buf = *p_buf_ptr;
-
-        FSCache_EntryFlush(p_buf, p_err);
-        if (*p_err != FS_ERR_NONE) {
-            return;
-        }
-
-        buf_ix++;
-        p_buf_ptr++;
+    if (p_entry->Next != FS_CACHE_IX_NONE) {
+        p_cache_data->EntryTbl[p_entry->Next].Prev = p_entry->Prev;
+    } else {
+        p_q->Tail = p_entry->Prev;
     }
+    p_q->Cnt--;
 
-   *p_err = FS_ERR_NONE;
+    p_entry->Prev = FS_CACHE_IX_NONE;
+    p_entry->Next = FS_CACHE_IX_NONE;
 }
-#endif
-
-
 
 
 /*
 *********************************************************************************************************
-*                                      FSCache_EntriesRelease()
+*                                          FSCache_HashIns()
 *
-* Description : Flush cache entries.
+* Description : Insert entry into the hash table, keyed by its sector number.
 *
 * Argument(s) : p_cache_data    Pointer to cache data.
 *               ----------      Argument validated by caller.
 *
-*               p_cache         Pointer to cache.
-*               ----------      Argument validated by caller.
+*               entry_ix        Index of the entry.
 *
 * Return(s)   : none.
 *
-* Caller(s)   : FSCache_Release().
+* Caller(s)   : FSCache_EntryAlloc(),
+*               FSCache_GhostAdd().
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  FSCache_EntriesRelease (FS_CACHE_DATA  *p_cache_data,
-                                      FS_CACHE       *p_cache,
-                                      FS_SEC_NBR      start,
-                                      FS_SEC_QTY      cnt)
+static  void  FSCache_HashIns (FS_CACHE_DATA  *p_cache_data,
+                               FS_SEC_QTY      entry_ix)
 {
-    FS_BUF       *p_buf;
-    FS_BUF      **p_buf_ptr;
-    FS_SEC_QTY    buf_ix;
-
-
-    (void)&p_cache;
-
-    if (p_cache_data->Size == 0u) {
-        return;
-    }
-
-    p_buf_ptr = p_cache_data->BufUsedPtrs;
-    buf_ix    = 0u;
-
-    while (buf_ix < p_cache_data->Size) {
-        p_buf = *p_buf_ptr;
-
-        if ((p_buf->Start >= start) &&
-            (p_buf->Start < start + cnt)) {
-            FSCache_BufFree(p_buf);
-        }
+    FS_SEC_QTY       hash_ix;
+    FS_CACHE_ENTRY  *p_entry;
 
-        buf_ix++;
-        p_buf_ptr++;
-    }
 
+    p_entry                        = &p_cache_data->EntryTbl[entry_ix];
+    hash_ix                        = (FS_SEC_QTY)p_entry->Start & p_cache_data->HashMask;
+    p_entry->HashNext              =  p_cache_data->HashTbl[hash_ix];
+    p_cache_data->HashTbl[hash_ix] =  entry_ix;
 }
 
 
 /*
 *********************************************************************************************************
-*                                         FSCache_UpdateIndex()
+*                                         FSCache_HashRemove()
 *
-* Description : Get the next cache buffer index where data will be stored in the cache.
+* Description : Remove entry from the hash table.
 *
 * Argument(s) : p_cache_data    Pointer to cache data.
 *               ----------      Argument validated by caller.
 *
+*               entry_ix        Index of the entry, which MUST be in the hash table.
+*
 * Return(s)   : none.
 *
-* Caller(s)   : FSCache_SecPut().
+* Caller(s)   : FSCache_EntryRemove().
 *
 * Note(s)     : none.
 *********************************************************************************************************
 */
 
-static  void  FSCache_UpdateIndex (FS_CACHE_DATA  *p_cache_data)
+static  void  FSCache_HashRemove (FS_CACHE_DATA  *p_cache_data,
+                                  FS_SEC_QTY      entry_ix)
 {
-    p_cache_data->NextBufToUseIx++;
-    if (p_cache_data->NextBufToUseIx >= p_cache_data->Size) {
-        p_cache_data->NextBufToUseIx = 0u;
+    FS_SEC_QTY       hash_ix;
+    FS_SEC_QTY      *p_link;
+    FS_CACHE_ENTRY  *p_entry;
+
+
+    p_entry = &p_cache_data->EntryTbl[entry_ix];
+    hash_ix = (FS_SEC_QTY)p_entry->Start & p_cache_data->HashMask;
+    p_link  = &p_cache_data->HashTbl[hash_ix];
+
+    while (*p_link != FS_CACHE_IX_NONE) {
+        if (*p_link == entry_ix) {
+           *p_link            = p_entry->HashNext;
+            p_entry->HashNext = FS_CACHE_IX_NONE;
+            return;
+        }
+        p_link = &p_cache_data->EntryTbl[*p_link].HashNext;
     }
 }
 
 
 /*
 *********************************************************************************************************
-*                                          FSCache_EntryFlush()
+*                                        FSCache_EntryRemove()
 *
-* Description : Flush cache buffer through device layer.
+* Description : Drop a buffer or a ghost from the cache & return it to the matching free queue.
 *
-* Argument(s) : p_buf       Pointer to a buffer. Must be a cache buffer.
-*               ----------  Argument validated by caller.
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               entry_ix        Index of the entry, which MUST be in use.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_EntriesRelease(),
+*               FSCache_EntryAlloc(),
+*               FSCache_GhostAdd().
+*
+* Note(s)     : (1) A dirty buffer is dropped without being written; the caller must flush it first if its
+*                   contents are still needed.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_EntryRemove (FS_CACHE_DATA  *p_cache_data,
+                                   FS_SEC_QTY      entry_ix)
+{
+    FS_CACHE_ENTRY  *p_entry;
+
+
+    p_entry = &p_cache_data->EntryTbl[entry_ix];
+
+    FSCache_HashRemove(p_cache_data, entry_ix);
+    FSCache_QRemove(p_cache_data, entry_ix);
+    p_entry->Start = (FS_SEC_NBR)(-1);
+
+    if (entry_ix < p_cache_data->Size) {
+        FSCache_BufFree(p_cache_data->BufUsedPtrs[entry_ix]);
+        FSCache_QIns(p_cache_data, FS_CACHE_Q_FREE,       entry_ix);
+    } else {
+        FSCache_QIns(p_cache_data, FS_CACHE_Q_GHOST_FREE, entry_ix);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSCache_EntryTouch()
+*
+* Description : Record a reference to a buffer found in the cache.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               entry_ix        Index of the buffer entry.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_SecGet(),
+*               FSCache_SecPut().
+*
+* Note(s)     : (1) A buffer in A1in is NOT moved (see 'LOCAL DEFINES  Note #1a'); a buffer in Am moves to
+*                   the head of the LRU list.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_EntryTouch (FS_CACHE_DATA  *p_cache_data,
+                                  FS_SEC_QTY      entry_ix)
+{
+    if (p_cache_data->EntryTbl[entry_ix].Q != FS_CACHE_Q_AM) {  /* See Note #1.                                         */
+        return;
+    }
+
+    if (p_cache_data->Q[FS_CACHE_Q_AM].Head != entry_ix) {
+        FSCache_QRemove(p_cache_data, entry_ix);
+        FSCache_QIns(p_cache_data, FS_CACHE_Q_AM, entry_ix);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FSCache_EntryAlloc()
+*
+* Description : Allocate a buffer for a sector that is NOT in the cache.
+*
+* Argument(s) : p_cache         Pointer to cache.
+*               ----------      Argument validated by caller.
+*
+*               p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               start           Sector number.
+*
+* Return(s)   : Index of the buffer entry, hashed & queued, with the buffer in state FS_BUF_STATE_USED.
+*               FS_CACHE_IX_NONE if the victim buffer could NOT be flushed.
+*
+* Caller(s)   : FSCache_SecPut().
+*
+* Note(s)     : (1) See 'LOCAL DEFINES  Note #1' for the choice of the victim & the destination queue.
+*
+*               (2) In write back mode, the victim is flushed before being reused, together with the dirty
+*                   buffers holding the sectors that surround it (see 'LOCAL DEFINES  Note #4a').  On
+*                   failure, the victim stays in the cache & the new sector is not cached.
+*********************************************************************************************************
+*/
+
+static  FS_SEC_QTY  FSCache_EntryAlloc (FS_CACHE       *p_cache,
+                                        FS_CACHE_DATA  *p_cache_data,
+                                        FS_SEC_NBR      start)
+{
+    FS_SEC_QTY   entry_ix;
+    FS_SEC_QTY   ghost_ix;
+    CPU_INT08U   q;
+    CPU_BOOLEAN  from_a1in;
+    FS_BUF      *p_buf;
+    FS_ERR       err;
+
+
+                                                                /* --------------------- CHK GHOST -------------------- */
+    q        = FS_CACHE_Q_A1IN;
+    ghost_ix = FSCache_EntryFind(p_cache_data, start);
+    if (ghost_ix != FS_CACHE_IX_NONE) {                         /* Sec recently evicted from A1in ...                   */
+        q = FS_CACHE_Q_AM;                                      /*                                ... promote to Am.    */
+        FS_CTR_STAT_INC(p_cache_data->StatGhostHitCtr);
+        FSCache_EntryRemove(p_cache_data, ghost_ix);            /* Ghost no longer needed.                              */
+    }
+
+                                                                /* -------------------- CHOOSE VICTIM ----------------- */
+    from_a1in = DEF_NO;
+    if (p_cache_data->Q[FS_CACHE_Q_FREE].Cnt > 0u) {
+        entry_ix = p_cache_data->Q[FS_CACHE_Q_FREE].Tail;
+
+    } else if ((p_cache_data->Q[FS_CACHE_Q_A1IN].Cnt > p_cache_data->A1inSizeMax) ||
+               (p_cache_data->Q[FS_CACHE_Q_AM].Cnt   == 0u)) {
+        entry_ix  = p_cache_data->Q[FS_CACHE_Q_A1IN].Tail;
+        from_a1in = DEF_YES;
+
+    } else {
+        entry_ix  = p_cache_data->Q[FS_CACHE_Q_AM].Tail;
+    }
+
+    p_buf = p_cache_data->BufUsedPtrs[entry_ix];
+    if (p_cache_data->EntryTbl[entry_ix].Q != FS_CACHE_Q_FREE) {
+        FS_CTR_STAT_INC(p_cache->StatRemoveCtr);
+        if (p_cache->Mode == FS_VOL_CACHE_MODE_WR_BACK) {       /* Flush victim (see Note #2).                          */
+            FSCache_EntryRunFlush(p_cache, p_cache_data, entry_ix, &err);
+            if (err != FS_ERR_NONE) {
+                return (FS_CACHE_IX_NONE);
+            }
+        }
+        FS_CTR_STAT_INC(p_cache_data->StatEvictCtr);
+        if (from_a1in == DEF_YES) {
+            FSCache_GhostAdd(p_cache_data, p_cache_data->EntryTbl[entry_ix].Start);
+        }
+        FSCache_EntryRemove(p_cache_data, entry_ix);
+    }
+
+                                                                /* ---------------------- USE BUF --------------------- */
+    FSCache_QRemove(p_cache_data, entry_ix);
+    p_cache_data->EntryTbl[entry_ix].Start = start;
+    FSCache_HashIns(p_cache_data, entry_ix);
+    FSCache_QIns(p_cache_data, q, entry_ix);
+
+    p_buf->Start = start;
+    p_buf->State = FS_BUF_STATE_USED;
+    FS_CTR_STAT_INC(p_cache->StatAllocCtr);
+
+    return (entry_ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         FSCache_GhostAdd()
+*
+* Description : Remember the sector number of a buffer evicted from A1in.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               start           Sector number.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_EntryAlloc().
+*
+* Note(s)     : (1) When A1out is full, its oldest ghost is reused.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_GhostAdd (FS_CACHE_DATA  *p_cache_data,
+                                FS_SEC_NBR      start)
+{
+    FS_SEC_QTY  ghost_ix;
+
+
+    if (p_cache_data->GhostSize == 0u) {
+        return;
+    }
+
+    if (p_cache_data->Q[FS_CACHE_Q_GHOST_FREE].Cnt == 0u) {     /* See Note #1.                                         */
+        FSCache_EntryRemove(p_cache_data, p_cache_data->Q[FS_CACHE_Q_A1OUT].Tail);
+    }
+
+    ghost_ix = p_cache_data->Q[FS_CACHE_Q_GHOST_FREE].Tail;
+    FSCache_QRemove(p_cache_data, ghost_ix);
+    p_cache_data->EntryTbl[ghost_ix].Start = start;
+    FSCache_HashIns(p_cache_data, ghost_ix);
+    FSCache_QIns(p_cache_data, FS_CACHE_Q_A1OUT, ghost_ix);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSCache_RdMiss()
+*
+* Description : Read a run of sectors missed in the cache from the device & put them in the cache.
+*
+* Argument(s) : p_vol       Pointer to volume.
+*               ----------  Argument validated by caller.
+*
+*               p_cache     Pointer to cache.
+*               ----------  Argument validated by caller.
+*
+*               p_dest      Pointer to destination buffer.
+*               ----------  Argument validated by caller.
+*
+*               start       Start sector of read.
+*
+*               cnt         Number of sectors to read.
+*
+*               sec_type    Type of sector :
+*
+*                               FS_VOL_SEC_TYPE_MGMT    Management sector.
+*                               FS_VOL_SEC_TYPE_DIR     Directory sector.
+*                               FS_VOL_SEC_TYPE_FILE    File sector.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*               ----------  Argument validated by caller.
+*
+*                               FS_ERR_NONE                   Sector(s) read.
+*
+*                                                             ------- RETURNED BY FSDev_RdLocked() ------
+*                               FS_ERR_DEV_INVALID_LOW_FMT    Device needs to be low-level formatted.
+*                               FS_ERR_DEV_IO                 Device I/O error.
+*                               FS_ERR_DEV_TIMEOUT            Device timeout error.
+*                               FS_ERR_DEV_NOT_PRESENT        Device is not present.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_Rd().
+*
+* Note(s)     : (1) See 'LOCAL DEFINES  Note #4b'.  The run & the sectors read ahead are read into the
+*                   transfer buffer with a single device access.
+*
+*               (2) The window is bounded :
+*
+*                   (a) by the transfer buffer;
+*                   (b) by the A1in share of the data buffers, so that sectors read ahead are NOT evicted
+*                       by the sectors read ahead after them;
+*                   (c) by the end of the partition;
+*                   (d) by the first sector already held by a data buffer, which may be dirty.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_RdMiss (FS_VOL      *p_vol,
+                              FS_CACHE    *p_cache,
+                              CPU_INT08U  *p_dest,
+                              FS_SEC_NBR   start,
+                              FS_SEC_QTY   cnt,
+                              FS_FLAGS     sec_type,
+                              FS_ERR      *p_err)
+{
+    FS_CACHE_DATA  *p_cache_data;
+    CPU_INT08U     *p_rd;
+    FS_SEC_QTY      ahead_cnt;
+    FS_SEC_QTY      ahead_max;
+    FS_SEC_QTY      ix;
+
+
+                                                                /* ---------------- SIZE RD-AHEAD WIN ----------------- */
+    ahead_cnt    = 0u;
+    p_cache_data = &p_cache->DataData;
+    if ((sec_type          == FS_VOL_SEC_TYPE_FILE) &&
+        (p_cache_data->Size > 0u)) {
+        if (start == p_cache->RdAheadNext) {                    /* Sequential miss: open or grow win (see Note #1).     */
+            if (p_cache->RdAheadWin == 0u) {
+                p_cache->RdAheadWin  = FS_CACHE_RD_AHEAD_WIN_MIN;
+            } else if (p_cache->RdAheadWin < p_cache->XferSize) {
+                p_cache->RdAheadWin *= 2u;
+            } else {
+                ;
+            }
+        } else {
+            p_cache->RdAheadWin = 0u;                           /* Non-sequential miss: close win.                      */
+        }
+
+        ahead_cnt = p_cache->RdAheadWin;                        /* Bound win (see Note #2).                             */
+        ahead_max = (p_cache->XferSize > cnt) ? (p_cache->XferSize - cnt) : 0u;
+        if (ahead_cnt > ahead_max) {
+            ahead_cnt = ahead_max;
+        }
+        ahead_max = (p_cache_data->A1inSizeMax + 1u > cnt) ? (p_cache_data->A1inSizeMax + 1u - cnt) : 0u;
+        if (ahead_cnt > ahead_max) {
+            ahead_cnt = ahead_max;
+        }
+        ahead_max = (p_vol->PartitionSize > start + cnt) ? (FS_SEC_QTY)(p_vol->PartitionSize - (start + cnt)) : 0u;
+        if (ahead_cnt > ahead_max) {
+            ahead_cnt = ahead_max;
+        }
+        for (ix = 0u; ix < ahead_cnt; ix++) {
+            if (FSCache_EntryFind(p_cache_data, start + cnt + ix) < p_cache_data->Size) {
+                break;
+            }
+        }
+        ahead_cnt = ix;
+
+        p_cache->RdAheadNext = start + cnt + ahead_cnt;
+    }
+
+
+
+                                                                /* ------------------- RD FROM DEV -------------------- */
+    p_rd = (ahead_cnt > 0u) ? p_cache->XferBufPtr : p_dest;
+    FSDev_RdLocked(p_vol->DevPtr,
+                   p_rd,
+                   start + p_vol->PartitionStart,
+                   cnt   + ahead_cnt,
+                   p_err);
+    if (*p_err != FS_ERR_NONE) {
+        return;
+    }
+
+    if (ahead_cnt > 0u) {
+        Mem_Copy(p_dest, p_rd, (CPU_SIZE_T)cnt * p_cache->SecSize);
+        FS_CTR_STAT_ADD(p_cache->StatRdAheadCtr, (FS_CTR)ahead_cnt);
+    }
+
+
+
+                                                                /* ------------------- PUT IN CACHE ------------------- */
+    for (ix = 0u; ix < cnt + ahead_cnt; ix++) {
+       (void)FSCache_SecPut(p_cache,
+                            p_rd,
+                            start + ix,
+                            sec_type,
+                            DEF_YES);
+        p_rd += p_cache->SecSize;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     FSCache_EntriesInvalidate()
+*
+* Description : Invalidate cache.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               p_cache         Pointer to cache.
+*               ----------      Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_Invalidate().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_EntriesInvalidate (FS_CACHE_DATA  *p_cache_data,
+                                         FS_CACHE       *p_cache)
+{
+    (void)&p_cache;
+
+    if (p_cache_data->Size == 0u) {
+        return;
+    }
+
+    FSCache_DataReset(p_cache_data);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FSCache_EntriesFlush()
+*
+* Description : Flush cache entries.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               p_dev           Pointer to device.
+*               ----------      Argument validated by caller.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*               ----------      Argument validated by caller.
+*
+*                                   FS_ERR_NONE                   Cache flushed.
+*
+*                                                                 ----- RETURNED BY FSDev_WrLocked() ----
+*                                   FS_ERR_INVALID_SEC_NBR        Sector start or count invalid.
+*                                   FS_ERR_DEV_INVALID_LOW_FMT    Device needs to be low-level formatted.
+*                                   FS_ERR_DEV_IO                 Device I/O error.
+*                                   FS_ERR_DEV_TIMEOUT            Device timeout error.
+*                                   FS_ERR_DEV_NOT_PRESENT        Device is not present.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_Flush().
+*
+* Note(s)     : (1) Flushed buffers stay cached & keep their queue position.
+*
+*               (2) Each dirty buffer is flushed with the run of contiguous dirty sectors holding it, so
+*                   the other buffers of the run are found clean when reached.
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+static  void  FSCache_EntriesFlush (FS_VOL         *p_vol,
+                                    FS_CACHE_DATA  *p_cache_data,
+                                    FS_DEV         *p_dev,
+                                    FS_ERR         *p_err)
+{
+    FS_SEC_QTY   buf_ix;
+    FS_CACHE    *p_cache;
+
+
+    (void)&p_dev;
+
+    if (p_cache_data->Size == 0u) {
+        return;
+    }
+
+    p_cache = (FS_CACHE *)p_vol->CacheDataPtr;
+    buf_ix  =  0u;
+    while (buf_ix < p_cache_data->Size) {
+        FSCache_EntryRunFlush(p_cache,                          /* See Note #2.                                         */
+                              p_cache_data,
+                              buf_ix,
+                              p_err);
+        if (*p_err != FS_ERR_NONE) {
+            return;
+        }
+
+        buf_ix++;
+    }
+
+   *p_err = FS_ERR_NONE;
+}
+#endif
+
+
+
+
+/*
+*********************************************************************************************************
+*                                      FSCache_EntriesRelease()
+*
+* Description : Remove a range of sectors from the cache.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               p_cache         Pointer to cache.
+*               ----------      Argument validated by caller.
+*
+*               start           Start sector of release.
+*
+*               cnt             Number of sectors to release.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_Release(),
+*               FSCache_Wr().
+*
+* Note(s)     : (1) Short ranges are looked up sector by sector in the hash table; ranges at least as
+*                   large as the cache data are handled by scanning the buffers & ghosts.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_EntriesRelease (FS_CACHE_DATA  *p_cache_data,
+                                      FS_CACHE       *p_cache,
+                                      FS_SEC_NBR      start,
+                                      FS_SEC_QTY      cnt)
+{
+    FS_SEC_QTY       entry_ix;
+    FS_SEC_QTY       entry_cnt;
+    FS_SEC_NBR       sec;
+    FS_CACHE_ENTRY  *p_entry;
+
+
+    (void)&p_cache;
+
+    if (p_cache_data->Size == 0u) {
+        return;
+    }
+
+    entry_cnt = p_cache_data->Size + p_cache_data->GhostSize;
+
+    if (cnt < entry_cnt) {                                      /* See Note #1.                                         */
+        for (sec = start; sec < start + cnt; sec++) {
+            entry_ix = FSCache_EntryFind(p_cache_data, sec);
+            if (entry_ix != FS_CACHE_IX_NONE) {
+                FSCache_EntryRemove(p_cache_data, entry_ix);
+            }
+        }
+        return;
+    }
+
+    for (entry_ix = 0u; entry_ix < entry_cnt; entry_ix++) {
+        p_entry = &p_cache_data->EntryTbl[entry_ix];
+        if ((p_entry->Q     != FS_CACHE_Q_FREE)       &&
+            (p_entry->Q     != FS_CACHE_Q_GHOST_FREE) &&
+            (p_entry->Start >= start)                 &&
+            (p_entry->Start <  start + cnt)) {
+            FSCache_EntryRemove(p_cache_data, entry_ix);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          FSCache_EntryFlush()
+*
+* Description : Flush cache buffer through device layer.
+*
+* Argument(s) : p_buf       Pointer to a buffer. Must be a cache buffer.
+*               ----------  Argument validated by caller.
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *               ----------  Argument validated by caller.
@@ -1325,7 +2148,7 @@ static  void  FSCache_UpdateIndex (FS_CACHE_DATA  *p_cache_data)
 *               This function is an INTERNAL file system suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) A flushed buffer is clean but still valid, so it stays in the cache.
 *********************************************************************************************************
 */
 
@@ -1348,10 +2171,153 @@ static  void  FSCache_EntryFlush(FS_BUF  *p_buf,
         if (*p_err != FS_ERR_NONE) {
             return;
         }
+
+        p_buf->State = FS_BUF_STATE_USED;                       /* Update buf state (see Note #1).                      */
     }
 #endif
 
-    p_buf->State = FS_BUF_STATE_NONE;                           /* Update buf state.                                    */
+   *p_err = FS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       FSCache_EntryRunFlush()
+*
+* Description : Flush a cache buffer with the run of contiguous dirty sectors holding it.
+*
+* Argument(s) : p_cache         Pointer to cache.
+*               ----------      Argument validated by caller.
+*
+*               p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               entry_ix        Index of the buffer entry.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*               ----------      Argument validated by caller.
+*
+*                                   FS_ERR_NONE                   Buffer(s) flushed.
+*
+*                                                                 ----- RETURNED BY FSDev_WrLocked() ----
+*                                   FS_ERR_DEV_INVALID_LOW_FMT    Device needs to be low-level formatted.
+*                                   FS_ERR_DEV_IO                 Device I/O error.
+*                                   FS_ERR_DEV_TIMEOUT            Device timeout error.
+*                                   FS_ERR_DEV_NOT_PRESENT        Device is not present.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_EntriesFlush(),
+*               FSCache_EntryAlloc().
+*
+* Note(s)     : (1) See 'LOCAL DEFINES  Note #4a'.  The run is found by looking up the neighbouring
+*                   sectors in the hash table; its head is searched first, then the run is copied into
+*                   the transfer buffer & written from the head on, one transfer buffer at a time.
+*
+*               (2) A run of a single sector is written directly from its buffer.
+*
+*               (3) On failure, the buffers of the sectors NOT written stay dirty.
+*********************************************************************************************************
+*/
+
+static  void  FSCache_EntryRunFlush (FS_CACHE       *p_cache,
+                                     FS_CACHE_DATA  *p_cache_data,
+                                     FS_SEC_QTY      entry_ix,
+                                     FS_ERR         *p_err)
+{
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+    FS_BUF      *p_buf;
+    FS_BUF      *p_buf_head;
+    FS_VOL      *p_vol;
+    CPU_INT08U  *p_xfer;
+    FS_SEC_NBR   sec_head;
+    FS_SEC_QTY   sec_cnt;
+    FS_SEC_QTY   ix;
+#endif
+
+
+#if (FS_CFG_RD_ONLY_EN == DEF_DISABLED)
+    p_buf = p_cache_data->BufUsedPtrs[entry_ix];
+    if (p_buf->State != FS_BUF_STATE_DIRTY) {
+       *p_err = FS_ERR_NONE;
+        return;
+    }
+
+    if (p_cache->XferSize == 0u) {                              /* No xfer buf: flush single sec.                       */
+        FSCache_EntryFlush(p_buf, p_err);
+        return;
+    }
+
+                                                                /* ------------------- FIND RUN HEAD ------------------ */
+    sec_head = p_buf->Start;
+    while (sec_head > 0u) {
+        ix = FSCache_EntryFind(p_cache_data, sec_head - 1u);
+        if (ix >= p_cache_data->Size) {                         /* Prev sec not buf'd ...                               */
+            break;
+        }
+        if (p_cache_data->BufUsedPtrs[ix]->State != FS_BUF_STATE_DIRTY) {
+            break;                                              /*                    ... or clean.                     */
+        }
+        sec_head--;
+    }
+
+                                                                /* ---------------------- WR RUN ---------------------- */
+    p_vol = p_buf->VolPtr;
+    do {
+        p_buf_head = (FS_BUF *)0;
+        p_xfer     =  p_cache->XferBufPtr;
+        sec_cnt    =  0u;
+        while (sec_cnt < p_cache->XferSize) {                   /* Copy run into xfer buf.                              */
+            ix = FSCache_EntryFind(p_cache_data, sec_head + sec_cnt);
+            if (ix >= p_cache_data->Size) {
+                break;
+            }
+            p_buf = p_cache_data->BufUsedPtrs[ix];
+            if (p_buf->State != FS_BUF_STATE_DIRTY) {
+                break;
+            }
+            if (sec_cnt == 0u) {
+                p_buf_head = p_buf;
+            }
+            Mem_Copy(p_xfer, p_buf->DataPtr, p_cache->SecSize);
+            p_xfer += p_cache->SecSize;
+            sec_cnt++;
+        }
+
+        if (sec_cnt == 0u) {
+            break;
+        }
+
+        if (sec_cnt == 1u) {                                    /* See Note #2.                                         */
+            FSCache_EntryFlush(p_buf_head, p_err);
+            if (*p_err != FS_ERR_NONE) {
+                return;
+            }
+
+        } else {
+            FSDev_WrLocked(p_vol->DevPtr,                       /* Wr run.                                              */
+                           p_cache->XferBufPtr,
+                           sec_head + p_vol->PartitionStart,
+                           sec_cnt,
+                           p_err);
+            if (*p_err != FS_ERR_NONE) {                        /* See Note #3.                                         */
+                return;
+            }
+            FS_CTR_STAT_INC(p_cache->StatWrMultiCtr);
+
+            for (ix = 0u; ix < sec_cnt; ix++) {                 /* Mark run bufs clean.                                 */
+                entry_ix = FSCache_EntryFind(p_cache_data, sec_head + ix);
+                p_cache_data->BufUsedPtrs[entry_ix]->State = FS_BUF_STATE_USED;
+            }
+        }
+
+        sec_head += sec_cnt;
+    } while (sec_cnt == p_cache->XferSize);
+#else
+    (void)&p_cache;
+    (void)&p_cache_data;
+    (void)&entry_ix;
+#endif
 
    *p_err = FS_ERR_NONE;
 }
@@ -1367,43 +2333,37 @@ static  void  FSCache_EntryFlush(FS_BUF  *p_buf,
 *
 *               start           Start sector.
 *
-* Return(s)   : pointer to buffer adresses
-*               NULL pointer if not found
+* Return(s)   : Index of the buffer or ghost entry holding the sector, if found.
+*               FS_CACHE_IX_NONE, otherwise.
 *
-* Caller(s)   : FSCache_SecGet().
+* Caller(s)   : FSCache_EntriesRelease(),
+*               FSCache_EntryAlloc(),
+*               FSCache_SecGet(),
+*               FSCache_SecPut().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Indices below 'Size' are buffers; others are A1out ghosts, which hold no data.
 *********************************************************************************************************
 */
 
-static  FS_BUF  **FSCache_EntryFind (FS_CACHE_DATA  *p_cache_data,
-                                     FS_SEC_NBR      start)
+static  FS_SEC_QTY  FSCache_EntryFind (FS_CACHE_DATA  *p_cache_data,
+                                       FS_SEC_NBR      start)
 {
-    FS_BUF       *p_buf;
-    FS_BUF      **p_buf_ptr;
-    FS_SEC_QTY    buf_ix;
+    FS_SEC_QTY  entry_ix;
 
 
     if (p_cache_data->Size == 0u) {
-        return ((FS_BUF **)0);
+        return (FS_CACHE_IX_NONE);
     }
 
-    p_buf_ptr = p_cache_data->BufUsedPtrs;
-    buf_ix    = 0u;
-
-    while (buf_ix < p_cache_data->Size) {
-        p_buf = *p_buf_ptr;
-
-        if (p_buf->Start == start) {
-            p_buf_ptr = &p_cache_data->BufUsedPtrs[buf_ix];
-            return (p_buf_ptr);
+    entry_ix = p_cache_data->HashTbl[(FS_SEC_QTY)start & p_cache_data->HashMask];
+    while (entry_ix != FS_CACHE_IX_NONE) {
+        if (p_cache_data->EntryTbl[entry_ix].Start == start) {
+            return (entry_ix);
         }
-
-        buf_ix++;
-        p_buf_ptr++;
+        entry_ix = p_cache_data->EntryTbl[entry_ix].HashNext;
     }
 
-    return ((FS_BUF **)0);
+    return (FS_CACHE_IX_NONE);
 }
 
 
@@ -1426,35 +2386,9 @@ static  FS_BUF  **FSCache_EntryFind (FS_CACHE_DATA  *p_cache_data,
 
 static  void  FSCache_ObjClr (FS_CACHE  *p_cache)
 {
-    p_cache->Mode                     =  FS_VOL_CACHE_MODE_NONE;
-    p_cache->SecSize                  =  0u;
-    p_cache->Size                     =  0u;
-
-    p_cache->DataMgmt.Size            =  0u;
-    p_cache->DataMgmt.NextBufToUseIx  =  0u;
-    p_cache->DataMgmt.BufUsedPtrs     = (FS_BUF **)0;
-
-    p_cache->DataDir.Size             =  0u;
-    p_cache->DataDir.NextBufToUseIx   =  0u;
-    p_cache->DataDir.BufUsedPtrs      = (FS_BUF **)0;
-
-    p_cache->DataData.Size            =  0u;
-    p_cache->DataData.NextBufToUseIx  =  0u;
-    p_cache->DataData.BufUsedPtrs     = (FS_BUF **)0;
+    Mem_Clr((void *)p_cache, sizeof(FS_CACHE));
 
-#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
-    p_cache->StatHitCtr               =  0u;
-    p_cache->StatMissCtr              =  0u;
-    p_cache->StatRemoveCtr            =  0u;
-    p_cache->StatAllocCtr             =  0u;
-    p_cache->StatUpdateCtr            =  0u;
-    p_cache->StatRdCtr                =  0u;
-    p_cache->StatRdAvoidCtr           =  0u;
-#if (FS_CFG_RD_ONLY_EN  == DEF_DISABLED)
-    p_cache->StatWrCtr                =  0u;
-    p_cache->StatWrAvoidCtr           =  0u;
-#endif
-#endif
+    p_cache->Mode = FS_VOL_CACHE_MODE_NONE;
 }
 
 
@@ -1493,32 +2427,30 @@ static  CPU_BOOLEAN  FSCache_SecGet (FS_CACHE    *p_cache,
                                      FS_FLAGS     sec_type)
 {
     FS_BUF          *p_buf;
-    FS_BUF         **p_buf_ptr;
+    FS_SEC_QTY       entry_ix;
     FS_CACHE_DATA   *p_cache_data;
 
 
                                                                 /* ---------------- FIND ENTRY IN CACHE --------------- */
     p_cache_data = FSCache_GetData(p_cache, sec_type);
     if (p_cache_data == (FS_CACHE_DATA *)0) {
-        p_buf_ptr = (FS_BUF **)0;
-    } else {
-        p_buf_ptr = FSCache_EntryFind(p_cache_data, start);
-    }
-
-
-    if (p_buf_ptr == (FS_BUF **)0) {
         FS_CTR_STAT_INC(p_cache->StatMissCtr);
         return (DEF_NO);
     }
 
-    p_buf = *p_buf_ptr;
-
-    if (p_buf->State == FS_BUF_STATE_NONE) {
+    entry_ix = FSCache_EntryFind(p_cache_data, start);
+    if ((entry_ix == FS_CACHE_IX_NONE) ||                       /* If sec NOT found ...                                 */
+        (entry_ix >= p_cache_data->Size)) {                     /*               ... or only a ghost.                   */
         FS_CTR_STAT_INC(p_cache->StatMissCtr);
+        FS_CTR_STAT_INC(p_cache_data->StatMissCtr);
         return (DEF_NO);
     }
 
+    p_buf = p_cache_data->BufUsedPtrs[entry_ix];
+
     FS_CTR_STAT_INC(p_cache->StatHitCtr);
+    FS_CTR_STAT_INC(p_cache_data->StatHitCtr);
+    FSCache_EntryTouch(p_cache_data, entry_ix);
     Mem_Copy(p_dest, p_buf->DataPtr, p_cache->SecSize);
 
     return (DEF_YES);
@@ -1560,7 +2492,7 @@ static  CPU_BOOLEAN  FSCache_SecGet (FS_CACHE    *p_cache,
 *               This function is an INTERNAL file system suite function & MUST NOT be called by
 *               application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) A sector put after a read miss was already counted as a miss by FSCache_SecGet().
 *********************************************************************************************************
 */
 
@@ -1572,9 +2504,8 @@ static  CPU_BOOLEAN  FSCache_SecPut (FS_CACHE     *p_cache,
 {
     CPU_BOOLEAN      update;
     FS_BUF          *p_buf;
-    FS_BUF         **p_buf_ptr;
+    FS_SEC_QTY       entry_ix;
     FS_CACHE_DATA   *p_cache_data;
-    FS_ERR           err;
 
 
                                                                 /* -------------- VALIDATE CACHE FOR SEC -------------- */
@@ -1590,25 +2521,27 @@ static  CPU_BOOLEAN  FSCache_SecPut (FS_CACHE     *p_cache,
         return (update);
     }
 
-    p_buf_ptr = FSCache_EntryFind(p_cache_data, start);
+    entry_ix = FSCache_EntryFind(p_cache_data, start);
 
 
                                                                 /* ------------------- ALLOC NEW BUF ------------------ */
-    if (p_buf_ptr == (FS_BUF **)0) {
-        p_buf = p_cache_data->BufUsedPtrs[p_cache_data->NextBufToUseIx];
-        FS_CTR_STAT_INC(p_cache->StatRemoveCtr);
-        if (p_cache->Mode == FS_VOL_CACHE_MODE_WR_BACK) {
-            FSCache_EntryFlush(p_buf, &err);
-            if (err != FS_ERR_NONE) {
-                return (update);
-            }
+    if ((entry_ix == FS_CACHE_IX_NONE) ||
+        (entry_ix >= p_cache_data->Size)) {
+        if (rd == DEF_NO) {                                     /* See Note #1.                                         */
+            FS_CTR_STAT_INC(p_cache_data->StatMissCtr);
+        }
+        entry_ix = FSCache_EntryAlloc(p_cache, p_cache_data, start);
+        if (entry_ix == FS_CACHE_IX_NONE) {
+            return (update);
         }
-        p_buf->Start = start;
-        p_buf->State = FS_BUF_STATE_USED;
-        FSCache_UpdateIndex(p_cache_data);                      /* Update the cache entry index.                        */
+        p_buf = p_cache_data->BufUsedPtrs[entry_ix];
 
     } else{
-        p_buf = *p_buf_ptr;
+        if (rd == DEF_NO) {
+            FS_CTR_STAT_INC(p_cache_data->StatHitCtr);
+        }
+        p_buf = p_cache_data->BufUsedPtrs[entry_ix];
+        FSCache_EntryTouch(p_cache_data, entry_ix);
         FS_CTR_STAT_INC(p_cache->StatUpdateCtr);
     }
 
@@ -1628,6 +2561,42 @@ static  CPU_BOOLEAN  FSCache_SecPut (FS_CACHE     *p_cache,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        FSCache_DataStatGet()
+*
+* Description : Get statistics of a cache data.
+*
+* Argument(s) : p_cache_data    Pointer to cache data.
+*               ----------      Argument validated by caller.
+*
+*               p_stat          Pointer to structure that will receive the statistics.
+*               ----------      Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : FSCache_StatGet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+static  void  FSCache_DataStatGet (FS_CACHE_DATA           *p_cache_data,
+                                   FS_VOL_CACHE_DATA_STAT  *p_stat)
+{
+    p_stat->Size        = p_cache_data->Size;
+    p_stat->A1inCnt     = p_cache_data->Q[FS_CACHE_Q_A1IN].Cnt;
+    p_stat->AmCnt       = p_cache_data->Q[FS_CACHE_Q_AM].Cnt;
+    p_stat->A1outCnt    = p_cache_data->Q[FS_CACHE_Q_A1OUT].Cnt;
+    p_stat->HitCtr      = p_cache_data->StatHitCtr;
+    p_stat->MissCtr     = p_cache_data->StatMissCtr;
+    p_stat->GhostHitCtr = p_cache_data->StatGhostHitCtr;
+    p_stat->EvictCtr    = p_cache_data->StatEvictCtr;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           FSCache_GetData()
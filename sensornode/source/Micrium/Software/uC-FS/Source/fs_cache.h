@@ -54,6 +54,7 @@
 #include  <cpu.h>
 #include  <fs_cfg_fs.h>
 #include  <fs_err.h>
+#include  <fs_ctr.h>
 #include  <fs_type.h>
 
 
@@ -99,6 +100,43 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                  VOLUME CACHE STATISTICS DATA TYPES
+*
+* Note(s) : (1) The default cache keeps one set of statistics per sector type.  'A1inCnt', 'AmCnt' &
+*               'A1outCnt' are the current number of sectors referenced once, sectors referenced more than
+*               once & remembered evicted sectors (see 'fs_cache.c  LOCAL DEFINES  Note #1').
+*********************************************************************************************************
+*/
+
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+typedef  struct  fs_vol_cache_data_stat {
+    FS_SEC_QTY                Size;                             /* Nbr of bufs.                                         */
+    FS_SEC_QTY                A1inCnt;                          /* Nbr of bufs in A1in  (see Note #1).                  */
+    FS_SEC_QTY                AmCnt;                            /* Nbr of bufs in Am    (see Note #1).                  */
+    FS_SEC_QTY                A1outCnt;                         /* Nbr of secs in A1out (see Note #1).                  */
+    FS_CTR                    HitCtr;                           /* Nbr of lookups that found the sec.                   */
+    FS_CTR                    MissCtr;                          /* Nbr of lookups that did NOT find the sec.            */
+    FS_CTR                    GhostHitCtr;                      /* Nbr of misses on a sec remembered in A1out.          */
+    FS_CTR                    EvictCtr;                         /* Nbr of bufs evicted to make room.                    */
+} FS_VOL_CACHE_DATA_STAT;
+
+struct  fs_vol_cache_stat {
+    FS_SEC_QTY                Size;                             /* Nbr of bufs.                                         */
+    FS_CTR                    HitCtr;                           /* Nbr of rd hits.                                      */
+    FS_CTR                    MissCtr;                          /* Nbr of rd misses.                                    */
+    FS_CTR                    RdCtr;                            /* Nbr of secs rd from dev.                             */
+    FS_CTR                    WrCtr;                            /* Nbr of secs wr to dev.                               */
+    FS_CTR                    RdAheadCtr;                       /* Nbr of secs rd ahead of a sequential file rd.        */
+    FS_CTR                    WrMultiCtr;                       /* Nbr of multi-sec wrs issued when flushing.           */
+
+    FS_VOL_CACHE_DATA_STAT    Mgmt;                             /* Mgmt secs stats.                                     */
+    FS_VOL_CACHE_DATA_STAT    Dir;                              /* Dir  secs stats.                                     */
+    FS_VOL_CACHE_DATA_STAT    Data;                             /* File secs stats.                                     */
+};
+#endif
+
 /*
 *********************************************************************************************************
 *                                     VOLUME CACHE API DATA TYPE
@@ -144,6 +182,12 @@ struct  fs_vol_cache_api {
 
     void  (*Flush)     (FS_VOL       *p_vol,                    /* Flush cache.                                         */
                         FS_ERR       *p_err);
+
+#if (FS_CFG_CTR_STAT_EN == DEF_ENABLED)
+    void  (*StatGet)   (FS_VOL             *p_vol,              /* Get cache stats (optional, may be NULL).             */
+                        FS_VOL_CACHE_STAT  *p_stat,
+                        FS_ERR             *p_err);
+#endif
 };
 
 
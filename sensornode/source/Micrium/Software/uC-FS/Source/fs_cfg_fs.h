@@ -266,6 +266,19 @@
 #endif
 
 
+                                                                /* ------------ FS_CFG_CACHE_MULTI_SEC_MAX ------------ */
+#if     (FS_CFG_CACHE_EN == DEF_ENABLED)
+#ifndef  FS_CFG_CACHE_MULTI_SEC_MAX
+#error  "FS_CFG_CACHE_MULTI_SEC_MAX                   not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+
+#elif   (FS_CFG_CACHE_MULTI_SEC_MAX < 1u)
+#error  "FS_CFG_CACHE_MULTI_SEC_MAX             illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   FILE SYSTEM NAME CONFIGURATION
@@ -552,6 +565,133 @@
 #error  "                                       [MUST be  DEF_DISABLED]                         "
 #endif
 
+
+                                                                /* ------------ FS_FAT_CFG_JOURNAL_GROUP_EN ----------- */
+#ifndef  FS_FAT_CFG_JOURNAL_GROUP_EN
+#error  "FS_FAT_CFG_JOURNAL_GROUP_EN                  not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif  ((FS_FAT_CFG_JOURNAL_GROUP_EN != DEF_DISABLED) && \
+        (FS_FAT_CFG_JOURNAL_GROUP_EN != DEF_ENABLED ))
+#error  "FS_FAT_CFG_JOURNAL_GROUP_EN            illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif   (FS_FAT_CFG_JOURNAL_GROUP_EN == DEF_ENABLED)
+#ifndef  FS_FAT_CFG_JOURNAL_GROUP_SIZE
+#error  "FS_FAT_CFG_JOURNAL_GROUP_SIZE                not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1   ]                              "
+#error  "                                       [     &&  <= 8192]                              "
+
+#elif  ((FS_FAT_CFG_JOURNAL_GROUP_SIZE <    1u) || \
+        (FS_FAT_CFG_JOURNAL_GROUP_SIZE > 8192u))
+#error  "FS_FAT_CFG_JOURNAL_GROUP_SIZE          illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1   ]                              "
+#error  "                                       [     &&  <= 8192]                              "
+#endif
+
+#ifndef  FS_FAT_CFG_JOURNAL_GROUP_OP_CNT
+#error  "FS_FAT_CFG_JOURNAL_GROUP_OP_CNT              not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+
+#elif   (FS_FAT_CFG_JOURNAL_GROUP_OP_CNT < 1u)
+#error  "FS_FAT_CFG_JOURNAL_GROUP_OP_CNT        illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+#endif
+#endif
+
+
+                                                                /* -------------- FS_FAT_CFG_CLUS_MAP_EN -------------- */
+#ifndef  FS_FAT_CFG_CLUS_MAP_EN
+#error  "FS_FAT_CFG_CLUS_MAP_EN                       not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif  ((FS_FAT_CFG_CLUS_MAP_EN != DEF_DISABLED) && \
+        (FS_FAT_CFG_CLUS_MAP_EN != DEF_ENABLED ))
+#error  "FS_FAT_CFG_CLUS_MAP_EN                 illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif   (FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED)
+#ifndef  FS_FAT_CFG_CLUS_MAP_SIZE
+#error  "FS_FAT_CFG_CLUS_MAP_SIZE                     not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+
+#elif   (FS_FAT_CFG_CLUS_MAP_SIZE < 1u)
+#error  "FS_FAT_CFG_CLUS_MAP_SIZE               illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+#endif
+#endif
+
+#if    ((FS_FAT_CFG_CLUS_MAP_EN == DEF_ENABLED) && \
+        (FS_CFG_RD_ONLY_EN      == DEF_ENABLED))
+#error  "INVALID FS FAT CONFIG                                      in  'fs_cfg.h'              "
+#error  "Cluster map is useless when FS_CFG_RD_ONLY_EN is DEF_ENABLED. FS_FAT_CFG_CLUS_MAP_EN   "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#endif
+
+
+                                                                /* ------------- FS_FAT_CFG_FILE_EXTENT_EN ------------ */
+#ifndef  FS_FAT_CFG_FILE_EXTENT_EN
+#error  "FS_FAT_CFG_FILE_EXTENT_EN                    not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif  ((FS_FAT_CFG_FILE_EXTENT_EN != DEF_DISABLED) && \
+        (FS_FAT_CFG_FILE_EXTENT_EN != DEF_ENABLED ))
+#error  "FS_FAT_CFG_FILE_EXTENT_EN              illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif   (FS_FAT_CFG_FILE_EXTENT_EN == DEF_ENABLED)
+#ifndef  FS_FAT_CFG_FILE_EXTENT_NBR
+#error  "FS_FAT_CFG_FILE_EXTENT_NBR                   not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+
+#elif   (FS_FAT_CFG_FILE_EXTENT_NBR < 1u)
+#error  "FS_FAT_CFG_FILE_EXTENT_NBR             illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+#endif
+#endif
+
+
+                                                                /* -------------- FS_FAT_CFG_DIR_CACHE_EN ------------- */
+#ifndef  FS_FAT_CFG_DIR_CACHE_EN
+#error  "FS_FAT_CFG_DIR_CACHE_EN                      not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif  ((FS_FAT_CFG_DIR_CACHE_EN != DEF_DISABLED) && \
+        (FS_FAT_CFG_DIR_CACHE_EN != DEF_ENABLED ))
+#error  "FS_FAT_CFG_DIR_CACHE_EN                illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  DEF_DISABLED]                         "
+#error  "                                       [     ||  DEF_ENABLED ]                         "
+
+#elif   (FS_FAT_CFG_DIR_CACHE_EN == DEF_ENABLED)
+#ifndef  FS_FAT_CFG_DIR_CACHE_NBR
+#error  "FS_FAT_CFG_DIR_CACHE_NBR                     not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+
+#elif   (FS_FAT_CFG_DIR_CACHE_NBR < 1u)
+#error  "FS_FAT_CFG_DIR_CACHE_NBR               illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 1]                                 "
+#endif
+
+#ifndef  FS_FAT_CFG_DIR_CACHE_NAME_LEN
+#error  "FS_FAT_CFG_DIR_CACHE_NAME_LEN                not #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 12 ]                               "
+#error  "                                       [     &&  <= 255]                               "
+
+#elif  ((FS_FAT_CFG_DIR_CACHE_NAME_LEN <  12u) || \
+        (FS_FAT_CFG_DIR_CACHE_NAME_LEN > 255u))
+#error  "FS_FAT_CFG_DIR_CACHE_NAME_LEN          illegally #define'd in 'fs_cfg.h'               "
+#error  "                                       [MUST be  >= 12 ]                               "
+#error  "                                       [     &&  <= 255]                               "
+#endif
+#endif
+
 #endif
 /*
 *********************************************************************************************************
@@ -123,6 +123,11 @@
                                                                 /* ----------- NAND-DRIVER SPECIFIC OPTIONS ----------- */
 #define  FS_DEV_IO_CTRL_NAND_PARAM_PG_RD                  80u   /* Read parameter-page from ONFI device.                */
 #define  FS_DEV_IO_CTRL_NAND_DUMP                         81u   /* Dump raw NAND dev.                                   */
+#define  FS_DEV_IO_CTRL_NAND_MAINT                        82u   /* Perform one NAND bg maint step.                      */
+#define  FS_DEV_IO_CTRL_NAND_WR_AMP_GET                   83u   /* Get NAND wr amplification ctrs.                      */
+
+                                                                /* ------------ NOR-DRIVER SPECIFIC OPTIONS ----------- */
+#define  FS_DEV_IO_CTRL_NOR_COMPACT_STEP                  96u   /* Perform one NOR bg compaction step.                  */
 
 /*
 *********************************************************************************************************
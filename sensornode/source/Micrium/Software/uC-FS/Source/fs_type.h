@@ -123,6 +123,8 @@ typedef  struct  fs_vol              FS_VOL;
 
 typedef  struct  fs_vol_cache_api    FS_VOL_CACHE_API;
 
+typedef  struct  fs_vol_cache_stat   FS_VOL_CACHE_STAT;
+
 
 /*
 *********************************************************************************************************
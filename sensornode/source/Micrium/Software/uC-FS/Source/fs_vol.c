@@ -393,6 +393,90 @@ void  FSVol_CacheFlush (CPU_CHAR  *name_vol,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        FSVol_CacheStatGet()
+*
+* Description : Get cache statistics of a volume.
+*
+* Argument(s) : name_vol    Volume name.
+*
+*               p_stat      Pointer to structure that will receive the cache statistics.
+*
+*               p_err       Pointer to variable that will the receive the return error code from this function :
+*
+*                               FS_ERR_NONE               Statistics returned.
+*                               FS_ERR_NAME_NULL          Argument 'name_vol' passed a NULL pointer.
+*                               FS_ERR_NULL_PTR           Argument 'p_stat'   passed a NULL pointer.
+*                               FS_ERR_DEV_CHNGD          Device has changed.
+*                               FS_ERR_VOL_NO_CACHE       No cache assigned to volume, or the cache does
+*                                                             NOT keep statistics.
+*                               FS_ERR_VOL_NOT_OPEN       Volume not open.
+*                               FS_ERR_VOL_NOT_MOUNTED    Volume not mounted.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a file system suite application interface (API) function & MAY be called
+*               by application function(s).
+*
+* Note(s)     : (1) The counters are cumulative since the cache was assigned; the queue counts reflect the
+*                   current cache contents.  See 'fs_cache.h  VOLUME CACHE STATISTICS DATA TYPES'.
+*********************************************************************************************************
+*/
+
+#if ((defined(FS_CACHE_MODULE_PRESENT)) && \
+     (FS_CFG_CTR_STAT_EN == DEF_ENABLED))
+void  FSVol_CacheStatGet (CPU_CHAR           *name_vol,
+                          FS_VOL_CACHE_STAT  *p_stat,
+                          FS_ERR             *p_err)
+{
+    FS_VOL  *p_vol;
+
+
+#if (FS_CFG_ERR_ARG_CHK_EXT_EN == DEF_ENABLED)                  /* ------------------- VALIDATE ARGS ------------------ */
+    if (p_err == (FS_ERR *)0) {                                 /* Validate error ptr.                                  */
+        CPU_SW_EXCEPTION(;);
+    }
+    if (name_vol == (CPU_CHAR *)0) {                            /* Validate name ptr.                                   */
+       *p_err = FS_ERR_NAME_NULL;
+        return;
+    }
+    if (p_stat == (FS_VOL_CACHE_STAT *)0) {                     /* Validate stat ptr.                                   */
+       *p_err = FS_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+
+
+                                                                /* ----------------- ACQUIRE VOL LOCK ----------------- */
+    p_vol = FSVol_AcquireLockChk(name_vol, DEF_YES, p_err);     /* Vol MUST be mounted.                                 */
+    if (p_vol == (FS_VOL *)0) {
+        return;
+    }
+
+    if ((p_vol->CacheAPI_Ptr          == (FS_VOL_CACHE_API *)0) ||
+        (p_vol->CacheAPI_Ptr->StatGet ==  0)) {
+       *p_err = FS_ERR_VOL_NO_CACHE;
+        FSVol_ReleaseUnlock(p_vol);
+        return;
+    }
+
+
+
+                                                                /* ------------------ GET CACHE STATS ----------------- */
+    p_vol->CacheAPI_Ptr->StatGet(p_vol, p_stat, p_err);
+
+
+
+                                                                /* ----------------- RELEASE VOL LOCK ----------------- */
+    FSVol_ReleaseUnlock(p_vol);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            FSVol_Close()
@@ -223,6 +223,13 @@ void          FSVol_CacheFlush     (CPU_CHAR          *name_vol,    /* Flush cac
                                     FS_ERR            *p_err);
 #endif
 
+#if ((defined(FS_CACHE_MODULE_PRESENT)) && \
+     (FS_CFG_CTR_STAT_EN == DEF_ENABLED))
+void          FSVol_CacheStatGet   (CPU_CHAR          *name_vol,    /* Get cache stats of a volume.                     */
+                                    FS_VOL_CACHE_STAT *p_stat,
+                                    FS_ERR            *p_err);
+#endif
+
 void          FSVol_Close          (CPU_CHAR          *name_vol,    /* Close (unmount) a volume.                        */
                                     FS_ERR            *p_err);
 